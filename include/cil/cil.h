@@ -30,6 +30,7 @@
 #ifndef CIL_H_
 #define CIL_H_
 
+#include <sys/types.h>
 #include <sepol/policydb/policydb.h>
 
 struct cil_db;
@@ -39,6 +40,9 @@ extern void cil_db_init(cil_db_t **db);
 extern void cil_db_destroy(cil_db_t **db);
 
 extern int cil_add_file(cil_db_t *db, char *name, char *data, size_t size);
+extern int cil_add_file_mapped(cil_db_t *db, char *name, int fd);
+extern int cil_add_files(cil_db_t *db, char **names, int count, int jobs);
+extern int cil_add_stream(cil_db_t *db, char *name, ssize_t (*read_callback)(void *ctx, char *buffer, size_t size), void *ctx);
 
 extern int cil_compile(cil_db_t *db, sepol_policydb_t *sepol_db);
 extern int cil_build_policydb(cil_db_t *db, sepol_policydb_t *sepol_db);
@@ -50,6 +54,14 @@ extern void cil_set_disable_neverallow(cil_db_t *db, int disable_neverallow);
 extern void cil_set_preserve_tunables(cil_db_t *db, int preserve_tunables);
 extern int cil_set_handle_unknown(cil_db_t *db, int handle_unknown);
 extern void cil_set_mls(cil_db_t *db, int mls);
+extern void cil_set_build_on_parse(cil_db_t *db, int build_on_parse);
+extern void cil_set_full_reset(cil_db_t *db, int full_reset);
+extern void cil_set_resolve_jobs(cil_db_t *db, int jobs);
+extern int cil_set_parse_cache(cil_db_t *db, const char *dir);
+extern void cil_get_parse_cache_stats(cil_db_t *db, unsigned int *hits, unsigned int *misses);
+extern void cil_get_resolve_cache_stats(cil_db_t *db, unsigned int *hits, unsigned int *misses);
+extern int cil_db_save(cil_db_t *db, const char *path);
+extern int cil_db_load(cil_db_t **db, const char *path);
 
 enum cil_log_level {
 	CIL_ERR = 1,
@@ -58,6 +70,8 @@ enum cil_log_level {
 };
 extern void cil_set_log_level(enum cil_log_level lvl);
 extern void cil_set_log_handler(void (*handler)(int lvl, char *msg));
+extern void cil_db_set_log_level(cil_db_t *db, enum cil_log_level lvl);
+extern void cil_db_set_log_handler(cil_db_t *db, void (*handler)(int lvl, char *msg));
 
 #ifdef __GNUC__
 __attribute__ ((format(printf, 2, 3)))
@@ -65,5 +79,6 @@ __attribute__ ((format(printf, 2, 3)))
 extern void cil_log(enum cil_log_level lvl, const char *msg, ...);
 
 extern void cil_set_malloc_error_handler(void (*handler)(void));
+extern void cil_db_set_malloc_error_handler(cil_db_t *db, void (*handler)(void));
 
 #endif
@@ -37,6 +37,8 @@
 #include <cil/cil.h>
 #include <sepol/policydb.h>
 
+#define OPT_PARSE_CACHE 256
+
 void usage(char *prog)
 {
 	printf("Usage: %s [OPTION]... FILE...\n", prog);
@@ -60,6 +62,13 @@ void usage(char *prog)
 	printf("  -D, --disable-dontaudit        do not add dontaudit rules to the binary policy\n");
 	printf("  -P, --preserve-tunables        treat tunables as booleans\n");
 	printf("  -N, --disable-neverallow       do not check neverallow rules\n");
+	printf("  -n, --no-mmap                  read input files into memory instead of\n");
+	printf("                                 mapping them\n");
+	printf("  -j, --jobs=<count>             parse up to <count> files and resolve\n");
+	printf("                                 statements on up to <count> threads at once.\n");
+	printf("                                 0 uses one job per online CPU. (default: 1)\n");
+	printf("      --parse-cache=<dir>        reuse parse results for unchanged files from\n");
+	printf("                                 <dir>, and store new ones there\n");
 	printf("  -v, --verbose                  increment verbosity level\n");
 	printf("  -h, --help                     display usage information\n");
 	exit(1);
@@ -78,12 +87,17 @@ int main(int argc, char *argv[])
 	uint32_t file_size;
 	char *output = NULL;
 	char *filecontexts = NULL;
+	char *parse_cache = NULL;
+	unsigned int cache_hits;
+	unsigned int cache_misses;
 	struct cil_db *db = NULL;
 	int target = SEPOL_TARGET_SELINUX;
 	int mls = -1;
 	int disable_dontaudit = 0;
 	int disable_neverallow = 0;
 	int preserve_tunables = 0;
+	int use_mmap = 1;
+	int jobs = 1;
 	int handle_unknown = -1;
 	int policyvers = POLICYDB_VERSION_MAX;
 	int opt_char;
@@ -101,6 +115,9 @@ int main(int argc, char *argv[])
 		{"disable-dontaudit", no_argument, 0, 'D'},
 		{"disable-neverallow", no_argument, 0, 'N'},
 		{"preserve-tunables", no_argument, 0, 'P'},
+		{"no-mmap", no_argument, 0, 'n'},
+		{"jobs", required_argument, 0, 'j'},
+		{"parse-cache", required_argument, 0, OPT_PARSE_CACHE},
 		{"output", required_argument, 0, 'o'},
 		{"filecontexts", required_argument, 0, 'f'},
 		{0, 0, 0, 0}
@@ -108,7 +125,7 @@ int main(int argc, char *argv[])
 	int i;
 
 	while (1) {
-		opt_char = getopt_long(argc, argv, "o:f:U:hvt:M:PDNc:", long_opts, &opt_index);
+		opt_char = getopt_long(argc, argv, "o:f:U:hvt:M:PDNnj:c:", long_opts, &opt_index);
 		if (opt_char == -1) {
 			break;
 		}
@@ -170,6 +187,22 @@ int main(int argc, char *argv[])
 			case 'P':
 				preserve_tunables = 1;
 				break;
+			case 'n':
+				use_mmap = 0;
+				break;
+			case 'j': {
+				char *endptr = NULL;
+				errno = 0;
+				jobs = strtol(optarg, &endptr, 10);
+				if (errno != 0 || endptr == optarg || *endptr != '\0' || jobs < 0) {
+					fprintf(stderr, "Bad job count: %s\n", optarg);
+					usage(argv[0]);
+				}
+				break;
+			}
+			case OPT_PARSE_CACHE:
+				parse_cache = strdup(optarg);
+				break;
 			case 'o':
 				output = strdup(optarg);
 				break;
@@ -204,8 +237,24 @@ int main(int argc, char *argv[])
 	}
 
 	cil_set_mls(db, mls);
+	cil_set_build_on_parse(db, 1);
+	cil_set_resolve_jobs(db, jobs);
+	if (parse_cache != NULL) {
+		rc = cil_set_parse_cache(db, parse_cache);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+	}
+
+	if (use_mmap) {
+		rc = cil_add_files(db, &argv[optind], argc - optind, jobs);
+		if (rc != SEPOL_OK) {
+			cil_log(CIL_ERR, "Failure adding files\n");
+			goto exit;
+		}
+	}
 
-	for (i = optind; i < argc; i++) {
+	for (i = optind; i < argc && !use_mmap; i++) {
 		file = fopen(argv[i], "r");
 		if (!file) {
 			cil_log(CIL_ERR, "Could not open file: %s\n", argv[i]);
@@ -238,6 +287,11 @@ int main(int argc, char *argv[])
 		buffer = NULL;
 	}
 
+	if (parse_cache != NULL) {
+		cil_get_parse_cache_stats(db, &cache_hits, &cache_misses);
+		cil_log(CIL_WARN, "Parse cache: %u hits, %u misses\n", cache_hits, cache_misses);
+	}
+
 	rc = sepol_policydb_create(&pdb);
 	if (rc < 0) {
 		cil_log(CIL_ERR, "Failed to create policy db\n");
@@ -257,6 +311,9 @@ int main(int argc, char *argv[])
 		goto exit;
 	}
 
+	cil_get_resolve_cache_stats(db, &cache_hits, &cache_misses);
+	cil_log(CIL_WARN, "Name resolution cache: %u hits, %u misses\n", cache_hits, cache_misses);
+
 	rc = cil_build_policydb(db, pdb);
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_ERR, "Failed to build policydb\n");
@@ -345,6 +402,7 @@ exit:
 	free(buffer);
 	free(output);
 	free(filecontexts);
+	free(parse_cache);
 	cil_db_destroy(&db);
 	sepol_policydb_free(pdb);
 	sepol_policy_file_free(pf);
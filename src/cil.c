@@ -29,15 +29,22 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <sepol/policydb/policydb.h>
-#include <sepol/policydb/symtab.h>
 
 #include "cil_internal.h"
 #include "cil_flavor.h"
 #include "cil_log.h"
 #include "cil_mem.h"
+#include "cil_arena.h"
 #include "cil_tree.h"
+#include "cil_index.h"
 #include "cil_list.h"
 #include "cil_symtab.h"
 #include "cil_build_ast.h"
@@ -50,10 +57,14 @@
 #include "cil_binary.h"
 #include "cil_policy.h"
 #include "cil_strpool.h"
+#include "cil_parse_cache.h"
+#include "cil_resolve_cache.h"
+#include "cil_reset_ast.h"
+#include "cil_snapshot.h"
 
 int cil_sym_sizes[CIL_SYM_ARRAY_NUM][CIL_SYM_NUM] = {
 	{64, 64, 64, 1 << 13, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64},
-	{64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64},
+	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
 	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
 	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
 	{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}
@@ -62,160 +73,180 @@ int cil_sym_sizes[CIL_SYM_ARRAY_NUM][CIL_SYM_NUM] = {
 static void cil_init_keys(void)
 {
 	/* Initialize CIL Keys into strpool */
-	CIL_KEY_CONS_T1 = cil_strpool_add("t1");
-	CIL_KEY_CONS_T2 = cil_strpool_add("t2");
-	CIL_KEY_CONS_T3 = cil_strpool_add("t3");
-	CIL_KEY_CONS_R1 = cil_strpool_add("r1");
-	CIL_KEY_CONS_R2 = cil_strpool_add("r2");
-	CIL_KEY_CONS_R3 = cil_strpool_add("r3");
-	CIL_KEY_CONS_U1 = cil_strpool_add("u1");
-	CIL_KEY_CONS_U2 = cil_strpool_add("u2");
-	CIL_KEY_CONS_U3 = cil_strpool_add("u3");
-	CIL_KEY_CONS_L1 = cil_strpool_add("l1");
-	CIL_KEY_CONS_L2 = cil_strpool_add("l2");
-	CIL_KEY_CONS_H1 = cil_strpool_add("h1");
-	CIL_KEY_CONS_H2 = cil_strpool_add("h2");
-	CIL_KEY_AND = cil_strpool_add("and");
-	CIL_KEY_OR = cil_strpool_add("or");
-	CIL_KEY_NOT = cil_strpool_add("not");
-	CIL_KEY_EQ = cil_strpool_add("eq");
-	CIL_KEY_NEQ = cil_strpool_add("neq");
-	CIL_KEY_CONS_DOM = cil_strpool_add("dom");
-	CIL_KEY_CONS_DOMBY = cil_strpool_add("domby");
-	CIL_KEY_CONS_INCOMP = cil_strpool_add("incomp");
-	CIL_KEY_CONDTRUE = cil_strpool_add("true");
-	CIL_KEY_CONDFALSE = cil_strpool_add("false");
-	CIL_KEY_SELF = cil_strpool_add("self");
-	CIL_KEY_OBJECT_R = cil_strpool_add("object_r");
-	CIL_KEY_STAR = cil_strpool_add("*");
-	CIL_KEY_UDP = cil_strpool_add("udp");
-	CIL_KEY_TCP = cil_strpool_add("tcp");
-	CIL_KEY_AUDITALLOW = cil_strpool_add("auditallow");
-	CIL_KEY_TUNABLEIF = cil_strpool_add("tunableif");
-	CIL_KEY_ALLOW = cil_strpool_add("allow");
-	CIL_KEY_DONTAUDIT = cil_strpool_add("dontaudit");
-	CIL_KEY_TYPETRANSITION = cil_strpool_add("typetransition");
-	CIL_KEY_TYPECHANGE = cil_strpool_add("typechange");
-	CIL_KEY_CALL = cil_strpool_add("call");
-	CIL_KEY_TUNABLE = cil_strpool_add("tunable");
-	CIL_KEY_XOR = cil_strpool_add("xor");
-	CIL_KEY_ALL = cil_strpool_add("all");
-	CIL_KEY_RANGE = cil_strpool_add("range");
-	CIL_KEY_TYPE = cil_strpool_add("type");
-	CIL_KEY_ROLE = cil_strpool_add("role");
-	CIL_KEY_USER = cil_strpool_add("user");
-	CIL_KEY_SENSITIVITY = cil_strpool_add("sensitivity");
-	CIL_KEY_CATEGORY = cil_strpool_add("category");
-	CIL_KEY_CATSET = cil_strpool_add("categoryset");
-	CIL_KEY_LEVEL = cil_strpool_add("level");
-	CIL_KEY_LEVELRANGE = cil_strpool_add("levelrange");
-	CIL_KEY_CLASS = cil_strpool_add("class");
-	CIL_KEY_IPADDR = cil_strpool_add("ipaddr");
-	CIL_KEY_MAP_CLASS = cil_strpool_add("classmap");
-	CIL_KEY_CLASSPERMISSION = cil_strpool_add("classpermission");
-	CIL_KEY_BOOL = cil_strpool_add("boolean");
-	CIL_KEY_STRING = cil_strpool_add("string");
-	CIL_KEY_NAME = cil_strpool_add("name");
-	CIL_KEY_HANDLEUNKNOWN = cil_strpool_add("handleunknown");
-	CIL_KEY_HANDLEUNKNOWN_ALLOW = cil_strpool_add("allow");
-	CIL_KEY_HANDLEUNKNOWN_DENY = cil_strpool_add("deny");
-	CIL_KEY_HANDLEUNKNOWN_REJECT = cil_strpool_add("reject");
-	CIL_KEY_BLOCKINHERIT = cil_strpool_add("blockinherit");
-	CIL_KEY_BLOCKABSTRACT = cil_strpool_add("blockabstract");
-	CIL_KEY_CLASSORDER = cil_strpool_add("classorder");
-	CIL_KEY_CLASSMAPPING = cil_strpool_add("classmapping");
-	CIL_KEY_CLASSPERMISSIONSET = cil_strpool_add("classpermissionset");
-	CIL_KEY_COMMON = cil_strpool_add("common");
-	CIL_KEY_CLASSCOMMON = cil_strpool_add("classcommon");
-	CIL_KEY_SID = cil_strpool_add("sid");
-	CIL_KEY_SIDCONTEXT = cil_strpool_add("sidcontext");
-	CIL_KEY_SIDORDER = cil_strpool_add("sidorder");
-	CIL_KEY_USERLEVEL = cil_strpool_add("userlevel");
-	CIL_KEY_USERRANGE = cil_strpool_add("userrange");
-	CIL_KEY_USERBOUNDS = cil_strpool_add("userbounds");
-	CIL_KEY_USERPREFIX = cil_strpool_add("userprefix");
-	CIL_KEY_SELINUXUSER = cil_strpool_add("selinuxuser");
-	CIL_KEY_SELINUXUSERDEFAULT = cil_strpool_add("selinuxuserdefault");
-	CIL_KEY_TYPEATTRIBUTE = cil_strpool_add("typeattribute");
-	CIL_KEY_TYPEATTRIBUTESET = cil_strpool_add("typeattributeset");
-	CIL_KEY_TYPEALIAS = cil_strpool_add("typealias");
-	CIL_KEY_TYPEALIASACTUAL = cil_strpool_add("typealiasactual");
-	CIL_KEY_TYPEBOUNDS = cil_strpool_add("typebounds");
-	CIL_KEY_TYPEPERMISSIVE = cil_strpool_add("typepermissive");
-	CIL_KEY_RANGETRANSITION = cil_strpool_add("rangetransition");
-	CIL_KEY_USERROLE = cil_strpool_add("userrole");
-	CIL_KEY_ROLETYPE = cil_strpool_add("roletype");
-	CIL_KEY_ROLETRANSITION = cil_strpool_add("roletransition");
-	CIL_KEY_ROLEALLOW = cil_strpool_add("roleallow");
-	CIL_KEY_ROLEATTRIBUTE = cil_strpool_add("roleattribute");
-	CIL_KEY_ROLEATTRIBUTESET = cil_strpool_add("roleattributeset");
-	CIL_KEY_ROLEBOUNDS = cil_strpool_add("rolebounds");
-	CIL_KEY_BOOLEANIF = cil_strpool_add("booleanif");
-	CIL_KEY_NEVERALLOW = cil_strpool_add("neverallow");
-	CIL_KEY_TYPEMEMBER = cil_strpool_add("typemember");
-	CIL_KEY_SENSALIAS = cil_strpool_add("sensitivityalias");
-	CIL_KEY_SENSALIASACTUAL = cil_strpool_add("sensitivityaliasactual");
-	CIL_KEY_CATALIAS = cil_strpool_add("categoryalias");
-	CIL_KEY_CATALIASACTUAL = cil_strpool_add("categoryaliasactual");
-	CIL_KEY_CATORDER = cil_strpool_add("categoryorder");
-	CIL_KEY_SENSITIVITYORDER = cil_strpool_add("sensitivityorder");
-	CIL_KEY_SENSCAT = cil_strpool_add("sensitivitycategory");
-	CIL_KEY_CONSTRAIN = cil_strpool_add("constrain");
-	CIL_KEY_MLSCONSTRAIN = cil_strpool_add("mlsconstrain");
-	CIL_KEY_VALIDATETRANS = cil_strpool_add("validatetrans");
-	CIL_KEY_MLSVALIDATETRANS = cil_strpool_add("mlsvalidatetrans");
-	CIL_KEY_CONTEXT = cil_strpool_add("context");
-	CIL_KEY_FILECON = cil_strpool_add("filecon");
-	CIL_KEY_PORTCON = cil_strpool_add("portcon");
-	CIL_KEY_NODECON = cil_strpool_add("nodecon");
-	CIL_KEY_GENFSCON = cil_strpool_add("genfscon");
-	CIL_KEY_NETIFCON = cil_strpool_add("netifcon");
-	CIL_KEY_PIRQCON = cil_strpool_add("pirqcon");
-	CIL_KEY_IOMEMCON = cil_strpool_add("iomemcon");
-	CIL_KEY_IOPORTCON = cil_strpool_add("ioportcon");
-	CIL_KEY_PCIDEVICECON = cil_strpool_add("pcidevicecon");
-	CIL_KEY_FSUSE = cil_strpool_add("fsuse");
-	CIL_KEY_POLICYCAP = cil_strpool_add("policycap");
-	CIL_KEY_OPTIONAL = cil_strpool_add("optional");
-	CIL_KEY_DEFAULTUSER = cil_strpool_add("defaultuser");
-	CIL_KEY_DEFAULTROLE = cil_strpool_add("defaultrole");
-	CIL_KEY_DEFAULTTYPE = cil_strpool_add("defaulttype");
-	CIL_KEY_MACRO = cil_strpool_add("macro");
-	CIL_KEY_IN = cil_strpool_add("in");
-	CIL_KEY_MLS = cil_strpool_add("mls");
-	CIL_KEY_DEFAULTRANGE = cil_strpool_add("defaultrange");
-	CIL_KEY_GLOB = cil_strpool_add("*");
-	CIL_KEY_FILE = cil_strpool_add("file");
-	CIL_KEY_DIR = cil_strpool_add("dir");
-	CIL_KEY_CHAR = cil_strpool_add("char");
-	CIL_KEY_BLOCK = cil_strpool_add("block");
-	CIL_KEY_SOCKET = cil_strpool_add("socket");
-	CIL_KEY_PIPE = cil_strpool_add("pipe");
-	CIL_KEY_SYMLINK = cil_strpool_add("symlink");
-	CIL_KEY_ANY = cil_strpool_add("any");
-	CIL_KEY_XATTR = cil_strpool_add("xattr");
-	CIL_KEY_TASK = cil_strpool_add("task");
-	CIL_KEY_TRANS = cil_strpool_add("trans");
-	CIL_KEY_SOURCE = cil_strpool_add("source");
-	CIL_KEY_TARGET = cil_strpool_add("target");
-	CIL_KEY_LOW = cil_strpool_add("low");
-	CIL_KEY_HIGH = cil_strpool_add("high");
-	CIL_KEY_LOW_HIGH = cil_strpool_add("low-high");
-	CIL_KEY_ROOT = cil_strpool_add("<root>");
-	CIL_KEY_NODE = cil_strpool_add("<node>");
-	CIL_KEY_PERM = cil_strpool_add("perm");
-}
+	CIL_KEY_CONS_T1 = cil_strpool_add_key("t1");
+	CIL_KEY_CONS_T2 = cil_strpool_add_key("t2");
+	CIL_KEY_CONS_T3 = cil_strpool_add_key("t3");
+	CIL_KEY_CONS_R1 = cil_strpool_add_key("r1");
+	CIL_KEY_CONS_R2 = cil_strpool_add_key("r2");
+	CIL_KEY_CONS_R3 = cil_strpool_add_key("r3");
+	CIL_KEY_CONS_U1 = cil_strpool_add_key("u1");
+	CIL_KEY_CONS_U2 = cil_strpool_add_key("u2");
+	CIL_KEY_CONS_U3 = cil_strpool_add_key("u3");
+	CIL_KEY_CONS_L1 = cil_strpool_add_key("l1");
+	CIL_KEY_CONS_L2 = cil_strpool_add_key("l2");
+	CIL_KEY_CONS_H1 = cil_strpool_add_key("h1");
+	CIL_KEY_CONS_H2 = cil_strpool_add_key("h2");
+	CIL_KEY_AND = cil_strpool_add_key("and");
+	CIL_KEY_OR = cil_strpool_add_key("or");
+	CIL_KEY_NOT = cil_strpool_add_key("not");
+	CIL_KEY_EQ = cil_strpool_add_key("eq");
+	CIL_KEY_NEQ = cil_strpool_add_key("neq");
+	CIL_KEY_CONS_DOM = cil_strpool_add_key("dom");
+	CIL_KEY_CONS_DOMBY = cil_strpool_add_key("domby");
+	CIL_KEY_CONS_INCOMP = cil_strpool_add_key("incomp");
+	CIL_KEY_CONDTRUE = cil_strpool_add_keyword("true", CIL_KEYWORD_CONDTRUE);
+	CIL_KEY_CONDFALSE = cil_strpool_add_keyword("false", CIL_KEYWORD_CONDFALSE);
+	CIL_KEY_SELF = cil_strpool_add_key("self");
+	CIL_KEY_OBJECT_R = cil_strpool_add_key("object_r");
+	CIL_KEY_STAR = cil_strpool_add_key("*");
+	CIL_KEY_UDP = cil_strpool_add_key("udp");
+	CIL_KEY_TCP = cil_strpool_add_key("tcp");
+	CIL_KEY_AUDITALLOW = cil_strpool_add_keyword("auditallow", CIL_KEYWORD_AUDITALLOW);
+	CIL_KEY_TUNABLEIF = cil_strpool_add_keyword("tunableif", CIL_KEYWORD_TUNABLEIF);
+	CIL_KEY_ALLOW = cil_strpool_add_keyword("allow", CIL_KEYWORD_ALLOW);
+	CIL_KEY_DONTAUDIT = cil_strpool_add_keyword("dontaudit", CIL_KEYWORD_DONTAUDIT);
+	CIL_KEY_TYPETRANSITION = cil_strpool_add_keyword("typetransition", CIL_KEYWORD_TYPETRANSITION);
+	CIL_KEY_TYPECHANGE = cil_strpool_add_keyword("typechange", CIL_KEYWORD_TYPECHANGE);
+	CIL_KEY_CALL = cil_strpool_add_keyword("call", CIL_KEYWORD_CALL);
+	CIL_KEY_TUNABLE = cil_strpool_add_keyword("tunable", CIL_KEYWORD_TUNABLE);
+	CIL_KEY_XOR = cil_strpool_add_key("xor");
+	CIL_KEY_ALL = cil_strpool_add_key("all");
+	CIL_KEY_RANGE = cil_strpool_add_key("range");
+	CIL_KEY_TYPE = cil_strpool_add_keyword("type", CIL_KEYWORD_TYPE);
+	CIL_KEY_ROLE = cil_strpool_add_keyword("role", CIL_KEYWORD_ROLE);
+	CIL_KEY_USER = cil_strpool_add_keyword("user", CIL_KEYWORD_USER);
+	CIL_KEY_SENSITIVITY = cil_strpool_add_keyword("sensitivity", CIL_KEYWORD_SENSITIVITY);
+	CIL_KEY_CATEGORY = cil_strpool_add_keyword("category", CIL_KEYWORD_CATEGORY);
+	CIL_KEY_CATSET = cil_strpool_add_keyword("categoryset", CIL_KEYWORD_CATSET);
+	CIL_KEY_LEVEL = cil_strpool_add_keyword("level", CIL_KEYWORD_LEVEL);
+	CIL_KEY_LEVELRANGE = cil_strpool_add_keyword("levelrange", CIL_KEYWORD_LEVELRANGE);
+	CIL_KEY_CLASS = cil_strpool_add_keyword("class", CIL_KEYWORD_CLASS);
+	CIL_KEY_IPADDR = cil_strpool_add_keyword("ipaddr", CIL_KEYWORD_IPADDR);
+	CIL_KEY_MAP_CLASS = cil_strpool_add_keyword("classmap", CIL_KEYWORD_MAP_CLASS);
+	CIL_KEY_CLASSPERMISSION = cil_strpool_add_keyword("classpermission", CIL_KEYWORD_CLASSPERMISSION);
+	CIL_KEY_BOOL = cil_strpool_add_keyword("boolean", CIL_KEYWORD_BOOL);
+	CIL_KEY_STRING = cil_strpool_add_key("string");
+	CIL_KEY_NAME = cil_strpool_add_key("name");
+	CIL_KEY_HANDLEUNKNOWN = cil_strpool_add_keyword("handleunknown", CIL_KEYWORD_HANDLEUNKNOWN);
+	CIL_KEY_HANDLEUNKNOWN_ALLOW = cil_strpool_add_key("allow");
+	CIL_KEY_HANDLEUNKNOWN_DENY = cil_strpool_add_key("deny");
+	CIL_KEY_HANDLEUNKNOWN_REJECT = cil_strpool_add_key("reject");
+	CIL_KEY_BLOCKINHERIT = cil_strpool_add_keyword("blockinherit", CIL_KEYWORD_BLOCKINHERIT);
+	CIL_KEY_BLOCKABSTRACT = cil_strpool_add_keyword("blockabstract", CIL_KEYWORD_BLOCKABSTRACT);
+	CIL_KEY_CLASSORDER = cil_strpool_add_keyword("classorder", CIL_KEYWORD_CLASSORDER);
+	CIL_KEY_CLASSMAPPING = cil_strpool_add_keyword("classmapping", CIL_KEYWORD_CLASSMAPPING);
+	CIL_KEY_CLASSPERMISSIONSET = cil_strpool_add_keyword("classpermissionset", CIL_KEYWORD_CLASSPERMISSIONSET);
+	CIL_KEY_COMMON = cil_strpool_add_keyword("common", CIL_KEYWORD_COMMON);
+	CIL_KEY_CLASSCOMMON = cil_strpool_add_keyword("classcommon", CIL_KEYWORD_CLASSCOMMON);
+	CIL_KEY_SID = cil_strpool_add_keyword("sid", CIL_KEYWORD_SID);
+	CIL_KEY_SIDCONTEXT = cil_strpool_add_keyword("sidcontext", CIL_KEYWORD_SIDCONTEXT);
+	CIL_KEY_SIDORDER = cil_strpool_add_keyword("sidorder", CIL_KEYWORD_SIDORDER);
+	CIL_KEY_USERLEVEL = cil_strpool_add_keyword("userlevel", CIL_KEYWORD_USERLEVEL);
+	CIL_KEY_USERRANGE = cil_strpool_add_keyword("userrange", CIL_KEYWORD_USERRANGE);
+	CIL_KEY_USERBOUNDS = cil_strpool_add_keyword("userbounds", CIL_KEYWORD_USERBOUNDS);
+	CIL_KEY_USERPREFIX = cil_strpool_add_keyword("userprefix", CIL_KEYWORD_USERPREFIX);
+	CIL_KEY_SELINUXUSER = cil_strpool_add_keyword("selinuxuser", CIL_KEYWORD_SELINUXUSER);
+	CIL_KEY_SELINUXUSERDEFAULT = cil_strpool_add_keyword("selinuxuserdefault", CIL_KEYWORD_SELINUXUSERDEFAULT);
+	CIL_KEY_TYPEATTRIBUTE = cil_strpool_add_keyword("typeattribute", CIL_KEYWORD_TYPEATTRIBUTE);
+	CIL_KEY_TYPEATTRIBUTESET = cil_strpool_add_keyword("typeattributeset", CIL_KEYWORD_TYPEATTRIBUTESET);
+	CIL_KEY_TYPEALIAS = cil_strpool_add_keyword("typealias", CIL_KEYWORD_TYPEALIAS);
+	CIL_KEY_TYPEALIASACTUAL = cil_strpool_add_keyword("typealiasactual", CIL_KEYWORD_TYPEALIASACTUAL);
+	CIL_KEY_TYPEBOUNDS = cil_strpool_add_keyword("typebounds", CIL_KEYWORD_TYPEBOUNDS);
+	CIL_KEY_TYPEPERMISSIVE = cil_strpool_add_keyword("typepermissive", CIL_KEYWORD_TYPEPERMISSIVE);
+	CIL_KEY_RANGETRANSITION = cil_strpool_add_keyword("rangetransition", CIL_KEYWORD_RANGETRANSITION);
+	CIL_KEY_USERROLE = cil_strpool_add_keyword("userrole", CIL_KEYWORD_USERROLE);
+	CIL_KEY_ROLETYPE = cil_strpool_add_keyword("roletype", CIL_KEYWORD_ROLETYPE);
+	CIL_KEY_ROLETRANSITION = cil_strpool_add_keyword("roletransition", CIL_KEYWORD_ROLETRANSITION);
+	CIL_KEY_ROLEALLOW = cil_strpool_add_keyword("roleallow", CIL_KEYWORD_ROLEALLOW);
+	CIL_KEY_ROLEATTRIBUTE = cil_strpool_add_keyword("roleattribute", CIL_KEYWORD_ROLEATTRIBUTE);
+	CIL_KEY_ROLEATTRIBUTESET = cil_strpool_add_keyword("roleattributeset", CIL_KEYWORD_ROLEATTRIBUTESET);
+	CIL_KEY_ROLEBOUNDS = cil_strpool_add_keyword("rolebounds", CIL_KEYWORD_ROLEBOUNDS);
+	CIL_KEY_BOOLEANIF = cil_strpool_add_keyword("booleanif", CIL_KEYWORD_BOOLEANIF);
+	CIL_KEY_NEVERALLOW = cil_strpool_add_keyword("neverallow", CIL_KEYWORD_NEVERALLOW);
+	CIL_KEY_TYPEMEMBER = cil_strpool_add_keyword("typemember", CIL_KEYWORD_TYPEMEMBER);
+	CIL_KEY_SENSALIAS = cil_strpool_add_keyword("sensitivityalias", CIL_KEYWORD_SENSALIAS);
+	CIL_KEY_SENSALIASACTUAL = cil_strpool_add_keyword("sensitivityaliasactual", CIL_KEYWORD_SENSALIASACTUAL);
+	CIL_KEY_CATALIAS = cil_strpool_add_keyword("categoryalias", CIL_KEYWORD_CATALIAS);
+	CIL_KEY_CATALIASACTUAL = cil_strpool_add_keyword("categoryaliasactual", CIL_KEYWORD_CATALIASACTUAL);
+	CIL_KEY_CATORDER = cil_strpool_add_keyword("categoryorder", CIL_KEYWORD_CATORDER);
+	CIL_KEY_SENSITIVITYORDER = cil_strpool_add_keyword("sensitivityorder", CIL_KEYWORD_SENSITIVITYORDER);
+	CIL_KEY_SENSCAT = cil_strpool_add_keyword("sensitivitycategory", CIL_KEYWORD_SENSCAT);
+	CIL_KEY_CONSTRAIN = cil_strpool_add_keyword("constrain", CIL_KEYWORD_CONSTRAIN);
+	CIL_KEY_MLSCONSTRAIN = cil_strpool_add_keyword("mlsconstrain", CIL_KEYWORD_MLSCONSTRAIN);
+	CIL_KEY_VALIDATETRANS = cil_strpool_add_keyword("validatetrans", CIL_KEYWORD_VALIDATETRANS);
+	CIL_KEY_MLSVALIDATETRANS = cil_strpool_add_keyword("mlsvalidatetrans", CIL_KEYWORD_MLSVALIDATETRANS);
+	CIL_KEY_CONTEXT = cil_strpool_add_keyword("context", CIL_KEYWORD_CONTEXT);
+	CIL_KEY_FILECON = cil_strpool_add_keyword("filecon", CIL_KEYWORD_FILECON);
+	CIL_KEY_PORTCON = cil_strpool_add_keyword("portcon", CIL_KEYWORD_PORTCON);
+	CIL_KEY_NODECON = cil_strpool_add_keyword("nodecon", CIL_KEYWORD_NODECON);
+	CIL_KEY_GENFSCON = cil_strpool_add_keyword("genfscon", CIL_KEYWORD_GENFSCON);
+	CIL_KEY_NETIFCON = cil_strpool_add_keyword("netifcon", CIL_KEYWORD_NETIFCON);
+	CIL_KEY_PIRQCON = cil_strpool_add_keyword("pirqcon", CIL_KEYWORD_PIRQCON);
+	CIL_KEY_IOMEMCON = cil_strpool_add_keyword("iomemcon", CIL_KEYWORD_IOMEMCON);
+	CIL_KEY_IOPORTCON = cil_strpool_add_keyword("ioportcon", CIL_KEYWORD_IOPORTCON);
+	CIL_KEY_PCIDEVICECON = cil_strpool_add_keyword("pcidevicecon", CIL_KEYWORD_PCIDEVICECON);
+	CIL_KEY_FSUSE = cil_strpool_add_keyword("fsuse", CIL_KEYWORD_FSUSE);
+	CIL_KEY_POLICYCAP = cil_strpool_add_keyword("policycap", CIL_KEYWORD_POLICYCAP);
+	CIL_KEY_OPTIONAL = cil_strpool_add_keyword("optional", CIL_KEYWORD_OPTIONAL);
+	CIL_KEY_DEFAULTUSER = cil_strpool_add_keyword("defaultuser", CIL_KEYWORD_DEFAULTUSER);
+	CIL_KEY_DEFAULTROLE = cil_strpool_add_keyword("defaultrole", CIL_KEYWORD_DEFAULTROLE);
+	CIL_KEY_DEFAULTTYPE = cil_strpool_add_keyword("defaulttype", CIL_KEYWORD_DEFAULTTYPE);
+	CIL_KEY_MACRO = cil_strpool_add_keyword("macro", CIL_KEYWORD_MACRO);
+	CIL_KEY_IN = cil_strpool_add_keyword("in", CIL_KEYWORD_IN);
+	CIL_KEY_MLS = cil_strpool_add_keyword("mls", CIL_KEYWORD_MLS);
+	CIL_KEY_DEFAULTRANGE = cil_strpool_add_keyword("defaultrange", CIL_KEYWORD_DEFAULTRANGE);
+	CIL_KEY_GLOB = cil_strpool_add_key("*");
+	CIL_KEY_FILE = cil_strpool_add_key("file");
+	CIL_KEY_DIR = cil_strpool_add_key("dir");
+	CIL_KEY_CHAR = cil_strpool_add_key("char");
+	CIL_KEY_BLOCK = cil_strpool_add_keyword("block", CIL_KEYWORD_BLOCK);
+	CIL_KEY_SOCKET = cil_strpool_add_key("socket");
+	CIL_KEY_PIPE = cil_strpool_add_key("pipe");
+	CIL_KEY_SYMLINK = cil_strpool_add_key("symlink");
+	CIL_KEY_ANY = cil_strpool_add_key("any");
+	CIL_KEY_XATTR = cil_strpool_add_key("xattr");
+	CIL_KEY_TASK = cil_strpool_add_key("task");
+	CIL_KEY_TRANS = cil_strpool_add_key("trans");
+	CIL_KEY_SOURCE = cil_strpool_add_key("source");
+	CIL_KEY_TARGET = cil_strpool_add_key("target");
+	CIL_KEY_LOW = cil_strpool_add_key("low");
+	CIL_KEY_HIGH = cil_strpool_add_key("high");
+	CIL_KEY_LOW_HIGH = cil_strpool_add_key("low-high");
+	CIL_KEY_ROOT = cil_strpool_add_key("<root>");
+	CIL_KEY_NODE = cil_strpool_add_key("<node>");
+	CIL_KEY_PERM = cil_strpool_add_key("perm");
+}
+
+/* The string pool, and with it the CIL_KEY_* strings, is shared by every
+ * db. It is made along with the first db and freed along with the last. */
+static pthread_mutex_t cil_db_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int cil_db_count = 0;
 
 void cil_db_init(struct cil_db **db)
 {
+	struct cil_db_thread prev;
+
 	*db = cil_malloc(sizeof(**db));
+	(*db)->log_level = 0;
+	(*db)->log_handler = NULL;
+	(*db)->mem_error_handler = NULL;
+
+	pthread_mutex_lock(&cil_db_mutex);
+	if (cil_db_count++ == 0) {
+		cil_strpool_init();
+		cil_init_keys();
+	}
+	pthread_mutex_unlock(&cil_db_mutex);
 
-	cil_strpool_init();
-	cil_init_keys();
+	/* Everything hanging off the db is allocated from its arena */
+	cil_arena_init(&(*db)->arena);
+	cil_tree_locs_init(&(*db)->locs);
+	cil_db_enter(*db, &prev);
 
-	cil_tree_init(&(*db)->parse);
+	(*db)->parse = NULL;
 	cil_tree_init(&(*db)->ast);
 	cil_root_init((struct cil_root **)&(*db)->ast->root->data);
+	(*db)->index = NULL;
 	(*db)->sidorder = NULL;
 	(*db)->classorder = NULL;
 	(*db)->catorder = NULL;
@@ -249,47 +280,94 @@ void cil_db_init(struct cil_db **db)
 	(*db)->preserve_tunables = CIL_FALSE;
 	(*db)->handle_unknown = -1;
 	(*db)->mls = -1;
+	(*db)->build_on_parse = CIL_FALSE;
+	(*db)->full_reset = CIL_FALSE;
+	(*db)->resolve_jobs = 1;
+	(*db)->resolve_arenas = NULL;
+	(*db)->num_resolve_arenas = 0;
+	(*db)->parse_cache = NULL;
+	cil_resolve_cache_init(&(*db)->resolve_cache);
+	(*db)->compiled_tail = NULL;
+	(*db)->base = NULL;
+
+	cil_db_leave(&prev);
 }
 
 void cil_db_destroy(struct cil_db **db)
 {
+	struct cil_db_thread prev;
+	int i;
+
 	if (db == NULL || *db == NULL) {
 		return;
 	}
 
-	cil_tree_destroy(&(*db)->parse);
-	cil_tree_destroy(&(*db)->ast);
-	cil_list_destroy(&(*db)->sidorder, CIL_FALSE);
-	cil_list_destroy(&(*db)->classorder, CIL_FALSE);
-	cil_list_destroy(&(*db)->catorder, CIL_FALSE);
-	cil_list_destroy(&(*db)->sensitivityorder, CIL_FALSE);
-	cil_sort_destroy(&(*db)->netifcon);
-	cil_sort_destroy(&(*db)->genfscon);
-	cil_sort_destroy(&(*db)->filecon);
-	cil_sort_destroy(&(*db)->nodecon);
-	cil_sort_destroy(&(*db)->portcon);
-	cil_sort_destroy(&(*db)->pirqcon);
-	cil_sort_destroy(&(*db)->iomemcon);
-	cil_sort_destroy(&(*db)->ioportcon);
-	cil_sort_destroy(&(*db)->pcidevicecon);
-	cil_sort_destroy(&(*db)->fsuse);
-	cil_list_destroy(&(*db)->userprefixes, CIL_FALSE);
-	cil_list_destroy(&(*db)->selinuxusers, CIL_FALSE);
-	cil_list_destroy(&(*db)->names, CIL_TRUE);
-
-	cil_destroy_type((*db)->selftype);
-
-	cil_strpool_destroy();
+	cil_db_enter(*db, &prev);
+
+	/* The AST, the ordering lists and the sorted arrays live in the
+	 * arenas, and the bitmaps the AST holds are owned by them, so none of
+	 * it is visited here. Only what was allocated on the heap is freed. */
+	cil_parse_tokens_destroy(&(*db)->parse);
+	cil_index_destroy(&(*db)->index);
+	cil_parse_cache_destroy(&(*db)->parse_cache);
+	cil_resolve_cache_destroy(&(*db)->resolve_cache);
+	cil_reset_base_destroy(&(*db)->base);
 	free((*db)->val_to_type);
 	free((*db)->val_to_role);
 
+	cil_db_leave(&prev);
+	cil_tree_locs_destroy(&(*db)->locs);
+	for (i = 0; i < (*db)->num_resolve_arenas; i++) {
+		cil_arena_destroy(&(*db)->resolve_arenas[i]);
+	}
+	free((*db)->resolve_arenas);
+	cil_arena_destroy(&(*db)->arena);
+
 	free(*db);
 	*db = NULL;	
+
+	pthread_mutex_lock(&cil_db_mutex);
+	if (--cil_db_count == 0) {
+		cil_strpool_destroy();
+	}
+	pthread_mutex_unlock(&cil_db_mutex);
+}
+
+/* Make db the one the calling thread allocates from and looks up source
+ * locations in, and apply the log and allocation failure settings db has
+ * of its own. What the thread was working on before is saved in prev, to
+ * be given back to cil_db_leave(). */
+void cil_db_enter(struct cil_db *db, struct cil_db_thread *prev)
+{
+	prev->arena = cil_arena_enter(db->arena);
+	prev->locs = cil_tree_locs_enter(db->locs);
+	prev->log_level = cil_log_thread_level;
+	prev->log_handler = cil_log_thread_handler;
+	prev->mem_error_handler = cil_mem_thread_error_handler;
+
+	if (db->log_level != 0) {
+		cil_log_thread_level = db->log_level;
+	}
+	if (db->log_handler != NULL) {
+		cil_log_thread_handler = db->log_handler;
+	}
+	if (db->mem_error_handler != NULL) {
+		cil_mem_thread_error_handler = db->mem_error_handler;
+	}
+}
+
+void cil_db_leave(struct cil_db_thread *prev)
+{
+	cil_mem_thread_error_handler = prev->mem_error_handler;
+	cil_log_thread_handler = prev->log_handler;
+	cil_log_thread_level = prev->log_level;
+	cil_tree_locs_enter(prev->locs);
+	cil_arena_enter(prev->arena);
 }
 
 void cil_root_init(struct cil_root **root)
 {
-	struct cil_root *r = cil_malloc(sizeof(*r));
+	struct cil_root *r = cil_arena_alloc(sizeof(*r));
 	cil_symtab_array_init(r->symtab, cil_sym_sizes[CIL_SYM_ARRAY_ROOT]);
 
 	*root = r;
@@ -301,12 +379,75 @@ void cil_root_destroy(struct cil_root *root)
 		return;
 	}
 	cil_symtab_array_destroy(root->symtab);
-	free(root);
+	cil_arena_release(root, sizeof(*root));
+}
+
+static int __cil_build_statement(struct cil_parse_token *statement, void *extra_args)
+{
+	struct cil_db *db = extra_args;
+	struct cil_arena *prev = cil_arena_enter(db->arena);
+	int rc;
+
+	rc = cil_build_ast(db, statement, db->ast->root);
+
+	cil_arena_enter(prev);
+
+	return rc;
+}
+
+/* Add the tokens of a file after those of the files already parsed */
+static void __cil_parse_tokens_append(struct cil_db *db, struct cil_parse_tokens *tokens)
+{
+	struct cil_parse_tokens **tail = &db->parse;
+
+	while (*tail != NULL) {
+		tail = &(*tail)->next;
+	}
+
+	*tail = tokens;
+}
+
+/* Parse buffer into tokens, or straight into the AST if db is set to build
+ * on parse. The parse cache is used when one is given. Without a cache,
+ * building on parse never holds more than one statement's tokens. */
+static int __cil_parse_buffer(struct cil_db *db, struct cil_parse_cache *cache, char *name, char *buffer, uint32_t size, struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ERR;
+	int build = (db != NULL && db->build_on_parse);
+	struct cil_db_thread prev;
+
+	if (build) {
+		cil_db_enter(db, &prev);
+	}
+
+	if (build && cache == NULL) {
+		rc = cil_parser_stream(name, buffer, size, __cil_build_statement, db);
+		goto exit;
+	}
+
+	if (cache != NULL) {
+		rc = cil_parse_cache_parse(cache, name, buffer, size, tokens);
+	} else {
+		rc = cil_parser_tokens(name, buffer, size, tokens);
+	}
+
+	if (rc == SEPOL_OK && build) {
+		rc = cil_parse_tokens_walk(tokens, __cil_build_statement, db);
+		tokens->count = 0;
+	}
+
+exit:
+	if (build) {
+		cil_db_leave(&prev);
+	}
+
+	return rc;
 }
 
 int cil_add_file(cil_db_t *db, char *name, char *data, size_t size)
 {
 	char *buffer = NULL;
+	struct cil_parse_tokens *tokens = NULL;
 	int rc;
 
 	cil_log(CIL_INFO, "Parsing %s\n", name);
@@ -315,7 +456,9 @@ int cil_add_file(cil_db_t *db, char *name, char *data, size_t size)
 	memcpy(buffer, data, size);
 	memset(buffer + size, 0, 2);
 
-	rc = cil_parser(name, buffer, size + 2, &db->parse);
+	cil_parse_tokens_init(&tokens);
+
+	rc = __cil_parse_buffer(db, db->parse_cache, name, buffer, size + 2, tokens);
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_ERR, "Failed to parse %s\n", name);
 		goto exit;
@@ -324,34 +467,548 @@ int cil_add_file(cil_db_t *db, char *name, char *data, size_t size)
 	free(buffer);
 	buffer = NULL;
 
+	if (tokens->count > 0) {
+		__cil_parse_tokens_append(db, tokens);
+		tokens = NULL;
+	}
+
 	rc = SEPOL_OK;
 
 exit:
+	cil_parse_tokens_destroy(&tokens);
 	free(buffer);
 
 	return rc;
 }
 
+/* Map a file so that the lexer can scan it in place. The lexer needs its
+ * buffer to end with two NUL bytes but never writes to it, so the file is
+ * mapped read-only over an anonymous reservation that is large enough to
+ * hold the terminating NULs. The kernel zero fills the remainder of the last
+ * page of the file, and if the file ends too close to a page boundary the
+ * trailing page of the reservation supplies the NULs instead. The pages of
+ * the file stay shared with the page cache. */
+static int __cil_map_file(int fd, char **buffer, size_t *size, size_t *map_size)
+{
+	struct stat filedata;
+	size_t page_size = sysconf(_SC_PAGESIZE);
+	void *reserve = MAP_FAILED;
+	void *mapped = MAP_FAILED;
+
+	if (fstat(fd, &filedata) == -1) {
+		return SEPOL_ERR;
+	}
+
+	*size = filedata.st_size;
+	*map_size = ((*size + 2 + page_size - 1) / page_size) * page_size;
+
+	reserve = mmap(NULL, *map_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (reserve == MAP_FAILED) {
+		return SEPOL_ERR;
+	}
+
+	if (*size > 0) {
+		mapped = mmap(reserve, *size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+		if (mapped == MAP_FAILED) {
+			munmap(reserve, *map_size);
+			return SEPOL_ERR;
+		}
+		madvise(mapped, *size, MADV_SEQUENTIAL);
+	}
+
+	*buffer = reserve;
+
+	return SEPOL_OK;
+}
+
+static int __cil_parse_mapped(struct cil_db *db, struct cil_parse_cache *cache, char *name, int fd, struct cil_parse_tokens *tokens)
+{
+	char *buffer = NULL;
+	size_t size;
+	size_t map_size;
+	int rc;
+
+	rc = __cil_map_file(fd, &buffer, &size, &map_size);
+	if (rc != SEPOL_OK) {
+		cil_log(CIL_ERR, "Failed to map %s\n", name);
+		goto exit;
+	}
+
+	rc = __cil_parse_buffer(db, cache, name, buffer, size + 2, tokens);
+	if (rc != SEPOL_OK) {
+		cil_log(CIL_ERR, "Failed to parse %s\n", name);
+		goto exit;
+	}
+
+	rc = SEPOL_OK;
+
+exit:
+	if (buffer != NULL) {
+		munmap(buffer, map_size);
+	}
+
+	return rc;
+}
+
+int cil_add_file_mapped(cil_db_t *db, char *name, int fd)
+{
+	struct cil_parse_tokens *tokens = NULL;
+	int rc;
+
+	cil_log(CIL_INFO, "Parsing %s\n", name);
+
+	cil_parse_tokens_init(&tokens);
+
+	rc = __cil_parse_mapped(db, db->parse_cache, name, fd, tokens);
+	if (rc == SEPOL_OK && tokens->count > 0) {
+		__cil_parse_tokens_append(db, tokens);
+		tokens = NULL;
+	}
+
+	cil_parse_tokens_destroy(&tokens);
+
+	return rc;
+}
+
+#define CIL_STREAM_CHUNK_SIZE	(64 * 1024)
+
+enum cil_stream_mode {
+	CIL_STREAM_NORMAL = 0,
+	CIL_STREAM_QSTRING,
+	CIL_STREAM_COMMENT
+};
+
+/* Just enough of the lexer to find where top level statements end, so that
+ * a stream is only ever split between statements */
+struct cil_stream_scan {
+	enum cil_stream_mode mode;
+	uint32_t depth;
+	uint32_t lines;
+	size_t boundary;
+	uint32_t boundary_lines;
+};
+
+static void __cil_stream_scan(struct cil_stream_scan *scan, const char *buffer, size_t start, size_t end)
+{
+	size_t i;
+
+	for (i = start; i < end; i++) {
+		char c = buffer[i];
+
+		/* As in the lexer, only '\n' ends a comment or a quoted string,
+		 * while a bare '\r' elsewhere counts as a line */
+		if (c == '\n' || (c == '\r' && scan->mode == CIL_STREAM_NORMAL)) {
+			scan->lines++;
+			scan->mode = CIL_STREAM_NORMAL;
+			continue;
+		}
+
+		switch (scan->mode) {
+		case CIL_STREAM_QSTRING:
+			if (c == '"') {
+				scan->mode = CIL_STREAM_NORMAL;
+			}
+			break;
+		case CIL_STREAM_COMMENT:
+			break;
+		default:
+			if (c == '"') {
+				scan->mode = CIL_STREAM_QSTRING;
+			} else if (c == ';') {
+				scan->mode = CIL_STREAM_COMMENT;
+			} else if (c == '(') {
+				scan->depth++;
+			} else if (c == ')') {
+				if (scan->depth > 0) {
+					scan->depth--;
+				}
+				if (scan->depth == 0) {
+					scan->boundary = i + 1;
+					scan->boundary_lines = scan->lines;
+				}
+			}
+			break;
+		}
+	}
+}
+
+/* Parse the first size bytes of buffer, which end on a statement boundary.
+ * The two bytes after them are borrowed for the terminating NULs the lexer
+ * needs. */
+static int __cil_stream_parse(struct cil_db *db, char *name, char *buffer, size_t size, uint32_t line, struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ERR;
+	char saved[2];
+	struct cil_db_thread prev;
+
+	memcpy(saved, buffer + size, 2);
+	memset(buffer + size, 0, 2);
+
+	if (db->build_on_parse) {
+		cil_db_enter(db, &prev);
+		rc = cil_parser_chunk(name, buffer, size + 2, line, tokens, __cil_build_statement, db);
+		cil_db_leave(&prev);
+	} else {
+		rc = cil_parser_chunk(name, buffer, size + 2, line, tokens, NULL, NULL);
+	}
+
+	memcpy(buffer + size, saved, 2);
+
+	return rc;
+}
+
+/* Parse a file whose content is produced by read_callback, which works like
+ * read(2): it stores up to size bytes in buffer and returns how many it
+ * stored, 0 at the end of the input, or -1 on error. The input is parsed as
+ * soon as each top level statement is complete, so only the statement being
+ * read is held in memory when building on parse. Tokens and quoted strings
+ * may be split across reads. Streams do not use the parse cache. */
+int cil_add_stream(cil_db_t *db, char *name, ssize_t (*read_callback)(void *ctx, char *buffer, size_t size), void *ctx)
+{
+	int rc = SEPOL_ERR;
+	struct cil_stream_scan scan;
+	struct cil_parse_tokens *tokens = NULL;
+	char *buffer = NULL;
+	size_t alloc = 0;
+	size_t used = 0;
+	uint32_t line = 1;
+	ssize_t len;
+
+	cil_log(CIL_INFO, "Parsing %s\n", name);
+
+	memset(&scan, 0, sizeof(scan));
+	cil_parse_tokens_init(&tokens);
+
+	do {
+		if (alloc < used + CIL_STREAM_CHUNK_SIZE + 2) {
+			alloc = used + CIL_STREAM_CHUNK_SIZE + 2;
+			buffer = cil_realloc(buffer, alloc);
+		}
+
+		len = (*read_callback)(ctx, buffer + used, CIL_STREAM_CHUNK_SIZE);
+		if (len < 0) {
+			cil_log(CIL_ERR, "Failure reading %s\n", name);
+			rc = SEPOL_ERR;
+			goto exit;
+		}
+
+		__cil_stream_scan(&scan, buffer, used, used + len);
+		used += len;
+
+		if (len == 0) {
+			/* Whatever is left is checked by the parser */
+			scan.boundary = used;
+			scan.boundary_lines = scan.lines;
+		}
+
+		if (scan.boundary > 0) {
+			rc = __cil_stream_parse(db, name, buffer, scan.boundary, line, tokens);
+			if (rc != SEPOL_OK) {
+				cil_log(CIL_ERR, "Failed to parse %s\n", name);
+				goto exit;
+			}
+			line += scan.boundary_lines;
+			used -= scan.boundary;
+			memmove(buffer, buffer + scan.boundary, used);
+			scan.lines -= scan.boundary_lines;
+			scan.boundary = 0;
+			scan.boundary_lines = 0;
+		}
+	} while (len > 0);
+
+	if (tokens->count > 0) {
+		__cil_parse_tokens_append(db, tokens);
+		tokens = NULL;
+	}
+
+	rc = SEPOL_OK;
+
+exit:
+	cil_parse_tokens_destroy(&tokens);
+	free(buffer);
+
+	return rc;
+}
+
+struct cil_parse_job {
+	char *name;
+	struct cil_parse_tokens *tokens;
+	int rc;
+};
+
+struct cil_parse_pool {
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	struct cil_db *db;
+	struct cil_parse_cache *cache;
+	struct cil_parse_job *jobs;
+	int count;
+	int next;
+	int built;
+	int rc;
+	enum cil_log_level log_level;
+	void (*log_handler)(int lvl, char *msg);
+	void (*mem_error_handler)(void);
+};
+
+/* Build the AST for the job at index once every earlier file has been
+ * built, so that statements reach the AST in command line order. A file
+ * built while it was parsed has no tokens left and only takes its turn.
+ * After a failure the remaining files are skipped but still take their
+ * turn. */
+static void __cil_parse_job_build(struct cil_parse_pool *pool, int index)
+{
+	struct cil_parse_job *job = &pool->jobs[index];
+	struct cil_db_thread prev;
+
+	pthread_mutex_lock(&pool->mutex);
+	while (pool->built != index) {
+		pthread_cond_wait(&pool->cond, &pool->mutex);
+	}
+	pthread_mutex_unlock(&pool->mutex);
+
+	if (pool->rc == SEPOL_OK && job->rc == SEPOL_OK) {
+		cil_db_enter(pool->db, &prev);
+		job->rc = cil_parse_tokens_walk(job->tokens, __cil_build_statement, pool->db);
+		cil_db_leave(&prev);
+		if (job->rc != SEPOL_OK) {
+			cil_log(CIL_ERR, "Failed to parse %s\n", job->name);
+		}
+	}
+	if (pool->rc == SEPOL_OK) {
+		pool->rc = job->rc;
+	}
+	cil_parse_tokens_destroy(&job->tokens);
+
+	pthread_mutex_lock(&pool->mutex);
+	pool->built++;
+	pthread_cond_broadcast(&pool->cond);
+	pthread_mutex_unlock(&pool->mutex);
+}
+
+static void *__cil_parse_worker(void *arg)
+{
+	struct cil_parse_pool *pool = arg;
+	struct cil_parse_job *job = NULL;
+	int build;
+	int index;
+	int fd;
+	enum cil_log_level log_level = cil_log_thread_level;
+	void (*log_handler)(int lvl, char *msg) = cil_log_thread_handler;
+	void (*mem_error_handler)(void) = cil_mem_thread_error_handler;
+
+	/* Log and fail the way the thread that started the workers does */
+	cil_log_thread_level = pool->log_level;
+	cil_log_thread_handler = pool->log_handler;
+	cil_mem_thread_error_handler = pool->mem_error_handler;
+
+	while (1) {
+		pthread_mutex_lock(&pool->mutex);
+		index = pool->next < pool->count ? pool->next++ : -1;
+		pthread_mutex_unlock(&pool->mutex);
+
+		if (index == -1) {
+			break;
+		}
+
+		/* When every earlier file has been built already, as is always
+		 * the case with one job, the file is built as it is parsed
+		 * instead of being held as tokens first */
+		pthread_mutex_lock(&pool->mutex);
+		build = (pool->db != NULL && pool->built == index && pool->rc == SEPOL_OK);
+		pthread_mutex_unlock(&pool->mutex);
+
+		job = &pool->jobs[index];
+		fd = open(job->name, O_RDONLY);
+		if (fd == -1) {
+			cil_log(CIL_ERR, "Could not open file: %s\n", job->name);
+			job->rc = SEPOL_ERR;
+		} else {
+			job->rc = __cil_parse_mapped(build ? pool->db : NULL, pool->cache, job->name, fd, job->tokens);
+			close(fd);
+		}
+
+		if (pool->db != NULL) {
+			__cil_parse_job_build(pool, index);
+		}
+	}
+
+	cil_mem_thread_error_handler = mem_error_handler;
+	cil_log_thread_handler = log_handler;
+	cil_log_thread_level = log_level;
+
+	return NULL;
+}
+
+/* Parse count files using up to jobs threads (or one per online CPU when
+ * jobs is less than one). Every file gets its own token stream, and the
+ * streams are appended to db->parse (or built into the AST, when building on
+ * parse) in the order the files were given, so the result does not depend
+ * on how the work was scheduled. When building on parse, a file whose turn
+ * to be built has come by the time it is picked up is built statement by
+ * statement as it is parsed, without holding its tokens. */
+int cil_add_files(cil_db_t *db, char **names, int count, int jobs)
+{
+	int rc = SEPOL_ERR;
+	struct cil_parse_pool pool;
+	pthread_t *threads = NULL;
+	int num_threads = 0;
+	int i;
+
+	if (count <= 0) {
+		return SEPOL_OK;
+	}
+
+	if (jobs < 1) {
+		jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if (jobs > count) {
+		jobs = count;
+	}
+
+	pthread_mutex_init(&pool.mutex, NULL);
+	pthread_cond_init(&pool.cond, NULL);
+	pool.db = db->build_on_parse ? db : NULL;
+	pool.cache = db->parse_cache;
+	pool.jobs = cil_malloc(sizeof(*pool.jobs) * count);
+	pool.count = count;
+	pool.next = 0;
+	pool.built = 0;
+	pool.rc = SEPOL_OK;
+	pool.log_level = db->log_level != 0 ? db->log_level : cil_get_log_level();
+	pool.log_handler = db->log_handler != NULL ? db->log_handler : cil_get_log_handler();
+	pool.mem_error_handler = db->mem_error_handler != NULL ? db->mem_error_handler : CIL_MEM_ERROR_HANDLER;
+
+	for (i = 0; i < count; i++) {
+		cil_log(CIL_INFO, "Parsing %s\n", names[i]);
+		pool.jobs[i].name = names[i];
+		pool.jobs[i].rc = SEPOL_ERR;
+		cil_parse_tokens_init(&pool.jobs[i].tokens);
+	}
+
+	/* The calling thread is one of the workers. If a thread cannot be
+	 * started the remaining ones simply take on more of the files. */
+	if (jobs > 1) {
+		threads = cil_malloc(sizeof(*threads) * (jobs - 1));
+		for (i = 0; i < jobs - 1; i++) {
+			if (pthread_create(&threads[num_threads], NULL, __cil_parse_worker, &pool) == 0) {
+				num_threads++;
+			}
+		}
+	}
+
+	__cil_parse_worker(&pool);
+
+	for (i = 0; i < num_threads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	rc = pool.rc;
+	for (i = 0; i < count; i++) {
+		if (pool.jobs[i].rc != SEPOL_OK) {
+			rc = pool.jobs[i].rc;
+		} else if (rc == SEPOL_OK && pool.db == NULL && pool.jobs[i].tokens->count > 0) {
+			__cil_parse_tokens_append(db, pool.jobs[i].tokens);
+			pool.jobs[i].tokens = NULL;
+		}
+		cil_parse_tokens_destroy(&pool.jobs[i].tokens);
+	}
+
+	free(threads);
+	free(pool.jobs);
+	pthread_cond_destroy(&pool.cond);
+	pthread_mutex_destroy(&pool.mutex);
+
+	return rc;
+}
+
+/* Resolve the statements added to a compiled database, which come after
+ * compiled_tail, against the compiled ones without resolving those again.
+ * While they are resolved the added statements hang off a root of their
+ * own that shares the symbol tables of the real one. */
+static int __cil_resolve_added(struct cil_db *db)
+{
+	int rc = SEPOL_ERR;
+	struct cil_tree_node *root = db->ast->root;
+	struct cil_tree_node *added = NULL;
+	struct cil_tree_node *node = NULL;
+
+	if (cil_tree_node_next(db->compiled_tail) == NULL) {
+		return SEPOL_OK;
+	}
+
+	cil_tree_node_init(&added);
+	added->flavor = CIL_ROOT;
+	added->data = root->data;
+	cil_tree_node_set_head(added, cil_tree_node_next(db->compiled_tail));
+	cil_tree_node_set_tail(added, cil_tree_node_tail(root));
+	for (node = cil_tree_node_head(added); node != NULL; node = cil_tree_node_next(node)) {
+		cil_tree_node_set_parent(node, added);
+	}
+	cil_tree_node_set_next(db->compiled_tail, NULL);
+	cil_tree_node_set_tail(root, db->compiled_tail);
+
+	rc = cil_reset_base_capture(db, &db->base);
+	if (rc == SEPOL_OK) {
+		db->ast->root = added;
+		rc = cil_resolve_ast(db, added);
+		db->ast->root = root;
+	}
+
+	cil_tree_node_set_next(db->compiled_tail, cil_tree_node_head(added));
+	cil_tree_node_set_tail(root, cil_tree_node_tail(added));
+	for (node = cil_tree_node_head(added); node != NULL; node = cil_tree_node_next(node)) {
+		cil_tree_node_set_parent(node, root);
+	}
+	added->data = NULL;
+	cil_arena_release(added, sizeof(*added));
+
+	if (db->base != NULL && db->sidorder == NULL) {
+		/* Resolution stopped before the orders were merged */
+		db->sidorder = db->base->sidorder;
+		db->classorder = db->base->classorder;
+		db->catorder = db->base->catorder;
+		db->sensitivityorder = db->base->sensitivityorder;
+		db->base->sidorder = NULL;
+		db->base->classorder = NULL;
+		db->base->catorder = NULL;
+		db->base->sensitivityorder = NULL;
+	}
+	cil_reset_base_destroy(&db->base);
+
+	return rc;
+}
+
 int cil_compile(struct cil_db *db, sepol_policydb_t *sepol_db)
 {
 	int rc = SEPOL_ERR;
+	struct cil_parse_tokens *tokens = NULL;
+	struct cil_db_thread prev;
 
 	if (db == NULL || sepol_db == NULL) {
-		goto exit;
+		return SEPOL_ERR;
 	}
 
+	cil_db_enter(db, &prev);
+
 	cil_log(CIL_INFO, "Building AST from Parse Tree\n");
-	rc = cil_build_ast(db, db->parse->root, db->ast->root);
-	if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR, "Failed to build ast\n");
-		goto exit;
+	for (tokens = db->parse; tokens != NULL; tokens = tokens->next) {
+		rc = cil_parse_tokens_walk(tokens, __cil_build_statement, db);
+		if (rc != SEPOL_OK) {
+			cil_log(CIL_ERR, "Failed to build ast\n");
+			goto exit;
+		}
 	}
 
 	cil_log(CIL_INFO, "Destroying Parse Tree\n");
-	cil_tree_destroy(&db->parse);
+	cil_parse_tokens_destroy(&db->parse);
 
 	cil_log(CIL_INFO, "Resolving AST\n");
-	rc = cil_resolve_ast(db, db->ast->root);
+	if (db->compiled_tail != NULL) {
+		rc = __cil_resolve_added(db);
+	} else {
+		rc = cil_resolve_ast(db, db->ast->root);
+	}
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_ERR, "Failed to resolve ast\n");
 		goto exit;
@@ -371,7 +1028,10 @@ int cil_compile(struct cil_db *db, sepol_policydb_t *sepol_db)
 		goto exit;
 	}
 
+	db->compiled_tail = cil_tree_node_tail(db->ast->root);
+
 exit:
+	cil_db_leave(&prev);
 
 	return rc;
 }
@@ -379,6 +1039,9 @@ exit:
 int cil_build_policydb(cil_db_t *db, sepol_policydb_t *sepol_db)
 {
 	int rc;
+	struct cil_db_thread prev;
+
+	cil_db_enter(db, &prev);
 
 	cil_log(CIL_INFO, "Building policy binary\n");
 	rc = cil_binary_create(db, sepol_db);
@@ -388,6 +1051,8 @@ int cil_build_policydb(cil_db_t *db, sepol_policydb_t *sepol_db)
 	}
 
 exit:
+	cil_db_leave(&prev);
+
 	return rc;
 }
 
@@ -1123,7 +1788,8 @@ static int cil_level_equals(policydb_t *pdb, struct cil_level *low, struct cil_l
 
 static int __cil_level_strlen(struct cil_level *lvl)
 {
-	struct cil_list_item *item;
+	struct cil_cat *cat;
+	uint32_t i;
 	struct cil_cats *cats = lvl->cats;
 	int str_len = 0;
 	char *str1 = NULL;
@@ -1133,10 +1799,9 @@ static int __cil_level_strlen(struct cil_level *lvl)
 
 	str_len += strlen(lvl->sens->datum.fqn);
 
-	if (cats && cats->datum_expr != NULL) {
+	if (cats && cats->datums.count > 0) {
 		str_len++; /* initial ":" */
-		cil_list_for_each(item, cats->datum_expr) {
-			struct cil_cat *cat = item->data;
+		cil_vector_for_each(cat, i, &cats->datums) {
 			if (first == -1) {
 				str1 = cat->datum.fqn;
 				first = cat->value;
@@ -1154,7 +1819,7 @@ static int __cil_level_strlen(struct cil_level *lvl)
 				}
 				first = -1;
 				last = -1;
-				if (item->next != NULL) {
+				if (i + 1 < cats->datums.count) {
 					str_len++; /* space for "," after */
 				}
 			}
@@ -1175,7 +1840,8 @@ static int __cil_level_strlen(struct cil_level *lvl)
 
 static int __cil_level_to_string(struct cil_level *lvl, char *out)
 {
-	struct cil_list_item *item;
+	struct cil_cat *cat;
+	uint32_t i;
 	struct cil_cats *cats = lvl->cats;
 	int buf_pos = 0;
 	char *str_tmp = out;
@@ -1187,12 +1853,11 @@ static int __cil_level_to_string(struct cil_level *lvl, char *out)
 	buf_pos = sprintf(str_tmp, "%s", lvl->sens->datum.fqn);
 	str_tmp += buf_pos;
 
-	if (cats && cats->datum_expr != NULL) {
+	if (cats && cats->datums.count > 0) {
 		buf_pos = sprintf(str_tmp, ":");
 		str_tmp += buf_pos;
 
-		cil_list_for_each(item, cats->datum_expr) {
-			struct cil_cat *cat = item->data;
+		cil_vector_for_each(cat, i, &cats->datums) {
 			if (first == -1) {
 				str1 = cat->datum.fqn;
 				first = cat->value;
@@ -1213,7 +1878,7 @@ static int __cil_level_to_string(struct cil_level *lvl, char *out)
 				}
 				first = -1;
 				last = -1;
-				if (item->next != NULL) {
+				if (i + 1 < cats->datums.count) {
 					buf_pos = sprintf(str_tmp, ",");
 					str_tmp += buf_pos;
 				}
@@ -1449,7 +2114,107 @@ void cil_set_mls(struct cil_db *db, int mls)
 	db->mls = mls;
 }
 
-void cil_symtab_array_init(symtab_t symtab[], int symtab_sizes[CIL_SYM_NUM])
+/* When set, each top level statement is added to the AST as soon as it has
+ * been parsed rather than by cil_compile(), so only one statement of parse
+ * tree is held at a time. The AST depends on preserve_tunables, so this
+ * should be set after it and before any files are added. */
+void cil_set_build_on_parse(struct cil_db *db, int build_on_parse)
+{
+	db->build_on_parse = build_on_parse;
+}
+
+/* When set, disabling an optional resets and resolves the whole AST again
+ * rather than only the statements that depended on it */
+void cil_set_full_reset(struct cil_db *db, int full_reset)
+{
+	db->full_reset = full_reset;
+}
+
+/* Resolve the statements of the passes after the declarations are in
+ * place on up to jobs threads (or one per online CPU when jobs is less
+ * than one) */
+void cil_set_resolve_jobs(struct cil_db *db, int jobs)
+{
+	db->resolve_jobs = jobs;
+}
+
+/* Log at lvl and through handler, and call handler when an allocation
+ * fails, while working on db, in place of the process wide settings of
+ * cil_set_log_level(), cil_set_log_handler() and
+ * cil_set_malloc_error_handler() */
+void cil_db_set_log_level(struct cil_db *db, enum cil_log_level lvl)
+{
+	db->log_level = lvl;
+}
+
+void cil_db_set_log_handler(struct cil_db *db, void (*handler)(int lvl, char *msg))
+{
+	db->log_handler = handler;
+}
+
+void cil_db_set_malloc_error_handler(struct cil_db *db, void (*handler)(void))
+{
+	db->mem_error_handler = handler;
+}
+
+/* Reuse the parsed tokens of previously seen files from the cache in dir, and
+ * add entries for new ones */
+int cil_set_parse_cache(struct cil_db *db, const char *dir)
+{
+	cil_parse_cache_destroy(&db->parse_cache);
+
+	if (dir == NULL) {
+		return SEPOL_OK;
+	}
+
+	return cil_parse_cache_init(&db->parse_cache, dir);
+}
+
+/* Save a compiled database to path. Loading it gives back a database
+ * that more files can be added to and compiled without the saved statements
+ * going through the parser and resolver again. */
+int cil_db_save(struct cil_db *db, const char *path)
+{
+	int rc;
+	struct cil_db_thread prev;
+
+	if (db == NULL || path == NULL) {
+		return SEPOL_ERR;
+	}
+
+	cil_db_enter(db, &prev);
+	rc = cil_snapshot_save(db, path);
+	cil_db_leave(&prev);
+
+	return rc;
+}
+
+int cil_db_load(struct cil_db **db, const char *path)
+{
+	if (db == NULL || path == NULL) {
+		return SEPOL_ERR;
+	}
+
+	return cil_snapshot_load(db, path);
+}
+
+void cil_get_parse_cache_stats(struct cil_db *db, unsigned int *hits, unsigned int *misses)
+{
+	*hits = 0;
+	*misses = 0;
+
+	if (db->parse_cache != NULL) {
+		cil_parse_cache_stats(db->parse_cache, hits, misses);
+	}
+}
+
+void cil_get_resolve_cache_stats(struct cil_db *db, unsigned int *hits, unsigned int *misses)
+{
+	*hits = db->resolve_cache->hits;
+	*misses = db->resolve_cache->misses;
+}
+
+void cil_symtab_array_init(struct cil_symtab symtab[], int symtab_sizes[CIL_SYM_NUM])
 {
 	uint32_t i = 0;
 	for (i = 0; i < CIL_SYM_NUM; i++) {
@@ -1457,7 +2222,7 @@ void cil_symtab_array_init(symtab_t symtab[], int symtab_sizes[CIL_SYM_NUM])
 	}
 }
 
-void cil_symtab_array_destroy(symtab_t symtab[])
+void cil_symtab_array_destroy(struct cil_symtab symtab[])
 {
 	int i = 0;
 	for (i = 0; i < CIL_SYM_NUM; i++) {
@@ -1490,15 +2255,15 @@ void cil_destroy_ast_symtabs(struct cil_tree_node *current)
 			break;
 		}
 
-		if (current->cl_head) {
-			cil_destroy_ast_symtabs(current->cl_head);
+		if (cil_tree_node_head(current)) {
+			cil_destroy_ast_symtabs(cil_tree_node_head(current));
 		}
 
-		current = current->next;
+		current = cil_tree_node_next(current);
 	}
 }
 
-int cil_get_symtab(struct cil_tree_node *ast_node, symtab_t **symtab, enum cil_sym_index sym_index)
+int cil_get_symtab(struct cil_tree_node *ast_node, struct cil_symtab **symtab, enum cil_sym_index sym_index)
 {
 	struct cil_tree_node *node = ast_node;
 	*symtab = NULL;
@@ -1534,16 +2299,16 @@ int cil_get_symtab(struct cil_tree_node *ast_node, symtab_t **symtab, enum cil_s
 			*symtab = &((struct cil_in*)node->data)->symtab[sym_index];
 			break;
 		case CIL_CONDBLOCK: {
-			if (node->parent->flavor == CIL_TUNABLEIF) {
+			if (cil_tree_node_parent(node)->flavor == CIL_TUNABLEIF) {
 				/* Cond blocks only exist before resolving the AST */
 				*symtab = &((struct cil_condblock*)node->data)->symtab[sym_index];
-			} else if (node->parent->flavor == CIL_BOOLEANIF) {
-				node = node->parent->parent;
+			} else if (cil_tree_node_parent(node)->flavor == CIL_BOOLEANIF) {
+				node = cil_tree_node_parent(cil_tree_node_parent(node));
 			}
 			break;
 		}
 		default:
-			node = node->parent;
+			node = cil_tree_node_parent(node);
 		}
 	}
 
@@ -1555,13 +2320,32 @@ int cil_get_symtab(struct cil_tree_node *ast_node, symtab_t **symtab, enum cil_s
 
 exit:
 	cil_log(CIL_ERR, "Failed to get symtab from node at line %d of %s\n",
-			ast_node->line, ast_node->path);
+			cil_tree_node_line(ast_node), cil_tree_node_path(ast_node));
 	return SEPOL_ERR;	
 }
 
+static void __cil_ebitmap_destroy(void *map)
+{
+	ebitmap_destroy(map);
+}
+
+/* Bitmaps hanging off the AST are owned by the arena, which frees their
+ * nodes when the db goes away */
+void cil_ebitmap_init(ebitmap_t **map)
+{
+	*map = cil_arena_alloc_owned(sizeof(**map), __cil_ebitmap_destroy);
+	ebitmap_init(*map);
+}
+
+void cil_ebitmap_destroy(ebitmap_t **map)
+{
+	cil_arena_release_owned(*map, sizeof(**map));
+	*map = NULL;
+}
+
 void cil_sort_init(struct cil_sort **sort)
 {
-	*sort = cil_malloc(sizeof(**sort));
+	*sort = cil_arena_alloc(sizeof(**sort));
 
 	(*sort)->flavor = CIL_NONE;
 	(*sort)->count = 0;
@@ -1571,21 +2355,19 @@ void cil_sort_init(struct cil_sort **sort)
 
 void cil_sort_destroy(struct cil_sort **sort)
 {
+	cil_arena_release((*sort)->array, sizeof(*(*sort)->array) * (*sort)->count);
 	(*sort)->flavor = CIL_NONE;
 	(*sort)->count = 0;
 	(*sort)->index = 0;
-	if ((*sort)->array != NULL) {
-		free((*sort)->array);
-	}
 	(*sort)->array = NULL;
 
-	free(*sort);
+	cil_arena_release(*sort, sizeof(**sort));
 	*sort = NULL;
 }
 
 void cil_netifcon_init(struct cil_netifcon **netifcon)
 {
-	*netifcon = cil_malloc(sizeof(**netifcon));
+	*netifcon = cil_arena_alloc(sizeof(**netifcon));
 
 	(*netifcon)->interface_str = NULL;
 	(*netifcon)->if_context_str = NULL;
@@ -1597,7 +2379,7 @@ void cil_netifcon_init(struct cil_netifcon **netifcon)
 
 void cil_context_init(struct cil_context **context)
 {
-	*context = cil_malloc(sizeof(**context));
+	*context = cil_arena_alloc(sizeof(**context));
 
 	cil_symtab_datum_init(&(*context)->datum);
 	(*context)->user_str = NULL;
@@ -1612,7 +2394,7 @@ void cil_context_init(struct cil_context **context)
 
 void cil_level_init(struct cil_level **level)
 {
-	*level = cil_malloc(sizeof(**level));
+	*level = cil_arena_alloc(sizeof(**level));
 
 	cil_symtab_datum_init(&(*level)->datum);
 	(*level)->sens_str = NULL;
@@ -1622,7 +2404,7 @@ void cil_level_init(struct cil_level **level)
 
 void cil_levelrange_init(struct cil_levelrange **range)
 {
-	*range = cil_malloc(sizeof(**range));
+	*range = cil_arena_alloc(sizeof(**range));
 
 	cil_symtab_datum_init(&(*range)->datum);
 	(*range)->low_str = NULL;
@@ -1633,7 +2415,7 @@ void cil_levelrange_init(struct cil_levelrange **range)
 
 void cil_sens_init(struct cil_sens **sens)
 {
-	*sens = cil_malloc(sizeof(**sens));
+	*sens = cil_arena_alloc(sizeof(**sens));
 
 	cil_symtab_datum_init(&(*sens)->datum);
 
@@ -1644,7 +2426,7 @@ void cil_sens_init(struct cil_sens **sens)
 
 void cil_block_init(struct cil_block **block)
 {
-	*block = cil_malloc(sizeof(**block));
+	*block = cil_arena_alloc(sizeof(**block));
 
 	cil_symtab_datum_init(&(*block)->datum);
 
@@ -1657,20 +2439,20 @@ void cil_block_init(struct cil_block **block)
 
 void cil_blockinherit_init(struct cil_blockinherit **inherit)
 {
-	*inherit = cil_malloc(sizeof(**inherit));
+	*inherit = cil_arena_alloc(sizeof(**inherit));
 	(*inherit)->block_str = NULL;
 	(*inherit)->block = NULL;
 }
 
 void cil_blockabstract_init(struct cil_blockabstract **abstract)
 {
-	*abstract = cil_malloc(sizeof(**abstract));
+	*abstract = cil_arena_alloc(sizeof(**abstract));
 	(*abstract)->block_str = NULL;
 }
 
 void cil_in_init(struct cil_in **in)
 {
-	*in = cil_malloc(sizeof(**in));
+	*in = cil_arena_alloc(sizeof(**in));
 
 	cil_symtab_array_init((*in)->symtab, cil_sym_sizes[CIL_SYM_ARRAY_IN]);
 	(*in)->block_str = NULL;
@@ -1678,7 +2460,7 @@ void cil_in_init(struct cil_in **in)
 
 void cil_class_init(struct cil_class **class)
 {
-	*class = cil_malloc(sizeof(**class));
+	*class = cil_arena_alloc(sizeof(**class));
 
 	cil_symtab_datum_init(&(*class)->datum);
 
@@ -1691,14 +2473,14 @@ void cil_class_init(struct cil_class **class)
 
 void cil_classorder_init(struct cil_classorder **classorder)
 {
-	*classorder = cil_malloc(sizeof(**classorder));
+	*classorder = cil_arena_alloc(sizeof(**classorder));
 
 	(*classorder)->class_list_str = NULL;
 }
 
 void cil_classcommon_init(struct cil_classcommon **classcommon)
 {
-	*classcommon = cil_malloc(sizeof(**classcommon));
+	*classcommon = cil_arena_alloc(sizeof(**classcommon));
 
 	(*classcommon)->class_str = NULL;
 	(*classcommon)->common_str = NULL;
@@ -1706,7 +2488,7 @@ void cil_classcommon_init(struct cil_classcommon **classcommon)
 
 void cil_sid_init(struct cil_sid **sid)
 {
-	*sid = cil_malloc(sizeof(**sid));
+	*sid = cil_arena_alloc(sizeof(**sid));
 
 	cil_symtab_datum_init(&(*sid)->datum);
 
@@ -1716,7 +2498,7 @@ void cil_sid_init(struct cil_sid **sid)
 
 void cil_sidcontext_init(struct cil_sidcontext **sidcontext)
 {
-	*sidcontext = cil_malloc(sizeof(**sidcontext));
+	*sidcontext = cil_arena_alloc(sizeof(**sidcontext));
 
 	(*sidcontext)->sid_str = NULL;
 	(*sidcontext)->context_str = NULL;
@@ -1725,14 +2507,14 @@ void cil_sidcontext_init(struct cil_sidcontext **sidcontext)
 
 void cil_sidorder_init(struct cil_sidorder **sidorder)
 {
-	*sidorder = cil_malloc(sizeof(**sidorder));
+	*sidorder = cil_arena_alloc(sizeof(**sidorder));
 
 	(*sidorder)->sid_list_str = NULL;
 }
 
 void cil_userrole_init(struct cil_userrole **userrole)
 {
-	*userrole = cil_malloc(sizeof(**userrole));
+	*userrole = cil_arena_alloc(sizeof(**userrole));
 
 	(*userrole)->user_str = NULL;
 	(*userrole)->user = NULL;
@@ -1742,7 +2524,7 @@ void cil_userrole_init(struct cil_userrole **userrole)
 
 void cil_userprefix_init(struct cil_userprefix **userprefix)
 {
-	*userprefix = cil_malloc(sizeof(**userprefix));
+	*userprefix = cil_arena_alloc(sizeof(**userprefix));
 
 	(*userprefix)->user_str = NULL;
 	(*userprefix)->user = NULL;
@@ -1751,7 +2533,7 @@ void cil_userprefix_init(struct cil_userprefix **userprefix)
 
 void cil_selinuxuser_init(struct cil_selinuxuser **selinuxuser)
 {
-	*selinuxuser = cil_malloc(sizeof(**selinuxuser));
+	*selinuxuser = cil_arena_alloc(sizeof(**selinuxuser));
 
 	(*selinuxuser)->name_str = NULL;
 	(*selinuxuser)->user_str = NULL;
@@ -1762,7 +2544,7 @@ void cil_selinuxuser_init(struct cil_selinuxuser **selinuxuser)
 
 void cil_roletype_init(struct cil_roletype **roletype)
 {
-	*roletype = cil_malloc(sizeof(**roletype));
+	*roletype = cil_arena_alloc(sizeof(**roletype));
 
 	(*roletype)->role_str = NULL;
 	(*roletype)->role = NULL;
@@ -1772,7 +2554,7 @@ void cil_roletype_init(struct cil_roletype **roletype)
 
 void cil_roleattribute_init(struct cil_roleattribute **attr)
 {
-	*attr = cil_malloc(sizeof(**attr));
+	*attr = cil_arena_alloc(sizeof(**attr));
 
 	cil_symtab_datum_init(&(*attr)->datum);
 
@@ -1782,7 +2564,7 @@ void cil_roleattribute_init(struct cil_roleattribute **attr)
 
 void cil_roleattributeset_init(struct cil_roleattributeset **attrset)
 {
-	*attrset = cil_malloc(sizeof(**attrset));
+	*attrset = cil_arena_alloc(sizeof(**attrset));
 
 	(*attrset)->attr_str = NULL;
 	(*attrset)->str_expr = NULL;
@@ -1791,7 +2573,7 @@ void cil_roleattributeset_init(struct cil_roleattributeset **attrset)
 
 void cil_typeattribute_init(struct cil_typeattribute **attr)
 {
-	*attr = cil_malloc(sizeof(**attr));
+	*attr = cil_arena_alloc(sizeof(**attr));
 
 	cil_symtab_datum_init(&(*attr)->datum);
 
@@ -1802,7 +2584,7 @@ void cil_typeattribute_init(struct cil_typeattribute **attr)
 
 void cil_typeattributeset_init(struct cil_typeattributeset **attrset)
 {
-	*attrset = cil_malloc(sizeof(**attrset));
+	*attrset = cil_arena_alloc(sizeof(**attrset));
 
 	(*attrset)->attr_str = NULL;
 	(*attrset)->str_expr = NULL;
@@ -1811,7 +2593,7 @@ void cil_typeattributeset_init(struct cil_typeattributeset **attrset)
 
 void cil_alias_init(struct cil_alias **alias)
 {
-	*alias = cil_malloc(sizeof(**alias));
+	*alias = cil_arena_alloc(sizeof(**alias));
 
 	(*alias)->actual = NULL;
 
@@ -1820,7 +2602,7 @@ void cil_alias_init(struct cil_alias **alias)
 
 void cil_aliasactual_init(struct cil_aliasactual **aliasactual)
 {
-	*aliasactual = cil_malloc(sizeof(**aliasactual));
+	*aliasactual = cil_arena_alloc(sizeof(**aliasactual));
 
 	(*aliasactual)->alias_str = NULL;
 	(*aliasactual)->actual_str = NULL;
@@ -1828,7 +2610,7 @@ void cil_aliasactual_init(struct cil_aliasactual **aliasactual)
 
 void cil_typepermissive_init(struct cil_typepermissive **typeperm)
 {
-	*typeperm = cil_malloc(sizeof(**typeperm));
+	*typeperm = cil_arena_alloc(sizeof(**typeperm));
 
 	(*typeperm)->type_str = NULL;
 	(*typeperm)->type = NULL;
@@ -1836,7 +2618,7 @@ void cil_typepermissive_init(struct cil_typepermissive **typeperm)
 
 void cil_name_init(struct cil_name **name)
 {
-	*name = cil_malloc(sizeof(**name));
+	*name = cil_arena_alloc(sizeof(**name));
 
 	cil_symtab_datum_init(&(*name)->datum);
 	(*name)->name_str = NULL;
@@ -1844,7 +2626,7 @@ void cil_name_init(struct cil_name **name)
 
 void cil_nametypetransition_init(struct cil_nametypetransition **nametypetrans)
 {
-	*nametypetrans = cil_malloc(sizeof(**nametypetrans));
+	*nametypetrans = cil_arena_alloc(sizeof(**nametypetrans));
 
 	(*nametypetrans)->src_str = NULL;
 	(*nametypetrans)->src = NULL;
@@ -1860,7 +2642,7 @@ void cil_nametypetransition_init(struct cil_nametypetransition **nametypetrans)
 
 void cil_rangetransition_init(struct cil_rangetransition **rangetrans)
 {
-        *rangetrans = cil_malloc(sizeof(**rangetrans));
+        *rangetrans = cil_arena_alloc(sizeof(**rangetrans));
 
 	(*rangetrans)->src_str = NULL;
 	(*rangetrans)->src = NULL;
@@ -1874,7 +2656,7 @@ void cil_rangetransition_init(struct cil_rangetransition **rangetrans)
 
 void cil_bool_init(struct cil_bool **cilbool)
 {
-	*cilbool = cil_malloc(sizeof(**cilbool));
+	*cilbool = cil_arena_alloc(sizeof(**cilbool));
 
 	cil_symtab_datum_init(&(*cilbool)->datum);
 	(*cilbool)->value = 0;
@@ -1882,7 +2664,7 @@ void cil_bool_init(struct cil_bool **cilbool)
 
 void cil_tunable_init(struct cil_tunable **ciltun)
 {
-	*ciltun = cil_malloc(sizeof(**ciltun));
+	*ciltun = cil_arena_alloc(sizeof(**ciltun));
 
 	cil_symtab_datum_init(&(*ciltun)->datum);
 	(*ciltun)->value = 0;
@@ -1890,7 +2672,7 @@ void cil_tunable_init(struct cil_tunable **ciltun)
 
 void cil_condblock_init(struct cil_condblock **cb)
 {
-	*cb = cil_malloc(sizeof(**cb));
+	*cb = cil_arena_alloc(sizeof(**cb));
 
 	(*cb)->flavor = CIL_NONE;
 	cil_symtab_array_init((*cb)->symtab, cil_sym_sizes[CIL_SYM_ARRAY_CONDBLOCK]);
@@ -1898,7 +2680,7 @@ void cil_condblock_init(struct cil_condblock **cb)
 
 void cil_boolif_init(struct cil_booleanif **bif)
 {
-	*bif = cil_malloc(sizeof(**bif));
+	*bif = cil_arena_alloc(sizeof(**bif));
 
 	(*bif)->str_expr = NULL;
 	(*bif)->datum_expr = NULL;
@@ -1906,7 +2688,7 @@ void cil_boolif_init(struct cil_booleanif **bif)
 
 void cil_tunif_init(struct cil_tunableif **tif)
 {
-	*tif = cil_malloc(sizeof(**tif));
+	*tif = cil_arena_alloc(sizeof(**tif));
 
 	(*tif)->str_expr = NULL;
 	(*tif)->datum_expr = NULL;
@@ -1914,7 +2696,7 @@ void cil_tunif_init(struct cil_tunableif **tif)
 
 void cil_avrule_init(struct cil_avrule **avrule)
 {
-	*avrule = cil_malloc(sizeof(**avrule));
+	*avrule = cil_arena_alloc(sizeof(**avrule));
 
 	(*avrule)->rule_kind = CIL_NONE;
 	(*avrule)->src_str = NULL;
@@ -1926,7 +2708,7 @@ void cil_avrule_init(struct cil_avrule **avrule)
 
 void cil_type_rule_init(struct cil_type_rule **type_rule)
 {
-	*type_rule = cil_malloc(sizeof(**type_rule));
+	*type_rule = cil_arena_alloc(sizeof(**type_rule));
 
 	(*type_rule)->rule_kind = CIL_NONE;
 	(*type_rule)->src_str = NULL;
@@ -1941,7 +2723,7 @@ void cil_type_rule_init(struct cil_type_rule **type_rule)
 
 void cil_roletransition_init(struct cil_roletransition **role_trans)
 {
-	*role_trans = cil_malloc(sizeof(**role_trans));
+	*role_trans = cil_arena_alloc(sizeof(**role_trans));
 
 	(*role_trans)->src_str = NULL;
 	(*role_trans)->src = NULL;
@@ -1955,7 +2737,7 @@ void cil_roletransition_init(struct cil_roletransition **role_trans)
 
 void cil_roleallow_init(struct cil_roleallow **roleallow)
 {
-	*roleallow = cil_malloc(sizeof(**roleallow));
+	*roleallow = cil_arena_alloc(sizeof(**roleallow));
 
 	(*roleallow)->src_str = NULL;
 	(*roleallow)->src = NULL;
@@ -1965,7 +2747,7 @@ void cil_roleallow_init(struct cil_roleallow **roleallow)
 
 void cil_catset_init(struct cil_catset **catset)
 {
-	*catset = cil_malloc(sizeof(**catset));
+	*catset = cil_arena_alloc(sizeof(**catset));
 
 	cil_symtab_datum_init(&(*catset)->datum);
 	(*catset)->cats = NULL;
@@ -1973,7 +2755,7 @@ void cil_catset_init(struct cil_catset **catset)
 
 void cil_senscat_init(struct cil_senscat **senscat)
 {
-	*senscat = cil_malloc(sizeof(**senscat));
+	*senscat = cil_arena_alloc(sizeof(**senscat));
 
 	(*senscat)->sens_str = NULL;
 	(*senscat)->cats = NULL;
@@ -1981,16 +2763,17 @@ void cil_senscat_init(struct cil_senscat **senscat)
 
 void cil_cats_init(struct cil_cats **cats)
 {
-	*cats = cil_malloc(sizeof(**cats));
+	*cats = cil_arena_alloc(sizeof(**cats));
 
 	(*cats)->evaluated = CIL_FALSE;
 	(*cats)->str_expr = NULL;
 	(*cats)->datum_expr = NULL;
+	cil_vector_init(&(*cats)->datums);
 }
 
 void cil_filecon_init(struct cil_filecon **filecon)
 {
-	*filecon = cil_malloc(sizeof(**filecon));
+	*filecon = cil_arena_alloc(sizeof(**filecon));
 
 	(*filecon)->path_str = NULL;
 	(*filecon)->type = 0;
@@ -2000,7 +2783,7 @@ void cil_filecon_init(struct cil_filecon **filecon)
 
 void cil_portcon_init(struct cil_portcon **portcon)
 {
-	*portcon = cil_malloc(sizeof(**portcon));
+	*portcon = cil_arena_alloc(sizeof(**portcon));
 	(*portcon)->proto = 0;
 	(*portcon)->port_low = 0;
 	(*portcon)->port_high = 0;
@@ -2010,7 +2793,7 @@ void cil_portcon_init(struct cil_portcon **portcon)
 
 void cil_nodecon_init(struct cil_nodecon **nodecon)
 {
-	*nodecon = cil_malloc(sizeof(**nodecon));
+	*nodecon = cil_arena_alloc(sizeof(**nodecon));
 
 	(*nodecon)->addr_str = NULL;
 	(*nodecon)->addr = NULL;
@@ -2022,7 +2805,7 @@ void cil_nodecon_init(struct cil_nodecon **nodecon)
 
 void cil_genfscon_init(struct cil_genfscon **genfscon)
 {
-	*genfscon = cil_malloc(sizeof(**genfscon));
+	*genfscon = cil_arena_alloc(sizeof(**genfscon));
 
 	(*genfscon)->fs_str = NULL;
 	(*genfscon)->path_str = NULL;
@@ -2032,7 +2815,7 @@ void cil_genfscon_init(struct cil_genfscon **genfscon)
 
 void cil_pirqcon_init(struct cil_pirqcon **pirqcon)
 {
-	*pirqcon = cil_malloc(sizeof(**pirqcon));
+	*pirqcon = cil_arena_alloc(sizeof(**pirqcon));
 	
 	(*pirqcon)->pirq = 0;
 	(*pirqcon)->context_str = NULL;
@@ -2041,7 +2824,7 @@ void cil_pirqcon_init(struct cil_pirqcon **pirqcon)
 
 void cil_iomemcon_init(struct cil_iomemcon **iomemcon)
 {
-	*iomemcon = cil_malloc(sizeof(**iomemcon));
+	*iomemcon = cil_arena_alloc(sizeof(**iomemcon));
 
 	(*iomemcon)->iomem_low = 0;
 	(*iomemcon)->iomem_high = 0;
@@ -2051,7 +2834,7 @@ void cil_iomemcon_init(struct cil_iomemcon **iomemcon)
 
 void cil_ioportcon_init(struct cil_ioportcon **ioportcon)
 {
-	*ioportcon = cil_malloc(sizeof(**ioportcon));
+	*ioportcon = cil_arena_alloc(sizeof(**ioportcon));
 
 	(*ioportcon)->context_str = NULL;
 	(*ioportcon)->context = NULL;
@@ -2059,7 +2842,7 @@ void cil_ioportcon_init(struct cil_ioportcon **ioportcon)
 
 void cil_pcidevicecon_init(struct cil_pcidevicecon **pcidevicecon)
 {
-	*pcidevicecon = cil_malloc(sizeof(**pcidevicecon));
+	*pcidevicecon = cil_arena_alloc(sizeof(**pcidevicecon));
 
 	(*pcidevicecon)->dev = 0;
 	(*pcidevicecon)->context_str = NULL;
@@ -2068,7 +2851,7 @@ void cil_pcidevicecon_init(struct cil_pcidevicecon **pcidevicecon)
 
 void cil_fsuse_init(struct cil_fsuse **fsuse)
 {
-	*fsuse = cil_malloc(sizeof(**fsuse));
+	*fsuse = cil_arena_alloc(sizeof(**fsuse));
 
 	(*fsuse)->type = 0;
 	(*fsuse)->fs_str = NULL;
@@ -2078,7 +2861,7 @@ void cil_fsuse_init(struct cil_fsuse **fsuse)
 
 void cil_constrain_init(struct cil_constrain **constrain)
 {
-	*constrain = cil_malloc(sizeof(**constrain));
+	*constrain = cil_arena_alloc(sizeof(**constrain));
 
 	(*constrain)->classperms = NULL;
 	(*constrain)->str_expr = NULL;
@@ -2087,7 +2870,7 @@ void cil_constrain_init(struct cil_constrain **constrain)
 
 void cil_validatetrans_init(struct cil_validatetrans **validtrans)
 {
-	*validtrans = cil_malloc(sizeof(**validtrans));
+	*validtrans = cil_arena_alloc(sizeof(**validtrans));
 
 	(*validtrans)->class_str = NULL;
 	(*validtrans)->class = NULL;
@@ -2097,7 +2880,7 @@ void cil_validatetrans_init(struct cil_validatetrans **validtrans)
 
 void cil_ipaddr_init(struct cil_ipaddr **ipaddr)
 {
-	*ipaddr = cil_malloc(sizeof(**ipaddr));
+	*ipaddr = cil_arena_alloc(sizeof(**ipaddr));
 
 	cil_symtab_datum_init(&(*ipaddr)->datum);
 	memset(&(*ipaddr)->ip, 0, sizeof((*ipaddr)->ip));
@@ -2105,7 +2888,7 @@ void cil_ipaddr_init(struct cil_ipaddr **ipaddr)
 
 void cil_perm_init(struct cil_perm **perm)
 {
-	*perm = cil_malloc(sizeof(**perm));
+	*perm = cil_arena_alloc(sizeof(**perm));
 
 	cil_symtab_datum_init(&(*perm)->datum);
 	(*perm)->value = 0;
@@ -2114,7 +2897,7 @@ void cil_perm_init(struct cil_perm **perm)
 
 void cil_classpermission_init(struct cil_classpermission **cp)
 {
-	*cp = cil_malloc(sizeof(**cp));
+	*cp = cil_arena_alloc(sizeof(**cp));
 
 	cil_symtab_datum_init(&(*cp)->datum);
 	(*cp)->classperms = NULL;
@@ -2122,7 +2905,7 @@ void cil_classpermission_init(struct cil_classpermission **cp)
 
 void cil_classpermissionset_init(struct cil_classpermissionset **cps)
 {
-	*cps = cil_malloc(sizeof(**cps));
+	*cps = cil_arena_alloc(sizeof(**cps));
 
 	(*cps)->set_str = NULL;
 	(*cps)->classperms = NULL;
@@ -2130,23 +2913,25 @@ void cil_classpermissionset_init(struct cil_classpermissionset **cps)
 
 void cil_classperms_set_init(struct cil_classperms_set **cp_set)
 {
-	*cp_set = cil_malloc(sizeof(**cp_set));
+	*cp_set = cil_arena_alloc(sizeof(**cp_set));
 	(*cp_set)->set_str = NULL;
 	(*cp_set)->set = NULL;
 }
 
 void cil_classperms_init(struct cil_classperms **cp)
 {
-	*cp = cil_malloc(sizeof(**cp));
+	*cp = cil_arena_alloc(sizeof(**cp));
 	(*cp)->class_str = NULL;
 	(*cp)->class = NULL;
 	(*cp)->perm_strs = NULL;
 	(*cp)->perms = NULL;
+	(*cp)->evaluated = CIL_FALSE;
+	cil_vector_init(&(*cp)->datums);
 }
 
 void cil_classmapping_init(struct cil_classmapping **mapping)
 {
-	*mapping = cil_malloc(sizeof(**mapping));
+	*mapping = cil_arena_alloc(sizeof(**mapping));
 
 	(*mapping)->map_class_str = NULL;
 	(*mapping)->map_perm_str = NULL;
@@ -2155,7 +2940,7 @@ void cil_classmapping_init(struct cil_classmapping **mapping)
 
 void cil_user_init(struct cil_user **user)
 {
-	*user = cil_malloc(sizeof(**user));
+	*user = cil_arena_alloc(sizeof(**user));
 
 	cil_symtab_datum_init(&(*user)->datum);
 	(*user)->bounds = NULL;
@@ -2166,7 +2951,7 @@ void cil_user_init(struct cil_user **user)
 
 void cil_userlevel_init(struct cil_userlevel **usrlvl)
 {
-	*usrlvl = cil_malloc(sizeof(**usrlvl));
+	*usrlvl = cil_arena_alloc(sizeof(**usrlvl));
 
 	(*usrlvl)->user_str = NULL;
 	(*usrlvl)->level_str = NULL;
@@ -2175,7 +2960,7 @@ void cil_userlevel_init(struct cil_userlevel **usrlvl)
 
 void cil_userrange_init(struct cil_userrange **userrange)
 {
-	*userrange = cil_malloc(sizeof(**userrange));
+	*userrange = cil_arena_alloc(sizeof(**userrange));
 
 	(*userrange)->user_str = NULL;
 	(*userrange)->range_str = NULL;
@@ -2184,7 +2969,7 @@ void cil_userrange_init(struct cil_userrange **userrange)
 
 void cil_role_init(struct cil_role **role)
 {
-	*role = cil_malloc(sizeof(**role));
+	*role = cil_arena_alloc(sizeof(**role));
 
 	cil_symtab_datum_init(&(*role)->datum);
 	(*role)->bounds = NULL;
@@ -2194,7 +2979,7 @@ void cil_role_init(struct cil_role **role)
 
 void cil_type_init(struct cil_type **type)
 {
-	*type = cil_malloc(sizeof(**type));
+	*type = cil_arena_alloc(sizeof(**type));
 
 	cil_symtab_datum_init(&(*type)->datum);
 	(*type)->bounds = NULL;
@@ -2203,7 +2988,7 @@ void cil_type_init(struct cil_type **type)
 
 void cil_cat_init(struct cil_cat **cat)
 {
-	*cat = cil_malloc(sizeof(**cat));
+	*cat = cil_arena_alloc(sizeof(**cat));
 
 	cil_symtab_datum_init(&(*cat)->datum);
 	(*cat)->ordered = CIL_FALSE;
@@ -2212,21 +2997,21 @@ void cil_cat_init(struct cil_cat **cat)
 
 void cil_catorder_init(struct cil_catorder **catorder)
 {
-	*catorder = cil_malloc(sizeof(**catorder));
+	*catorder = cil_arena_alloc(sizeof(**catorder));
 
 	(*catorder)->cat_list_str = NULL;
 }
 
 void cil_sensorder_init(struct cil_sensorder **sensorder)
 {
-	*sensorder = cil_malloc(sizeof(**sensorder));
+	*sensorder = cil_arena_alloc(sizeof(**sensorder));
 
 	(*sensorder)->sens_list_str = NULL;
 }
 
 void cil_args_init(struct cil_args **args)
 {
-	*args = cil_malloc(sizeof(**args));
+	*args = cil_arena_alloc(sizeof(**args));
 	(*args)->arg_str = NULL;
 	(*args)->arg = NULL;
 	(*args)->param_str = NULL;
@@ -2235,25 +3020,25 @@ void cil_args_init(struct cil_args **args)
 
 void cil_call_init(struct cil_call **call)
 {
-	*call = cil_malloc(sizeof(**call));
+	*call = cil_arena_alloc(sizeof(**call));
 
 	(*call)->macro_str = NULL;
 	(*call)->macro = NULL;
-	(*call)->args_tree = NULL;
+	(*call)->args_tokens = NULL;
 	(*call)->args = NULL;
 	(*call)->copied = 0;
 }
 
 void cil_optional_init(struct cil_optional **optional)
 {
-	*optional = cil_malloc(sizeof(**optional));
+	*optional = cil_arena_alloc(sizeof(**optional));
 	(*optional)->enabled = CIL_TRUE;
 	cil_symtab_datum_init(&(*optional)->datum);
 }
 
 void cil_param_init(struct cil_param **param)
 {
-	*param = cil_malloc(sizeof(**param));
+	*param = cil_arena_alloc(sizeof(**param));
 
 	(*param)->str = NULL;
 	(*param)->flavor = CIL_NONE;
@@ -2261,7 +3046,7 @@ void cil_param_init(struct cil_param **param)
 
 void cil_macro_init(struct cil_macro **macro)
 {
-	*macro = cil_malloc(sizeof(**macro));
+	*macro = cil_arena_alloc(sizeof(**macro));
 
 	cil_symtab_datum_init(&(*macro)->datum);
 	cil_symtab_array_init((*macro)->symtab, cil_sym_sizes[CIL_SYM_ARRAY_MACRO]);
@@ -2270,14 +3055,14 @@ void cil_macro_init(struct cil_macro **macro)
 
 void cil_policycap_init(struct cil_policycap **policycap)
 {
-	*policycap = cil_malloc(sizeof(**policycap));
+	*policycap = cil_arena_alloc(sizeof(**policycap));
 
 	cil_symtab_datum_init(&(*policycap)->datum);
 }
 
 void cil_bounds_init(struct cil_bounds **bounds)
 {
-	*bounds = cil_malloc(sizeof(**bounds));
+	*bounds = cil_arena_alloc(sizeof(**bounds));
 
 	(*bounds)->parent_str = NULL;
 	(*bounds)->child_str = NULL;
@@ -2285,7 +3070,7 @@ void cil_bounds_init(struct cil_bounds **bounds)
 
 void cil_default_init(struct cil_default **def)
 {
-	*def = cil_malloc(sizeof(**def));
+	*def = cil_arena_alloc(sizeof(**def));
 
 	(*def)->flavor = CIL_NONE;
 	(*def)->class_strs = NULL;
@@ -2294,7 +3079,7 @@ void cil_default_init(struct cil_default **def)
 
 void cil_defaultrange_init(struct cil_defaultrange **def)
 {
-	*def = cil_malloc(sizeof(**def));
+	*def = cil_arena_alloc(sizeof(**def));
 
 	(*def)->class_strs = NULL;
 	(*def)->class_datums = NULL;
@@ -2302,11 +3087,11 @@ void cil_defaultrange_init(struct cil_defaultrange **def)
 
 void cil_handleunknown_init(struct cil_handleunknown **unk)
 {
-	*unk = cil_malloc(sizeof(**unk));
+	*unk = cil_arena_alloc(sizeof(**unk));
 }
 
 void cil_mls_init(struct cil_mls **mls)
 {
-	*mls = cil_malloc(sizeof(**mls));
+	*mls = cil_arena_alloc(sizeof(**mls));
 	(*mls)->value = 0;
 }
@@ -0,0 +1,817 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+/*
+ * Region allocator for AST objects.
+ *
+ * Lists, list items and statement payloads are carved out of large regions
+ * owned by an arena. Objects created together sit next to each other, and a
+ * whole arena goes back to the system with one munmap per region. Regions are aligned to their size and start with a header naming
+ * their arena, so cil_arena_release() can find the owner of any object.
+ * Released objects are kept on per-size free lists and handed out again by
+ * later allocations of the same size. Sizes up to 1K are told apart by 8
+ * bytes and bigger ones are rounded up to a power of two, while objects too
+ * big to share a region are unmapped as soon as they are released.
+ *
+ * Objects that hold memory from outside of the arena, such as ebitmaps, are
+ * allocated with cil_arena_alloc_owned(). The arena keeps a list of them and
+ * runs their destroy function when it is destroyed itself, so that a db can
+ * be thrown away without visiting its AST.
+ *
+ * Tree nodes are not placed in the regions. They come from a table of
+ * CIL_ARENA_NODE_SIZE byte slots that is reserved once for the process and
+ * handed out to arenas one region sized block at a time, so that nodes can
+ * link to each other by 32 bit slot index. A block starts with the same
+ * header as a region, and blocks of a destroyed arena are given back to the
+ * table for the next arena to use. The table is reserved big enough for
+ * every index where the address space allows it, and smaller, holding
+ * fewer nodes, where it does not (on 32 bit systems, or under ulimit -v).
+ *
+ * A snapshot is an arena saved as it is in memory. Its regions are mapped
+ * back from the file and added to an arena with cil_arena_add_image(), and
+ * its node blocks are mapped into the table with cil_arena_map_nodes(),
+ * where they take the blocks they were saved from when those are free. The
+ * table is placed at a fixed address when it can be, so that node addresses
+ * saved in an image usually hold in the process that loads it. Bitmaps in
+ * an image have no destroy function, since their nodes are in the image as
+ * well.
+ *
+ * Allocations come from the arena last passed to cil_arena_enter() on the
+ * calling thread. A thread that has not entered one gets a private arena
+ * that is never unmapped and never reuses memory, so objects made outside
+ * of any db stay valid for the life of the process.
+ *
+ * An arena is only ever touched by one thread at a time. Threads that work
+ * on one db side by side each enter an arena of their own marked with
+ * cil_arena_defer(), and objects of other arenas they release are queued
+ * on it until cil_arena_release_deferred() hands them back to their owners
+ * once the threads are done.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sepol/errcodes.h>
+
+#include "cil_mem.h"
+#include "cil_arena.h"
+
+#define CIL_ARENA_ALIGN		8
+#define CIL_ARENA_SMALL_CLASSES	128
+#define CIL_ARENA_CLASSES	(CIL_ARENA_SMALL_CLASSES + CIL_ARENA_REGION_SHIFT - 11)
+#define CIL_ARENA_NODE_TABLE_MAX	((uint64_t)CIL_ARENA_NODE_SIZE << 32)
+#define CIL_ARENA_NODE_TABLE_MIN	((uint64_t)CIL_ARENA_REGION_SIZE << 6)
+#if UINTPTR_MAX > UINT32_MAX
+#define CIL_ARENA_NODE_TABLE_BASE	((uintptr_t)0x200000000000)
+#endif
+
+struct cil_arena_region {
+	struct cil_arena *arena;
+	struct cil_arena_region *next;
+	size_t size;
+};
+
+struct cil_arena_owned {
+	struct cil_arena_owned *next;
+	struct cil_arena_owned **pprev;
+	void (*destroy)(void *ptr);
+};
+
+struct cil_arena {
+	struct cil_arena_region *regions;
+	struct cil_arena_owned *owned;
+	char *next;
+	char *end;
+	void *free[CIL_ARENA_CLASSES];
+	struct cil_arena_region *node_regions;
+	char *node_next;
+	char *node_end;
+	void *node_free;
+	void *deferred[CIL_ARENA_CLASSES + 1];
+	void *deferred_nodes;
+	int defer;
+	int reuse;
+};
+
+typedef char cil_arena_header_fits[sizeof(struct cil_arena_region) <= CIL_ARENA_HEADER_SIZE ? 1 : -1];
+
+#define CIL_ARENA_REGION(ptr) \
+	((struct cil_arena_region *)((uintptr_t)(ptr) & ~(uintptr_t)(CIL_ARENA_REGION_SIZE - 1)))
+
+static __thread struct cil_arena *cil_arena_current;
+static __thread struct cil_arena *cil_arena_fallback;
+
+uintptr_t cil_arena_nodes;
+static pthread_once_t cil_arena_nodes_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t cil_arena_nodes_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uintptr_t cil_arena_nodes_top;
+static uintptr_t cil_arena_nodes_limit;	/* where the blocks taken by images start */
+static uint32_t cil_arena_nodes_blocks;
+static struct cil_arena_region *cil_arena_nodes_free;
+
+/* Map size bytes (a multiple of the region size) aligned to the region size */
+static struct cil_arena_region *__cil_arena_region_map(struct cil_arena *arena, size_t size)
+{
+	struct cil_arena_region *region = NULL;
+	char *mem = NULL;
+	char *aligned = NULL;
+
+	mem = mmap(NULL, size + CIL_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+
+	aligned = (char *)(((uintptr_t)mem + CIL_ARENA_REGION_SIZE - 1) & ~(uintptr_t)(CIL_ARENA_REGION_SIZE - 1));
+	if (aligned != mem) {
+		munmap(mem, aligned - mem);
+	}
+	munmap(aligned + size, (mem + CIL_ARENA_REGION_SIZE) - aligned);
+
+	region = (struct cil_arena_region *)aligned;
+	region->arena = arena;
+	region->size = size;
+	region->next = arena->regions;
+	arena->regions = region;
+
+	return region;
+}
+
+/* Reserve the address space of the node table. Nothing is committed until
+ * a block is handed to an arena. The table only needs to be aligned to the
+ * region size, so when all of it cannot be had, half as much is tried
+ * until CIL_ARENA_NODE_TABLE_MIN. */
+static void __cil_arena_nodes_reserve(void)
+{
+	uint64_t size = CIL_ARENA_NODE_TABLE_MAX;
+	char *mem = MAP_FAILED;
+	uintptr_t aligned;
+
+	/* Leave most of a 32 bit address space to everything else */
+	if (size > (uint64_t)(UINTPTR_MAX / 4) + 1) {
+		size = (uint64_t)(UINTPTR_MAX / 4) + 1;
+	}
+
+#ifdef CIL_ARENA_NODE_TABLE_BASE
+	mem = mmap((void *)CIL_ARENA_NODE_TABLE_BASE, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (mem == (char *)CIL_ARENA_NODE_TABLE_BASE) {
+		cil_arena_nodes = CIL_ARENA_NODE_TABLE_BASE;
+		cil_arena_nodes_top = cil_arena_nodes;
+		cil_arena_nodes_limit = cil_arena_nodes + size;
+		cil_arena_nodes_blocks = size >> CIL_ARENA_REGION_SHIFT;
+		return;
+	}
+	if (mem != MAP_FAILED) {
+		munmap(mem, size);
+		mem = MAP_FAILED;
+	}
+#endif
+
+	for (; size >= CIL_ARENA_NODE_TABLE_MIN; size /= 2) {
+		mem = mmap(NULL, size + CIL_ARENA_REGION_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (mem != MAP_FAILED) {
+			break;
+		}
+	}
+	if (mem == MAP_FAILED) {
+		(*CIL_MEM_ERROR_HANDLER)();
+		return;
+	}
+
+	aligned = ((uintptr_t)mem + CIL_ARENA_REGION_SIZE - 1) & ~(uintptr_t)(CIL_ARENA_REGION_SIZE - 1);
+	if (aligned != (uintptr_t)mem) {
+		munmap(mem, aligned - (uintptr_t)mem);
+	}
+	munmap((char *)aligned + size, (uintptr_t)mem + CIL_ARENA_REGION_SIZE - aligned);
+
+	cil_arena_nodes = aligned;
+	cil_arena_nodes_top = aligned;
+	cil_arena_nodes_limit = aligned + size;
+	cil_arena_nodes_blocks = size >> CIL_ARENA_REGION_SHIFT;
+}
+
+/* The number of blocks in the node table */
+uint32_t cil_arena_node_blocks(void)
+{
+	pthread_once(&cil_arena_nodes_once, __cil_arena_nodes_reserve);
+
+	return cil_arena_nodes_blocks;
+}
+
+static void __cil_arena_nodes_grow(struct cil_arena *arena)
+{
+	struct cil_arena_region *region = NULL;
+
+	pthread_once(&cil_arena_nodes_once, __cil_arena_nodes_reserve);
+
+	pthread_mutex_lock(&cil_arena_nodes_mutex);
+	if (cil_arena_nodes_free != NULL) {
+		region = cil_arena_nodes_free;
+		cil_arena_nodes_free = region->next;
+	} else if (cil_arena_nodes_top < cil_arena_nodes_limit) {
+		region = (struct cil_arena_region *)cil_arena_nodes_top;
+		if (mprotect(region, CIL_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE) == 0) {
+			cil_arena_nodes_top += CIL_ARENA_REGION_SIZE;
+		} else {
+			region = NULL;
+		}
+	}
+	pthread_mutex_unlock(&cil_arena_nodes_mutex);
+
+	if (region == NULL) {
+		(*CIL_MEM_ERROR_HANDLER)();
+		return;
+	}
+
+	region->arena = arena;
+	region->size = CIL_ARENA_REGION_SIZE;
+	region->next = arena->node_regions;
+	arena->node_regions = region;
+	arena->node_next = (char *)region + CIL_ARENA_NODE_SIZE;
+	arena->node_end = (char *)region + CIL_ARENA_REGION_SIZE;
+}
+
+/* Give a block back to the node table along with the memory behind it,
+ * which may be a mapping of an image */
+static void __cil_arena_nodes_put(struct cil_arena_region *region)
+{
+	if (mmap(region, CIL_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED) {
+		(*CIL_MEM_ERROR_HANDLER)();
+		return;
+	}
+
+	pthread_mutex_lock(&cil_arena_nodes_mutex);
+	region->next = cil_arena_nodes_free;
+	cil_arena_nodes_free = region;
+	pthread_mutex_unlock(&cil_arena_nodes_mutex);
+}
+
+/* Round size up to what is handed out for it and return its free list, or
+ * CIL_ARENA_CLASSES for objects that get a region of their own. */
+static size_t __cil_arena_class(size_t *size)
+{
+	size_t class = CIL_ARENA_SMALL_CLASSES;
+	size_t rounded;
+
+	if (*size <= CIL_ARENA_SMALL_CLASSES * CIL_ARENA_ALIGN) {
+		*size = *size == 0 ? CIL_ARENA_ALIGN : (*size + CIL_ARENA_ALIGN - 1) & ~(size_t)(CIL_ARENA_ALIGN - 1);
+		return *size / CIL_ARENA_ALIGN - 1;
+	}
+
+	rounded = CIL_ARENA_SMALL_CLASSES * CIL_ARENA_ALIGN * 2;
+	while (rounded < *size && class < CIL_ARENA_CLASSES) {
+		rounded <<= 1;
+		class++;
+	}
+
+	if (class == CIL_ARENA_CLASSES) {
+		*size = (*size + CIL_ARENA_ALIGN - 1) & ~(size_t)(CIL_ARENA_ALIGN - 1);
+	} else {
+		*size = rounded;
+	}
+
+	return class;
+}
+
+static void __cil_arena_grow(struct cil_arena *arena)
+{
+	struct cil_arena_region *region = NULL;
+
+	region = __cil_arena_region_map(arena, CIL_ARENA_REGION_SIZE);
+	arena->next = (char *)region + CIL_ARENA_HEADER_SIZE;
+	arena->end = (char *)region + CIL_ARENA_REGION_SIZE;
+}
+
+static void __cil_arena_owned_destroy(struct cil_arena *arena)
+{
+	struct cil_arena_owned *owned = NULL;
+
+	for (owned = arena->owned; owned != NULL; owned = owned->next) {
+		if (owned->destroy != NULL) {
+			owned->destroy(owned + 1);
+		}
+	}
+	arena->owned = NULL;
+}
+
+void cil_arena_init(struct cil_arena **arena)
+{
+	struct cil_arena *new_arena = cil_calloc(1, sizeof(*new_arena));
+
+	new_arena->reuse = 1;
+
+	*arena = new_arena;
+}
+
+void cil_arena_destroy(struct cil_arena **arena)
+{
+	struct cil_arena_region *region = NULL;
+	struct cil_arena_region *next = NULL;
+
+	if (*arena == NULL) {
+		return;
+	}
+
+	if (cil_arena_current == *arena) {
+		cil_arena_current = NULL;
+	}
+
+	__cil_arena_owned_destroy(*arena);
+
+	for (region = (*arena)->regions; region != NULL; region = next) {
+		next = region->next;
+		munmap(region, region->size);
+	}
+
+	for (region = (*arena)->node_regions; region != NULL; region = next) {
+		next = region->next;
+		__cil_arena_nodes_put(region);
+	}
+
+	free(*arena);
+	*arena = NULL;
+}
+
+/* Forget every object in the arena. The oldest standard sized region and
+ * the oldest node block are kept to be filled again. */
+void cil_arena_reset(struct cil_arena *arena)
+{
+	struct cil_arena_region *region = NULL;
+	struct cil_arena_region *next = NULL;
+	struct cil_arena_region *keep = NULL;
+	int i;
+
+	__cil_arena_owned_destroy(arena);
+
+	for (region = arena->regions; region != NULL; region = region->next) {
+		if (region->size == CIL_ARENA_REGION_SIZE) {
+			keep = region;
+		}
+	}
+
+	for (region = arena->regions; region != NULL; region = next) {
+		next = region->next;
+		if (region != keep) {
+			munmap(region, region->size);
+		}
+	}
+
+	arena->regions = keep;
+	if (keep != NULL) {
+		keep->next = NULL;
+		arena->next = (char *)keep + CIL_ARENA_HEADER_SIZE;
+		arena->end = (char *)keep + CIL_ARENA_REGION_SIZE;
+	} else {
+		arena->next = NULL;
+		arena->end = NULL;
+	}
+
+	for (i = 0; i < CIL_ARENA_CLASSES; i++) {
+		arena->free[i] = NULL;
+	}
+
+	keep = NULL;
+	for (region = arena->node_regions; region != NULL; region = next) {
+		next = region->next;
+		if (next == NULL) {
+			keep = region;
+		} else {
+			__cil_arena_nodes_put(region);
+		}
+	}
+
+	arena->node_regions = keep;
+	arena->node_free = NULL;
+	if (keep != NULL) {
+		arena->node_next = (char *)keep + CIL_ARENA_NODE_SIZE;
+		arena->node_end = (char *)keep + CIL_ARENA_REGION_SIZE;
+	} else {
+		arena->node_next = NULL;
+		arena->node_end = NULL;
+	}
+}
+
+/* Make arena the one allocated from by this thread and return the previous
+ * one, which the caller passes back here when it is done. */
+struct cil_arena *cil_arena_enter(struct cil_arena *arena)
+{
+	struct cil_arena *prev = cil_arena_current;
+
+	cil_arena_current = arena;
+
+	return prev;
+}
+
+static struct cil_arena *__cil_arena_current(void)
+{
+	if (cil_arena_current != NULL) {
+		return cil_arena_current;
+	}
+
+	if (cil_arena_fallback == NULL) {
+		cil_arena_init(&cil_arena_fallback);
+		cil_arena_fallback->reuse = 0;
+	}
+
+	return cil_arena_fallback;
+}
+
+void *cil_arena_alloc(size_t size)
+{
+	struct cil_arena *arena = __cil_arena_current();
+	size_t class;
+	void *mem = NULL;
+
+	class = __cil_arena_class(&size);
+
+	if (class == CIL_ARENA_CLASSES) {
+		/* Oversized objects get a region of their own. Nothing else is
+		 * placed after them, since only the first region-sized block of a
+		 * region can be traced back to its header. */
+		size = (size + CIL_ARENA_HEADER_SIZE + CIL_ARENA_REGION_SIZE - 1) & ~(size_t)(CIL_ARENA_REGION_SIZE - 1);
+		return (char *)__cil_arena_region_map(arena, size) + CIL_ARENA_HEADER_SIZE;
+	}
+
+	if (arena->free[class] != NULL) {
+		mem = arena->free[class];
+		arena->free[class] = *(void **)mem;
+		return mem;
+	}
+
+	if ((size_t)(arena->end - arena->next) < size) {
+		__cil_arena_grow(arena);
+	}
+
+	mem = arena->next;
+	arena->next += size;
+
+	return mem;
+}
+
+/* Give an object back to the arena it came from. size must be the size it
+ * was allocated with. */
+/* The arena of the calling thread when it has to queue an object of owner
+ * instead of handing it back */
+static struct cil_arena *__cil_arena_deferring(struct cil_arena *owner)
+{
+	struct cil_arena *arena = cil_arena_current;
+
+	if (arena != NULL && arena != owner && arena->defer) {
+		return arena;
+	}
+
+	return NULL;
+}
+
+static void __cil_arena_free(void *ptr, size_t class)
+{
+	struct cil_arena_region *region = CIL_ARENA_REGION(ptr);
+	struct cil_arena_region **prev = NULL;
+	struct cil_arena *arena = region->arena;
+
+	if (class < CIL_ARENA_CLASSES) {
+		*(void **)ptr = arena->free[class];
+		arena->free[class] = ptr;
+		return;
+	}
+
+	prev = &arena->regions;
+	while (*prev != region) {
+		prev = &(*prev)->next;
+	}
+	*prev = region->next;
+	munmap(region, region->size);
+}
+
+void cil_arena_release(void *ptr, size_t size)
+{
+	struct cil_arena *arena = NULL;
+	struct cil_arena *deferring = NULL;
+	size_t class;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	arena = CIL_ARENA_REGION(ptr)->arena;
+	if (!arena->reuse) {
+		return;
+	}
+
+	class = __cil_arena_class(&size);
+	deferring = __cil_arena_deferring(arena);
+	if (deferring != NULL) {
+		*(void **)ptr = deferring->deferred[class];
+		deferring->deferred[class] = ptr;
+		return;
+	}
+
+	__cil_arena_free(ptr, class);
+}
+
+/* Allocate an object that destroy is run on when its arena is destroyed,
+ * unless it is released before then */
+void *cil_arena_alloc_owned(size_t size, void (*destroy)(void *ptr))
+{
+	struct cil_arena_owned *owned = cil_arena_alloc(sizeof(*owned) + size);
+	struct cil_arena *arena = CIL_ARENA_REGION(owned)->arena;
+
+	owned->destroy = destroy;
+	owned->next = arena->owned;
+	owned->pprev = &arena->owned;
+	if (arena->owned != NULL) {
+		arena->owned->pprev = &owned->next;
+	}
+	arena->owned = owned;
+
+	return owned + 1;
+}
+
+/* Destroy and release an object from cil_arena_alloc_owned(). Objects of
+ * an image have no destroy function and are on no list. */
+void cil_arena_release_owned(void *ptr, size_t size)
+{
+	struct cil_arena_owned *owned = NULL;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	owned = (struct cil_arena_owned *)ptr - 1;
+	if (owned->destroy != NULL) {
+		owned->destroy(ptr);
+	}
+
+	if (__cil_arena_deferring(CIL_ARENA_REGION(owned)->arena) != NULL) {
+		/* The owner's list is not ours to change, so the object stays on
+		 * it with nothing left to destroy until the owner goes */
+		owned->destroy = NULL;
+		return;
+	}
+
+	if (owned->pprev != NULL) {
+		*owned->pprev = owned->next;
+		if (owned->next != NULL) {
+			owned->next->pprev = owned->pprev;
+		}
+	}
+
+	cil_arena_release(owned, sizeof(*owned) + size);
+}
+
+void *cil_arena_alloc_node(void)
+{
+	struct cil_arena *arena = __cil_arena_current();
+	void *mem = NULL;
+
+	if (arena->node_free != NULL) {
+		mem = arena->node_free;
+		arena->node_free = *(void **)mem;
+		return mem;
+	}
+
+	if (arena->node_next == arena->node_end) {
+		__cil_arena_nodes_grow(arena);
+	}
+
+	mem = arena->node_next;
+	arena->node_next += CIL_ARENA_NODE_SIZE;
+
+	return mem;
+}
+
+void cil_arena_release_node(void *ptr)
+{
+	struct cil_arena *arena = NULL;
+	struct cil_arena *deferring = NULL;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	arena = CIL_ARENA_REGION(ptr)->arena;
+	if (!arena->reuse) {
+		return;
+	}
+
+	deferring = __cil_arena_deferring(arena);
+	if (deferring != NULL) {
+		*(void **)ptr = deferring->deferred_nodes;
+		deferring->deferred_nodes = ptr;
+		return;
+	}
+
+	*(void **)ptr = arena->node_free;
+	arena->node_free = ptr;
+}
+
+/* Queue what is released of other arenas while arena is entered, so that
+ * threads sharing a db never change an arena they did not enter */
+void cil_arena_defer(struct cil_arena *arena)
+{
+	arena->defer = 1;
+}
+
+/* Hand the objects queued on arena back to their owners and stop queueing.
+ * No thread may be releasing into those owners meanwhile. */
+void cil_arena_release_deferred(struct cil_arena *arena)
+{
+	struct cil_arena *owner = NULL;
+	void *ptr = NULL;
+	size_t class;
+
+	for (class = 0; class <= CIL_ARENA_CLASSES; class++) {
+		while (arena->deferred[class] != NULL) {
+			ptr = arena->deferred[class];
+			arena->deferred[class] = *(void **)ptr;
+			__cil_arena_free(ptr, class);
+		}
+	}
+
+	while (arena->deferred_nodes != NULL) {
+		ptr = arena->deferred_nodes;
+		arena->deferred_nodes = *(void **)ptr;
+		owner = CIL_ARENA_REGION(ptr)->arena;
+		*(void **)ptr = owner->node_free;
+		owner->node_free = ptr;
+	}
+
+	arena->defer = 0;
+}
+
+void cil_arena_image_init(struct cil_arena_image *image)
+{
+	memset(image, 0, sizeof(*image));
+}
+
+void cil_arena_image_destroy(struct cil_arena_image *image)
+{
+	free(image->data);
+	memset(image, 0, sizeof(*image));
+}
+
+/* Add a zeroed region of size bytes to the end of the image */
+static size_t __cil_arena_image_region(struct cil_arena_image *image, size_t size)
+{
+	struct cil_arena_region *region = NULL;
+	size_t offset = image->size;
+
+	if (image->alloc - image->size < size) {
+		while (image->alloc - image->size < size) {
+			image->alloc = image->alloc ? image->alloc * 2 : CIL_ARENA_REGION_SIZE * 4;
+		}
+		image->data = cil_realloc(image->data, image->alloc);
+	}
+
+	memset(image->data + offset, 0, size);
+	region = (struct cil_arena_region *)(image->data + offset);
+	region->size = size;
+	image->size += size;
+
+	return offset;
+}
+
+/* Place size bytes in the image and return their offset. The memory is
+ * zeroed. */
+size_t cil_arena_image_alloc(struct cil_arena_image *image, size_t size)
+{
+	size_t offset;
+
+	if (__cil_arena_class(&size) == CIL_ARENA_CLASSES) {
+		size = (size + CIL_ARENA_HEADER_SIZE + CIL_ARENA_REGION_SIZE - 1) & ~(size_t)(CIL_ARENA_REGION_SIZE - 1);
+		return __cil_arena_image_region(image, size) + CIL_ARENA_HEADER_SIZE;
+	}
+
+	if (image->end - image->next < size) {
+		offset = __cil_arena_image_region(image, CIL_ARENA_REGION_SIZE);
+		image->next = offset + CIL_ARENA_HEADER_SIZE;
+		image->end = offset + CIL_ARENA_REGION_SIZE;
+	}
+
+	offset = image->next;
+	image->next += size;
+
+	return offset;
+}
+
+/* Place an object that cil_arena_release_owned() can be called on */
+size_t cil_arena_image_alloc_owned(struct cil_arena_image *image, size_t size)
+{
+	return cil_arena_image_alloc(image, sizeof(struct cil_arena_owned) + size) + sizeof(struct cil_arena_owned);
+}
+
+/* Hand the regions of an image mapped at mem, which must be aligned to the
+ * region size, to the current arena */
+int cil_arena_add_image(void *mem, size_t size)
+{
+	struct cil_arena *arena = __cil_arena_current();
+	struct cil_arena_region *region = NULL;
+	size_t offset;
+
+	if (((uintptr_t)mem & (CIL_ARENA_REGION_SIZE - 1)) != 0) {
+		return SEPOL_ERR;
+	}
+
+	for (offset = 0; offset < size; offset += region->size) {
+		region = (struct cil_arena_region *)((char *)mem + offset);
+		if (region->size == 0 || (region->size & (CIL_ARENA_REGION_SIZE - 1)) != 0 || region->size > size - offset) {
+			return SEPOL_ERR;
+		}
+	}
+
+	for (offset = 0; offset < size; offset += region->size) {
+		region = (struct cil_arena_region *)((char *)mem + offset);
+		region->arena = arena;
+		region->next = arena->regions;
+		arena->regions = region;
+	}
+
+	return SEPOL_OK;
+}
+
+/* Map count node blocks of an image, found at offset in fd, into the node
+ * table for the current arena. They go to blocks first onwards when those
+ * have never been used, and to any free blocks otherwise; blocks[] is set
+ * to where each one went. */
+int cil_arena_map_nodes(int fd, uint64_t offset, uint32_t first, uint32_t count, uint32_t *blocks)
+{
+	struct cil_arena *arena = __cil_arena_current();
+	struct cil_arena_region *region = NULL;
+	uintptr_t start;
+	uint32_t taken = 0;
+	uint32_t i;
+	int rc = SEPOL_OK;
+
+	pthread_once(&cil_arena_nodes_once, __cil_arena_nodes_reserve);
+
+	pthread_mutex_lock(&cil_arena_nodes_mutex);
+	if (first > 0 && first <= cil_arena_nodes_blocks && count <= cil_arena_nodes_blocks - first &&
+		(start = cil_arena_nodes + ((uintptr_t)first << CIL_ARENA_REGION_SHIFT)) >= cil_arena_nodes_top &&
+		start + ((uintptr_t)count << CIL_ARENA_REGION_SHIFT) <= cil_arena_nodes_limit) {
+		for (i = 0; i < count; i++) {
+			blocks[i] = first + i;
+		}
+		cil_arena_nodes_limit = start;
+		taken = count;
+	} else {
+		for (taken = 0; taken < count; taken++) {
+			if (cil_arena_nodes_free != NULL) {
+				region = cil_arena_nodes_free;
+				cil_arena_nodes_free = region->next;
+			} else if (cil_arena_nodes_top < cil_arena_nodes_limit) {
+				region = (struct cil_arena_region *)cil_arena_nodes_top;
+				cil_arena_nodes_top += CIL_ARENA_REGION_SIZE;
+			} else {
+				break;
+			}
+			blocks[taken] = ((uintptr_t)region - cil_arena_nodes) >> CIL_ARENA_REGION_SHIFT;
+		}
+	}
+	pthread_mutex_unlock(&cil_arena_nodes_mutex);
+
+	for (i = 0; i < taken; i++) {
+		region = (struct cil_arena_region *)(cil_arena_nodes + ((uintptr_t)blocks[i] << CIL_ARENA_REGION_SHIFT));
+		if (rc == SEPOL_OK && taken == count &&
+			mmap(region, CIL_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, offset + ((uint64_t)i << CIL_ARENA_REGION_SHIFT)) == MAP_FAILED) {
+			rc = SEPOL_ERR;
+		}
+		if (rc != SEPOL_OK || taken < count) {
+			/* The table keeps what could not be used */
+			__cil_arena_nodes_put(region);
+			continue;
+		}
+		region->arena = arena;
+		region->size = CIL_ARENA_REGION_SIZE;
+		region->next = arena->node_regions;
+		arena->node_regions = region;
+	}
+
+	return (taken == count) ? rc : SEPOL_ERR;
+}
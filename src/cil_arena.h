@@ -0,0 +1,93 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#ifndef CIL_ARENA_H_
+#define CIL_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Regions are aligned to their size and start with a header of
+ * CIL_ARENA_HEADER_SIZE bytes */
+#define CIL_ARENA_REGION_SHIFT	20
+#define CIL_ARENA_REGION_SIZE	(1 << CIL_ARENA_REGION_SHIFT)
+#define CIL_ARENA_HEADER_SIZE	24
+
+struct cil_arena;
+
+/* An arena laid out in a buffer, to be written to a file and mapped back
+ * as a run of regions with cil_arena_add_image(). Objects are placed the
+ * way cil_arena_alloc() would place them and are named by their offset
+ * from the start of the image, which stays valid as the buffer grows. */
+struct cil_arena_image {
+	char *data;
+	size_t size;
+	size_t alloc;
+	size_t next;
+	size_t end;
+};
+
+void cil_arena_init(struct cil_arena **arena);
+void cil_arena_destroy(struct cil_arena **arena);
+void cil_arena_reset(struct cil_arena *arena);
+struct cil_arena *cil_arena_enter(struct cil_arena *arena);
+void *cil_arena_alloc(size_t size);
+void cil_arena_release(void *ptr, size_t size);
+void *cil_arena_alloc_owned(size_t size, void (*destroy)(void *ptr));
+void cil_arena_release_owned(void *ptr, size_t size);
+void cil_arena_defer(struct cil_arena *arena);
+void cil_arena_release_deferred(struct cil_arena *arena);
+
+void cil_arena_image_init(struct cil_arena_image *image);
+void cil_arena_image_destroy(struct cil_arena_image *image);
+size_t cil_arena_image_alloc(struct cil_arena_image *image, size_t size);
+size_t cil_arena_image_alloc_owned(struct cil_arena_image *image, size_t size);
+int cil_arena_add_image(void *mem, size_t size);
+
+/* Tree nodes are kept in one table of fixed size slots shared by every
+ * arena, starting at cil_arena_nodes. A slot's offset in the table shifted
+ * right by CIL_ARENA_NODE_SHIFT is its index, and index 0 is never handed
+ * out. */
+#define CIL_ARENA_NODE_SHIFT	5
+#define CIL_ARENA_NODE_SIZE	(1 << CIL_ARENA_NODE_SHIFT)
+
+/* The table is handed out in region sized blocks of 1 << CIL_ARENA_BLOCK_SHIFT
+ * slots, the first of which holds the block's header. It has at most
+ * CIL_ARENA_NUM_BLOCKS of them, and cil_arena_node_blocks() in fact. */
+#define CIL_ARENA_BLOCK_SHIFT	(CIL_ARENA_REGION_SHIFT - CIL_ARENA_NODE_SHIFT)
+#define CIL_ARENA_NUM_BLOCKS	(UINT32_C(1) << (32 - CIL_ARENA_BLOCK_SHIFT))
+
+extern uintptr_t cil_arena_nodes;
+
+uint32_t cil_arena_node_blocks(void);
+void *cil_arena_alloc_node(void);
+void cil_arena_release_node(void *ptr);
+int cil_arena_map_nodes(int fd, uint64_t offset, uint32_t first, uint32_t count, uint32_t *blocks);
+
+#endif /* CIL_ARENA_H_ */
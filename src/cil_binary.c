@@ -43,24 +43,25 @@
 #include "cil_log.h"
 #include "cil_mem.h"
 #include "cil_tree.h"
+#include "cil_index.h"
 #include "cil_binary.h"
 #include "cil_symtab.h"
 
-/* There are 44000 filename_trans in current fedora policy. 1.33 times this is the recommended
- * size of a hashtable. The next power of 2 of this is 2 ** 16.
+/* Starting sizes of the duplicate transition indexes. They grow as rules are
+ * added, so these only need to cover small policies.
  */
-#define FILENAME_TRANS_TABLE_SIZE 1 << 16
-#define RANGE_TRANS_TABLE_SIZE 1 << 13
-#define ROLE_TRANS_TABLE_SIZE 1 << 10
+#define FILENAME_TRANS_TABLE_SIZE 1 << 10
+#define RANGE_TRANS_TABLE_SIZE 1 << 6
+#define ROLE_TRANS_TABLE_SIZE 1 << 6
 
 struct cil_args_binary {
 	const struct cil_db *db;
 	policydb_t *pdb;
 	struct cil_list *neverallows;
 	int pass;
-	hashtab_t filename_trans_table;
-	hashtab_t range_trans_table;
-	hashtab_t role_trans_table;
+	struct cil_complex_symtab *filename_trans_table;
+	struct cil_complex_symtab *range_trans_table;
+	struct cil_complex_symtab *role_trans_table;
 };
 
 struct cil_args_booleanif {
@@ -69,7 +70,7 @@ struct cil_args_booleanif {
 	cond_node_t *cond_node;
 	enum cil_flavor cond_flavor;
 	struct cil_list *neverallows;
-	hashtab_t filename_trans_table;
+	struct cil_complex_symtab *filename_trans_table;
 };
 
 struct cil_neverallow {
@@ -169,7 +170,7 @@ static int __cil_get_sepol_level_datum(policydb_t *pdb, struct cil_symtab_datum
 
 static int __cil_expand_role(struct cil_symtab_datum *datum, ebitmap_t *new)
 {
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	if (node->flavor == CIL_ROLEATTRIBUTE) {
 		struct cil_roleattribute *attr = (struct cil_roleattribute *)datum;
@@ -195,7 +196,7 @@ exit:
 
 static int __cil_expand_type(struct cil_symtab_datum *datum, ebitmap_t *new)
 {
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	if (node->flavor == CIL_TYPEATTRIBUTE) {
 		struct cil_typeattribute *attr = (struct cil_typeattribute *)datum;
@@ -243,9 +244,9 @@ static void __add_classes_from_classperms_list(struct cil_list *classperms, stru
 			if (FLAVOR(cp->class) == CIL_CLASS) {
 				cil_list_append(class_list, CIL_CLASS, cp->class);
 			} else { /* MAP */
-				struct cil_list_item *i = NULL;
-				cil_list_for_each(i, cp->perms) {
-					struct cil_perm *cmp = i->data;
+				struct cil_perm *cmp;
+				uint32_t i;
+				cil_vector_for_each(cmp, i, &cp->datums) {
 					__add_classes_from_classperms_list(cmp->classperms, class_list);
 				}
 			}	
@@ -287,8 +288,8 @@ int cil_common_to_policydb(policydb_t *pdb, struct cil_class *cil_common, common
 	int rc = SEPOL_ERR;
 	uint32_t value = 0;
 	char *key = NULL;
-	struct cil_tree_node *node = cil_common->datum.nodes->head->data;
-	struct cil_tree_node *cil_perm = node->cl_head;
+	struct cil_tree_node *node = cil_vector_get(&cil_common->datum.nodes, 0);
+	struct cil_tree_node *cil_perm = cil_tree_node_head(node);
 	common_datum_t *sepol_common = cil_malloc(sizeof(*sepol_common));
 	memset(sepol_common, 0, sizeof(common_datum_t));
 
@@ -318,7 +319,7 @@ int cil_common_to_policydb(policydb_t *pdb, struct cil_class *cil_common, common
 		}
 		sepol_perm->s.value = sepol_common->permissions.nprim + 1;
 		sepol_common->permissions.nprim++;
-		cil_perm = cil_perm->next;
+		cil_perm = cil_tree_node_next(cil_perm);
 	}
 
 	*common_out = sepol_common;
@@ -339,8 +340,8 @@ int cil_classorder_to_policydb(policydb_t *pdb, const struct cil_db *db)
 		struct cil_class *cil_class = curr_class->data;
 		uint32_t value = 0;
 		char *key = NULL;
-		struct cil_tree_node *node = cil_class->datum.nodes->head->data;
-		struct cil_tree_node *cil_perm = node->cl_head;
+		struct cil_tree_node *node = cil_vector_get(&cil_class->datum.nodes, 0);
+		struct cil_tree_node *cil_perm = cil_tree_node_head(node);
 		common_datum_t *sepol_common = NULL;
 		class_datum_t *sepol_class = cil_malloc(sizeof(*sepol_class));
 		memset(sepol_class, 0, sizeof(class_datum_t));
@@ -389,7 +390,7 @@ int cil_classorder_to_policydb(policydb_t *pdb, const struct cil_db *db)
 			}
 			sepol_perm->s.value = sepol_class->permissions.nprim + 1;
 			sepol_class->permissions.nprim++;
-			cil_perm = cil_perm->next;
+			cil_perm = cil_tree_node_next(cil_perm);
 		}
 	}
 
@@ -1139,7 +1140,7 @@ int cil_type_rule_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 	return  __cil_type_rule_to_avtab(pdb, db, cil_rule, NULL, CIL_FALSE);
 }
 
-int __cil_typetransition_to_avtab(policydb_t *pdb, const struct cil_db *db, struct cil_nametypetransition *typetrans, cond_node_t *cond_node, enum cil_flavor cond_flavor, hashtab_t filename_trans_table)
+int __cil_typetransition_to_avtab(policydb_t *pdb, const struct cil_db *db, struct cil_nametypetransition *typetrans, cond_node_t *cond_node, enum cil_flavor cond_flavor, struct cil_complex_symtab *filename_trans_table)
 {
 	int rc = SEPOL_ERR;
 	type_datum_t *sepol_src = NULL;
@@ -1153,6 +1154,9 @@ int __cil_typetransition_to_avtab(policydb_t *pdb, const struct cil_db *db, stru
 	unsigned int i, j;
 	struct cil_list_item *c;
 	char *name = DATUM(typetrans->name)->name;
+	struct cil_complex_symtab_key ckey;
+	struct cil_complex_symtab_datum datum;
+	struct cil_complex_symtab_datum *odatum = NULL;
 	uint32_t *otype = NULL;
 
 	if (name == CIL_KEY_STAR) {
@@ -1201,18 +1205,22 @@ int __cil_typetransition_to_avtab(policydb_t *pdb, const struct cil_db *db, stru
 				new->otype = sepol_result->s.value;
 				new->name = cil_strdup(name);
 
-				rc = hashtab_insert(filename_trans_table, (hashtab_key_t)new, &(new->otype));
-				if (rc != SEPOL_OK) {
-					if (rc == SEPOL_EEXIST) {
-						add = CIL_FALSE;
-						otype = hashtab_search(filename_trans_table, (hashtab_key_t)new);
-						if (new->otype != *otype) {
-							cil_log(CIL_ERR, "Conflicting name type transition rules\n");
-						} else {
-							rc = SEPOL_OK;
-						}
+				/* The interned name stands in for the copy */
+				ckey.key1 = new->stype;
+				ckey.key2 = new->ttype;
+				ckey.key3 = new->tclass;
+				ckey.key4 = (intptr_t)name;
+				datum.data = &new->otype;
+
+				rc = cil_complex_symtab_insert(filename_trans_table, &ckey, &datum);
+				if (rc == SEPOL_EEXIST) {
+					add = CIL_FALSE;
+					cil_complex_symtab_search(filename_trans_table, &ckey, &odatum);
+					otype = odatum->data;
+					if (new->otype != *otype) {
+						cil_log(CIL_ERR, "Conflicting name type transition rules\n");
 					} else {
-						cil_log(CIL_ERR, "Out of memory\n");
+						rc = SEPOL_OK;
 					}
 				}
 
@@ -1239,22 +1247,21 @@ exit:
 	return rc;
 }
 
-int cil_typetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_nametypetransition *typetrans, hashtab_t filename_trans_table)
+int cil_typetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_nametypetransition *typetrans, struct cil_complex_symtab *filename_trans_table)
 {
 	return  __cil_typetransition_to_avtab(pdb, db, typetrans, NULL, CIL_FALSE, filename_trans_table);
 }
 
-int __cil_perms_to_datum(struct cil_list *perms, class_datum_t *sepol_class, uint32_t *datum)
+int __cil_perms_to_datum(struct cil_vector *perms, class_datum_t *sepol_class, uint32_t *datum)
 {
 	int rc = SEPOL_ERR;
 	char *key = NULL;
-	struct cil_list_item *curr_perm;
 	struct cil_perm *cil_perm;
 	uint32_t data = 0;
+	uint32_t i;
 
-	cil_list_for_each(curr_perm, perms) {
+	cil_vector_for_each(cil_perm, i, perms) {
 		perm_datum_t *sepol_perm;
-		cil_perm = curr_perm->data;
 		key = cil_perm->datum.fqn;
 		sepol_perm = hashtab_search(sepol_class->permissions.table, key);
 		if (sepol_perm == NULL) {
@@ -1381,22 +1388,22 @@ static int __cil_is_type_match(enum cil_flavor f1, struct cil_symtab_datum *t1,
 static int __cil_check_neverallows(struct cil_list *neverallows, struct cil_symtab_datum *src, struct cil_symtab_datum *tgt, uint32_t class, uint32_t perms)
 {
 	struct cil_list_item *curr = NULL;
-	enum cil_flavor al_src_flavor = ((struct cil_tree_node*)src->nodes->head->data)->flavor;
-	enum cil_flavor al_tgt_flavor = ((struct cil_tree_node*)tgt->nodes->head->data)->flavor;
+	enum cil_flavor al_src_flavor = ((struct cil_tree_node*)cil_vector_get(&src->nodes, 0))->flavor;
+	enum cil_flavor al_tgt_flavor = ((struct cil_tree_node*)cil_vector_get(&tgt->nodes, 0))->flavor;
 	cil_list_for_each(curr, neverallows) {
 		struct cil_neverallow *neverallow = curr->data;
 		struct cil_tree_node *node = neverallow->node;
 		struct cil_list_item *curr_item = NULL;
 		cil_list_for_each(curr_item, neverallow->rules) {
 			struct cil_neverallow_rule *curr_rule = curr_item->data;
-			enum cil_flavor nv_src_flavor = ((struct cil_tree_node*)curr_rule->src->nodes->head->data)->flavor;
-			enum cil_flavor nv_tgt_flavor = ((struct cil_tree_node*)curr_rule->tgt->nodes->head->data)->flavor;
+			enum cil_flavor nv_src_flavor = ((struct cil_tree_node*)cil_vector_get(&curr_rule->src->nodes, 0))->flavor;
+			enum cil_flavor nv_tgt_flavor = ((struct cil_tree_node*)cil_vector_get(&curr_rule->tgt->nodes, 0))->flavor;
 			if ((curr_rule->perms & perms) && (class == curr_rule->class)) {
 				int src_match = __cil_is_type_match(al_src_flavor, src, nv_src_flavor, curr_rule->src);
 				if (src_match) {
 					int tgt_match = __cil_is_type_match(al_tgt_flavor, tgt, nv_tgt_flavor, curr_rule->tgt);
 					if (tgt_match) {
-						cil_log(CIL_ERR, "Neverallow found that matches avrule at line %d of %s\n", node->line, node->path);
+						cil_log(CIL_ERR, "Neverallow found that matches avrule at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 						return SEPOL_ERR;
 					}
 				}
@@ -1417,7 +1424,7 @@ int __cil_avrule_expand_helper(policydb_t *pdb, uint16_t kind, struct cil_symtab
 	rc = __cil_get_sepol_class_datum(pdb, DATUM(cp->class), &sepol_class);
 	if (rc != SEPOL_OK) goto exit;
 
-	rc = __cil_perms_to_datum(cp->perms, sepol_class, &data);
+	rc = __cil_perms_to_datum(&cp->datums, sepol_class, &data);
 	if (rc != SEPOL_OK) goto exit;
 
 	if (data == 0) {
@@ -1470,9 +1477,9 @@ int __cil_avrule_expand(policydb_t *pdb, uint16_t kind, struct cil_symtab_datum
 					goto exit;
 				}
 			} else { /* MAP */
-				struct cil_list_item *i = NULL;
-				cil_list_for_each(i, cp->perms) {
-					struct cil_perm *cmp = i->data;
+				struct cil_perm *cmp;
+				uint32_t i;
+				cil_vector_for_each(cmp, i, &cp->datums) {
 					rc = __cil_avrule_expand(pdb, kind, src, tgt, cmp->classperms, neverallows, cond_node, cond_flavor);
 					if (rc != SEPOL_OK) {
 						goto exit;
@@ -1565,7 +1572,7 @@ int __cil_cond_to_policydb_helper(struct cil_tree_node *node, __attribute__((unu
 	struct cil_type_rule *cil_type_rule;
 	struct cil_avrule *cil_avrule;
 	struct cil_nametypetransition *cil_typetrans;
-	hashtab_t filename_trans_table = args->filename_trans_table;
+	struct cil_complex_symtab *filename_trans_table = args->filename_trans_table;
 
 	flavor = node->flavor;
 	switch (flavor) {
@@ -1574,12 +1581,12 @@ int __cil_cond_to_policydb_helper(struct cil_tree_node *node, __attribute__((unu
 		if (DATUM(cil_typetrans->name)->fqn != CIL_KEY_STAR) {
 			cil_log(CIL_ERR, "typetransition with file name not allowed within a booleanif block.\n");
 			cil_log(CIL_ERR,"Invalid typetransition statement at line %d of %s\n", 
-			node->line, node->path);
+			cil_tree_node_line(node), cil_tree_node_path(node));
 			goto exit;
 		}
 		rc = __cil_typetransition_to_avtab(pdb, db, cil_typetrans, cond_node, cond_flavor, filename_trans_table);
 		if (rc != SEPOL_OK) {
-			cil_log(CIL_ERR, "Failed to insert type transition into avtab at line %d of %s\n", node->line, node->path);
+			cil_log(CIL_ERR, "Failed to insert type transition into avtab at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 			goto exit;
 		}
 		break;
@@ -1587,7 +1594,7 @@ int __cil_cond_to_policydb_helper(struct cil_tree_node *node, __attribute__((unu
 		cil_type_rule = node->data;
 		rc = __cil_type_rule_to_avtab(pdb, db, cil_type_rule, cond_node, cond_flavor);
 		if (rc != SEPOL_OK) {
-			cil_log(CIL_ERR, "Failed to insert typerule into avtab at line %d of %s\n", node->line, node->path);
+			cil_log(CIL_ERR, "Failed to insert typerule into avtab at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 			goto exit;
 		}
 		break;
@@ -1595,7 +1602,7 @@ int __cil_cond_to_policydb_helper(struct cil_tree_node *node, __attribute__((unu
 		cil_avrule = node->data;
 		rc = __cil_avrule_to_avtab(pdb, db, cil_avrule, args->neverallows, cond_node, cond_flavor);
 		if (rc != SEPOL_OK) {
-			cil_log(CIL_ERR, "Failed to insert avrule into avtab at line %d of %s\n", node->line, node->path);
+			cil_log(CIL_ERR, "Failed to insert avrule into avtab at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 			goto exit;
 		}
 		break;
@@ -1604,7 +1611,7 @@ int __cil_cond_to_policydb_helper(struct cil_tree_node *node, __attribute__((unu
 		break;
 	default:
 		cil_log(CIL_ERR, "Invalid statement within booleanif at line %d of %s\n", 
-			node->line, node->path);
+			cil_tree_node_line(node), cil_tree_node_path(node));
 		goto exit;
 	}
 
@@ -1762,12 +1769,12 @@ static int __cil_cond_expr_to_sepol_expr(policydb_t *pdb, struct cil_list *cil_e
 	return SEPOL_OK;
 }
 
-int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_tree_node *node, struct cil_list *neverallows, hashtab_t filename_trans_table)
+int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_tree_node *node, struct cil_list *neverallows, struct cil_complex_symtab *filename_trans_table)
 {
 	int rc = SEPOL_ERR;
 	struct cil_args_booleanif bool_args;
 	struct cil_booleanif *cil_boolif = (struct cil_booleanif*)node->data;
-	struct cil_tree_node *cb_node = node->cl_head;
+	struct cil_tree_node *cb_node = cil_tree_node_head(node);
 	struct cil_tree_node *true_node = NULL;
 	struct cil_tree_node *false_node = NULL;
 	struct cil_tree_node *tmp_node = NULL;
@@ -1781,13 +1788,13 @@ int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 	if (tmp_cond == NULL) {
 		rc = SEPOL_ERR;
 		cil_log(CIL_INFO, "Failed to create sepol conditional node at line %d of %s\n", 
-			node->line, node->path);
+			cil_tree_node_line(node), cil_tree_node_path(node));
 		goto exit;
 	}
 	
 	rc = __cil_cond_expr_to_sepol_expr(pdb, cil_boolif->datum_expr, &tmp_cond->expr);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failed to convert CIL conditional expression to sepol expression at line %d of %s\n", node->line, node->path);
+		cil_log(CIL_INFO, "Failed to convert CIL conditional expression to sepol expression at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 		goto exit;
 	}
 
@@ -1817,7 +1824,7 @@ int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 	cond_expr_destroy(tmp_cond->expr);
 	free(tmp_cond);
 
-	for (cb_node = node->cl_head; cb_node != NULL; cb_node = cb_node->next) {
+	for (cb_node = cil_tree_node_head(node); cb_node != NULL; cb_node = cil_tree_node_next(cb_node)) {
 		if (cb_node->flavor == CIL_CONDBLOCK) {
 			struct cil_condblock *cb = cb_node->data;
 			if (cb->flavor == CIL_CONDTRUE) {
@@ -1844,7 +1851,7 @@ int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 		bool_args.cond_flavor = CIL_CONDTRUE;
 		rc = cil_tree_walk(true_node, __cil_cond_to_policydb_helper, NULL, NULL, &bool_args);
 		if (rc != SEPOL_OK) {
-			cil_log(CIL_ERR, "Failure while walking true conditional block at line %d of %s\n", true_node->line, true_node->path);
+			cil_log(CIL_ERR, "Failure while walking true conditional block at line %d of %s\n", cil_tree_node_line(true_node), cil_tree_node_path(true_node));
 			goto exit;
 		}
 	}
@@ -1853,7 +1860,7 @@ int cil_booleanif_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 		bool_args.cond_flavor = CIL_CONDFALSE;
 		rc = cil_tree_walk(false_node, __cil_cond_to_policydb_helper, NULL, NULL, &bool_args);
 		if (rc != SEPOL_OK) {
-			cil_log(CIL_ERR, "Failure while walking false conditional block at line %d of %s\n", false_node->line, false_node->path);
+			cil_log(CIL_ERR, "Failure while walking false conditional block at line %d of %s\n", cil_tree_node_line(false_node), cil_tree_node_path(false_node));
 			goto exit;
 		}
 	}
@@ -1864,7 +1871,7 @@ exit:
 	return rc;
 }
 
-int cil_roletrans_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_roletransition *roletrans, hashtab_t role_trans_table)
+int cil_roletrans_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_roletransition *roletrans, struct cil_complex_symtab *role_trans_table)
 {
 	int rc = SEPOL_ERR;
 	role_datum_t *sepol_src = NULL;
@@ -1873,6 +1880,9 @@ int cil_roletrans_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 	struct cil_list *class_list;
 	role_datum_t *sepol_result = NULL;
 	role_trans_t *new = NULL;
+	struct cil_complex_symtab_key ckey;
+	struct cil_complex_symtab_datum datum;
+	struct cil_complex_symtab_datum *odatum = NULL;
 	uint32_t *new_role = NULL;
 	ebitmap_t role_bitmap, type_bitmap;
 	ebitmap_node_t *rnode, *tnode;
@@ -1914,19 +1924,21 @@ int cil_roletrans_to_policydb(policydb_t *pdb, const struct cil_db *db, struct c
 				new->tclass = sepol_obj->s.value;
 				new->new_role = sepol_result->s.value;
 
-				rc = SEPOL_OK;
-				rc = hashtab_insert(role_trans_table, (hashtab_key_t)new, &(new->new_role));
-				if (rc != SEPOL_OK) {
-					if (rc == SEPOL_EEXIST) {
-						add = CIL_FALSE;
-						new_role = hashtab_search(role_trans_table, (hashtab_key_t)new);
-						if (new->new_role != *new_role) {
-							cil_log(CIL_ERR, "Conflicting role transition rules\n");
-						} else {
-							rc = SEPOL_OK;
-						}
+				ckey.key1 = new->role;
+				ckey.key2 = new->type;
+				ckey.key3 = new->tclass;
+				ckey.key4 = 0;
+				datum.data = &new->new_role;
+
+				rc = cil_complex_symtab_insert(role_trans_table, &ckey, &datum);
+				if (rc == SEPOL_EEXIST) {
+					add = CIL_FALSE;
+					cil_complex_symtab_search(role_trans_table, &ckey, &odatum);
+					new_role = odatum->data;
+					if (new->new_role != *new_role) {
+						cil_log(CIL_ERR, "Conflicting role transition rules\n");
 					} else {
-						cil_log(CIL_ERR, "Out of memory\n");
+						rc = SEPOL_OK;
 					}
 				}
 
@@ -2288,7 +2300,7 @@ int __cil_constrain_expr_to_sepol_expr(policydb_t *pdb, const struct cil_db *db,
 	return SEPOL_OK;
 }
 
-int cil_constrain_to_policydb_helper(policydb_t *pdb, const struct cil_db *db, struct cil_symtab_datum *class, struct cil_list *perms, struct cil_list *expr)
+int cil_constrain_to_policydb_helper(policydb_t *pdb, const struct cil_db *db, struct cil_symtab_datum *class, struct cil_vector *perms, struct cil_list *expr)
 {
 	int rc = SEPOL_ERR;
 	constraint_node_t *sepol_constrain = NULL;
@@ -2331,14 +2343,14 @@ int cil_constrain_expand(policydb_t *pdb, const struct cil_db *db, struct cil_li
 		if (curr->flavor == CIL_CLASSPERMS) {
 			struct cil_classperms *cp = curr->data;
 			if (FLAVOR(cp->class) == CIL_CLASS) {
-				rc = cil_constrain_to_policydb_helper(pdb, db, DATUM(cp->class), cp->perms, expr);
+				rc = cil_constrain_to_policydb_helper(pdb, db, DATUM(cp->class), &cp->datums, expr);
 				if (rc != SEPOL_OK) {
 					goto exit;
 				}
 			} else { /* MAP */
-				struct cil_list_item *i = NULL;
-				cil_list_for_each(i, cp->perms) {
-					struct cil_perm *cmp = i->data;
+				struct cil_perm *cmp;
+				uint32_t i;
+				cil_vector_for_each(cmp, i, &cp->datums) {
 					rc = cil_constrain_expand(pdb, db, cmp->classperms, expr);
 					if (rc != SEPOL_OK) {
 						goto exit;
@@ -2416,23 +2428,25 @@ exit:
 int __cil_cats_to_mls_level(policydb_t *pdb, struct cil_cats *cats, mls_level_t *mls_level)
 {
 	int rc = SEPOL_ERR;
-	struct cil_list_item *i;
+	struct cil_symtab_datum *cat;
+	uint32_t i;
 	cat_datum_t *sepol_cat = NULL;
 
-	cil_list_for_each(i, cats->datum_expr) {
-		struct cil_tree_node *node = DATUM(i->data)->nodes->head->data;
+	cil_vector_for_each(cat, i, &cats->datums) {
+		struct cil_tree_node *node = cil_vector_get(&cat->nodes, 0);
 		if (node->flavor == CIL_CATSET) {
-			struct cil_list_item *j;
-			struct cil_catset *cs = i->data;
-			cil_list_for_each(j, cs->cats->datum_expr) {
-				rc = __cil_get_sepol_cat_datum(pdb, j->data, &sepol_cat);
+			struct cil_symtab_datum *c;
+			struct cil_catset *cs = (struct cil_catset *)cat;
+			uint32_t j;
+			cil_vector_for_each(c, j, &cs->cats->datums) {
+				rc = __cil_get_sepol_cat_datum(pdb, c, &sepol_cat);
 				if (rc != SEPOL_OK) goto exit;
 
 				rc = ebitmap_set_bit(&mls_level->cat, sepol_cat->s.value - 1, 1);
 				if (rc != SEPOL_OK) goto exit;
 			}
 		} else {
-			rc = __cil_get_sepol_cat_datum(pdb, i->data, &sepol_cat);
+			rc = __cil_get_sepol_cat_datum(pdb, cat, &sepol_cat);
 			if (rc != SEPOL_OK) goto exit;
 
 			rc = ebitmap_set_bit(&mls_level->cat, sepol_cat->s.value - 1, 1);
@@ -2632,7 +2646,7 @@ exit:
 	return rc;
 }
 
-int cil_rangetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_rangetransition *rangetrans, hashtab_t range_trans_table)
+int cil_rangetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, struct cil_rangetransition *rangetrans, struct cil_complex_symtab *range_trans_table)
 {
 	int rc = SEPOL_ERR;
 	type_datum_t *sepol_src = NULL;
@@ -2644,6 +2658,9 @@ int cil_rangetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, st
 	ebitmap_node_t *node1, *node2;
 	unsigned int i, j;
 	struct cil_list_item *c;
+	struct cil_complex_symtab_key ckey;
+	struct cil_complex_symtab_datum datum;
+	struct cil_complex_symtab_datum *odatum = NULL;
 	struct mls_range *o_range = NULL;
 
 	rc = __cil_expand_type(rangetrans->src, &src_bitmap);
@@ -2682,19 +2699,21 @@ int cil_rangetransition_to_policydb(policydb_t *pdb, const struct cil_db *db, st
 					goto exit;
 				}
 
-				rc = SEPOL_OK;
-				rc = hashtab_insert(range_trans_table, (hashtab_key_t)new, &(new->target_range));
-				if (rc != SEPOL_OK) {
-					if (rc == SEPOL_EEXIST) {
-						add = CIL_FALSE;
-						o_range = hashtab_search(range_trans_table, (hashtab_key_t)new);
-						if (!mls_range_eq(&new->target_range, o_range)) {
-							cil_log(CIL_ERR, "Conflicting Range transition rules\n");
-						} else {
-							rc = SEPOL_OK;
-						}
+				ckey.key1 = new->source_type;
+				ckey.key2 = new->target_type;
+				ckey.key3 = new->target_class;
+				ckey.key4 = 0;
+				datum.data = &new->target_range;
+
+				rc = cil_complex_symtab_insert(range_trans_table, &ckey, &datum);
+				if (rc == SEPOL_EEXIST) {
+					add = CIL_FALSE;
+					cil_complex_symtab_search(range_trans_table, &ckey, &odatum);
+					o_range = odatum->data;
+					if (!mls_range_eq(&new->target_range, o_range)) {
+						cil_log(CIL_ERR, "Conflicting Range transition rules\n");
 					} else {
-						cil_log(CIL_ERR, "Out of memory\n");
+						rc = SEPOL_OK;
 					}
 				}
 
@@ -3088,9 +3107,9 @@ int __cil_node_to_policydb(struct cil_tree_node *node, void *extra_args)
 	struct cil_args_binary *args = extra_args;
 	const struct cil_db *db;
 	policydb_t *pdb;
-	hashtab_t filename_trans_table;
-	hashtab_t range_trans_table;
-	hashtab_t role_trans_table;
+	struct cil_complex_symtab *filename_trans_table;
+	struct cil_complex_symtab *range_trans_table;
+	struct cil_complex_symtab *role_trans_table;
 	db = args->db;
 	pdb = args->pdb;
 	pass = args->pass;
@@ -3099,7 +3118,7 @@ int __cil_node_to_policydb(struct cil_tree_node *node, void *extra_args)
 	role_trans_table = args->role_trans_table;
 
 	if (node->flavor >= CIL_MIN_DECLARATIVE) {
-		if (node != DATUM(node->data)->nodes->head->data) {
+		if (node != cil_vector_get(&DATUM(node->data)->nodes, 0)) {
 			goto exit;
 		}
 	}
@@ -3258,39 +3277,38 @@ int __cil_node_to_policydb(struct cil_tree_node *node, void *extra_args)
 
 exit:
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR, "Binary policy creation failed at line %d of %s\n", node->line, node->path);
+		cil_log(CIL_ERR, "Binary policy creation failed at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	}
 	return rc;
 }
 
-int __cil_binary_create_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+/* Statements in a booleanif are added by cil_booleanif_to_policydb() */
+int __cil_binary_create_helper(struct cil_index_entry *entry, void *extra_args)
 {
-	int rc = SEPOL_ERR;
-
-	if (node->flavor == CIL_BLOCK) {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-			rc = SEPOL_OK;
-			goto exit;
-		}
-	} else if (node->flavor == CIL_MACRO) {
-		*finished = CIL_TREE_SKIP_HEAD;
-		rc = SEPOL_OK;
-		goto exit;
-	} else if (node->flavor == CIL_BOOLEANIF) {
-		*finished = CIL_TREE_SKIP_HEAD;
-	}
-
-	rc = __cil_node_to_policydb(node, extra_args);
-	if (rc != SEPOL_OK) {
-		goto exit;
+	if (entry->boolif != NULL) {
+		return SEPOL_OK;
 	}
 
-exit:
-	return rc;
+	return __cil_node_to_policydb(entry->node, extra_args);
 }
 
+static const enum cil_flavor __cil_binary_pass1_flavors[] = {
+	CIL_ROLE, CIL_TYPE, CIL_TYPEATTRIBUTE, CIL_POLICYCAP, CIL_USER, CIL_BOOL, CIL_CATALIAS,
+	CIL_SENS,
+};
+
+static const enum cil_flavor __cil_binary_pass2_flavors[] = {
+	CIL_TYPE, CIL_TYPEALIAS, CIL_TYPEPERMISSIVE, CIL_TYPEATTRIBUTE, CIL_SENSALIAS, CIL_ROLE,
+	CIL_USER, CIL_USERROLE, CIL_TYPE_RULE, CIL_AVRULE, CIL_ROLETRANSITION,
+	CIL_NAMETYPETRANSITION, CIL_CONSTRAIN, CIL_MLSCONSTRAIN, CIL_VALIDATETRANS,
+	CIL_MLSVALIDATETRANS, CIL_RANGETRANSITION, CIL_DEFAULTUSER, CIL_DEFAULTROLE,
+	CIL_DEFAULTTYPE, CIL_DEFAULTRANGE,
+};
+
+static const enum cil_flavor __cil_binary_pass3_flavors[] = {
+	CIL_BOOLEANIF, CIL_AVRULE, CIL_ROLEALLOW,
+};
+
 int __cil_contexts_to_policydb(policydb_t *pdb, const struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
@@ -3590,57 +3608,6 @@ exit:
 	return rc;
 }
 
-static unsigned int filename_trans_hash(hashtab_t h, hashtab_key_t key)
-{
-	filename_trans_t *k = (filename_trans_t *)key;
-	return ((k->tclass + (k->ttype << 2) +
-				(k->stype << 9)) & (h->size - 1));
-}
-
-static int filename_trans_compare(hashtab_t h
-             __attribute__ ((unused)), hashtab_key_t key1,
-			              hashtab_key_t key2)
-{
-	filename_trans_t *a = (filename_trans_t *)key1;
-	filename_trans_t *b = (filename_trans_t *)key2;
-
-	return a->stype != b->stype || a->ttype != b->ttype || a->tclass != b->tclass || strcmp(a->name, b->name);
-}
-
-static unsigned int range_trans_hash(hashtab_t h, hashtab_key_t key)
-{
-	range_trans_t *k = (range_trans_t *)key;
-	return ((k->target_class + (k->target_type << 2) +
-				(k->source_type << 5)) & (h->size - 1));
-}
-
-static int range_trans_compare(hashtab_t h
-             __attribute__ ((unused)), hashtab_key_t key1,
-			              hashtab_key_t key2)
-{
-	range_trans_t *a = (range_trans_t *)key1;
-	range_trans_t *b = (range_trans_t *)key2;
-
-	return a->source_type != b->source_type || a->target_type != b->target_type || a->target_class != b->target_class;
-}
-
-static unsigned int role_trans_hash(hashtab_t h, hashtab_key_t key)
-{
-	role_trans_t *k = (role_trans_t *)key;
-	return ((k->role + (k->type << 2) +
-				(k->tclass << 5)) & (h->size - 1));
-}
-
-static int role_trans_compare(hashtab_t h
-             __attribute__ ((unused)), hashtab_key_t key1,
-			              hashtab_key_t key2)
-{
-	role_trans_t *a = (role_trans_t *)key1;
-	role_trans_t *b = (role_trans_t *)key2;
-
-	return a->role != b->role || a->type != b->type || a->tclass != b->tclass;
-}
-
 int cil_binary_create(const struct cil_db *db, sepol_policydb_t *policydb)
 {
 	int rc = SEPOL_ERR;
@@ -3648,9 +3615,21 @@ int cil_binary_create(const struct cil_db *db, sepol_policydb_t *policydb)
 	struct cil_args_binary extra_args;
 	policydb_t *pdb = &policydb->p;
 	struct cil_list *neverallows = NULL;
-	hashtab_t filename_trans_table = NULL;
-	hashtab_t range_trans_table = NULL;
-	hashtab_t role_trans_table = NULL;
+	struct cil_complex_symtab filename_trans_table;
+	struct cil_complex_symtab range_trans_table;
+	struct cil_complex_symtab role_trans_table;
+	struct cil_index *index = NULL;
+	struct cil_index *local_index = NULL;
+	const enum cil_flavor *pass_flavors[] = {
+		__cil_binary_pass1_flavors,
+		__cil_binary_pass2_flavors,
+		__cil_binary_pass3_flavors,
+	};
+	uint32_t num_pass_flavors[] = {
+		sizeof(__cil_binary_pass1_flavors) / sizeof(enum cil_flavor),
+		sizeof(__cil_binary_pass2_flavors) / sizeof(enum cil_flavor),
+		sizeof(__cil_binary_pass3_flavors) / sizeof(enum cil_flavor),
+	};
 
 	if (db == NULL || policydb == NULL) {
 		if (db == NULL) {
@@ -3667,36 +3646,34 @@ int cil_binary_create(const struct cil_db *db, sepol_policydb_t *policydb)
 		return SEPOL_ERR;
 	}
 
-	filename_trans_table = hashtab_create(filename_trans_hash, filename_trans_compare, FILENAME_TRANS_TABLE_SIZE);
-	if (!filename_trans_table) {
-		cil_log(CIL_INFO, "Failure to create hashtab for filename_trans\n");
-		goto exit;
-	}
-
-	range_trans_table = hashtab_create(range_trans_hash, range_trans_compare, RANGE_TRANS_TABLE_SIZE);
-	if (!range_trans_table) {
-		cil_log(CIL_INFO, "Failure to create hashtab for range_trans\n");
-		goto exit;
-	}
-
-	role_trans_table = hashtab_create(role_trans_hash, role_trans_compare, ROLE_TRANS_TABLE_SIZE);
-	if (!role_trans_table) {
-		cil_log(CIL_INFO, "Failure to create hashtab for role_trans\n");
-		goto exit;
-	}
+	cil_complex_symtab_init(&filename_trans_table, FILENAME_TRANS_TABLE_SIZE);
+	cil_complex_symtab_init(&range_trans_table, RANGE_TRANS_TABLE_SIZE);
+	cil_complex_symtab_init(&role_trans_table, ROLE_TRANS_TABLE_SIZE);
 
 	cil_list_init(&neverallows, CIL_LIST_ITEM);
 
 	extra_args.db = db;
 	extra_args.pdb = pdb;
 	extra_args.neverallows = neverallows;
-	extra_args.filename_trans_table = filename_trans_table;
-	extra_args.range_trans_table = range_trans_table;
-	extra_args.role_trans_table = role_trans_table;
+	extra_args.filename_trans_table = &filename_trans_table;
+	extra_args.range_trans_table = &range_trans_table;
+	extra_args.role_trans_table = &role_trans_table;
+	/* The index is built by cil_post_process(). Each pass only visits the
+	 * flavors it handles. */
+	index = db->index;
+	if (index == NULL) {
+		cil_index_init(&local_index);
+		rc = cil_index_build(local_index, db->ast->root);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+		index = local_index;
+	}
+
 	for (i = 1; i <= 3; i++) {
 		extra_args.pass = i;
 
-		rc = cil_tree_walk(db->ast->root, __cil_binary_create_helper, NULL, NULL, &extra_args);
+		rc = cil_index_walk(index, pass_flavors[i - 1], num_pass_flavors[i - 1], __cil_binary_create_helper, &extra_args);
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_INFO, "Failure while walking cil database\n");
 			goto exit;
@@ -3736,9 +3713,10 @@ int cil_binary_create(const struct cil_db *db, sepol_policydb_t *policydb)
 	rc = SEPOL_OK;
 
 exit:
-	hashtab_destroy(filename_trans_table);
-	hashtab_destroy(range_trans_table);
-	hashtab_destroy(role_trans_table);
+	cil_complex_symtab_destroy(&filename_trans_table);
+	cil_complex_symtab_destroy(&range_trans_table);
+	cil_complex_symtab_destroy(&role_trans_table);
 	cil_neverallows_list_destroy(neverallows);
+	cil_index_destroy(&local_index);
 	return rc;
 }
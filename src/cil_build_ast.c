@@ -38,6 +38,7 @@
 #include "cil_flavor.h"
 #include "cil_log.h"
 #include "cil_mem.h"
+#include "cil_arena.h"
 #include "cil_tree.h"
 #include "cil_list.h"
 #include "cil_parser.h"
@@ -53,12 +54,13 @@ struct cil_args_build {
 	struct cil_tree_node *boolif;
 	struct cil_tree_node *tunif;
 	struct cil_tree_node *in;
+	struct cil_parse_token *parse_next;	/* where the walk resumes, if set */
 };
 
-int cil_fill_list(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list **list)
+int cil_fill_list(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list **list)
 {
 	int rc = SEPOL_ERR;
-	struct cil_tree_node *curr;
+	struct cil_parse_token *curr;
 	enum cil_syntax syntax[] = {
 		CIL_SYN_N_STRINGS,
 		CIL_SYN_END
@@ -72,7 +74,7 @@ int cil_fill_list(struct cil_tree_node *current, enum cil_flavor flavor, struct
 
 	cil_list_init(list, flavor);
 
-	for (curr = current; curr != NULL; curr = curr->next) {
+	for (curr = current; curr != NULL; curr = cil_parse_token_next(curr)) {
 		cil_list_append(*list, CIL_STRING, curr->data);
 	}
 
@@ -85,14 +87,14 @@ exit:
 int cil_gen_node(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *ast_node, struct cil_symtab_datum *datum, hashtab_key_t key, enum cil_sym_index sflavor, enum cil_flavor nflavor)
 {
 	int rc = SEPOL_ERR;
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 
 	rc = __cil_verify_name((const char*)key);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_get_symtab(ast_node->parent, &symtab, sflavor);
+	rc = cil_get_symtab(cil_tree_node_parent(ast_node), &symtab, sflavor);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -107,18 +109,18 @@ int cil_gen_node(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 				cil_node_to_string(ast_node), key);
 			if (cil_symtab_get_datum(symtab, key, &datum) == SEPOL_OK) {
 				if (sflavor == CIL_SYM_BLOCKS) {
-					struct cil_tree_node *node = datum->nodes->head->data;
+					struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 					cil_log(CIL_ERR, "Previous declaration at line %d of %s\n",
-						node->line, node->path);
+						cil_tree_node_line(node), cil_tree_node_path(node));
 				}
 			}
 			goto exit;
 		}
 	}
 
-	if (ast_node->flavor >= CIL_MIN_DECLARATIVE && ast_node->parent->flavor == CIL_MACRO) {
+	if (ast_node->flavor >= CIL_MIN_DECLARATIVE && cil_tree_node_parent(ast_node)->flavor == CIL_MACRO) {
 		struct cil_list_item *item;
-		struct cil_list *param_list = ((struct cil_macro*)ast_node->parent->data)->params;
+		struct cil_list *param_list = ((struct cil_macro*)cil_tree_node_parent(ast_node)->data)->params;
 		if (param_list != NULL) {
 			cil_list_for_each(item, param_list) {
 				struct cil_param *param = item->data;
@@ -150,7 +152,7 @@ void cil_clear_node(struct cil_tree_node *ast_node)
 	ast_node->flavor = CIL_NONE;
 }
 
-int cil_gen_block(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, uint16_t is_abstract)
+int cil_gen_block(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, uint16_t is_abstract)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -176,7 +178,7 @@ int cil_gen_block(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	block->is_abstract = is_abstract;
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)block, (hashtab_key_t)key, CIL_SYM_BLOCKS, CIL_BLOCK);
 	if (rc != SEPOL_OK) {
@@ -187,7 +189,7 @@ int cil_gen_block(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad block declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_block(block);
 	cil_clear_node(ast_node);
 	return rc;
@@ -203,10 +205,10 @@ void cil_destroy_block(struct cil_block *block)
 	cil_symtab_array_destroy(block->symtab);
 	cil_list_destroy(&block->bi_nodes, CIL_FALSE);
 
-	free(block);
+	cil_arena_release(block, sizeof(*block));
 }
 
-int cil_gen_blockinherit(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_blockinherit(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -228,7 +230,7 @@ int cil_gen_blockinherit(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 	cil_blockinherit_init(&inherit);
 
-	inherit->block_str = parse_current->next->data;
+	inherit->block_str = cil_parse_token_next(parse_current)->data;
 
 	ast_node->data = inherit;
 	ast_node->flavor = CIL_BLOCKINHERIT;
@@ -237,7 +239,7 @@ int cil_gen_blockinherit(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 exit:
 	cil_log(CIL_ERR, "Bad blockinherit declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_blockinherit(inherit);
 	return rc;
 }
@@ -248,10 +250,10 @@ void cil_destroy_blockinherit(struct cil_blockinherit *inherit)
 		return;
 	}
 
-	free(inherit);
+	cil_arena_release(inherit, sizeof(*inherit));
 }
 
-int cil_gen_blockabstract(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_blockabstract(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -273,7 +275,7 @@ int cil_gen_blockabstract(__attribute__((unused)) struct cil_db *db, struct cil_
 
 	cil_blockabstract_init(&abstract);
 
-	abstract->block_str = parse_current->next->data;
+	abstract->block_str = cil_parse_token_next(parse_current)->data;
 
 	ast_node->data = abstract;
 	ast_node->flavor = CIL_BLOCKABSTRACT;
@@ -282,7 +284,7 @@ int cil_gen_blockabstract(__attribute__((unused)) struct cil_db *db, struct cil_
 
 exit:
 	cil_log(CIL_ERR, "Bad blockabstract declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_blockabstract(abstract);
 	return rc;
 }
@@ -293,10 +295,10 @@ void cil_destroy_blockabstract(struct cil_blockabstract *abstract)
 		return;
 	}
 
-	free(abstract);
+	cil_arena_release(abstract, sizeof(*abstract));
 }
 
-int cil_gen_in(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_in(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -319,7 +321,7 @@ int cil_gen_in(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *
 
 	cil_in_init(&in);
 
-	in->block_str = parse_current->next->data;
+	in->block_str = cil_parse_token_next(parse_current)->data;
 
 	ast_node->data = in;
 	ast_node->flavor = CIL_IN;
@@ -327,7 +329,7 @@ int cil_gen_in(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *
 	return SEPOL_OK;
 exit:
 	cil_log(CIL_ERR, "Bad in statement at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_in(in);
 	return rc;
 }
@@ -340,10 +342,10 @@ void cil_destroy_in(struct cil_in *in)
 
 	cil_symtab_array_destroy(in->symtab);
 
-	free(in);
+	cil_arena_release(in, sizeof(*in));
 }
 
-int cil_gen_class(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_class(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -354,7 +356,7 @@ int cil_gen_class(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 	int syntax_len = sizeof(syntax)/sizeof(*syntax);
 	char *key = NULL;
 	struct cil_class *class = NULL;
-	struct cil_tree_node *perms = NULL;
+	struct cil_parse_token *perms = NULL;
 	int rc = SEPOL_ERR;
 
 	rc = __cil_verify_syntax(parse_current, syntax, syntax_len);
@@ -364,15 +366,15 @@ int cil_gen_class(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	cil_class_init(&class);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)class, (hashtab_key_t)key, CIL_SYM_CLASSES, CIL_CLASS);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	if (parse_current->next->next != NULL) {
-		perms = parse_current->next->next->cl_head;
+	if (cil_parse_token_next(cil_parse_token_next(parse_current)) != NULL) {
+		perms = cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current)));
 		rc = cil_gen_perm_nodes(db, perms, ast_node, CIL_PERM, &class->num_perms);
 		if (rc != SEPOL_OK) {
 			goto exit;
@@ -383,7 +385,7 @@ int cil_gen_class(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad class declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_class(class);
 	cil_clear_node(ast_node);
 	return rc;
@@ -398,10 +400,10 @@ void cil_destroy_class(struct cil_class *class)
 	cil_symtab_datum_destroy(&class->datum);
 	cil_symtab_destroy(&class->perms);
 
-	free(class);
+	cil_arena_release(class, sizeof(*class));
 }
 
-int cil_gen_classorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_classorder(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -423,7 +425,7 @@ int cil_gen_classorder(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 	cil_classorder_init(&classorder);
 
-	rc = cil_fill_list(parse_current->next->cl_head, CIL_CLASSORDER, &classorder->class_list_str);
+	rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_CLASSORDER, &classorder->class_list_str);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -434,7 +436,7 @@ int cil_gen_classorder(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 exit:
 	cil_log(CIL_ERR, "Bad classorder declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_classorder(classorder);
 	return rc;
 }
@@ -449,10 +451,10 @@ void cil_destroy_classorder(struct cil_classorder *classorder)
 		cil_list_destroy(&classorder->class_list_str, 1);
 	}
 
-	free(classorder);
+	cil_arena_release(classorder, sizeof(*classorder));
 }
 
-int cil_gen_perm(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor, unsigned int *num_perms)
+int cil_gen_perm(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor, unsigned int *num_perms)
 {
 	char *key = NULL;
 	struct cil_perm *perm = NULL;
@@ -487,38 +489,37 @@ void cil_destroy_perm(struct cil_perm *perm)
 	cil_symtab_datum_destroy(&perm->datum);
 	cil_list_destroy(&perm->classperms, CIL_FALSE);
 
-	free(perm);
+	cil_arena_release(perm, sizeof(*perm));
 }
 
-int cil_gen_perm_nodes(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *current_perm, struct cil_tree_node *ast_node, enum cil_flavor flavor, unsigned int *num_perms)
+int cil_gen_perm_nodes(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *current_perm, struct cil_tree_node *ast_node, enum cil_flavor flavor, unsigned int *num_perms)
 {
 	int rc = SEPOL_ERR;
 	struct cil_tree_node *new_ast = NULL;
 
 	while(current_perm != NULL) {
-		if (current_perm->cl_head != NULL) {
+		if (cil_parse_token_child(current_perm) != NULL) {
 		
 			rc = SEPOL_ERR;
 			goto exit;
 		}
 		cil_tree_node_init(&new_ast);
-		new_ast->parent = ast_node;
-		new_ast->line = current_perm->line;
-		new_ast->path = current_perm->path;
+		cil_tree_node_set_parent(new_ast, ast_node);
+		new_ast->loc = current_perm->loc;
 
 		rc = cil_gen_perm(db, current_perm, new_ast, flavor, num_perms);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 
-		if (ast_node->cl_head == NULL) {
-			ast_node->cl_head = new_ast;
+		if (cil_tree_node_head(ast_node) == NULL) {
+			cil_tree_node_set_head(ast_node, new_ast);
 		} else {
-			ast_node->cl_tail->next = new_ast;
+			cil_tree_node_set_next(cil_tree_node_tail(ast_node), new_ast);
 		}
-		ast_node->cl_tail = new_ast;
+		cil_tree_node_set_tail(ast_node, new_ast);
 
-		current_perm = current_perm->next;
+		current_perm = cil_parse_token_next(current_perm);
 	}
 
 	return SEPOL_OK;
@@ -528,7 +529,7 @@ exit:
 	return rc;
 }
 
-int cil_fill_perms(struct cil_tree_node *start_perm, struct cil_list **perms)
+int cil_fill_perms(struct cil_parse_token *start_perm, struct cil_list **perms)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -537,7 +538,7 @@ int cil_fill_perms(struct cil_tree_node *start_perm, struct cil_list **perms)
 	};
 	int syntax_len = sizeof(syntax)/sizeof(*syntax);
 
-	rc = __cil_verify_syntax(start_perm->cl_head, syntax, syntax_len);
+	rc = __cil_verify_syntax(cil_parse_token_child(start_perm), syntax, syntax_len);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -554,7 +555,7 @@ exit:
 	return rc;
 }
 
-int cil_fill_classperms(struct cil_tree_node *parse_current, struct cil_classperms **cp)
+int cil_fill_classperms(struct cil_parse_token *parse_current, struct cil_classperms **cp)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -573,7 +574,7 @@ int cil_fill_classperms(struct cil_tree_node *parse_current, struct cil_classper
 
 	(*cp)->class_str = parse_current->data;
 
-	rc = cil_fill_perms(parse_current->next, &(*cp)->perm_strs);
+	rc = cil_fill_perms(cil_parse_token_next(parse_current), &(*cp)->perm_strs);
 	if (rc != SEPOL_OK) {
 		cil_destroy_classperms(*cp);
 		goto exit;
@@ -595,11 +596,12 @@ void cil_destroy_classperms(struct cil_classperms *cp)
 
 	cil_list_destroy(&cp->perm_strs, CIL_TRUE);
 	cil_list_destroy(&cp->perms, CIL_FALSE);
+	cil_vector_destroy(&cp->datums);
 
-	free(cp);
+	cil_arena_release(cp, sizeof(*cp));
 }
 
-void cil_fill_classperms_set(struct cil_tree_node *parse_current, struct cil_classperms_set **cp_set)
+void cil_fill_classperms_set(struct cil_parse_token *parse_current, struct cil_classperms_set **cp_set)
 {
 	cil_classperms_set_init(cp_set);
 	(*cp_set)->set_str = parse_current->data;
@@ -611,13 +613,13 @@ void cil_destroy_classperms_set(struct cil_classperms_set *cp_set)
 		return;
 	}
 
-	free(cp_set);
+	cil_arena_release(cp_set, sizeof(*cp_set));
 }
 
-int cil_fill_classperms_list(struct cil_tree_node *parse_current, struct cil_list **cp_list)
+int cil_fill_classperms_list(struct cil_parse_token *parse_current, struct cil_list **cp_list)
 {
 	int rc = SEPOL_ERR;
-	struct cil_tree_node *curr;
+	struct cil_parse_token *curr;
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING | CIL_SYN_LIST,
 	};
@@ -634,14 +636,14 @@ int cil_fill_classperms_list(struct cil_tree_node *parse_current, struct cil_lis
 
 	cil_list_init(cp_list, CIL_CLASSPERMS);
 
-	curr = parse_current->cl_head;
+	curr = cil_parse_token_child(parse_current);
 
 	if (curr == NULL) {
 		/* Class-perms form: SET1 */
 		struct cil_classperms_set *new_cp_set;
 		cil_fill_classperms_set(parse_current, &new_cp_set);
 		cil_list_append(*cp_list, CIL_CLASSPERMS_SET, new_cp_set);
-	} else if (curr->cl_head == NULL) {
+	} else if (cil_parse_token_child(curr) == NULL) {
 		/* Class-perms form: (CLASS1 (PERM1 ...)) */
 		struct cil_classperms *new_cp;
 		rc = cil_fill_classperms(curr, &new_cp);
@@ -682,7 +684,7 @@ void cil_destroy_classperms_list(struct cil_list **cp_list)
 	cil_list_destroy(cp_list, CIL_FALSE);
 }
 
-int cil_gen_classpermission(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_classpermission(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	char *key = NULL;
@@ -705,7 +707,7 @@ int cil_gen_classpermission(__attribute__((unused)) struct cil_db *db, struct ci
 
 	cil_classpermission_init(&cp);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)cp, (hashtab_key_t)key, CIL_SYM_CLASSPERMSETS, CIL_CLASSPERMISSION);
 	if (rc != SEPOL_OK) {
@@ -716,7 +718,7 @@ int cil_gen_classpermission(__attribute__((unused)) struct cil_db *db, struct ci
 
 exit:
 	cil_log(CIL_ERR, "Bad classpermission declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_classpermission(cp);
 	cil_clear_node(ast_node);
 	return rc;
@@ -738,10 +740,10 @@ void cil_destroy_classpermission(struct cil_classpermission *cp)
 	cil_symtab_datum_destroy(&cp->datum);
 
 
-	free(cp);
+	cil_arena_release(cp, sizeof(*cp));
 }
 
-int cil_gen_classpermissionset(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_classpermissionset(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	struct cil_classpermissionset *cps = NULL;
@@ -764,9 +766,9 @@ int cil_gen_classpermissionset(__attribute__((unused)) struct cil_db *db, struct
 
 	cil_classpermissionset_init(&cps);
 
-	cps->set_str = parse_current->next->data;
+	cps->set_str = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_fill_classperms_list(parse_current->next->next, &cps->classperms);
+	rc = cil_fill_classperms_list(cil_parse_token_next(cil_parse_token_next(parse_current)), &cps->classperms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -778,7 +780,7 @@ int cil_gen_classpermissionset(__attribute__((unused)) struct cil_db *db, struct
 
 exit:
 	cil_log(CIL_ERR, "Bad classpermissionset at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_classpermissionset(cps);
 	return rc;
 }
@@ -791,10 +793,10 @@ void cil_destroy_classpermissionset(struct cil_classpermissionset *cps)
 
 	cil_destroy_classperms_list(&cps->classperms);
 
-	free(cps);
+	cil_arena_release(cps, sizeof(*cps));
 }
 
-int cil_gen_map_class(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_map_class(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -814,14 +816,14 @@ int cil_gen_map_class(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_class_init(&map);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)map, (hashtab_key_t)key, CIL_SYM_CLASSES, CIL_MAP_CLASS);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_gen_perm_nodes(db, parse_current->next->next->cl_head, ast_node, CIL_MAP_PERM, &map->num_perms);
+	rc = cil_gen_perm_nodes(db, cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), ast_node, CIL_MAP_PERM, &map->num_perms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -830,13 +832,13 @@ int cil_gen_map_class(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad map class declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_class(map);
 	cil_clear_node(ast_node);
 	return rc;
 }
 
-int cil_gen_classmapping(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_classmapping(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	struct cil_classmapping *mapping = NULL;
@@ -860,10 +862,10 @@ int cil_gen_classmapping(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 	cil_classmapping_init(&mapping);
 
-	mapping->map_class_str = parse_current->next->data;
-	mapping->map_perm_str = parse_current->next->next->data;
+	mapping->map_class_str = cil_parse_token_next(parse_current)->data;
+	mapping->map_perm_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
-	rc = cil_fill_classperms_list(parse_current->next->next->next, &mapping->classperms);
+	rc = cil_fill_classperms_list(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))), &mapping->classperms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -875,7 +877,7 @@ int cil_gen_classmapping(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 exit:
 	cil_log(CIL_ERR, "Bad classmapping declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_classmapping(mapping);
 	return rc;
 }
@@ -888,11 +890,11 @@ void cil_destroy_classmapping(struct cil_classmapping *mapping)
 
 	cil_destroy_classperms_list(&mapping->classperms);
 
-	free(mapping);
+	cil_arena_release(mapping, sizeof(*mapping));
 }
 
 // TODO try to merge some of this with cil_gen_class (helper function for both)
-int cil_gen_common(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_common(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -916,14 +918,14 @@ int cil_gen_common(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 	cil_class_init(&common);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)common, (hashtab_key_t)key, CIL_SYM_COMMONS, CIL_COMMON);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_gen_perm_nodes(db, parse_current->next->next->cl_head, ast_node, CIL_PERM, &common->num_perms);
+	rc = cil_gen_perm_nodes(db, cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), ast_node, CIL_PERM, &common->num_perms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -932,14 +934,14 @@ int cil_gen_common(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 exit:
 	cil_log(CIL_ERR, "Bad common declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_class(common);
 	cil_clear_node(ast_node);
 	return rc;
 
 }
 
-int cil_gen_classcommon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_classcommon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -962,8 +964,8 @@ int cil_gen_classcommon(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 	cil_classcommon_init(&clscom);
 
-	clscom->class_str = parse_current->next->data;
-	clscom->common_str = parse_current->next->next->data;
+	clscom->class_str = cil_parse_token_next(parse_current)->data;
+	clscom->common_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = clscom;
 	ast_node->flavor = CIL_CLASSCOMMON;
@@ -972,7 +974,7 @@ int cil_gen_classcommon(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 exit:
 	cil_log(CIL_ERR, "Bad classcommon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_classcommon(clscom);
 	return rc;
 
@@ -984,10 +986,10 @@ void cil_destroy_classcommon(struct cil_classcommon *clscom)
 		return;
 	}
 
-	free(clscom);
+	cil_arena_release(clscom, sizeof(*clscom));
 }
 
-int cil_gen_sid(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_sid(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1010,7 +1012,7 @@ int cil_gen_sid(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_sid_init(&sid);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)sid, (hashtab_key_t)key, CIL_SYM_SIDS, CIL_SID);
 	if (rc != SEPOL_OK) {
@@ -1021,7 +1023,7 @@ int cil_gen_sid(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad sid declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_sid(sid);
 	cil_clear_node(ast_node);
 	return rc;
@@ -1034,10 +1036,10 @@ void cil_destroy_sid(struct cil_sid *sid)
 	}
 
 	cil_symtab_datum_destroy(&sid->datum);
-	free(sid);
+	cil_arena_release(sid, sizeof(*sid));
 }
 
-int cil_gen_sidcontext(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_sidcontext(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1060,14 +1062,14 @@ int cil_gen_sidcontext(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 	cil_sidcontext_init(&sidcon);
 
-	sidcon->sid_str = parse_current->next->data;
+	sidcon->sid_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->cl_head == NULL) {
-		sidcon->context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		sidcon->context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&sidcon->context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, sidcon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), sidcon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -1080,7 +1082,7 @@ int cil_gen_sidcontext(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 exit:
 	cil_log(CIL_ERR, "Bad sidcontext declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_sidcontext(sidcon);
 	return rc;
 }
@@ -1095,10 +1097,10 @@ void cil_destroy_sidcontext(struct cil_sidcontext *sidcon)
 		cil_destroy_context(sidcon->context);
 	}
 
-	free(sidcon);
+	cil_arena_release(sidcon, sizeof(*sidcon));
 }
 
-int cil_gen_sidorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_sidorder(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1120,7 +1122,7 @@ int cil_gen_sidorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_sidorder_init(&sidorder);
 
-	rc = cil_fill_list(parse_current->next->cl_head, CIL_SIDORDER, &sidorder->sid_list_str);
+	rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_SIDORDER, &sidorder->sid_list_str);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -1131,7 +1133,7 @@ int cil_gen_sidorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad sidorder declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_sidorder(sidorder);
 	return rc;
 }
@@ -1146,10 +1148,10 @@ void cil_destroy_sidorder(struct cil_sidorder *sidorder)
 		cil_list_destroy(&sidorder->sid_list_str, 1);
 	}
 
-	free(sidorder);
+	cil_arena_release(sidorder, sizeof(*sidorder));
 }
 
-int cil_gen_user(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_user(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1172,7 +1174,7 @@ int cil_gen_user(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_user_init(&user);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)user, (hashtab_key_t)key, CIL_SYM_USERS, CIL_USER);
 	if (rc != SEPOL_OK) {
@@ -1183,7 +1185,7 @@ int cil_gen_user(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad user declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_user(user);
 	cil_clear_node(ast_node);
 	return rc;
@@ -1197,10 +1199,10 @@ void cil_destroy_user(struct cil_user *user)
 
 	cil_symtab_datum_destroy(&user->datum);
 	cil_list_destroy(&user->roles, CIL_FALSE);
-	free(user);
+	cil_arena_release(user, sizeof(*user));
 }
 
-int cil_gen_userlevel(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_userlevel(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1223,14 +1225,14 @@ int cil_gen_userlevel(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_userlevel_init(&usrlvl);
 
-	usrlvl->user_str = parse_current->next->data;
+	usrlvl->user_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->cl_head == NULL) {
-		usrlvl->level_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		usrlvl->level_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_level_init(&usrlvl->level);
 
-		rc = cil_fill_level(parse_current->next->next->cl_head, usrlvl->level);
+		rc = cil_fill_level(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), usrlvl->level);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -1243,7 +1245,7 @@ int cil_gen_userlevel(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad userlevel declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_userlevel(usrlvl);
 	return rc;
 }
@@ -1258,10 +1260,10 @@ void cil_destroy_userlevel(struct cil_userlevel *usrlvl)
 		cil_destroy_level(usrlvl->level);
 	}
 
-	free(usrlvl);
+	cil_arena_release(usrlvl, sizeof(*usrlvl));
 }
 
-int cil_gen_userrange(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_userrange(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1284,14 +1286,14 @@ int cil_gen_userrange(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_userrange_init(&userrange);
 
-	userrange->user_str = parse_current->next->data;
+	userrange->user_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->cl_head == NULL) {
-		userrange->range_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		userrange->range_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_levelrange_init(&userrange->range);
 
-		rc = cil_fill_levelrange(parse_current->next->next->cl_head, userrange->range);
+		rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), userrange->range);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -1304,7 +1306,7 @@ int cil_gen_userrange(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad userrange declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_userrange(userrange);
 	return rc;
 }
@@ -1319,10 +1321,10 @@ void cil_destroy_userrange(struct cil_userrange *userrange)
 		cil_destroy_levelrange(userrange->range);
 	}
 
-	free(userrange);
+	cil_arena_release(userrange, sizeof(*userrange));
 }
 
-int cil_gen_userprefix(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_userprefix(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1345,8 +1347,8 @@ int cil_gen_userprefix(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 	cil_userprefix_init(&userprefix);
 
-	userprefix->user_str = parse_current->next->data;
-	userprefix->prefix_str = parse_current->next->next->data;
+	userprefix->user_str = cil_parse_token_next(parse_current)->data;
+	userprefix->prefix_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = userprefix;
 	ast_node->flavor = CIL_USERPREFIX;
@@ -1354,7 +1356,7 @@ int cil_gen_userprefix(__attribute__((unused)) struct cil_db *db, struct cil_tre
 	return SEPOL_OK;
 exit:
 	cil_log(CIL_ERR, "Bad userprefix declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_userprefix(userprefix);
 	return rc;
 }
@@ -1365,10 +1367,10 @@ void cil_destroy_userprefix(struct cil_userprefix *userprefix)
 		return;
 	}
 
-	free(userprefix);
+	cil_arena_release(userprefix, sizeof(*userprefix));
 }
 
-int cil_gen_selinuxuser(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_selinuxuser(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1392,15 +1394,15 @@ int cil_gen_selinuxuser(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 	cil_selinuxuser_init(&selinuxuser);
 
-	selinuxuser->name_str = parse_current->next->data;
-	selinuxuser->user_str = parse_current->next->next->data;
+	selinuxuser->name_str = cil_parse_token_next(parse_current)->data;
+	selinuxuser->user_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
-	if (parse_current->next->next->next->cl_head == NULL) {
-		selinuxuser->range_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL) {
+		selinuxuser->range_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_levelrange_init(&selinuxuser->range);
 
-		rc = cil_fill_levelrange(parse_current->next->next->next->cl_head, selinuxuser->range);
+		rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), selinuxuser->range);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -1412,12 +1414,12 @@ int cil_gen_selinuxuser(__attribute__((unused)) struct cil_db *db, struct cil_tr
 	return SEPOL_OK;
 exit:
 	cil_log(CIL_ERR, "Bad selinuxuser declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_selinuxuser(selinuxuser);
 	return rc;
 }
 
-int cil_gen_selinuxuserdefault(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_selinuxuserdefault(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1441,14 +1443,14 @@ int cil_gen_selinuxuserdefault(__attribute__((unused)) struct cil_db *db, struct
 	cil_selinuxuser_init(&selinuxuser);
 
 	selinuxuser->name_str = cil_strpool_add("__default__");
-	selinuxuser->user_str = parse_current->next->data;
+	selinuxuser->user_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->cl_head == NULL) {
-		selinuxuser->range_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		selinuxuser->range_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_levelrange_init(&selinuxuser->range);
 
-		rc = cil_fill_levelrange(parse_current->next->next->cl_head, selinuxuser->range);
+		rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), selinuxuser->range);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -1460,7 +1462,7 @@ int cil_gen_selinuxuserdefault(__attribute__((unused)) struct cil_db *db, struct
 	return SEPOL_OK;
 exit:
 	cil_log(CIL_ERR, "Bad selinuxuserdefault declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_selinuxuser(selinuxuser);
 	return rc;
 }
@@ -1475,10 +1477,10 @@ void cil_destroy_selinuxuser(struct cil_selinuxuser *selinuxuser)
 		cil_destroy_levelrange(selinuxuser->range);
 	}
 
-	free(selinuxuser);
+	cil_arena_release(selinuxuser, sizeof(*selinuxuser));
 }
 
-int cil_gen_role(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_role(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1501,7 +1503,7 @@ int cil_gen_role(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_role_init(&role);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)role, (hashtab_key_t)key, CIL_SYM_ROLES, CIL_ROLE);
 	if (rc != SEPOL_OK) {
@@ -1512,7 +1514,7 @@ int cil_gen_role(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad role declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_role(role);
 	cil_clear_node(ast_node);
 	return rc;
@@ -1525,12 +1527,11 @@ void cil_destroy_role(struct cil_role *role)
 	}
 
 	cil_symtab_datum_destroy(&role->datum);
-	ebitmap_destroy(role->types);
-	free(role->types);
-	free(role);
+	cil_ebitmap_destroy(&role->types);
+	cil_arena_release(role, sizeof(*role));
 }
 
-int cil_gen_roletype(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_roletype(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1553,8 +1554,8 @@ int cil_gen_roletype(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_roletype_init(&roletype);
 
-	roletype->role_str = parse_current->next->data;
-	roletype->type_str = parse_current->next->next->data;
+	roletype->role_str = cil_parse_token_next(parse_current)->data;
+	roletype->type_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = roletype;
 	ast_node->flavor = CIL_ROLETYPE;
@@ -1563,7 +1564,7 @@ int cil_gen_roletype(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad roletype declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_roletype(roletype);
 	return rc;
 }
@@ -1574,10 +1575,10 @@ void cil_destroy_roletype(struct cil_roletype *roletype)
 		return;
 	}
 
-	free(roletype);
+	cil_arena_release(roletype, sizeof(*roletype));
 }
 
-int cil_gen_userrole(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_userrole(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1600,8 +1601,8 @@ int cil_gen_userrole(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_userrole_init(&userrole);
 
-	userrole->user_str = parse_current->next->data;
-	userrole->role_str = parse_current->next->next->data;
+	userrole->user_str = cil_parse_token_next(parse_current)->data;
+	userrole->role_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = userrole;
 	ast_node->flavor = CIL_USERROLE;
@@ -1610,7 +1611,7 @@ int cil_gen_userrole(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad userrole declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_userrole(userrole);
 	return rc;
 }
@@ -1621,10 +1622,10 @@ void cil_destroy_userrole(struct cil_userrole *userrole)
 		return;
 	}
 
-	free(userrole);
+	cil_arena_release(userrole, sizeof(*userrole));
 }
 
-int cil_gen_roletransition(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_roletransition(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1649,10 +1650,10 @@ int cil_gen_roletransition(struct cil_tree_node *parse_current, struct cil_tree_
 
 	cil_roletransition_init(&roletrans);
 
-	roletrans->src_str = parse_current->next->data;
-	roletrans->tgt_str = parse_current->next->next->data;
-	roletrans->obj_str = parse_current->next->next->next->data;
-	roletrans->result_str = parse_current->next->next->next->next->data;
+	roletrans->src_str = cil_parse_token_next(parse_current)->data;
+	roletrans->tgt_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
+	roletrans->obj_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
+	roletrans->result_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))->data;
 
 	ast_node->data = roletrans;
 	ast_node->flavor = CIL_ROLETRANSITION;
@@ -1661,7 +1662,7 @@ int cil_gen_roletransition(struct cil_tree_node *parse_current, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad roletransition rule at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_roletransition(roletrans);
 	return rc;
 }
@@ -1672,10 +1673,10 @@ void cil_destroy_roletransition(struct cil_roletransition *roletrans)
 		return;
 	}
 
-	free(roletrans);
+	cil_arena_release(roletrans, sizeof(*roletrans));
 }
 
-int cil_gen_roleallow(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_roleallow(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1698,8 +1699,8 @@ int cil_gen_roleallow(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_roleallow_init(&roleallow);
 
-	roleallow->src_str = parse_current->next->data;
-	roleallow->tgt_str = parse_current->next->next->data;
+	roleallow->src_str = cil_parse_token_next(parse_current)->data;
+	roleallow->tgt_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = roleallow;
 	ast_node->flavor = CIL_ROLEALLOW;
@@ -1708,7 +1709,7 @@ int cil_gen_roleallow(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad roleallow rule at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_roleallow(roleallow);
 	return rc;
 }
@@ -1719,10 +1720,10 @@ void cil_destroy_roleallow(struct cil_roleallow *roleallow)
 		return;
 	}
 
-	free(roleallow);
+	cil_arena_release(roleallow, sizeof(*roleallow));
 }
 
-int cil_gen_roleattribute(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_roleattribute(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1743,7 +1744,7 @@ int cil_gen_roleattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 		goto exit;
 	}
 
-	if (parse_current->next->data == CIL_KEY_SELF) {
+	if (cil_parse_token_next(parse_current)->data == CIL_KEY_SELF) {
 		cil_log(CIL_ERR, "The keyword '%s' is reserved\n", CIL_KEY_SELF);
 		rc = SEPOL_ERR;
 		goto exit;
@@ -1751,7 +1752,7 @@ int cil_gen_roleattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 
 	cil_roleattribute_init(&attr);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)attr, (hashtab_key_t)key, CIL_SYM_ROLES, CIL_ROLEATTRIBUTE);
 	if (rc != SEPOL_OK) {
 		goto exit;
@@ -1760,7 +1761,7 @@ int cil_gen_roleattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 	return SEPOL_OK;
 exit:
 	cil_log(CIL_ERR, "Bad roleattribute declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_roleattribute(attr);
 	cil_clear_node(ast_node);
 	return rc;
@@ -1782,17 +1783,16 @@ void cil_destroy_roleattribute(struct cil_roleattribute *attr)
 			cil_list_item_destroy(&expr, CIL_FALSE);
 			expr = next;
 		}
-		free(attr->expr_list);
+		cil_arena_release(attr->expr_list, sizeof(*attr->expr_list));
 		attr->expr_list = NULL;
 	}
 
 	cil_symtab_datum_destroy(&attr->datum);
-	ebitmap_destroy(attr->roles);
-	free(attr->roles);
-	free(attr);
+	cil_ebitmap_destroy(&attr->roles);
+	cil_arena_release(attr, sizeof(*attr));
 }
 
-int cil_gen_roleattributeset(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_roleattributeset(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1815,9 +1815,9 @@ int cil_gen_roleattributeset(__attribute__((unused)) struct cil_db *db, struct c
 
 	cil_roleattributeset_init(&attrset);
 
-	attrset->attr_str = parse_current->next->data;
+	attrset->attr_str = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_gen_expr(parse_current->next->next, CIL_ROLE, &attrset->str_expr);
+	rc = cil_gen_expr(cil_parse_token_next(cil_parse_token_next(parse_current)), CIL_ROLE, &attrset->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -1828,7 +1828,7 @@ int cil_gen_roleattributeset(__attribute__((unused)) struct cil_db *db, struct c
 
 exit:
 	cil_log(CIL_ERR, "Bad roleattributeset declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_roleattributeset(attrset);
 
 	return rc;
@@ -1843,10 +1843,10 @@ void cil_destroy_roleattributeset(struct cil_roleattributeset *attrset)
 	cil_list_destroy(&attrset->str_expr, CIL_TRUE);
 	cil_list_destroy(&attrset->datum_expr, CIL_FALSE);
 
-	free(attrset);
+	cil_arena_release(attrset, sizeof(*attrset));
 }
 
-int cil_gen_avrule(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, uint32_t rule_kind)
+int cil_gen_avrule(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, uint32_t rule_kind)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1872,10 +1872,10 @@ int cil_gen_avrule(struct cil_tree_node *parse_current, struct cil_tree_node *as
 
 	rule->rule_kind = rule_kind;
 
-	rule->src_str = parse_current->next->data;
-	rule->tgt_str = parse_current->next->next->data;
+	rule->src_str = cil_parse_token_next(parse_current)->data;
+	rule->tgt_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
-	rc = cil_fill_classperms_list(parse_current->next->next->next, &rule->classperms);
+	rc = cil_fill_classperms_list(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))), &rule->classperms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -1887,7 +1887,7 @@ int cil_gen_avrule(struct cil_tree_node *parse_current, struct cil_tree_node *as
 
 exit:
 	cil_log(CIL_ERR, "Bad allow rule at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_avrule(rule);
 	return rc;
 }
@@ -1900,10 +1900,10 @@ void cil_destroy_avrule(struct cil_avrule *rule)
 
 	cil_destroy_classperms_list(&rule->classperms);
 
-	free(rule);
+	cil_arena_release(rule, sizeof(*rule));
 }
 
-int cil_gen_type_rule(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, uint32_t rule_kind)
+int cil_gen_type_rule(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, uint32_t rule_kind)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1929,10 +1929,10 @@ int cil_gen_type_rule(struct cil_tree_node *parse_current, struct cil_tree_node
 	cil_type_rule_init(&rule);
 
 	rule->rule_kind = rule_kind;
-	rule->src_str = parse_current->next->data;
-	rule->tgt_str = parse_current->next->next->data;
-	rule->obj_str = parse_current->next->next->next->data;
-	rule->result_str = parse_current->next->next->next->next->data;
+	rule->src_str = cil_parse_token_next(parse_current)->data;
+	rule->tgt_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
+	rule->obj_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
+	rule->result_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))->data;
 
 	ast_node->data = rule;
 	ast_node->flavor = CIL_TYPE_RULE;
@@ -1941,7 +1941,7 @@ int cil_gen_type_rule(struct cil_tree_node *parse_current, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad type rule at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_type_rule(rule);
 	return rc;
 }
@@ -1952,10 +1952,10 @@ void cil_destroy_type_rule(struct cil_type_rule *rule)
 		return;
 	}
 
-	free(rule);
+	cil_arena_release(rule, sizeof(*rule));
 }
 
-int cil_gen_type(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_type(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -1976,7 +1976,7 @@ int cil_gen_type(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 		goto exit;
 	}
 
-	if (parse_current->next->data == CIL_KEY_SELF) {
+	if (cil_parse_token_next(parse_current)->data == CIL_KEY_SELF) {
 		cil_log(CIL_ERR, "The keyword '%s' is reserved\n", CIL_KEY_SELF);
 		rc = SEPOL_ERR;
 		goto exit;
@@ -1984,7 +1984,7 @@ int cil_gen_type(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_type_init(&type);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)type, (hashtab_key_t)key, CIL_SYM_TYPES, CIL_TYPE);
 	if (rc != SEPOL_OK) {
 		goto exit;
@@ -1994,7 +1994,7 @@ int cil_gen_type(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad type declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_type(type);
 	cil_clear_node(ast_node);
 	return rc;
@@ -2007,10 +2007,10 @@ void cil_destroy_type(struct cil_type *type)
 	}
 
 	cil_symtab_datum_destroy(&type->datum);
-	free(type);
+	cil_arena_release(type, sizeof(*type));
 }
 
-int cil_gen_typeattribute(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_typeattribute(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2031,7 +2031,7 @@ int cil_gen_typeattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 		goto exit;
 	}
 
-	if (parse_current->next->data == CIL_KEY_SELF) {
+	if (cil_parse_token_next(parse_current)->data == CIL_KEY_SELF) {
 		cil_log(CIL_ERR, "The keyword '%s' is reserved\n", CIL_KEY_SELF);
 		rc = SEPOL_ERR;
 		goto exit;
@@ -2039,7 +2039,7 @@ int cil_gen_typeattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 
 	cil_typeattribute_init(&attr);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)attr, (hashtab_key_t)key, CIL_SYM_TYPES, CIL_TYPEATTRIBUTE);
 	if (rc != SEPOL_OK) {
 		goto exit;
@@ -2049,7 +2049,7 @@ int cil_gen_typeattribute(__attribute__((unused)) struct cil_db *db, struct cil_
 
 exit:
 	cil_log(CIL_ERR, "Bad typeattribute declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_typeattribute(attr);
 	cil_clear_node(ast_node);
 	return rc;
@@ -2073,15 +2073,14 @@ void cil_destroy_typeattribute(struct cil_typeattribute *attr)
 			cil_list_item_destroy(&expr, CIL_FALSE);
 			expr = next;
 		}
-		free(attr->expr_list);
+		cil_arena_release(attr->expr_list, sizeof(*attr->expr_list));
 		attr->expr_list = NULL;
 	}
-	ebitmap_destroy(attr->types);
-	free(attr->types);
-	free(attr);
+	cil_ebitmap_destroy(&attr->types);
+	cil_arena_release(attr, sizeof(*attr));
 }
 
-int cil_gen_bool(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, int tunableif)
+int cil_gen_bool(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, int tunableif)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2105,11 +2104,11 @@ int cil_gen_bool(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_bool_init(&boolean);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->data == CIL_KEY_CONDTRUE) {
+	if (cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_CONDTRUE) {
 		boolean->value = CIL_TRUE;
-	} else if (parse_current->next->next->data == CIL_KEY_CONDFALSE) {
+	} else if (cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_CONDFALSE) {
 		boolean->value = CIL_FALSE;
 	} else {
 		cil_log(CIL_ERR, "Value must be either \'true\' or \'false\'");
@@ -2127,10 +2126,10 @@ int cil_gen_bool(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 exit:
 	if (tunableif) {
 		cil_log(CIL_ERR, "Bad tunable (treated as a boolean due to preserve-tunables) declaration at line %d of %s\n",
-			parse_current->line, parse_current->path);
+			cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	} else {
 		cil_log(CIL_ERR, "Bad boolean declaration at line %d of %s\n",
-			parse_current->line, parse_current->path);
+			cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	}
 	cil_destroy_bool(boolean);
 	cil_clear_node(ast_node);
@@ -2144,10 +2143,10 @@ void cil_destroy_bool(struct cil_bool *boolean)
 	}
 
 	cil_symtab_datum_destroy(&boolean->datum);
-	free(boolean);
+	cil_arena_release(boolean, sizeof(*boolean));
 }
 
-int cil_gen_tunable(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_tunable(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2171,11 +2170,11 @@ int cil_gen_tunable(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_tunable_init(&tunable);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->data == CIL_KEY_CONDTRUE) {
+	if (cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_CONDTRUE) {
 		tunable->value = CIL_TRUE;
-	} else if (parse_current->next->next->data == CIL_KEY_CONDFALSE) {
+	} else if (cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_CONDFALSE) {
 		tunable->value = CIL_FALSE;
 	} else {
 		cil_log(CIL_ERR, "Value must be either \'true\' or \'false\'");
@@ -2192,7 +2191,7 @@ int cil_gen_tunable(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad tunable declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_tunable(tunable);
 	cil_clear_node(ast_node);
 	return rc;
@@ -2205,7 +2204,7 @@ void cil_destroy_tunable(struct cil_tunable *tunable)
 	}
 
 	cil_symtab_datum_destroy(&tunable->datum);
-	free(tunable);
+	cil_arena_release(tunable, sizeof(*tunable));
 }
 
 static enum cil_flavor __cil_get_expr_operator_flavor(const char *op)
@@ -2222,9 +2221,9 @@ static enum cil_flavor __cil_get_expr_operator_flavor(const char *op)
 	else return CIL_NONE;
 }
 
-static int __cil_fill_expr(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list *expr, int *depth);
+static int __cil_fill_expr(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list *expr, int *depth);
 
-static int __cil_fill_expr_helper(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list *expr, int *depth)
+static int __cil_fill_expr_helper(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list *expr, int *depth)
 {
 	int rc = SEPOL_ERR;
 	enum cil_flavor op;
@@ -2243,14 +2242,14 @@ static int __cil_fill_expr_helper(struct cil_tree_node *current, enum cil_flavor
 
 	if (op != CIL_NONE) {
 		cil_list_append(expr, CIL_OP, (void *)op);
-		current = current->next;
+		current = cil_parse_token_next(current);
 	}
 
 	if (op == CIL_NONE || op == CIL_ALL) {
 		(*depth)++;
 	}
 
-	for (;current != NULL; current = current->next) {
+	for (;current != NULL; current = cil_parse_token_next(current)) {
 		rc = __cil_fill_expr(current, flavor, expr, depth);
 		if (rc != SEPOL_OK) {
 			goto exit;
@@ -2265,11 +2264,11 @@ exit:
 	return rc;
 }
 
-static int __cil_fill_expr(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list *expr, int *depth)
+static int __cil_fill_expr(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list *expr, int *depth)
 {
 	int rc = SEPOL_ERR;
 
-	if (current->cl_head == NULL) {
+	if (cil_parse_token_child(current) == NULL) {
 		enum cil_flavor op = __cil_get_expr_operator_flavor(current->data);
 		if (op != CIL_NONE) {
 			cil_log(CIL_ERR, "Operator (%s) not in an expression\n", (char*)current->data);
@@ -2279,7 +2278,7 @@ static int __cil_fill_expr(struct cil_tree_node *current, enum cil_flavor flavor
 	} else {
 		struct cil_list *sub_expr;
 		cil_list_init(&sub_expr, flavor);
-		rc = __cil_fill_expr_helper(current->cl_head, flavor, sub_expr, depth);
+		rc = __cil_fill_expr_helper(cil_parse_token_child(current), flavor, sub_expr, depth);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -2293,17 +2292,17 @@ exit:
 }
 
 
-int cil_gen_expr(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list **expr)
+int cil_gen_expr(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list **expr)
 {
 	int rc = SEPOL_ERR;
 	int depth = 0;
 
 	cil_list_init(expr, flavor);
 
-	if (current->cl_head == NULL) {
+	if (cil_parse_token_child(current) == NULL) {
 		rc = __cil_fill_expr(current, flavor, *expr, &depth);
 	} else {
-		rc = __cil_fill_expr_helper(current->cl_head, flavor, *expr, &depth);
+		rc = __cil_fill_expr_helper(cil_parse_token_child(current), flavor, *expr, &depth);
 	}
 
 	if (rc != SEPOL_OK) {
@@ -2346,15 +2345,15 @@ static enum cil_flavor __cil_get_constraint_operand_flavor(const char *operand)
 	else return CIL_STRING;
 }
 
-static int __cil_fill_constraint_leaf_expr(struct cil_tree_node *current, enum cil_flavor expr_flavor, enum cil_flavor op, struct cil_list **leaf_expr)
+static int __cil_fill_constraint_leaf_expr(struct cil_parse_token *current, enum cil_flavor expr_flavor, enum cil_flavor op, struct cil_list **leaf_expr)
 {
 	int rc = SEPOL_ERR;
 	enum cil_flavor leaf_expr_flavor = CIL_NONE;
 	enum cil_flavor l_flavor = CIL_NONE;
 	enum cil_flavor r_flavor = CIL_NONE;
 
-	l_flavor = __cil_get_constraint_operand_flavor(current->next->data);
-	r_flavor = __cil_get_constraint_operand_flavor(current->next->next->data);
+	l_flavor = __cil_get_constraint_operand_flavor(cil_parse_token_next(current)->data);
+	r_flavor = __cil_get_constraint_operand_flavor(cil_parse_token_next(cil_parse_token_next(current))->data);
 
 	switch (l_flavor) {
 	case CIL_CONS_U1:
@@ -2379,7 +2378,7 @@ static int __cil_fill_constraint_leaf_expr(struct cil_tree_node *current, enum c
 		leaf_expr_flavor = CIL_LEVEL;
 		break;
 	default:
-		cil_log(CIL_ERR, "Invalid left operand (%s)\n", (char*)current->next->data);
+		cil_log(CIL_ERR, "Invalid left operand (%s)\n", (char*)cil_parse_token_next(current)->data);
 		goto exit;
 	}
 
@@ -2395,10 +2394,10 @@ static int __cil_fill_constraint_leaf_expr(struct cil_tree_node *current, enum c
 	cil_list_append(*leaf_expr, CIL_CONS_OPERAND, (void *)l_flavor);
 
 	if (r_flavor == CIL_STRING) {
-		cil_list_append(*leaf_expr, CIL_STRING, current->next->next->data);
+		cil_list_append(*leaf_expr, CIL_STRING, cil_parse_token_next(cil_parse_token_next(current))->data);
 	} else if (r_flavor == CIL_LIST) {
 		struct cil_list *sub_list;
-		cil_fill_list(current->next->next->cl_head, leaf_expr_flavor, &sub_list);
+		cil_fill_list(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(current))), leaf_expr_flavor, &sub_list);
 		cil_list_append(*leaf_expr, CIL_LIST, &sub_list);
 	} else {
 		cil_list_append(*leaf_expr, CIL_CONS_OPERAND, (void *)r_flavor);
@@ -2411,14 +2410,14 @@ exit:
 	return SEPOL_ERR;
 }
 
-static int __cil_fill_constraint_expr(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list **expr, int *depth)
+static int __cil_fill_constraint_expr(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list **expr, int *depth)
 {
 	int rc = SEPOL_ERR;
 	enum cil_flavor op;
 	struct cil_list *lexpr;
 	struct cil_list *rexpr;
 
-	if (current->data == NULL || current->cl_head != NULL) {
+	if (current->data == NULL || cil_parse_token_child(current) != NULL) {
 		cil_log(CIL_ERR, "Expected a string at the start of the constraint expression\n");
 		goto exit;
 	}
@@ -2449,7 +2448,7 @@ static int __cil_fill_constraint_expr(struct cil_tree_node *current, enum cil_fl
 		}
 		break;
 	case CIL_NOT:
-		rc = __cil_fill_constraint_expr(current->next->cl_head, flavor, &lexpr, depth);
+		rc = __cil_fill_constraint_expr(cil_parse_token_child(cil_parse_token_next(current)), flavor, &lexpr, depth);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -2458,11 +2457,11 @@ static int __cil_fill_constraint_expr(struct cil_tree_node *current, enum cil_fl
 		cil_list_append(*expr, CIL_LIST, lexpr);
 		break;
 	default:
-		rc = __cil_fill_constraint_expr(current->next->cl_head, flavor, &lexpr, depth);
+		rc = __cil_fill_constraint_expr(cil_parse_token_child(cil_parse_token_next(current)), flavor, &lexpr, depth);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
-		rc = __cil_fill_constraint_expr(current->next->next->cl_head, flavor, &rexpr, depth);
+		rc = __cil_fill_constraint_expr(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(current))), flavor, &rexpr, depth);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -2481,16 +2480,16 @@ exit:
 	return rc;
 }
 
-int cil_gen_constraint_expr(struct cil_tree_node *current, enum cil_flavor flavor, struct cil_list **expr)
+int cil_gen_constraint_expr(struct cil_parse_token *current, enum cil_flavor flavor, struct cil_list **expr)
 {
 	int rc = SEPOL_ERR;
 	int depth = 0;
 
-	if (current->cl_head == NULL) {
+	if (cil_parse_token_child(current) == NULL) {
 		goto exit;
 	}
 
-	rc = __cil_fill_constraint_expr(current->cl_head, flavor, expr, &depth);
+	rc = __cil_fill_constraint_expr(cil_parse_token_child(current), flavor, expr, &depth);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -2503,7 +2502,7 @@ exit:
 	return rc;
 }
 
-int cil_gen_boolif(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, int tunableif)
+int cil_gen_boolif(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, int tunableif)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2514,8 +2513,7 @@ int cil_gen_boolif(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 	};
 	int syntax_len = sizeof(syntax)/sizeof(*syntax);
 	struct cil_booleanif *bif = NULL;
-	struct cil_tree_node *next = NULL;
-	struct cil_tree_node *cond = NULL;
+	struct cil_parse_token *cond = NULL;
 	int rc = SEPOL_ERR;
 
 	if (db == NULL || parse_current == NULL || ast_node == NULL) {
@@ -2530,36 +2528,30 @@ int cil_gen_boolif(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 	cil_boolif_init(&bif);
 	bif->preserved_tunable = tunableif;
 
-	rc = cil_gen_expr(parse_current->next, CIL_BOOL, &bif->str_expr);
+	rc = cil_gen_expr(cil_parse_token_next(parse_current), CIL_BOOL, &bif->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	cond = parse_current->next->next;
+	cond = cil_parse_token_next(cil_parse_token_next(parse_current));
 
-	/* Destroying expr tree after stack is created*/
-	if (cond->cl_head->data != CIL_KEY_CONDTRUE &&
-		cond->cl_head->data != CIL_KEY_CONDFALSE) {
+	if (cil_parse_token_child(cond)->data != CIL_KEY_CONDTRUE &&
+		cil_parse_token_child(cond)->data != CIL_KEY_CONDFALSE) {
 		rc = SEPOL_ERR;
 		cil_log(CIL_ERR, "Conditional neither true nor false\n");
 		goto exit;
 	}
 
-	if (cond->next != NULL) {
-		cond = cond->next;
-		if (cond->cl_head->data != CIL_KEY_CONDTRUE &&
-			cond->cl_head->data != CIL_KEY_CONDFALSE) {
+	if (cil_parse_token_next(cond) != NULL) {
+		cond = cil_parse_token_next(cond);
+		if (cil_parse_token_child(cond)->data != CIL_KEY_CONDTRUE &&
+			cil_parse_token_child(cond)->data != CIL_KEY_CONDFALSE) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Conditional neither true nor false\n");
 			goto exit;
 		}
 	}
 
-
-	next = parse_current->next->next;
-	cil_tree_subtree_destroy(parse_current->next);
-	parse_current->next = next;
-
 	ast_node->flavor = CIL_BOOLEANIF;
 	ast_node->data = bif;
 
@@ -2568,10 +2560,10 @@ int cil_gen_boolif(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 exit:
 	if (tunableif) {
 		cil_log(CIL_ERR, "Bad tunableif (treated as a booleanif due to preserve-tunables) declaration at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	} else {
 		cil_log(CIL_ERR, "Bad booleanif declaration at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	}
 	cil_destroy_boolif(bif);
 	return rc;
@@ -2586,10 +2578,10 @@ void cil_destroy_boolif(struct cil_booleanif *bif)
 	cil_list_destroy(&bif->str_expr, CIL_TRUE);
 	cil_list_destroy(&bif->datum_expr, CIL_FALSE);
 
-	free(bif);
+	cil_arena_release(bif, sizeof(*bif));
 }
 
-int cil_gen_tunif(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_tunif(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2600,8 +2592,7 @@ int cil_gen_tunif(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 	};
 	int syntax_len = sizeof(syntax)/sizeof(*syntax);
 	struct cil_tunableif *tif = NULL;
-	struct cil_tree_node *next = NULL;
-	struct cil_tree_node *cond = NULL;
+	struct cil_parse_token *cond = NULL;
 	int rc = SEPOL_ERR;
 
 	if (db == NULL || parse_current == NULL || ast_node == NULL) {
@@ -2615,36 +2606,31 @@ int cil_gen_tunif(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	cil_tunif_init(&tif);
 
-	rc = cil_gen_expr(parse_current->next, CIL_TUNABLE, &tif->str_expr);
+	rc = cil_gen_expr(cil_parse_token_next(parse_current), CIL_TUNABLE, &tif->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	cond = parse_current->next->next;
+	cond = cil_parse_token_next(cil_parse_token_next(parse_current));
 
-	if (cond->cl_head->data != CIL_KEY_CONDTRUE &&
-		cond->cl_head->data != CIL_KEY_CONDFALSE) {
+	if (cil_parse_token_child(cond)->data != CIL_KEY_CONDTRUE &&
+		cil_parse_token_child(cond)->data != CIL_KEY_CONDFALSE) {
 		rc = SEPOL_ERR;
 		cil_log(CIL_ERR, "Conditional neither true nor false\n");
 		goto exit;
 	}
 
-	if (cond->next != NULL) {
-		cond = cond->next;
+	if (cil_parse_token_next(cond) != NULL) {
+		cond = cil_parse_token_next(cond);
 
-		if (cond->cl_head->data != CIL_KEY_CONDTRUE &&
-			cond->cl_head->data != CIL_KEY_CONDFALSE) {
+		if (cil_parse_token_child(cond)->data != CIL_KEY_CONDTRUE &&
+			cil_parse_token_child(cond)->data != CIL_KEY_CONDFALSE) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Conditional neither true nor false\n");
 			goto exit;
 		}
 	}
 
-	/* Destroying expr tree after stack is created*/
-	next = parse_current->next->next;
-	cil_tree_subtree_destroy(parse_current->next);
-	parse_current->next = next;
-
 	ast_node->flavor = CIL_TUNABLEIF;
 	ast_node->data = tif;
 
@@ -2652,7 +2638,7 @@ int cil_gen_tunif(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad tunableif declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_tunif(tif);
 	return rc;
 }
@@ -2666,10 +2652,10 @@ void cil_destroy_tunif(struct cil_tunableif *tif)
 	cil_list_destroy(&tif->str_expr, CIL_TRUE);
 	cil_list_destroy(&tif->datum_expr, CIL_FALSE);
 
-	free(tif);
+	cil_arena_release(tif, sizeof(*tif));
 }
 
-int cil_gen_condblock(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_condblock(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2689,7 +2675,7 @@ int cil_gen_condblock(__attribute__((unused)) struct cil_db *db, struct cil_tree
 		goto exit;
 	}
 
-	if (ast_node->parent->flavor != CIL_BOOLEANIF && ast_node->parent->flavor != CIL_TUNABLEIF) {
+	if (cil_tree_node_parent(ast_node)->flavor != CIL_BOOLEANIF && cil_tree_node_parent(ast_node)->flavor != CIL_TUNABLEIF) {
 		rc = SEPOL_ERR;
 		cil_log(CIL_ERR, "Conditional statements must be a direct child of a tunableif or booleanif statement.\n");
 		goto exit;
@@ -2706,7 +2692,7 @@ int cil_gen_condblock(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad %s condition declaration at line %d of %s\n",
-		(char*)parse_current->data, parse_current->line, parse_current->path);
+		(char*)parse_current->data, cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_condblock(cb);
 	return rc;
 }
@@ -2718,10 +2704,10 @@ void cil_destroy_condblock(struct cil_condblock *cb)
 	}
 
 	cil_symtab_array_destroy(cb->symtab);
-	free(cb);
+	cil_arena_release(cb, sizeof(*cb));
 }
 
-int cil_gen_alias(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_alias(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2743,7 +2729,7 @@ int cil_gen_alias(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 		goto exit;
 	}
 
-	if (flavor == CIL_TYPEALIAS && parse_current->next->data == CIL_KEY_SELF) {
+	if (flavor == CIL_TYPEALIAS && cil_parse_token_next(parse_current)->data == CIL_KEY_SELF) {
 		cil_log(CIL_ERR, "The keyword '%s' is reserved\n", CIL_KEY_SELF);
 		rc = SEPOL_ERR;
 		goto exit;
@@ -2751,7 +2737,7 @@ int cil_gen_alias(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	cil_alias_init(&alias);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_flavor_to_symtab_index(flavor, &sym_index);
 	if (rc != SEPOL_OK) {
@@ -2767,7 +2753,7 @@ int cil_gen_alias(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad %s declaration at line %d of %s\n",
-		(char*)parse_current->data, parse_current->line, parse_current->path);
+		(char*)parse_current->data, cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_alias(alias);
 	cil_clear_node(ast_node);
 	return rc;
@@ -2782,10 +2768,10 @@ void cil_destroy_alias(struct cil_alias *alias)
 	cil_symtab_datum_destroy(&alias->datum);
 	alias->actual = NULL;
 
-	free(alias);
+	cil_arena_release(alias, sizeof(*alias));
 }
 
-int cil_gen_aliasactual(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_aliasactual(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -2806,7 +2792,7 @@ int cil_gen_aliasactual(__attribute__((unused)) struct cil_db *db, struct cil_tr
 		goto exit;
 	}
 
-	if ((flavor == CIL_TYPEALIAS && parse_current->next->data == CIL_KEY_SELF) || parse_current->next->next->data == CIL_KEY_SELF) {
+	if ((flavor == CIL_TYPEALIAS && cil_parse_token_next(parse_current)->data == CIL_KEY_SELF) || cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_SELF) {
 		cil_log(CIL_ERR, "The keyword '%s' is reserved\n", CIL_KEY_SELF);
 		rc = SEPOL_ERR;
 		goto exit;
@@ -2814,9 +2800,9 @@ int cil_gen_aliasactual(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 	cil_aliasactual_init(&aliasactual);
 
-	aliasactual->alias_str = parse_current->next->data;
+	aliasactual->alias_str = cil_parse_token_next(parse_current)->data;
 
-	aliasactual->actual_str = parse_current->next->next->data;
+	aliasactual->actual_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = aliasactual;
 	ast_node->flavor = flavor;
@@ -2825,7 +2811,7 @@ int cil_gen_aliasactual(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 exit:
 	cil_log(CIL_ERR, "Bad %s association at line %d of %s\n", 
-			cil_node_to_string(parse_current),parse_current->line, parse_current->path);
+			(char *)parse_current->data,cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_clear_node(ast_node);
 	return rc;
 }
@@ -2836,10 +2822,10 @@ void cil_destroy_aliasactual(struct cil_aliasactual *aliasactual)
 		return;
 	}
 
-	free(aliasactual);
+	cil_arena_release(aliasactual, sizeof(*aliasactual));
 }
 
-int cil_gen_typeattributeset(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_typeattributeset(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2862,9 +2848,9 @@ int cil_gen_typeattributeset(__attribute__((unused)) struct cil_db *db, struct c
 
 	cil_typeattributeset_init(&attrset);
 
-	attrset->attr_str = parse_current->next->data;
+	attrset->attr_str = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_gen_expr(parse_current->next->next, CIL_TYPE, &attrset->str_expr);
+	rc = cil_gen_expr(cil_parse_token_next(cil_parse_token_next(parse_current)), CIL_TYPE, &attrset->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -2875,7 +2861,7 @@ int cil_gen_typeattributeset(__attribute__((unused)) struct cil_db *db, struct c
 
 exit:
 	cil_log(CIL_ERR, "Bad typeattributeset statement at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_typeattributeset(attrset);
 	return rc;
 }
@@ -2889,10 +2875,10 @@ void cil_destroy_typeattributeset(struct cil_typeattributeset *attrset)
 	cil_list_destroy(&attrset->str_expr, CIL_TRUE);
 	cil_list_destroy(&attrset->datum_expr, CIL_FALSE);
 
-	free(attrset);
+	cil_arena_release(attrset, sizeof(*attrset));
 }
 
-int cil_gen_typepermissive(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_typepermissive(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -2914,7 +2900,7 @@ int cil_gen_typepermissive(__attribute__((unused)) struct cil_db *db, struct cil
 
 	cil_typepermissive_init(&typeperm);
 
-	typeperm->type_str = parse_current->next->data;
+	typeperm->type_str = cil_parse_token_next(parse_current)->data;
 
 	ast_node->data = typeperm;
 	ast_node->flavor = CIL_TYPEPERMISSIVE;
@@ -2923,7 +2909,7 @@ int cil_gen_typepermissive(__attribute__((unused)) struct cil_db *db, struct cil
 
 exit:
 	cil_log(CIL_ERR, "Bad typepermissive declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_typepermissive(typeperm);
 	return rc;
 }
@@ -2934,10 +2920,10 @@ void cil_destroy_typepermissive(struct cil_typepermissive *typeperm)
 		return;
 	}
 
-	free(typeperm);
+	cil_arena_release(typeperm, sizeof(*typeperm));
 }
 
-int cil_gen_typetransition(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_typetransition(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -2961,17 +2947,17 @@ int cil_gen_typetransition(__attribute__((unused)) struct cil_db *db, struct cil
 		goto exit;
 	}
 
-	s1 = parse_current->next->data;
-	s2 = parse_current->next->next->data;
-	s3 = parse_current->next->next->next->data;
-	s4 = parse_current->next->next->next->next->data;
+	s1 = cil_parse_token_next(parse_current)->data;
+	s2 = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
+	s3 = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
+	s4 = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))->data;
 	s5 = NULL;
 
-	if (parse_current->next->next->next->next->next) {
+	if (cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))))) {
 		if (s4 == CIL_KEY_STAR) {
-			s4 = parse_current->next->next->next->next->next->data;
+			s4 = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))))->data;
 		} else {
-			s5 = parse_current->next->next->next->next->next->data;
+			s5 = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))))->data;
 		}
 	}
 
@@ -3007,7 +2993,7 @@ int cil_gen_typetransition(__attribute__((unused)) struct cil_db *db, struct cil
 
 exit:
 	cil_log(CIL_ERR, "Bad typetransition declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	return rc;
 }
 
@@ -3018,7 +3004,7 @@ void cil_destroy_name(struct cil_name *name)
 	}
 
 	cil_symtab_datum_destroy(&name->datum);
-	free(name);
+	cil_arena_release(name, sizeof(*name));
 }
 
 void cil_destroy_typetransition(struct cil_nametypetransition *nametypetrans)
@@ -3027,10 +3013,10 @@ void cil_destroy_typetransition(struct cil_nametypetransition *nametypetrans)
 		return;
 	}
 
-	free(nametypetrans);
+	cil_arena_release(nametypetrans, sizeof(*nametypetrans));
 }
 
-int cil_gen_rangetransition(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_rangetransition(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3055,18 +3041,18 @@ int cil_gen_rangetransition(__attribute__((unused)) struct cil_db *db, struct ci
 
 	cil_rangetransition_init(&rangetrans);
 
-	rangetrans->src_str = parse_current->next->data;
-	rangetrans->exec_str = parse_current->next->next->data;
-	rangetrans->obj_str = parse_current->next->next->next->data;
+	rangetrans->src_str = cil_parse_token_next(parse_current)->data;
+	rangetrans->exec_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
+	rangetrans->obj_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 
 	rangetrans->range_str = NULL;
 
-	if (parse_current->next->next->next->next->cl_head == NULL) {
-		rangetrans->range_str = parse_current->next->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))) == NULL) {
+		rangetrans->range_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))->data;
 	} else {
 		cil_levelrange_init(&rangetrans->range);
 
-		rc = cil_fill_levelrange(parse_current->next->next->next->next->cl_head, rangetrans->range);
+		rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))), rangetrans->range);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -3079,7 +3065,7 @@ int cil_gen_rangetransition(__attribute__((unused)) struct cil_db *db, struct ci
 
 exit:
 	cil_log(CIL_ERR, "Bad rangetransition declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_rangetransition(rangetrans);
 	return rc;
 }
@@ -3094,10 +3080,10 @@ void cil_destroy_rangetransition(struct cil_rangetransition *rangetrans)
 		cil_destroy_levelrange(rangetrans->range);
 	}
 
-	free(rangetrans);
+	cil_arena_release(rangetrans, sizeof(*rangetrans));
 }
 
-int cil_gen_sensitivity(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_sensitivity(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3120,7 +3106,7 @@ int cil_gen_sensitivity(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 	cil_sens_init(&sens);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)sens, (hashtab_key_t)key, CIL_SYM_SENS, CIL_SENS);
 	if (rc != SEPOL_OK) {
@@ -3131,7 +3117,7 @@ int cil_gen_sensitivity(__attribute__((unused)) struct cil_db *db, struct cil_tr
 
 exit:
 	cil_log(CIL_ERR, "Bad sensitivity declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_sensitivity(sens);
 	cil_clear_node(ast_node);
 	return rc;
@@ -3147,10 +3133,10 @@ void cil_destroy_sensitivity(struct cil_sens *sens)
 
 	cil_list_destroy(&sens->cats_list, CIL_FALSE);
 
-	free(sens);
+	cil_arena_release(sens, sizeof(*sens));
 }
 
-int cil_gen_category(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_category(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3173,7 +3159,7 @@ int cil_gen_category(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_cat_init(&cat);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)cat, (hashtab_key_t)key, CIL_SYM_CATS, CIL_CAT);
 	if (rc != SEPOL_OK) {
@@ -3184,7 +3170,7 @@ int cil_gen_category(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad category declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_category(cat);
 	cil_clear_node(ast_node);
 	return rc;
@@ -3197,10 +3183,10 @@ void cil_destroy_category(struct cil_cat *cat)
 	}
 
 	cil_symtab_datum_destroy(&cat->datum);
-	free(cat);
+	cil_arena_release(cat, sizeof(*cat));
 }
 
-int cil_gen_catset(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_catset(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3224,14 +3210,14 @@ int cil_gen_catset(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 	cil_catset_init(&catset);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)catset, (hashtab_key_t)key, CIL_SYM_CATS, CIL_CATSET);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_fill_cats(parse_current->next->next, &catset->cats);
+	rc = cil_fill_cats(cil_parse_token_next(cil_parse_token_next(parse_current)), &catset->cats);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3240,7 +3226,7 @@ int cil_gen_catset(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 exit:
 	cil_log(CIL_ERR, "Bad categoryset declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_catset(catset);
 	cil_clear_node(ast_node);
 	return rc;
@@ -3256,10 +3242,10 @@ void cil_destroy_catset(struct cil_catset *catset)
 
 	cil_destroy_cats(catset->cats);
 
-	free(catset);
+	cil_arena_release(catset, sizeof(*catset));
 }
 
-int cil_gen_catorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_catorder(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3281,7 +3267,7 @@ int cil_gen_catorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_catorder_init(&catorder);
 
-	rc = cil_fill_list(parse_current->next->cl_head, CIL_CATORDER, &catorder->cat_list_str);
+	rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_CATORDER, &catorder->cat_list_str);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3292,7 +3278,7 @@ int cil_gen_catorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad categoryorder declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_catorder(catorder);
 	return rc;
 }
@@ -3307,10 +3293,10 @@ void cil_destroy_catorder(struct cil_catorder *catorder)
 		cil_list_destroy(&catorder->cat_list_str, 1);
 	}
 
-	free(catorder);
+	cil_arena_release(catorder, sizeof(*catorder));
 }
 
-int cil_gen_sensitivityorder(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_sensitivityorder(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3332,7 +3318,7 @@ int cil_gen_sensitivityorder(__attribute__((unused)) struct cil_db *db, struct c
 
 	cil_sensorder_init(&sensorder);
 
-	rc = cil_fill_list(parse_current->next->cl_head, CIL_SENSITIVITYORDER, &sensorder->sens_list_str);
+	rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_SENSITIVITYORDER, &sensorder->sens_list_str);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3344,7 +3330,7 @@ int cil_gen_sensitivityorder(__attribute__((unused)) struct cil_db *db, struct c
 
 exit:
 	cil_log(CIL_ERR, "Bad sensitivityorder declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_sensitivityorder(sensorder);
 	return rc;
 }
@@ -3359,10 +3345,10 @@ void cil_destroy_sensitivityorder(struct cil_sensorder *sensorder)
 		cil_list_destroy(&sensorder->sens_list_str, CIL_TRUE);
 	}
 
-	free(sensorder);
+	cil_arena_release(sensorder, sizeof(*sensorder));
 }
 
-int cil_gen_senscat(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_senscat(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3385,9 +3371,9 @@ int cil_gen_senscat(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_senscat_init(&senscat);
 
-	senscat->sens_str = parse_current->next->data;
+	senscat->sens_str = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_fill_cats(parse_current->next->next, &senscat->cats);
+	rc = cil_fill_cats(cil_parse_token_next(cil_parse_token_next(parse_current)), &senscat->cats);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3399,7 +3385,7 @@ int cil_gen_senscat(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad sensitivitycategory declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_senscat(senscat);
 	return rc;
 }
@@ -3412,10 +3398,10 @@ void cil_destroy_senscat(struct cil_senscat *senscat)
 
 	cil_destroy_cats(senscat->cats);
 
-	free(senscat);
+	cil_arena_release(senscat, sizeof(*senscat));
 }
 
-int cil_gen_level(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_level(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3439,14 +3425,14 @@ int cil_gen_level(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	cil_level_init(&level);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)level, (hashtab_key_t)key, CIL_SYM_LEVELS, CIL_LEVEL);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_fill_level(parse_current->next->next->cl_head, level);
+	rc = cil_fill_level(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), level);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3455,7 +3441,7 @@ int cil_gen_level(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad level declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_level(level);
 	cil_clear_node(ast_node);
 	return rc;
@@ -3471,11 +3457,11 @@ void cil_destroy_level(struct cil_level *level)
 
 	cil_destroy_cats(level->cats);
 
-	free(level);
+	cil_arena_release(level, sizeof(*level));
 }
 
 /* low should be pointing to either the name of the low level or to an open paren for an anonymous low level */
-int cil_fill_levelrange(struct cil_tree_node *low, struct cil_levelrange *lvlrange)
+int cil_fill_levelrange(struct cil_parse_token *low, struct cil_levelrange *lvlrange)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING | CIL_SYN_LIST,
@@ -3495,21 +3481,21 @@ int cil_fill_levelrange(struct cil_tree_node *low, struct cil_levelrange *lvlran
 		goto exit;
 	}
 
-	if (low->cl_head == NULL) {
+	if (cil_parse_token_child(low) == NULL) {
 		lvlrange->low_str = low->data;
 	} else {
 		cil_level_init(&lvlrange->low);
-		rc = cil_fill_level(low->cl_head, lvlrange->low);
+		rc = cil_fill_level(cil_parse_token_child(low), lvlrange->low);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 	}
 
-	if (low->next->cl_head == NULL) {
-		lvlrange->high_str = low->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(low)) == NULL) {
+		lvlrange->high_str = cil_parse_token_next(low)->data;
 	} else {
 		cil_level_init(&lvlrange->high);
-		rc = cil_fill_level(low->next->cl_head, lvlrange->high);
+		rc = cil_fill_level(cil_parse_token_child(cil_parse_token_next(low)), lvlrange->high);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -3522,7 +3508,7 @@ exit:
 	return rc;
 }
 
-int cil_gen_levelrange(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_levelrange(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3546,14 +3532,14 @@ int cil_gen_levelrange(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 	cil_levelrange_init(&lvlrange);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)lvlrange, (hashtab_key_t)key, CIL_SYM_LEVELRANGES, CIL_LEVELRANGE);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_fill_levelrange(parse_current->next->next->cl_head, lvlrange);
+	rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), lvlrange);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3562,7 +3548,7 @@ int cil_gen_levelrange(__attribute__((unused)) struct cil_db *db, struct cil_tre
 
 exit:
 	cil_log(CIL_ERR, "Bad levelrange declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_levelrange(lvlrange);
 	cil_clear_node(ast_node);
 	return rc;
@@ -3584,10 +3570,10 @@ void cil_destroy_levelrange(struct cil_levelrange *lvlrange)
 		cil_destroy_level(lvlrange->high);
 	}
 
-	free(lvlrange);
+	cil_arena_release(lvlrange, sizeof(*lvlrange));
 }
 
-int cil_gen_constrain(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_constrain(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3610,12 +3596,12 @@ int cil_gen_constrain(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_constrain_init(&cons);
 
-	rc = cil_fill_classperms_list(parse_current->next, &cons->classperms);
+	rc = cil_fill_classperms_list(cil_parse_token_next(parse_current), &cons->classperms);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_gen_constraint_expr(parse_current->next->next, flavor, &cons->str_expr);
+	rc = cil_gen_constraint_expr(cil_parse_token_next(cil_parse_token_next(parse_current)), flavor, &cons->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3627,7 +3613,7 @@ int cil_gen_constrain(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad constrain declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_constrain(cons);
 	return rc;
 }
@@ -3642,10 +3628,10 @@ void cil_destroy_constrain(struct cil_constrain *cons)
 	cil_list_destroy(&cons->str_expr, CIL_TRUE);
 	cil_list_destroy(&cons->datum_expr, CIL_FALSE);
 
-	free(cons);
+	cil_arena_release(cons, sizeof(*cons));
 }
 
-int cil_gen_validatetrans(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_validatetrans(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3668,9 +3654,9 @@ int cil_gen_validatetrans(__attribute__((unused)) struct cil_db *db, struct cil_
 
 	cil_validatetrans_init(&validtrans);
 
-	validtrans->class_str = parse_current->next->data;
+	validtrans->class_str = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_gen_constraint_expr(parse_current->next->next, flavor, &validtrans->str_expr);
+	rc = cil_gen_constraint_expr(cil_parse_token_next(cil_parse_token_next(parse_current)), flavor, &validtrans->str_expr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3682,7 +3668,7 @@ int cil_gen_validatetrans(__attribute__((unused)) struct cil_db *db, struct cil_
 
 exit:
 	cil_log(CIL_ERR, "Bad validatetrans declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_validatetrans(validtrans);
 	return rc;
 
@@ -3698,11 +3684,11 @@ void cil_destroy_validatetrans(struct cil_validatetrans *validtrans)
 	cil_list_destroy(&validtrans->str_expr, CIL_TRUE);
 	cil_list_destroy(&validtrans->datum_expr, CIL_FALSE);
 
-	free(validtrans);
+	cil_arena_release(validtrans, sizeof(*validtrans));
 }
 
 /* Fills in context starting from user */
-int cil_fill_context(struct cil_tree_node *user_node, struct cil_context *context)
+int cil_fill_context(struct cil_parse_token *user_node, struct cil_context *context)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3724,17 +3710,17 @@ int cil_fill_context(struct cil_tree_node *user_node, struct cil_context *contex
 	}
 
 	context->user_str = user_node->data;
-	context->role_str = user_node->next->data;
-	context->type_str = user_node->next->next->data;
+	context->role_str = cil_parse_token_next(user_node)->data;
+	context->type_str = cil_parse_token_next(cil_parse_token_next(user_node))->data;
 
 	context->range_str = NULL;
 
-	if (user_node->next->next->next->cl_head == NULL) {
-		context->range_str = user_node->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(user_node)))) == NULL) {
+		context->range_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(user_node)))->data;
 	} else {
 		cil_levelrange_init(&context->range);
 
-		rc = cil_fill_levelrange(user_node->next->next->next->cl_head, context->range);
+		rc = cil_fill_levelrange(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(user_node)))), context->range);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -3747,7 +3733,7 @@ exit:
 	return rc;
 }
 
-int cil_gen_context(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_context(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3771,14 +3757,14 @@ int cil_gen_context(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_context_init(&context);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)context, (hashtab_key_t)key, CIL_SYM_CONTEXTS, CIL_CONTEXT);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	rc = cil_fill_context(parse_current->next->next->cl_head, context);
+	rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), context);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -3787,7 +3773,7 @@ int cil_gen_context(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad context declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_context(context);
 	cil_clear_node(ast_node);
 	return SEPOL_ERR;
@@ -3805,10 +3791,10 @@ void cil_destroy_context(struct cil_context *context)
 		cil_destroy_levelrange(context->range);
 	}
 
-	free(context);
+	cil_arena_release(context, sizeof(*context));
 }
 
-int cil_gen_filecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_filecon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3831,10 +3817,10 @@ int cil_gen_filecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 		goto exit;
 	}
 
-	type = parse_current->next->next->data;
+	type = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	cil_filecon_init(&filecon);
 
-	filecon->path_str = parse_current->next->data;
+	filecon->path_str = cil_parse_token_next(parse_current)->data;
 
 	if (type == CIL_KEY_FILE) {
 		filecon->type = CIL_FILECON_FILE;
@@ -3858,15 +3844,15 @@ int cil_gen_filecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 		goto exit;
 	}
 
-	if (parse_current->next->next->next->cl_head == NULL) {
-		filecon->context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL) {
+		filecon->context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
-		if (parse_current->next->next->next->cl_head->next == NULL) {
+		if (cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current))))) == NULL) {
 			filecon->context = NULL;
 		} else {
 			cil_context_init(&filecon->context);
 
-			rc = cil_fill_context(parse_current->next->next->next->cl_head, filecon->context);
+			rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), filecon->context);
 			if (rc != SEPOL_OK) {
 				goto exit;
 			}
@@ -3880,7 +3866,7 @@ int cil_gen_filecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad filecon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_filecon(filecon);
 	return rc;
 }
@@ -3896,10 +3882,10 @@ void cil_destroy_filecon(struct cil_filecon *filecon)
 		cil_destroy_context(filecon->context);
 	}
 
-	free(filecon);
+	cil_arena_release(filecon, sizeof(*filecon));
 }
 
-int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -3924,7 +3910,7 @@ int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_portcon_init(&portcon);
 
-	proto = parse_current->next->data;
+	proto = cil_parse_token_next(parse_current)->data;
 	if (proto == CIL_KEY_UDP) {
 		portcon->proto = CIL_PROTOCOL_UDP;
 	} else if (proto == CIL_KEY_TCP) {
@@ -3935,15 +3921,15 @@ int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 		goto exit;
 	}
 
-	if (parse_current->next->next->cl_head != NULL) {
-		if (parse_current->next->next->cl_head->next != NULL
-		&& parse_current->next->next->cl_head->next->next == NULL) {
-			rc = cil_fill_integer(parse_current->next->next->cl_head, &portcon->port_low);
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) != NULL) {
+		if (cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current)))) != NULL
+		&& cil_parse_token_next(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))))) == NULL) {
+			rc = cil_fill_integer(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), &portcon->port_low);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper port specified\n");
 				goto exit;
 			}
-			rc = cil_fill_integer(parse_current->next->next->cl_head->next, &portcon->port_high);
+			rc = cil_fill_integer(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current)))), &portcon->port_high);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper port specified\n");
 				goto exit;
@@ -3954,7 +3940,7 @@ int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 			goto exit;
 		}
 	} else {
-		rc = cil_fill_integer(parse_current->next->next, &portcon->port_low);
+		rc = cil_fill_integer(cil_parse_token_next(cil_parse_token_next(parse_current)), &portcon->port_low);
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_ERR, "Improper port specified\n");
 			goto exit;
@@ -3962,12 +3948,12 @@ int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 		portcon->port_high = portcon->port_low;
 	}
 
-	if (parse_current->next->next->next->cl_head == NULL ) {
-		portcon->context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL ) {
+		portcon->context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_context_init(&portcon->context);
 
-		rc = cil_fill_context(parse_current->next->next->next->cl_head, portcon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), portcon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -3980,7 +3966,7 @@ int cil_gen_portcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad portcon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_portcon(portcon);
 	return rc;
 }
@@ -3995,10 +3981,10 @@ void cil_destroy_portcon(struct cil_portcon *portcon)
 		cil_destroy_context(portcon->context);
 	}
 
-	free(portcon);
+	cil_arena_release(portcon, sizeof(*portcon));
 }
 
-int cil_gen_nodecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_nodecon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4022,34 +4008,34 @@ int cil_gen_nodecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_nodecon_init(&nodecon);
 
-	if (parse_current->next->cl_head == NULL ) {
-		nodecon->addr_str = parse_current->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(parse_current)) == NULL ) {
+		nodecon->addr_str = cil_parse_token_next(parse_current)->data;
 	} else {
 		cil_ipaddr_init(&nodecon->addr);
 
-		rc = cil_fill_ipaddr(parse_current->next->cl_head, nodecon->addr);
+		rc = cil_fill_ipaddr(cil_parse_token_child(cil_parse_token_next(parse_current)), nodecon->addr);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 	}
 
-	if (parse_current->next->next->cl_head == NULL ) {
-		nodecon->mask_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL ) {
+		nodecon->mask_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_ipaddr_init(&nodecon->mask);
 
-		rc = cil_fill_ipaddr(parse_current->next->next->cl_head, nodecon->mask);
+		rc = cil_fill_ipaddr(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), nodecon->mask);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 	}
 
-	if (parse_current->next->next->next->cl_head == NULL ) {
-		nodecon->context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL ) {
+		nodecon->context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_context_init(&nodecon->context);
 
-		rc = cil_fill_context(parse_current->next->next->next->cl_head, nodecon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), nodecon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4062,7 +4048,7 @@ int cil_gen_nodecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad nodecon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_nodecon(nodecon);
 	return rc;
 }
@@ -4085,10 +4071,10 @@ void cil_destroy_nodecon(struct cil_nodecon *nodecon)
 		cil_destroy_context(nodecon->context);
 	}
 
-	free(nodecon);
+	cil_arena_release(nodecon, sizeof(*nodecon));
 }
 
-int cil_gen_genfscon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_genfscon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4112,15 +4098,15 @@ int cil_gen_genfscon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_genfscon_init(&genfscon);
 
-	genfscon->fs_str = parse_current->next->data;
-	genfscon->path_str = parse_current->next->next->data;
+	genfscon->fs_str = cil_parse_token_next(parse_current)->data;
+	genfscon->path_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
-	if (parse_current->next->next->next->cl_head == NULL ) {
-		genfscon->context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL ) {
+		genfscon->context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_context_init(&genfscon->context);
 
-		rc = cil_fill_context(parse_current->next->next->next->cl_head, genfscon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), genfscon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4133,7 +4119,7 @@ int cil_gen_genfscon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad genfscon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_genfscon(genfscon);
 	return SEPOL_ERR;
 }
@@ -4148,11 +4134,11 @@ void cil_destroy_genfscon(struct cil_genfscon *genfscon)
 		cil_destroy_context(genfscon->context);
 	}
 
-	free(genfscon);
+	cil_arena_release(genfscon, sizeof(*genfscon));
 }
 
 
-int cil_gen_netifcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_netifcon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4176,25 +4162,25 @@ int cil_gen_netifcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_netifcon_init(&netifcon);
 
-	netifcon->interface_str = parse_current->next->data;
+	netifcon->interface_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next->cl_head == NULL) {
-		netifcon->if_context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		netifcon->if_context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&netifcon->if_context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, netifcon->if_context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), netifcon->if_context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 	}
 
-	if (parse_current->next->next->next->cl_head == NULL) {
-		netifcon->packet_context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL) {
+		netifcon->packet_context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_context_init(&netifcon->packet_context);
 
-		rc = cil_fill_context(parse_current->next->next->next->cl_head, netifcon->packet_context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), netifcon->packet_context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4207,7 +4193,7 @@ int cil_gen_netifcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad netifcon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_netifcon(netifcon);
 	return SEPOL_ERR;
 }
@@ -4226,10 +4212,10 @@ void cil_destroy_netifcon(struct cil_netifcon *netifcon)
 		cil_destroy_context(netifcon->packet_context);
 	}
 
-	free(netifcon);
+	cil_arena_release(netifcon, sizeof(*netifcon));
 }
 
-int cil_gen_pirqcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_pirqcon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4252,17 +4238,17 @@ int cil_gen_pirqcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 	cil_pirqcon_init(&pirqcon);
 
-	rc = cil_fill_integer(parse_current->next, &pirqcon->pirq);
+	rc = cil_fill_integer(cil_parse_token_next(parse_current), &pirqcon->pirq);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	if (parse_current->next->next->cl_head == NULL) {
-		pirqcon->context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		pirqcon->context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&pirqcon->context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, pirqcon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), pirqcon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4275,7 +4261,7 @@ int cil_gen_pirqcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad pirqcon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_pirqcon(pirqcon);
 	return rc;
 }
@@ -4290,10 +4276,10 @@ void cil_destroy_pirqcon(struct cil_pirqcon *pirqcon)
 		cil_destroy_context(pirqcon->context);
 	}
 
-	free(pirqcon);
+	cil_arena_release(pirqcon, sizeof(*pirqcon));
 }
 
-int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4316,15 +4302,15 @@ int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_iomemcon_init(&iomemcon);
 
-	if (parse_current->next->cl_head != NULL) {
-		if (parse_current->next->cl_head->next != NULL &&
-		    parse_current->next->cl_head->next->next == NULL) {
-			rc = cil_fill_integer(parse_current->next->cl_head, &iomemcon->iomem_low);
+	if (cil_parse_token_child(cil_parse_token_next(parse_current)) != NULL) {
+		if (cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current))) != NULL &&
+		    cil_parse_token_next(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current)))) == NULL) {
+			rc = cil_fill_integer(cil_parse_token_child(cil_parse_token_next(parse_current)), &iomemcon->iomem_low);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper iomem specified\n");
 				goto exit;
 			}
-			rc = cil_fill_integer(parse_current->next->cl_head->next, &iomemcon->iomem_high);
+			rc = cil_fill_integer(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current))), &iomemcon->iomem_high);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper iomem specified\n");
 				goto exit;
@@ -4335,7 +4321,7 @@ int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 			goto exit;
 		}
 	} else {
-		rc = cil_fill_integer(parse_current->next, &iomemcon->iomem_low);;
+		rc = cil_fill_integer(cil_parse_token_next(parse_current), &iomemcon->iomem_low);;
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_ERR, "Improper iomem specified\n");
 			goto exit;
@@ -4343,12 +4329,12 @@ int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 		iomemcon->iomem_high = iomemcon->iomem_low;
 	}
 
-	if (parse_current->next->next->cl_head == NULL ) {
-		iomemcon->context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL ) {
+		iomemcon->context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&iomemcon->context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, iomemcon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), iomemcon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4361,7 +4347,7 @@ int cil_gen_iomemcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad iomemcon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_iomemcon(iomemcon);
 	return rc;
 }
@@ -4376,10 +4362,10 @@ void cil_destroy_iomemcon(struct cil_iomemcon *iomemcon)
 		cil_destroy_context(iomemcon->context);
 	}
 
-	free(iomemcon);
+	cil_arena_release(iomemcon, sizeof(*iomemcon));
 }
 
-int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4402,15 +4388,15 @@ int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_ioportcon_init(&ioportcon);
 
-	if (parse_current->next->cl_head != NULL) {
-		if (parse_current->next->cl_head->next != NULL &&
-		    parse_current->next->cl_head->next->next == NULL) {
-			rc = cil_fill_integer(parse_current->next->cl_head, &ioportcon->ioport_low);
+	if (cil_parse_token_child(cil_parse_token_next(parse_current)) != NULL) {
+		if (cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current))) != NULL &&
+		    cil_parse_token_next(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current)))) == NULL) {
+			rc = cil_fill_integer(cil_parse_token_child(cil_parse_token_next(parse_current)), &ioportcon->ioport_low);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper ioport specified\n");
 				goto exit;
 			}
-			rc = cil_fill_integer(parse_current->next->cl_head->next, &ioportcon->ioport_high);
+			rc = cil_fill_integer(cil_parse_token_next(cil_parse_token_child(cil_parse_token_next(parse_current))), &ioportcon->ioport_high);
 			if (rc != SEPOL_OK) {
 				cil_log(CIL_ERR, "Improper ioport specified\n");
 				goto exit;
@@ -4421,7 +4407,7 @@ int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_tree
 			goto exit;
 		}
 	} else {
-		rc = cil_fill_integer(parse_current->next, &ioportcon->ioport_low);
+		rc = cil_fill_integer(cil_parse_token_next(parse_current), &ioportcon->ioport_low);
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_ERR, "Improper ioport specified\n");
 			goto exit;
@@ -4429,12 +4415,12 @@ int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_tree
 		ioportcon->ioport_high = ioportcon->ioport_low;
 	}
 
-	if (parse_current->next->next->cl_head == NULL ) {
-		ioportcon->context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL ) {
+		ioportcon->context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&ioportcon->context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, ioportcon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), ioportcon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4447,7 +4433,7 @@ int cil_gen_ioportcon(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad ioportcon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_ioportcon(ioportcon);
 	return rc;
 }
@@ -4462,10 +4448,10 @@ void cil_destroy_ioportcon(struct cil_ioportcon *ioportcon)
 		cil_destroy_context(ioportcon->context);
 	}
 
-	free(ioportcon);
+	cil_arena_release(ioportcon, sizeof(*ioportcon));
 }
 
-int cil_gen_pcidevicecon(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_pcidevicecon(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4488,17 +4474,17 @@ int cil_gen_pcidevicecon(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 	cil_pcidevicecon_init(&pcidevicecon);
 
-	rc = cil_fill_integer(parse_current->next, &pcidevicecon->dev);
+	rc = cil_fill_integer(cil_parse_token_next(parse_current), &pcidevicecon->dev);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 
-	if (parse_current->next->next->cl_head == NULL) {
-		pcidevicecon->context_str = parse_current->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))) == NULL) {
+		pcidevicecon->context_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	} else {
 		cil_context_init(&pcidevicecon->context);
 
-		rc = cil_fill_context(parse_current->next->next->cl_head, pcidevicecon->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current))), pcidevicecon->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4511,7 +4497,7 @@ int cil_gen_pcidevicecon(__attribute__((unused)) struct cil_db *db, struct cil_t
 
 exit:
 	cil_log(CIL_ERR, "Bad pcidevicecon declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_pcidevicecon(pcidevicecon);
 	return rc;
 }
@@ -4526,10 +4512,10 @@ void cil_destroy_pcidevicecon(struct cil_pcidevicecon *pcidevicecon)
 		cil_destroy_context(pcidevicecon->context);
 	}
 
-	free(pcidevicecon);
+	cil_arena_release(pcidevicecon, sizeof(*pcidevicecon));
 }
 
-int cil_gen_fsuse(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_fsuse(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4552,7 +4538,7 @@ int cil_gen_fsuse(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 		goto exit;
 	}
 
-	type = parse_current->next->data;
+	type = cil_parse_token_next(parse_current)->data;
 
 	cil_fsuse_init(&fsuse);
 
@@ -4567,14 +4553,14 @@ int cil_gen_fsuse(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 		goto exit;
 	}
 
-	fsuse->fs_str = parse_current->next->next->data;
+	fsuse->fs_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
-	if (parse_current->next->next->next->cl_head == NULL) {
-		fsuse->context_str = parse_current->next->next->next->data;
+	if (cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))) == NULL) {
+		fsuse->context_str = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	} else {
 		cil_context_init(&fsuse->context);
 
-		rc = cil_fill_context(parse_current->next->next->next->cl_head, fsuse->context);
+		rc = cil_fill_context(cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))), fsuse->context);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4587,7 +4573,7 @@ int cil_gen_fsuse(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad fsuse declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_fsuse(fsuse);
 	return SEPOL_ERR;
 }
@@ -4602,7 +4588,7 @@ void cil_destroy_fsuse(struct cil_fsuse *fsuse)
 		cil_destroy_context(fsuse->context);
 	}
 
-	free(fsuse);
+	cil_arena_release(fsuse, sizeof(*fsuse));
 }
 
 void cil_destroy_param(struct cil_param *param)
@@ -4611,15 +4597,14 @@ void cil_destroy_param(struct cil_param *param)
 		return;
 	}
 
-	free(param);
+	cil_arena_release(param, sizeof(*param));
 }
 
-int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	char *key = NULL;
 	struct cil_macro *macro = NULL;
-	struct cil_tree_node *macro_content = NULL;
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
 		CIL_SYN_STRING,
@@ -4640,9 +4625,9 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 	cil_macro_init(&macro);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
-	struct cil_tree_node *current_item = parse_current->next->next->cl_head;
+	struct cil_parse_token *current_item = cil_parse_token_child(cil_parse_token_next(cil_parse_token_next(parse_current)));
 	while (current_item != NULL) {
 		enum cil_syntax param_syntax[] = {
 			CIL_SYN_STRING,
@@ -4653,7 +4638,7 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 		char *kind = NULL;
 		struct cil_param *param = NULL;
 
-		rc =__cil_verify_syntax(current_item->cl_head, param_syntax, param_syntax_len);
+		rc =__cil_verify_syntax(cil_parse_token_child(current_item), param_syntax, param_syntax_len);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -4662,7 +4647,7 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 			cil_list_init(&macro->params, CIL_LIST_ITEM);
 		}
 
-		kind = current_item->cl_head->data;
+		kind = cil_parse_token_child(current_item)->data;
 		cil_param_init(&param);
 
 		if (kind == CIL_KEY_TYPE) {
@@ -4701,7 +4686,7 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 			goto exit;
 		}
 
-		param->str =  current_item->cl_head->next->data;
+		param->str =  cil_parse_token_next(cil_parse_token_child(current_item))->data;
 
 		rc = __cil_verify_name(param->str);
 		if (rc != SEPOL_OK) {
@@ -4723,17 +4708,7 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 		cil_list_append(macro->params, CIL_PARAM, param);
 
-		current_item = current_item->next;
-	}
-
-	/* we don't want the tree walker to walk the macro parameters (they were just handled above), so the subtree is deleted, and the next pointer of the
-           node containing the macro name is updated to point to the start of the macro content */
-	macro_content = parse_current->next->next->next;
-	cil_tree_subtree_destroy(parse_current->next->next);
-	parse_current->next->next = macro_content;
-	if (macro_content == NULL) {
-		/* No statements in macro and macro parameter list was last node */
-		parse_current->parent->cl_tail = parse_current->next;
+		current_item = cil_parse_token_next(current_item);
 	}
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)macro, (hashtab_key_t)key, CIL_SYM_BLOCKS, CIL_MACRO);
@@ -4745,7 +4720,7 @@ int cil_gen_macro(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 
 exit:
 	cil_log(CIL_ERR, "Bad macro declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_macro(macro);
 	cil_clear_node(ast_node);
 	return SEPOL_ERR;
@@ -4764,10 +4739,10 @@ void cil_destroy_macro(struct cil_macro *macro)
 		cil_list_destroy(&macro->params, 1);
 	}
 
-	free(macro);
+	cil_arena_release(macro, sizeof(*macro));
 }
 
-int cil_gen_call(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_call(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4790,11 +4765,10 @@ int cil_gen_call(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 	cil_call_init(&call);
 
-	call->macro_str = parse_current->next->data;
+	call->macro_str = cil_parse_token_next(parse_current)->data;
 
-	if (parse_current->next->next != NULL) {
-		cil_tree_init(&call->args_tree);
-		cil_copy_ast(db, parse_current->next->next, call->args_tree->root);
+	if (cil_parse_token_next(cil_parse_token_next(parse_current)) != NULL) {
+		call->args_tokens = cil_parse_token_copy(cil_parse_token_next(cil_parse_token_next(parse_current)));
 	}
 
 	ast_node->data = call;
@@ -4804,7 +4778,7 @@ int cil_gen_call(__attribute__((unused)) struct cil_db *db, struct cil_tree_node
 
 exit:
 	cil_log(CIL_ERR, "Bad macro call at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_call(call);
 	return rc;
 }
@@ -4817,15 +4791,15 @@ void cil_destroy_call(struct cil_call *call)
 
 	call->macro = NULL;
 
-	if (call->args_tree != NULL) {
-		cil_tree_destroy(&call->args_tree);
+	if (call->args_tokens != NULL) {
+		cil_parse_token_release(call->args_tokens);
 	}
 
 	if (call->args != NULL) {
 		cil_list_destroy(&call->args, 1);
 	}
 
-	free(call);
+	cil_arena_release(call, sizeof(*call));
 }
 
 void cil_destroy_args(struct cil_args *args)
@@ -4837,29 +4811,29 @@ void cil_destroy_args(struct cil_args *args)
 	if (args->arg_str != NULL) {
 		args->arg_str = NULL;
 	} else if (args->arg != NULL) {
-		struct cil_tree_node *node = args->arg->nodes->head->data;
+		struct cil_tree_node *node = cil_vector_get(&args->arg->nodes, 0);
 		switch (args->flavor) {
 		case CIL_NAME:
 			break;
 		case CIL_CATSET:
 			cil_destroy_catset((struct cil_catset *)args->arg);
-			free(node);
+			cil_arena_release_node(node);
 			break;
 		case CIL_LEVEL:
 			cil_destroy_level((struct cil_level *)args->arg);
-			free(node);
+			cil_arena_release_node(node);
 			break;
 		case CIL_LEVELRANGE:
 			cil_destroy_levelrange((struct cil_levelrange *)args->arg);
-			free(node);
+			cil_arena_release_node(node);
 			break;
 		case CIL_IPADDR:
 			cil_destroy_ipaddr((struct cil_ipaddr *)args->arg);
-			free(node);
+			cil_arena_release_node(node);
 			break;
 		case CIL_CLASSPERMISSION:
 			cil_destroy_classpermission((struct cil_classpermission *)args->arg);
-			free(node);
+			cil_arena_release_node(node);
 			break;
 		default:
 			cil_log(CIL_ERR, "Destroying arg with the unexpected flavor=%d\n",args->flavor);
@@ -4870,10 +4844,10 @@ void cil_destroy_args(struct cil_args *args)
 	args->param_str = NULL;
 	args->arg = NULL;
 
-	free(args);
+	cil_arena_release(args, sizeof(*args));
 }
 
-int cil_gen_optional(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_optional(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4897,7 +4871,7 @@ int cil_gen_optional(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 	cil_optional_init(&optional);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)optional, (hashtab_key_t)key, CIL_SYM_BLOCKS, CIL_OPTIONAL);
 	if (rc != SEPOL_OK)
@@ -4907,7 +4881,7 @@ int cil_gen_optional(__attribute__((unused)) struct cil_db *db, struct cil_tree_
 
 exit:
 	cil_log(CIL_ERR, "Bad optional at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_optional(optional);
 	cil_clear_node(ast_node);
 	return rc;
@@ -4920,10 +4894,10 @@ void cil_destroy_optional(struct cil_optional *optional)
 	}
 
 	cil_symtab_datum_destroy(&optional->datum);
-	free(optional);
+	cil_arena_release(optional, sizeof(*optional));
 }
 
-int cil_gen_policycap(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_policycap(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4946,7 +4920,7 @@ int cil_gen_policycap(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 	cil_policycap_init(&polcap);
 
-	key = parse_current->next->data;
+	key = cil_parse_token_next(parse_current)->data;
 
 	rc = cil_gen_node(db, ast_node, (struct cil_symtab_datum*)polcap, (hashtab_key_t)key, CIL_SYM_POLICYCAPS, CIL_POLICYCAP);
 	if (rc != SEPOL_OK)
@@ -4956,7 +4930,7 @@ int cil_gen_policycap(__attribute__((unused)) struct cil_db *db, struct cil_tree
 
 exit:
 	cil_log(CIL_ERR, "Bad policycap statement at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_policycap(polcap);
 	cil_clear_node(ast_node);
 	return rc;
@@ -4969,10 +4943,10 @@ void cil_destroy_policycap(struct cil_policycap *polcap)
 	}
 
 	cil_symtab_datum_destroy(&polcap->datum);
-	free(polcap);
+	cil_arena_release(polcap, sizeof(*polcap));
 }
 
-int cil_gen_ipaddr(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_ipaddr(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -4996,9 +4970,9 @@ int cil_gen_ipaddr(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 	cil_ipaddr_init(&ipaddr);
 
-	key  = parse_current->next->data;
+	key  = cil_parse_token_next(parse_current)->data;
 
-	rc = cil_fill_ipaddr(parse_current->next->next, ipaddr);
+	rc = cil_fill_ipaddr(cil_parse_token_next(cil_parse_token_next(parse_current)), ipaddr);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
@@ -5012,7 +4986,7 @@ int cil_gen_ipaddr(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 exit:
 	cil_log(CIL_ERR, "Bad ipaddr statement at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_ipaddr(ipaddr);
 	cil_clear_node(ast_node);
 	return rc;
@@ -5025,10 +4999,10 @@ void cil_destroy_ipaddr(struct cil_ipaddr *ipaddr)
 	}
 
 	cil_symtab_datum_destroy(&ipaddr->datum);
-	free(ipaddr);
+	cil_arena_release(ipaddr, sizeof(*ipaddr));
 }
 
-int cil_fill_integer(struct cil_tree_node *int_node, uint32_t *integer)
+int cil_fill_integer(struct cil_parse_token *int_node, uint32_t *integer)
 {
 	int rc = SEPOL_ERR;
 	char *endptr = NULL;
@@ -5054,7 +5028,7 @@ exit:
 	return rc;
 }
 
-int cil_fill_ipaddr(struct cil_tree_node *addr_node, struct cil_ipaddr *addr)
+int cil_fill_ipaddr(struct cil_parse_token *addr_node, struct cil_ipaddr *addr)
 {
 	int rc = SEPOL_ERR;
 
@@ -5062,7 +5036,7 @@ int cil_fill_ipaddr(struct cil_tree_node *addr_node, struct cil_ipaddr *addr)
 		goto exit;
 	}
 
-	if (addr_node->cl_head != NULL ||  addr_node->next != NULL) {
+	if (cil_parse_token_child(addr_node) != NULL ||  cil_parse_token_next(addr_node) != NULL) {
 		goto exit;
 	}
 
@@ -5085,7 +5059,7 @@ exit:
 	return rc;
 }
 
-int cil_fill_level(struct cil_tree_node *curr, struct cil_level *level)
+int cil_fill_level(struct cil_parse_token *curr, struct cil_level *level)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -5105,8 +5079,8 @@ int cil_fill_level(struct cil_tree_node *curr, struct cil_level *level)
 	}
 
 	level->sens_str = curr->data;
-	if (curr->next != NULL) {
-		rc = cil_fill_cats(curr->next, &level->cats);
+	if (cil_parse_token_next(curr) != NULL) {
+		rc = cil_fill_cats(cil_parse_token_next(curr), &level->cats);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -5119,7 +5093,7 @@ exit:
 	return rc;
 }
 
-int cil_fill_cats(struct cil_tree_node *curr, struct cil_cats **cats)
+int cil_fill_cats(struct cil_parse_token *curr, struct cil_cats **cats)
 {
 	int rc = SEPOL_ERR;
 
@@ -5142,10 +5116,11 @@ void cil_destroy_cats(struct cil_cats *cats)
 	cil_list_destroy(&cats->str_expr, CIL_TRUE);
 
 	cil_list_destroy(&cats->datum_expr, CIL_FALSE);
+	cil_vector_destroy(&cats->datums);
 
-	free(cats);
+	cil_arena_release(cats, sizeof(*cats));
 }
-int cil_gen_bounds(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_bounds(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	enum cil_syntax syntax[] = {
 		CIL_SYN_STRING,
@@ -5168,8 +5143,8 @@ int cil_gen_bounds(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 	cil_bounds_init(&bounds);
 
-	bounds->parent_str = parse_current->next->data;
-	bounds->child_str = parse_current->next->next->data;
+	bounds->parent_str = cil_parse_token_next(parse_current)->data;
+	bounds->child_str = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 
 	ast_node->data = bounds;
 
@@ -5191,7 +5166,7 @@ int cil_gen_bounds(__attribute__((unused)) struct cil_db *db, struct cil_tree_no
 
 exit:
 	cil_log(CIL_ERR, "Bad bounds declaration at line %d of %s\n", 
-		parse_current->line, parse_current->path);
+		cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_bounds(bounds);
 	return rc;
 }
@@ -5202,10 +5177,10 @@ void cil_destroy_bounds(struct cil_bounds *bounds)
 		return;
 	}
 
-	free(bounds);
+	cil_arena_release(bounds, sizeof(*bounds));
 }
 
-int cil_gen_default(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
+int cil_gen_default(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node, enum cil_flavor flavor)
 {
 	int rc = SEPOL_ERR;
 	struct cil_default *def = NULL;
@@ -5227,15 +5202,15 @@ int cil_gen_default(struct cil_tree_node *parse_current, struct cil_tree_node *a
 
 	def->flavor = flavor;
 
-	if (parse_current->next->cl_head == NULL) {
+	if (cil_parse_token_child(cil_parse_token_next(parse_current)) == NULL) {
 		cil_list_init(&def->class_strs, CIL_CLASS);
-		cil_list_append(def->class_strs, CIL_STRING, parse_current->next->data);
+		cil_list_append(def->class_strs, CIL_STRING, cil_parse_token_next(parse_current)->data);
 		rc = SEPOL_OK;
 	} else {
-		rc = cil_fill_list(parse_current->next->cl_head, CIL_CLASS, &def->class_strs);
+		rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_CLASS, &def->class_strs);
 	}
 
-	object = parse_current->next->next->data;
+	object = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
 	if (object == CIL_KEY_SOURCE) {
 		def->object = CIL_DEFAULT_SOURCE;
 	} else if (object == CIL_KEY_TARGET) {
@@ -5253,7 +5228,7 @@ int cil_gen_default(struct cil_tree_node *parse_current, struct cil_tree_node *a
 
 exit:
 	cil_log(CIL_ERR, "Bad %s declaration at line %d of %s\n", 
-			cil_node_to_string(parse_current), parse_current->line, parse_current->path);
+			(char *)parse_current->data, cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_default(def);
 	return rc;
 }
@@ -5268,10 +5243,10 @@ void cil_destroy_default(struct cil_default *def)
 
 	cil_list_destroy(&def->class_datums, CIL_FALSE);
 
-	free(def);
+	cil_arena_release(def, sizeof(*def));
 }
 
-int cil_gen_defaultrange(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_defaultrange(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	struct cil_defaultrange *def = NULL;
@@ -5293,16 +5268,16 @@ int cil_gen_defaultrange(struct cil_tree_node *parse_current, struct cil_tree_no
 
 	cil_defaultrange_init(&def);
 
-	if (parse_current->next->cl_head == NULL) {
+	if (cil_parse_token_child(cil_parse_token_next(parse_current)) == NULL) {
 		cil_list_init(&def->class_strs, CIL_CLASS);
-		cil_list_append(def->class_strs, CIL_STRING, parse_current->next->data);
+		cil_list_append(def->class_strs, CIL_STRING, cil_parse_token_next(parse_current)->data);
 		rc = SEPOL_OK;
 	} else {
-		rc = cil_fill_list(parse_current->next->cl_head, CIL_CLASS, &def->class_strs);
+		rc = cil_fill_list(cil_parse_token_child(cil_parse_token_next(parse_current)), CIL_CLASS, &def->class_strs);
 	}
 
-	object = parse_current->next->next->data;
-	range = parse_current->next->next->next->data;
+	object = cil_parse_token_next(cil_parse_token_next(parse_current))->data;
+	range = cil_parse_token_next(cil_parse_token_next(cil_parse_token_next(parse_current)))->data;
 	if (object == CIL_KEY_SOURCE) {
 		if (range == CIL_KEY_LOW) {
 			def->object_range = CIL_DEFAULT_SOURCE_LOW;
@@ -5315,7 +5290,7 @@ int cil_gen_defaultrange(struct cil_tree_node *parse_current, struct cil_tree_no
 			rc = SEPOL_ERR;
 			goto exit;
 		}
-	} else if (parse_current->next->next->data == CIL_KEY_TARGET) {
+	} else if (cil_parse_token_next(cil_parse_token_next(parse_current))->data == CIL_KEY_TARGET) {
 		if (range == CIL_KEY_LOW) {
 			def->object_range = CIL_DEFAULT_TARGET_LOW;
 		} else if (range == CIL_KEY_HIGH) {
@@ -5340,7 +5315,7 @@ int cil_gen_defaultrange(struct cil_tree_node *parse_current, struct cil_tree_no
 
 exit:
 	cil_log(CIL_ERR, "Bad defaultrange declaration at line %d of %s\n", 
-			parse_current->line, parse_current->path);
+			cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_defaultrange(def);
 	return rc;
 }
@@ -5355,10 +5330,10 @@ void cil_destroy_defaultrange(struct cil_defaultrange *def)
 
 	cil_list_destroy(&def->class_datums, CIL_FALSE);
 
-	free(def);
+	cil_arena_release(def, sizeof(*def));
 }
 
-int cil_gen_handleunknown(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_handleunknown(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -5381,7 +5356,7 @@ int cil_gen_handleunknown(struct cil_tree_node *parse_current, struct cil_tree_n
 
 	cil_handleunknown_init(&unknown);
 
-	unknown_key = parse_current->next->data;
+	unknown_key = cil_parse_token_next(parse_current)->data;
 	if (unknown_key == CIL_KEY_HANDLEUNKNOWN_ALLOW) {
 		unknown->handle_unknown = SEPOL_ALLOW_UNKNOWN;
 	} else if (unknown_key == CIL_KEY_HANDLEUNKNOWN_DENY) {
@@ -5401,17 +5376,17 @@ int cil_gen_handleunknown(struct cil_tree_node *parse_current, struct cil_tree_n
 
 exit:
 	cil_log(CIL_ERR, "Bad handleunknown at line %d of %s\n",
-			parse_current->line, parse_current->path);
+			cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_handleunknown(unknown);
 	return rc;
 }
 
 void cil_destroy_handleunknown(struct cil_handleunknown *unk)
 {
-	free(unk);
+	cil_arena_release(unk, sizeof(*unk));
 }
 
-int cil_gen_mls(struct cil_tree_node *parse_current, struct cil_tree_node *ast_node)
+int cil_gen_mls(struct cil_parse_token *parse_current, struct cil_tree_node *ast_node)
 {
 	int rc = SEPOL_ERR;
 	enum cil_syntax syntax[] = {
@@ -5433,9 +5408,9 @@ int cil_gen_mls(struct cil_tree_node *parse_current, struct cil_tree_node *ast_n
 
 	cil_mls_init(&mls);
 
-	if (parse_current->next->data == CIL_KEY_CONDTRUE) {
+	if (cil_parse_token_next(parse_current)->data == CIL_KEY_CONDTRUE) {
 		mls->value = CIL_TRUE;
-	} else if (parse_current->next->data == CIL_KEY_CONDFALSE) {
+	} else if (cil_parse_token_next(parse_current)->data == CIL_KEY_CONDFALSE) {
 		mls->value = CIL_FALSE;
 	} else {
 		cil_log(CIL_ERR, "Value must be either \'true\' or \'false\'");
@@ -5450,17 +5425,30 @@ int cil_gen_mls(struct cil_tree_node *parse_current, struct cil_tree_node *ast_n
 
 exit:
 	cil_log(CIL_ERR, "Bad mls at line %d of %s\n",
-			parse_current->line, parse_current->path);
+			cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 	cil_destroy_mls(mls);
 	return rc;
 }
 
 void cil_destroy_mls(struct cil_mls *mls)
 {
-	free(mls);
+	cil_arena_release(mls, sizeof(*mls));
+}
+
+/* The token following the first num_args arguments of the statement whose
+ * keyword is parse_current, which may be the close of the statement */
+static struct cil_parse_token *__cil_build_ast_skip_args(struct cil_parse_token *parse_current, int num_args)
+{
+	struct cil_parse_token *current = parse_current + 1;
+
+	for (; num_args > 0; num_args--) {
+		current += (current->data == NULL ? current->match : 0) + 1;
+	}
+
+	return current;
 }
 
-int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *finished, void *extra_args)
+int __cil_build_ast_node_helper(struct cil_parse_token *parse_current, uint32_t *finished, void *extra_args)
 {
 	struct cil_args_build *args = NULL;
 	struct cil_tree_node *ast_current = NULL;
@@ -5484,18 +5472,14 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 	tunif = args->tunif;
 	in = args->in;
 
-	if (parse_current->parent->cl_head != parse_current) {
+	if ((parse_current - 1)->data != NULL || (parse_current - 1)->match < 0) {
 		/* ignore anything that isn't following a parenthesis */
 		rc = SEPOL_OK;
 		goto exit;
 	} else if (parse_current->data == NULL) {
-		/* the only time parenthsis can immediately following parenthesis is if
-		 * the parent is the root node */
-		if (parse_current->parent->parent == NULL) {
-			rc = SEPOL_OK;
-		} else {
-			cil_log(CIL_ERR, "Keyword expected after open parenthesis in line %d of %s\n", parse_current->line, parse_current->path);
-		}
+		/* statements are walked one at a time, so a parenthesis following
+		 * a parenthesis is never at the top level */
+		cil_log(CIL_ERR, "Keyword expected after open parenthesis in line %d of %s\n", cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 		goto exit;
 	}
 
@@ -5503,7 +5487,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 		if (parse_current->data == CIL_KEY_MACRO) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found macro at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			cil_log(CIL_ERR, "Macros cannot be defined within macro statement\n");
 			goto exit;
 		}
@@ -5511,7 +5495,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 		if (parse_current->data == CIL_KEY_TUNABLE) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found tunable at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			cil_log(CIL_ERR, "Tunables cannot be defined within macro statement\n");
 			goto exit;
 		}
@@ -5519,7 +5503,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 		if (parse_current->data == CIL_KEY_IN) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found in at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			cil_log(CIL_ERR, "in-statements cannot be defined within macro statement\n");
 			goto exit;
 		}
@@ -5537,7 +5521,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 			parse_current->data != CIL_KEY_CALL) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found %s at line %d of %s\n",
-				(char*)parse_current->data, parse_current->line, parse_current->path);
+				(char*)parse_current->data, cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			if (((struct cil_booleanif*)boolif->data)->preserved_tunable) {
 				cil_log(CIL_ERR, "%s cannot be defined within tunableif statement (treated as a booleanif due to preserve-tunables)\n",
 						(char*)parse_current->data);
@@ -5553,7 +5537,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 		if (parse_current->data == CIL_KEY_TUNABLE) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found tunable at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			cil_log(CIL_ERR, "Tunables cannot be defined within tunableif statement\n");
 			goto exit;
 		}
@@ -5563,7 +5547,7 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 		if (parse_current->data == CIL_KEY_IN) {
 			rc = SEPOL_ERR;
 			cil_log(CIL_ERR, "Found in-statement at line %d of %s\n",
-				parse_current->line, parse_current->path);
+				cil_tree_loc_line(parse_current->loc), cil_tree_loc_path(parse_current->loc));
 			cil_log(CIL_ERR, "in-statements cannot be defined within in-statements\n");
 			goto exit;
 		}
@@ -5571,255 +5555,345 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 
 	cil_tree_node_init(&ast_node);
 
-	ast_node->parent = ast_current;
-	ast_node->line = parse_current->line;
-	ast_node->path = parse_current->path;
+	cil_tree_node_set_parent(ast_node, ast_current);
+	ast_node->loc = parse_current->loc;
 
-	if (parse_current->data == CIL_KEY_BLOCK) {
+	switch (cil_strpool_keyword(parse_current->data)) {
+	case CIL_KEYWORD_BLOCK:
 		rc = cil_gen_block(db, parse_current, ast_node, 0);
-	} else if (parse_current->data == CIL_KEY_BLOCKINHERIT) {
+		break;
+	case CIL_KEYWORD_BLOCKINHERIT:
 		rc = cil_gen_blockinherit(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_BLOCKABSTRACT) {
+		break;
+	case CIL_KEYWORD_BLOCKABSTRACT:
 		rc = cil_gen_blockabstract(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_IN) {
+		break;
+	case CIL_KEYWORD_IN:
 		rc = cil_gen_in(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_CLASS) {
+		break;
+	case CIL_KEYWORD_CLASS:
 		rc = cil_gen_class(db, parse_current, ast_node);
 		// To avoid parsing list of perms again
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CLASSORDER) {
+		break;
+	case CIL_KEYWORD_CLASSORDER:
 		rc = cil_gen_classorder(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_MAP_CLASS) {
+		break;
+	case CIL_KEYWORD_MAP_CLASS:
 		rc = cil_gen_map_class(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CLASSMAPPING) {
+		break;
+	case CIL_KEYWORD_CLASSMAPPING:
 		rc = cil_gen_classmapping(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CLASSPERMISSION) {
+		break;
+	case CIL_KEYWORD_CLASSPERMISSION:
 		rc = cil_gen_classpermission(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CLASSPERMISSIONSET) {
+		break;
+	case CIL_KEYWORD_CLASSPERMISSIONSET:
 		rc = cil_gen_classpermissionset(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_COMMON) {
+		break;
+	case CIL_KEYWORD_COMMON:
 		rc = cil_gen_common(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CLASSCOMMON) {
+		break;
+	case CIL_KEYWORD_CLASSCOMMON:
 		rc = cil_gen_classcommon(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_SID) {
+		break;
+	case CIL_KEYWORD_SID:
 		rc = cil_gen_sid(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_SIDCONTEXT) {
+		break;
+	case CIL_KEYWORD_SIDCONTEXT:
 		rc = cil_gen_sidcontext(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_SIDORDER) {
+		break;
+	case CIL_KEYWORD_SIDORDER:
 		rc = cil_gen_sidorder(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_USER) {
+		break;
+	case CIL_KEYWORD_USER:
 		rc = cil_gen_user(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_USERLEVEL) {
+		break;
+	case CIL_KEYWORD_USERLEVEL:
 		rc = cil_gen_userlevel(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_USERRANGE) {
+		break;
+	case CIL_KEYWORD_USERRANGE:
 		rc = cil_gen_userrange(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_USERBOUNDS) {
+		break;
+	case CIL_KEYWORD_USERBOUNDS:
 		rc = cil_gen_bounds(db, parse_current, ast_node, CIL_USER);
-	} else if (parse_current->data == CIL_KEY_USERPREFIX) {
+		break;
+	case CIL_KEYWORD_USERPREFIX:
 		rc = cil_gen_userprefix(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_SELINUXUSER) {
+		break;
+	case CIL_KEYWORD_SELINUXUSER:
 		rc = cil_gen_selinuxuser(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_SELINUXUSERDEFAULT) {
+		break;
+	case CIL_KEYWORD_SELINUXUSERDEFAULT:
 		rc = cil_gen_selinuxuserdefault(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_TYPE) {
+		break;
+	case CIL_KEYWORD_TYPE:
 		rc = cil_gen_type(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_TYPEATTRIBUTE) {
+		break;
+	case CIL_KEYWORD_TYPEATTRIBUTE:
 		rc = cil_gen_typeattribute(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_TYPEATTRIBUTESET) {
+		break;
+	case CIL_KEYWORD_TYPEATTRIBUTESET:
 		rc = cil_gen_typeattributeset(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_TYPEALIAS) {
+		break;
+	case CIL_KEYWORD_TYPEALIAS:
 		rc = cil_gen_alias(db, parse_current, ast_node, CIL_TYPEALIAS);
-	} else if (parse_current->data == CIL_KEY_TYPEALIASACTUAL) {
+		break;
+	case CIL_KEYWORD_TYPEALIASACTUAL:
 		rc = cil_gen_aliasactual(db, parse_current, ast_node, CIL_TYPEALIASACTUAL);
-	} else if (parse_current->data == CIL_KEY_TYPEBOUNDS) {
+		break;
+	case CIL_KEYWORD_TYPEBOUNDS:
 		rc = cil_gen_bounds(db, parse_current, ast_node, CIL_TYPE);
-	} else if (parse_current->data == CIL_KEY_TYPEPERMISSIVE) {
+		break;
+	case CIL_KEYWORD_TYPEPERMISSIVE:
 		rc = cil_gen_typepermissive(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_RANGETRANSITION) {
+		break;
+	case CIL_KEYWORD_RANGETRANSITION:
 		rc = cil_gen_rangetransition(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_ROLE) {
+		break;
+	case CIL_KEYWORD_ROLE:
 		rc = cil_gen_role(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_USERROLE) {
+		break;
+	case CIL_KEYWORD_USERROLE:
 		rc = cil_gen_userrole(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_ROLETYPE) {
+		break;
+	case CIL_KEYWORD_ROLETYPE:
 		rc = cil_gen_roletype(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_ROLETRANSITION) {
+		break;
+	case CIL_KEYWORD_ROLETRANSITION:
 		rc = cil_gen_roletransition(parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_ROLEALLOW) {
+		break;
+	case CIL_KEYWORD_ROLEALLOW:
 		rc = cil_gen_roleallow(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_ROLEATTRIBUTE) {
+		break;
+	case CIL_KEYWORD_ROLEATTRIBUTE:
 		rc = cil_gen_roleattribute(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_ROLEATTRIBUTESET) {
+		break;
+	case CIL_KEYWORD_ROLEATTRIBUTESET:
 		rc = cil_gen_roleattributeset(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_ROLEBOUNDS) {
+		break;
+	case CIL_KEYWORD_ROLEBOUNDS:
 		rc = cil_gen_bounds(db, parse_current, ast_node, CIL_ROLE);
-	} else if (parse_current->data == CIL_KEY_BOOL) {
+		break;
+	case CIL_KEYWORD_BOOL:
 		rc = cil_gen_bool(db, parse_current, ast_node, CIL_FALSE);
-	} else if (parse_current->data == CIL_KEY_BOOLEANIF) {
+		break;
+	case CIL_KEYWORD_BOOLEANIF:
 		rc = cil_gen_boolif(db, parse_current, ast_node, CIL_FALSE);
-	} else if(parse_current->data == CIL_KEY_TUNABLE) {
+		break;
+	case CIL_KEYWORD_TUNABLE:
 		if (db->preserve_tunables) {
 			rc = cil_gen_bool(db, parse_current, ast_node, CIL_TRUE);
 		} else {
 			rc = cil_gen_tunable(db, parse_current, ast_node);
 		}
-	} else if (parse_current->data == CIL_KEY_TUNABLEIF) {
+		break;
+	case CIL_KEYWORD_TUNABLEIF:
 		if (db->preserve_tunables) {
 			rc = cil_gen_boolif(db, parse_current, ast_node, CIL_TRUE);
 		} else {
 			rc = cil_gen_tunif(db, parse_current, ast_node);
 		}
-	} else if (parse_current->data == CIL_KEY_CONDTRUE) {
+		break;
+	case CIL_KEYWORD_CONDTRUE:
 		rc = cil_gen_condblock(db, parse_current, ast_node, CIL_CONDTRUE);
-	} else if (parse_current->data == CIL_KEY_CONDFALSE) {
+		break;
+	case CIL_KEYWORD_CONDFALSE:
 		rc = cil_gen_condblock(db, parse_current, ast_node, CIL_CONDFALSE);
-	} else if (parse_current->data == CIL_KEY_ALLOW) {
+		break;
+	case CIL_KEYWORD_ALLOW:
 		rc = cil_gen_avrule(parse_current, ast_node, CIL_AVRULE_ALLOWED);
 		// So that the object and perms lists do not get parsed again
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_AUDITALLOW) {
+		break;
+	case CIL_KEYWORD_AUDITALLOW:
 		rc = cil_gen_avrule(parse_current, ast_node, CIL_AVRULE_AUDITALLOW);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_DONTAUDIT) {
+		break;
+	case CIL_KEYWORD_DONTAUDIT:
 		rc = cil_gen_avrule(parse_current, ast_node, CIL_AVRULE_DONTAUDIT);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_NEVERALLOW) {
+		break;
+	case CIL_KEYWORD_NEVERALLOW:
 		rc = cil_gen_avrule(parse_current, ast_node, CIL_AVRULE_NEVERALLOW);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_TYPETRANSITION) {
+		break;
+	case CIL_KEYWORD_TYPETRANSITION:
 		rc = cil_gen_typetransition(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_TYPECHANGE) {
+		break;
+	case CIL_KEYWORD_TYPECHANGE:
 		rc = cil_gen_type_rule(parse_current, ast_node, CIL_TYPE_CHANGE);
-	} else if (parse_current->data == CIL_KEY_TYPEMEMBER) {
+		break;
+	case CIL_KEYWORD_TYPEMEMBER:
 		rc = cil_gen_type_rule(parse_current, ast_node, CIL_TYPE_MEMBER);
-	} else if (parse_current->data == CIL_KEY_SENSITIVITY) {
+		break;
+	case CIL_KEYWORD_SENSITIVITY:
 		rc = cil_gen_sensitivity(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_SENSALIAS) {
+		break;
+	case CIL_KEYWORD_SENSALIAS:
 		rc = cil_gen_alias(db, parse_current, ast_node, CIL_SENSALIAS);
-	} else if (parse_current->data == CIL_KEY_SENSALIASACTUAL) {
+		break;
+	case CIL_KEYWORD_SENSALIASACTUAL:
 		rc = cil_gen_aliasactual(db, parse_current, ast_node, CIL_SENSALIASACTUAL);
-	} else if (parse_current->data == CIL_KEY_CATEGORY) {
+		break;
+	case CIL_KEYWORD_CATEGORY:
 		rc = cil_gen_category(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_CATALIAS) {
+		break;
+	case CIL_KEYWORD_CATALIAS:
 		rc = cil_gen_alias(db, parse_current, ast_node, CIL_CATALIAS);
-	} else if (parse_current->data == CIL_KEY_CATALIASACTUAL) {
+		break;
+	case CIL_KEYWORD_CATALIASACTUAL:
 		rc = cil_gen_aliasactual(db, parse_current, ast_node, CIL_CATALIASACTUAL);
-	} else if (parse_current->data == CIL_KEY_CATSET) {
+		break;
+	case CIL_KEYWORD_CATSET:
 		rc = cil_gen_catset(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CATORDER) {
+		break;
+	case CIL_KEYWORD_CATORDER:
 		rc = cil_gen_catorder(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_SENSITIVITYORDER) {
+		break;
+	case CIL_KEYWORD_SENSITIVITYORDER:
 		rc = cil_gen_sensitivityorder(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_SENSCAT) {
+		break;
+	case CIL_KEYWORD_SENSCAT:
 		rc = cil_gen_senscat(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_LEVEL) {
+		break;
+	case CIL_KEYWORD_LEVEL:
 		rc = cil_gen_level(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_LEVELRANGE) {
+		break;
+	case CIL_KEYWORD_LEVELRANGE:
 		rc = cil_gen_levelrange(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CONSTRAIN) {
+		break;
+	case CIL_KEYWORD_CONSTRAIN:
 		rc = cil_gen_constrain(db, parse_current, ast_node, CIL_CONSTRAIN);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_MLSCONSTRAIN) {
+		break;
+	case CIL_KEYWORD_MLSCONSTRAIN:
 		rc = cil_gen_constrain(db, parse_current, ast_node, CIL_MLSCONSTRAIN);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_VALIDATETRANS) {
+		break;
+	case CIL_KEYWORD_VALIDATETRANS:
 		rc = cil_gen_validatetrans(db, parse_current, ast_node, CIL_VALIDATETRANS);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_MLSVALIDATETRANS) {
+		break;
+	case CIL_KEYWORD_MLSVALIDATETRANS:
 		rc = cil_gen_validatetrans(db, parse_current, ast_node, CIL_MLSVALIDATETRANS);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_CONTEXT) {
+		break;
+	case CIL_KEYWORD_CONTEXT:
 		rc = cil_gen_context(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_FILECON) {
+		break;
+	case CIL_KEYWORD_FILECON:
 		rc = cil_gen_filecon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_PORTCON) {
+		break;
+	case CIL_KEYWORD_PORTCON:
 		rc = cil_gen_portcon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_NODECON) {
+		break;
+	case CIL_KEYWORD_NODECON:
 		rc = cil_gen_nodecon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_GENFSCON) {
+		break;
+	case CIL_KEYWORD_GENFSCON:
 		rc = cil_gen_genfscon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_NETIFCON) {
+		break;
+	case CIL_KEYWORD_NETIFCON:
 		rc = cil_gen_netifcon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_PIRQCON) {
+		break;
+	case CIL_KEYWORD_PIRQCON:
 		rc = cil_gen_pirqcon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_IOMEMCON) {
+		break;
+	case CIL_KEYWORD_IOMEMCON:
 		rc = cil_gen_iomemcon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_IOPORTCON) {
+		break;
+	case CIL_KEYWORD_IOPORTCON:
 		rc = cil_gen_ioportcon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_PCIDEVICECON) {
+		break;
+	case CIL_KEYWORD_PCIDEVICECON:
 		rc = cil_gen_pcidevicecon(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_FSUSE) {
+		break;
+	case CIL_KEYWORD_FSUSE:
 		rc = cil_gen_fsuse(db, parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_MACRO) {
+		break;
+	case CIL_KEYWORD_MACRO:
 		rc = cil_gen_macro(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_CALL) {
+		break;
+	case CIL_KEYWORD_CALL:
 		rc = cil_gen_call(db, parse_current, ast_node);
 		*finished = 1;
-	} else if (parse_current->data == CIL_KEY_POLICYCAP) {
+		break;
+	case CIL_KEYWORD_POLICYCAP:
 		rc = cil_gen_policycap(db, parse_current, ast_node);
 		*finished = 1;
-	} else if (parse_current->data == CIL_KEY_OPTIONAL) {
+		break;
+	case CIL_KEYWORD_OPTIONAL:
 		rc = cil_gen_optional(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_IPADDR) {
+		break;
+	case CIL_KEYWORD_IPADDR:
 		rc = cil_gen_ipaddr(db, parse_current, ast_node);
-	} else if (parse_current->data == CIL_KEY_DEFAULTUSER) {
+		break;
+	case CIL_KEYWORD_DEFAULTUSER:
 		rc = cil_gen_default(parse_current, ast_node, CIL_DEFAULTUSER);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_DEFAULTROLE) {
+		break;
+	case CIL_KEYWORD_DEFAULTROLE:
 		rc = cil_gen_default(parse_current, ast_node, CIL_DEFAULTROLE);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_DEFAULTTYPE) {
+		break;
+	case CIL_KEYWORD_DEFAULTTYPE:
 		rc = cil_gen_default(parse_current, ast_node, CIL_DEFAULTTYPE);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_DEFAULTRANGE) {
+		break;
+	case CIL_KEYWORD_DEFAULTRANGE:
 		rc = cil_gen_defaultrange(parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_HANDLEUNKNOWN) {
+		break;
+	case CIL_KEYWORD_HANDLEUNKNOWN:
 		rc = cil_gen_handleunknown(parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else if (parse_current->data == CIL_KEY_MLS) {
+		break;
+	case CIL_KEYWORD_MLS:
 		rc = cil_gen_mls(parse_current, ast_node);
 		*finished = CIL_TREE_SKIP_NEXT;
-	} else {
+		break;
+	default:
 		cil_log(CIL_ERR, "Error: Unknown keyword %s\n", (char*)parse_current->data);
 		rc = SEPOL_ERR;
+		break;
 	}
 
 	if (rc == SEPOL_OK) {
-		if (ast_current->cl_head == NULL) {
+		if (cil_tree_node_head(ast_current) == NULL) {
 			if (ast_current->flavor == CIL_MACRO) {
 				args->macro = ast_current;
 			}
@@ -5836,13 +5910,20 @@ int __cil_build_ast_node_helper(struct cil_tree_node *parse_current, uint32_t *f
 				args->in = ast_current;
 			}
 		
-			ast_current->cl_head = ast_node;
+			cil_tree_node_set_head(ast_current, ast_node);
 		} else {
-			ast_current->cl_tail->next = ast_node;
+			cil_tree_node_set_next(cil_tree_node_tail(ast_current), ast_node);
 		}
-		ast_current->cl_tail = ast_node;
+		cil_tree_node_set_tail(ast_current, ast_node);
 		ast_current = ast_node;
 		args->ast = ast_current;
+
+		/* Macro parameters and conditional expressions are not statements */
+		if (ast_node->flavor == CIL_MACRO) {
+			args->parse_next = __cil_build_ast_skip_args(parse_current, 2);
+		} else if (ast_node->flavor == CIL_BOOLEANIF || ast_node->flavor == CIL_TUNABLEIF) {
+			args->parse_next = __cil_build_ast_skip_args(parse_current, 1);
+		}
 	} else {
 		cil_tree_node_destroy(&ast_node);
 	}
@@ -5851,7 +5932,7 @@ exit:
 	return rc;
 }
 
-int __cil_build_ast_last_child_helper(struct cil_tree_node *parse_current, void *extra_args)
+int __cil_build_ast_last_child_helper(void *extra_args)
 {
 	int rc = SEPOL_ERR;
 	struct cil_tree_node *ast = NULL;
@@ -5869,7 +5950,7 @@ int __cil_build_ast_last_child_helper(struct cil_tree_node *parse_current, void
 		goto exit;
 	}
 
-	args->ast = ast->parent;
+	args->ast = cil_tree_node_parent(ast);
 
 	if (ast->flavor == CIL_MACRO) {
 		args->macro = NULL;
@@ -5887,25 +5968,68 @@ int __cil_build_ast_last_child_helper(struct cil_tree_node *parse_current, void
 		args->in = NULL;
 	}
 
-	// At this point we no longer have any need for parse_current or any of its
-	// siblings; they have all been converted to the appropriate AST node. The
-	// full parse tree will get deleted elsewhere, but in an attempt to
-	// minimize memory useage (of which the parse tree uses alot), start
-	// deleting the parts we don't need now.
-	cil_tree_children_destroy(parse_current->parent);
+	return SEPOL_OK;
+
+exit:
+	return rc;
+}
+
+/* Walk the tokens of statement the way cil_tree_walk() walks a parse tree:
+ * the node helper sees every symbol and open parenthesis, and the last child
+ * helper sees the close of every list that is entered. */
+static int __cil_build_ast_walk(struct cil_parse_token *statement, struct cil_args_build *args)
+{
+	int rc = SEPOL_OK;
+	struct cil_parse_token *current = statement + 1;
+	struct cil_parse_token *end = statement + statement->match;
+	uint32_t finished;
+
+	while (current <= end) {
+		if (current->data == NULL && current->match < 0) {
+			rc = __cil_build_ast_last_child_helper(args);
+			if (rc != SEPOL_OK) {
+				current += current->match;
+				goto exit;
+			}
+			current++;
+			continue;
+		}
+
+		finished = CIL_TREE_SKIP_NOTHING;
+		args->parse_next = NULL;
+		rc = __cil_build_ast_node_helper(current, &finished, args);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+
+		if (finished & CIL_TREE_SKIP_NEXT) {
+			/* Go to the close of the list that current begins */
+			current = (current - 1) + (current - 1)->match;
+		} else if (args->parse_next != NULL) {
+			current = args->parse_next;
+		} else if (current->data == NULL && current->match == 1) {
+			/* An empty list has nothing to enter */
+			current += 2;
+		} else {
+			current++;
+		}
+	}
 
 	return SEPOL_OK;
 
 exit:
+	cil_log(CIL_INFO, "Problem at line %d of %s\n", cil_tree_loc_line(current->loc), cil_tree_loc_path(current->loc));
 	return rc;
 }
 
-int cil_build_ast(__attribute__((unused)) struct cil_db *db, struct cil_tree_node *parse_tree, struct cil_tree_node *ast)
+/* Build the AST of one top level statement, as handed out by
+ * cil_parse_tokens_walk(), under ast */
+int cil_build_ast(__attribute__((unused)) struct cil_db *db, struct cil_parse_token *statement, struct cil_tree_node *ast)
 {
 	int rc = SEPOL_ERR;
 	struct cil_args_build extra_args;
 
-	if (db == NULL || parse_tree == NULL || ast == NULL) {
+	if (db == NULL || statement == NULL || ast == NULL) {
 		goto exit;
 	}
 
@@ -5915,8 +6039,9 @@ int cil_build_ast(__attribute__((unused)) struct cil_db *db, struct cil_tree_nod
 	extra_args.boolif = NULL;
 	extra_args.tunif = NULL;
 	extra_args.in = NULL;
+	extra_args.parse_next = NULL;
 
-	rc = cil_tree_walk(parse_tree, __cil_build_ast_node_helper, NULL, __cil_build_ast_last_child_helper, &extra_args);
+	rc = __cil_build_ast_walk(statement, &extra_args);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
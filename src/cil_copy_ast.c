@@ -83,7 +83,7 @@ void cil_copy_list(struct cil_list *data, struct cil_list **copy)
 	*copy = new;
 }
 
-int cil_copy_node(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_node(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	char *new = NULL;
 
@@ -95,7 +95,7 @@ int cil_copy_node(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_block(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_block(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_block *orig = data;
 	char *key = orig->datum.name;
@@ -113,7 +113,7 @@ int cil_copy_block(__attribute__((unused)) struct cil_db *db, void *data, void *
 	return SEPOL_OK;
 }
 
-int cil_copy_blockabstract(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_blockabstract(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_blockabstract *orig = data;
 	struct cil_blockabstract *new = NULL;
@@ -127,7 +127,7 @@ int cil_copy_blockabstract(__attribute__((unused)) struct cil_db *db, void *data
 	return SEPOL_OK;
 }
 
-int cil_copy_blockinherit(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_blockinherit(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_blockinherit *orig = data;
 	struct cil_blockinherit *new = NULL;
@@ -142,7 +142,7 @@ int cil_copy_blockinherit(__attribute__((unused)) struct cil_db *db, void *data,
 	return SEPOL_OK;
 }
 
-int cil_copy_policycap(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_policycap(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_policycap *orig = data;
 	char *key = orig->datum.name;
@@ -160,7 +160,7 @@ int cil_copy_policycap(__attribute__((unused)) struct cil_db *db, void *data, vo
 	return SEPOL_OK;
 }
 
-int cil_copy_perm(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_perm(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_perm *orig = data;
 	char *key = orig->datum.name;
@@ -213,7 +213,7 @@ void cil_copy_classperms_list(struct cil_list *orig, struct cil_list **new)
 	}
 }
 
-int cil_copy_classmapping(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_classmapping(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_classmapping *orig = data;
 	struct cil_classmapping *new = NULL;
@@ -230,7 +230,7 @@ int cil_copy_classmapping(__attribute__((unused)) struct cil_db *db, void *data,
 	return SEPOL_OK;
 }
 
-int cil_copy_class(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_class(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_class *orig = data;
 	struct cil_class *new = NULL;
@@ -252,7 +252,7 @@ int cil_copy_class(__attribute__((unused)) struct cil_db *db, void *data, void *
 	return SEPOL_OK;
 }
 
-int cil_copy_classorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_classorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_classorder *orig = data;
 	struct cil_classorder *new = NULL;
@@ -267,7 +267,7 @@ int cil_copy_classorder(__attribute__((unused)) struct cil_db *db, void *data, v
 	return SEPOL_OK;
 }
 
-int cil_copy_classpermission(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_classpermission(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_classpermission *orig = data;
 	struct cil_classpermission *new = NULL;
@@ -289,7 +289,7 @@ int cil_copy_classpermission(__attribute__((unused)) struct cil_db *db, void *da
 	return SEPOL_OK;
 }
 
-int cil_copy_classpermissionset(__attribute__((unused)) struct cil_db *db, void *data, void **copy,  __attribute__((unused)) symtab_t *symtab)
+int cil_copy_classpermissionset(__attribute__((unused)) struct cil_db *db, void *data, void **copy,  __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_classpermissionset *orig = data;
 	struct cil_classpermissionset *new = NULL;
@@ -303,7 +303,7 @@ int cil_copy_classpermissionset(__attribute__((unused)) struct cil_db *db, void
 	return SEPOL_OK;
 }
 
-int cil_copy_classcommon(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_classcommon(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_classcommon *orig = data;
 	struct cil_classcommon *new = NULL;
@@ -318,7 +318,7 @@ int cil_copy_classcommon(__attribute__((unused)) struct cil_db *db, void *data,
 	return SEPOL_OK;
 }
 
-int cil_copy_sid(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_sid(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_sid *orig = data;
 	char *key = orig->datum.name;
@@ -336,7 +336,7 @@ int cil_copy_sid(__attribute__((unused)) struct cil_db *db, void *data, void **c
 	return SEPOL_OK;
 }
 
-int cil_copy_sidcontext(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_sidcontext(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_sidcontext *orig = data;
 	struct cil_sidcontext *new = NULL;
@@ -355,7 +355,7 @@ int cil_copy_sidcontext(struct cil_db *db, void *data, void **copy, __attribute_
 	return SEPOL_OK;
 }
 
-int cil_copy_sidorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_sidorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_sidorder *orig = data;
 	struct cil_sidorder *new = NULL;
@@ -370,7 +370,7 @@ int cil_copy_sidorder(__attribute__((unused)) struct cil_db *db, void *data, voi
 	return SEPOL_OK;
 }
 
-int cil_copy_user(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_user(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_user *orig = data;
 	char *key = orig->datum.name;
@@ -388,7 +388,7 @@ int cil_copy_user(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_userrole(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_userrole(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_userrole *orig = data;
 	struct cil_userrole *new = NULL;
@@ -403,7 +403,7 @@ int cil_copy_userrole(__attribute__((unused)) struct cil_db *db, void *data, voi
 	return SEPOL_OK;
 }
 
-int cil_copy_userlevel(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_userlevel(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_userlevel *orig = data;
 	struct cil_userlevel *new = NULL;
@@ -423,7 +423,7 @@ int cil_copy_userlevel(struct cil_db *db, void *data, void **copy, __attribute__
 	return SEPOL_OK;
 }
 
-int cil_copy_userrange(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_userrange(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_userrange *orig = data;
 	struct cil_userrange *new = NULL;
@@ -444,7 +444,7 @@ int cil_copy_userrange(struct cil_db *db, void *data, void **copy, __attribute__
 	return SEPOL_OK;
 }
 
-int cil_copy_userprefix(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_userprefix(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_userprefix *orig = data;
 	struct cil_userprefix *new = NULL;
@@ -459,7 +459,7 @@ int cil_copy_userprefix(__attribute__((unused)) struct cil_db *db, void *data, v
 	return SEPOL_OK;
 }
 
-int cil_copy_role(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_role(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_role *orig = data;
 	char *key = orig->datum.name;
@@ -477,7 +477,7 @@ int cil_copy_role(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_roletype(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_roletype(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_roletype *orig = data;
 	struct cil_roletype *new = NULL;
@@ -492,7 +492,7 @@ int cil_copy_roletype(__attribute__((unused)) struct cil_db *db, void *data, voi
 	return SEPOL_OK;
 }
 
-int cil_copy_roleattribute(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_roleattribute(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_roleattribute *orig = data;
 	char *key = orig->datum.name;
@@ -510,7 +510,7 @@ int cil_copy_roleattribute(__attribute__((unused)) struct cil_db *db, void *data
 	return SEPOL_OK;
 }
 
-int cil_copy_roleattributeset(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_roleattributeset(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_roleattributeset *orig = data;
 	struct cil_roleattributeset *new = NULL;
@@ -527,7 +527,7 @@ int cil_copy_roleattributeset(struct cil_db *db, void *data, void **copy, __attr
 	return SEPOL_OK;
 }
 
-int cil_copy_roleallow(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_roleallow(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_roleallow *orig = data;
 	struct cil_roleallow *new = NULL;
@@ -542,7 +542,7 @@ int cil_copy_roleallow(__attribute__((unused)) struct cil_db *db, void *data, vo
 	return SEPOL_OK;
 }
 
-int cil_copy_type(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_type(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_type *orig = data;
 	char *key = orig->datum.name;
@@ -560,7 +560,7 @@ int cil_copy_type(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_typepermissive(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_typepermissive(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_typepermissive *orig = data;
 	struct cil_typepermissive *new = NULL;
@@ -574,7 +574,7 @@ int cil_copy_typepermissive(__attribute__((unused)) struct cil_db *db, void *dat
 	return SEPOL_OK;
 }
 
-int cil_copy_typeattribute(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_typeattribute(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_typeattribute *orig = data;
 	char *key = orig->datum.name;
@@ -592,7 +592,7 @@ int cil_copy_typeattribute(__attribute__((unused)) struct cil_db *db, void *data
 	return SEPOL_OK;
 }
 
-int cil_copy_typeattributeset(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_typeattributeset(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_typeattributeset *orig = data;
 	struct cil_typeattributeset *new = NULL;
@@ -609,7 +609,7 @@ int cil_copy_typeattributeset(struct cil_db *db, void *data, void **copy, __attr
 	return SEPOL_OK;
 }
 
-int cil_copy_alias(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_alias(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_alias *orig = data;
 	struct cil_alias *new = NULL;
@@ -629,7 +629,7 @@ int cil_copy_alias(__attribute__((unused)) struct cil_db *db, void *data, void *
 	return SEPOL_OK;
 }
 
-int cil_copy_aliasactual(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused))symtab_t *symtab)
+int cil_copy_aliasactual(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused))struct cil_symtab *symtab)
 {
 	struct cil_aliasactual *orig = data;
 	struct cil_aliasactual *new = NULL;
@@ -644,7 +644,7 @@ int cil_copy_aliasactual(__attribute__((unused)) struct cil_db *db, void *data,
 	return SEPOL_OK;
 }
 
-int cil_copy_roletransition(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_roletransition(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_roletransition *orig = data;
 	struct cil_roletransition *new = NULL;
@@ -661,7 +661,7 @@ int cil_copy_roletransition(__attribute__((unused)) struct cil_db *db, void *dat
 	return SEPOL_OK;
 }
 
-int cil_copy_nametypetransition(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_nametypetransition(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_nametypetransition *orig = data;
 	struct cil_nametypetransition *new = NULL;
@@ -680,7 +680,7 @@ int cil_copy_nametypetransition(__attribute__((unused)) struct cil_db *db, void
 	return SEPOL_OK;
 }
 
-int cil_copy_rangetransition(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_rangetransition(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_rangetransition *orig = data;
 	struct cil_rangetransition *new = NULL;
@@ -703,7 +703,7 @@ int cil_copy_rangetransition(struct cil_db *db, void *data, void **copy, __attri
 	return SEPOL_OK;
 }
 
-int cil_copy_bool(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_bool(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_bool *orig = data;
 	struct cil_bool *new = NULL;
@@ -723,7 +723,7 @@ int cil_copy_bool(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_tunable(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_tunable(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_tunable *orig = data;
 	struct cil_tunable *new = NULL;
@@ -743,7 +743,7 @@ int cil_copy_tunable(__attribute__((unused)) struct cil_db *db, void *data, void
 	return SEPOL_OK;
 }
 
-int cil_copy_avrule(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_avrule(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_avrule *orig = data;
 	struct cil_avrule *new = NULL;
@@ -760,7 +760,7 @@ int cil_copy_avrule(__attribute__((unused)) struct cil_db *db, void *data, void
 	return SEPOL_OK;
 }
 
-int cil_copy_type_rule(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_type_rule(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_type_rule  *orig = data;
 	struct cil_type_rule *new = NULL;
@@ -778,7 +778,7 @@ int cil_copy_type_rule(__attribute__((unused)) struct cil_db *db, void *data, vo
 	return SEPOL_OK;
 }
 
-int cil_copy_sens(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_sens(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_sens *orig = data;
 	char *key = orig->datum.name;
@@ -796,7 +796,7 @@ int cil_copy_sens(__attribute__((unused)) struct cil_db *db, void *data, void **
 	return SEPOL_OK;
 }
 
-int cil_copy_cat(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_cat(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_cat *orig = data;
 	char *key = orig->datum.name;
@@ -821,7 +821,7 @@ void cil_copy_cats(struct cil_db *db, struct cil_cats *orig, struct cil_cats **n
 	cil_copy_expr(db, orig->datum_expr, &(*new)->datum_expr);
 }
 
-int cil_copy_catset(struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_catset(struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_catset *orig = data;
 	struct cil_catset *new = NULL;
@@ -843,7 +843,7 @@ int cil_copy_catset(struct cil_db *db, void *data, void **copy, symtab_t *symtab
 	return SEPOL_OK;
 }
 
-int cil_copy_senscat(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_senscat(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_senscat *orig = data;
 	struct cil_senscat *new = NULL;
@@ -859,7 +859,7 @@ int cil_copy_senscat(struct cil_db *db, void *data, void **copy, __attribute__((
 	return SEPOL_OK;
 }
 
-int cil_copy_catorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_catorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_catorder *orig = data;
 	struct cil_catorder *new = NULL;
@@ -874,7 +874,7 @@ int cil_copy_catorder(__attribute__((unused)) struct cil_db *db, void *data, voi
 	return SEPOL_OK;
 }
 
-int cil_copy_sensitivityorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_sensitivityorder(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_sensorder *orig = data;
 	struct cil_sensorder *new = NULL;
@@ -900,7 +900,7 @@ void cil_copy_fill_level(struct cil_db *db, struct cil_level *orig, struct cil_l
 	}
 }
 
-int cil_copy_level(struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_level(struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_level *orig = data;
 	struct cil_level *new = NULL;
@@ -937,7 +937,7 @@ void cil_copy_fill_levelrange(struct cil_db *db, struct cil_levelrange *data, st
 	}
 }
 
-int cil_copy_levelrange(struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_levelrange(struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_levelrange *orig = data;
 	struct cil_levelrange *new = NULL;
@@ -974,7 +974,7 @@ void cil_copy_fill_context(struct cil_db *db, struct cil_context *data, struct c
 	}
 }
 
-int cil_copy_context(struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_context(struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_context *orig = data;
 	struct cil_context *new = NULL;
@@ -997,7 +997,7 @@ int cil_copy_context(struct cil_db *db, void *data, void **copy, symtab_t *symta
 	return SEPOL_OK;
 }
 
-int cil_copy_netifcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_netifcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_netifcon *orig = data;
 	struct cil_netifcon *new = NULL;
@@ -1025,7 +1025,7 @@ int cil_copy_netifcon(struct cil_db *db, void *data, void **copy, __attribute__(
 	return SEPOL_OK;
 }
 
-int cil_copy_genfscon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_genfscon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_genfscon *orig = data;
 	struct cil_genfscon *new = NULL;
@@ -1047,7 +1047,7 @@ int cil_copy_genfscon(struct cil_db *db, void *data, void **copy, __attribute__(
 	return SEPOL_OK;
 }
 
-int cil_copy_filecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_filecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_filecon *orig = data;
 	struct cil_filecon *new = NULL;
@@ -1069,7 +1069,7 @@ int cil_copy_filecon(struct cil_db *db, void *data, void **copy, __attribute__((
 	return SEPOL_OK;
 }
 
-int cil_copy_nodecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_nodecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_nodecon *orig = data;
 	struct cil_nodecon *new = NULL;
@@ -1102,7 +1102,7 @@ int cil_copy_nodecon(struct cil_db *db, void *data, void **copy, __attribute__((
 	return SEPOL_OK;
 }
 
-int cil_copy_portcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_portcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_portcon *orig = data;
 	struct cil_portcon *new = NULL;
@@ -1125,7 +1125,7 @@ int cil_copy_portcon(struct cil_db *db, void *data, void **copy, __attribute__((
 	return SEPOL_OK;
 }
 
-int cil_copy_pirqcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_pirqcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_pirqcon *orig = data;
 	struct cil_pirqcon *new = NULL;
@@ -1146,7 +1146,7 @@ int cil_copy_pirqcon(struct cil_db *db, void *data, void **copy, __attribute__((
 	return SEPOL_OK;
 }
 
-int cil_copy_iomemcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_iomemcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_iomemcon *orig = data;
 	struct cil_iomemcon *new = NULL;
@@ -1168,7 +1168,7 @@ int cil_copy_iomemcon(struct cil_db *db, void *data, void **copy, __attribute__(
 	return SEPOL_OK;
 }
 
-int cil_copy_ioportcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_ioportcon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_ioportcon *orig = data;
 	struct cil_ioportcon *new = NULL;
@@ -1190,7 +1190,7 @@ int cil_copy_ioportcon(struct cil_db *db, void *data, void **copy, __attribute__
 	return SEPOL_OK;
 }
 
-int cil_copy_pcidevicecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_pcidevicecon(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_pcidevicecon *orig = data;
 	struct cil_pcidevicecon *new = NULL;
@@ -1211,7 +1211,7 @@ int cil_copy_pcidevicecon(struct cil_db *db, void *data, void **copy, __attribut
 	return SEPOL_OK;
 }
 
-int cil_copy_fsuse(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_fsuse(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_fsuse *orig = data;
 	struct cil_fsuse *new = NULL;
@@ -1274,7 +1274,7 @@ int cil_copy_expr(struct cil_db *db, struct cil_list *orig, struct cil_list **ne
 	return SEPOL_OK;
 }
 
-int cil_copy_constrain(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_constrain(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_constrain *orig = data;
 	struct cil_constrain *new = NULL;
@@ -1290,7 +1290,7 @@ int cil_copy_constrain(struct cil_db *db, void *data, void **copy, __attribute__
 	return SEPOL_OK;
 }
 
-int cil_copy_validatetrans(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_validatetrans(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_validatetrans *orig = data;
 	struct cil_validatetrans *new = NULL;
@@ -1307,23 +1307,18 @@ int cil_copy_validatetrans(struct cil_db *db, void *data, void **copy, __attribu
 	return SEPOL_OK;
 }
 
-int cil_copy_call(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_call(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_call *orig = data;
 	struct cil_call *new = NULL;
-	int rc = SEPOL_ERR;
 
 	cil_call_init(&new);
 
 	new->macro_str = orig->macro_str;
 	new->macro = orig->macro;
 
-	if (orig->args_tree != NULL) {
-		cil_tree_init(&new->args_tree);
-		rc = cil_copy_ast(db, orig->args_tree->root, new->args_tree->root);
-		if (rc != SEPOL_OK) {
-			goto exit;
-		}
+	if (orig->args_tokens != NULL) {
+		new->args_tokens = cil_parse_token_copy(orig->args_tokens);
 	}
 	
 	new->copied = orig->copied;
@@ -1331,13 +1326,9 @@ int cil_copy_call(struct cil_db *db, void *data, void **copy, __attribute__((unu
 	*copy = new;
 
 	return SEPOL_OK;
-
-exit:
-	cil_destroy_call(new);
-	return rc;
 }
 
-int cil_copy_macro(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_macro(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_macro *orig = data;
 	char *key = orig->datum.name;
@@ -1402,7 +1393,7 @@ exit:
 	return SEPOL_ERR;
 }
 
-int cil_copy_optional(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_optional(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_optional *orig = data;
 	char *key = orig->datum.name;
@@ -1426,7 +1417,7 @@ void cil_copy_fill_ipaddr(struct cil_ipaddr *data, struct cil_ipaddr *new)
 	memcpy(&new->ip, &data->ip, sizeof(data->ip));
 }
 
-int cil_copy_ipaddr(__attribute__((unused)) struct cil_db *db, void *data, void **copy, symtab_t *symtab)
+int cil_copy_ipaddr(__attribute__((unused)) struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab)
 {
 	struct cil_ipaddr *orig = data;
 	struct cil_ipaddr *new = NULL;
@@ -1447,7 +1438,7 @@ int cil_copy_ipaddr(__attribute__((unused)) struct cil_db *db, void *data, void
 	return SEPOL_OK;
 }
 
-int cil_copy_condblock(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_condblock(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_condblock *orig = data;
 	struct cil_condblock *new = *copy;
@@ -1458,7 +1449,7 @@ int cil_copy_condblock(__attribute__((unused)) struct cil_db *db, void *data, vo
 	return SEPOL_OK;
 }
 
-int cil_copy_boolif(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_boolif(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_booleanif *orig = data;
 	struct cil_booleanif *new = NULL;
@@ -1474,7 +1465,7 @@ int cil_copy_boolif(struct cil_db *db, void *data, void **copy, __attribute__((u
 	return SEPOL_OK;
 }
 
-int cil_copy_tunif(struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_tunif(struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_tunableif *orig = data;
 	struct cil_tunableif *new = NULL;
@@ -1489,7 +1480,7 @@ int cil_copy_tunif(struct cil_db *db, void *data, void **copy, __attribute__((un
 	return SEPOL_OK;
 }
 
-int cil_copy_default(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_default(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_default *orig = data;
 	struct cil_default *new = NULL;
@@ -1509,7 +1500,7 @@ int cil_copy_default(__attribute__((unused)) struct cil_db *db, void *data, void
 	return SEPOL_OK;
 }
 
-int cil_copy_defaultrange(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_defaultrange(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_defaultrange *orig = data;
 	struct cil_defaultrange *new = NULL;
@@ -1527,7 +1518,7 @@ int cil_copy_defaultrange(__attribute__((unused)) struct cil_db *db, void *data,
 	return SEPOL_OK;
 }
 
-int cil_copy_handleunknown(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_handleunknown(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_handleunknown *orig = data;
 	struct cil_handleunknown *new = NULL;
@@ -1539,7 +1530,7 @@ int cil_copy_handleunknown(__attribute__((unused)) struct cil_db *db, void *data
 	return SEPOL_OK;
 }
 
-int cil_copy_mls(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_mls(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_mls *orig = data;
 	struct cil_mls *new = NULL;
@@ -1551,7 +1542,7 @@ int cil_copy_mls(__attribute__((unused)) struct cil_db *db, void *data, void **c
 	return SEPOL_OK;
 }
 
-int cil_copy_bounds(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) symtab_t *symtab)
+int cil_copy_bounds(__attribute__((unused)) struct cil_db *db, void *data, void **copy, __attribute__((unused)) struct cil_symtab *symtab)
 {
 	struct cil_bounds *orig = data;
 	struct cil_bounds *new = NULL;
@@ -1576,9 +1567,9 @@ int __cil_copy_node_helper(struct cil_tree_node *orig, __attribute__((unused)) u
 	struct cil_tree_node *namespace = NULL;
 	struct cil_param *param = NULL;
 	enum cil_sym_index sym_index = CIL_SYM_UNKNOWN;
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	void *data = NULL;
-	int (*copy_func)(struct cil_db *db, void *data, void **copy, symtab_t *symtab) = NULL;
+	int (*copy_func)(struct cil_db *db, void *data, void **copy, struct cil_symtab *symtab) = NULL;
 	struct cil_blockinherit *blockinherit = NULL;
 
 	if (orig == NULL || extra_args == NULL) {
@@ -1849,9 +1840,8 @@ int __cil_copy_node_helper(struct cil_tree_node *orig, __attribute__((unused)) u
 	if (rc == SEPOL_OK) {
 		cil_tree_node_init(&new);
 
-		new->parent = parent;
-		new->line = orig->line;
-		new->path = orig->path;
+		cil_tree_node_set_parent(new, parent);
+		new->loc = orig->loc;
 		new->flavor = orig->flavor;
 		new->data = data;
 
@@ -1860,7 +1850,7 @@ int __cil_copy_node_helper(struct cil_tree_node *orig, __attribute__((unused)) u
 
 			namespace = new;
 			while (namespace->flavor != CIL_MACRO && namespace->flavor != CIL_BLOCK && namespace->flavor != CIL_ROOT) {
-				namespace = namespace->parent;
+				namespace = cil_tree_node_parent(namespace);
 			}
 
 			if (namespace->flavor == CIL_MACRO) {
@@ -1872,8 +1862,8 @@ int __cil_copy_node_helper(struct cil_tree_node *orig, __attribute__((unused)) u
 						param = item->data;
 						if (param->flavor == new->flavor) {
 							if (param->str == ((struct cil_symtab_datum*)new->data)->name) {
-								cil_log(CIL_ERR, "%s %s shadows a macro parameter (%s line:%d)\n", cil_node_to_string(new), ((struct cil_symtab_datum*)orig->data)->name, orig->path, orig->line);
-								cil_log(CIL_ERR, "Note: macro declaration (%s line:%d)\n", namespace->path, namespace->line);
+								cil_log(CIL_ERR, "%s %s shadows a macro parameter (%s line:%d)\n", cil_node_to_string(new), ((struct cil_symtab_datum*)orig->data)->name, cil_tree_node_path(orig), cil_tree_node_line(orig));
+								cil_log(CIL_ERR, "Note: macro declaration (%s line:%d)\n", cil_tree_node_path(namespace), cil_tree_node_line(namespace));
 								rc = SEPOL_ERR;
 								goto exit;
 							}
@@ -1888,15 +1878,15 @@ int __cil_copy_node_helper(struct cil_tree_node *orig, __attribute__((unused)) u
 			cil_list_append(blockinherit->block->bi_nodes, CIL_NODE, new);
 		}
 
-		if (parent->cl_head == NULL) {
-			parent->cl_head = new;
-			parent->cl_tail = new;
+		if (cil_tree_node_head(parent) == NULL) {
+			cil_tree_node_set_head(parent, new);
+			cil_tree_node_set_tail(parent, new);
 		} else {
-			parent->cl_tail->next = new;
-			parent->cl_tail = new;
+			cil_tree_node_set_next(cil_tree_node_tail(parent), new);
+			cil_tree_node_set_tail(parent, new);
 		}
 
-		if (orig->cl_head != NULL) {
+		if (cil_tree_node_head(orig) != NULL) {
 			args->dest = new;
 		}
 	} else {
@@ -1919,7 +1909,7 @@ int __cil_copy_last_child_helper(__attribute__((unused)) struct cil_tree_node *o
 	node = args->dest;
 
 	if (node->flavor != CIL_ROOT) {
-		args->dest = node->parent;
+		args->dest = cil_tree_node_parent(node);
 	}
 
 	return SEPOL_OK;
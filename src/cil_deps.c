@@ -0,0 +1,559 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sepol/errcodes.h>
+#include <sepol/policydb/hashtab.h>
+
+#include "cil_internal.h"
+#include "cil_flavor.h"
+#include "cil_list.h"
+#include "cil_log.h"
+#include "cil_mem.h"
+#include "cil_reset_ast.h"
+#include "cil_tree.h"
+#include "cil_vector.h"
+#include "cil_deps.h"
+
+#define CIL_DEPS_TABLE_SIZE	(1 << 16)
+
+#define CIL_DEPS_RESET	1
+#define CIL_DEPS_GONE	2
+
+struct cil_args_deps {
+	struct cil_deps *deps;
+	struct cil_vector work;
+	struct cil_vector dirty;
+	struct cil_vector resets;
+	struct cil_vector gone;
+	struct cil_vector marked;
+	struct cil_vector roots;
+	uint32_t reorder;
+};
+
+static unsigned int __cil_deps_ptr_hash(hashtab_t h, hashtab_key_t key)
+{
+	uintptr_t val = (uintptr_t)key;
+
+	return (unsigned int)((val >> 3) ^ (val >> 15)) & (h->size - 1);
+}
+
+static int __cil_deps_ptr_compare(hashtab_t h __attribute__ ((unused)), hashtab_key_t key1, hashtab_key_t key2)
+{
+	if (key1 == key2) {
+		return 0;
+	}
+
+	return ((uintptr_t)key1 < (uintptr_t)key2) ? -1 : 1;
+}
+
+static hashtab_t __cil_deps_table_create(void)
+{
+	hashtab_t table = hashtab_create(__cil_deps_ptr_hash, __cil_deps_ptr_compare, CIL_DEPS_TABLE_SIZE);
+
+	if (table == NULL) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+
+	return table;
+}
+
+static void __cil_deps_table_insert(hashtab_t table, void *key, void *data)
+{
+	if (hashtab_insert(table, (hashtab_key_t)key, (hashtab_datum_t)data) != SEPOL_OK) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+}
+
+static void __cil_deps_stmt_destroy(struct cil_deps_stmt *stmt)
+{
+	cil_vector_destroy(&stmt->uses);
+	cil_vector_destroy(&stmt->mutates);
+	cil_vector_destroy(&stmt->marks);
+	free(stmt);
+}
+
+static void __cil_deps_decl_destroy(struct cil_deps_decl *decl)
+{
+	cil_vector_destroy(&decl->users);
+	free(decl);
+}
+
+static int __cil_deps_stmt_destroy_helper(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, __attribute__((unused)) void *args)
+{
+	__cil_deps_stmt_destroy(d);
+
+	return SEPOL_OK;
+}
+
+static int __cil_deps_decl_destroy_helper(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, __attribute__((unused)) void *args)
+{
+	__cil_deps_decl_destroy(d);
+
+	return SEPOL_OK;
+}
+
+static void __cil_deps_stmt_remove_helper(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, __attribute__((unused)) void *args)
+{
+	__cil_deps_stmt_destroy(d);
+}
+
+static void __cil_deps_decl_remove_helper(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, __attribute__((unused)) void *args)
+{
+	__cil_deps_decl_destroy(d);
+}
+
+void cil_deps_init(struct cil_deps **deps)
+{
+	struct cil_deps *new_deps = cil_malloc(sizeof(*new_deps));
+
+	new_deps->stmts = __cil_deps_table_create();
+	new_deps->decls = __cil_deps_table_create();
+	new_deps->count = 0;
+	new_deps->last = NULL;
+	cil_vector_init(&new_deps->orders);
+
+	*deps = new_deps;
+}
+
+void cil_deps_destroy(struct cil_deps **deps)
+{
+	if (deps == NULL || *deps == NULL) {
+		return;
+	}
+
+	hashtab_map((*deps)->stmts, __cil_deps_stmt_destroy_helper, NULL);
+	hashtab_destroy((*deps)->stmts);
+	hashtab_map((*deps)->decls, __cil_deps_decl_destroy_helper, NULL);
+	hashtab_destroy((*deps)->decls);
+	cil_vector_destroy(&(*deps)->orders);
+	free(*deps);
+	*deps = NULL;
+}
+
+static int __cil_deps_is_order(struct cil_tree_node *node)
+{
+	switch (node->flavor) {
+	case CIL_SIDORDER:
+	case CIL_CLASSORDER:
+	case CIL_CATORDER:
+	case CIL_SENSITIVITYORDER:
+		return CIL_TRUE;
+	default:
+		return CIL_FALSE;
+	}
+}
+
+/* Number a node. Called for every node in tree order before any of them
+ * is resolved by a tracked pass. */
+void cil_deps_add_node(struct cil_deps *deps, struct cil_tree_node *node)
+{
+	struct cil_deps_stmt *stmt = cil_malloc(sizeof(*stmt));
+
+	stmt->node = node;
+	stmt->order = deps->count++;
+	stmt->dirty = CIL_FALSE;
+	cil_vector_init(&stmt->uses);
+	cil_vector_init(&stmt->mutates);
+	cil_vector_init(&stmt->marks);
+
+	__cil_deps_table_insert(deps->stmts, node, stmt);
+
+	if (__cil_deps_is_order(node)) {
+		cil_vector_append(&deps->orders, node);
+	}
+}
+
+static struct cil_deps_stmt *__cil_deps_stmt(struct cil_deps *deps, struct cil_tree_node *node)
+{
+	struct cil_deps_stmt *stmt = deps->last;
+
+	if (stmt != NULL && stmt->node == node) {
+		return stmt;
+	}
+
+	stmt = hashtab_search(deps->stmts, (hashtab_key_t)node);
+	if (stmt != NULL) {
+		deps->last = stmt;
+	}
+
+	return stmt;
+}
+
+static struct cil_deps_decl *__cil_deps_decl(struct cil_deps *deps, struct cil_symtab_datum *datum)
+{
+	struct cil_deps_decl *decl = hashtab_search(deps->decls, (hashtab_key_t)datum);
+
+	if (decl == NULL) {
+		decl = cil_malloc(sizeof(*decl));
+		cil_vector_init(&decl->users);
+		decl->state = CIL_FALSE;
+		__cil_deps_table_insert(deps->decls, datum, decl);
+	}
+
+	return decl;
+}
+
+static void __cil_deps_add_user(struct cil_deps_decl *decl, struct cil_tree_node *node)
+{
+	if (decl->users.count == 0 || cil_vector_get(&decl->users, decl->users.count - 1) != node) {
+		cil_vector_append(&decl->users, node);
+	}
+}
+
+void cil_deps_use(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum)
+{
+	struct cil_deps_stmt *stmt = __cil_deps_stmt(deps, node);
+	struct cil_deps_decl *decl = NULL;
+
+	if (stmt == NULL) {
+		return;
+	}
+
+	cil_vector_append(&stmt->uses, datum);
+
+	decl = __cil_deps_decl(deps, datum);
+	__cil_deps_add_user(decl, node);
+}
+
+void cil_deps_mutate(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum)
+{
+	struct cil_deps_stmt *stmt = __cil_deps_stmt(deps, node);
+	struct cil_deps_decl *decl = NULL;
+
+	if (stmt == NULL) {
+		return;
+	}
+
+	cil_vector_append(&stmt->mutates, datum);
+
+	/* Resetting the declaration undoes every statement that filled it */
+	decl = __cil_deps_decl(deps, datum);
+	__cil_deps_add_user(decl, node);
+}
+
+void cil_deps_mark(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum)
+{
+	struct cil_deps_stmt *stmt = __cil_deps_stmt(deps, node);
+
+	if (stmt == NULL) {
+		return;
+	}
+
+	cil_vector_append(&stmt->marks, datum);
+}
+
+/* A node goes away with the optionals being disabled if it is in one */
+int cil_deps_doomed(struct cil_tree_node *node)
+{
+	for (node = cil_tree_node_parent(node); node != NULL; node = cil_tree_node_parent(node)) {
+		if (node->flavor == CIL_OPTIONAL && ((struct cil_optional *)node->data)->enabled == CIL_FALSE) {
+			return CIL_TRUE;
+		}
+	}
+
+	return CIL_FALSE;
+}
+
+static int __cil_deps_gone(struct cil_symtab_datum *datum)
+{
+	struct cil_tree_node *node = NULL;
+	uint32_t i;
+
+	cil_vector_for_each(node, i, &datum->nodes) {
+		if (!cil_deps_doomed(node)) {
+			return CIL_FALSE;
+		}
+	}
+
+	return CIL_TRUE;
+}
+
+static void __cil_deps_dirty(struct cil_args_deps *args, struct cil_tree_node *node)
+{
+	struct cil_deps_stmt *stmt = hashtab_search(args->deps->stmts, (hashtab_key_t)node);
+
+	if (stmt == NULL || stmt->dirty || cil_deps_doomed(node)) {
+		return;
+	}
+
+	stmt->dirty = CIL_TRUE;
+	cil_vector_append(&args->work, stmt);
+	cil_vector_append(&args->dirty, stmt);
+
+	if (__cil_deps_is_order(node)) {
+		args->reorder = CIL_TRUE;
+	}
+}
+
+static void __cil_deps_dirty_users(struct cil_args_deps *args, struct cil_deps_decl *decl)
+{
+	struct cil_tree_node *user = NULL;
+	uint32_t i;
+
+	cil_vector_for_each(user, i, &decl->users) {
+		__cil_deps_dirty(args, user);
+	}
+}
+
+/* Everything added to a declaration is undone together, so everything
+ * that added to it or read it has to be resolved again */
+static void __cil_deps_reset(struct cil_args_deps *args, struct cil_symtab_datum *datum)
+{
+	struct cil_deps_decl *decl = NULL;
+	struct cil_tree_node *node = NULL;
+	uint32_t i;
+
+	if (__cil_deps_gone(datum)) {
+		return;
+	}
+
+	decl = __cil_deps_decl(args->deps, datum);
+	if (decl->state != CIL_FALSE) {
+		return;
+	}
+
+	decl->state = CIL_DEPS_RESET;
+	cil_vector_append(&args->resets, datum);
+
+	__cil_deps_dirty_users(args, decl);
+	cil_vector_for_each(node, i, &datum->nodes) {
+		__cil_deps_dirty(args, node);
+	}
+}
+
+static void __cil_deps_undo(struct cil_args_deps *args, struct cil_deps_stmt *stmt)
+{
+	struct cil_symtab_datum *datum = NULL;
+	uint32_t i;
+
+	cil_vector_for_each(datum, i, &stmt->mutates) {
+		__cil_deps_reset(args, datum);
+	}
+}
+
+static int __cil_deps_doomed_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+{
+	struct cil_args_deps *args = extra_args;
+	struct cil_deps *deps = args->deps;
+	struct cil_deps_stmt *stmt = hashtab_search(deps->stmts, (hashtab_key_t)node);
+
+	if (stmt != NULL) {
+		struct cil_symtab_datum *datum = NULL;
+		uint32_t i;
+
+		__cil_deps_undo(args, stmt);
+		cil_vector_for_each(datum, i, &stmt->marks) {
+			cil_vector_append(&args->marked, datum);
+		}
+
+		if (__cil_deps_is_order(node)) {
+			cil_vector_remove(&deps->orders, node);
+			args->reorder = CIL_TRUE;
+		}
+
+		if (deps->last == stmt) {
+			deps->last = NULL;
+		}
+		hashtab_remove(deps->stmts, (hashtab_key_t)node, __cil_deps_stmt_remove_helper, NULL);
+	}
+
+	if (node->flavor >= CIL_MIN_DECLARATIVE) {
+		struct cil_symtab_datum *datum = node->data;
+		struct cil_deps_decl *decl = hashtab_search(deps->decls, (hashtab_key_t)datum);
+
+		if (decl != NULL && decl->state != CIL_DEPS_GONE && __cil_deps_gone(datum)) {
+			decl->state = CIL_DEPS_GONE;
+			cil_vector_append(&args->gone, datum);
+			__cil_deps_dirty_users(args, decl);
+		}
+	}
+
+	return SEPOL_OK;
+}
+
+/* An attribute marked by statements that went away or are resolved again
+ * stays used only if another statement marked it. The ones resolved again
+ * mark it again. */
+static void __cil_deps_recheck_used(struct cil_deps *deps, struct cil_symtab_datum *datum)
+{
+	struct cil_typeattribute *attr = (struct cil_typeattribute *)datum;
+	struct cil_deps_decl *decl = hashtab_search(deps->decls, (hashtab_key_t)datum);
+	struct cil_tree_node *user = NULL;
+	uint32_t i, j;
+
+	if (decl == NULL || decl->state != CIL_FALSE || FLAVOR(datum) != CIL_TYPEATTRIBUTE) {
+		return;
+	}
+
+	attr->used = CIL_FALSE;
+	cil_vector_for_each(user, i, &decl->users) {
+		struct cil_deps_stmt *stmt = hashtab_search(deps->stmts, (hashtab_key_t)user);
+		struct cil_symtab_datum *marked = NULL;
+		if (stmt == NULL) {
+			continue;
+		}
+		cil_vector_for_each(marked, j, &stmt->marks) {
+			if (marked == datum) {
+				attr->used = CIL_TRUE;
+				return;
+			}
+		}
+	}
+}
+
+static int __cil_deps_order_compare(const void *a, const void *b)
+{
+	const struct cil_deps_stmt *sa = *(struct cil_deps_stmt * const *)a;
+	const struct cil_deps_stmt *sb = *(struct cil_deps_stmt * const *)b;
+
+	if (sa->order == sb->order) {
+		return 0;
+	}
+
+	return sa->order < sb->order ? -1 : 1;
+}
+
+/* Destroy the contents of the disabled optionals and undo what depended on
+ * the declarations in them. The statements that have to be resolved again
+ * are returned in tree order. reorder is set if the ordering statements
+ * have to be merged again; all of them are returned then. */
+int cil_deps_disable(struct cil_deps *deps, struct cil_list *optionals, struct cil_vector *dirty, uint32_t *reorder)
+{
+	int rc = SEPOL_ERR;
+	struct cil_args_deps args;
+	struct cil_list_item *item = NULL;
+	struct cil_tree_node *node = NULL;
+	struct cil_symtab_datum *datum = NULL;
+	struct cil_deps_stmt *stmt = NULL;
+	uint32_t i;
+
+	args.deps = deps;
+	cil_vector_init(&args.work);
+	cil_vector_init(&args.dirty);
+	cil_vector_init(&args.resets);
+	cil_vector_init(&args.gone);
+	cil_vector_init(&args.marked);
+	cil_vector_init(&args.roots);
+	args.reorder = CIL_FALSE;
+
+	/* Optionals in ones being disabled go away with them */
+	cil_list_for_each(item, optionals) {
+		struct cil_optional *opt = item->data;
+		cil_vector_for_each(node, i, &opt->datum.nodes) {
+			if (!cil_deps_doomed(node)) {
+				cil_vector_append(&args.roots, node);
+			}
+		}
+	}
+
+	cil_vector_for_each(node, i, &args.roots) {
+		rc = cil_tree_walk(node, __cil_deps_doomed_helper, NULL, NULL, &args);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+	}
+
+	while (args.work.count > 0) {
+		stmt = cil_vector_get(&args.work, --args.work.count);
+		__cil_deps_undo(&args, stmt);
+	}
+
+	if (args.reorder) {
+		cil_vector_for_each(node, i, &deps->orders) {
+			__cil_deps_dirty(&args, node);
+		}
+	}
+
+	cil_vector_for_each(datum, i, &args.resets) {
+		uint32_t j;
+		cil_vector_for_each(node, j, &datum->nodes) {
+			if (!cil_deps_doomed(node)) {
+				cil_reset_node(node);
+				break;
+			}
+		}
+	}
+
+	cil_vector_for_each(stmt, i, &args.dirty) {
+		struct cil_deps_decl *decl = NULL;
+		uint32_t j;
+		node = stmt->node;
+		if (node->flavor >= CIL_MIN_DECLARATIVE) {
+			decl = hashtab_search(deps->decls, (hashtab_key_t)node->data);
+		}
+		/* Declarations being reset were reset once above */
+		if (decl == NULL || decl->state == CIL_FALSE) {
+			cil_reset_node(node);
+		}
+		cil_vector_for_each(datum, j, &stmt->marks) {
+			cil_vector_append(&args.marked, datum);
+		}
+		cil_vector_destroy(&stmt->uses);
+		cil_vector_destroy(&stmt->mutates);
+		cil_vector_destroy(&stmt->marks);
+	}
+
+	cil_vector_for_each(datum, i, &args.marked) {
+		__cil_deps_recheck_used(deps, datum);
+	}
+
+	cil_vector_for_each(datum, i, &args.resets) {
+		__cil_deps_decl(deps, datum)->state = CIL_FALSE;
+	}
+
+	cil_vector_for_each(datum, i, &args.gone) {
+		hashtab_remove(deps->decls, (hashtab_key_t)datum, __cil_deps_decl_remove_helper, NULL);
+	}
+
+	cil_vector_for_each(node, i, &args.roots) {
+		cil_tree_children_destroy(node);
+	}
+
+	qsort(cil_vector_data(&args.dirty), args.dirty.count, sizeof(stmt), __cil_deps_order_compare);
+	cil_vector_for_each(stmt, i, &args.dirty) {
+		stmt->dirty = CIL_FALSE;
+		cil_vector_append(dirty, stmt->node);
+	}
+
+	*reorder = args.reorder;
+
+	rc = SEPOL_OK;
+
+exit:
+	cil_vector_destroy(&args.work);
+	cil_vector_destroy(&args.dirty);
+	cil_vector_destroy(&args.resets);
+	cil_vector_destroy(&args.gone);
+	cil_vector_destroy(&args.marked);
+	cil_vector_destroy(&args.roots);
+	return rc;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2011 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#ifndef CIL_DEPS_H_
+#define CIL_DEPS_H_
+
+#include <stdint.h>
+
+#include <sepol/policydb/hashtab.h>
+
+#include "cil_symtab.h"
+#include "cil_tree.h"
+#include "cil_vector.h"
+
+struct cil_deps_stmt {
+	struct cil_tree_node *node;
+	uint32_t order;
+	uint32_t dirty;
+	struct cil_vector uses;		/* declarations its names resolved to */
+	struct cil_vector mutates;	/* declarations its resolution added to */
+	struct cil_vector marks;	/* type attributes it marked as used */
+};
+
+struct cil_deps_decl {
+	struct cil_vector users;	/* statements that resolved to or filled it */
+	uint32_t state;
+};
+
+/* What the resolution passes after CIL_PASS_CALL1 did with each node, so
+ * that disabling an optional only has to undo and resolve again the
+ * statements that depended on what it declared. The tree is no longer
+ * copied into by then, so it only shrinks and the order in which the nodes
+ * were numbered stays the tree order. */
+struct cil_deps {
+	hashtab_t stmts;
+	hashtab_t decls;
+	uint32_t count;
+	struct cil_deps_stmt *last;
+	struct cil_vector orders;
+};
+
+void cil_deps_init(struct cil_deps **deps);
+void cil_deps_destroy(struct cil_deps **deps);
+void cil_deps_add_node(struct cil_deps *deps, struct cil_tree_node *node);
+void cil_deps_use(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum);
+void cil_deps_mutate(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum);
+void cil_deps_mark(struct cil_deps *deps, struct cil_tree_node *node, struct cil_symtab_datum *datum);
+int cil_deps_doomed(struct cil_tree_node *node);
+int cil_deps_disable(struct cil_deps *deps, struct cil_list *optionals, struct cil_vector *dirty, uint32_t *reorder);
+
+#endif /* CIL_DEPS_H_ */
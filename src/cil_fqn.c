@@ -120,7 +120,7 @@ static int __cil_fqn_qualify_blocks(__attribute__((unused)) hashtab_key_t k, has
 
 exit:
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR,"Problem qualifying names in block at line %d of %s\n", child_args.node->line, child_args.node->path);
+		cil_log(CIL_ERR,"Problem qualifying names in block at line %d of %s\n", cil_tree_node_line(child_args.node), cil_tree_node_path(child_args.node));
 	}
 
 	return rc;
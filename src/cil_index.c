@@ -0,0 +1,231 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sepol/errcodes.h>
+
+#include "cil_internal.h"
+#include "cil_log.h"
+#include "cil_mem.h"
+#include "cil_tree.h"
+#include "cil_vector.h"
+#include "cil_index.h"
+
+struct cil_args_index {
+	struct cil_index *index;
+	struct cil_tree_node *boolif;
+};
+
+static int __cil_index_slot(enum cil_flavor flavor)
+{
+	if (flavor < CIL_INDEX_DECLARATIVE) {
+		return flavor;
+	} else if (flavor >= CIL_MIN_DECLARATIVE && flavor <= CIL_POLICYCAP) {
+		return CIL_INDEX_DECLARATIVE + flavor - CIL_MIN_DECLARATIVE;
+	}
+
+	return -1;
+}
+
+void cil_index_init(struct cil_index **index)
+{
+	struct cil_index *new_index = cil_malloc(sizeof(*new_index));
+	int i;
+
+	new_index->count = 0;
+	for (i = 0; i < CIL_INDEX_NUM; i++) {
+		new_index->lists[i].count = 0;
+		new_index->lists[i].alloc = 0;
+		new_index->lists[i].entries = NULL;
+	}
+
+	*index = new_index;
+}
+
+void cil_index_destroy(struct cil_index **index)
+{
+	int i;
+
+	if (index == NULL || *index == NULL) {
+		return;
+	}
+
+	for (i = 0; i < CIL_INDEX_NUM; i++) {
+		if ((*index)->lists[i].alloc != 0) {
+			free((*index)->lists[i].entries);
+		}
+	}
+
+	free(*index);
+	*index = NULL;
+}
+
+static void __cil_index_append(struct cil_index *index, struct cil_tree_node *node, struct cil_tree_node *boolif)
+{
+	struct cil_index_list *list = NULL;
+	struct cil_index_entry *entry = NULL;
+	int slot = __cil_index_slot(node->flavor);
+
+	if (slot < 0) {
+		return;
+	}
+
+	list = &index->lists[slot];
+	list->entries = cil_array_grow(list->entries, list->count, &list->alloc, sizeof(*list->entries), 16);
+
+	entry = &list->entries[list->count++];
+	entry->node = node;
+	entry->boolif = boolif;
+	entry->order = index->count++;
+}
+
+static int __cil_index_build_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args)
+{
+	struct cil_args_index *args = extra_args;
+
+	if (node->flavor == CIL_BLOCK) {
+		struct cil_block *blk = node->data;
+		if (blk->is_abstract == CIL_TRUE) {
+			/* Kept for the blocks inheriting it, but not its contents */
+			__cil_index_append(args->index, node, args->boolif);
+			*finished = CIL_TREE_SKIP_HEAD;
+			return SEPOL_OK;
+		}
+	} else if (node->flavor == CIL_MACRO) {
+		*finished = CIL_TREE_SKIP_HEAD;
+		return SEPOL_OK;
+	}
+
+	__cil_index_append(args->index, node, args->boolif);
+
+	if (node->flavor == CIL_BOOLEANIF && cil_tree_node_head(node) != NULL) {
+		args->boolif = node;
+	}
+
+	return SEPOL_OK;
+}
+
+static int __cil_index_build_last_child_helper(struct cil_tree_node *node, void *extra_args)
+{
+	struct cil_args_index *args = extra_args;
+
+	if (cil_tree_node_parent(node) == args->boolif) {
+		args->boolif = NULL;
+	}
+
+	return SEPOL_OK;
+}
+
+/* Rebuild the index from the tree under root, reusing the list storage.
+ * Lists borrowed from a snapshot are dropped instead. */
+int cil_index_build(struct cil_index *index, struct cil_tree_node *root)
+{
+	struct cil_args_index extra_args;
+	int i;
+
+	index->count = 0;
+	for (i = 0; i < CIL_INDEX_NUM; i++) {
+		index->lists[i].count = 0;
+		if (index->lists[i].alloc == 0) {
+			index->lists[i].entries = NULL;
+		}
+	}
+
+	extra_args.index = index;
+	extra_args.boolif = NULL;
+
+	return cil_tree_walk(root, __cil_index_build_helper, NULL, __cil_index_build_last_child_helper, &extra_args);
+}
+
+struct cil_index_list *cil_index_get(struct cil_index *index, enum cil_flavor flavor)
+{
+	int slot = __cil_index_slot(flavor);
+
+	if (slot < 0) {
+		return NULL;
+	}
+
+	return &index->lists[slot];
+}
+
+/* Call process_entry on every node of the given flavors, merging their lists
+ * so that the nodes are visited in tree order, as a tree walk would. */
+int cil_index_walk(struct cil_index *index, const enum cil_flavor *flavors, uint32_t num_flavors, int (*process_entry)(struct cil_index_entry *entry, void *extra_args), void *extra_args)
+{
+	int rc = SEPOL_ERR;
+	struct cil_index_list *lists[CIL_INDEX_MAX_WALK];
+	uint32_t pos[CIL_INDEX_MAX_WALK];
+	uint32_t num_lists = 0;
+	uint32_t i;
+
+	if (num_flavors > CIL_INDEX_MAX_WALK) {
+		cil_log(CIL_ERR, "Too many flavors for a single index walk\n");
+		goto exit;
+	}
+
+	for (i = 0; i < num_flavors; i++) {
+		struct cil_index_list *list = cil_index_get(index, flavors[i]);
+		if (list != NULL && list->count > 0) {
+			lists[num_lists] = list;
+			pos[num_lists] = 0;
+			num_lists++;
+		}
+	}
+
+	while (num_lists > 0) {
+		struct cil_index_entry *entry = NULL;
+		uint32_t next = 0;
+
+		for (i = 1; i < num_lists; i++) {
+			if (lists[i]->entries[pos[i]].order < lists[next]->entries[pos[next]].order) {
+				next = i;
+			}
+		}
+
+		entry = &lists[next]->entries[pos[next]];
+		rc = (*process_entry)(entry, extra_args);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+
+		pos[next]++;
+		if (pos[next] == lists[next]->count) {
+			num_lists--;
+			lists[next] = lists[num_lists];
+			pos[next] = pos[num_lists];
+		}
+	}
+
+	rc = SEPOL_OK;
+
+exit:
+	return rc;
+}
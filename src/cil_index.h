@@ -0,0 +1,74 @@
+/*
+ * Copyright 2011 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#ifndef CIL_INDEX_H_
+#define CIL_INDEX_H_
+
+#include <stdint.h>
+
+#include "cil_flavor.h"
+#include "cil_tree.h"
+
+/* Statement flavors are numbered from 0 up to CIL_MLS and from
+ * CIL_MIN_DECLARATIVE up to CIL_POLICYCAP. Operator flavors never appear
+ * in the AST and have no list. */
+#define CIL_INDEX_DECLARATIVE	(CIL_MLS + 1)
+#define CIL_INDEX_NUM		(CIL_INDEX_DECLARATIVE + CIL_POLICYCAP - CIL_MIN_DECLARATIVE + 1)
+#define CIL_INDEX_MAX_WALK	32
+
+struct cil_index_entry {
+	struct cil_tree_node *node;
+	struct cil_tree_node *boolif;
+	uint32_t order;
+};
+
+/* A list with entries but no alloc borrows them from a loaded snapshot */
+struct cil_index_list {
+	uint32_t count;
+	uint32_t alloc;
+	struct cil_index_entry *entries;
+};
+
+/* Per-flavor lists of the nodes of a resolved AST, in tree order. Nodes in
+ * macros and abstract blocks are left out, and each entry records the
+ * booleanif it is in, if any. The AST is copied and pruned throughout
+ * resolution, so the index is built afterwards and must be rebuilt if the
+ * tree changes. */
+struct cil_index {
+	uint32_t count;
+	struct cil_index_list lists[CIL_INDEX_NUM];
+};
+
+void cil_index_init(struct cil_index **index);
+void cil_index_destroy(struct cil_index **index);
+int cil_index_build(struct cil_index *index, struct cil_tree_node *root);
+struct cil_index_list *cil_index_get(struct cil_index *index, enum cil_flavor flavor);
+int cil_index_walk(struct cil_index *index, const enum cil_flavor *flavors, uint32_t num_flavors, int (*process_entry)(struct cil_index_entry *entry, void *extra_args), void *extra_args);
+
+#endif /* CIL_INDEX_H_ */
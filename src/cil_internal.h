@@ -216,6 +216,103 @@ char *CIL_KEY_ROOT;
 char *CIL_KEY_NODE;
 char *CIL_KEY_PERM;
 
+/*
+	Statement keyword ids, see cil_strpool_keyword()
+*/
+enum cil_keyword {
+	CIL_KEYWORD_NONE = 0,
+	CIL_KEYWORD_BLOCK,
+	CIL_KEYWORD_BLOCKINHERIT,
+	CIL_KEYWORD_BLOCKABSTRACT,
+	CIL_KEYWORD_IN,
+	CIL_KEYWORD_CLASS,
+	CIL_KEYWORD_CLASSORDER,
+	CIL_KEYWORD_MAP_CLASS,
+	CIL_KEYWORD_CLASSMAPPING,
+	CIL_KEYWORD_CLASSPERMISSION,
+	CIL_KEYWORD_CLASSPERMISSIONSET,
+	CIL_KEYWORD_COMMON,
+	CIL_KEYWORD_CLASSCOMMON,
+	CIL_KEYWORD_SID,
+	CIL_KEYWORD_SIDCONTEXT,
+	CIL_KEYWORD_SIDORDER,
+	CIL_KEYWORD_USER,
+	CIL_KEYWORD_USERLEVEL,
+	CIL_KEYWORD_USERRANGE,
+	CIL_KEYWORD_USERBOUNDS,
+	CIL_KEYWORD_USERPREFIX,
+	CIL_KEYWORD_SELINUXUSER,
+	CIL_KEYWORD_SELINUXUSERDEFAULT,
+	CIL_KEYWORD_TYPE,
+	CIL_KEYWORD_TYPEATTRIBUTE,
+	CIL_KEYWORD_TYPEATTRIBUTESET,
+	CIL_KEYWORD_TYPEALIAS,
+	CIL_KEYWORD_TYPEALIASACTUAL,
+	CIL_KEYWORD_TYPEBOUNDS,
+	CIL_KEYWORD_TYPEPERMISSIVE,
+	CIL_KEYWORD_RANGETRANSITION,
+	CIL_KEYWORD_ROLE,
+	CIL_KEYWORD_USERROLE,
+	CIL_KEYWORD_ROLETYPE,
+	CIL_KEYWORD_ROLETRANSITION,
+	CIL_KEYWORD_ROLEALLOW,
+	CIL_KEYWORD_ROLEATTRIBUTE,
+	CIL_KEYWORD_ROLEATTRIBUTESET,
+	CIL_KEYWORD_ROLEBOUNDS,
+	CIL_KEYWORD_BOOL,
+	CIL_KEYWORD_BOOLEANIF,
+	CIL_KEYWORD_TUNABLE,
+	CIL_KEYWORD_TUNABLEIF,
+	CIL_KEYWORD_CONDTRUE,
+	CIL_KEYWORD_CONDFALSE,
+	CIL_KEYWORD_ALLOW,
+	CIL_KEYWORD_AUDITALLOW,
+	CIL_KEYWORD_DONTAUDIT,
+	CIL_KEYWORD_NEVERALLOW,
+	CIL_KEYWORD_TYPETRANSITION,
+	CIL_KEYWORD_TYPECHANGE,
+	CIL_KEYWORD_TYPEMEMBER,
+	CIL_KEYWORD_SENSITIVITY,
+	CIL_KEYWORD_SENSALIAS,
+	CIL_KEYWORD_SENSALIASACTUAL,
+	CIL_KEYWORD_CATEGORY,
+	CIL_KEYWORD_CATALIAS,
+	CIL_KEYWORD_CATALIASACTUAL,
+	CIL_KEYWORD_CATSET,
+	CIL_KEYWORD_CATORDER,
+	CIL_KEYWORD_SENSITIVITYORDER,
+	CIL_KEYWORD_SENSCAT,
+	CIL_KEYWORD_LEVEL,
+	CIL_KEYWORD_LEVELRANGE,
+	CIL_KEYWORD_CONSTRAIN,
+	CIL_KEYWORD_MLSCONSTRAIN,
+	CIL_KEYWORD_VALIDATETRANS,
+	CIL_KEYWORD_MLSVALIDATETRANS,
+	CIL_KEYWORD_CONTEXT,
+	CIL_KEYWORD_FILECON,
+	CIL_KEYWORD_PORTCON,
+	CIL_KEYWORD_NODECON,
+	CIL_KEYWORD_GENFSCON,
+	CIL_KEYWORD_NETIFCON,
+	CIL_KEYWORD_PIRQCON,
+	CIL_KEYWORD_IOMEMCON,
+	CIL_KEYWORD_IOPORTCON,
+	CIL_KEYWORD_PCIDEVICECON,
+	CIL_KEYWORD_FSUSE,
+	CIL_KEYWORD_MACRO,
+	CIL_KEYWORD_CALL,
+	CIL_KEYWORD_POLICYCAP,
+	CIL_KEYWORD_OPTIONAL,
+	CIL_KEYWORD_IPADDR,
+	CIL_KEYWORD_DEFAULTUSER,
+	CIL_KEYWORD_DEFAULTROLE,
+	CIL_KEYWORD_DEFAULTTYPE,
+	CIL_KEYWORD_DEFAULTRANGE,
+	CIL_KEYWORD_HANDLEUNKNOWN,
+	CIL_KEYWORD_MLS,
+	CIL_KEYWORD_NUM
+};
+
 /*
 	Symbol Table Array Indices
 */
@@ -257,8 +354,11 @@ extern int cil_sym_sizes[CIL_SYM_ARRAY_NUM][CIL_SYM_NUM];
 #define CIL_CLASS_SYM_SIZE	256
 
 struct cil_db {
-	struct cil_tree *parse;
+	struct cil_arena *arena;
+	struct cil_tree_locs *locs;
+	struct cil_parse_tokens *parse;
 	struct cil_tree *ast;
+	struct cil_index *index;
 	struct cil_type *selftype;
 	struct cil_list *sidorder;
 	struct cil_list *classorder;
@@ -287,10 +387,22 @@ struct cil_db {
 	int preserve_tunables;
 	int handle_unknown;
 	int mls;
+	int build_on_parse;
+	int full_reset;
+	int resolve_jobs;
+	enum cil_log_level log_level;		/* 0 to use the process wide level */
+	void (*log_handler)(int lvl, char *msg);	/* NULL to use the process wide one */
+	void (*mem_error_handler)(void);	/* likewise */
+	struct cil_arena **resolve_arenas;
+	int num_resolve_arenas;
+	struct cil_parse_cache *parse_cache;
+	struct cil_resolve_cache *resolve_cache;
+	struct cil_tree_node *compiled_tail;
+	struct cil_reset_base *base;
 };
 
 struct cil_root {
-	symtab_t symtab[CIL_SYM_NUM];
+	struct cil_symtab symtab[CIL_SYM_NUM];
 };
 
 struct cil_sort {
@@ -302,7 +414,7 @@ struct cil_sort {
 
 struct cil_block {
 	struct cil_symtab_datum datum;
-	symtab_t symtab[CIL_SYM_NUM];
+	struct cil_symtab symtab[CIL_SYM_NUM];
 	uint16_t is_abstract;
 	struct cil_list *bi_nodes;
 };
@@ -317,7 +429,7 @@ struct cil_blockabstract {
 };
 
 struct cil_in {
-	symtab_t symtab[CIL_SYM_NUM];
+	struct cil_symtab symtab[CIL_SYM_NUM];
 	char *block_str;
 };
 
@@ -334,7 +446,7 @@ struct cil_perm {
 
 struct cil_class {
 	struct cil_symtab_datum datum;
-	symtab_t perms;
+	struct cil_symtab perms;
 	unsigned int num_perms;
 	struct cil_class *common; /* Only used for kernel class */
 	uint32_t ordered; /* Only used for kernel class */
@@ -354,6 +466,8 @@ struct cil_classperms {
 	struct cil_class *class;
 	struct cil_list *perm_strs;
 	struct cil_list *perms;
+	uint32_t evaluated;
+	struct cil_vector datums;	/* the permissions of perms, once evaluated */
 };
 
 struct cil_classpermission {
@@ -602,6 +716,7 @@ struct cil_cats {
 	uint32_t evaluated;
 	struct cil_list *str_expr;
 	struct cil_list *datum_expr;
+	struct cil_vector datums;	/* the categories of datum_expr, once evaluated */
 };
 
 struct cil_catset {
@@ -774,7 +889,7 @@ struct cil_param {
 
 struct cil_macro {
 	struct cil_symtab_datum datum;
-	symtab_t symtab[CIL_SYM_NUM];
+	struct cil_symtab symtab[CIL_SYM_NUM];
 	struct cil_list *params;
 };
 
@@ -788,7 +903,7 @@ struct cil_args {
 struct cil_call {
 	char *macro_str;
 	struct cil_macro *macro;
-	struct cil_tree *args_tree;
+	struct cil_parse_token *args_tokens;	/* a copy of the argument list */
 	struct cil_list *args;
 	int copied;
 };
@@ -798,7 +913,7 @@ struct cil_call {
 
 struct cil_condblock {
 	enum cil_flavor flavor;
-	symtab_t symtab[CIL_SYM_NUM];
+	struct cil_symtab symtab[CIL_SYM_NUM];
 };
 
 struct cil_booleanif {
@@ -860,8 +975,19 @@ struct cil_mls {
 	int value;
 };
 
+/* What the calling thread was working on before cil_db_enter() */
+struct cil_db_thread {
+	struct cil_arena *arena;
+	struct cil_tree_locs *locs;
+	enum cil_log_level log_level;
+	void (*log_handler)(int lvl, char *msg);
+	void (*mem_error_handler)(void);
+};
+
 void cil_db_init(struct cil_db **db);
 void cil_db_destroy(struct cil_db **db);
+void cil_db_enter(struct cil_db *db, struct cil_db_thread *prev);
+void cil_db_leave(struct cil_db_thread *prev);
 
 void cil_root_init(struct cil_root **root);
 void cil_root_destroy(struct cil_root *root);
@@ -875,11 +1001,13 @@ int cil_userprefixes_to_string(struct cil_db *db, sepol_policydb_t *sepol_db, ch
 int cil_selinuxusers_to_string(struct cil_db *db, sepol_policydb_t *sepol_db, char **out, size_t *size);
 int cil_filecons_to_string(struct cil_db *db, sepol_policydb_t *sepol_db, char **out, size_t *size);
 
-void cil_symtab_array_init(symtab_t symtab[], int symtab_sizes[CIL_SYM_NUM]);
-void cil_symtab_array_destroy(symtab_t symtab[]);
+void cil_symtab_array_init(struct cil_symtab symtab[], int symtab_sizes[CIL_SYM_NUM]);
+void cil_symtab_array_destroy(struct cil_symtab symtab[]);
 void cil_destroy_ast_symtabs(struct cil_tree_node *root);
-int cil_get_symtab(struct cil_tree_node *ast_node, symtab_t **symtab, enum cil_sym_index sym_index);
+int cil_get_symtab(struct cil_tree_node *ast_node, struct cil_symtab **symtab, enum cil_sym_index sym_index);
 
+void cil_ebitmap_init(ebitmap_t **map);
+void cil_ebitmap_destroy(ebitmap_t **map);
 void cil_sort_init(struct cil_sort **sort);
 void cil_sort_destroy(struct cil_sort **sort);
 void cil_netifcon_init(struct cil_netifcon **netifcon);
@@ -40,14 +40,20 @@
 #define END_OF_FILE 6
 #define UNKNOWN 7
 
+/* value is NUL-terminated and len bytes long. It belongs to the lexer and
+ * only lasts until the next token is read. */
 struct token {
 	uint32_t type;
 	char * value;
+	uint32_t len;
 	uint32_t line;
 };
 
-int cil_lexer_setup(char *buffer, uint32_t size);
-void cil_lexer_destroy(void);
-int cil_lexer_next(struct token *tok);
+struct cil_lexer;
+
+int cil_lexer_setup(struct cil_lexer **lexer, char *buffer, uint32_t size);
+void cil_lexer_destroy(struct cil_lexer **lexer);
+int cil_lexer_next(struct cil_lexer *lexer, struct token *tok);
+const char *cil_lexer_build(void);
 
 #endif /* CIL_LEXER_H_ */
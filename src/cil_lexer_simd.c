@@ -0,0 +1,310 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+/*
+ * Hand written replacement for the flex scanner in cil_lexer.l. It recognizes
+ * exactly the same tokens and reports the same line numbers. The caller's
+ * buffer is never written, so it can be a read-only mapping; each token is
+ * copied out and NUL-terminated in a buffer the lexer owns. All scanner
+ * state lives in the struct cil_lexer handed out by cil_lexer_setup(), so
+ * separate buffers can be scanned concurrently.
+ *
+ * Runs of symbol characters, comments, quoted strings and whitespace are
+ * located a vector at a time using SSE2 (or AVX2 when the compiler targets
+ * it); the scalar loops handle the tail of the buffer and other platforms.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sepol/errcodes.h>
+
+#include "cil_internal.h"
+#include "cil_lexer.h"
+#include "cil_log.h"
+#include "cil_mem.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+
+#define CIL_LEXER_VEC_WIDTH 32
+#define CIL_LEXER_VEC_FULL 0xffffffffU
+
+typedef __m256i cil_lexer_vec_t;
+
+#define cil_lexer_vec_load(p) _mm256_loadu_si256((const __m256i *)(p))
+#define cil_lexer_vec_set(c) _mm256_set1_epi8(c)
+#define cil_lexer_vec_eq(a, b) _mm256_cmpeq_epi8(a, b)
+#define cil_lexer_vec_gt(a, b) _mm256_cmpgt_epi8(a, b)
+#define cil_lexer_vec_or(a, b) _mm256_or_si256(a, b)
+#define cil_lexer_vec_and(a, b) _mm256_and_si256(a, b)
+#define cil_lexer_vec_mask(v) ((uint32_t)_mm256_movemask_epi8(v))
+
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+
+#define CIL_LEXER_VEC_WIDTH 16
+#define CIL_LEXER_VEC_FULL 0xffffU
+
+typedef __m128i cil_lexer_vec_t;
+
+#define cil_lexer_vec_load(p) _mm_loadu_si128((const __m128i *)(p))
+#define cil_lexer_vec_set(c) _mm_set1_epi8(c)
+#define cil_lexer_vec_eq(a, b) _mm_cmpeq_epi8(a, b)
+#define cil_lexer_vec_gt(a, b) _mm_cmpgt_epi8(a, b)
+#define cil_lexer_vec_or(a, b) _mm_or_si128(a, b)
+#define cil_lexer_vec_and(a, b) _mm_and_si128(a, b)
+#define cil_lexer_vec_mask(v) ((uint32_t)_mm_movemask_epi8(v))
+
+#endif
+
+#define CIL_LEXER_SYMBOL	0x01
+#define CIL_LEXER_BLANK		0x02
+#define CIL_LEXER_NEWLINE	0x04
+
+#define CIL_LEXER_VALUE_INITIAL	256
+
+/* The symbol class is every printable, non-space ASCII character except
+ * the double quote, parentheses, semicolon and backslash. This is the same
+ * set that {digit}, {alpha} and {spec_char} describe in cil_lexer.l. Bytes
+ * from 0x80 up belong to no class. */
+#define S CIL_LEXER_SYMBOL
+#define B CIL_LEXER_BLANK
+#define N CIL_LEXER_NEWLINE
+static const unsigned char cil_lexer_class[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, B, N, 0, 0, N, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	B, S, 0, S, S, S, S, S, 0, 0, S, S, S, S, S, S,
+	S, S, S, S, S, S, S, S, S, S, S, 0, S, S, S, S,
+	S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,
+	S, S, S, S, S, S, S, S, S, S, S, S, 0, S, S, S,
+	S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, S,
+	S, S, S, S, S, S, S, S, S, S, S, S, S, S, S, 0
+};
+#undef S
+#undef B
+#undef N
+
+struct cil_lexer {
+	char *pos;
+	char *end;
+	char *value;
+	uint32_t len;
+	uint32_t alloc;
+	uint32_t line;
+};
+
+#ifdef CIL_LEXER_VEC_WIDTH
+static inline uint32_t cil_lexer_vec_symbol(cil_lexer_vec_t v)
+{
+	/* Signed compares: bytes >= 0x80 are negative and fail the first test */
+	cil_lexer_vec_t in = cil_lexer_vec_and(cil_lexer_vec_gt(v, cil_lexer_vec_set(0x20)),
+					       cil_lexer_vec_gt(cil_lexer_vec_set(0x7f), v));
+	cil_lexer_vec_t out = cil_lexer_vec_or(cil_lexer_vec_or(cil_lexer_vec_eq(v, cil_lexer_vec_set('"')),
+								 cil_lexer_vec_eq(v, cil_lexer_vec_set(';'))),
+						cil_lexer_vec_or(cil_lexer_vec_or(cil_lexer_vec_eq(v, cil_lexer_vec_set('(')),
+										  cil_lexer_vec_eq(v, cil_lexer_vec_set(')'))),
+								 cil_lexer_vec_eq(v, cil_lexer_vec_set('\\'))));
+
+	return cil_lexer_vec_mask(in) & ~cil_lexer_vec_mask(out);
+}
+#endif
+
+static char *cil_lexer_scan_symbol(char *p, char *end)
+{
+#ifdef CIL_LEXER_VEC_WIDTH
+	while (end - p >= CIL_LEXER_VEC_WIDTH) {
+		uint32_t stop = ~cil_lexer_vec_symbol(cil_lexer_vec_load(p)) & CIL_LEXER_VEC_FULL;
+		if (stop != 0) {
+			return p + __builtin_ctz(stop);
+		}
+		p += CIL_LEXER_VEC_WIDTH;
+	}
+#endif
+	while (p < end && (cil_lexer_class[(unsigned char)*p] & CIL_LEXER_SYMBOL)) {
+		p++;
+	}
+
+	return p;
+}
+
+/* Find the first c1 or c2 in [p, end), or return end */
+static char *cil_lexer_scan_until(char *p, char *end, char c1, char c2)
+{
+#ifdef CIL_LEXER_VEC_WIDTH
+	cil_lexer_vec_t v1 = cil_lexer_vec_set(c1);
+	cil_lexer_vec_t v2 = cil_lexer_vec_set(c2);
+
+	while (end - p >= CIL_LEXER_VEC_WIDTH) {
+		cil_lexer_vec_t v = cil_lexer_vec_load(p);
+		uint32_t stop = cil_lexer_vec_mask(cil_lexer_vec_or(cil_lexer_vec_eq(v, v1), cil_lexer_vec_eq(v, v2)));
+		if (stop != 0) {
+			return p + __builtin_ctz(stop);
+		}
+		p += CIL_LEXER_VEC_WIDTH;
+	}
+#endif
+	while (p < end && *p != c1 && *p != c2) {
+		p++;
+	}
+
+	return p;
+}
+
+/* Skip blanks and newlines, counting the newlines */
+static char *cil_lexer_scan_blank(char *p, char *end, uint32_t *line)
+{
+#ifdef CIL_LEXER_VEC_WIDTH
+	while (end - p >= CIL_LEXER_VEC_WIDTH) {
+		cil_lexer_vec_t v = cil_lexer_vec_load(p);
+		uint32_t nl = cil_lexer_vec_mask(cil_lexer_vec_or(cil_lexer_vec_eq(v, cil_lexer_vec_set('\n')),
+								   cil_lexer_vec_eq(v, cil_lexer_vec_set('\r'))));
+		uint32_t blank = cil_lexer_vec_mask(cil_lexer_vec_or(cil_lexer_vec_eq(v, cil_lexer_vec_set(' ')),
+								      cil_lexer_vec_eq(v, cil_lexer_vec_set('\t'))));
+		uint32_t stop = ~(nl | blank) & CIL_LEXER_VEC_FULL;
+		if (stop != 0) {
+			int offset = __builtin_ctz(stop);
+			*line += __builtin_popcount(nl & ((1U << offset) - 1));
+			return p + offset;
+		}
+		*line += __builtin_popcount(nl);
+		p += CIL_LEXER_VEC_WIDTH;
+	}
+#endif
+	while (p < end && (cil_lexer_class[(unsigned char)*p] & (CIL_LEXER_BLANK | CIL_LEXER_NEWLINE))) {
+		if (cil_lexer_class[(unsigned char)*p] & CIL_LEXER_NEWLINE) {
+			(*line)++;
+		}
+		p++;
+	}
+
+	return p;
+}
+
+static uint32_t cil_lexer_token(struct cil_lexer *lexer, char *start, char *end, uint32_t type)
+{
+	lexer->len = end - start;
+	if (lexer->len >= lexer->alloc) {
+		while (lexer->len >= lexer->alloc) {
+			lexer->alloc *= 2;
+		}
+		lexer->value = cil_realloc(lexer->value, lexer->alloc);
+	}
+	memcpy(lexer->value, start, lexer->len);
+	lexer->value[lexer->len] = '\0';
+
+	lexer->pos = end;
+
+	return type;
+}
+
+static uint32_t cil_lexer_lex(struct cil_lexer *lexer)
+{
+	char *p = lexer->pos;
+	char *end = lexer->end;
+	char *q;
+
+	p = cil_lexer_scan_blank(p, end, &lexer->line);
+	if (p == end) {
+		return cil_lexer_token(lexer, p, p, END_OF_FILE);
+	}
+
+	switch (*p) {
+	case '(':
+		return cil_lexer_token(lexer, p, p + 1, OPAREN);
+	case ')':
+		return cil_lexer_token(lexer, p, p + 1, CPAREN);
+	case ';':
+		return cil_lexer_token(lexer, p, cil_lexer_scan_until(p + 1, end, '\n', '\n'), COMMENT);
+	case '"':
+		q = cil_lexer_scan_until(p + 1, end, '"', '\n');
+		if (q == end || *q != '"') {
+			return cil_lexer_token(lexer, p, p + 1, UNKNOWN);
+		}
+		return cil_lexer_token(lexer, p, q + 1, QSTRING);
+	default:
+		break;
+	}
+
+	if (cil_lexer_class[(unsigned char)*p] & CIL_LEXER_SYMBOL) {
+		return cil_lexer_token(lexer, p, cil_lexer_scan_symbol(p + 1, end), SYMBOL);
+	}
+
+	return cil_lexer_token(lexer, p, p + 1, UNKNOWN);
+}
+
+/* Names this build of the lexer, for keying cached parses */
+const char *cil_lexer_build(void)
+{
+	return "simd " __DATE__ " " __TIME__;
+}
+
+int cil_lexer_setup(struct cil_lexer **lexer, char *buffer, uint32_t size)
+{
+	struct cil_lexer *new_lexer = NULL;
+
+	/* Same requirement as flex's yy_scan_buffer() */
+	if (size < 2 || buffer[size - 2] != '\0' || buffer[size - 1] != '\0') {
+		cil_log(CIL_INFO, "Lexer failed to setup buffer\n");
+		return SEPOL_ERR;
+	}
+
+	new_lexer = cil_malloc(sizeof(*new_lexer));
+	new_lexer->pos = buffer;
+	new_lexer->end = buffer + size - 2;
+	new_lexer->alloc = CIL_LEXER_VALUE_INITIAL;
+	new_lexer->value = cil_malloc(new_lexer->alloc);
+	new_lexer->len = 0;
+	new_lexer->line = 1;
+
+	*lexer = new_lexer;
+
+	return SEPOL_OK;
+}
+
+void cil_lexer_destroy(struct cil_lexer **lexer)
+{
+	if (*lexer == NULL) {
+		return;
+	}
+
+	free((*lexer)->value);
+	free(*lexer);
+	*lexer = NULL;
+}
+
+int cil_lexer_next(struct cil_lexer *lexer, struct token *tok)
+{
+	tok->type = cil_lexer_lex(lexer);
+	tok->value = lexer->value;
+	tok->len = lexer->len;
+	tok->line = lexer->line;
+
+	return SEPOL_OK;
+}
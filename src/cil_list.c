@@ -34,6 +34,7 @@
 #include "cil_flavor.h"
 #include "cil_log.h"
 #include "cil_mem.h"
+#include "cil_arena.h"
 
 __attribute__((noreturn)) __attribute__((format (printf, 1, 2))) void cil_list_error(const char* msg, ...)
 {
@@ -46,7 +47,7 @@ __attribute__((noreturn)) __attribute__((format (printf, 1, 2))) void cil_list_e
 
 void cil_list_init(struct cil_list **list, enum cil_flavor flavor)
 {
-	struct cil_list *new_list = cil_malloc(sizeof(*new_list));
+	struct cil_list *new_list = cil_arena_alloc(sizeof(*new_list));
 	new_list->head = NULL;
 	new_list->tail = NULL;
 	new_list->flavor = flavor;
@@ -66,19 +67,19 @@ void cil_list_destroy(struct cil_list **list, unsigned destroy_data)
 		next = item->next;
 		if (item->flavor == CIL_LIST) {
 			cil_list_destroy((struct cil_list**)&(item->data), destroy_data);
-			free(item);
+			cil_arena_release(item, sizeof(*item));
 		} else {
 			cil_list_item_destroy(&item, destroy_data);
 		}
 		item = next;
 	}
-	free(*list);
+	cil_arena_release(*list, sizeof(**list));
 	*list = NULL;
 }
 
 void cil_list_item_init(struct cil_list_item **item)
 {
-	struct cil_list_item *new_item = cil_malloc(sizeof(*new_item));
+	struct cil_list_item *new_item = cil_arena_alloc(sizeof(*new_item));
 	new_item->next = NULL;
 	new_item->flavor = CIL_NONE;
 	new_item->data = NULL;
@@ -91,7 +92,7 @@ void cil_list_item_destroy(struct cil_list_item **item, unsigned destroy_data)
 	if (destroy_data) {
 		cil_destroy_data(&(*item)->data, (*item)->flavor);
 	}
-	free(*item);
+	cil_arena_release(*item, sizeof(**item));
 	*item = NULL;
 }
 
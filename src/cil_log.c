@@ -35,7 +35,11 @@
 #include <cil/cil.h>
 #include "cil_log.h"
 
+/* The level and handler set here hold for the whole process. A thread
+ * can override them for itself, which is how the settings of a db apply to
+ * the threads working on it. */
 static enum cil_log_level cil_log_level = CIL_ERR;
+__thread enum cil_log_level cil_log_thread_level;
 
 void cil_default_log_handler(__attribute__((unused)) int lvl, char *msg)
 {
@@ -43,6 +47,7 @@ void cil_default_log_handler(__attribute__((unused)) int lvl, char *msg)
 }
 
 void (*cil_log_handler)(int lvl, char *msg) = &cil_default_log_handler;
+__thread void (*cil_log_thread_handler)(int lvl, char *msg);
 
 void cil_set_log_handler(void (*handler)(int lvl, char *msg))
 {
@@ -51,10 +56,12 @@ void cil_set_log_handler(void (*handler)(int lvl, char *msg))
 
 __attribute__ ((format (printf, 2, 0))) void cil_vlog(enum cil_log_level lvl, const char *msg, va_list args)
 {
-	if (cil_log_level >= lvl) {
+	enum cil_log_level level = cil_get_log_level();
+
+	if (level >= lvl) {
 		char buff[MAX_LOG_SIZE];
 		vsnprintf(buff, MAX_LOG_SIZE, msg, args);
-		(*cil_log_handler)(cil_log_level, buff);
+		(*cil_get_log_handler())(level, buff);
 	}
 }
 
@@ -70,3 +77,15 @@ void cil_set_log_level(enum cil_log_level lvl)
 {
 	cil_log_level = lvl;
 }
+
+/* The level in force on the calling thread */
+enum cil_log_level cil_get_log_level(void)
+{
+	return cil_log_thread_level != 0 ? cil_log_thread_level : cil_log_level;
+}
+
+/* The handler in force on the calling thread */
+void (*cil_get_log_handler(void))(int lvl, char *msg)
+{
+	return cil_log_thread_handler != NULL ? cil_log_thread_handler : cil_log_handler;
+}
@@ -36,5 +36,12 @@
 
 __attribute__ ((format(printf, 2, 0))) void cil_vlog(enum cil_log_level lvl, const char *msg, va_list args);
 __attribute__ ((format(printf, 2, 3))) void cil_log(enum cil_log_level lvl, const char *msg, ...);
+enum cil_log_level cil_get_log_level(void);
+void (*cil_get_log_handler(void))(int lvl, char *msg);
+
+/* Override the process wide level and handler on the calling thread unless
+ * 0 or NULL */
+extern __thread enum cil_log_level cil_log_thread_level;
+extern __thread void (*cil_log_thread_handler)(int lvl, char *msg);
 
 #endif // CIL_LOG_H_
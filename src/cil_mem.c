@@ -32,6 +32,7 @@
 #include <string.h>
 
 #include "cil_log.h"
+#include "cil_mem.h"
 
 __attribute__((noreturn)) void cil_default_mem_error_handler(void)
 {
@@ -40,6 +41,7 @@ __attribute__((noreturn)) void cil_default_mem_error_handler(void)
 }
 
 void (*cil_mem_error_handler)(void) = &cil_default_mem_error_handler;
+__thread void (*cil_mem_thread_error_handler)(void);
 
 void cil_set_mem_error_handler(void (*handler)(void))
 {
@@ -53,7 +55,7 @@ void *cil_malloc(size_t size)
 		if (size == 0) {
 			return NULL;
 		}
-		(*cil_mem_error_handler)();
+		(*CIL_MEM_ERROR_HANDLER)();
 	}
 
 	return mem;
@@ -63,7 +65,7 @@ void *cil_calloc(size_t num_elements, size_t element_size)
 {
 	void *mem = calloc(num_elements, element_size);
 	if (mem == NULL){
-		(*cil_mem_error_handler)();
+		(*CIL_MEM_ERROR_HANDLER)();
 	}
 
 	return mem;
@@ -76,7 +78,7 @@ void *cil_realloc(void *ptr, size_t size)
 		if (size == 0) {
 			return NULL;
 		}
-		(*cil_mem_error_handler)();
+		(*CIL_MEM_ERROR_HANDLER)();
 	}
 
 	return mem;
@@ -93,7 +95,7 @@ char *cil_strdup(const char *str)
 
 	mem = strdup(str);
 	if (mem == NULL) {
-		(*cil_mem_error_handler)();
+		(*CIL_MEM_ERROR_HANDLER)();
 	}
 
 	return mem;
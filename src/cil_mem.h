@@ -35,7 +35,15 @@ void *cil_malloc(size_t size);
 void *cil_calloc(size_t num_elements, size_t element_size);
 void *cil_realloc(void *ptr, size_t size);
 char *cil_strdup(const char *str);
+
 void (*cil_mem_error_handler)(void);
 
+/* Overrides cil_mem_error_handler on the calling thread unless NULL */
+extern __thread void (*cil_mem_thread_error_handler)(void);
+
+/* The handler called when an allocation on the calling thread fails */
+#define CIL_MEM_ERROR_HANDLER \
+	(cil_mem_thread_error_handler != NULL ? cil_mem_thread_error_handler : cil_mem_error_handler)
+
 #endif /* CIL_MEM_H_ */
 
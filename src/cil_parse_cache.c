@@ -0,0 +1,645 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+/*
+ * On-disk cache of parsed CIL files.
+ *
+ * An entry is named after the SHA-256 of the cache format version, the
+ * builds of the lexer and the parser and the file's content, so an entry
+ * can only ever be reused for identical input read by the same compiler.
+ * It holds the file's struct cil_parse_tokens as written by the parser: a
+ * table of the distinct symbols, followed by one token per parenthesis or
+ * symbol giving its symbol index, line number and matching parenthesis.
+ * Entries are mapped read-only and loaded straight into a token stream.
+ *
+ * CIL_PARSE_CACHE_VERSION is the format of an entry. Rebuilding the lexer
+ * or the parser changes their build stamps, which retires the entries they
+ * wrote.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sepol/errcodes.h>
+#include <sepol/policydb/hashtab.h>
+
+#include "cil_internal.h"
+#include "cil_log.h"
+#include "cil_mem.h"
+#include "cil_lexer.h"
+#include "cil_parser.h"
+#include "cil_strpool.h"
+#include "cil_parse_cache.h"
+
+#define CIL_PARSE_CACHE_MAGIC		"CILPARSE"
+#define CIL_PARSE_CACHE_VERSION		3
+#define CIL_PARSE_CACHE_HASH_SIZE	32
+#define CIL_PARSE_CACHE_NONE		UINT32_MAX
+
+#define CIL_PARSE_CACHE_SYMTAB_SIZE	(1 << 12)
+
+struct cil_parse_cache {
+	char *dir;
+	pthread_mutex_t mutex;
+	unsigned int hits;
+	unsigned int misses;
+};
+
+struct cil_parse_cache_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t num_symbols;
+	uint32_t num_tokens;
+	uint32_t strings_size;
+	unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE];
+};
+
+struct cil_parse_cache_token {
+	uint32_t symbol;	/* CIL_PARSE_CACHE_NONE for a parenthesis */
+	uint32_t line;
+	int32_t match;
+};
+
+/* The symbol table of an entry being written */
+struct cil_parse_cache_symbols {
+	hashtab_t ids;
+	char **symbols;
+	uint32_t count;
+	uint32_t alloc;
+	uint32_t strings_size;
+};
+
+/* SHA-256, FIPS 180-4 */
+struct cil_sha256 {
+	uint32_t state[8];
+	uint64_t length;
+	unsigned char block[64];
+	uint32_t used;
+};
+
+static const uint32_t cil_sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define CIL_SHA256_ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void cil_sha256_block(struct cil_sha256 *ctx, const unsigned char *p)
+{
+	uint32_t w[64];
+	uint32_t a, b, c, d, e, f, g, h, t1, t2;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		w[i] = ((uint32_t)p[i * 4] << 24) | ((uint32_t)p[i * 4 + 1] << 16) | ((uint32_t)p[i * 4 + 2] << 8) | p[i * 4 + 3];
+	}
+	for (i = 16; i < 64; i++) {
+		uint32_t s0 = CIL_SHA256_ROR(w[i - 15], 7) ^ CIL_SHA256_ROR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+		uint32_t s1 = CIL_SHA256_ROR(w[i - 2], 17) ^ CIL_SHA256_ROR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+		w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+	}
+
+	a = ctx->state[0];
+	b = ctx->state[1];
+	c = ctx->state[2];
+	d = ctx->state[3];
+	e = ctx->state[4];
+	f = ctx->state[5];
+	g = ctx->state[6];
+	h = ctx->state[7];
+
+	for (i = 0; i < 64; i++) {
+		t1 = h + (CIL_SHA256_ROR(e, 6) ^ CIL_SHA256_ROR(e, 11) ^ CIL_SHA256_ROR(e, 25)) + ((e & f) ^ (~e & g)) + cil_sha256_k[i] + w[i];
+		t2 = (CIL_SHA256_ROR(a, 2) ^ CIL_SHA256_ROR(a, 13) ^ CIL_SHA256_ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+
+	ctx->state[0] += a;
+	ctx->state[1] += b;
+	ctx->state[2] += c;
+	ctx->state[3] += d;
+	ctx->state[4] += e;
+	ctx->state[5] += f;
+	ctx->state[6] += g;
+	ctx->state[7] += h;
+}
+
+static void cil_sha256_init(struct cil_sha256 *ctx)
+{
+	ctx->state[0] = 0x6a09e667;
+	ctx->state[1] = 0xbb67ae85;
+	ctx->state[2] = 0x3c6ef372;
+	ctx->state[3] = 0xa54ff53a;
+	ctx->state[4] = 0x510e527f;
+	ctx->state[5] = 0x9b05688c;
+	ctx->state[6] = 0x1f83d9ab;
+	ctx->state[7] = 0x5be0cd19;
+	ctx->length = 0;
+	ctx->used = 0;
+}
+
+static void cil_sha256_update(struct cil_sha256 *ctx, const void *data, size_t size)
+{
+	const unsigned char *p = data;
+
+	ctx->length += size;
+
+	if (ctx->used > 0) {
+		size_t n = 64 - ctx->used;
+		if (n > size) {
+			n = size;
+		}
+		memcpy(ctx->block + ctx->used, p, n);
+		ctx->used += n;
+		p += n;
+		size -= n;
+		if (ctx->used < 64) {
+			return;
+		}
+		cil_sha256_block(ctx, ctx->block);
+		ctx->used = 0;
+	}
+
+	while (size >= 64) {
+		cil_sha256_block(ctx, p);
+		p += 64;
+		size -= 64;
+	}
+
+	memcpy(ctx->block, p, size);
+	ctx->used = size;
+}
+
+static void cil_sha256_final(struct cil_sha256 *ctx, unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE])
+{
+	uint64_t bits = ctx->length * 8;
+	int i;
+
+	ctx->block[ctx->used++] = 0x80;
+	if (ctx->used > 56) {
+		memset(ctx->block + ctx->used, 0, 64 - ctx->used);
+		cil_sha256_block(ctx, ctx->block);
+		ctx->used = 0;
+	}
+	memset(ctx->block + ctx->used, 0, 56 - ctx->used);
+	for (i = 0; i < 8; i++) {
+		ctx->block[56 + i] = bits >> (56 - i * 8);
+	}
+	cil_sha256_block(ctx, ctx->block);
+
+	for (i = 0; i < 8; i++) {
+		hash[i * 4] = ctx->state[i] >> 24;
+		hash[i * 4 + 1] = ctx->state[i] >> 16;
+		hash[i * 4 + 2] = ctx->state[i] >> 8;
+		hash[i * 4 + 3] = ctx->state[i];
+	}
+}
+
+int cil_parse_cache_init(struct cil_parse_cache **cache, const char *dir)
+{
+	struct stat dirdata;
+	struct cil_parse_cache *new_cache = NULL;
+
+	if (stat(dir, &dirdata) != 0 || !S_ISDIR(dirdata.st_mode)) {
+		cil_log(CIL_ERR, "Parse cache directory %s does not exist\n", dir);
+		return SEPOL_ERR;
+	}
+
+	new_cache = cil_malloc(sizeof(*new_cache));
+	new_cache->dir = cil_strdup(dir);
+	pthread_mutex_init(&new_cache->mutex, NULL);
+	new_cache->hits = 0;
+	new_cache->misses = 0;
+
+	*cache = new_cache;
+
+	return SEPOL_OK;
+}
+
+void cil_parse_cache_destroy(struct cil_parse_cache **cache)
+{
+	if (cache == NULL || *cache == NULL) {
+		return;
+	}
+
+	pthread_mutex_destroy(&(*cache)->mutex);
+	free((*cache)->dir);
+	free(*cache);
+	*cache = NULL;
+}
+
+void cil_parse_cache_stats(struct cil_parse_cache *cache, unsigned int *hits, unsigned int *misses)
+{
+	pthread_mutex_lock(&cache->mutex);
+	*hits = cache->hits;
+	*misses = cache->misses;
+	pthread_mutex_unlock(&cache->mutex);
+}
+
+static void __cil_parse_cache_key(const char *buffer, uint32_t size, unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE])
+{
+	struct cil_sha256 ctx;
+	uint32_t version = CIL_PARSE_CACHE_VERSION;
+	const char *lexer = cil_lexer_build();
+	const char *parser = cil_parser_build();
+
+	cil_sha256_init(&ctx);
+	cil_sha256_update(&ctx, CIL_PARSE_CACHE_MAGIC, 8);
+	cil_sha256_update(&ctx, &version, sizeof(version));
+	cil_sha256_update(&ctx, lexer, strlen(lexer) + 1);
+	cil_sha256_update(&ctx, parser, strlen(parser) + 1);
+	cil_sha256_update(&ctx, buffer, size);
+	cil_sha256_final(&ctx, hash);
+}
+
+static char *__cil_parse_cache_entry_path(struct cil_parse_cache *cache, const unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE], const char *suffix)
+{
+	char name[CIL_PARSE_CACHE_HASH_SIZE * 2 + 1];
+	char *path = NULL;
+	int i;
+
+	for (i = 0; i < CIL_PARSE_CACHE_HASH_SIZE; i++) {
+		sprintf(name + i * 2, "%02x", hash[i]);
+	}
+
+	path = cil_malloc(strlen(cache->dir) + strlen(name) + strlen(suffix) + 2);
+	sprintf(path, "%s/%s%s", cache->dir, name, suffix);
+
+	return path;
+}
+
+/* Check that a mapped entry is complete and self consistent before any of
+ * it is used, so a truncated or corrupted entry is only ever a miss. */
+static int __cil_parse_cache_verify(const char *data, size_t size, const unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE])
+{
+	const struct cil_parse_cache_header *header = (const struct cil_parse_cache_header *)data;
+	const uint32_t *symbols = NULL;
+	const struct cil_parse_cache_token *tokens = NULL;
+	const char *strings = NULL;
+	uint64_t expected;
+	uint32_t i;
+
+	if (size < sizeof(*header)) {
+		return SEPOL_ERR;
+	}
+
+	if (memcmp(header->magic, CIL_PARSE_CACHE_MAGIC, 8) != 0 || header->version != CIL_PARSE_CACHE_VERSION || memcmp(header->hash, hash, CIL_PARSE_CACHE_HASH_SIZE) != 0) {
+		return SEPOL_ERR;
+	}
+
+	expected = sizeof(*header) + (uint64_t)header->num_symbols * sizeof(*symbols) + (uint64_t)header->num_tokens * sizeof(*tokens) + header->strings_size;
+	if (expected != size) {
+		return SEPOL_ERR;
+	}
+
+	symbols = (const uint32_t *)(data + sizeof(*header));
+	tokens = (const struct cil_parse_cache_token *)(symbols + header->num_symbols);
+	strings = (const char *)(tokens + header->num_tokens);
+
+	if (header->num_symbols > 0 && (header->strings_size == 0 || strings[header->strings_size - 1] != '\0')) {
+		return SEPOL_ERR;
+	}
+
+	for (i = 0; i < header->num_symbols; i++) {
+		if (symbols[i] >= header->strings_size) {
+			return SEPOL_ERR;
+		}
+	}
+
+	for (i = 0; i < header->num_tokens; i++) {
+		if (tokens[i].symbol != CIL_PARSE_CACHE_NONE && tokens[i].symbol >= header->num_symbols) {
+			return SEPOL_ERR;
+		}
+	}
+
+	return SEPOL_OK;
+}
+
+/* Copy the tokens of a verified entry into tokens. The parentheses are
+ * paired up the same way the parser does it, and an entry whose matches
+ * disagree with that is rejected. */
+static int __cil_parse_cache_read(const char *data, char *path, struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ERR;
+	const struct cil_parse_cache_header *header = (const struct cil_parse_cache_header *)data;
+	const uint32_t *symbols = (const uint32_t *)(data + sizeof(*header));
+	const struct cil_parse_cache_token *entry = (const struct cil_parse_cache_token *)(symbols + header->num_symbols);
+	const char *strings = (const char *)(entry + header->num_tokens);
+	char **interned = NULL;
+	uint32_t current = CIL_PARSE_CACHE_NONE;
+	uint32_t end;
+	int32_t enclosing;
+	uint32_t i;
+
+	interned = cil_malloc(sizeof(*interned) * (header->num_symbols + 1));
+	for (i = 0; i < header->num_symbols; i++) {
+		interned[i] = cil_strpool_add(strings + symbols[i]);
+	}
+
+	tokens->path = path;
+
+	for (i = 0; i < header->num_tokens; i++) {
+		if (entry[i].symbol != CIL_PARSE_CACHE_NONE) {
+			if (current == CIL_PARSE_CACHE_NONE) {
+				goto exit;
+			}
+			cil_parse_tokens_add(tokens, interned[entry[i].symbol], entry[i].line, 0);
+		} else if (entry[i].match > 0) {
+			enclosing = (current == CIL_PARSE_CACHE_NONE) ? 0 : i - current;
+			current = cil_parse_tokens_add(tokens, NULL, entry[i].line, enclosing);
+		} else {
+			if (current == CIL_PARSE_CACHE_NONE || entry[i].match != -(int32_t)(i - current) || entry[current].match != (int32_t)(i - current)) {
+				goto exit;
+			}
+			end = cil_parse_tokens_add(tokens, NULL, entry[i].line, entry[i].match);
+			enclosing = tokens->tokens[current].match;
+			tokens->tokens[current].match = end - current;
+			current = (enclosing == 0) ? CIL_PARSE_CACHE_NONE : current - enclosing;
+		}
+	}
+
+	if (current != CIL_PARSE_CACHE_NONE) {
+		goto exit;
+	}
+
+	rc = SEPOL_OK;
+
+exit:
+	if (rc != SEPOL_OK) {
+		tokens->count = 0;
+	}
+	free(interned);
+
+	return rc;
+}
+
+/* Returns SEPOL_ENOENT if there is no usable entry for hash */
+static int __cil_parse_cache_load(struct cil_parse_cache *cache, const unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE], char *path, struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ENOENT;
+	char *entry = __cil_parse_cache_entry_path(cache, hash, "");
+	struct stat filedata;
+	void *data = MAP_FAILED;
+	int fd;
+
+	fd = open(entry, O_RDONLY);
+	if (fd == -1) {
+		goto exit;
+	}
+
+	if (fstat(fd, &filedata) != 0 || filedata.st_size == 0) {
+		goto exit;
+	}
+
+	data = mmap(NULL, filedata.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) {
+		goto exit;
+	}
+
+	if (__cil_parse_cache_verify(data, filedata.st_size, hash) != SEPOL_OK || __cil_parse_cache_read(data, path, tokens) != SEPOL_OK) {
+		cil_log(CIL_WARN, "Ignoring invalid parse cache entry %s\n", entry);
+		goto exit;
+	}
+
+	rc = SEPOL_OK;
+
+exit:
+	if (data != MAP_FAILED) {
+		munmap(data, filedata.st_size);
+	}
+	if (fd != -1) {
+		close(fd);
+	}
+	free(entry);
+
+	return rc;
+}
+
+static unsigned int __cil_parse_cache_symbol_hash(hashtab_t h, hashtab_key_t key)
+{
+	uintptr_t val = (uintptr_t)key;
+
+	return (unsigned int)((val >> 3) ^ (val >> 15)) & (h->size - 1);
+}
+
+static int __cil_parse_cache_symbol_compare(hashtab_t h __attribute__ ((unused)), hashtab_key_t key1, hashtab_key_t key2)
+{
+	/* Symbols are interned, so equal strings are the same pointer */
+	if (key1 == key2) {
+		return 0;
+	}
+
+	return ((uintptr_t)key1 < (uintptr_t)key2) ? -1 : 1;
+}
+
+static void __cil_parse_cache_symbols_init(struct cil_parse_cache_symbols *symbols)
+{
+	symbols->ids = hashtab_create(__cil_parse_cache_symbol_hash, __cil_parse_cache_symbol_compare, CIL_PARSE_CACHE_SYMTAB_SIZE);
+	if (symbols->ids == NULL) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+	symbols->symbols = NULL;
+	symbols->count = 0;
+	symbols->alloc = 0;
+	symbols->strings_size = 0;
+}
+
+static void __cil_parse_cache_symbols_destroy(struct cil_parse_cache_symbols *symbols)
+{
+	hashtab_destroy(symbols->ids);
+	free(symbols->symbols);
+}
+
+static uint32_t __cil_parse_cache_symbol_id(struct cil_parse_cache_symbols *symbols, char *symbol)
+{
+	uintptr_t id = (uintptr_t)hashtab_search(symbols->ids, (hashtab_key_t)symbol);
+
+	if (id != 0) {
+		return id - 1;
+	}
+
+	if (symbols->count == symbols->alloc) {
+		symbols->alloc = symbols->alloc ? symbols->alloc * 2 : 256;
+		symbols->symbols = cil_realloc(symbols->symbols, sizeof(*symbols->symbols) * symbols->alloc);
+	}
+
+	symbols->symbols[symbols->count] = symbol;
+	symbols->strings_size += strlen(symbol) + 1;
+	if (hashtab_insert(symbols->ids, (hashtab_key_t)symbol, (hashtab_datum_t)(uintptr_t)(symbols->count + 1)) != SEPOL_OK) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+
+	return symbols->count++;
+}
+
+static int __cil_parse_cache_write_all(int fd, const void *data, size_t size)
+{
+	const char *p = data;
+	ssize_t written;
+
+	while (size > 0) {
+		written = write(fd, p, size);
+		if (written <= 0) {
+			return SEPOL_ERR;
+		}
+		p += written;
+		size -= written;
+	}
+
+	return SEPOL_OK;
+}
+
+/* Write the entry under a temporary name and rename it into place, so that
+ * concurrent builds never see a partial entry */
+static int __cil_parse_cache_store(struct cil_parse_cache *cache, const unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE], struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ERR;
+	struct cil_parse_cache_header header;
+	struct cil_parse_cache_symbols symbols;
+	struct cil_parse_cache_token *entry_tokens = NULL;
+	char *entry = __cil_parse_cache_entry_path(cache, hash, "");
+	char *tmp = __cil_parse_cache_entry_path(cache, hash, ".XXXXXX");
+	uint32_t offset = 0;
+	uint32_t i;
+	int fd;
+
+	__cil_parse_cache_symbols_init(&symbols);
+
+	fd = mkstemp(tmp);
+	if (fd == -1) {
+		goto exit;
+	}
+
+	entry_tokens = cil_malloc(sizeof(*entry_tokens) * (tokens->count + 1));
+	for (i = 0; i < tokens->count; i++) {
+		if (tokens->tokens[i].data == NULL) {
+			entry_tokens[i].symbol = CIL_PARSE_CACHE_NONE;
+		} else {
+			entry_tokens[i].symbol = __cil_parse_cache_symbol_id(&symbols, tokens->tokens[i].data);
+		}
+		entry_tokens[i].line = tokens->tokens[i].line;
+		entry_tokens[i].match = tokens->tokens[i].match;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CIL_PARSE_CACHE_MAGIC, 8);
+	header.version = CIL_PARSE_CACHE_VERSION;
+	header.num_symbols = symbols.count;
+	header.num_tokens = tokens->count;
+	header.strings_size = symbols.strings_size;
+	memcpy(header.hash, hash, CIL_PARSE_CACHE_HASH_SIZE);
+
+	rc = __cil_parse_cache_write_all(fd, &header, sizeof(header));
+	for (i = 0; i < symbols.count && rc == SEPOL_OK; i++) {
+		rc = __cil_parse_cache_write_all(fd, &offset, sizeof(offset));
+		offset += strlen(symbols.symbols[i]) + 1;
+	}
+	if (rc == SEPOL_OK) {
+		rc = __cil_parse_cache_write_all(fd, entry_tokens, sizeof(*entry_tokens) * tokens->count);
+	}
+	for (i = 0; i < symbols.count && rc == SEPOL_OK; i++) {
+		rc = __cil_parse_cache_write_all(fd, symbols.symbols[i], strlen(symbols.symbols[i]) + 1);
+	}
+
+	if (close(fd) != 0) {
+		rc = SEPOL_ERR;
+	}
+
+	if (rc == SEPOL_OK && rename(tmp, entry) != 0) {
+		rc = SEPOL_ERR;
+	}
+
+	if (rc != SEPOL_OK) {
+		unlink(tmp);
+	}
+
+exit:
+	__cil_parse_cache_symbols_destroy(&symbols);
+	free(entry_tokens);
+	free(entry);
+	free(tmp);
+
+	return rc;
+}
+
+/* Parse buffer, which must be set up as for cil_parser(), into tokens,
+ * which must be empty. The tokens come from the cache when it has an entry
+ * for this content. Otherwise the buffer is parsed and a new entry is
+ * stored. Failing to store an entry is not an error. */
+int cil_parse_cache_parse(struct cil_parse_cache *cache, char *path, char *buffer, uint32_t size, struct cil_parse_tokens *tokens)
+{
+	int rc = SEPOL_ERR;
+	unsigned char hash[CIL_PARSE_CACHE_HASH_SIZE];
+
+	if (size < 2) {
+		return cil_parser_tokens(path, buffer, size, tokens);
+	}
+
+	__cil_parse_cache_key(buffer, size - 2, hash);
+
+	rc = __cil_parse_cache_load(cache, hash, cil_strpool_add(path), tokens);
+	if (rc == SEPOL_OK) {
+		cil_log(CIL_INFO, "Parse cache hit for %s\n", path);
+		pthread_mutex_lock(&cache->mutex);
+		cache->hits++;
+		pthread_mutex_unlock(&cache->mutex);
+		return SEPOL_OK;
+	}
+
+	cil_log(CIL_INFO, "Parse cache miss for %s\n", path);
+	pthread_mutex_lock(&cache->mutex);
+	cache->misses++;
+	pthread_mutex_unlock(&cache->mutex);
+
+	rc = cil_parser_tokens(path, buffer, size, tokens);
+	if (rc == SEPOL_OK && __cil_parse_cache_store(cache, hash, tokens) != SEPOL_OK) {
+		cil_log(CIL_WARN, "Failed to write parse cache entry for %s\n", path);
+	}
+
+	return rc;
+}
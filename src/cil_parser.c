@@ -36,82 +36,254 @@
 #include "cil_internal.h"
 #include "cil_log.h"
 #include "cil_mem.h"
+#include "cil_arena.h"
 #include "cil_tree.h" 
 #include "cil_lexer.h"
 #include "cil_strpool.h"
+#include "cil_parser.h"
 
-int cil_parser(char *_path, char *buffer, uint32_t size, struct cil_tree **parse_tree)
+#define CIL_PARSE_TOKENS_INITIAL	1024
+
+void cil_parse_tokens_init(struct cil_parse_tokens **tokens)
 {
+	struct cil_parse_tokens *new_tokens = cil_malloc(sizeof(*new_tokens));
 
-	int paren_count = 0;
+	new_tokens->path = NULL;
+	new_tokens->tokens = NULL;
+	new_tokens->count = 0;
+	new_tokens->alloc = 0;
+	new_tokens->next = NULL;
+
+	*tokens = new_tokens;
+}
+
+/* Destroys tokens and every token stream chained after it */
+void cil_parse_tokens_destroy(struct cil_parse_tokens **tokens)
+{
+	struct cil_parse_tokens *curr = NULL;
+	struct cil_parse_tokens *next = NULL;
+
+	if (tokens == NULL) {
+		return;
+	}
+
+	for (curr = *tokens; curr != NULL; curr = next) {
+		next = curr->next;
+		free(curr->tokens);
+		free(curr);
+	}
+
+	*tokens = NULL;
+}
+
+uint32_t cil_parse_tokens_add(struct cil_parse_tokens *tokens, char *data, uint32_t line, int32_t match)
+{
+	struct cil_parse_token *token = NULL;
+
+	if (tokens->count == tokens->alloc) {
+		tokens->alloc = tokens->alloc ? tokens->alloc * 2 : CIL_PARSE_TOKENS_INITIAL;
+		tokens->tokens = cil_realloc(tokens->tokens, sizeof(*tokens->tokens) * tokens->alloc);
+	}
+
+	token = &tokens->tokens[tokens->count];
+	token->data = data;
+	token->line = line;
+	token->match = match;
+
+	return tokens->count++;
+}
+
+/* The first item of the list opened at token, or NULL if the list is empty
+ * or token is a symbol */
+struct cil_parse_token *cil_parse_token_child(struct cil_parse_token *token)
+{
+	if (token->data != NULL || token->match == 1) {
+		return NULL;
+	}
+
+	return token + 1;
+}
+
+/* The item following token in the same list, or NULL at the end of the list.
+ * token must not be a top level statement, which has nothing after it to
+ * stop at. */
+struct cil_parse_token *cil_parse_token_next(struct cil_parse_token *token)
+{
+	struct cil_parse_token *next = token + (token->data == NULL ? token->match : 0) + 1;
 
-	struct cil_tree *tree = NULL;
+	if (next->data == NULL && next->match < 0) {
+		/* The close parenthesis of the enclosing list */
+		return NULL;
+	}
+
+	return next;
+}
+
+/* Copy the list opened at token, parentheses included, into the current
+ * arena so that it outlives its token stream */
+struct cil_parse_token *cil_parse_token_copy(struct cil_parse_token *token)
+{
+	uint32_t count = token->match + 1;
+	struct cil_parse_token *copy = cil_arena_alloc(sizeof(*copy) * count);
+
+	memcpy(copy, token, sizeof(*copy) * count);
+
+	return copy;
+}
+
+void cil_parse_token_release(struct cil_parse_token *copy)
+{
+	cil_arena_release(copy, sizeof(*copy) * (copy->match + 1));
+}
+
+/* Build the parse tree of statement and append it to the children of root */
+static void __cil_parse_tokens_tree(struct cil_parse_token *statement, struct cil_tree_node *root)
+{
+	struct cil_parse_token *token = NULL;
+	struct cil_parse_token *end = statement + statement->match;
+	struct cil_tree_node *current = root;
 	struct cil_tree_node *node = NULL;
-	struct cil_tree_node *item = NULL;
-	struct cil_tree_node *current = NULL;
+
+	for (token = statement; token <= end; token++) {
+		if (token->data == NULL && token->match < 0) {
+			current = cil_tree_node_parent(current);
+			continue;
+		}
+
+		cil_tree_node_init(&node);
+		cil_tree_node_set_parent(node, current);
+		node->flavor = CIL_NODE;
+		node->loc = token->loc;
+		node->data = token->data;
+		if (cil_tree_node_head(current) == NULL) {
+			cil_tree_node_set_head(current, node);
+		} else {
+			cil_tree_node_set_next(cil_tree_node_tail(current), node);
+		}
+		cil_tree_node_set_tail(current, node);
+		if (token->data == NULL) {
+			current = node;
+		}
+	}
+}
+
+/* Replace the line of each token of statement with its source location */
+static void __cil_parse_tokens_locate(char *path, struct cil_parse_token *statement)
+{
+	struct cil_parse_token *token = NULL;
+	struct cil_parse_token *end = statement + statement->match;
+	uint32_t first = statement->line;
+	uint32_t last = first;
+	uint32_t loc;
+
+	for (token = statement; token <= end; token++) {
+		if (token->line > last) {
+			last = token->line;
+		}
+	}
+	loc = cil_tree_loc_add(path, first, last);
+
+	for (token = statement; token <= end; token++) {
+		token->loc = loc + (token->line - first);
+	}
+}
+
+/* Pass each top level statement of tokens to process_statement, which walks
+ * it with cil_parse_token_child() and cil_parse_token_next(). The tokens of
+ * a statement hold source locations from then on, so a stream can only be
+ * walked once. */
+int cil_parse_tokens_walk(struct cil_parse_tokens *tokens, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args)
+{
+	int rc = SEPOL_OK;
+	struct cil_parse_token *statement = NULL;
+	uint32_t i;
+
+	for (i = 0; i < tokens->count; i += statement->match + 1) {
+		statement = &tokens->tokens[i];
+		__cil_parse_tokens_locate(tokens->path, statement);
+		rc = (*process_statement)(statement, extra_args);
+		if (rc != SEPOL_OK) {
+			break;
+		}
+	}
+
+	return rc;
+}
+
+/* Lex buffer into tokens. While a list is open its match field holds the
+ * distance back to the enclosing open parenthesis, or 0 at the top level,
+ * and is pointed at the matching close once it is read. If process_statement
+ * is given it is called for each top level statement as soon as it is
+ * complete, after which the tokens are reused for the next statement. Line
+ * numbers are counted from first_line. */
+static int __cil_parser(char *_path, char *buffer, uint32_t size, uint32_t first_line, struct cil_parse_tokens *tokens, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args)
+{
+	int rc = SEPOL_ERR;
+	int paren_count = 0;
+	uint32_t open = 0;
+	uint32_t close;
+	int32_t enclosing;
 	char *path = cil_strpool_add(_path);
 
+	struct cil_lexer *lexer = NULL;
 	struct token tok;
 
-	cil_lexer_setup(buffer, size);
+	rc = cil_lexer_setup(&lexer, buffer, size);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
 
-	tree = *parse_tree;
-	current = tree->root;	
+	tokens->path = path;
 
 	do {
-		cil_lexer_next(&tok);
+		cil_lexer_next(lexer, &tok);
+		tok.line += first_line - 1;
 		switch (tok.type) {
 		case OPAREN:
+			enclosing = (paren_count > 0) ? tokens->count - open : 0;
 			paren_count++;
-			cil_tree_node_init(&node);
-			node->parent = current;
-			node->flavor = CIL_NODE;
-			node->line = tok.line;
-			node->path = path;
-			if (current->cl_head == NULL) {
-				current->cl_head = node;
-			} else {
-				current->cl_tail->next = node;
-			}
-			current->cl_tail = node;
-			current = node;
+			open = cil_parse_tokens_add(tokens, NULL, tok.line, enclosing);
 			break;
 		case CPAREN:
 			paren_count--;
 			if (paren_count < 0) {
 				cil_log(CIL_ERR, "Close parenthesis without matching open at line %d of %s\n", tok.line, path);
-				return SEPOL_ERR;
+				rc = SEPOL_ERR;
+				goto exit;
+			}
+			/* A close parenthesis has no line of its own in the parse
+			 * tree, so it takes the line of its open */
+			close = cil_parse_tokens_add(tokens, NULL, tokens->tokens[open].line, 0);
+			enclosing = tokens->tokens[open].match;
+			tokens->tokens[open].match = close - open;
+			tokens->tokens[close].match = -tokens->tokens[open].match;
+			open -= enclosing;
+			if (paren_count == 0 && process_statement != NULL) {
+				rc = cil_parse_tokens_walk(tokens, process_statement, extra_args);
+				tokens->count = 0;
+				if (rc != SEPOL_OK) {
+					goto exit;
+				}
 			}
-			current = current->parent;
 			break;
 		case SYMBOL:
 		case QSTRING:
 			if (paren_count == 0) {
 				cil_log(CIL_ERR, "Symbol not inside parenthesis at line %d of %s\n", tok.line, path);
-				return SEPOL_ERR;
+				rc = SEPOL_ERR;
+				goto exit;
 			}
-			cil_tree_node_init(&item);
-			item->parent = current;
 			if (tok.type == QSTRING) {
-				tok.value[strlen(tok.value) - 1] = '\0';
-				item->data = cil_strpool_add(tok.value + 1);
+				cil_parse_tokens_add(tokens, cil_strpool_add_len(tok.value + 1, tok.len - 2), tok.line, 0);
 			} else {
-				item->data = cil_strpool_add(tok.value);
+				cil_parse_tokens_add(tokens, cil_strpool_add_len(tok.value, tok.len), tok.line, 0);
 			}
-			item->flavor = CIL_NODE;
-			item->line = tok.line;
-			item->path = path;
-			if (current->cl_head == NULL) {
-				current->cl_head = item;
-			} else {
-				current->cl_tail->next = item;
-			}
-			current->cl_tail = item;
 			break;
 		case END_OF_FILE:
 			if (paren_count > 0) {
 				cil_log(CIL_ERR, "Open parenthesis without matching close at line %d of %s\n", tok.line, path);
-				return SEPOL_ERR;
+				rc = SEPOL_ERR;
+				goto exit;
 			}
 			break;
 		case COMMENT:
@@ -119,17 +291,89 @@ int cil_parser(char *_path, char *buffer, uint32_t size, struct cil_tree **parse
 			break;
 		case UNKNOWN:
 			cil_log(CIL_ERR, "Invalid token '%s' at line %d of %s\n", tok.value, tok.line, path);
-			return SEPOL_ERR;
+			rc = SEPOL_ERR;
+			goto exit;
 		default:
 			cil_log(CIL_ERR, "Unknown token type '%d' at line %d of %s\n", tok.type, tok.line, path);
-			return SEPOL_ERR;
+			rc = SEPOL_ERR;
+			goto exit;
 		}
 	}
 	while (tok.type != END_OF_FILE);
 
-	cil_lexer_destroy();
+	rc = SEPOL_OK;
+
+exit:
+	cil_lexer_destroy(&lexer);
 
-	*parse_tree = tree;
+	return rc;
+}
 
-	return SEPOL_OK;
+/* Names this build of the parser, for keying cached parses */
+const char *cil_parser_build(void)
+{
+	return __DATE__ " " __TIME__;
+}
+
+/* Parse buffer into tokens, which must be empty */
+int cil_parser_tokens(char *path, char *buffer, uint32_t size, struct cil_parse_tokens *tokens)
+{
+	int rc = __cil_parser(path, buffer, size, 1, tokens, NULL, NULL);
+
+	if (rc != SEPOL_OK) {
+		tokens->count = 0;
+	}
+
+	return rc;
+}
+
+int cil_parser(char *path, char *buffer, uint32_t size, struct cil_tree **parse_tree)
+{
+	int rc = SEPOL_ERR;
+	struct cil_parse_tokens *tokens = NULL;
+	uint32_t i;
+
+	cil_parse_tokens_init(&tokens);
+
+	rc = cil_parser_tokens(path, buffer, size, tokens);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	for (i = 0; i < tokens->count; i += tokens->tokens[i].match + 1) {
+		__cil_parse_tokens_locate(tokens->path, &tokens->tokens[i]);
+		__cil_parse_tokens_tree(&tokens->tokens[i], (*parse_tree)->root);
+	}
+
+exit:
+	cil_parse_tokens_destroy(&tokens);
+
+	return rc;
+}
+
+/* Parse buffer one top level statement at a time. As soon as the closing
+ * parenthesis of a statement is read, process_statement is called with its
+ * open parenthesis as by cil_parse_tokens_walk(). The tokens are reused when
+ * process_statement returns, so they do not accumulate. */
+int cil_parser_stream(char *path, char *buffer, uint32_t size, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args)
+{
+	int rc = SEPOL_ERR;
+	struct cil_parse_tokens *tokens = NULL;
+
+	cil_parse_tokens_init(&tokens);
+
+	rc = __cil_parser(path, buffer, size, 1, tokens, process_statement, extra_args);
+
+	cil_parse_tokens_destroy(&tokens);
+
+	return rc;
+}
+
+/* Parse a piece of a file that begins at first_line and holds only whole
+ * top level statements. Without process_statement the statements are
+ * appended to tokens, otherwise they are passed on one at a time as by
+ * cil_parser_stream() and tokens is left empty. */
+int cil_parser_chunk(char *path, char *buffer, uint32_t size, uint32_t first_line, struct cil_parse_tokens *tokens, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args)
+{
+	return __cil_parser(path, buffer, size, first_line, tokens, process_statement, extra_args);
 }
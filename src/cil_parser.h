@@ -30,8 +30,46 @@
 #ifndef CIL_PARSER_H_
 #define CIL_PARSER_H_
 
+#include <stdint.h>
+
 #include "cil_tree.h"
 
+/* A parenthesis or symbol of a parsed file. Parentheses have no data, and
+ * match holds the distance from an open parenthesis forward to its close, or
+ * from a close back to its open as a negative number. A token holds the line
+ * it was read from until cil_parse_tokens_walk() reaches its statement, which
+ * replaces the line with the token's source location. */
+struct cil_parse_token {
+	char *data;
+	union {
+		uint32_t line;
+		uint32_t loc;
+	};
+	int32_t match;
+};
+
+/* The tokens of one file, in order */
+struct cil_parse_tokens {
+	char *path;
+	struct cil_parse_token *tokens;
+	uint32_t count;
+	uint32_t alloc;
+	struct cil_parse_tokens *next;
+};
+
+void cil_parse_tokens_init(struct cil_parse_tokens **tokens);
+void cil_parse_tokens_destroy(struct cil_parse_tokens **tokens);
+uint32_t cil_parse_tokens_add(struct cil_parse_tokens *tokens, char *data, uint32_t line, int32_t match);
+struct cil_parse_token *cil_parse_token_child(struct cil_parse_token *token);
+struct cil_parse_token *cil_parse_token_next(struct cil_parse_token *token);
+struct cil_parse_token *cil_parse_token_copy(struct cil_parse_token *token);
+void cil_parse_token_release(struct cil_parse_token *copy);
+int cil_parse_tokens_walk(struct cil_parse_tokens *tokens, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args);
+
+const char *cil_parser_build(void);
+int cil_parser_tokens(char *path, char *buffer, uint32_t size, struct cil_parse_tokens *tokens);
 int cil_parser(char *path, char *buffer, uint32_t size, struct cil_tree **parse_tree);
+int cil_parser_stream(char *path, char *buffer, uint32_t size, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args);
+int cil_parser_chunk(char *path, char *buffer, uint32_t size, uint32_t first_line, struct cil_parse_tokens *tokens, int (*process_statement)(struct cil_parse_token *statement, void *extra_args), void *extra_args);
 
 #endif /* CIL_PARSER_H_ */
@@ -415,7 +415,12 @@ int cil_sens_to_policy(FILE **file_arr, struct cil_list *sens)
 
 void cil_cats_to_policy(FILE **file_arr, uint32_t file_index, struct cil_cats *cats)
 {
-	cil_expr_to_policy(file_arr, file_index, cats->datum_expr);
+	struct cil_symtab_datum *cat;
+	uint32_t i;
+
+	cil_vector_for_each(cat, i, &cats->datums) {
+		fprintf(file_arr[file_index], "%s%s", i == 0 ? "" : ",", cat->name);
+	}
 }
 
 void cil_level_to_policy(FILE **file_arr, uint32_t file_index, struct cil_level *level)
@@ -450,53 +455,14 @@ void cil_context_to_policy(FILE **file_arr, uint32_t file_index, struct cil_cont
 	cil_levelrange_to_policy(file_arr, file_index, lvlrange);
 }
 
-void cil_perms_to_policy(FILE **file_arr, uint32_t file_index, struct cil_list *list)
+void cil_perms_to_policy(FILE **file_arr, uint32_t file_index, struct cil_vector *perms)
 {
-	struct cil_list_item *curr;
+	struct cil_symtab_datum *perm;
+	uint32_t i;
 
 	fprintf(file_arr[file_index], " {");
-	cil_list_for_each(curr, list) {
-		switch (curr->flavor) {
-		case CIL_LIST:
-			cil_perms_to_policy(file_arr, file_index, curr->data);
-			break;
-		case CIL_STRING:
-			fprintf(file_arr[file_index], " %s", (char *)curr->data);
-			break;
-		case CIL_DATUM:
-			fprintf(file_arr[file_index], " %s", ((struct cil_symtab_datum *)curr->data)->name);
-			break;
-		case CIL_OP: {
-			enum cil_flavor op_flavor = *((enum cil_flavor *)curr->data);
-			char *op_str = NULL;
-
-			switch (op_flavor) {
-			case CIL_AND:
-				op_str = CIL_KEY_AND;
-				break;
-			case CIL_OR:
-				op_str = CIL_KEY_OR;
-				break;
-			case CIL_NOT:
-				op_str = CIL_KEY_NOT;
-				break;
-			case CIL_ALL:
-				op_str = CIL_KEY_ALL;
-				break;
-			case CIL_XOR:
-				op_str = CIL_KEY_XOR;
-				break;
-			default:
-				cil_log(CIL_ERR, "Unknown operator in expression\n");
-				break;
-			}
-			fprintf(file_arr[file_index], " %s", op_str);
-			break;
-		}
-		default:
-			cil_log(CIL_ERR, "Unknown flavor in expression\n");
-			break;
-		}
+	cil_vector_for_each(perm, i, perms) {
+		fprintf(file_arr[file_index], " %s", perm->name);
 	}
 	fprintf(file_arr[file_index], " }");
 }
@@ -510,14 +476,14 @@ void cil_constrain_to_policy_helper(FILE **file_arr, char *kind, struct cil_list
 			struct cil_classperms *cp = curr->data;
 			if (FLAVOR(cp->class) == CIL_CLASS) {
 				fprintf(file_arr[CONSTRAINS], "%s %s", kind, cp->class->datum.name);
-				cil_perms_to_policy(file_arr, CONSTRAINS, cp->perms);
+				cil_perms_to_policy(file_arr, CONSTRAINS, &cp->datums);
 				fprintf(file_arr[CONSTRAINS], "\n\t");
 				cil_expr_to_policy(file_arr, CONSTRAINS, expr);
 				fprintf(file_arr[CONSTRAINS], ";\n");
 			} else { /* MAP */
-				struct cil_list_item *i = NULL;
-				cil_list_for_each(i, cp->perms) {
-					struct cil_perm *cmp = i->data;
+				struct cil_perm *cmp;
+				uint32_t i;
+				cil_vector_for_each(cmp, i, &cp->datums) {
 					cil_constrain_to_policy_helper(file_arr, kind, cmp->classperms, expr);
 				}
 			}	
@@ -551,12 +517,12 @@ void cil_avrule_to_policy_helper(FILE **file_arr, uint32_t file_index, const cha
 			struct cil_classperms *cp = i->data;
 			if (FLAVOR(cp->class) == CIL_CLASS) {
 				fprintf(file_arr[file_index], "%s %s %s: %s", kind, src, tgt, cp->class->datum.name);
-				cil_perms_to_policy(file_arr, file_index, cp->perms);
+				cil_perms_to_policy(file_arr, file_index, &cp->datums);
 				fprintf(file_arr[file_index], ";\n");
 			} else { /* MAP */
-				struct cil_list_item *j = NULL;
-				cil_list_for_each(j, cp->perms) {
-					struct cil_perm *cmp = j->data;
+				struct cil_perm *cmp;
+				uint32_t j;
+				cil_vector_for_each(cmp, j, &cp->datums) {
 					cil_avrule_to_policy_helper(file_arr, file_index, kind, src, tgt, cmp->classperms);
 				}
 			}
@@ -874,7 +840,7 @@ int __cil_booleanif_last_child_helper(struct cil_tree_node *node, void *extra_ar
 	file_arr = args->file_arr;
 	file_index = args->file_index;
 
-	if (node->parent->flavor == CIL_FALSE) {
+	if (cil_tree_node_parent(node)->flavor == CIL_FALSE) {
 		fprintf(file_arr[*file_index], "}\n");
 	}
 	
@@ -902,21 +868,21 @@ int cil_booleanif_to_policy(FILE **file_arr, uint32_t file_index, struct cil_tre
 		return rc;
 	}
 
-	if (node->cl_head != NULL && node->cl_head->flavor == CIL_CONDBLOCK) {
-		cb = node->cl_head->data;
+	if (cil_tree_node_head(node) != NULL && cil_tree_node_head(node)->flavor == CIL_CONDBLOCK) {
+		cb = cil_tree_node_head(node)->data;
 		if (cb->flavor == CIL_CONDTRUE) {
-			true_node = node->cl_head;
+			true_node = cil_tree_node_head(node);
 		} else if (cb->flavor == CIL_CONDFALSE) {
-			false_node = node->cl_head;
+			false_node = cil_tree_node_head(node);
 		}
 	}
 
-	if (node->cl_head != NULL && node->cl_head->next != NULL && node->cl_head->next->flavor == CIL_CONDBLOCK) {
-		cb = node->cl_head->next->data;
+	if (cil_tree_node_head(node) != NULL && cil_tree_node_next(cil_tree_node_head(node)) != NULL && cil_tree_node_next(cil_tree_node_head(node))->flavor == CIL_CONDBLOCK) {
+		cb = cil_tree_node_next(cil_tree_node_head(node))->data;
 		if (cb->flavor == CIL_CONDTRUE) {
-			true_node = node->cl_head->next;
+			true_node = cil_tree_node_next(cil_tree_node_head(node));
 		} else if (cb->flavor == CIL_CONDFALSE) {
-			false_node = node->cl_head->next;
+			false_node = cil_tree_node_next(cil_tree_node_head(node));
 		}
 	}
 
@@ -981,8 +947,8 @@ int cil_name_to_policy(FILE **file_arr, struct cil_tree_node *current)
 	case CIL_COMMON:
 		fprintf(file_arr[COMMONS], "common %s", ((struct cil_symtab_datum*)current->data)->name);
 
-		if (current->cl_head != NULL) {
-			current = current->cl_head;
+		if (cil_tree_node_head(current) != NULL) {
+			current = cil_tree_node_head(current);
 			fprintf(file_arr[COMMONS], " {");
 		} else {
 			cil_log(CIL_INFO, "No permissions given\n");
@@ -996,7 +962,7 @@ int cil_name_to_policy(FILE **file_arr, struct cil_tree_node *current)
 				cil_log(CIL_INFO, "Improper data type found in common permissions: %d\n", current->flavor);
 				return SEPOL_ERR;
 			}
-			current = current->next;
+			current = cil_tree_node_next(current);
 		}
 		fprintf(file_arr[COMMONS], "}\n");
 
@@ -1121,7 +1087,7 @@ int __cil_gen_policy_node_helper(struct cil_tree_node *node, uint32_t *finished,
 	cats = args->cats;
 	file_arr = args->file_arr;
 
-	if (node->cl_head != NULL) {
+	if (cil_tree_node_head(node) != NULL) {
 		if (node->flavor == CIL_MACRO) {
 			*finished = CIL_TREE_SKIP_HEAD;
 			return SEPOL_OK;
@@ -1275,7 +1241,7 @@ int cil_gen_policy(struct cil_db *db)
 
 	cil_list_for_each(item, db->classorder) {
 		struct cil_class *class = item->data;
-		struct cil_tree_node *node = class->datum.nodes->head->data;
+		struct cil_tree_node *node = cil_vector_get(&class->datum.nodes, 0);
 
 		fprintf(file_arr[CLASS_DECL], "class %s\n", class->datum.name);
 
@@ -1283,12 +1249,12 @@ int cil_gen_policy(struct cil_db *db)
 		if (class->common != NULL) {
 			fprintf(file_arr[CLASSES], "inherits %s ", class->common->datum.name);
 		}
-		if (node->cl_head != NULL) {
-			struct cil_tree_node *curr_perm = node->cl_head;
+		if (cil_tree_node_head(node) != NULL) {
+			struct cil_tree_node *curr_perm = cil_tree_node_head(node);
 			fprintf(file_arr[CLASSES], "{ ");
 			while (curr_perm != NULL) {
 				fprintf(file_arr[CLASSES], "%s ", ((struct cil_symtab_datum*)curr_perm->data)->name);
-				curr_perm = curr_perm->next;
+				curr_perm = cil_tree_node_next(curr_perm);
 			}
 			fprintf(file_arr[CLASSES], "}");
 		}
@@ -41,6 +41,7 @@
 #include "cil_log.h"
 #include "cil_mem.h"
 #include "cil_tree.h"
+#include "cil_index.h"
 #include "cil_list.h"
 #include "cil_post.h"
 #include "cil_policy.h"
@@ -65,7 +66,7 @@ static int cil_verify_is_list(struct cil_list *list, enum cil_flavor flavor)
 		default:
 			if (flavor == CIL_CAT) {
 				struct cil_symtab_datum *d = curr->data;
-				struct cil_tree_node *n = d->nodes->head->data;
+				struct cil_tree_node *n = cil_vector_get(&d->nodes, 0);
 				if (n->flavor == CIL_CATSET) {
 					return CIL_FALSE;
 				}
@@ -313,24 +314,15 @@ int cil_post_fsuse_compare(const void *a, const void *b)
 	return rc;
 }
 
-static int __cil_post_db_count_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args)
+static int __cil_post_db_count_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	struct cil_db *db = extra_args;
 
 	switch(node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO:
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
 	case CIL_TYPE: {
 		struct cil_type *type = node->data;
-		if (type->datum.nodes->head->data == node) {
+		if (cil_vector_get(&type->datum.nodes, 0) == node) {
 			// multiple AST nodes can point to the same cil_type data (like if
 			// copied from a macro). This check ensures we only count the
 			// duplicates once
@@ -341,7 +333,7 @@ static int __cil_post_db_count_helper(struct cil_tree_node *node, uint32_t *fini
 	}
 	case CIL_ROLE: {
 		struct cil_role *role = node->data;
-		if (role->datum.nodes->head->data == node) {
+		if (cil_vector_get(&role->datum.nodes, 0) == node) {
 			// multiple AST nodes can point to the same cil_role data (like if
 			// copied from a macro). This check ensures we only count the
 			// duplicates once
@@ -387,21 +379,12 @@ static int __cil_post_db_count_helper(struct cil_tree_node *node, uint32_t *fini
 	return SEPOL_OK;
 }
 
-static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+static int __cil_post_db_array_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	struct cil_db *db = extra_args;
 
 	switch(node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO:
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
 	case CIL_TYPE: {
 		struct cil_type *type = node->data;
 		if (db->val_to_type == NULL) {
@@ -435,7 +418,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -446,7 +429,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -457,7 +440,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -468,7 +451,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-		sort->array = cil_malloc(sizeof(*sort->array)*count);
+		sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -479,7 +462,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -490,7 +473,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -501,7 +484,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -512,7 +495,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -523,7 +506,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -534,7 +517,7 @@ static int __cil_post_db_array_helper(struct cil_tree_node *node, __attribute__(
 		uint32_t count = sort->count;
 		uint32_t i = sort->index;
 		if (sort->array == NULL) {
-			sort->array = cil_malloc(sizeof(*sort->array)*count);
+			sort->array = cil_arena_alloc(sizeof(*sort->array)*count);
 		}
 		sort->array[i] = node->data;
 		sort->index++;
@@ -551,13 +534,11 @@ static int __evaluate_type_expression(struct cil_typeattribute *attr, struct cil
 {
 	int rc;
 
-	attr->types = cil_malloc(sizeof(*attr->types));
+	cil_ebitmap_init(&attr->types);
 	rc = __cil_expr_list_to_bitmap(attr->expr_list, attr->types, db->num_types, db);
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_ERR, "Failed to expand type attribute to bitmap\n");
-		ebitmap_destroy(attr->types);
-		free(attr->types);
-		attr->types = NULL;
+		cil_ebitmap_destroy(&attr->types);
 	}
 	return rc;
 }
@@ -565,7 +546,7 @@ static int __evaluate_type_expression(struct cil_typeattribute *attr, struct cil
 static int __cil_type_to_bitmap(struct cil_symtab_datum *datum, ebitmap_t *bitmap, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	ebitmap_init(bitmap);
 
@@ -603,13 +584,11 @@ static int __evaluate_role_expression(struct cil_roleattribute *attr, struct cil
 {
 	int rc;
 
-	attr->roles = cil_malloc(sizeof(*attr->roles));
+	cil_ebitmap_init(&attr->roles);
 	rc = __cil_expr_list_to_bitmap(attr->expr_list, attr->roles, db->num_roles, db);
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_ERR, "Failed to expand role attribute to bitmap\n");
-		ebitmap_destroy(attr->roles);
-		free(attr->roles);
-		attr->roles = NULL;
+		cil_ebitmap_destroy(&attr->roles);
 	}
 	return rc;
 }
@@ -617,7 +596,7 @@ static int __evaluate_role_expression(struct cil_roleattribute *attr, struct cil
 static int __cil_role_to_bitmap(struct cil_symtab_datum *datum, ebitmap_t *bitmap, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	ebitmap_init(bitmap);
 
@@ -662,7 +641,6 @@ static int __evaluate_cat_expression(struct cil_cats *cats, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
 	ebitmap_t bitmap;
-	struct cil_list *new;
 	struct cil_list_item *curr;
 
 	if (cats->evaluated == CIL_TRUE) {
@@ -670,6 +648,10 @@ static int __evaluate_cat_expression(struct cil_cats *cats, struct cil_db *db)
 	}
 
 	if (cil_verify_is_list(cats->datum_expr, CIL_CAT)) {
+		cil_list_for_each(curr, cats->datum_expr) {
+			cil_vector_append(&cats->datums, curr->data);
+		}
+		cats->evaluated = CIL_TRUE;
 		return SEPOL_OK;
 	}
 
@@ -681,24 +663,14 @@ static int __evaluate_cat_expression(struct cil_cats *cats, struct cil_db *db)
 		goto exit;
 	}
 
-	cil_list_init(&new, CIL_CAT);
-
 	cil_list_for_each(curr, db->catorder) {
 		struct cil_cat *cat = curr->data;
 		if (ebitmap_get_bit(&bitmap, cat->value)) {
-			cil_list_append(new, CIL_DATUM, cat);
+			cil_vector_append(&cats->datums, cat);
 		}
 	}
 
 	ebitmap_destroy(&bitmap);
-	cil_list_destroy(&cats->datum_expr, CIL_FALSE);
-	if (new->head != NULL) { 
-		cats->datum_expr = new;
-	} else {
-		/* empty list */
-		cil_list_destroy(&new, CIL_FALSE);
-		cats->datum_expr = NULL;
-	}
 
 	cats->evaluated = CIL_TRUE;
 
@@ -711,19 +683,19 @@ exit:
 static int __cil_cat_to_bitmap(struct cil_symtab_datum *datum, ebitmap_t *bitmap, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	ebitmap_init(bitmap);
 
 	if (node->flavor == CIL_CATSET) {
 		struct cil_catset *catset = (struct cil_catset *)datum;
-		struct cil_list_item *curr;
+		struct cil_cat *cat;
+		uint32_t i;
 		if (catset->cats->evaluated == CIL_FALSE) {
 			rc = __evaluate_cat_expression(catset->cats, db);
 			if (rc != SEPOL_OK) goto exit;
 		}
-		for (curr = catset->cats->datum_expr->head; curr; curr = curr->next) {
-			struct cil_cat *cat = (struct cil_cat *)curr->data;
+		cil_vector_for_each(cat, i, &catset->cats->datums) {
 			if (ebitmap_set_bit(bitmap, cat->value, 1)) {
 				cil_log(CIL_ERR, "Failed to set cat bit\n");
 				ebitmap_destroy(bitmap);
@@ -758,8 +730,8 @@ static int __cil_expr_range_to_bitmap_helper(struct cil_list_item *i1, struct ci
 	int rc = SEPOL_ERR;
 	struct cil_symtab_datum *d1 = i1->data;
 	struct cil_symtab_datum *d2 = i2->data;
-	struct cil_tree_node *n1 = d1->nodes->head->data;
-	struct cil_tree_node *n2 = d2->nodes->head->data;
+	struct cil_tree_node *n1 = cil_vector_get(&d1->nodes, 0);
+	struct cil_tree_node *n2 = cil_vector_get(&d2->nodes, 0);
 	struct cil_cat *c1 = (struct cil_cat *)d1;
 	struct cil_cat *c2 = (struct cil_cat *)d2;
 	int i;
@@ -967,23 +939,13 @@ exit:
 	return SEPOL_ERR;
 }
 
-static int __cil_post_db_attr_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+static int __cil_post_db_attr_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	int rc = SEPOL_ERR;
 	struct cil_db *db = extra_args;
 
 	switch (node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO: {
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
-	}
 	case CIL_TYPEATTRIBUTE: {
 		struct cil_typeattribute *attr = node->data;
 		if (attr->types == NULL) {
@@ -1012,11 +974,10 @@ exit:
 
 static int __cil_role_assign_types(struct cil_role *role, struct cil_symtab_datum *datum)
 {
-	struct cil_tree_node *node = datum->nodes->head->data;
+	struct cil_tree_node *node = cil_vector_get(&datum->nodes, 0);
 
 	if (role->types == NULL) {
-		role->types = cil_malloc(sizeof(*role->types));
-		ebitmap_init(role->types);
+		cil_ebitmap_init(&role->types);
 	}
 
 	if (node->flavor == CIL_TYPE) {
@@ -1043,28 +1004,18 @@ exit:
 	return SEPOL_ERR;
 }
 
-static int __cil_post_db_roletype_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+static int __cil_post_db_roletype_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	int rc = SEPOL_ERR;
 	struct cil_db *db = extra_args;
 
 	switch (node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO: {
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
-	}
 	case CIL_ROLETYPE: {
 		struct cil_roletype *roletype = node->data;
 		struct cil_symtab_datum *role_datum = roletype->role;
 		struct cil_symtab_datum *type_datum = roletype->type;
-		struct cil_tree_node *role_node = role_datum->nodes->head->data;
+		struct cil_tree_node *role_node = cil_vector_get(&role_datum->nodes, 0);
 
 		if (role_node->flavor == CIL_ROLEATTRIBUTE) {
 			struct cil_roleattribute *attr = roletype->role;
@@ -1135,23 +1086,13 @@ exit:
 	return rc;
 }
 
-static int __cil_post_db_cat_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args)
+static int __cil_post_db_cat_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	int rc = SEPOL_ERR;
 	struct cil_db *db = extra_args;
 
 	switch (node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO: {
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
-	}
 	case CIL_CATSET: {
 		struct cil_catset *catset = node->data;
 		rc = __evaluate_cat_expression(catset->cats, db);
@@ -1323,17 +1264,15 @@ exit:
 	return rc;
 }
 
-struct perm_to_list {
-	enum cil_flavor flavor;
+struct perm_to_vector {
 	ebitmap_t *perms;
-	struct cil_list *new_list;
+	struct cil_vector *datums;
 };
 
-static int __perm_bits_to_list(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, void *args)
+static int __perm_bits_to_vector(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, void *args)
 {
-	struct perm_to_list *perm_args = (struct perm_to_list *)args;
+	struct perm_to_vector *perm_args = (struct perm_to_vector *)args;
 	ebitmap_t *perms = perm_args->perms;
-	struct cil_list *new_list = perm_args->new_list;
 	struct cil_perm *perm = (struct cil_perm *)d;
 	unsigned int value = perm->value;
 
@@ -1341,18 +1280,22 @@ static int __perm_bits_to_list(__attribute__((unused)) hashtab_key_t k, hashtab_
 		return SEPOL_OK;
 	}
 
-	cil_list_append(new_list, CIL_DATUM, d);
+	cil_vector_append(perm_args->datums, d);
 
 	return SEPOL_OK;
 }
 
-static int __evaluate_perm_expression(struct cil_list *perms, enum cil_flavor flavor, symtab_t *class_symtab, symtab_t *common_symtab, unsigned int num_perms, struct cil_list **new_list, struct cil_db *db)
+static int __evaluate_perm_expression(struct cil_list *perms, struct cil_symtab *class_symtab, struct cil_symtab *common_symtab, unsigned int num_perms, struct cil_vector *datums, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
-	struct perm_to_list args;
+	struct perm_to_vector args;
+	struct cil_list_item *curr;
 	ebitmap_t bitmap;
 
 	if (cil_verify_is_list(perms, CIL_PERM)) {
+		cil_list_for_each(curr, perms) {
+			cil_vector_append(datums, curr->data);
+		}
 		return SEPOL_OK;
 	}
 
@@ -1363,16 +1306,13 @@ static int __evaluate_perm_expression(struct cil_list *perms, enum cil_flavor fl
 		goto exit;
 	}
 
-	cil_list_init(new_list, flavor);
-
-	args.flavor = flavor;
 	args.perms = &bitmap;
-	args.new_list = *new_list;
+	args.datums = datums;
 
-	cil_symtab_map(class_symtab, __perm_bits_to_list, &args);
+	cil_symtab_map(class_symtab, __perm_bits_to_vector, &args);
 
 	if (common_symtab != NULL) {
-		cil_symtab_map(common_symtab, __perm_bits_to_list, &args);
+		cil_symtab_map(common_symtab, __perm_bits_to_vector, &args);
 	}
 
 	ebitmap_destroy(&bitmap);
@@ -1382,30 +1322,31 @@ exit:
 	return rc;
 }
 
+/* Fill in the permissions of a class or map class, in the order they are
+ * listed, or in the order the class declares them when they are given by
+ * an expression */
 static int __evaluate_classperms(struct cil_classperms *cp, struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
 	struct cil_class *class = cp->class;
 	struct cil_class *common = class->common;
-	symtab_t *common_symtab = NULL;
-	struct cil_list *new_list = NULL;
+	struct cil_symtab *common_symtab = NULL;
+
+	if (cp->evaluated == CIL_TRUE) {
+		return SEPOL_OK;
+	}
 
 	if (common) {
 		common_symtab = &common->perms;
 	}
 
-	rc = __evaluate_perm_expression(cp->perms, CIL_PERM, &class->perms, common_symtab, class->num_perms, &new_list, db);
+	rc = __evaluate_perm_expression(cp->perms, &class->perms, common_symtab, class->num_perms, &cp->datums, db);
 	if (rc != SEPOL_OK) {
+		cil_vector_destroy(&cp->datums);
 		goto exit;
 	}
 
-	if (new_list == NULL) {
-		return SEPOL_OK;
-	}
-
-	cil_list_destroy(&cp->perms, CIL_FALSE);
-
-	cp->perms = new_list;
+	cp->evaluated = CIL_TRUE;
 
 	return SEPOL_OK;
 
@@ -1421,21 +1362,20 @@ static int __evaluate_classperms_list(struct cil_list *classperms, struct cil_db
 	cil_list_for_each(curr, classperms) {
 		if (curr->flavor == CIL_CLASSPERMS) {
 			struct cil_classperms *cp = curr->data;
-			if (FLAVOR(cp->class) == CIL_CLASS) {
-				rc = __evaluate_classperms(cp, db);
-				if (rc != SEPOL_OK) {
-					goto exit;
-				}
-			} else { /* MAP */
-				struct cil_list_item *i = NULL;
-				cil_list_for_each(i, cp->perms) {
-					struct cil_perm *cmp = i->data;
+			rc = __evaluate_classperms(cp, db);
+			if (rc != SEPOL_OK) {
+				goto exit;
+			}
+			if (FLAVOR(cp->class) == CIL_MAP_CLASS) {
+				struct cil_perm *cmp;
+				uint32_t i;
+				cil_vector_for_each(cmp, i, &cp->datums) {
 					rc = __evaluate_classperms_list(cmp->classperms, db);
 					if (rc != SEPOL_OK) {
 						goto exit;
 					}
 				}
-			}	
+			}
 		} else { /* SET */
 			struct cil_classperms_set *cp_set = curr->data;
 			struct cil_classpermission *cp = cp_set->set;
@@ -1482,22 +1422,13 @@ static int __evaluate_map_class(struct cil_class *mc, struct cil_db *db)
 	return map_args.rc;
 }
 
-static int __cil_post_db_classperms_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args)
+static int __cil_post_db_classperms_helper(struct cil_index_entry *entry, void *extra_args)
 {
+	struct cil_tree_node *node = entry->node;
 	int rc = SEPOL_ERR;
 	struct cil_db *db = extra_args;
 
 	switch (node->flavor) {
-	case CIL_BLOCK: {
-		struct cil_block *blk = node->data;
-		if (blk->is_abstract == CIL_TRUE) {
-			*finished = CIL_TREE_SKIP_HEAD;
-		}
-		break;
-	}
-	case CIL_MACRO:
-		*finished = CIL_TREE_SKIP_HEAD;
-		break;
 	case CIL_MAP_CLASS: {
 		rc = __evaluate_map_class(node->data, db);
 		if (rc != SEPOL_OK) {
@@ -1540,43 +1471,162 @@ exit:
 	return rc;
 }
 
+static const enum cil_flavor __cil_post_db_count_flavors[] = {
+	CIL_TYPE, CIL_ROLE, CIL_NETIFCON, CIL_GENFSCON, CIL_FILECON, CIL_NODECON, CIL_PORTCON,
+	CIL_PIRQCON, CIL_IOMEMCON, CIL_IOPORTCON, CIL_PCIDEVICECON, CIL_FSUSE,
+};
+
+static const enum cil_flavor __cil_post_db_classperms_flavors[] = {
+	CIL_MAP_CLASS, CIL_CLASSPERMISSION, CIL_AVRULE, CIL_CONSTRAIN, CIL_MLSCONSTRAIN,
+};
+
+static const enum cil_flavor __cil_post_db_cat_flavors[] = {
+	CIL_CATSET, CIL_SENSCAT, CIL_LEVEL, CIL_LEVELRANGE, CIL_USER, CIL_SELINUXUSERDEFAULT,
+	CIL_SELINUXUSER, CIL_RANGETRANSITION, CIL_CONTEXT, CIL_SIDCONTEXT, CIL_FILECON,
+	CIL_PORTCON, CIL_NODECON, CIL_GENFSCON, CIL_NETIFCON, CIL_PIRQCON, CIL_IOMEMCON,
+	CIL_IOPORTCON, CIL_PCIDEVICECON, CIL_FSUSE,
+};
+
+static const enum cil_flavor __cil_post_db_array_flavors[] = {
+	CIL_TYPE, CIL_ROLE, CIL_USERPREFIX, CIL_SELINUXUSER, CIL_SELINUXUSERDEFAULT, CIL_NETIFCON,
+	CIL_FSUSE, CIL_GENFSCON, CIL_FILECON, CIL_NODECON, CIL_PORTCON, CIL_PIRQCON,
+	CIL_IOMEMCON, CIL_IOPORTCON, CIL_PCIDEVICECON,
+};
+
+static const enum cil_flavor __cil_post_db_attr_flavors[] = {
+	CIL_TYPEATTRIBUTE, CIL_ROLEATTRIBUTE,
+};
+
+static const enum cil_flavor __cil_post_db_roletype_flavors[] = {
+	CIL_ROLETYPE,
+};
+
+static const enum cil_flavor __cil_post_db_reset_flavors[] = {
+	CIL_ROLE, CIL_TYPEATTRIBUTE, CIL_ROLEATTRIBUTE,
+};
+
+#define CIL_POST_DB_WALK(db, name) \
+	cil_index_walk((db)->index, __cil_post_db_##name##_flavors, \
+		       sizeof(__cil_post_db_##name##_flavors) / sizeof(enum cil_flavor), \
+		       __cil_post_db_##name##_helper, (db))
+
+static int __cil_post_db_reset_helper(struct cil_index_entry *entry, __attribute__((unused)) void *extra_args)
+{
+	struct cil_tree_node *node = entry->node;
+	ebitmap_t **bitmap = NULL;
+
+	switch (node->flavor) {
+	case CIL_ROLE:
+		bitmap = &((struct cil_role *)node->data)->types;
+		break;
+	case CIL_TYPEATTRIBUTE:
+		bitmap = &((struct cil_typeattribute *)node->data)->types;
+		break;
+	case CIL_ROLEATTRIBUTE:
+		bitmap = &((struct cil_roleattribute *)node->data)->roles;
+		break;
+	default:
+		return SEPOL_OK;
+	}
+
+	cil_ebitmap_destroy(bitmap);
+
+	return SEPOL_OK;
+}
+
+static void __cil_post_db_reset_sort(struct cil_sort *sort)
+{
+	cil_arena_release(sort->array, sizeof(*sort->array) * sort->count);
+	sort->array = NULL;
+	sort->count = 0;
+	sort->index = 0;
+}
+
+/* A database that statements were added to after it was compiled goes
+ * through post processing again, so drop what the last run left behind. */
+static int __cil_post_db_reset(struct cil_db *db)
+{
+	db->num_types = 0;
+	db->num_roles = 0;
+	free(db->val_to_type);
+	db->val_to_type = NULL;
+	free(db->val_to_role);
+	db->val_to_role = NULL;
+
+	__cil_post_db_reset_sort(db->netifcon);
+	__cil_post_db_reset_sort(db->genfscon);
+	__cil_post_db_reset_sort(db->filecon);
+	__cil_post_db_reset_sort(db->nodecon);
+	__cil_post_db_reset_sort(db->portcon);
+	__cil_post_db_reset_sort(db->pirqcon);
+	__cil_post_db_reset_sort(db->iomemcon);
+	__cil_post_db_reset_sort(db->ioportcon);
+	__cil_post_db_reset_sort(db->pcidevicecon);
+	__cil_post_db_reset_sort(db->fsuse);
+
+	cil_list_destroy(&db->userprefixes, CIL_FALSE);
+	cil_list_init(&db->userprefixes, CIL_LIST_ITEM);
+	cil_list_destroy(&db->selinuxusers, CIL_FALSE);
+	cil_list_init(&db->selinuxusers, CIL_LIST_ITEM);
+
+	return CIL_POST_DB_WALK(db, reset);
+}
+
 static int cil_post_db(struct cil_db *db)
 {
 	int rc = SEPOL_ERR;
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_count_helper, NULL, NULL, db);
+	/* Each pass only visits the flavors it handles, in tree order. Arrays
+	 * need the counts, attribute bitmaps need the type and role values and
+	 * roletypes need the attribute bitmaps. */
+	if (db->index == NULL) {
+		cil_index_init(&db->index);
+	}
+
+	rc = cil_index_build(db->index, db->ast->root);
+	if (rc != SEPOL_OK) {
+		cil_log(CIL_INFO, "Failed to index the AST\n");
+		goto exit;
+	}
+
+	rc = __cil_post_db_reset(db);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	rc = CIL_POST_DB_WALK(db, count);
 	if (rc != SEPOL_OK) {
 		cil_log(CIL_INFO, "Failure during cil databse count helper\n");
 		goto exit;
 	}
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_array_helper, NULL, NULL, db);
+	rc = CIL_POST_DB_WALK(db, classperms);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failure during cil database array helper\n");
+		cil_log(CIL_INFO, "Failed to evaluate class mapping permissions expressions\n");
 		goto exit;
 	}
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_attr_helper, NULL, NULL, db);
+	rc = CIL_POST_DB_WALK(db, cat);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failed to create attribute bitmaps\n");
+		cil_log(CIL_INFO, "Failed to evaluate category expressions\n");
 		goto exit;
 	}
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_roletype_helper, NULL, NULL, db);
+	rc = CIL_POST_DB_WALK(db, array);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failed during roletype association\n");
+		cil_log(CIL_INFO, "Failure during cil database array helper\n");
 		goto exit;
 	}
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_classperms_helper, NULL, NULL, db);
+	rc = CIL_POST_DB_WALK(db, attr);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failed to evaluate class mapping permissions expressions\n");
+		cil_log(CIL_INFO, "Failed to create attribute bitmaps\n");
 		goto exit;
 	}
 
-	rc = cil_tree_walk(db->ast->root, __cil_post_db_cat_helper, NULL, NULL, db);
+	rc = CIL_POST_DB_WALK(db, roletype);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_INFO, "Failed to evaluate category expressions\n");
+		cil_log(CIL_INFO, "Failed during roletype association\n");
 		goto exit;
 	}
 
@@ -2,7 +2,11 @@
 #include "cil_internal.h"
 #include "cil_log.h"
 #include "cil_list.h"
+#include "cil_arena.h"
 #include "cil_symtab.h"
+#include "cil_mem.h"
+#include "cil_index.h"
+#include "cil_reset_ast.h"
 
 static inline void cil_reset_classperms_list(struct cil_list *cp_list);
 static inline void cil_reset_level(struct cil_level *level);
@@ -23,7 +27,7 @@ static void cil_reset_class(struct cil_class *class)
 {
 	if (class->common != NULL) {
 		struct cil_class *common = class->common;
-		cil_symtab_map(&common->perms, __class_reset_perm_values, &common->num_perms);
+		cil_symtab_map(&class->perms, __class_reset_perm_values, &common->num_perms);
 		/* during a re-resolve, we need to reset the common, so a classcommon
 		 * statement isn't seen as a duplicate */
 		class->num_perms -= common->num_perms;
@@ -34,7 +38,9 @@ static void cil_reset_class(struct cil_class *class)
 
 static void cil_reset_perm(struct cil_perm *perm)
 {
-	cil_reset_classperms_list(perm->classperms);
+	/* during a re-resolve, the classperms of a map perm are added again by
+	 * its classmapping statements */
+	cil_list_destroy(&perm->classperms, CIL_FALSE);
 }
 
 static inline void cil_reset_classperms(struct cil_classperms *cp)
@@ -44,6 +50,8 @@ static inline void cil_reset_classperms(struct cil_classperms *cp)
 	}
 
 	cil_list_destroy(&cp->perms, CIL_FALSE);
+	cp->evaluated = CIL_FALSE;
+	cil_vector_destroy(&cp->datums);
 }
 
 static void cil_reset_classpermission(struct cil_classpermission *cp)
@@ -52,11 +60,24 @@ static void cil_reset_classpermission(struct cil_classpermission *cp)
 		return;
 	}
 
+	/* A named classpermission is filled by classpermissionset statements,
+	 * which add to it again when they are re-resolved */
+	if (cp->datum.name != NULL) {
+		cil_list_destroy(&cp->classperms, CIL_FALSE);
+		return;
+	}
+
 	cil_reset_classperms_list(cp->classperms);
 }
 
 static void cil_reset_classperms_set(struct cil_classperms_set *cp_set)
 {
+	/* A named set is reset with the classpermissionset statements filling
+	 * it, which may be compiled ones that are not resolved again */
+	if (cp_set->set == NULL || cp_set->set->datum.name != NULL) {
+		return;
+	}
+
 	cil_reset_classpermission(cp_set->set);
 }
 
@@ -128,7 +149,7 @@ static void cil_reset_roleattr(struct cil_roleattribute *attr)
 			cil_list_item_destroy(&expr, CIL_FALSE);
 			expr = next;
 		}
-		free(attr->expr_list);
+		cil_arena_release(attr->expr_list, sizeof(*attr->expr_list));
 		attr->expr_list = NULL;
 	}
 }
@@ -157,7 +178,7 @@ static void cil_reset_typeattr(struct cil_typeattribute *attr)
 			cil_list_item_destroy(&expr, CIL_FALSE);
 			expr = next;
 		}
-		free(attr->expr_list);
+		cil_arena_release(attr->expr_list, sizeof(*attr->expr_list));
 		attr->expr_list = NULL;
 	}
 	attr->used = CIL_FALSE;
@@ -198,6 +219,7 @@ static inline void cil_reset_cats(struct cil_cats *cats)
 	if (cats != NULL) {
 		cats->evaluated = CIL_FALSE;
 		cil_list_destroy(&cats->datum_expr, CIL_FALSE);
+		cil_vector_destroy(&cats->datums);
 	}
 }
 
@@ -528,3 +550,284 @@ int cil_reset_ast(struct cil_tree_node *current)
 
 	return SEPOL_OK;
 }
+
+/* Reset a single node, leaving its children alone */
+void cil_reset_node(struct cil_tree_node *node)
+{
+	__cil_reset_node(node, NULL, NULL);
+}
+
+static const enum cil_flavor cil_reset_base_flavors[] = {
+	CIL_BLOCK, CIL_MAP_PERM, CIL_CLASSPERMISSION, CIL_CLASS, CIL_TYPEALIAS, CIL_SENSALIAS, CIL_CATALIAS,
+	CIL_USER, CIL_ROLE, CIL_ROLEATTRIBUTE, CIL_TYPE, CIL_TYPEATTRIBUTE, CIL_SENS,
+	CIL_SID,
+};
+
+static void __cil_reset_base_add(struct cil_reset_base *base, enum cil_flavor flavor, void *data, void *ptr, struct cil_list *list, uint32_t value)
+{
+	struct cil_reset_base_entry *entry;
+
+	if (base->count == base->alloc) {
+		base->alloc = base->alloc ? base->alloc * 2 : 256;
+		base->entries = cil_realloc(base->entries, sizeof(*base->entries) * base->alloc);
+	}
+
+	entry = &base->entries[base->count++];
+	entry->flavor = flavor;
+	entry->data = data;
+	entry->ptr = ptr;
+	entry->list = list;
+	entry->tail = list != NULL ? list->tail : NULL;
+	entry->value = value;
+}
+
+static int __cil_reset_base_capture_helper(struct cil_index_entry *entry, void *extra_args)
+{
+	struct cil_tree_node *node = entry->node;
+	struct cil_reset_base *base = extra_args;
+
+	/* Copies made by macros and blockinherits share their datum */
+	if (cil_vector_get(&DATUM(node->data)->nodes, 0) != node) {
+		return SEPOL_OK;
+	}
+
+	switch (node->flavor) {
+	case CIL_BLOCK: {
+		struct cil_block *block = node->data;
+		__cil_reset_base_add(base, node->flavor, block, NULL, block->bi_nodes, 0);
+		break;
+	}
+	case CIL_MAP_PERM: {
+		struct cil_perm *perm = node->data;
+		__cil_reset_base_add(base, node->flavor, perm, NULL, perm->classperms, 0);
+		break;
+	}
+	case CIL_CLASSPERMISSION: {
+		struct cil_classpermission *cp = node->data;
+		__cil_reset_base_add(base, node->flavor, cp, NULL, cp->classperms, 0);
+		break;
+	}
+	case CIL_CLASS: {
+		struct cil_class *class = node->data;
+		__cil_reset_base_add(base, node->flavor, class, class->common, NULL, class->num_perms);
+		break;
+	}
+	case CIL_TYPEALIAS:
+	case CIL_SENSALIAS:
+	case CIL_CATALIAS: {
+		struct cil_alias *alias = node->data;
+		__cil_reset_base_add(base, node->flavor, alias, alias->actual, NULL, 0);
+		break;
+	}
+	case CIL_USER: {
+		struct cil_user *user = node->data;
+		__cil_reset_base_add(base, node->flavor, user, user->bounds, user->roles, 0);
+		__cil_reset_base_add(base, CIL_USERLEVEL, user, user->dftlevel, NULL, 0);
+		__cil_reset_base_add(base, CIL_USERRANGE, user, user->range, NULL, 0);
+		break;
+	}
+	case CIL_ROLE: {
+		struct cil_role *role = node->data;
+		__cil_reset_base_add(base, node->flavor, role, role->bounds, NULL, 0);
+		break;
+	}
+	case CIL_ROLEATTRIBUTE: {
+		struct cil_roleattribute *attr = node->data;
+		__cil_reset_base_add(base, node->flavor, attr, NULL, attr->expr_list, 0);
+		break;
+	}
+	case CIL_TYPE: {
+		struct cil_type *type = node->data;
+		__cil_reset_base_add(base, node->flavor, type, type->bounds, NULL, 0);
+		break;
+	}
+	case CIL_TYPEATTRIBUTE: {
+		struct cil_typeattribute *attr = node->data;
+		__cil_reset_base_add(base, node->flavor, attr, NULL, attr->expr_list, 0);
+		break;
+	}
+	case CIL_SENS: {
+		struct cil_sens *sens = node->data;
+		__cil_reset_base_add(base, node->flavor, sens, NULL, sens->cats_list, 0);
+		break;
+	}
+	case CIL_SID: {
+		struct cil_sid *sid = node->data;
+		__cil_reset_base_add(base, node->flavor, sid, sid->context, NULL, 0);
+		break;
+	}
+	default:
+		break;
+	}
+
+	return SEPOL_OK;
+}
+
+/* Record the compiled part of db before more statements are resolved
+ * against it, using the index its post processing left. The settled
+ * orders move into the record. */
+int cil_reset_base_capture(struct cil_db *db, struct cil_reset_base **base)
+{
+	int rc = SEPOL_ERR;
+	struct cil_reset_base *new_base = cil_malloc(sizeof(*new_base));
+
+	new_base->sidorder = db->sidorder;
+	new_base->classorder = db->classorder;
+	new_base->catorder = db->catorder;
+	new_base->sensitivityorder = db->sensitivityorder;
+	db->sidorder = NULL;
+	db->classorder = NULL;
+	db->catorder = NULL;
+	db->sensitivityorder = NULL;
+	new_base->entries = NULL;
+	new_base->count = 0;
+	new_base->alloc = 0;
+	*base = new_base;
+
+	if (db->index == NULL) {
+		cil_log(CIL_ERR, "Compiled database has no index\n");
+		goto exit;
+	}
+
+	rc = cil_index_walk(db->index, cil_reset_base_flavors, sizeof(cil_reset_base_flavors) / sizeof(cil_reset_base_flavors[0]), __cil_reset_base_capture_helper, new_base);
+
+exit:
+	return rc;
+}
+
+/* Cut list back to the items it had when it was recorded. A list that was
+ * only made since goes away. */
+static void __cil_reset_base_truncate(struct cil_list **list, struct cil_list *saved, struct cil_list_item *tail)
+{
+	struct cil_list_item *item = NULL;
+
+	if (*list == NULL) {
+		return;
+	}
+
+	item = tail != NULL ? tail->next : (*list)->head;
+	while (item != NULL) {
+		struct cil_list_item *next = item->next;
+		cil_list_item_destroy(&item, CIL_FALSE);
+		item = next;
+	}
+
+	if (saved == NULL) {
+		cil_arena_release(*list, sizeof(**list));
+		*list = NULL;
+		return;
+	}
+
+	if (tail != NULL) {
+		tail->next = NULL;
+	} else {
+		saved->head = NULL;
+	}
+	saved->tail = tail;
+}
+
+/* Undo what resolving the statements added since the capture did to the
+ * compiled declarations, as cil_reset_ast() does for the statements
+ * themselves. The lists of blocks keep their blockinherits, since those
+ * are not resolved again. */
+void cil_reset_base_restore(struct cil_reset_base *base)
+{
+	uint32_t i;
+
+	for (i = 0; i < base->count; i++) {
+		struct cil_reset_base_entry *entry = &base->entries[i];
+
+		switch (entry->flavor) {
+		case CIL_MAP_PERM: {
+			struct cil_perm *perm = entry->data;
+			__cil_reset_base_truncate(&perm->classperms, entry->list, entry->tail);
+			break;
+		}
+		case CIL_CLASSPERMISSION: {
+			struct cil_classpermission *cp = entry->data;
+			__cil_reset_base_truncate(&cp->classperms, entry->list, entry->tail);
+			break;
+		}
+		case CIL_CLASS: {
+			struct cil_class *class = entry->data;
+			if (class->common != entry->ptr) {
+				struct cil_class *common = class->common;
+				cil_symtab_map(&class->perms, __class_reset_perm_values, &common->num_perms);
+				class->num_perms = entry->value;
+				class->common = entry->ptr;
+			}
+			break;
+		}
+		case CIL_TYPEALIAS:
+		case CIL_SENSALIAS:
+		case CIL_CATALIAS: {
+			struct cil_alias *alias = entry->data;
+			alias->actual = entry->ptr;
+			break;
+		}
+		case CIL_USER: {
+			struct cil_user *user = entry->data;
+			user->bounds = entry->ptr;
+			__cil_reset_base_truncate(&user->roles, entry->list, entry->tail);
+			break;
+		}
+		case CIL_USERLEVEL: {
+			struct cil_user *user = entry->data;
+			user->dftlevel = entry->ptr;
+			break;
+		}
+		case CIL_USERRANGE: {
+			struct cil_user *user = entry->data;
+			user->range = entry->ptr;
+			break;
+		}
+		case CIL_ROLE: {
+			struct cil_role *role = entry->data;
+			role->bounds = entry->ptr;
+			break;
+		}
+		case CIL_ROLEATTRIBUTE: {
+			struct cil_roleattribute *attr = entry->data;
+			__cil_reset_base_truncate(&attr->expr_list, entry->list, entry->tail);
+			break;
+		}
+		case CIL_TYPE: {
+			struct cil_type *type = entry->data;
+			type->bounds = entry->ptr;
+			break;
+		}
+		case CIL_TYPEATTRIBUTE: {
+			struct cil_typeattribute *attr = entry->data;
+			__cil_reset_base_truncate(&attr->expr_list, entry->list, entry->tail);
+			break;
+		}
+		case CIL_SENS: {
+			struct cil_sens *sens = entry->data;
+			__cil_reset_base_truncate(&sens->cats_list, entry->list, entry->tail);
+			break;
+		}
+		case CIL_SID: {
+			struct cil_sid *sid = entry->data;
+			sid->context = entry->ptr;
+			break;
+		}
+		default:
+			break;
+		}
+	}
+}
+
+void cil_reset_base_destroy(struct cil_reset_base **base)
+{
+	if (*base == NULL) {
+		return;
+	}
+
+	cil_list_destroy(&(*base)->sidorder, CIL_FALSE);
+	cil_list_destroy(&(*base)->classorder, CIL_FALSE);
+	cil_list_destroy(&(*base)->catorder, CIL_FALSE);
+	cil_list_destroy(&(*base)->sensitivityorder, CIL_FALSE);
+	free((*base)->entries);
+	free(*base);
+	*base = NULL;
+}
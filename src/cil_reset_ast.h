@@ -2,7 +2,37 @@
 #define CIL_RESET_AST_H_
 
 #include "cil_tree.h"
+#include "cil_list.h"
+
+struct cil_db;
+
+/* A declaration of an already compiled part of a database, with the fields
+ * that resolving more statements against it can change */
+struct cil_reset_base_entry {
+	enum cil_flavor flavor;
+	void *data;
+	void *ptr;
+	struct cil_list *list;
+	struct cil_list_item *tail;
+	uint32_t value;
+};
+
+/* The state of the compiled part of a database that statements resolved
+ * after it may change: the settled orders and the declarations above */
+struct cil_reset_base {
+	struct cil_list *sidorder;
+	struct cil_list *classorder;
+	struct cil_list *catorder;
+	struct cil_list *sensitivityorder;
+	struct cil_reset_base_entry *entries;
+	uint32_t count;
+	uint32_t alloc;
+};
 
 int cil_reset_ast(struct cil_tree_node *current);
+void cil_reset_node(struct cil_tree_node *node);
+int cil_reset_base_capture(struct cil_db *db, struct cil_reset_base **base);
+void cil_reset_base_restore(struct cil_reset_base *base);
+void cil_reset_base_destroy(struct cil_reset_base **base);
 
 #endif /* CIL_RESET_AST_H_ */
@@ -30,6 +30,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include <sepol/policydb/conditional.h>
 
@@ -37,7 +39,11 @@
 #include "cil_flavor.h"
 #include "cil_log.h"
 #include "cil_mem.h"
+#include "cil_arena.h"
 #include "cil_tree.h"
+#include "cil_index.h"
+#include "cil_deps.h"
+#include "cil_resolve_cache.h"
 #include "cil_list.h"
 #include "cil_build_ast.h"
 #include "cil_resolve_ast.h"
@@ -60,17 +66,87 @@ struct cil_args_resolve {
 	struct cil_list *catorder_lists;
 	struct cil_list *sensitivityorder_lists;
 	struct cil_list *in_list;
+	struct cil_deps *deps;
+	struct cil_list *disabled;
+	struct cil_vector worklists[CIL_PASS_NUM];
+	struct cil_resolve_cache *cache;
+	struct cil_resolve_chunk *chunk;
 };
 
+enum cil_resolve_event_kind {
+	CIL_RESOLVE_EVENT_USE,
+	CIL_RESOLVE_EVENT_MARK,
+	CIL_RESOLVE_EVENT_LOG,
+	CIL_RESOLVE_EVENT_FAIL
+};
+
+/* Something resolving the statement at index in a worklist did to shared
+ * state, held back to be done in tree order once the pass is over */
+struct cil_resolve_event {
+	uint32_t index;
+	enum cil_resolve_event_kind kind;
+	int value;
+	struct cil_tree_node *node;
+	void *data;
+};
+
+/* A run of statements of a worklist resolved on one thread */
+struct cil_resolve_chunk {
+	uint32_t start;
+	uint32_t end;
+	uint32_t current;
+	struct cil_resolve_event *events;
+	uint32_t count;
+	uint32_t alloc;
+};
+
+static void __cil_resolve_chunk_add(struct cil_resolve_chunk *chunk, enum cil_resolve_event_kind kind, struct cil_tree_node *node, void *data, int value)
+{
+	struct cil_resolve_event *event = NULL;
+
+	chunk->events = cil_array_grow(chunk->events, chunk->count, &chunk->alloc, sizeof(*chunk->events), 64);
+	event = &chunk->events[chunk->count++];
+	event->index = chunk->current;
+	event->kind = kind;
+	event->value = value;
+	event->node = node;
+	event->data = data;
+}
+
+/* Record that resolving current added to datum, so that it is reset if
+ * current has to be resolved again */
+static void __cil_resolve_mutated(struct cil_tree_node *current, struct cil_symtab_datum *datum, void *extra_args)
+{
+	struct cil_args_resolve *args = extra_args;
+
+	if (args != NULL && args->deps != NULL) {
+		cil_deps_mutate(args->deps, current, datum);
+	}
+}
+
+/* Record that resolving current looked up datum */
+static void __cil_resolve_used(struct cil_args_resolve *args, struct cil_tree_node *current, struct cil_symtab_datum *datum)
+{
+	if (args->deps == NULL) {
+		return;
+	}
+
+	if (args->chunk != NULL) {
+		__cil_resolve_chunk_add(args->chunk, CIL_RESOLVE_EVENT_USE, current, datum, 0);
+	} else {
+		cil_deps_use(args->deps, current, datum);
+	}
+}
+
 static struct cil_name * __cil_insert_name(struct cil_db *db, hashtab_key_t key, struct cil_tree_node *ast_node)
 {
 	/* Currently only used for typetransition file names.
 	   But could be used for any string that is passed as a parameter.
 	*/
-	struct cil_tree_node *parent = ast_node->parent;
+	struct cil_tree_node *parent = cil_tree_node_parent(ast_node);
 	struct cil_macro *macro = NULL;
 	struct cil_name *name;
-	symtab_t *symtab;
+	struct cil_symtab *symtab;
 	enum cil_sym_index sym_index;
 	struct cil_symtab_datum *datum = NULL;
 
@@ -104,7 +180,7 @@ static struct cil_name * __cil_insert_name(struct cil_db *db, hashtab_key_t key,
 	return name;
 }
 
-static int __cil_resolve_perms(symtab_t *class_symtab, symtab_t *common_symtab, struct cil_list *perm_strs, struct cil_list **perm_datums)
+static int __cil_resolve_perms(struct cil_symtab *class_symtab, struct cil_symtab *common_symtab, struct cil_list *perm_strs, struct cil_list **perm_datums)
 {
 	int rc = SEPOL_ERR;
 	struct cil_list_item *curr;
@@ -148,7 +224,7 @@ int cil_resolve_classperms(struct cil_tree_node *current, struct cil_classperms
 {
 	int rc = SEPOL_ERR;
 	struct cil_symtab_datum *datum = NULL;
-	symtab_t *common_symtab = NULL;
+	struct cil_symtab *common_symtab = NULL;
 	struct cil_class *class;
 
 	rc = cil_resolve_name(current, cp->class_str, CIL_SYM_CLASSES, extra_args, &datum);
@@ -252,6 +328,7 @@ int cil_resolve_classpermissionset(struct cil_tree_node *current, struct cil_cla
 	cil_list_for_each(curr, cps->classperms) {
 		cil_list_append(cp->classperms, curr->flavor, curr->data);
 	}
+	__cil_resolve_mutated(current, datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -259,13 +336,22 @@ exit:
 	return rc;
 }
 
-int cil_type_used(struct cil_symtab_datum *datum)
+int cil_type_used(struct cil_tree_node *current, struct cil_symtab_datum *datum, void *extra_args)
 {
+	struct cil_args_resolve *args = extra_args;
 	struct cil_typeattribute *attr = NULL;
 
 	if (FLAVOR(datum) == CIL_TYPEATTRIBUTE) {
+		if (args != NULL && args->chunk != NULL) {
+			/* Marked when the chunk is merged */
+			__cil_resolve_chunk_add(args->chunk, CIL_RESOLVE_EVENT_MARK, current, datum, 0);
+			return 0;
+		}
 		attr = (struct cil_typeattribute*)datum;
 		attr->used = CIL_TRUE;
+		if (args != NULL && args->deps != NULL) {
+			cil_deps_mark(args->deps, current, datum);
+		}
 	}
 
 	return 0;
@@ -291,7 +377,7 @@ int cil_resolve_avrule(struct cil_tree_node *current, void *extra_args)
 	}
 	rule->src = src_datum;
 	if (rule->rule_kind != CIL_AVRULE_NEVERALLOW) {
-		cil_type_used(src_datum);
+		cil_type_used(current, src_datum, extra_args);
 	}
 		
 	if (rule->tgt_str == CIL_KEY_SELF) {
@@ -303,7 +389,7 @@ int cil_resolve_avrule(struct cil_tree_node *current, void *extra_args)
 		}
 		rule->tgt = tgt_datum;
 		if (rule->rule_kind != CIL_AVRULE_NEVERALLOW) {
-			cil_type_used(tgt_datum);
+			cil_type_used(current, tgt_datum, extra_args);
 		}
 	}
 
@@ -333,14 +419,14 @@ int cil_resolve_type_rule(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 	rule->src = src_datum;
-	cil_type_used(src_datum);
+	cil_type_used(current, src_datum, extra_args);
 
 	rc = cil_resolve_name(current, rule->tgt_str, CIL_SYM_TYPES, extra_args, &tgt_datum);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 	rule->tgt = tgt_datum;
-	cil_type_used(tgt_datum);
+	cil_type_used(current, tgt_datum, extra_args);
 
 	rc = cil_resolve_name(current, rule->obj_str, CIL_SYM_CLASSES, extra_args, &obj_datum);
 	if (rc != SEPOL_OK) {
@@ -353,7 +439,7 @@ int cil_resolve_type_rule(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 
-	result_node = result_datum->nodes->head->data;
+	result_node = cil_vector_get(&result_datum->nodes, 0);
 
 	if (result_node->flavor != CIL_TYPE) {
 		cil_log(CIL_ERR, "Type rule result must be a type [%d]\n",result_node->flavor);
@@ -381,7 +467,7 @@ int cil_resolve_typeattributeset(struct cil_tree_node *current, void *extra_args
 		goto exit;
 	}
 
-	attr_node = attr_datum->nodes->head->data;
+	attr_node = cil_vector_get(&attr_datum->nodes, 0);
 
 	if (attr_node->flavor != CIL_TYPEATTRIBUTE) {
 		rc = SEPOL_ERR;
@@ -406,6 +492,7 @@ int cil_resolve_typeattributeset(struct cil_tree_node *current, void *extra_args
 	}
 
 	cil_list_append(attr->expr_list, CIL_LIST, attrtypes->datum_expr);
+	__cil_resolve_mutated(current, attr_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -445,6 +532,7 @@ int cil_resolve_aliasactual(struct cil_tree_node *current, void *extra_args, enu
 	}
 
 	alias->actual = actual_datum;
+	__cil_resolve_mutated(current, alias_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -462,15 +550,15 @@ int cil_resolve_alias_to_actual(struct cil_tree_node *current, enum cil_flavor f
 	int limit = 2;
 
 	if (alias->actual == NULL) {
-		cil_log(CIL_ERR, "Alias declared but not used at line %d of %s\n",current->line, current->path);
+		cil_log(CIL_ERR, "Alias declared but not used at line %d of %s\n",cil_tree_node_line(current), cil_tree_node_path(current));
 		return SEPOL_ERR;
 	}
 
-	a1_node = a1->datum.nodes->head->data;
+	a1_node = cil_vector_get(&a1->datum.nodes, 0);
 
 	while (flavor != a1_node->flavor) {
 		a1 = a1->actual;
-		a1_node = a1->datum.nodes->head->data;
+		a1_node = cil_vector_get(&a1->datum.nodes, 0);
 		steps += 1;
 
 		if (a1 == a2) {
@@ -508,7 +596,7 @@ int cil_resolve_typepermissive(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 
-	type_node = type_datum->nodes->head->data;
+	type_node = cil_vector_get(&type_datum->nodes, 0);
 
 	if (type_node->flavor != CIL_TYPE && type_node->flavor != CIL_TYPEALIAS) {
 		cil_log(CIL_ERR, "Typepermissive must be a type or type alias\n");
@@ -541,14 +629,14 @@ int cil_resolve_nametypetransition(struct cil_tree_node *current, void *extra_ar
 		goto exit;
 	}
 	nametypetrans->src = src_datum;
-	cil_type_used(src_datum);
+	cil_type_used(current, src_datum, extra_args);
 
 	rc = cil_resolve_name(current, nametypetrans->tgt_str, CIL_SYM_TYPES, extra_args, &tgt_datum);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 	nametypetrans->tgt = tgt_datum;
-	cil_type_used(tgt_datum);
+	cil_type_used(current, tgt_datum, extra_args);
 
 	rc = cil_resolve_name(current, nametypetrans->obj_str, CIL_SYM_CLASSES, extra_args, &obj_datum);
 	if (rc != SEPOL_OK) {
@@ -570,7 +658,7 @@ int cil_resolve_nametypetransition(struct cil_tree_node *current, void *extra_ar
 		goto exit;
 	}
 
-	result_node = result_datum->nodes->head->data;
+	result_node = cil_vector_get(&result_datum->nodes, 0);
 
 	if (result_node->flavor != CIL_TYPE && result_node->flavor != CIL_TYPEALIAS) {
 		cil_log(CIL_ERR, "typetransition result is not a type or type alias\n");
@@ -599,14 +687,14 @@ int cil_resolve_rangetransition(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 	rangetrans->src = src_datum;
-	cil_type_used(src_datum);
+	cil_type_used(current, src_datum, extra_args);
 
 	rc = cil_resolve_name(current, rangetrans->exec_str, CIL_SYM_TYPES, extra_args, &exec_datum);
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
 	rangetrans->exec = exec_datum;
-	cil_type_used(exec_datum);
+	cil_type_used(current, exec_datum, extra_args);
 
 	rc = cil_resolve_name(current, rangetrans->obj_str, CIL_SYM_CLASSES, extra_args, &obj_datum);
 	if (rc != SEPOL_OK) {
@@ -682,6 +770,7 @@ int cil_resolve_classcommon(struct cil_tree_node *current, void *extra_args)
 	cil_symtab_map(&class->perms, __class_update_perm_values, &common->num_perms);
 
 	class->num_perms += common->num_perms;
+	__cil_resolve_mutated(current, class_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -723,6 +812,7 @@ int cil_resolve_classmapping(struct cil_tree_node *current, void *extra_args)
 	cil_list_for_each(curr, mapping->classperms) {
 		cil_list_append(mp->classperms, curr->flavor, curr->data);
 	}
+	__cil_resolve_mutated(current, &mp->datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -754,6 +844,7 @@ int cil_resolve_userrole(struct cil_tree_node *current, void *extra_args)
 	}
 
 	cil_list_append(userrole->user->roles, CIL_ROLE, userrole->role);
+	__cil_resolve_mutated(current, user_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -782,6 +873,7 @@ int cil_resolve_userlevel(struct cil_tree_node *current, void *extra_args)
 		}
 		usrlvl->level = (struct cil_level*)lvl_datum;
 		user->dftlevel = usrlvl->level;
+		__cil_resolve_mutated(current, user_datum, extra_args);
 
 		/* This could still be an anonymous level even if level_str is set, if level_str is a param_str*/
 		if (user->dftlevel->datum.name == NULL) {
@@ -796,6 +888,7 @@ int cil_resolve_userlevel(struct cil_tree_node *current, void *extra_args)
 			goto exit;
 		}
 		user->dftlevel = usrlvl->level;
+		__cil_resolve_mutated(current, user_datum, extra_args);
 	}
 
 	return SEPOL_OK;
@@ -825,6 +918,7 @@ int cil_resolve_userrange(struct cil_tree_node *current, void *extra_args)
 		}
 		userrange->range = (struct cil_levelrange*)range_datum;
 		user->range = userrange->range;
+		__cil_resolve_mutated(current, user_datum, extra_args);
 
 		/* This could still be an anonymous levelrange even if levelrange_str is set, if levelrange_str is a param_str*/
 		if (user->range->datum.name == NULL) {
@@ -839,6 +933,7 @@ int cil_resolve_userrange(struct cil_tree_node *current, void *extra_args)
 			goto exit;
 		}
 		user->range = userrange->range;
+		__cil_resolve_mutated(current, user_datum, extra_args);
 	}
 
 	return SEPOL_OK;
@@ -921,7 +1016,7 @@ int cil_resolve_roletype(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 	roletype->type = (struct cil_type*)type_datum;
-	cil_type_used(type_datum);
+	cil_type_used(current, type_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -950,7 +1045,7 @@ int cil_resolve_roletransition(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 	roletrans->tgt = tgt_datum;
-	cil_type_used(tgt_datum);
+	cil_type_used(current, tgt_datum, extra_args);
 
 	rc = cil_resolve_name(current, roletrans->obj_str, CIL_SYM_CLASSES, extra_args, &obj_datum);
 	if (rc != SEPOL_OK) {
@@ -962,7 +1057,7 @@ int cil_resolve_roletransition(struct cil_tree_node *current, void *extra_args)
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
-	node = result_datum->nodes->head->data;
+	node = cil_vector_get(&result_datum->nodes, 0);
 	if (node->flavor != CIL_ROLE) {
 		rc = SEPOL_ERR;
 		printf("%i\n", node->flavor);
@@ -1014,7 +1109,7 @@ int cil_resolve_roleattributeset(struct cil_tree_node *current, void *extra_args
 	if (rc != SEPOL_OK) {
 		goto exit;
 	}
-	attr_node = attr_datum->nodes->head->data;
+	attr_node = cil_vector_get(&attr_datum->nodes, 0);
 
 	if (attr_node->flavor != CIL_ROLEATTRIBUTE) {
 		rc = SEPOL_ERR;
@@ -1038,6 +1133,7 @@ int cil_resolve_roleattributeset(struct cil_tree_node *current, void *extra_args
 	}
 
 	cil_list_append(attr->expr_list, CIL_LIST, attrroles->datum_expr);
+	__cil_resolve_mutated(current, attr_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -1081,10 +1177,10 @@ void __cil_ordered_lists_destroy(struct cil_list **ordered_lists)
 		struct cil_list_item *next = item->next;
 		struct cil_ordered_list *ordered = item->data;
 		__cil_ordered_list_destroy(&ordered);
-		free(item);
+		cil_arena_release(item, sizeof(*item));
 		item = next;
 	}
-	free(*ordered_lists);
+	cil_arena_release(*ordered_lists, sizeof(**ordered_lists));
 	*ordered_lists = NULL;
 }
 
@@ -1277,7 +1373,7 @@ struct cil_list *__cil_ordered_lists_merge_all(struct cil_list **ordered_lists)
 			cil_list_for_each(curr, *ordered_lists) {
 				struct cil_ordered_list *ordered_list = curr->data;
 				if (ordered_list->merged == CIL_FALSE) {
-					cil_log(CIL_ERR, "Unable to merge ordered list at line %d of %s\n",ordered_list->node->line, ordered_list->node->path);
+					cil_log(CIL_ERR, "Unable to merge ordered list at line %d of %s\n",cil_tree_node_line(ordered_list->node), cil_tree_node_path(ordered_list->node));
 				}
 			}
 			goto exit;
@@ -1293,6 +1389,89 @@ exit:
 	return NULL;
 }
 
+static void __cil_ordered_item_unmark(struct cil_list_item *item)
+{
+	switch (item->flavor) {
+	case CIL_SID:
+		((struct cil_sid *)item->data)->ordered = CIL_FALSE;
+		break;
+	case CIL_CLASS:
+		((struct cil_class *)item->data)->ordered = CIL_FALSE;
+		break;
+	case CIL_CAT:
+		((struct cil_cat *)item->data)->ordered = CIL_FALSE;
+		break;
+	case CIL_SENS:
+		((struct cil_sens *)item->data)->ordered = CIL_FALSE;
+		break;
+	default:
+		break;
+	}
+}
+
+static void __cil_ordered_unmark(struct cil_list *ordered)
+{
+	struct cil_list_item *curr = NULL;
+
+	if (ordered == NULL) {
+		return;
+	}
+
+	cil_list_for_each(curr, ordered) {
+		__cil_ordered_item_unmark(curr);
+	}
+}
+
+/* Put the order settled when the compiled part of the database was
+ * resolved ahead of the lists of the added statements, so that they are
+ * merged into it */
+static void __cil_ordered_lists_seed(struct cil_list *ordered_lists, struct cil_list *settled)
+{
+	struct cil_ordered_list *ordered = NULL;
+	struct cil_list_item *curr = NULL;
+
+	if (settled == NULL) {
+		return;
+	}
+
+	__cil_ordered_list_init(&ordered);
+	cil_list_init(&ordered->list, CIL_LIST_ITEM);
+
+	cil_list_for_each(curr, settled) {
+		__cil_ordered_item_unmark(curr);
+		cil_list_append(ordered->list, curr->flavor, curr->data);
+	}
+
+	cil_list_prepend(ordered_lists, CIL_LIST_ITEM, ordered);
+}
+
+/* Compiled categories already have their values, so added ones have to
+ * come after them */
+static int __cil_verify_settled_prefix(struct cil_list *settled, struct cil_list *merged)
+{
+	struct cil_list_item *scurr = NULL;
+	struct cil_list_item *mcurr = NULL;
+
+	if (settled == NULL) {
+		return SEPOL_OK;
+	}
+
+	if (merged == NULL) {
+		return SEPOL_ERR;
+	}
+
+	mcurr = merged->head;
+	cil_list_for_each(scurr, settled) {
+		if (mcurr == NULL || mcurr->data != scurr->data) {
+			cil_log(CIL_ERR, "Added categories must be ordered after those of the compiled policy\n");
+			return SEPOL_ERR;
+		}
+		mcurr = mcurr->next;
+	}
+
+	return SEPOL_OK;
+}
+
 int cil_resolve_classorder(struct cil_tree_node *current, void *extra_args)
 {
 	struct cil_args_resolve *args = extra_args;
@@ -1394,7 +1573,7 @@ int cil_resolve_catorder(struct cil_tree_node *current, void *extra_args)
 			cil_log(CIL_ERR, "Failed to resolve category %s in categoryorder\n", (char *)curr->data);
 			goto exit;
 		}
-		node = cat_datum->nodes->head->data;
+		node = cil_vector_get(&cat_datum->nodes, 0);
 		if (node->flavor != CIL_CAT) {
 			cil_log(CIL_ERR, "%s is not a category. Only categories are allowed in categoryorder statements\n", cat_datum->name);
 			rc = SEPOL_ERR;
@@ -1509,6 +1688,7 @@ int cil_resolve_senscat(struct cil_tree_node *current, void *extra_args)
 	}
 
 	cil_list_append(sens->cats_list, CIL_CAT, senscat->cats);
+	__cil_resolve_mutated(current, sens_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -1671,7 +1851,7 @@ int cil_resolve_context(struct cil_tree_node *current, struct cil_context *conte
 		goto exit;
 	}
 
-	type_node = type_datum->nodes->head->data;
+	type_node = cil_vector_get(&type_datum->nodes, 0);
 
 	if (type_node->flavor != CIL_TYPE && type_node->flavor != CIL_TYPEALIAS) {
 		rc = SEPOL_ERR;
@@ -2029,6 +2209,7 @@ int cil_resolve_sidcontext(struct cil_tree_node *current, void *extra_args)
 	}
 
 	sid->context = sidcon->context;
+	__cil_resolve_mutated(current, sid_datum, extra_args);
 
 	return SEPOL_OK;
 
@@ -2048,7 +2229,7 @@ int cil_resolve_blockinherit_link(struct cil_tree_node *current, void *extra_arg
 		goto exit;
 	}
 
-	node = block_datum->nodes->head->data;
+	node = cil_vector_get(&block_datum->nodes, 0);
 
 	if (node->flavor != CIL_BLOCK) {
 		cil_log(CIL_ERR, "%s is not a block\n", cil_node_to_string(node));
@@ -2086,7 +2267,7 @@ int cil_resolve_blockinherit_copy(struct cil_tree_node *current, void *extra_arg
 	db = args->db;
 
 	// Make sure this is the original block and not a merged block from a blockinherit
-	if (current != block->datum.nodes->head->data) {
+	if (current != cil_vector_get(&block->datum.nodes, 0)) {
 		rc = SEPOL_OK;
 		goto exit;
 	}
@@ -2098,6 +2279,7 @@ int cil_resolve_blockinherit_copy(struct cil_tree_node *current, void *extra_arg
 			goto exit;
 		}
 	}
+	cil_resolve_cache_flush(db->resolve_cache);
 
 	return SEPOL_OK;
 
@@ -2105,6 +2287,38 @@ exit:
 	return rc;
 }
 
+/* Copy compiled blocks into the blockinherits added since they were
+ * compiled. The compiled part of the tree is not walked again, and it comes
+ * first, so this is done before the pass walks the added statements. */
+static int __cil_resolve_base_blockinherits(struct cil_db *db)
+{
+	struct cil_reset_base *base = db->base;
+	uint32_t i;
+	int rc = SEPOL_OK;
+
+	for (i = 0; i < base->count; i++) {
+		struct cil_reset_base_entry *entry = &base->entries[i];
+		struct cil_block *block = entry->data;
+		struct cil_list_item *item;
+
+		if (entry->flavor != CIL_BLOCK || block->bi_nodes == NULL) {
+			continue;
+		}
+
+		item = entry->tail != NULL ? entry->tail->next : block->bi_nodes->head;
+		for (; item != NULL; item = item->next) {
+			rc = cil_copy_ast(db, cil_vector_get(&block->datum.nodes, 0), item->data);
+			if (rc != SEPOL_OK) {
+				cil_log(CIL_ERR, "Failed to copy block contents into blockinherit\n");
+				return rc;
+			}
+		}
+	}
+	cil_resolve_cache_flush(db->resolve_cache);
+
+	return rc;
+}
+
 int cil_resolve_blockabstract(struct cil_tree_node *current, void *extra_args)
 {
 	struct cil_blockabstract *abstract = current->data;
@@ -2117,7 +2331,7 @@ int cil_resolve_blockabstract(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 
-	block_node = block_datum->nodes->head->data;
+	block_node = cil_vector_get(&block_datum->nodes, 0);
 	if (block_node->flavor != CIL_BLOCK) {
 		cil_log(CIL_ERR, "Failed to resolve blockabstract to a block, rc: %d\n", rc);
 		goto exit;
@@ -2131,6 +2345,17 @@ exit:
 	return rc;
 }
 
+/* Whether node is one of the statements being resolved, rather than part of
+ * the compiled policy they are added to */
+static int __cil_resolve_node_is_added(struct cil_db *db, struct cil_tree_node *node)
+{
+	while (cil_tree_node_parent(node) != NULL) {
+		node = cil_tree_node_parent(node);
+	}
+
+	return node == db->ast->root;
+}
+
 int cil_resolve_in(struct cil_tree_node *current, void *extra_args)
 {
 	struct cil_in *in = current->data;
@@ -2149,7 +2374,13 @@ int cil_resolve_in(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 
-	block_node = block_datum->nodes->head->data;
+	block_node = cil_vector_get(&block_datum->nodes, 0);
+
+	if (db != NULL && db->base != NULL && !__cil_resolve_node_is_added(db, block_node)) {
+		cil_log(CIL_ERR, "Cannot add statements to block %s of the compiled policy at line %u of %s\n", in->block_str, cil_tree_node_line(current), cil_tree_node_path(current));
+		rc = SEPOL_ERR;
+		goto exit;
+	}
 
 	rc = cil_copy_ast(db, current, block_node);
 	if (rc != SEPOL_OK) {
@@ -2158,8 +2389,11 @@ int cil_resolve_in(struct cil_tree_node *current, void *extra_args)
 	}
 
 	cil_tree_children_destroy(current);
-	current->cl_head = NULL;
-	current->cl_tail = NULL;
+	cil_tree_node_set_head(current, NULL);
+	cil_tree_node_set_tail(current, NULL);
+	if (db != NULL) {
+		cil_resolve_cache_flush(db->resolve_cache);
+	}
 
 	return SEPOL_OK;
 
@@ -2209,7 +2443,7 @@ int cil_resolve_in_list(void *extra_args)
 		}
 
 		if (unresolved > 0 && resolved == 0) {
-			cil_log(CIL_ERR, "Failed to resolve in-statement on line %d of %s\n", last_failed_node->line, last_failed_node->path);
+			cil_log(CIL_ERR, "Failed to resolve in-statement on line %d of %s\n", cil_tree_node_line(last_failed_node), cil_tree_node_path(last_failed_node));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
@@ -2251,8 +2485,8 @@ int cil_resolve_bounds(struct cil_tree_node *current, void *extra_args, enum cil
 		struct cil_user *user = (struct cil_user *)child_datum;
 
 		if (user->bounds != NULL) {
-			struct cil_tree_node *node = user->bounds->datum.nodes->head->data;
-			cil_log(CIL_ERR, "User %s already bound by parent at line %u of %s\n", bounds->child_str, node->line, node->path);
+			struct cil_tree_node *node = cil_vector_get(&user->bounds->datum.nodes, 0);
+			cil_log(CIL_ERR, "User %s already bound by parent at line %u of %s\n", bounds->child_str, cil_tree_node_line(node), cil_tree_node_path(node));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
@@ -2264,8 +2498,8 @@ int cil_resolve_bounds(struct cil_tree_node *current, void *extra_args, enum cil
 		struct cil_role *role = (struct cil_role *)child_datum;
 
 		if (role->bounds != NULL) {
-			struct cil_tree_node *node = role->bounds->datum.nodes->head->data;
-			cil_log(CIL_ERR, "Role %s already bound by parent at line %u of %s\n", bounds->child_str, node->line, node->path);
+			struct cil_tree_node *node = cil_vector_get(&role->bounds->datum.nodes, 0);
+			cil_log(CIL_ERR, "Role %s already bound by parent at line %u of %s\n", bounds->child_str, cil_tree_node_line(node), cil_tree_node_path(node));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
@@ -2278,21 +2512,21 @@ int cil_resolve_bounds(struct cil_tree_node *current, void *extra_args, enum cil
 		struct cil_tree_node *node = NULL;
 
 		if (type->bounds != NULL) {
-			node = ((struct cil_symtab_datum *)type->bounds)->nodes->head->data;
-			cil_log(CIL_ERR, "Type %s already bound by parent at line %u of %s\n", bounds->child_str, node->line, node->path);
-			cil_log(CIL_ERR, "Now being bound to parent %s at line %u of %s\n", bounds->parent_str, current->line, current->path);
+			node = cil_vector_get(&((struct cil_symtab_datum *)type->bounds)->nodes, 0);
+			cil_log(CIL_ERR, "Type %s already bound by parent at line %u of %s\n", bounds->child_str, cil_tree_node_line(node), cil_tree_node_path(node));
+			cil_log(CIL_ERR, "Now being bound to parent %s at line %u of %s\n", bounds->parent_str, cil_tree_node_line(current), cil_tree_node_path(current));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
 
-		node = parent_datum->nodes->head->data;
+		node = cil_vector_get(&parent_datum->nodes, 0);
 		if (node->flavor == CIL_TYPEATTRIBUTE) {
 			cil_log(CIL_ERR, "Bounds parent %s is an attribute\n", bounds->parent_str);
 			rc = SEPOL_ERR;
 			goto exit;
 		}
 
-		node = child_datum->nodes->head->data;
+		node = cil_vector_get(&child_datum->nodes, 0);
 		if (node->flavor == CIL_TYPEATTRIBUTE) {
 			cil_log(CIL_ERR, "Bounds child %s is an attribute\n", bounds->child_str);
 			rc = SEPOL_ERR;
@@ -2305,11 +2539,12 @@ int cil_resolve_bounds(struct cil_tree_node *current, void *extra_args, enum cil
 	default:
 		break;
 	}
+	__cil_resolve_mutated(current, child_datum, extra_args);
 
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Bad bounds statement at line %u of %s\n", current->line, current->path);
+	cil_log(CIL_ERR, "Bad bounds statement at line %u of %s\n", cil_tree_node_line(current), cil_tree_node_path(current));
 	return rc;
 }
 
@@ -2361,6 +2596,20 @@ exit:
 	return rc;
 }
 
+/* A copied macro only adds declarations, so only lookups of the names it
+ * declares can now resolve differently */
+static int __cil_resolve_call_invalidate_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
+{
+	struct cil_resolve_cache *cache = extra_args;
+	enum cil_sym_index sym_index = CIL_SYM_UNKNOWN;
+
+	if (node->flavor >= CIL_MIN_DECLARATIVE && cil_flavor_to_symtab_index(node->flavor, &sym_index) == SEPOL_OK) {
+		cil_resolve_cache_invalidate(cache, DATUM(node->data)->name, sym_index);
+	}
+
+	return SEPOL_OK;
+}
+
 int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 {
 	struct cil_call *new_call = current->data;
@@ -2379,7 +2628,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 		goto exit;
 	}
 
-	macro_node = macro_datum->nodes->head->data;
+	macro_node = cil_vector_get(&macro_datum->nodes, 0);
 
 	if (macro_node->flavor != CIL_MACRO) {
 		printf("Failed to resolve macro %s\n", new_call->macro_str);
@@ -2392,15 +2641,15 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 
 		struct cil_list_item *item;
 		struct cil_args *new_arg = NULL;
-		struct cil_tree_node *pc = NULL;
+		struct cil_parse_token *pc = NULL;
 
-		if (new_call->args_tree == NULL) {
-			cil_log(CIL_ERR, "Missing arguments (%s, line: %d)\n", current->path, current->line);
+		if (new_call->args_tokens == NULL) {
+			cil_log(CIL_ERR, "Missing arguments (%s, line: %d)\n", cil_tree_node_path(current), cil_tree_node_line(current));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
 
-		pc = new_call->args_tree->root->cl_head;
+		pc = cil_parse_token_child(new_call->args_tokens);
 
 		cil_list_init(&new_call->args, CIL_LIST_ITEM);
 
@@ -2408,7 +2657,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 			enum cil_flavor flavor = ((struct cil_param*)item->data)->flavor;
 
 			if (pc == NULL) {
-				cil_log(CIL_ERR, "Missing arguments (%s, line: %d)\n", current->path, current->line);
+				cil_log(CIL_ERR, "Missing arguments (%s, line: %d)\n", cil_tree_node_path(current), cil_tree_node_line(current));
 				rc = SEPOL_ERR;
 				goto exit;
 			}
@@ -2449,7 +2698,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 				new_arg->arg_str = pc->data;
 				break;
 			case CIL_CATSET: {
-				if (pc->cl_head != NULL) {
+				if (cil_parse_token_child(pc) != NULL) {
 					struct cil_catset *catset = NULL;
 					struct cil_tree_node *cat_node = NULL;
 					cil_catset_init(&catset);
@@ -2461,8 +2710,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 					cil_tree_node_init(&cat_node);
 					cat_node->flavor = CIL_CATSET;
 					cat_node->data = catset;
-					cil_list_append(((struct cil_symtab_datum*)catset)->nodes,
-									CIL_LIST_ITEM, cat_node);
+					cil_vector_append(&((struct cil_symtab_datum*)catset)->nodes, cat_node);
 					new_arg->arg = (struct cil_symtab_datum*)catset;
 				} else {
 					new_arg->arg_str = pc->data;
@@ -2471,12 +2719,12 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 				break;
 			}
 			case CIL_LEVEL: {
-				if (pc->cl_head != NULL) {
+				if (cil_parse_token_child(pc) != NULL) {
 					struct cil_level *level = NULL;
 					struct cil_tree_node *lvl_node = NULL;
 					cil_level_init(&level);
 
-					rc = cil_fill_level(pc->cl_head, level);
+					rc = cil_fill_level(cil_parse_token_child(pc), level);
 					if (rc != SEPOL_OK) {
 						cil_log(CIL_ERR, "Failed to create anonymous level, rc: %d\n", rc);
 						cil_destroy_level(level);
@@ -2485,8 +2733,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 					cil_tree_node_init(&lvl_node);
 					lvl_node->flavor = CIL_LEVEL;
 					lvl_node->data = level;
-					cil_list_append(((struct cil_symtab_datum*)level)->nodes, 
-									CIL_LIST_ITEM, lvl_node);
+					cil_vector_append(&((struct cil_symtab_datum*)level)->nodes, lvl_node);
 					new_arg->arg = (struct cil_symtab_datum*)level;
 				} else {
 					new_arg->arg_str = pc->data;
@@ -2495,12 +2742,12 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 				break;
 			}
 			case CIL_LEVELRANGE: {
-				if (pc->cl_head != NULL) {
+				if (cil_parse_token_child(pc) != NULL) {
 					struct cil_levelrange *range = NULL;
 					struct cil_tree_node *range_node = NULL;
 					cil_levelrange_init(&range);
 
-					rc = cil_fill_levelrange(pc->cl_head, range);
+					rc = cil_fill_levelrange(cil_parse_token_child(pc), range);
 					if (rc != SEPOL_OK) {
 						cil_log(CIL_ERR, "Failed to create anonymous levelrange, rc: %d\n", rc);
 						cil_destroy_levelrange(range);
@@ -2509,8 +2756,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 					cil_tree_node_init(&range_node);
 					range_node->flavor = CIL_LEVELRANGE;
 					range_node->data = range;
-					cil_list_append(((struct cil_symtab_datum*)range)->nodes, 
-									CIL_LIST_ITEM, range_node);
+					cil_vector_append(&((struct cil_symtab_datum*)range)->nodes, range_node);
 					new_arg->arg = (struct cil_symtab_datum*)range;
 				} else {
 					new_arg->arg_str = pc->data;
@@ -2519,12 +2765,12 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 				break;
 			}
 			case CIL_IPADDR: {
-				if (pc->cl_head != NULL) {
+				if (cil_parse_token_child(pc) != NULL) {
 					struct cil_ipaddr *ipaddr = NULL;
 					struct cil_tree_node *addr_node = NULL;
 					cil_ipaddr_init(&ipaddr);
 
-					rc = cil_fill_ipaddr(pc->cl_head, ipaddr);
+					rc = cil_fill_ipaddr(cil_parse_token_child(pc), ipaddr);
 					if (rc != SEPOL_OK) {
 						cil_log(CIL_ERR, "Failed to create anonymous ip address, rc; %d\n", rc);
 						cil_destroy_ipaddr(ipaddr);
@@ -2533,8 +2779,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 					cil_tree_node_init(&addr_node);
 					addr_node->flavor = CIL_IPADDR;
 					addr_node->data = ipaddr;
-					cil_list_append(((struct cil_symtab_datum*)ipaddr)->nodes,
-									CIL_LIST_ITEM, addr_node);
+					cil_vector_append(&((struct cil_symtab_datum*)ipaddr)->nodes, addr_node);
 					new_arg->arg = (struct cil_symtab_datum*)ipaddr;
 				} else {
 					new_arg->arg_str = pc->data;
@@ -2549,7 +2794,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 				new_arg->arg_str = pc->data;
 				break;
 			case CIL_CLASSPERMISSION: {
-				if (pc->cl_head != NULL) {
+				if (cil_parse_token_child(pc) != NULL) {
 					struct cil_classpermission *cp = NULL;
 					struct cil_tree_node *cp_node = NULL;
 
@@ -2563,7 +2808,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 					cil_tree_node_init(&cp_node);
 					cp_node->flavor = CIL_CLASSPERMISSION;
 					cp_node->data = cp;
-					cil_list_append(cp->datum.nodes, CIL_LIST_ITEM, cp_node);
+					cil_vector_append(&cp->datum.nodes, cp_node);
 					new_arg->arg = (struct cil_symtab_datum*)cp;
 				} else {
 					new_arg->arg_str = pc->data;
@@ -2581,16 +2826,16 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 
 			cil_list_append(new_call->args, CIL_ARGS, new_arg);
 
-			pc = pc->next;
+			pc = cil_parse_token_next(pc);
 		}
 
 		if (pc != NULL) {
-			cil_log(CIL_ERR, "Unexpected arguments (%s, line: %d)\n", current->path, current->line);
+			cil_log(CIL_ERR, "Unexpected arguments (%s, line: %d)\n", cil_tree_node_path(current), cil_tree_node_line(current));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
-	} else if (new_call->args_tree != NULL) {
-		cil_log(CIL_ERR, "Unexpected arguments (%s, line: %d)\n", current->path, current->line);
+	} else if (new_call->args_tokens != NULL) {
+		cil_log(CIL_ERR, "Unexpected arguments (%s, line: %d)\n", cil_tree_node_path(current), cil_tree_node_line(current));
 		rc = SEPOL_ERR;
 		goto exit;
 	}
@@ -2602,6 +2847,7 @@ int cil_resolve_call1(struct cil_tree_node *current, void *extra_args)
 			cil_log(CIL_ERR, "Failed to copy macro, rc: %d\n", rc);
 			goto exit;
 		}
+		cil_tree_walk(current, __cil_resolve_call_invalidate_helper, NULL, NULL, db->resolve_cache);
 	}
 
 	return SEPOL_OK;
@@ -2791,7 +3037,7 @@ int cil_resolve_expr(enum cil_flavor expr_type, struct cil_list *str_expr, struc
 			}
 
 			if (sym_index == CIL_SYM_TYPES && (expr_type == CIL_CONSTRAIN || expr_type == CIL_VALIDATETRANS)) {
-				cil_type_used(res_datum);
+				cil_type_used(parent, res_datum, extra_args);
 			}
 
 			cil_list_append(*datum_expr, CIL_DATUM, res_datum);
@@ -2904,34 +3150,34 @@ int cil_resolve_tunif(struct cil_tree_node *current, void *extra_args)
 
 	result = __cil_evaluate_tunable_expr(tif->datum_expr->head);
 
-	if (current->cl_head != NULL && current->cl_head->flavor == CIL_CONDBLOCK) {
-		cb = current->cl_head->data;
+	if (cil_tree_node_head(current) != NULL && cil_tree_node_head(current)->flavor == CIL_CONDBLOCK) {
+		cb = cil_tree_node_head(current)->data;
 		if (cb->flavor == CIL_CONDTRUE) {
-			true_node = current->cl_head;
+			true_node = cil_tree_node_head(current);
 		} else if (cb->flavor == CIL_CONDFALSE) {
-			false_node = current->cl_head;
+			false_node = cil_tree_node_head(current);
 		}
 	}
 
-	if (current->cl_head != NULL && current->cl_head->next != NULL && current->cl_head->next->flavor == CIL_CONDBLOCK) {
-		cb = current->cl_head->next->data;
+	if (cil_tree_node_head(current) != NULL && cil_tree_node_next(cil_tree_node_head(current)) != NULL && cil_tree_node_next(cil_tree_node_head(current))->flavor == CIL_CONDBLOCK) {
+		cb = cil_tree_node_next(cil_tree_node_head(current))->data;
 		if (cb->flavor == CIL_CONDTRUE) {
-			true_node = current->cl_head->next;
+			true_node = cil_tree_node_next(cil_tree_node_head(current));
 		} else if (cb->flavor == CIL_CONDFALSE) {
-			false_node = current->cl_head->next;
+			false_node = cil_tree_node_next(cil_tree_node_head(current));
 		}
 	}
 
 	if (result == CIL_TRUE) {
 		if (true_node != NULL) {
-			rc = cil_copy_ast(db, true_node, current->parent);
+			rc = cil_copy_ast(db, true_node, cil_tree_node_parent(current));
 			if (rc != SEPOL_OK) {
 				goto exit;
 			}
 		}
 	} else {
 		if (false_node != NULL) {
-			rc = cil_copy_ast(db, false_node, current->parent);
+			rc = cil_copy_ast(db, false_node, cil_tree_node_parent(current));
 			if (rc  != SEPOL_OK) {
 				goto exit;
 			}
@@ -2939,8 +3185,9 @@ int cil_resolve_tunif(struct cil_tree_node *current, void *extra_args)
 	}
 
 	cil_tree_children_destroy(current);
-	current->cl_head = NULL;
-	current->cl_tail = NULL;
+	cil_tree_node_set_head(current, NULL);
+	cil_tree_node_set_tail(current, NULL);
+	cil_resolve_cache_flush(db->resolve_cache);
 
 	return SEPOL_OK;
 
@@ -3213,6 +3460,123 @@ exit:
 	return rc;
 }
 
+static void __cil_resolve_disable_optional(struct cil_optional *opt, struct cil_tree_node *node)
+{
+	cil_log(CIL_WARN, "Disabling optional %s at %d of %s\n", opt->datum.name, cil_tree_node_line(cil_tree_node_parent(node)), cil_tree_node_path(cil_tree_node_parent(node)));
+
+	/* disable an optional if something failed to resolve */
+	opt->enabled = CIL_FALSE;
+}
+
+/* The pass that resolves nodes of a flavor, or CIL_PASS_NUM if there is none.
+ * Calls are also handled by the macro and call1 passes, which walk the tree. */
+static enum cil_pass __cil_resolve_flavor_pass(enum cil_flavor flavor)
+{
+	switch (flavor) {
+	case CIL_TUNABLEIF:
+		return CIL_PASS_TIF;
+	case CIL_IN:
+		return CIL_PASS_IN;
+	case CIL_BLOCKINHERIT:
+		return CIL_PASS_BLKIN_LINK;
+	case CIL_BLOCK:
+		return CIL_PASS_BLKIN_COPY;
+	case CIL_BLOCKABSTRACT:
+		return CIL_PASS_BLKABS;
+	case CIL_MACRO:
+		return CIL_PASS_MACRO;
+	case CIL_CALL:
+		return CIL_PASS_CALL2;
+	case CIL_TYPEALIASACTUAL:
+	case CIL_SENSALIASACTUAL:
+	case CIL_CATALIASACTUAL:
+		return CIL_PASS_ALIAS1;
+	case CIL_TYPEALIAS:
+	case CIL_SENSALIAS:
+	case CIL_CATALIAS:
+		return CIL_PASS_ALIAS2;
+	case CIL_SIDORDER:
+	case CIL_CLASSORDER:
+	case CIL_CATORDER:
+	case CIL_SENSITIVITYORDER:
+	case CIL_BOOLEANIF:
+		return CIL_PASS_MISC1;
+	case CIL_CATSET:
+		return CIL_PASS_MLS;
+	case CIL_SENSCAT:
+	case CIL_CLASSCOMMON:
+		return CIL_PASS_MISC2;
+	case CIL_TYPEATTRIBUTESET:
+	case CIL_TYPEBOUNDS:
+	case CIL_TYPEPERMISSIVE:
+	case CIL_NAMETYPETRANSITION:
+	case CIL_RANGETRANSITION:
+	case CIL_CLASSPERMISSIONSET:
+	case CIL_CLASSMAPPING:
+	case CIL_AVRULE:
+	case CIL_TYPE_RULE:
+	case CIL_USERROLE:
+	case CIL_USERLEVEL:
+	case CIL_USERRANGE:
+	case CIL_USERBOUNDS:
+	case CIL_USERPREFIX:
+	case CIL_SELINUXUSER:
+	case CIL_SELINUXUSERDEFAULT:
+	case CIL_ROLEATTRIBUTESET:
+	case CIL_ROLETYPE:
+	case CIL_ROLETRANSITION:
+	case CIL_ROLEALLOW:
+	case CIL_ROLEBOUNDS:
+	case CIL_LEVEL:
+	case CIL_LEVELRANGE:
+	case CIL_CONSTRAIN:
+	case CIL_MLSCONSTRAIN:
+	case CIL_VALIDATETRANS:
+	case CIL_MLSVALIDATETRANS:
+	case CIL_CONTEXT:
+	case CIL_FILECON:
+	case CIL_PORTCON:
+	case CIL_NODECON:
+	case CIL_GENFSCON:
+	case CIL_NETIFCON:
+	case CIL_PIRQCON:
+	case CIL_IOMEMCON:
+	case CIL_IOPORTCON:
+	case CIL_PCIDEVICECON:
+	case CIL_FSUSE:
+	case CIL_SIDCONTEXT:
+	case CIL_DEFAULTUSER:
+	case CIL_DEFAULTROLE:
+	case CIL_DEFAULTTYPE:
+	case CIL_DEFAULTRANGE:
+		return CIL_PASS_MISC3;
+	default:
+		return CIL_PASS_NUM;
+	}
+}
+
+/* The tif and call1 passes walk the whole tree, since they copy into it as
+ * they go. The passes up to the next such walk only go through the nodes
+ * that the walk put in their worklists. */
+static enum cil_pass __cil_resolve_next_walk(enum cil_pass pass)
+{
+	return pass < CIL_PASS_CALL1 ? CIL_PASS_CALL1 : CIL_PASS_NUM;
+}
+
+static void __cil_resolve_worklist_add(struct cil_args_resolve *args, struct cil_tree_node *node)
+{
+	enum cil_pass pass = __cil_resolve_flavor_pass(node->flavor);
+
+	if (args->macro != NULL) {
+		/* Macros are walked by the macro pass */
+		return;
+	}
+
+	if (pass > args->pass && pass < __cil_resolve_next_walk(args->pass)) {
+		cil_vector_append(&args->worklists[pass], node);
+	}
+}
+
 int __cil_resolve_ast_node_helper(struct cil_tree_node *node, __attribute__((unused)) uint32_t *finished, void *extra_args)
 {
 	int rc = SEPOL_ERR;
@@ -3228,7 +3592,7 @@ int __cil_resolve_ast_node_helper(struct cil_tree_node *node, __attribute__((unu
 	if (optstack != NULL) {
 		if (node->flavor == CIL_TUNABLE || node->flavor == CIL_MACRO) {
 			/* tuanbles and macros are not allowed in optionals*/
-			cil_log(CIL_ERR, "%s statement is not allowed in optionals (%s:%d)\n", cil_node_to_string(node), node->path, node->line);
+			cil_log(CIL_ERR, "%s statement is not allowed in optionals (%s:%d)\n", cil_node_to_string(node), cil_tree_node_path(node), cil_tree_node_line(node));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
@@ -3242,9 +3606,9 @@ int __cil_resolve_ast_node_helper(struct cil_tree_node *node, __attribute__((unu
 			node->flavor == CIL_TUNABLEIF ||
 			node->flavor == CIL_NAMETYPETRANSITION)) {
 			if (((struct cil_booleanif*)boolif->data)->preserved_tunable) {
-				cil_log(CIL_ERR, "%s statement is not allowed in booleanifs (tunableif treated as a booleanif) (%s:%d)\n", cil_node_to_string(node), node->path, node->line);
+				cil_log(CIL_ERR, "%s statement is not allowed in booleanifs (tunableif treated as a booleanif) (%s:%d)\n", cil_node_to_string(node), cil_tree_node_path(node), cil_tree_node_line(node));
 			} else {
-				cil_log(CIL_ERR, "%s statement is not allowed in booleanifs (%s:%d)\n", cil_node_to_string(node), node->path, node->line);
+				cil_log(CIL_ERR, "%s statement is not allowed in booleanifs (%s:%d)\n", cil_node_to_string(node), cil_tree_node_path(node), cil_tree_node_line(node));
 			}
 			rc = SEPOL_ERR;
 			goto exit;
@@ -3265,18 +3629,23 @@ int __cil_resolve_ast_node_helper(struct cil_tree_node *node, __attribute__((unu
 		goto exit;
 	}
 
+	if (args->deps != NULL && pass == CIL_PASS_CALL1) {
+		cil_deps_add_node(args->deps, node);
+	}
+
 	rc = __cil_resolve_ast_node(node, extra_args);
 	if (rc == SEPOL_ENOENT && optstack != NULL) {
-		struct cil_optional *opt = (struct cil_optional *)optstack->data;
-		cil_log(CIL_WARN, "Disabling optional %s at %d of %s\n", opt->datum.name, node->parent->line, node->parent->path);
-		/* disable an optional if something failed to resolve */
-		opt->enabled = CIL_FALSE;
+		__cil_resolve_disable_optional(optstack->data, node);
 		rc = SEPOL_OK;
 	} else if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR, "Failed to resolve %s statement at %d of %s\n", cil_node_to_string(node), node->line, node->path);
+		cil_log(CIL_ERR, "Failed to resolve %s statement at %d of %s\n", cil_node_to_string(node), cil_tree_node_line(node), cil_tree_node_path(node));
 		goto exit;
 	}
 
+	if (pass == CIL_PASS_TIF || pass == CIL_PASS_CALL1) {
+		__cil_resolve_worklist_add(args, node);
+	}
+
 	return rc;
 
 exit:
@@ -3297,7 +3666,7 @@ int __cil_resolve_ast_first_child_helper(struct cil_tree_node *current, void *ex
 
 	callstack = args->callstack;
 	optstack = args->optstack;
-	parent = current->parent;
+	parent = cil_tree_node_parent(current);
 
 	if (parent->flavor == CIL_CALL || parent->flavor == CIL_OPTIONAL) {
 		/* push this node onto a stack */
@@ -3311,8 +3680,8 @@ int __cil_resolve_ast_first_child_helper(struct cil_tree_node *current, void *ex
 			if (callstack != NULL) {
 				struct cil_tree_node *curr = NULL;
 				struct cil_call *new_call = new->data;
-				for (curr = callstack->cl_head; curr != NULL;
-					curr = curr->cl_head) {
+				for (curr = cil_tree_node_head(callstack); curr != NULL;
+					curr = cil_tree_node_head(curr)) {
 					struct cil_call *curr_call = curr->data;
 					if (curr_call->macro == new_call->macro) {
 						cil_log(CIL_ERR, "Recursive macro call found\n");
@@ -3320,14 +3689,14 @@ int __cil_resolve_ast_first_child_helper(struct cil_tree_node *current, void *ex
 						goto exit;
 					}
 				}
-				callstack->parent = new;
-				new->cl_head = callstack;
+				cil_tree_node_set_parent(callstack, new);
+				cil_tree_node_set_head(new, callstack);
 			}
 			args->callstack = new;
 		} else if (parent->flavor == CIL_OPTIONAL) {
 			if (optstack != NULL) {
-				optstack->parent = new;
-				new->cl_head = optstack;
+				cil_tree_node_set_parent(optstack, new);
+				cil_tree_node_set_head(new, optstack);
 			}
 			args->optstack = new;
 		}
@@ -3354,16 +3723,16 @@ int __cil_resolve_ast_last_child_helper(struct cil_tree_node *current, void *ext
 		goto exit;
 	}
 
-	parent = current->parent;
+	parent = cil_tree_node_parent(current);
 
 	if (parent->flavor == CIL_CALL) {
 		/* pop off the stack */
 		struct cil_tree_node *callstack = args->callstack;
-		args->callstack = callstack->cl_head;
-		if (callstack->cl_head) {
-			callstack->cl_head->parent = NULL;
+		args->callstack = cil_tree_node_head(callstack);
+		if (cil_tree_node_head(callstack)) {
+			cil_tree_node_set_parent(cil_tree_node_head(callstack), NULL);
 		}
-		free(callstack);
+		cil_arena_release(callstack, sizeof(*callstack));
 	} else if (parent->flavor == CIL_MACRO) {
 		args->macro = NULL;
 	} else if (parent->flavor == CIL_OPTIONAL) {
@@ -3372,15 +3741,16 @@ int __cil_resolve_ast_last_child_helper(struct cil_tree_node *current, void *ext
 		if (((struct cil_optional *)parent->data)->enabled == CIL_FALSE) {
 			*(args->changed) = CIL_TRUE;
 			cil_tree_children_destroy(parent);
+			cil_resolve_cache_flush(args->db->resolve_cache);
 		}
 
 		/* pop off the stack */
 		optstack = args->optstack;
-		args->optstack = optstack->cl_head;
-		if (optstack->cl_head) {
-			optstack->cl_head->parent = NULL;
+		args->optstack = cil_tree_node_head(optstack);
+		if (cil_tree_node_head(optstack)) {
+			cil_tree_node_set_parent(cil_tree_node_head(optstack), NULL);
 		}
-		free(optstack);
+		cil_arena_release(optstack, sizeof(*optstack));
 	} else if (parent->flavor == CIL_BOOLEANIF) {
 		args->boolif = NULL;
 	}
@@ -3391,17 +3761,690 @@ exit:
 	return rc;
 }
 
+static int __cil_resolve_worklist_build_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args)
+{
+	struct cil_args_resolve *args = extra_args;
+
+	if (node->flavor == CIL_BLOCK && ((struct cil_block *)node->data)->is_abstract == CIL_TRUE && args->pass >= CIL_PASS_BLKABS) {
+		*finished = CIL_TREE_SKIP_HEAD;
+		return SEPOL_OK;
+	}
+
+	if (node->flavor == CIL_MACRO) {
+		*finished = CIL_TREE_SKIP_HEAD;
+	} else if (args->deps != NULL && args->pass == CIL_PASS_CALL1) {
+		cil_deps_add_node(args->deps, node);
+	}
+
+	__cil_resolve_worklist_add(args, node);
+
+	return SEPOL_OK;
+}
+
+/* Refill the worklists of the passes between the current one and the next
+ * walk once the tree has been copied into or pruned */
+static int __cil_resolve_worklists_build(struct cil_args_resolve *args, struct cil_tree_node *current)
+{
+	enum cil_pass pass;
+
+	for (pass = args->pass + 1; pass < CIL_PASS_NUM; pass++) {
+		args->worklists[pass].count = 0;
+	}
+
+	if (args->deps != NULL && args->pass == CIL_PASS_CALL1) {
+		/* The nodes are numbered again */
+		cil_deps_destroy(&args->deps);
+		cil_deps_init(&args->deps);
+	} else if (args->pass + 1 >= __cil_resolve_next_walk(args->pass)) {
+		return SEPOL_OK;
+	}
+
+	return cil_tree_walk(current, __cil_resolve_worklist_build_helper, NULL, NULL, args);
+}
+
+/* Drop the nodes going away with the disabled optionals from the worklists
+ * of the passes after last */
+static void __cil_resolve_worklists_prune(struct cil_args_resolve *args, enum cil_pass last)
+{
+	enum cil_pass pass;
+
+	for (pass = last + 1; pass < CIL_PASS_NUM; pass++) {
+		struct cil_vector *worklist = &args->worklists[pass];
+		void **nodes = cil_vector_data(worklist);
+		uint32_t i, j = 0;
+
+		for (i = 0; i < worklist->count; i++) {
+			if (!cil_deps_doomed(nodes[i])) {
+				nodes[j++] = nodes[i];
+			}
+		}
+		worklist->count = j;
+	}
+}
+
+/* Deal with node failing to resolve with rc. Not finding a name disables
+ * the nearest optional, which is destroyed once the pass is done. */
+static int __cil_resolve_failed(struct cil_args_resolve *args, struct cil_tree_node *node, int rc)
+{
+	struct cil_tree_node *optional = NULL;
+
+	if (rc == SEPOL_ENOENT) {
+		for (optional = cil_tree_node_parent(node); optional != NULL; optional = cil_tree_node_parent(optional)) {
+			if (optional->flavor == CIL_OPTIONAL) {
+				struct cil_optional *opt = optional->data;
+				if (opt->enabled == CIL_TRUE) {
+					cil_list_append(args->disabled, CIL_OPTIONAL, opt);
+				}
+				__cil_resolve_disable_optional(opt, node);
+				return SEPOL_OK;
+			}
+		}
+	}
+
+	cil_log(CIL_ERR, "Failed to resolve %s statement at %d of %s\n", cil_node_to_string(node), cil_tree_node_line(node), cil_tree_node_path(node));
+
+	return rc;
+}
+
+static int __cil_resolve_doomed(struct cil_args_resolve *args, struct cil_tree_node *node)
+{
+	/* Going away with its optional */
+	return args->disabled->head != NULL && cil_deps_doomed(node);
+}
+
+/* Resolve the nodes of a worklist in order */
+static int __cil_resolve_worklist(struct cil_args_resolve *args, struct cil_vector *worklist)
+{
+	int rc = SEPOL_ERR;
+	struct cil_tree_node *node = NULL;
+	uint32_t i;
+
+	cil_vector_for_each(node, i, worklist) {
+		if (__cil_resolve_doomed(args, node)) {
+			continue;
+		}
+
+		rc = __cil_resolve_ast_node(node, args);
+		if (rc != SEPOL_OK) {
+			rc = __cil_resolve_failed(args, node, rc);
+			if (rc != SEPOL_OK) {
+				goto exit;
+			}
+		}
+	}
+
+	return SEPOL_OK;
+
+exit:
+	return rc;
+}
+
+#define CIL_RESOLVE_CHUNK_SIZE 512
+
+struct cil_resolve_pool {
+	pthread_mutex_t mutex;
+	struct cil_args_resolve *args;
+	void **nodes;
+	uint8_t *local;
+	struct cil_resolve_chunk *chunks;
+	uint32_t num_chunks;
+	uint32_t next;
+	unsigned int hits;
+	unsigned int misses;
+	enum cil_log_level log_level;
+	void (*mem_error_handler)(void);
+};
+
+struct cil_resolve_worker {
+	struct cil_resolve_pool *pool;
+	struct cil_arena *arena;
+};
+
+static __thread struct cil_resolve_chunk *cil_resolve_log_chunk;
+
+/* Messages logged on a worker are kept with the statement being resolved */
+static void __cil_resolve_log_handler(int lvl, char *msg)
+{
+	struct cil_resolve_chunk *chunk = cil_resolve_log_chunk;
+
+	__cil_resolve_chunk_add(chunk, CIL_RESOLVE_EVENT_LOG, NULL, cil_strdup(msg), lvl);
+}
+
+/* Whether resolving node only writes to its own statement, or to shared
+ * state through the events of its chunk. Anonymous call arguments are shared
+ * by every statement in the call that names them, and are resolved again by
+ * each of them. */
+static int __cil_resolve_is_local(struct cil_tree_node *node)
+{
+	struct cil_tree_node *parent = NULL;
+	struct cil_list_item *item = NULL;
+
+	switch (node->flavor) {
+	case CIL_BOOLEANIF:
+	case CIL_CATSET:
+	case CIL_TYPEPERMISSIVE:
+	case CIL_RANGETRANSITION:
+	case CIL_AVRULE:
+	case CIL_TYPE_RULE:
+	case CIL_USERPREFIX:
+	case CIL_SELINUXUSER:
+	case CIL_SELINUXUSERDEFAULT:
+	case CIL_ROLETYPE:
+	case CIL_ROLETRANSITION:
+	case CIL_ROLEALLOW:
+	case CIL_LEVEL:
+	case CIL_LEVELRANGE:
+	case CIL_CONSTRAIN:
+	case CIL_MLSCONSTRAIN:
+	case CIL_VALIDATETRANS:
+	case CIL_MLSVALIDATETRANS:
+	case CIL_CONTEXT:
+	case CIL_FILECON:
+	case CIL_PORTCON:
+	case CIL_NODECON:
+	case CIL_GENFSCON:
+	case CIL_NETIFCON:
+	case CIL_PIRQCON:
+	case CIL_IOMEMCON:
+	case CIL_IOPORTCON:
+	case CIL_PCIDEVICECON:
+	case CIL_FSUSE:
+	case CIL_DEFAULTUSER:
+	case CIL_DEFAULTROLE:
+	case CIL_DEFAULTTYPE:
+	case CIL_DEFAULTRANGE:
+		break;
+	default:
+		return CIL_FALSE;
+	}
+
+	for (parent = cil_tree_node_parent(node); parent != NULL; parent = cil_tree_node_parent(parent)) {
+		if (parent->flavor == CIL_CALL) {
+			struct cil_call *call = parent->data;
+			cil_list_for_each(item, call->args) {
+				struct cil_args *arg = item->data;
+				if (arg->arg != NULL && arg->arg->name == NULL) {
+					return CIL_FALSE;
+				}
+			}
+		}
+	}
+
+	return CIL_TRUE;
+}
+
+/* Resolve the statements of the chunks handed out by the pool that only
+ * write to themselves. Everything else is left to the merge. */
+static void *__cil_resolve_worker(void *arg)
+{
+	struct cil_resolve_worker *worker = arg;
+	struct cil_resolve_pool *pool = worker->pool;
+	struct cil_args_resolve args = *pool->args;
+	struct cil_resolve_chunk *chunk = NULL;
+	struct cil_db_thread prev;
+	struct cil_arena *prev_arena = NULL;
+	uint32_t index;
+	uint32_t i;
+	int rc;
+
+	cil_db_enter(args.db, &prev);
+	prev_arena = cil_arena_enter(worker->arena);
+	cil_arena_defer(worker->arena);
+	cil_log_thread_level = pool->log_level;
+	cil_log_thread_handler = __cil_resolve_log_handler;
+	cil_mem_thread_error_handler = pool->mem_error_handler;
+	cil_resolve_cache_init(&args.cache);
+
+	while (1) {
+		pthread_mutex_lock(&pool->mutex);
+		index = pool->next < pool->num_chunks ? pool->next++ : pool->num_chunks;
+		pthread_mutex_unlock(&pool->mutex);
+
+		if (index == pool->num_chunks) {
+			break;
+		}
+
+		chunk = &pool->chunks[index];
+		args.chunk = chunk;
+		cil_resolve_log_chunk = chunk;
+
+		for (i = chunk->start; i < chunk->end; i++) {
+			pool->local[i] = __cil_resolve_is_local(pool->nodes[i]);
+			if (!pool->local[i]) {
+				continue;
+			}
+
+			chunk->current = i;
+			rc = __cil_resolve_ast_node(pool->nodes[i], &args);
+			if (rc != SEPOL_OK) {
+				__cil_resolve_chunk_add(chunk, CIL_RESOLVE_EVENT_FAIL, pool->nodes[i], NULL, rc);
+			}
+		}
+	}
+
+	pthread_mutex_lock(&pool->mutex);
+	pool->hits += args.cache->hits;
+	pool->misses += args.cache->misses;
+	pthread_mutex_unlock(&pool->mutex);
+
+	cil_resolve_cache_destroy(&args.cache);
+	cil_resolve_log_chunk = NULL;
+	cil_arena_enter(prev_arena);
+	cil_db_leave(&prev);
+
+	return NULL;
+}
+
+/* Go through the worklist in tree order, doing what the workers held back
+ * for the statements they resolved and resolving the rest, just as
+ * __cil_resolve_worklist() would have. */
+static int __cil_resolve_merge(struct cil_args_resolve *args, struct cil_resolve_pool *pool)
+{
+	int rc = SEPOL_ERR;
+	struct cil_resolve_chunk *chunk = NULL;
+	struct cil_resolve_event *event = NULL;
+	struct cil_tree_node *node = NULL;
+	uint32_t c, i, e;
+	int doomed;
+
+	for (c = 0; c < pool->num_chunks; c++) {
+		chunk = &pool->chunks[c];
+		e = 0;
+		for (i = chunk->start; i < chunk->end; i++) {
+			node = pool->nodes[i];
+			doomed = __cil_resolve_doomed(args, node);
+
+			if (!pool->local[i]) {
+				if (doomed) {
+					continue;
+				}
+				rc = __cil_resolve_ast_node(node, args);
+				if (rc != SEPOL_OK) {
+					rc = __cil_resolve_failed(args, node, rc);
+					if (rc != SEPOL_OK) {
+						goto exit;
+					}
+				}
+				continue;
+			}
+
+			for (; e < chunk->count && chunk->events[e].index == i; e++) {
+				event = &chunk->events[e];
+				if (doomed) {
+					continue;
+				}
+				switch (event->kind) {
+				case CIL_RESOLVE_EVENT_USE:
+					cil_deps_use(args->deps, event->node, event->data);
+					break;
+				case CIL_RESOLVE_EVENT_MARK:
+					((struct cil_typeattribute *)event->data)->used = CIL_TRUE;
+					if (args->deps != NULL) {
+						cil_deps_mark(args->deps, event->node, event->data);
+					}
+					break;
+				case CIL_RESOLVE_EVENT_LOG:
+					cil_log(event->value, "%s", (char *)event->data);
+					break;
+				case CIL_RESOLVE_EVENT_FAIL:
+					rc = __cil_resolve_failed(args, node, event->value);
+					if (rc != SEPOL_OK) {
+						goto exit;
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	return SEPOL_OK;
+
+exit:
+	return rc;
+}
+
+/* Give db an arena for each of count workers, the calling thread among
+ * them. What the workers allocate hangs off the AST, so the arenas last as
+ * long as the db. */
+static void __cil_resolve_arenas_reserve(struct cil_db *db, int count)
+{
+	int i;
+
+	if (db->num_resolve_arenas >= count) {
+		return;
+	}
+
+	db->resolve_arenas = cil_realloc(db->resolve_arenas, sizeof(*db->resolve_arenas) * count);
+	for (i = db->num_resolve_arenas; i < count; i++) {
+		cil_arena_init(&db->resolve_arenas[i]);
+	}
+	db->num_resolve_arenas = count;
+}
+
+/* Resolve a worklist on up to db->resolve_jobs threads. Each thread takes
+ * chunks of the worklist and resolves the statements in them that only
+ * write to themselves, holding back what that does to shared state. The
+ * calling thread then merges the chunks in order, so that the outcome, and
+ * what gets logged, is the same as resolving the worklist serially. */
+static int __cil_resolve_worklist_parallel(struct cil_args_resolve *args, struct cil_vector *worklist)
+{
+	int rc = SEPOL_ERR;
+	struct cil_db *db = args->db;
+	struct cil_resolve_pool pool;
+	struct cil_resolve_worker *workers = NULL;
+	pthread_t *threads = NULL;
+	int num_threads = 0;
+	int jobs = db->resolve_jobs;
+	uint32_t num_chunks = (worklist->count + CIL_RESOLVE_CHUNK_SIZE - 1) / CIL_RESOLVE_CHUNK_SIZE;
+	uint32_t c, e;
+	int i;
+
+	if (jobs < 1) {
+		jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if ((uint32_t)jobs > num_chunks) {
+		jobs = num_chunks;
+	}
+	if (jobs <= 1) {
+		return __cil_resolve_worklist(args, worklist);
+	}
+
+	pthread_mutex_init(&pool.mutex, NULL);
+	pool.args = args;
+	pool.nodes = cil_vector_data(worklist);
+	pool.local = cil_malloc(worklist->count);
+	pool.chunks = cil_calloc(num_chunks, sizeof(*pool.chunks));
+	pool.num_chunks = num_chunks;
+	pool.next = 0;
+	pool.hits = 0;
+	pool.misses = 0;
+	pool.log_level = cil_get_log_level();
+	pool.mem_error_handler = CIL_MEM_ERROR_HANDLER;
+
+	for (c = 0; c < num_chunks; c++) {
+		pool.chunks[c].start = c * CIL_RESOLVE_CHUNK_SIZE;
+		pool.chunks[c].end = pool.chunks[c].start + CIL_RESOLVE_CHUNK_SIZE;
+		if (pool.chunks[c].end > worklist->count) {
+			pool.chunks[c].end = worklist->count;
+		}
+	}
+
+	__cil_resolve_arenas_reserve(db, jobs);
+
+	/* The calling thread is one of the workers and leaves the db's own
+	 * arena alone while the others run. If a thread cannot be started the
+	 * others take on more of the chunks. */
+	workers = cil_malloc(sizeof(*workers) * jobs);
+	threads = cil_malloc(sizeof(*threads) * (jobs - 1));
+	for (i = 0; i < jobs; i++) {
+		workers[i].pool = &pool;
+		workers[i].arena = db->resolve_arenas[i];
+	}
+	for (i = 1; i < jobs; i++) {
+		if (pthread_create(&threads[num_threads], NULL, __cil_resolve_worker, &workers[i]) == 0) {
+			num_threads++;
+		}
+	}
+
+	__cil_resolve_worker(&workers[0]);
+
+	for (i = 0; i < num_threads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (i = 0; i < jobs; i++) {
+		cil_arena_release_deferred(db->resolve_arenas[i]);
+	}
+
+	args->cache->hits += pool.hits;
+	args->cache->misses += pool.misses;
+
+	rc = __cil_resolve_merge(args, &pool);
+
+	for (c = 0; c < num_chunks; c++) {
+		for (e = 0; e < pool.chunks[c].count; e++) {
+			if (pool.chunks[c].events[e].kind == CIL_RESOLVE_EVENT_LOG) {
+				free(pool.chunks[c].events[e].data);
+			}
+		}
+		free(pool.chunks[c].events);
+	}
+	free(threads);
+	free(workers);
+	free(pool.chunks);
+	free(pool.local);
+	pthread_mutex_destroy(&pool.mutex);
+
+	return rc;
+}
+
+static int __cil_resolve_in_abstract(struct cil_tree_node *node)
+{
+	for (node = cil_tree_node_parent(node); node != NULL; node = cil_tree_node_parent(node)) {
+		if (node->flavor == CIL_BLOCK && ((struct cil_block *)node->data)->is_abstract == CIL_TRUE) {
+			return CIL_TRUE;
+		}
+	}
+
+	return CIL_FALSE;
+}
+
+/* Walk the macros, other than those in abstract blocks, for the calls in
+ * them. Calls copied in are walked as they are expanded. */
+static int __cil_resolve_macros(struct cil_args_resolve *args)
+{
+	int rc = SEPOL_OK;
+	struct cil_tree_node *node = NULL;
+	uint32_t i;
+
+	cil_vector_for_each(node, i, &args->worklists[CIL_PASS_MACRO]) {
+		if (__cil_resolve_in_abstract(node)) {
+			continue;
+		}
+
+		rc = cil_tree_walk(node, __cil_resolve_ast_node_helper, __cil_resolve_ast_first_child_helper, __cil_resolve_ast_last_child_helper, args);
+		if (rc != SEPOL_OK) {
+			break;
+		}
+	}
+
+	return rc;
+}
+
+static int __cil_resolve_pass(struct cil_args_resolve *args, struct cil_tree_node *current)
+{
+	switch (args->pass) {
+	case CIL_PASS_TIF:
+	case CIL_PASS_CALL1:
+		return cil_tree_walk(current, __cil_resolve_ast_node_helper, __cil_resolve_ast_first_child_helper, __cil_resolve_ast_last_child_helper, args);
+	case CIL_PASS_MACRO:
+		return __cil_resolve_macros(args);
+	case CIL_PASS_MISC1:
+	case CIL_PASS_MLS:
+	case CIL_PASS_MISC2:
+	case CIL_PASS_MISC3:
+		return __cil_resolve_worklist_parallel(args, &args->worklists[args->pass]);
+	default:
+		return __cil_resolve_worklist(args, &args->worklists[args->pass]);
+	}
+}
+
+/* Destroy the contents of the optionals disabled while going through a
+ * worklist */
+static void __cil_resolve_destroy_disabled(struct cil_args_resolve *args)
+{
+	struct cil_list_item *item = NULL;
+	struct cil_tree_node *node = NULL;
+	struct cil_vector roots;
+	uint32_t i;
+
+	cil_vector_init(&roots);
+
+	/* Optionals in ones being disabled go away with them */
+	cil_list_for_each(item, args->disabled) {
+		struct cil_optional *opt = item->data;
+		cil_vector_for_each(node, i, &opt->datum.nodes) {
+			if (!cil_deps_doomed(node)) {
+				cil_vector_append(&roots, node);
+			}
+		}
+	}
+
+	cil_vector_for_each(node, i, &roots) {
+		cil_tree_children_destroy(node);
+	}
+	cil_resolve_cache_flush(args->db->resolve_cache);
+
+	cil_vector_destroy(&roots);
+	cil_list_destroy(&args->disabled, CIL_FALSE);
+	cil_list_init(&args->disabled, CIL_OPTIONAL);
+	*(args->changed) = CIL_TRUE;
+}
+
+/* Merge the ordering statements resolved in the MISC1 pass */
+static int __cil_resolve_ordered(struct cil_args_resolve *args, struct cil_tree_node *current)
+{
+	int rc = SEPOL_ERR;
+	struct cil_db *db = args->db;
+
+	if (db->base != NULL) {
+		__cil_ordered_lists_seed(args->sidorder_lists, db->base->sidorder);
+		__cil_ordered_lists_seed(args->classorder_lists, db->base->classorder);
+		__cil_ordered_lists_seed(args->catorder_lists, db->base->catorder);
+		__cil_ordered_lists_seed(args->sensitivityorder_lists, db->base->sensitivityorder);
+	}
+	db->sidorder = __cil_ordered_lists_merge_all(&args->sidorder_lists);
+	db->classorder = __cil_ordered_lists_merge_all(&args->classorder_lists);
+	db->catorder = __cil_ordered_lists_merge_all(&args->catorder_lists);
+	db->sensitivityorder = __cil_ordered_lists_merge_all(&args->sensitivityorder_lists);
+	if (db->base != NULL) {
+		rc = __cil_verify_settled_prefix(db->base->catorder, db->catorder);
+		if (rc != SEPOL_OK) {
+			goto exit;
+		}
+	}
+	cil_set_cat_values(db->catorder, db);
+
+	rc = __cil_verify_ordered(current, CIL_SID);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	rc = __cil_verify_ordered(current, CIL_CLASS);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	rc = __cil_verify_ordered(current, CIL_CAT);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	rc = __cil_verify_ordered(current, CIL_SENS);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	return SEPOL_OK;
+
+exit:
+	return rc;
+}
+
+/* Undo the merge so the ordering statements can be resolved again */
+static void __cil_resolve_ordered_reset(struct cil_args_resolve *args)
+{
+	struct cil_db *db = args->db;
+
+	__cil_ordered_lists_reset(&args->sidorder_lists);
+	__cil_ordered_lists_reset(&args->classorder_lists);
+	__cil_ordered_lists_reset(&args->catorder_lists);
+	__cil_ordered_lists_reset(&args->sensitivityorder_lists);
+	__cil_ordered_unmark(db->sidorder);
+	__cil_ordered_unmark(db->classorder);
+	__cil_ordered_unmark(db->catorder);
+	__cil_ordered_unmark(db->sensitivityorder);
+	cil_list_destroy(&db->sidorder, CIL_FALSE);
+	cil_list_destroy(&db->classorder, CIL_FALSE);
+	cil_list_destroy(&db->catorder, CIL_FALSE);
+	cil_list_destroy(&db->sensitivityorder, CIL_FALSE);
+}
+
+/* Destroy the optionals disabled up to and including the last pass, and
+ * resolve what depended on them again, pass by pass, in tree order. This
+ * repeats while that disables more optionals. */
+static int __cil_resolve_disabled(struct cil_args_resolve *args, struct cil_tree_node *current, enum cil_pass last)
+{
+	int rc = SEPOL_ERR;
+	struct cil_vector dirty;
+	uint32_t reorder = CIL_FALSE;
+	enum cil_pass pass;
+
+	cil_vector_init(&dirty);
+
+	while (args->disabled->head != NULL) {
+		cil_log(CIL_INFO, "Resetting statements depending on disabled optionals\n");
+
+		__cil_resolve_worklists_prune(args, last);
+
+		rc = cil_deps_disable(args->deps, args->disabled, &dirty, &reorder);
+		if (rc != SEPOL_OK) {
+			cil_log(CIL_ERR, "Failed to reset statements\n");
+			goto exit;
+		}
+		cil_resolve_cache_flush(args->db->resolve_cache);
+		cil_list_destroy(&args->disabled, CIL_FALSE);
+		cil_list_init(&args->disabled, CIL_OPTIONAL);
+
+		/* Ordering statements are only resolved from the MISC1 pass on */
+		reorder = (reorder && last >= CIL_PASS_MISC1);
+		if (reorder) {
+			__cil_resolve_ordered_reset(args);
+		}
+
+		for (pass = CIL_PASS_CALL2; pass <= last; pass++) {
+			args->pass = pass;
+
+			rc = __cil_resolve_worklist(args, &dirty);
+			if (rc != SEPOL_OK) {
+				goto exit;
+			}
+
+			if (pass == CIL_PASS_MISC1 && reorder) {
+				rc = __cil_resolve_ordered(args, current);
+				if (rc != SEPOL_OK) {
+					goto exit;
+				}
+			}
+		}
+
+		cil_vector_destroy(&dirty);
+	}
+
+	args->pass = last;
+	rc = SEPOL_OK;
+
+exit:
+	cil_vector_destroy(&dirty);
+	return rc;
+}
+
 int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 {
 	int rc = SEPOL_ERR;
 	struct cil_args_resolve extra_args;
 	enum cil_pass pass = CIL_PASS_TIF;
 	uint32_t changed = 0;
+	uint32_t rebuild = 0;
 
 	if (db == NULL || current == NULL) {
-		goto exit;
+		return SEPOL_ERR;
 	}
 
+	/* Resolution copies and prunes the tree, so any index is stale */
+	cil_index_destroy(&db->index);
+	cil_resolve_cache_flush(db->resolve_cache);
+
 	extra_args.db = db;
 	extra_args.pass = pass;
 	extra_args.changed = &changed;
@@ -3414,21 +4457,47 @@ int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 	extra_args.catorder_lists = NULL;
 	extra_args.sensitivityorder_lists = NULL;
 	extra_args.in_list = NULL;
+	extra_args.deps = NULL;
+	extra_args.disabled = NULL;
+	extra_args.cache = db->resolve_cache;
+	extra_args.chunk = NULL;
 
 	cil_list_init(&extra_args.sidorder_lists, CIL_LIST_ITEM);
 	cil_list_init(&extra_args.classorder_lists, CIL_LIST_ITEM);
 	cil_list_init(&extra_args.catorder_lists, CIL_LIST_ITEM);
 	cil_list_init(&extra_args.sensitivityorder_lists, CIL_LIST_ITEM);
 	cil_list_init(&extra_args.in_list, CIL_IN);
+	cil_list_init(&extra_args.disabled, CIL_OPTIONAL);
+	for (pass = CIL_PASS_TIF; pass < CIL_PASS_NUM; pass++) {
+		cil_vector_init(&extra_args.worklists[pass]);
+	}
+
 	for (pass = CIL_PASS_TIF; pass < CIL_PASS_NUM; pass++) {
 		extra_args.pass = pass;
-		rc = cil_tree_walk(current, __cil_resolve_ast_node_helper, __cil_resolve_ast_first_child_helper, __cil_resolve_ast_last_child_helper, &extra_args);
+
+		if (pass == CIL_PASS_BLKIN_COPY && db->base != NULL) {
+			rc = __cil_resolve_base_blockinherits(db);
+			if (rc != SEPOL_OK) {
+				goto exit;
+			}
+		}
+
+		/* Nothing is copied into the tree after the call1 pass, so from
+		 * then on disabling an optional only undoes what depended on it.
+		 * Statements resolved against a compiled base are reset with it.
+		 * The call1 walk numbers the nodes. */
+		if (pass == CIL_PASS_CALL1 && db->base == NULL && db->full_reset == CIL_FALSE) {
+			cil_deps_init(&extra_args.deps);
+		}
+
+		rc = __cil_resolve_pass(&extra_args, current);
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_INFO, "Pass %i of resolution failed\n", pass);
 			goto exit;
 		}
 
 		if (pass == CIL_PASS_IN) {
+			rebuild = (extra_args.in_list->head != NULL);
 			rc = cil_resolve_in_list(&extra_args);
 			if (rc != SEPOL_OK) {
 				goto exit;
@@ -3437,31 +4506,23 @@ int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 		}
 
 		if (pass == CIL_PASS_MISC1) {
-			db->sidorder = __cil_ordered_lists_merge_all(&extra_args.sidorder_lists);
-			db->classorder = __cil_ordered_lists_merge_all(&extra_args.classorder_lists);
-			db->catorder = __cil_ordered_lists_merge_all(&extra_args.catorder_lists);
-			cil_set_cat_values(db->catorder, db);
-			db->sensitivityorder = __cil_ordered_lists_merge_all(&extra_args.sensitivityorder_lists);
-
-			rc = __cil_verify_ordered(current, CIL_SID);
-			if (rc != SEPOL_OK) {
-				goto exit;
-			}
-
-			rc = __cil_verify_ordered(current, CIL_CLASS);
+			rc = __cil_resolve_ordered(&extra_args, current);
 			if (rc != SEPOL_OK) {
 				goto exit;
 			}
+		}
 
-			rc = __cil_verify_ordered(current, CIL_CAT);
-			if (rc != SEPOL_OK) {
-				goto exit;
-			}
+		if (pass == CIL_PASS_BLKIN_COPY) {
+			rebuild = (extra_args.worklists[CIL_PASS_BLKIN_LINK].count > 0 || db->base != NULL);
+		}
 
-			rc = __cil_verify_ordered(current, CIL_SENS);
+		if (extra_args.deps != NULL && pass > CIL_PASS_CALL1) {
+			rc = __cil_resolve_disabled(&extra_args, current, pass);
 			if (rc != SEPOL_OK) {
 				goto exit;
 			}
+		} else if (extra_args.disabled->head != NULL) {
+			__cil_resolve_destroy_disabled(&extra_args);
 		}
 
 		if (changed && (pass > CIL_PASS_CALL1)) {
@@ -3475,14 +4536,7 @@ int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 			cil_log(CIL_INFO, "Resetting declarations\n");
 
 			if (pass >= CIL_PASS_MISC1) {
-				__cil_ordered_lists_reset(&extra_args.sidorder_lists);
-				__cil_ordered_lists_reset(&extra_args.classorder_lists);
-				__cil_ordered_lists_reset(&extra_args.catorder_lists);
-				__cil_ordered_lists_reset(&extra_args.sensitivityorder_lists);
-				cil_list_destroy(&db->sidorder, CIL_FALSE);
-				cil_list_destroy(&db->classorder, CIL_FALSE);
-				cil_list_destroy(&db->catorder, CIL_FALSE);
-				cil_list_destroy(&db->sensitivityorder, CIL_FALSE);
+				__cil_resolve_ordered_reset(&extra_args);
 			}
 
 			pass = CIL_PASS_CALL1;
@@ -3492,20 +4546,33 @@ int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 				cil_log(CIL_ERR, "Failed to reset declarations\n");
 				goto exit;
 			}
+			cil_resolve_cache_flush(db->resolve_cache);
+			if (db->base != NULL) {
+				cil_reset_base_restore(db->base);
+			}
+			extra_args.pass = pass;
+		}
+
+		if (changed || rebuild) {
+			rc = __cil_resolve_worklists_build(&extra_args, current);
+			if (rc != SEPOL_OK) {
+				goto exit;
+			}
 		}
 
 		/* reset the arguments */
 		changed = 0;
+		rebuild = 0;
 		while (extra_args.callstack != NULL) {
 			struct cil_tree_node *curr = extra_args.callstack;
-			struct cil_tree_node *next = curr->cl_head;
-			free(curr);
+			struct cil_tree_node *next = cil_tree_node_head(curr);
+			cil_arena_release(curr, sizeof(*curr));
 			extra_args.callstack = next;
 		}
 		while (extra_args.optstack != NULL) {
 			struct cil_tree_node *curr = extra_args.optstack;
-			struct cil_tree_node *next = curr->cl_head;
-			free(curr);
+			struct cil_tree_node *next = cil_tree_node_head(curr);
+			cil_arena_release(curr, sizeof(*curr));
 			extra_args.optstack = next;
 		}
 	}
@@ -3517,12 +4584,18 @@ int cil_resolve_ast(struct cil_db *db, struct cil_tree_node *current)
 
 	rc = SEPOL_OK;
 exit:
+	cil_resolve_cache_release(db->resolve_cache);
+	cil_deps_destroy(&extra_args.deps);
+	cil_list_destroy(&extra_args.disabled, CIL_FALSE);
+	for (pass = CIL_PASS_TIF; pass < CIL_PASS_NUM; pass++) {
+		cil_vector_destroy(&extra_args.worklists[pass]);
+	}
 	return rc;
 }
 
 static int __cil_resolve_name_with_root(struct cil_db *db, char *name, enum cil_sym_index sym_index, struct cil_symtab_datum **datum)
 {
-	symtab_t *symtab = &((struct cil_root *)db->ast->root->data)->symtab[sym_index];
+	struct cil_symtab *symtab = &((struct cil_root *)db->ast->root->data)->symtab[sym_index];
 
 	return cil_symtab_get_datum(symtab, name, datum);
 }
@@ -3530,7 +4603,7 @@ static int __cil_resolve_name_with_root(struct cil_db *db, char *name, enum cil_
 static int __cil_resolve_name_with_parents(struct cil_tree_node *node, char *name, enum cil_sym_index sym_index, struct cil_symtab_datum **datum)
 {
 	int rc = SEPOL_ERR;
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 
 	while (node != NULL && rc != SEPOL_OK) {
 		switch (node->flavor) {
@@ -3543,7 +4616,7 @@ static int __cil_resolve_name_with_parents(struct cil_tree_node *node, char *nam
 			break;
 		case CIL_BLOCKINHERIT: {
 			struct cil_blockinherit *inherit = node->data;
-			rc = __cil_resolve_name_with_parents(node->parent, name, sym_index, datum);
+			rc = __cil_resolve_name_with_parents(cil_tree_node_parent(node), name, sym_index, datum);
 			if (rc != SEPOL_OK) {
 				/* Continue search in original block's parent */
 				rc = __cil_resolve_name_with_parents(NODE(inherit->block), name, sym_index, datum);
@@ -3562,7 +4635,7 @@ static int __cil_resolve_name_with_parents(struct cil_tree_node *node, char *nam
 			rc = cil_resolve_name_call_args(call, name, sym_index, datum);
 			if (rc != SEPOL_OK) {
 				/* Continue search in macro's parent */
-				rc = __cil_resolve_name_with_parents(NODE(call->macro)->parent, name, sym_index, datum);
+				rc = __cil_resolve_name_with_parents(cil_tree_node_parent(NODE(call->macro)), name, sym_index, datum);
 			}
 		}
 			break;
@@ -3574,21 +4647,59 @@ static int __cil_resolve_name_with_parents(struct cil_tree_node *node, char *nam
 			break;
 		}
 
-		node = node->parent;
+		node = cil_tree_node_parent(node);
 	}
 
 exit:
 	return rc;
 }
 
-static int __cil_resolve_name_helper(struct cil_db *db, struct cil_tree_node *node, char *name, enum cil_sym_index sym_index, struct cil_symtab_datum **datum)
+/* The nearest node above a statement that name resolution looks in */
+static struct cil_tree_node *__cil_resolve_name_scope(struct cil_tree_node *node)
+{
+	for (; node != NULL; node = cil_tree_node_parent(node)) {
+		switch (node->flavor) {
+		case CIL_ROOT:
+		case CIL_BLOCK:
+		case CIL_BLOCKINHERIT:
+		case CIL_MACRO:
+		case CIL_CALL:
+			return node;
+		default:
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static int __cil_resolve_name_helper(struct cil_args_resolve *args, struct cil_tree_node *node, char *name, enum cil_sym_index sym_index, struct cil_symtab_datum **datum)
 {
 	int rc = SEPOL_ERR;
+	struct cil_db *db = args->db;
+	struct cil_tree_node *scope = __cil_resolve_name_scope(node);
+
+	if (scope == NULL || scope->flavor == CIL_ROOT) {
+		/* Only the root symtab to look in */
+		scope = NULL;
+	} else {
+		*datum = cil_resolve_cache_lookup(args->cache, scope, name, sym_index);
+		if (*datum != NULL) {
+			return SEPOL_OK;
+		}
+	}
 
-	rc = __cil_resolve_name_with_parents(node, name, sym_index, datum);
+	rc = __cil_resolve_name_with_parents(scope, name, sym_index, datum);
 	if (rc != SEPOL_OK) {
 		rc = __cil_resolve_name_with_root(db, name, sym_index, datum);
 	}
+
+	/* An argument of a call not resolved yet answers NULL, which is not
+	 * kept, so resolving the arguments leaves the cache valid */
+	if (rc == SEPOL_OK && scope != NULL && *datum != NULL) {
+		cil_resolve_cache_insert(args->cache, scope, name, sym_index, *datum);
+	}
+
 	return rc;
 }
 
@@ -3608,34 +4719,35 @@ int cil_resolve_name(struct cil_tree_node *ast_node, char *name, enum cil_sym_in
 
 	if (strchr(name,'.') == NULL) {
 		/* No '.' in name */
-		rc = __cil_resolve_name_helper(db, ast_node->parent, name, sym_index, datum);
+		rc = __cil_resolve_name_helper(args, cil_tree_node_parent(ast_node), name, sym_index, datum);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
 	} else {
-		char *sp = NULL;
-		char *name_dup = cil_strdup(name);
-		char *current = strtok_r(name_dup, ".", &sp);
-		char *next = strtok_r(NULL, ".", &sp);
-		symtab_t *symtab = NULL;
-		
+		const struct cil_strpool_name *qname = cil_strpool_name(name);
+		struct cil_symtab *symtab = NULL;
+		uint32_t i;
+
+		if (qname->count == 0) {
+			rc = SEPOL_ERR;
+			goto exit;
+		}
+
 		node = ast_node;
-		if (*name == '.') {
+		if (qname->leading_dot) {
 			/* Leading '.' */
 			symtab = &((struct cil_root *)db->ast->root->data)->symtab[CIL_SYM_BLOCKS];
 		} else {
-			rc = __cil_resolve_name_helper(db, node->parent, current, CIL_SYM_BLOCKS, datum);
+			rc = __cil_resolve_name_helper(args, cil_tree_node_parent(node), qname->segments[0], CIL_SYM_BLOCKS, datum);
 			if (rc != SEPOL_OK) {
-				free(name_dup);
 				goto exit;
 			}
 			symtab = (*datum)->symtab;
 		}
 		/* Keep looking up blocks by name until only last part of name remains */
-		while (next != NULL) {
-			rc = cil_symtab_get_datum(symtab, current, datum);
+		for (i = 0; i + 1 < qname->count; i++) {
+			rc = cil_symtab_get_datum(symtab, qname->segments[i], datum);
 			if (rc != SEPOL_OK) {
-				free(name_dup);
 				goto exit;
 			}
 			node = NODE(*datum);
@@ -3644,7 +4756,6 @@ int cil_resolve_name(struct cil_tree_node *ast_node, char *name, enum cil_sym_in
 			} else {
 				if (ast_node->flavor != CIL_IN) {
 					cil_log(CIL_WARN, "Can only use %s name for name resolution in \"in\" blocks\n", cil_node_to_string(node));
-					free(name_dup);
 					rc = SEPOL_ERR;
 					goto exit;
 				}
@@ -3656,12 +4767,9 @@ int cil_resolve_name(struct cil_tree_node *ast_node, char *name, enum cil_sym_in
 					symtab = (*datum)->symtab;
 				}
 			}
-			current = next;
-			next = strtok_r(NULL, ".", &sp);
 		}
 		symtab = &(symtab[sym_index]);
-		rc = cil_symtab_get_datum(symtab, current, datum);
-		free(name_dup);
+		rc = cil_symtab_get_datum(symtab, qname->segments[i], datum);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -3673,7 +4781,7 @@ exit:
 	if (rc != SEPOL_OK) {
 		*datum = NULL;
 		cil_log(CIL_WARN, "Failed to resolve %s in %s statement on line %d of %s\n", 
-			name, cil_node_to_string(ast_node), ast_node->line, ast_node->path);
+			name, cil_node_to_string(ast_node), cil_tree_node_line(ast_node), cil_tree_node_path(ast_node));
 	}
 
 	if (*datum != NULL) {
@@ -3687,7 +4795,9 @@ exit:
 			if (alias->actual) {
 				*datum = alias->actual;
 			}
+			__cil_resolve_used(args, ast_node, &alias->datum);
 		}
+		__cil_resolve_used(args, ast_node, *datum);
 	}
 
 	return rc;
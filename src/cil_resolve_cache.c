@@ -0,0 +1,263 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cil_mem.h"
+#include "cil_resolve_cache.h"
+
+#define CIL_RESOLVE_CACHE_MIN_SIZE	(1 << 10)
+#define CIL_RESOLVE_CACHE_KILLS_MIN_SIZE	(1 << 6)
+
+void cil_resolve_cache_init(struct cil_resolve_cache **cache)
+{
+	struct cil_resolve_cache *new_cache = cil_malloc(sizeof(*new_cache));
+
+	new_cache->entries = NULL;
+	new_cache->kills = NULL;
+	new_cache->size = 0;
+	new_cache->count = 0;
+	new_cache->kills_size = 0;
+	new_cache->kills_count = 0;
+	new_cache->gen = 1;
+	new_cache->stamp = 1;
+	new_cache->hits = 0;
+	new_cache->misses = 0;
+
+	*cache = new_cache;
+}
+
+void cil_resolve_cache_destroy(struct cil_resolve_cache **cache)
+{
+	if (cache == NULL || *cache == NULL) {
+		return;
+	}
+
+	free((*cache)->entries);
+	free((*cache)->kills);
+	free(*cache);
+	*cache = NULL;
+}
+
+static uint32_t __cil_resolve_cache_hash(struct cil_tree_node *scope, char *name, uint32_t sym_index)
+{
+	uintptr_t key = ((uintptr_t)name >> 3) * 0x9e3779b1;
+
+	key ^= ((uintptr_t)scope >> 4) * 0x85ebca77;
+	key ^= sym_index;
+
+	return (uint32_t)(key ^ (key >> 16));
+}
+
+static struct cil_resolve_cache_entry *__cil_resolve_cache_find(struct cil_resolve_cache *cache, struct cil_tree_node *scope, char *name, uint32_t sym_index)
+{
+	uint32_t mask = cache->size - 1;
+	uint32_t i = __cil_resolve_cache_hash(scope, name, sym_index) & mask;
+
+	/* Entries of older generations count as empty */
+	while (cache->entries[i].gen == cache->gen) {
+		struct cil_resolve_cache_entry *entry = &cache->entries[i];
+		if (entry->name == name && entry->scope == scope && entry->sym_index == sym_index) {
+			break;
+		}
+		i = (i + 1) & mask;
+	}
+
+	return &cache->entries[i];
+}
+
+static struct cil_resolve_cache_kill *__cil_resolve_cache_find_kill(struct cil_resolve_cache *cache, char *name, uint32_t sym_index)
+{
+	uint32_t mask = cache->kills_size - 1;
+	uint32_t i = __cil_resolve_cache_hash(NULL, name, sym_index) & mask;
+
+	while (cache->kills[i].gen == cache->gen) {
+		struct cil_resolve_cache_kill *kill = &cache->kills[i];
+		if (kill->name == name && kill->sym_index == sym_index) {
+			break;
+		}
+		i = (i + 1) & mask;
+	}
+
+	return &cache->kills[i];
+}
+
+/* Whether the name of an entry was declared again since it was stored */
+static int __cil_resolve_cache_killed(struct cil_resolve_cache *cache, struct cil_resolve_cache_entry *entry)
+{
+	struct cil_resolve_cache_kill *kill = NULL;
+
+	if (entry->stamp == cache->stamp || cache->kills_count == 0) {
+		return 0;
+	}
+
+	kill = __cil_resolve_cache_find_kill(cache, entry->name, entry->sym_index);
+
+	return kill->gen == cache->gen && entry->stamp < kill->stamp;
+}
+
+struct cil_symtab_datum *cil_resolve_cache_lookup(struct cil_resolve_cache *cache, struct cil_tree_node *scope, char *name, uint32_t sym_index)
+{
+	struct cil_resolve_cache_entry *entry = NULL;
+
+	if (cache->count > 0) {
+		entry = __cil_resolve_cache_find(cache, scope, name, sym_index);
+		if (entry->gen == cache->gen && !__cil_resolve_cache_killed(cache, entry)) {
+			cache->hits++;
+			return entry->datum;
+		}
+	}
+
+	cache->misses++;
+
+	return NULL;
+}
+
+static void __cil_resolve_cache_grow(struct cil_resolve_cache *cache)
+{
+	struct cil_resolve_cache_entry *old = cache->entries;
+	uint32_t old_size = cache->size;
+	uint32_t i;
+
+	cache->size = old_size ? old_size * 2 : CIL_RESOLVE_CACHE_MIN_SIZE;
+	cache->entries = cil_calloc(cache->size, sizeof(*cache->entries));
+
+	for (i = 0; i < old_size; i++) {
+		if (old[i].gen == cache->gen) {
+			*__cil_resolve_cache_find(cache, old[i].scope, old[i].name, old[i].sym_index) = old[i];
+		}
+	}
+
+	free(old);
+}
+
+void cil_resolve_cache_insert(struct cil_resolve_cache *cache, struct cil_tree_node *scope, char *name, uint32_t sym_index, struct cil_symtab_datum *datum)
+{
+	struct cil_resolve_cache_entry *entry = NULL;
+
+	if ((cache->count + 1) * 2 > cache->size) {
+		__cil_resolve_cache_grow(cache);
+	}
+
+	entry = __cil_resolve_cache_find(cache, scope, name, sym_index);
+	if (entry->gen != cache->gen) {
+		entry->name = name;
+		entry->scope = scope;
+		entry->sym_index = sym_index;
+		entry->gen = cache->gen;
+		cache->count++;
+	}
+	entry->datum = datum;
+	entry->stamp = cache->stamp;
+}
+
+static void __cil_resolve_cache_grow_kills(struct cil_resolve_cache *cache)
+{
+	struct cil_resolve_cache_kill *old = cache->kills;
+	uint32_t old_size = cache->kills_size;
+	uint32_t i;
+
+	cache->kills_size = old_size ? old_size * 2 : CIL_RESOLVE_CACHE_KILLS_MIN_SIZE;
+	cache->kills = cil_calloc(cache->kills_size, sizeof(*cache->kills));
+
+	for (i = 0; i < old_size; i++) {
+		if (old[i].gen == cache->gen) {
+			*__cil_resolve_cache_find_kill(cache, old[i].name, old[i].sym_index) = old[i];
+		}
+	}
+
+	free(old);
+}
+
+/* Forget what name resolved to from every scope, for when a declaration of
+ * name was added to the tree. Lookups of other names keep their entries. */
+void cil_resolve_cache_invalidate(struct cil_resolve_cache *cache, char *name, uint32_t sym_index)
+{
+	struct cil_resolve_cache_kill *kill = NULL;
+
+	if (cache->count == 0) {
+		return;
+	}
+
+	if (cache->stamp == UINT32_MAX) {
+		cil_resolve_cache_flush(cache);
+		cache->stamp = 1;
+		return;
+	}
+
+	if ((cache->kills_count + 1) * 2 > cache->kills_size) {
+		__cil_resolve_cache_grow_kills(cache);
+	}
+
+	kill = __cil_resolve_cache_find_kill(cache, name, sym_index);
+	if (kill->gen != cache->gen) {
+		kill->name = name;
+		kill->sym_index = sym_index;
+		kill->gen = cache->gen;
+		cache->kills_count++;
+	}
+	kill->stamp = ++cache->stamp;
+}
+
+/* Forget every entry, for when declarations were added to or removed from
+ * the tree */
+void cil_resolve_cache_flush(struct cil_resolve_cache *cache)
+{
+	if (cache->count == 0) {
+		return;
+	}
+
+	cache->count = 0;
+	cache->kills_count = 0;
+	cache->gen++;
+	if (cache->gen == 0) {
+		memset(cache->entries, 0, sizeof(*cache->entries) * cache->size);
+		if (cache->kills != NULL) {
+			memset(cache->kills, 0, sizeof(*cache->kills) * cache->kills_size);
+		}
+		cache->gen = 1;
+	}
+}
+
+/* Free the table once resolution is done, keeping the counters */
+void cil_resolve_cache_release(struct cil_resolve_cache *cache)
+{
+	free(cache->entries);
+	free(cache->kills);
+	cache->entries = NULL;
+	cache->kills = NULL;
+	cache->size = 0;
+	cache->count = 0;
+	cache->kills_size = 0;
+	cache->kills_count = 0;
+	cache->gen = 1;
+	cache->stamp = 1;
+}
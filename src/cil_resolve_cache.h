@@ -0,0 +1,82 @@
+/*
+ * Copyright 2011 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#ifndef CIL_RESOLVE_CACHE_H_
+#define CIL_RESOLVE_CACHE_H_
+
+#include <stdint.h>
+
+#include "cil_symtab.h"
+#include "cil_tree.h"
+
+struct cil_resolve_cache_entry {
+	char *name;
+	struct cil_tree_node *scope;
+	struct cil_symtab_datum *datum;
+	uint32_t sym_index;
+	uint32_t gen;
+	uint32_t stamp;
+};
+
+struct cil_resolve_cache_kill {
+	char *name;
+	uint32_t sym_index;
+	uint32_t gen;
+	uint32_t stamp;
+};
+
+/* What names resolved to from a scope, keyed by the interned name, the
+ * symbol table index and the nearest block, blockinherit, macro or call
+ * above the statement. Only successful lookups are kept. Flushing bumps the
+ * generation instead of clearing the table, since it happens every time the
+ * tree is pruned. A copy that only declares new names invalidates those
+ * names instead: each kill records the stamp it was made at, and an entry
+ * stamped before the kill of its name and symbol table counts as a miss. */
+struct cil_resolve_cache {
+	struct cil_resolve_cache_entry *entries;
+	struct cil_resolve_cache_kill *kills;
+	uint32_t size;
+	uint32_t count;
+	uint32_t kills_size;
+	uint32_t kills_count;
+	uint32_t gen;
+	uint32_t stamp;
+	unsigned int hits;
+	unsigned int misses;
+};
+
+void cil_resolve_cache_init(struct cil_resolve_cache **cache);
+void cil_resolve_cache_destroy(struct cil_resolve_cache **cache);
+struct cil_symtab_datum *cil_resolve_cache_lookup(struct cil_resolve_cache *cache, struct cil_tree_node *scope, char *name, uint32_t sym_index);
+void cil_resolve_cache_insert(struct cil_resolve_cache *cache, struct cil_tree_node *scope, char *name, uint32_t sym_index, struct cil_symtab_datum *datum);
+void cil_resolve_cache_invalidate(struct cil_resolve_cache *cache, char *name, uint32_t sym_index);
+void cil_resolve_cache_flush(struct cil_resolve_cache *cache);
+void cil_resolve_cache_release(struct cil_resolve_cache *cache);
+
+#endif /* CIL_RESOLVE_CACHE_H_ */
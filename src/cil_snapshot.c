@@ -0,0 +1,2680 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+/*
+ * Snapshot of a compiled database.
+ *
+ * An image holds the state that cil_compile() leaves behind: the AST and
+ * every payload hanging off it, the symbol tables, the ordered lists, the
+ * sorted context statements, the index and the attribute and role bitmaps.
+ * They are saved the way they are laid out in memory, so that loading maps
+ * them instead of rebuilding them:
+ *
+ *   struct cil_snapshot_header
+ *   data	arena regions holding the payloads, lists and arrays
+ *   nodes	node table blocks holding the tree
+ *   strings	the strings, as an image of the strpool
+ *   tables	locs, strings, symtabs, refs and relocs
+ *
+ * Each area starts on a multiple of CIL_SNAPSHOT_ALIGN. Pointers hold the
+ * addresses the image is meant to be mapped at: the data at
+ * CIL_SNAPSHOT_DATA_BASE, the strings at CIL_SNAPSHOT_STRINGS_BASE, the
+ * nodes in the blocks they were numbered in and keys in the static block of
+ * the strpool. These are normally free or the same in the loading process,
+ * and then a load costs a few mmap() calls plus the pages that are touched
+ * later on. Whatever did not land where it was meant to is fixed up from the
+ * tables, which list every pointer held in the data and every use of each
+ * string, and by a walk of the node blocks. That takes as long as reading
+ * the whole image, as when a second image is loaded into a process or
+ * strings were interned before the load. Keys keep their offsets in the
+ * static block, so when only the block moved, as it does when the library
+ * is loaded at another address, their uses are shifted rather than
+ * interned again.
+ *
+ * Payloads are described by the field tables below, which must be kept in
+ * step with cil_internal.h; fields that are not listed are left zeroed. A
+ * sum of the tables and of the sizes of the other structures saved is kept
+ * in the header, so that images from another build are turned away. Images
+ * are in host byte order.
+ *
+ * Loading checks the header, that the areas fit in the file and the
+ * checksum of the header and of the location table. The rest is not read,
+ * so images must come from a trusted cil_db_save() and must not be changed
+ * in place while they are loaded. cil_db_save() writes a new file and
+ * renames it over the old one.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sepol/errcodes.h>
+#include <sepol/policydb/hashtab.h>
+
+#include "cil_internal.h"
+#include "cil_flavor.h"
+#include "cil_arena.h"
+#include "cil_log.h"
+#include "cil_mem.h"
+#include "cil_list.h"
+#include "cil_tree.h"
+#include "cil_build_ast.h"
+#include "cil_parser.h"
+#include "cil_symtab.h"
+#include "cil_strpool.h"
+#include "cil_index.h"
+#include "cil_snapshot.h"
+
+#define CIL_SNAPSHOT_MAGIC		"CILSNAPS"
+#define CIL_SNAPSHOT_VERSION		5
+#define CIL_SNAPSHOT_SYMTAB_KEYED	1
+#define CIL_SNAPSHOT_BYTE_ORDER		0x01020304
+#define CIL_SNAPSHOT_CHECKSUM_INIT	2166136261U
+
+#define CIL_SNAPSHOT_MAP_SIZE		(1 << 16)
+#define CIL_SNAPSHOT_ALIGN		(1 << 16)
+#define CIL_SNAPSHOT_DATA_BASE		((uintptr_t)0x300000000000)
+#define CIL_SNAPSHOT_STRINGS_BASE	((uintptr_t)0x280000000000)
+
+struct cil_snapshot_header {
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint64_t layout;		/* see __cil_snapshot_layout() */
+	uint64_t file_size;
+	uint64_t keys_base;		/* the strpool's static block */
+	uint64_t keys_sum;
+	uint64_t data_base;
+	uint64_t data_offset;
+	uint64_t data_size;
+	uint64_t db;			/* offset of the struct cil_snapshot_db */
+	uint64_t nodes_base;		/* the node table */
+	uint64_t nodes_offset;
+	uint32_t nodes_first;		/* the block the nodes were numbered from */
+	uint32_t nodes_count;		/* in blocks */
+	uint64_t strings_base;
+	uint64_t strings_offset;
+	uint64_t strings_size;
+	uint64_t tables_offset;
+	uint64_t tables_size;
+	uint64_t num_refs;
+	uint64_t num_relocs;
+	uint32_t num_symtabs;
+	uint32_t num_strings;
+	uint32_t num_locs;
+	uint32_t checksum;		/* of the header and the locs */
+};
+
+/* A range of the source location table. path is a string number, from 1. */
+struct cil_snapshot_loc {
+	uint32_t path;
+	uint32_t first;
+	uint32_t count;
+	uint32_t base;
+};
+
+/* A string and the offsets in the data of the pointers to it, which are
+ * refs[first_ref] onwards */
+struct cil_snapshot_string {
+	uint64_t addr;			/* the address the pointers hold */
+	uint64_t copy;			/* offset of its copy in the strings area */
+	uint64_t first_ref;
+	uint32_t num_refs;
+	uint32_t is_static;
+};
+
+/* A reloc is the offset in the data of a pointer shifted left by one, with
+ * the low bit telling what it points into */
+enum cil_snapshot_reloc {
+	CIL_SNAPSHOT_RELOC_DATA = 0,
+	CIL_SNAPSHOT_RELOC_NODE,
+};
+
+enum cil_snapshot_kind {
+	CIL_SNAPSHOT_KIND_NONE = 0,
+	CIL_SNAPSHOT_KIND_NODE,
+	CIL_SNAPSHOT_KIND_LIST,
+	CIL_SNAPSHOT_KIND_CATS_LIST,	/* a sensitivity's list of struct cil_cats */
+	CIL_SNAPSHOT_KIND_CATS,
+	CIL_SNAPSHOT_KIND_DATA,		/* a payload of the object's flavor */
+};
+
+struct cil_snapshot_object {
+	uint16_t kind;
+	uint16_t flavor;
+};
+
+enum cil_snapshot_field_type {
+	CIL_SNAPSHOT_FIELD_U16,
+	CIL_SNAPSHOT_FIELD_U32,
+	CIL_SNAPSHOT_FIELD_BYTES,	/* arg bytes, copied as they are */
+	CIL_SNAPSHOT_FIELD_STR,
+	CIL_SNAPSHOT_FIELD_DATA,	/* a payload of flavor arg; see __cil_snapshot_put_data() */
+	CIL_SNAPSHOT_FIELD_ARG_DATA,	/* a payload whose flavor is the enum at offset arg */
+	CIL_SNAPSHOT_FIELD_LIST,
+	CIL_SNAPSHOT_FIELD_CATS_LIST,
+	CIL_SNAPSHOT_FIELD_CATS,
+	CIL_SNAPSHOT_FIELD_NODE,
+	CIL_SNAPSHOT_FIELD_SYMTAB,
+	CIL_SNAPSHOT_FIELD_SYMTABS,	/* an array of CIL_SYM_NUM symtabs */
+	CIL_SNAPSHOT_FIELD_DATUM,
+	CIL_SNAPSHOT_FIELD_NAME_DATUM,	/* a datum whose nodes are not kept */
+	CIL_SNAPSHOT_FIELD_EBITMAP,	/* an ebitmap_t * owned by the payload */
+	CIL_SNAPSHOT_FIELD_DATUMS,	/* a struct cil_vector of datums */
+	CIL_SNAPSHOT_FIELD_TOKENS,	/* a copied list of struct cil_parse_token */
+};
+
+struct cil_snapshot_field {
+	uint16_t type;
+	uint16_t arg;
+	uint32_t offset;
+};
+
+struct cil_snapshot_desc {
+	uint32_t size;
+	uint32_t num_fields;
+	const struct cil_snapshot_field *fields;
+};
+
+#define CIL_SNAPSHOT_FIELD(type, s, f) \
+	{ CIL_SNAPSHOT_FIELD_##type, 0, offsetof(struct s, f) }
+#define CIL_SNAPSHOT_FIELD_ARG(type, s, f, arg) \
+	{ CIL_SNAPSHOT_FIELD_##type, arg, offsetof(struct s, f) }
+#define CIL_SNAPSHOT_DESC(name, s) \
+	static const struct cil_snapshot_desc name = { sizeof(struct s), sizeof(name##_fields) / sizeof(name##_fields[0]), name##_fields }
+
+static const struct cil_snapshot_field cil_snapshot_cats_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_cats, evaluated),
+	CIL_SNAPSHOT_FIELD(LIST, cil_cats, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_cats, datum_expr),
+	CIL_SNAPSHOT_FIELD(DATUMS, cil_cats, datums),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_cats, cil_cats);
+
+static const struct cil_snapshot_field cil_snapshot_root_fields[] = {
+	CIL_SNAPSHOT_FIELD(SYMTABS, cil_root, symtab),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_root, cil_root);
+
+static const struct cil_snapshot_field cil_snapshot_param_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_param, str),
+	CIL_SNAPSHOT_FIELD(U32, cil_param, flavor),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_param, cil_param);
+
+static const struct cil_snapshot_field cil_snapshot_args_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_args, arg_str),
+	CIL_SNAPSHOT_FIELD_ARG(ARG_DATA, cil_args, arg, offsetof(struct cil_args, flavor)),
+	CIL_SNAPSHOT_FIELD(STR, cil_args, param_str),
+	CIL_SNAPSHOT_FIELD(U32, cil_args, flavor),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_args, cil_args);
+
+static const struct cil_snapshot_field cil_snapshot_block_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_block, datum),
+	CIL_SNAPSHOT_FIELD(SYMTABS, cil_block, symtab),
+	CIL_SNAPSHOT_FIELD(U16, cil_block, is_abstract),
+	CIL_SNAPSHOT_FIELD(LIST, cil_block, bi_nodes),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_block, cil_block);
+
+static const struct cil_snapshot_field cil_snapshot_blockinherit_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_blockinherit, block_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_blockinherit, block, CIL_BLOCK),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_blockinherit, cil_blockinherit);
+
+static const struct cil_snapshot_field cil_snapshot_blockabstract_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_blockabstract, block_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_blockabstract, cil_blockabstract);
+
+static const struct cil_snapshot_field cil_snapshot_in_fields[] = {
+	CIL_SNAPSHOT_FIELD(SYMTABS, cil_in, symtab),
+	CIL_SNAPSHOT_FIELD(STR, cil_in, block_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_in, cil_in);
+
+static const struct cil_snapshot_field cil_snapshot_macro_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_macro, datum),
+	CIL_SNAPSHOT_FIELD(SYMTABS, cil_macro, symtab),
+	CIL_SNAPSHOT_FIELD(LIST, cil_macro, params),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_macro, cil_macro);
+
+static const struct cil_snapshot_field cil_snapshot_call_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_call, macro_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_call, macro, CIL_MACRO),
+	CIL_SNAPSHOT_FIELD(TOKENS, cil_call, args_tokens),
+	CIL_SNAPSHOT_FIELD(LIST, cil_call, args),
+	CIL_SNAPSHOT_FIELD(U32, cil_call, copied),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_call, cil_call);
+
+static const struct cil_snapshot_field cil_snapshot_optional_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_optional, datum),
+	CIL_SNAPSHOT_FIELD(U32, cil_optional, enabled),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_optional, cil_optional);
+
+static const struct cil_snapshot_field cil_snapshot_bool_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_bool, datum),
+	CIL_SNAPSHOT_FIELD(U16, cil_bool, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_bool, cil_bool);
+
+static const struct cil_snapshot_field cil_snapshot_tunable_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_tunable, datum),
+	CIL_SNAPSHOT_FIELD(U16, cil_tunable, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_tunable, cil_tunable);
+
+static const struct cil_snapshot_field cil_snapshot_booleanif_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_booleanif, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_booleanif, datum_expr),
+	CIL_SNAPSHOT_FIELD(U32, cil_booleanif, preserved_tunable),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_booleanif, cil_booleanif);
+
+static const struct cil_snapshot_field cil_snapshot_tunableif_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_tunableif, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_tunableif, datum_expr),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_tunableif, cil_tunableif);
+
+static const struct cil_snapshot_field cil_snapshot_condblock_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_condblock, flavor),
+	CIL_SNAPSHOT_FIELD(SYMTABS, cil_condblock, symtab),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_condblock, cil_condblock);
+
+static const struct cil_snapshot_field cil_snapshot_perm_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_perm, datum),
+	CIL_SNAPSHOT_FIELD(U32, cil_perm, value),
+	CIL_SNAPSHOT_FIELD(LIST, cil_perm, classperms),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_perm, cil_perm);
+
+static const struct cil_snapshot_field cil_snapshot_class_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_class, datum),
+	CIL_SNAPSHOT_FIELD(SYMTAB, cil_class, perms),
+	CIL_SNAPSHOT_FIELD(U32, cil_class, num_perms),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_class, common, CIL_COMMON),
+	CIL_SNAPSHOT_FIELD(U32, cil_class, ordered),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_class, cil_class);
+
+static const struct cil_snapshot_field cil_snapshot_classorder_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_classorder, class_list_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classorder, cil_classorder);
+
+static const struct cil_snapshot_field cil_snapshot_classperms_set_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_classperms_set, set_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_classperms_set, set, CIL_CLASSPERMISSION),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classperms_set, cil_classperms_set);
+
+static const struct cil_snapshot_field cil_snapshot_classperms_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_classperms, class_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_classperms, class, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(LIST, cil_classperms, perm_strs),
+	CIL_SNAPSHOT_FIELD(LIST, cil_classperms, perms),
+	CIL_SNAPSHOT_FIELD(U32, cil_classperms, evaluated),
+	CIL_SNAPSHOT_FIELD(DATUMS, cil_classperms, datums),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classperms, cil_classperms);
+
+static const struct cil_snapshot_field cil_snapshot_classpermission_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_classpermission, datum),
+	CIL_SNAPSHOT_FIELD(LIST, cil_classpermission, classperms),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classpermission, cil_classpermission);
+
+static const struct cil_snapshot_field cil_snapshot_classpermissionset_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_classpermissionset, set_str),
+	CIL_SNAPSHOT_FIELD(LIST, cil_classpermissionset, classperms),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classpermissionset, cil_classpermissionset);
+
+static const struct cil_snapshot_field cil_snapshot_classmapping_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_classmapping, map_class_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_classmapping, map_perm_str),
+	CIL_SNAPSHOT_FIELD(LIST, cil_classmapping, classperms),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classmapping, cil_classmapping);
+
+static const struct cil_snapshot_field cil_snapshot_classcommon_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_classcommon, class_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_classcommon, common_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_classcommon, cil_classcommon);
+
+static const struct cil_snapshot_field cil_snapshot_alias_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_alias, datum),
+	CIL_SNAPSHOT_FIELD(DATA, cil_alias, actual),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_alias, cil_alias);
+
+static const struct cil_snapshot_field cil_snapshot_aliasactual_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_aliasactual, alias_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_aliasactual, actual_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_aliasactual, cil_aliasactual);
+
+static const struct cil_snapshot_field cil_snapshot_sid_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_sid, datum),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_sid, context, CIL_CONTEXT),
+	CIL_SNAPSHOT_FIELD(U32, cil_sid, ordered),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_sid, cil_sid);
+
+static const struct cil_snapshot_field cil_snapshot_sidcontext_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_sidcontext, sid_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_sidcontext, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_sidcontext, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_sidcontext, cil_sidcontext);
+
+static const struct cil_snapshot_field cil_snapshot_sidorder_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_sidorder, sid_list_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_sidorder, cil_sidorder);
+
+static const struct cil_snapshot_field cil_snapshot_user_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_user, datum),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_user, bounds, CIL_USER),
+	CIL_SNAPSHOT_FIELD(LIST, cil_user, roles),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_user, dftlevel, CIL_LEVEL),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_user, range, CIL_LEVELRANGE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_user, cil_user);
+
+static const struct cil_snapshot_field cil_snapshot_userrole_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_userrole, user_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_userrole, user, CIL_USER),
+	CIL_SNAPSHOT_FIELD(STR, cil_userrole, role_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_userrole, role),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_userrole, cil_userrole);
+
+static const struct cil_snapshot_field cil_snapshot_userlevel_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_userlevel, user_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_userlevel, level_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_userlevel, level, CIL_LEVEL),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_userlevel, cil_userlevel);
+
+static const struct cil_snapshot_field cil_snapshot_userrange_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_userrange, user_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_userrange, range_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_userrange, range, CIL_LEVELRANGE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_userrange, cil_userrange);
+
+static const struct cil_snapshot_field cil_snapshot_userprefix_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_userprefix, user_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_userprefix, user, CIL_USER),
+	CIL_SNAPSHOT_FIELD(STR, cil_userprefix, prefix_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_userprefix, cil_userprefix);
+
+static const struct cil_snapshot_field cil_snapshot_selinuxuser_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_selinuxuser, name_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_selinuxuser, user_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_selinuxuser, user, CIL_USER),
+	CIL_SNAPSHOT_FIELD(STR, cil_selinuxuser, range_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_selinuxuser, range, CIL_LEVELRANGE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_selinuxuser, cil_selinuxuser);
+
+static const struct cil_snapshot_field cil_snapshot_role_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_role, datum),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_role, bounds, CIL_ROLE),
+	CIL_SNAPSHOT_FIELD(EBITMAP, cil_role, types),
+	CIL_SNAPSHOT_FIELD(U32, cil_role, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_role, cil_role);
+
+static const struct cil_snapshot_field cil_snapshot_roleattribute_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_roleattribute, datum),
+	CIL_SNAPSHOT_FIELD(LIST, cil_roleattribute, expr_list),
+	CIL_SNAPSHOT_FIELD(EBITMAP, cil_roleattribute, roles),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_roleattribute, cil_roleattribute);
+
+static const struct cil_snapshot_field cil_snapshot_roleattributeset_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_roleattributeset, attr_str),
+	CIL_SNAPSHOT_FIELD(LIST, cil_roleattributeset, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_roleattributeset, datum_expr),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_roleattributeset, cil_roleattributeset);
+
+static const struct cil_snapshot_field cil_snapshot_roletype_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_roletype, role_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_roletype, role),
+	CIL_SNAPSHOT_FIELD(STR, cil_roletype, type_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_roletype, type),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_roletype, cil_roletype);
+
+static const struct cil_snapshot_field cil_snapshot_type_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_type, datum),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_type, bounds, CIL_TYPE),
+	CIL_SNAPSHOT_FIELD(U32, cil_type, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_type, cil_type);
+
+static const struct cil_snapshot_field cil_snapshot_typeattribute_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_typeattribute, datum),
+	CIL_SNAPSHOT_FIELD(LIST, cil_typeattribute, expr_list),
+	CIL_SNAPSHOT_FIELD(EBITMAP, cil_typeattribute, types),
+	CIL_SNAPSHOT_FIELD(U32, cil_typeattribute, used),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_typeattribute, cil_typeattribute);
+
+static const struct cil_snapshot_field cil_snapshot_typeattributeset_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_typeattributeset, attr_str),
+	CIL_SNAPSHOT_FIELD(LIST, cil_typeattributeset, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_typeattributeset, datum_expr),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_typeattributeset, cil_typeattributeset);
+
+static const struct cil_snapshot_field cil_snapshot_typepermissive_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_typepermissive, type_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_typepermissive, type),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_typepermissive, cil_typepermissive);
+
+static const struct cil_snapshot_field cil_snapshot_name_fields[] = {
+	CIL_SNAPSHOT_FIELD(NAME_DATUM, cil_name, datum),
+	CIL_SNAPSHOT_FIELD(STR, cil_name, name_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_name, cil_name);
+
+static const struct cil_snapshot_field cil_snapshot_nametypetransition_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_nametypetransition, src_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_nametypetransition, src),
+	CIL_SNAPSHOT_FIELD(STR, cil_nametypetransition, tgt_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_nametypetransition, tgt),
+	CIL_SNAPSHOT_FIELD(STR, cil_nametypetransition, obj_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_nametypetransition, obj, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(STR, cil_nametypetransition, name_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_nametypetransition, name, CIL_NAME),
+	CIL_SNAPSHOT_FIELD(STR, cil_nametypetransition, result_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_nametypetransition, result),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_nametypetransition, cil_nametypetransition);
+
+static const struct cil_snapshot_field cil_snapshot_rangetransition_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_rangetransition, src_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_rangetransition, src),
+	CIL_SNAPSHOT_FIELD(STR, cil_rangetransition, exec_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_rangetransition, exec),
+	CIL_SNAPSHOT_FIELD(STR, cil_rangetransition, obj_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_rangetransition, obj, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(STR, cil_rangetransition, range_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_rangetransition, range, CIL_LEVELRANGE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_rangetransition, cil_rangetransition);
+
+static const struct cil_snapshot_field cil_snapshot_avrule_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_avrule, rule_kind),
+	CIL_SNAPSHOT_FIELD(STR, cil_avrule, src_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_avrule, src),
+	CIL_SNAPSHOT_FIELD(STR, cil_avrule, tgt_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_avrule, tgt),
+	CIL_SNAPSHOT_FIELD(LIST, cil_avrule, classperms),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_avrule, cil_avrule);
+
+static const struct cil_snapshot_field cil_snapshot_type_rule_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_type_rule, rule_kind),
+	CIL_SNAPSHOT_FIELD(STR, cil_type_rule, src_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_type_rule, src),
+	CIL_SNAPSHOT_FIELD(STR, cil_type_rule, tgt_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_type_rule, tgt),
+	CIL_SNAPSHOT_FIELD(STR, cil_type_rule, obj_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_type_rule, obj, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(STR, cil_type_rule, result_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_type_rule, result),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_type_rule, cil_type_rule);
+
+static const struct cil_snapshot_field cil_snapshot_roletransition_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_roletransition, src_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_roletransition, src, CIL_ROLE),
+	CIL_SNAPSHOT_FIELD(STR, cil_roletransition, tgt_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_roletransition, tgt),
+	CIL_SNAPSHOT_FIELD(STR, cil_roletransition, obj_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_roletransition, obj, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(STR, cil_roletransition, result_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_roletransition, result, CIL_ROLE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_roletransition, cil_roletransition);
+
+static const struct cil_snapshot_field cil_snapshot_roleallow_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_roleallow, src_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_roleallow, src),
+	CIL_SNAPSHOT_FIELD(STR, cil_roleallow, tgt_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_roleallow, tgt),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_roleallow, cil_roleallow);
+
+static const struct cil_snapshot_field cil_snapshot_sens_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_sens, datum),
+	CIL_SNAPSHOT_FIELD(CATS_LIST, cil_sens, cats_list),
+	CIL_SNAPSHOT_FIELD(U32, cil_sens, ordered),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_sens, cil_sens);
+
+static const struct cil_snapshot_field cil_snapshot_sensorder_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_sensorder, sens_list_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_sensorder, cil_sensorder);
+
+static const struct cil_snapshot_field cil_snapshot_cat_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_cat, datum),
+	CIL_SNAPSHOT_FIELD(U32, cil_cat, ordered),
+	CIL_SNAPSHOT_FIELD(U32, cil_cat, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_cat, cil_cat);
+
+static const struct cil_snapshot_field cil_snapshot_catset_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_catset, datum),
+	CIL_SNAPSHOT_FIELD(CATS, cil_catset, cats),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_catset, cil_catset);
+
+static const struct cil_snapshot_field cil_snapshot_catorder_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_catorder, cat_list_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_catorder, cil_catorder);
+
+static const struct cil_snapshot_field cil_snapshot_senscat_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_senscat, sens_str),
+	CIL_SNAPSHOT_FIELD(CATS, cil_senscat, cats),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_senscat, cil_senscat);
+
+static const struct cil_snapshot_field cil_snapshot_level_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_level, datum),
+	CIL_SNAPSHOT_FIELD(STR, cil_level, sens_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_level, sens, CIL_SENS),
+	CIL_SNAPSHOT_FIELD(CATS, cil_level, cats),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_level, cil_level);
+
+static const struct cil_snapshot_field cil_snapshot_levelrange_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_levelrange, datum),
+	CIL_SNAPSHOT_FIELD(STR, cil_levelrange, low_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_levelrange, low, CIL_LEVEL),
+	CIL_SNAPSHOT_FIELD(STR, cil_levelrange, high_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_levelrange, high, CIL_LEVEL),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_levelrange, cil_levelrange);
+
+static const struct cil_snapshot_field cil_snapshot_context_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_context, datum),
+	CIL_SNAPSHOT_FIELD(STR, cil_context, user_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_context, user, CIL_USER),
+	CIL_SNAPSHOT_FIELD(STR, cil_context, role_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_context, role, CIL_ROLE),
+	CIL_SNAPSHOT_FIELD(STR, cil_context, type_str),
+	CIL_SNAPSHOT_FIELD(DATA, cil_context, type),
+	CIL_SNAPSHOT_FIELD(STR, cil_context, range_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_context, range, CIL_LEVELRANGE),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_context, cil_context);
+
+static const struct cil_snapshot_field cil_snapshot_filecon_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_filecon, path_str),
+	CIL_SNAPSHOT_FIELD(U32, cil_filecon, type),
+	CIL_SNAPSHOT_FIELD(STR, cil_filecon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_filecon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_filecon, cil_filecon);
+
+static const struct cil_snapshot_field cil_snapshot_portcon_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_portcon, proto),
+	CIL_SNAPSHOT_FIELD(U32, cil_portcon, port_low),
+	CIL_SNAPSHOT_FIELD(U32, cil_portcon, port_high),
+	CIL_SNAPSHOT_FIELD(STR, cil_portcon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_portcon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_portcon, cil_portcon);
+
+static const struct cil_snapshot_field cil_snapshot_nodecon_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_nodecon, addr_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_nodecon, addr, CIL_IPADDR),
+	CIL_SNAPSHOT_FIELD(STR, cil_nodecon, mask_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_nodecon, mask, CIL_IPADDR),
+	CIL_SNAPSHOT_FIELD(STR, cil_nodecon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_nodecon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_nodecon, cil_nodecon);
+
+static const struct cil_snapshot_field cil_snapshot_ipaddr_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_ipaddr, datum),
+	CIL_SNAPSHOT_FIELD(U32, cil_ipaddr, family),
+	CIL_SNAPSHOT_FIELD_ARG(BYTES, cil_ipaddr, ip, sizeof(((struct cil_ipaddr *)NULL)->ip)),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_ipaddr, cil_ipaddr);
+
+static const struct cil_snapshot_field cil_snapshot_genfscon_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_genfscon, fs_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_genfscon, path_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_genfscon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_genfscon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_genfscon, cil_genfscon);
+
+static const struct cil_snapshot_field cil_snapshot_netifcon_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_netifcon, interface_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_netifcon, if_context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_netifcon, if_context, CIL_CONTEXT),
+	CIL_SNAPSHOT_FIELD(STR, cil_netifcon, packet_context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_netifcon, packet_context, CIL_CONTEXT),
+	CIL_SNAPSHOT_FIELD(STR, cil_netifcon, context_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_netifcon, cil_netifcon);
+
+static const struct cil_snapshot_field cil_snapshot_pirqcon_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_pirqcon, pirq),
+	CIL_SNAPSHOT_FIELD(STR, cil_pirqcon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_pirqcon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_pirqcon, cil_pirqcon);
+
+static const struct cil_snapshot_field cil_snapshot_iomemcon_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_iomemcon, iomem_low),
+	CIL_SNAPSHOT_FIELD(U32, cil_iomemcon, iomem_high),
+	CIL_SNAPSHOT_FIELD(STR, cil_iomemcon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_iomemcon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_iomemcon, cil_iomemcon);
+
+static const struct cil_snapshot_field cil_snapshot_ioportcon_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_ioportcon, ioport_low),
+	CIL_SNAPSHOT_FIELD(U32, cil_ioportcon, ioport_high),
+	CIL_SNAPSHOT_FIELD(STR, cil_ioportcon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_ioportcon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_ioportcon, cil_ioportcon);
+
+static const struct cil_snapshot_field cil_snapshot_pcidevicecon_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_pcidevicecon, dev),
+	CIL_SNAPSHOT_FIELD(STR, cil_pcidevicecon, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_pcidevicecon, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_pcidevicecon, cil_pcidevicecon);
+
+static const struct cil_snapshot_field cil_snapshot_fsuse_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_fsuse, type),
+	CIL_SNAPSHOT_FIELD(STR, cil_fsuse, fs_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_fsuse, context_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_fsuse, context, CIL_CONTEXT),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_fsuse, cil_fsuse);
+
+static const struct cil_snapshot_field cil_snapshot_constrain_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_constrain, classperms),
+	CIL_SNAPSHOT_FIELD(LIST, cil_constrain, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_constrain, datum_expr),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_constrain, cil_constrain);
+
+static const struct cil_snapshot_field cil_snapshot_validatetrans_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_validatetrans, class_str),
+	CIL_SNAPSHOT_FIELD_ARG(DATA, cil_validatetrans, class, CIL_CLASS),
+	CIL_SNAPSHOT_FIELD(LIST, cil_validatetrans, str_expr),
+	CIL_SNAPSHOT_FIELD(LIST, cil_validatetrans, datum_expr),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_validatetrans, cil_validatetrans);
+
+static const struct cil_snapshot_field cil_snapshot_policycap_fields[] = {
+	CIL_SNAPSHOT_FIELD(DATUM, cil_policycap, datum),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_policycap, cil_policycap);
+
+static const struct cil_snapshot_field cil_snapshot_bounds_fields[] = {
+	CIL_SNAPSHOT_FIELD(STR, cil_bounds, parent_str),
+	CIL_SNAPSHOT_FIELD(STR, cil_bounds, child_str),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_bounds, cil_bounds);
+
+static const struct cil_snapshot_field cil_snapshot_default_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_default, flavor),
+	CIL_SNAPSHOT_FIELD(LIST, cil_default, class_strs),
+	CIL_SNAPSHOT_FIELD(LIST, cil_default, class_datums),
+	CIL_SNAPSHOT_FIELD(U32, cil_default, object),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_default, cil_default);
+
+static const struct cil_snapshot_field cil_snapshot_defaultrange_fields[] = {
+	CIL_SNAPSHOT_FIELD(LIST, cil_defaultrange, class_strs),
+	CIL_SNAPSHOT_FIELD(LIST, cil_defaultrange, class_datums),
+	CIL_SNAPSHOT_FIELD(U32, cil_defaultrange, object_range),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_defaultrange, cil_defaultrange);
+
+static const struct cil_snapshot_field cil_snapshot_handleunknown_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_handleunknown, handle_unknown),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_handleunknown, cil_handleunknown);
+
+static const struct cil_snapshot_field cil_snapshot_mls_fields[] = {
+	CIL_SNAPSHOT_FIELD(U32, cil_mls, value),
+};
+CIL_SNAPSHOT_DESC(cil_snapshot_mls, cil_mls);
+
+/* The layout of the payload of a node of flavor, or NULL if there is none */
+static const struct cil_snapshot_desc *__cil_snapshot_desc(enum cil_flavor flavor)
+{
+	switch (flavor) {
+	case CIL_ROOT:
+		return &cil_snapshot_root;
+	case CIL_PARAM:
+		return &cil_snapshot_param;
+	case CIL_ARGS:
+		return &cil_snapshot_args;
+	case CIL_BLOCK:
+		return &cil_snapshot_block;
+	case CIL_BLOCKINHERIT:
+		return &cil_snapshot_blockinherit;
+	case CIL_BLOCKABSTRACT:
+		return &cil_snapshot_blockabstract;
+	case CIL_IN:
+		return &cil_snapshot_in;
+	case CIL_MACRO:
+		return &cil_snapshot_macro;
+	case CIL_CALL:
+		return &cil_snapshot_call;
+	case CIL_OPTIONAL:
+		return &cil_snapshot_optional;
+	case CIL_BOOL:
+		return &cil_snapshot_bool;
+	case CIL_TUNABLE:
+		return &cil_snapshot_tunable;
+	case CIL_BOOLEANIF:
+		return &cil_snapshot_booleanif;
+	case CIL_TUNABLEIF:
+		return &cil_snapshot_tunableif;
+	case CIL_CONDBLOCK:
+		return &cil_snapshot_condblock;
+	case CIL_PERM:
+	case CIL_MAP_PERM:
+		return &cil_snapshot_perm;
+	case CIL_COMMON:
+	case CIL_CLASS:
+	case CIL_MAP_CLASS:
+		return &cil_snapshot_class;
+	case CIL_CLASSORDER:
+		return &cil_snapshot_classorder;
+	case CIL_CLASSPERMS_SET:
+		return &cil_snapshot_classperms_set;
+	case CIL_CLASSPERMS:
+		return &cil_snapshot_classperms;
+	case CIL_CLASSPERMISSION:
+		return &cil_snapshot_classpermission;
+	case CIL_CLASSPERMISSIONSET:
+		return &cil_snapshot_classpermissionset;
+	case CIL_CLASSMAPPING:
+		return &cil_snapshot_classmapping;
+	case CIL_CLASSCOMMON:
+		return &cil_snapshot_classcommon;
+	case CIL_TYPEALIAS:
+	case CIL_SENSALIAS:
+	case CIL_CATALIAS:
+		return &cil_snapshot_alias;
+	case CIL_TYPEALIASACTUAL:
+	case CIL_SENSALIASACTUAL:
+	case CIL_CATALIASACTUAL:
+		return &cil_snapshot_aliasactual;
+	case CIL_SID:
+		return &cil_snapshot_sid;
+	case CIL_SIDCONTEXT:
+		return &cil_snapshot_sidcontext;
+	case CIL_SIDORDER:
+		return &cil_snapshot_sidorder;
+	case CIL_USER:
+		return &cil_snapshot_user;
+	case CIL_USERROLE:
+		return &cil_snapshot_userrole;
+	case CIL_USERLEVEL:
+		return &cil_snapshot_userlevel;
+	case CIL_USERRANGE:
+		return &cil_snapshot_userrange;
+	case CIL_USERPREFIX:
+		return &cil_snapshot_userprefix;
+	case CIL_SELINUXUSER:
+	case CIL_SELINUXUSERDEFAULT:
+		return &cil_snapshot_selinuxuser;
+	case CIL_ROLE:
+		return &cil_snapshot_role;
+	case CIL_ROLEATTRIBUTE:
+		return &cil_snapshot_roleattribute;
+	case CIL_ROLEATTRIBUTESET:
+		return &cil_snapshot_roleattributeset;
+	case CIL_ROLETYPE:
+		return &cil_snapshot_roletype;
+	case CIL_TYPE:
+		return &cil_snapshot_type;
+	case CIL_TYPEATTRIBUTE:
+		return &cil_snapshot_typeattribute;
+	case CIL_TYPEATTRIBUTESET:
+		return &cil_snapshot_typeattributeset;
+	case CIL_TYPEPERMISSIVE:
+		return &cil_snapshot_typepermissive;
+	case CIL_NAME:
+		return &cil_snapshot_name;
+	case CIL_NAMETYPETRANSITION:
+		return &cil_snapshot_nametypetransition;
+	case CIL_RANGETRANSITION:
+		return &cil_snapshot_rangetransition;
+	case CIL_AVRULE:
+		return &cil_snapshot_avrule;
+	case CIL_TYPE_RULE:
+		return &cil_snapshot_type_rule;
+	case CIL_ROLETRANSITION:
+		return &cil_snapshot_roletransition;
+	case CIL_ROLEALLOW:
+		return &cil_snapshot_roleallow;
+	case CIL_SENS:
+		return &cil_snapshot_sens;
+	case CIL_SENSITIVITYORDER:
+		return &cil_snapshot_sensorder;
+	case CIL_CAT:
+		return &cil_snapshot_cat;
+	case CIL_CATSET:
+		return &cil_snapshot_catset;
+	case CIL_CATORDER:
+		return &cil_snapshot_catorder;
+	case CIL_SENSCAT:
+		return &cil_snapshot_senscat;
+	case CIL_LEVEL:
+		return &cil_snapshot_level;
+	case CIL_LEVELRANGE:
+		return &cil_snapshot_levelrange;
+	case CIL_CONTEXT:
+		return &cil_snapshot_context;
+	case CIL_FILECON:
+		return &cil_snapshot_filecon;
+	case CIL_PORTCON:
+		return &cil_snapshot_portcon;
+	case CIL_NODECON:
+		return &cil_snapshot_nodecon;
+	case CIL_IPADDR:
+		return &cil_snapshot_ipaddr;
+	case CIL_GENFSCON:
+		return &cil_snapshot_genfscon;
+	case CIL_NETIFCON:
+		return &cil_snapshot_netifcon;
+	case CIL_PIRQCON:
+		return &cil_snapshot_pirqcon;
+	case CIL_IOMEMCON:
+		return &cil_snapshot_iomemcon;
+	case CIL_IOPORTCON:
+		return &cil_snapshot_ioportcon;
+	case CIL_PCIDEVICECON:
+		return &cil_snapshot_pcidevicecon;
+	case CIL_FSUSE:
+		return &cil_snapshot_fsuse;
+	case CIL_CONSTRAIN:
+	case CIL_MLSCONSTRAIN:
+		return &cil_snapshot_constrain;
+	case CIL_VALIDATETRANS:
+	case CIL_MLSVALIDATETRANS:
+		return &cil_snapshot_validatetrans;
+	case CIL_POLICYCAP:
+		return &cil_snapshot_policycap;
+	case CIL_USERBOUNDS:
+	case CIL_ROLEBOUNDS:
+	case CIL_TYPEBOUNDS:
+		return &cil_snapshot_bounds;
+	case CIL_DEFAULTUSER:
+	case CIL_DEFAULTROLE:
+	case CIL_DEFAULTTYPE:
+		return &cil_snapshot_default;
+	case CIL_DEFAULTRANGE:
+		return &cil_snapshot_defaultrange;
+	case CIL_HANDLEUNKNOWN:
+		return &cil_snapshot_handleunknown;
+	case CIL_MLS:
+		return &cil_snapshot_mls;
+	default:
+		return NULL;
+	}
+}
+
+static const struct cil_snapshot_desc *__cil_snapshot_object_desc(enum cil_snapshot_kind kind, enum cil_flavor flavor)
+{
+	switch (kind) {
+	case CIL_SNAPSHOT_KIND_CATS:
+		return &cil_snapshot_cats;
+	case CIL_SNAPSHOT_KIND_DATA:
+		return __cil_snapshot_desc(flavor);
+	default:
+		return NULL;
+	}
+}
+
+/* The sorted context statements, in the order they are written */
+static const struct {
+	size_t offset;
+	enum cil_flavor flavor;
+} cil_snapshot_sorts[] = {
+	{ offsetof(struct cil_db, netifcon), CIL_NETIFCON },
+	{ offsetof(struct cil_db, genfscon), CIL_GENFSCON },
+	{ offsetof(struct cil_db, filecon), CIL_FILECON },
+	{ offsetof(struct cil_db, nodecon), CIL_NODECON },
+	{ offsetof(struct cil_db, portcon), CIL_PORTCON },
+	{ offsetof(struct cil_db, pirqcon), CIL_PIRQCON },
+	{ offsetof(struct cil_db, iomemcon), CIL_IOMEMCON },
+	{ offsetof(struct cil_db, ioportcon), CIL_IOPORTCON },
+	{ offsetof(struct cil_db, pcidevicecon), CIL_PCIDEVICECON },
+	{ offsetof(struct cil_db, fsuse), CIL_FSUSE },
+};
+
+#define CIL_SNAPSHOT_NUM_SORTS (sizeof(cil_snapshot_sorts) / sizeof(cil_snapshot_sorts[0]))
+
+#define CIL_SNAPSHOT_SORT(db, i) (*(struct cil_sort **)((char *)(db) + cil_snapshot_sorts[i].offset))
+
+
+/* The state of the db that is not reached from its AST. The header holds
+ * its offset in the data. */
+struct cil_snapshot_db {
+	struct cil_tree_node *root;
+	struct cil_type *selftype;
+	struct cil_list *sidorder;
+	struct cil_list *classorder;
+	struct cil_list *catorder;
+	struct cil_list *sensitivityorder;
+	struct cil_sort *sorts[CIL_SNAPSHOT_NUM_SORTS];
+	struct cil_list *userprefixes;
+	struct cil_list *selinuxusers;
+	struct cil_list *names;
+	struct cil_type **val_to_type;
+	struct cil_role **val_to_role;
+	struct cil_index_list index[CIL_INDEX_NUM];
+	uint32_t indexed;
+	uint32_t index_count;
+	int32_t num_cats;
+	int32_t num_types;
+	int32_t num_roles;
+	int32_t disable_dontaudit;
+	int32_t disable_neverallow;
+	int32_t preserve_tunables;
+	int32_t handle_unknown;
+	int32_t mls;
+};
+
+/* Where a symbol table lives: the payload that holds it and its offset */
+struct cil_snapshot_owner {
+	uint32_t id;
+	uint32_t offset;
+};
+
+/* A pointer in the data to string id */
+struct cil_snapshot_use {
+	uint64_t offset;
+	uint32_t id;
+};
+
+/* The writer walks the database twice with the same functions. The first
+ * pass numbers every string and object it reaches, queueing new objects so
+ * that each one is visited once. Objects are then given their place in the
+ * image, and the second pass writes them there, along with the arrays they
+ * own, recording every pointer that a load may have to fix up. */
+struct cil_snapshot_writer {
+	int rc;
+	int emit;
+	hashtab_t ids;
+	hashtab_t symtabs;
+	hashtab_t string_ids;
+	struct cil_snapshot_object *objects;
+	void **entries;
+	uint64_t *offsets;		/* in the data, or the index of a node */
+	uint32_t num_objects;
+	uint32_t alloc_objects;
+	struct cil_snapshot_owner *owners;
+	uint32_t num_owners;
+	uint32_t alloc_owners;
+	char **strings;
+	uint64_t *copies;		/* of each string in the strings area */
+	uint64_t *addrs;		/* that pointers to each string hold */
+	uint32_t num_strings;
+	uint32_t alloc_strings;
+	struct cil_snapshot_loc *locs;
+	uint32_t num_locs;
+	uint32_t alloc_locs;
+	struct cil_arena_image data;
+	uint64_t db;
+	char *nodes;
+	uint32_t nodes_first;
+	uint32_t nodes_count;
+	char *strings_image;
+	uint64_t strings_size;
+	struct cil_snapshot_use *uses;
+	uint32_t num_uses;
+	uint32_t alloc_uses;
+	uint64_t *relocs;
+	uint32_t num_relocs;
+	uint32_t alloc_relocs;
+	uint64_t *symtab_offsets;
+	uint32_t num_symtabs;
+	uint32_t alloc_symtabs;
+};
+
+#define CIL_SNAPSHOT_AT(w, offset)	((void *)((w)->data.data + (offset)))
+#define CIL_SNAPSHOT_ADDR(offset)	(CIL_SNAPSHOT_DATA_BASE + (offset))
+
+/* Nodes of an image are numbered from slot 1 of each block, as slot 0
+ * holds the header of the block */
+#define CIL_SNAPSHOT_BLOCK_NODES	((UINT32_C(1) << CIL_ARENA_BLOCK_SHIFT) - 1)
+#define CIL_SNAPSHOT_SLOT_MASK		((UINT32_C(1) << CIL_ARENA_BLOCK_SHIFT) - 1)
+
+static unsigned int __cil_snapshot_ptr_hash(hashtab_t h, hashtab_key_t key)
+{
+	uintptr_t val = (uintptr_t)key;
+
+	return (unsigned int)((val >> 3) ^ (val >> 15)) & (h->size - 1);
+}
+
+static int __cil_snapshot_ptr_compare(hashtab_t h __attribute__ ((unused)), hashtab_key_t key1, hashtab_key_t key2)
+{
+	if (key1 == key2) {
+		return 0;
+	}
+
+	return ((uintptr_t)key1 < (uintptr_t)key2) ? -1 : 1;
+}
+
+static hashtab_t __cil_snapshot_map_create(void)
+{
+	hashtab_t map = hashtab_create(__cil_snapshot_ptr_hash, __cil_snapshot_ptr_compare, CIL_SNAPSHOT_MAP_SIZE);
+
+	if (map == NULL) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+
+	return map;
+}
+
+static void __cil_snapshot_map_insert(hashtab_t map, void *key, uint32_t value)
+{
+	if (hashtab_insert(map, (hashtab_key_t)key, (hashtab_datum_t)(uintptr_t)value) != SEPOL_OK) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+}
+
+static uint32_t __cil_snapshot_map_search(hashtab_t map, void *key)
+{
+	return (uint32_t)(uintptr_t)hashtab_search(map, (hashtab_key_t)key);
+}
+
+static void __cil_snapshot_writer_init(struct cil_snapshot_writer *w)
+{
+	memset(w, 0, sizeof(*w));
+	w->rc = SEPOL_OK;
+	w->emit = CIL_FALSE;
+	w->ids = __cil_snapshot_map_create();
+	w->symtabs = __cil_snapshot_map_create();
+	w->string_ids = __cil_snapshot_map_create();
+	cil_arena_image_init(&w->data);
+}
+
+static void __cil_snapshot_writer_destroy(struct cil_snapshot_writer *w)
+{
+	hashtab_destroy(w->ids);
+	hashtab_destroy(w->symtabs);
+	hashtab_destroy(w->string_ids);
+	free(w->objects);
+	free(w->entries);
+	free(w->offsets);
+	free(w->owners);
+	free(w->strings);
+	free(w->copies);
+	free(w->addrs);
+	free(w->locs);
+	cil_arena_image_destroy(&w->data);
+	free(w->nodes);
+	free(w->strings_image);
+	free(w->uses);
+	free(w->relocs);
+	free(w->symtab_offsets);
+}
+
+static uint64_t __cil_snapshot_alloc(struct cil_snapshot_writer *w, size_t size)
+{
+	return cil_arena_image_alloc(&w->data, size);
+}
+
+/* Write a pointer at offset in the data and record it to be relocated */
+static void __cil_snapshot_put_ptr(struct cil_snapshot_writer *w, uint64_t offset, uint64_t value, enum cil_snapshot_reloc reloc)
+{
+	memcpy(CIL_SNAPSHOT_AT(w, offset), &value, sizeof(value));
+
+	w->relocs = cil_array_grow(w->relocs, w->num_relocs, &w->alloc_relocs, sizeof(*w->relocs), 4096);
+	w->relocs[w->num_relocs++] = (offset << 1) | reloc;
+}
+
+static uint32_t __cil_snapshot_string_id(struct cil_snapshot_writer *w, char *str)
+{
+	uint32_t id = __cil_snapshot_map_search(w->string_ids, str);
+
+	if (id != 0) {
+		return id;
+	}
+
+	if (w->emit) {
+		w->rc = SEPOL_ERR;
+		return 0;
+	}
+
+	w->strings = cil_array_grow(w->strings, w->num_strings, &w->alloc_strings, sizeof(*w->strings), 1024);
+	w->strings[w->num_strings++] = str;
+	id = w->num_strings;
+	__cil_snapshot_map_insert(w->string_ids, str, id);
+
+	return id;
+}
+
+static void __cil_snapshot_put_str(struct cil_snapshot_writer *w, uint64_t offset, char *str)
+{
+	uint32_t id;
+
+	if (str == NULL) {
+		return;
+	}
+
+	id = __cil_snapshot_string_id(w, str);
+	if (!w->emit || id == 0) {
+		return;
+	}
+
+	memcpy(CIL_SNAPSHOT_AT(w, offset), &w->addrs[id - 1], sizeof(uint64_t));
+
+	w->uses = cil_array_grow(w->uses, w->num_uses, &w->alloc_uses, sizeof(*w->uses), 4096);
+	w->uses[w->num_uses].offset = offset;
+	w->uses[w->num_uses].id = id;
+	w->num_uses++;
+}
+
+static void __cil_snapshot_add_owners(struct cil_snapshot_writer *w, uint32_t id, void *data, const struct cil_snapshot_desc *desc)
+{
+	uint32_t i;
+	uint32_t j;
+
+	for (i = 0; i < desc->num_fields; i++) {
+		const struct cil_snapshot_field *field = &desc->fields[i];
+		uint32_t count;
+
+		if (field->type == CIL_SNAPSHOT_FIELD_SYMTAB) {
+			count = 1;
+		} else if (field->type == CIL_SNAPSHOT_FIELD_SYMTABS) {
+			count = CIL_SYM_NUM;
+		} else {
+			continue;
+		}
+
+		for (j = 0; j < count; j++) {
+			uint32_t offset = field->offset + j * sizeof(struct cil_symtab);
+			w->owners = cil_array_grow(w->owners, w->num_owners, &w->alloc_owners, sizeof(*w->owners), 256);
+			w->owners[w->num_owners].id = id;
+			w->owners[w->num_owners].offset = offset;
+			w->num_owners++;
+			__cil_snapshot_map_insert(w->symtabs, (char *)data + offset, w->num_owners);
+		}
+	}
+}
+
+/* Return the id of ptr, numbering it as a new object of kind and flavor
+ * while collecting */
+static uint32_t __cil_snapshot_ref(struct cil_snapshot_writer *w, void *ptr, enum cil_snapshot_kind kind, enum cil_flavor flavor)
+{
+	const struct cil_snapshot_desc *desc = NULL;
+	uint32_t id;
+
+	if (ptr == NULL) {
+		return 0;
+	}
+
+	id = __cil_snapshot_map_search(w->ids, ptr);
+	if (id != 0) {
+		if (w->objects[id - 1].kind != kind) {
+			cil_log(CIL_ERR, "Snapshot object %u is referenced as two different kinds\n", id);
+			w->rc = SEPOL_ERR;
+			return 0;
+		}
+		return id;
+	}
+
+	if (w->emit) {
+		w->rc = SEPOL_ERR;
+		return 0;
+	}
+
+	if (kind == CIL_SNAPSHOT_KIND_DATA || kind == CIL_SNAPSHOT_KIND_CATS) {
+		desc = __cil_snapshot_object_desc(kind, flavor);
+		if (desc == NULL) {
+			cil_log(CIL_ERR, "Cannot snapshot statements of flavor %d\n", flavor);
+			w->rc = SEPOL_ERR;
+			return 0;
+		}
+	}
+
+	if (w->num_objects == w->alloc_objects) {
+		uint32_t alloc = w->alloc_objects;
+		w->objects = cil_array_grow(w->objects, w->num_objects, &alloc, sizeof(*w->objects), 4096);
+		alloc = w->alloc_objects;
+		w->entries = cil_array_grow(w->entries, w->num_objects, &alloc, sizeof(*w->entries), 4096);
+		w->alloc_objects = alloc;
+	}
+	w->objects[w->num_objects].kind = kind;
+	w->objects[w->num_objects].flavor = flavor;
+	w->entries[w->num_objects] = ptr;
+	id = ++w->num_objects;
+	__cil_snapshot_map_insert(w->ids, ptr, id);
+
+	if (kind == CIL_SNAPSHOT_KIND_DATA) {
+		__cil_snapshot_add_owners(w, id, ptr, desc);
+	}
+
+	return id;
+}
+
+/* The address object id is given in the image */
+static uint64_t __cil_snapshot_addr(struct cil_snapshot_writer *w, uint32_t id)
+{
+	if (w->objects[id - 1].kind == CIL_SNAPSHOT_KIND_NODE) {
+		return cil_arena_nodes + (w->offsets[id - 1] << CIL_ARENA_NODE_SHIFT);
+	}
+
+	return CIL_SNAPSHOT_ADDR(w->offsets[id - 1]);
+}
+
+static void __cil_snapshot_put_id(struct cil_snapshot_writer *w, uint64_t offset, uint32_t id)
+{
+	enum cil_snapshot_reloc reloc = CIL_SNAPSHOT_RELOC_DATA;
+
+	if (!w->emit || id == 0) {
+		return;
+	}
+
+	if (w->objects[id - 1].kind == CIL_SNAPSHOT_KIND_NODE) {
+		reloc = CIL_SNAPSHOT_RELOC_NODE;
+	}
+
+	__cil_snapshot_put_ptr(w, offset, __cil_snapshot_addr(w, id), reloc);
+}
+
+static void __cil_snapshot_put_ref(struct cil_snapshot_writer *w, uint64_t offset, void *ptr, enum cil_snapshot_kind kind)
+{
+	__cil_snapshot_put_id(w, offset, __cil_snapshot_ref(w, ptr, kind, CIL_NONE));
+}
+
+/* Payloads are numbered under the flavor of their first node when they have
+ * one, since most references only know that they point at some datum.
+ * Payloads that are not in the tree take the flavor of the reference. */
+static uint32_t __cil_snapshot_data_ref(struct cil_snapshot_writer *w, void *data, enum cil_flavor hint)
+{
+	enum cil_flavor flavor = hint;
+	uint32_t id;
+
+	if (data == NULL) {
+		return 0;
+	}
+
+	id = __cil_snapshot_map_search(w->ids, data);
+	if (id != 0) {
+		return __cil_snapshot_ref(w, data, CIL_SNAPSHOT_KIND_DATA, CIL_NONE);
+	}
+
+	if ((hint == CIL_NONE || hint >= CIL_MIN_DECLARATIVE) && DATUM(data)->nodes.count > 0) {
+		flavor = FLAVOR(data);
+	}
+
+	if (flavor == CIL_NONE) {
+		cil_log(CIL_ERR, "Cannot snapshot a datum that is not in the tree\n");
+		w->rc = SEPOL_ERR;
+		return 0;
+	}
+
+	return __cil_snapshot_ref(w, data, CIL_SNAPSHOT_KIND_DATA, flavor);
+}
+
+static void __cil_snapshot_put_data(struct cil_snapshot_writer *w, uint64_t offset, void *data, enum cil_flavor hint)
+{
+	__cil_snapshot_put_id(w, offset, __cil_snapshot_data_ref(w, data, hint));
+}
+
+/* The slots and order of a symtab are written out as they are, except that
+ * keys are placed by the address their string will have. Symtabs keyed by a
+ * string of the static block are marked in the list of symtabs, since only
+ * they need rehashing when nothing but the static block moved. */
+static void __cil_snapshot_put_symtab(struct cil_snapshot_writer *w, uint64_t offset, struct cil_symtab *symtab)
+{
+	struct cil_symtab *copy = NULL;
+	uint64_t slots = 0;
+	uint64_t order = 0;
+	uint64_t *entry = NULL;
+	uint32_t i;
+
+	if (symtab->slots == NULL) {
+		return;
+	}
+
+	if (w->emit) {
+		slots = __cil_snapshot_alloc(w, sizeof(*symtab->slots) * (symtab->mask + 1));
+		order = __cil_snapshot_alloc(w, sizeof(*symtab->order) * CIL_SYMTAB_LIMIT(symtab));
+		copy = CIL_SNAPSHOT_AT(w, offset);
+		copy->mask = symtab->mask;
+		copy->shift = symtab->shift;
+		copy->nelems = symtab->nelems;
+		copy->norder = symtab->norder;
+		__cil_snapshot_put_ptr(w, offset + offsetof(struct cil_symtab, slots), CIL_SNAPSHOT_ADDR(slots), CIL_SNAPSHOT_RELOC_DATA);
+		__cil_snapshot_put_ptr(w, offset + offsetof(struct cil_symtab, order), CIL_SNAPSHOT_ADDR(order), CIL_SNAPSHOT_RELOC_DATA);
+
+		w->symtab_offsets = cil_array_grow(w->symtab_offsets, w->num_symtabs, &w->alloc_symtabs, sizeof(*w->symtab_offsets), 256);
+		entry = &w->symtab_offsets[w->num_symtabs++];
+		*entry = offset;
+	}
+
+	for (i = 0; i < symtab->norder; i++) {
+		struct cil_symtab_datum *datum = symtab->order[i];
+		struct cil_symtab_slot *slot = NULL;
+		uint32_t id;
+		uint32_t pos;
+
+		if (datum == NULL) {
+			continue;
+		}
+
+		id = __cil_snapshot_string_id(w, datum->name);
+		__cil_snapshot_put_data(w, order + sizeof(*symtab->order) * i, datum, CIL_NONE);
+		if (!w->emit || id == 0) {
+			continue;
+		}
+
+		if (cil_strpool_is_static(datum->name)) {
+			*entry |= CIL_SNAPSHOT_SYMTAB_KEYED;
+		}
+		pos = CIL_SYMTAB_HASH(symtab, w->addrs[id - 1]);
+		slot = CIL_SNAPSHOT_AT(w, slots + sizeof(*slot) * pos);
+		while (slot->key != NULL) {
+			pos = (pos + 1) & symtab->mask;
+			slot = CIL_SNAPSHOT_AT(w, slots + sizeof(*slot) * pos);
+		}
+		slot->order = i;
+		__cil_snapshot_put_str(w, slots + sizeof(*slot) * pos + offsetof(struct cil_symtab_slot, key), datum->name);
+		__cil_snapshot_put_data(w, slots + sizeof(*slot) * pos + offsetof(struct cil_symtab_slot, datum), datum, CIL_NONE);
+	}
+}
+
+/* The elements of a vector of nodes or of datums */
+static void __cil_snapshot_put_vector(struct cil_snapshot_writer *w, uint64_t offset, struct cil_vector *vector, enum cil_snapshot_kind kind)
+{
+	struct cil_vector *copy = NULL;
+	uint64_t elems = offset + offsetof(struct cil_vector, u);
+	void *elem;
+	uint32_t i;
+
+	if (w->emit) {
+		copy = CIL_SNAPSHOT_AT(w, offset);
+		copy->count = vector->count;
+		copy->alloc = vector->alloc;
+		if (vector->alloc > CIL_VECTOR_INLINE) {
+			elems = __cil_snapshot_alloc(w, sizeof(void *) * vector->alloc);
+			__cil_snapshot_put_ptr(w, offset + offsetof(struct cil_vector, u), CIL_SNAPSHOT_ADDR(elems), CIL_SNAPSHOT_RELOC_DATA);
+		}
+	}
+
+	cil_vector_for_each(elem, i, vector) {
+		if (kind == CIL_SNAPSHOT_KIND_NODE) {
+			__cil_snapshot_put_ref(w, elems + sizeof(void *) * i, elem, CIL_SNAPSHOT_KIND_NODE);
+		} else {
+			__cil_snapshot_put_data(w, elems + sizeof(void *) * i, elem, CIL_NONE);
+		}
+	}
+}
+
+static void __cil_snapshot_put_datum(struct cil_snapshot_writer *w, uint64_t offset, struct cil_symtab_datum *datum, int with_nodes)
+{
+	struct cil_symtab_datum *copy = NULL;
+	uint32_t owner;
+
+	if (with_nodes) {
+		__cil_snapshot_put_vector(w, offset + offsetof(struct cil_symtab_datum, nodes), &datum->nodes, CIL_SNAPSHOT_KIND_NODE);
+	} else if (w->emit) {
+		copy = CIL_SNAPSHOT_AT(w, offset);
+		copy->nodes.count = 0;
+		copy->nodes.alloc = CIL_VECTOR_INLINE;
+	}
+	__cil_snapshot_put_str(w, offset + offsetof(struct cil_symtab_datum, name), datum->name);
+	__cil_snapshot_put_str(w, offset + offsetof(struct cil_symtab_datum, fqn), datum->fqn);
+
+	if (!w->emit || datum->symtab == NULL) {
+		return;
+	}
+
+	owner = __cil_snapshot_map_search(w->symtabs, datum->symtab);
+	if (owner == 0) {
+		cil_log(CIL_ERR, "Cannot snapshot %s, its symbol table is not in the tree\n", datum->name);
+		w->rc = SEPOL_ERR;
+		return;
+	}
+	__cil_snapshot_put_ptr(w, offset + offsetof(struct cil_symtab_datum, symtab),
+		CIL_SNAPSHOT_ADDR(w->offsets[w->owners[owner - 1].id - 1] + w->owners[owner - 1].offset), CIL_SNAPSHOT_RELOC_DATA);
+}
+
+/* Bitmaps are placed as arena owned objects without a destroy function,
+ * with their nodes in the data too */
+static void __cil_snapshot_put_ebitmap(struct cil_snapshot_writer *w, uint64_t offset, ebitmap_t *map)
+{
+	ebitmap_node_t *node;
+	uint64_t copy;
+	uint64_t prev;
+
+	if (!w->emit || map == NULL) {
+		return;
+	}
+
+	copy = cil_arena_image_alloc_owned(&w->data, sizeof(*map));
+	__cil_snapshot_put_ptr(w, offset, CIL_SNAPSHOT_ADDR(copy), CIL_SNAPSHOT_RELOC_DATA);
+	((ebitmap_t *)CIL_SNAPSHOT_AT(w, copy))->highbit = map->highbit;
+
+	prev = copy + offsetof(ebitmap_t, node);
+	for (node = map->node; node != NULL; node = node->next) {
+		uint64_t n = __cil_snapshot_alloc(w, sizeof(*node));
+		ebitmap_node_t *ncopy = CIL_SNAPSHOT_AT(w, n);
+		ncopy->startbit = node->startbit;
+		ncopy->map = node->map;
+		__cil_snapshot_put_ptr(w, prev, CIL_SNAPSHOT_ADDR(n), CIL_SNAPSHOT_RELOC_DATA);
+		prev = n + offsetof(ebitmap_node_t, next);
+	}
+}
+
+static void __cil_snapshot_put_tokens(struct cil_snapshot_writer *w, uint64_t offset, struct cil_parse_token *tokens)
+{
+	uint32_t count = (tokens != NULL) ? tokens->match + 1 : 0;
+	uint64_t copy = 0;
+	uint32_t i;
+
+	if (count == 0) {
+		return;
+	}
+
+	if (w->emit) {
+		copy = __cil_snapshot_alloc(w, sizeof(*tokens) * count);
+		__cil_snapshot_put_ptr(w, offset, CIL_SNAPSHOT_ADDR(copy), CIL_SNAPSHOT_RELOC_DATA);
+	}
+
+	for (i = 0; i < count; i++) {
+		uint64_t token = copy + sizeof(*tokens) * i;
+		if (w->emit) {
+			struct cil_parse_token *tcopy = CIL_SNAPSHOT_AT(w, token);
+			tcopy->loc = tokens[i].loc;
+			tcopy->match = tokens[i].match;
+		}
+		__cil_snapshot_put_str(w, token + offsetof(struct cil_parse_token, data), tokens[i].data);
+	}
+}
+
+static void __cil_snapshot_put_fields(struct cil_snapshot_writer *w, uint64_t offset, void *data, const struct cil_snapshot_desc *desc)
+{
+	uint32_t i;
+	uint32_t j;
+
+	for (i = 0; i < desc->num_fields; i++) {
+		const struct cil_snapshot_field *field = &desc->fields[i];
+		char *p = (char *)data + field->offset;
+		uint64_t o = offset + field->offset;
+
+		switch (field->type) {
+		case CIL_SNAPSHOT_FIELD_U16:
+			if (w->emit) {
+				memcpy(CIL_SNAPSHOT_AT(w, o), p, sizeof(uint16_t));
+			}
+			break;
+		case CIL_SNAPSHOT_FIELD_U32:
+			if (w->emit) {
+				memcpy(CIL_SNAPSHOT_AT(w, o), p, sizeof(uint32_t));
+			}
+			break;
+		case CIL_SNAPSHOT_FIELD_BYTES:
+			if (w->emit) {
+				memcpy(CIL_SNAPSHOT_AT(w, o), p, field->arg);
+			}
+			break;
+		case CIL_SNAPSHOT_FIELD_STR:
+			__cil_snapshot_put_str(w, o, *(char **)p);
+			break;
+		case CIL_SNAPSHOT_FIELD_DATA:
+			__cil_snapshot_put_data(w, o, *(void **)p, field->arg);
+			break;
+		case CIL_SNAPSHOT_FIELD_ARG_DATA:
+			__cil_snapshot_put_data(w, o, *(void **)p, *(uint32_t *)((char *)data + field->arg));
+			break;
+		case CIL_SNAPSHOT_FIELD_LIST:
+			__cil_snapshot_put_ref(w, o, *(void **)p, CIL_SNAPSHOT_KIND_LIST);
+			break;
+		case CIL_SNAPSHOT_FIELD_CATS_LIST:
+			__cil_snapshot_put_ref(w, o, *(void **)p, CIL_SNAPSHOT_KIND_CATS_LIST);
+			break;
+		case CIL_SNAPSHOT_FIELD_CATS:
+			__cil_snapshot_put_ref(w, o, *(void **)p, CIL_SNAPSHOT_KIND_CATS);
+			break;
+		case CIL_SNAPSHOT_FIELD_NODE:
+			__cil_snapshot_put_ref(w, o, *(void **)p, CIL_SNAPSHOT_KIND_NODE);
+			break;
+		case CIL_SNAPSHOT_FIELD_SYMTAB:
+			__cil_snapshot_put_symtab(w, o, (struct cil_symtab *)p);
+			break;
+		case CIL_SNAPSHOT_FIELD_SYMTABS:
+			for (j = 0; j < CIL_SYM_NUM; j++) {
+				__cil_snapshot_put_symtab(w, o + sizeof(struct cil_symtab) * j, &((struct cil_symtab *)p)[j]);
+			}
+			break;
+		case CIL_SNAPSHOT_FIELD_DATUM:
+			__cil_snapshot_put_datum(w, o, (struct cil_symtab_datum *)p, CIL_TRUE);
+			break;
+		case CIL_SNAPSHOT_FIELD_NAME_DATUM:
+			__cil_snapshot_put_datum(w, o, (struct cil_symtab_datum *)p, CIL_FALSE);
+			break;
+		case CIL_SNAPSHOT_FIELD_EBITMAP:
+			__cil_snapshot_put_ebitmap(w, o, *(ebitmap_t **)p);
+			break;
+		case CIL_SNAPSHOT_FIELD_DATUMS:
+			__cil_snapshot_put_vector(w, o, (struct cil_vector *)p, CIL_SNAPSHOT_KIND_DATA);
+			break;
+		case CIL_SNAPSHOT_FIELD_TOKENS:
+			__cil_snapshot_put_tokens(w, o, *(struct cil_parse_token **)p);
+			break;
+		default:
+			w->rc = SEPOL_ERR;
+			break;
+		}
+	}
+}
+
+/* The slot of node index in the node blocks of the image */
+static struct cil_tree_node *__cil_snapshot_node_at(struct cil_snapshot_writer *w, uint32_t index)
+{
+	uint64_t block = (index >> CIL_ARENA_BLOCK_SHIFT) - w->nodes_first;
+
+	return (struct cil_tree_node *)(w->nodes + (block << CIL_ARENA_REGION_SHIFT) + ((uint64_t)(index & CIL_SNAPSHOT_SLOT_MASK) << CIL_ARENA_NODE_SHIFT));
+}
+
+static uint32_t __cil_snapshot_node_index(struct cil_snapshot_writer *w, struct cil_tree_node *node)
+{
+	uint32_t id = __cil_snapshot_ref(w, node, CIL_SNAPSHOT_KIND_NODE, CIL_NONE);
+
+	return (w->emit && id != 0) ? (uint32_t)w->offsets[id - 1] : 0;
+}
+
+/* Nodes link to each other by index and are not in the relocs, as the
+ * load walks the node blocks when they move */
+static void __cil_snapshot_put_node(struct cil_snapshot_writer *w, uint32_t id)
+{
+	struct cil_tree_node *node = w->entries[id - 1];
+	struct cil_tree_node *copy = NULL;
+	uint32_t parent = __cil_snapshot_node_index(w, cil_tree_node_parent(node));
+	uint32_t head = __cil_snapshot_node_index(w, cil_tree_node_head(node));
+	uint32_t tail = __cil_snapshot_node_index(w, cil_tree_node_tail(node));
+	uint32_t next = __cil_snapshot_node_index(w, cil_tree_node_next(node));
+	uint32_t data = __cil_snapshot_data_ref(w, node->data, node->flavor);
+
+	if (data != 0 && w->objects[data - 1].flavor != node->flavor) {
+		cil_log(CIL_ERR, "Snapshot object %u is reached from nodes of two flavors\n", data);
+		w->rc = SEPOL_ERR;
+	}
+
+	if (!w->emit) {
+		return;
+	}
+
+	copy = __cil_snapshot_node_at(w, w->offsets[id - 1]);
+	copy->parent = parent;
+	copy->cl_head = head;
+	copy->cl_tail = tail;
+	copy->next = next;
+	copy->data = data ? (void *)(uintptr_t)__cil_snapshot_addr(w, data) : NULL;
+	copy->loc = node->loc;
+	copy->flavor = node->flavor;
+}
+
+static void __cil_snapshot_put_list(struct cil_snapshot_writer *w, uint64_t offset, struct cil_list *list, enum cil_snapshot_kind kind)
+{
+	struct cil_list_item *item;
+	uint64_t prev = offset + offsetof(struct cil_list, head);
+	uint64_t copy = 0;
+
+	if (w->emit) {
+		((struct cil_list *)CIL_SNAPSHOT_AT(w, offset))->flavor = list->flavor;
+	}
+
+	cil_list_for_each(item, list) {
+		uint64_t data;
+
+		if (w->emit) {
+			copy = __cil_snapshot_alloc(w, sizeof(*item));
+			((struct cil_list_item *)CIL_SNAPSHOT_AT(w, copy))->flavor = item->flavor;
+			__cil_snapshot_put_ptr(w, prev, CIL_SNAPSHOT_ADDR(copy), CIL_SNAPSHOT_RELOC_DATA);
+			prev = copy + offsetof(struct cil_list_item, next);
+		}
+		data = copy + offsetof(struct cil_list_item, data);
+
+		if (kind == CIL_SNAPSHOT_KIND_CATS_LIST) {
+			__cil_snapshot_put_ref(w, data, item->data, CIL_SNAPSHOT_KIND_CATS);
+			continue;
+		}
+		switch (item->flavor) {
+		case CIL_STRING:
+			__cil_snapshot_put_str(w, data, item->data);
+			break;
+		case CIL_OP:
+		case CIL_CONS_OPERAND:
+			if (w->emit) {
+				memcpy(CIL_SNAPSHOT_AT(w, data), &item->data, sizeof(item->data));
+			}
+			break;
+		case CIL_LIST:
+			__cil_snapshot_put_ref(w, data, item->data, CIL_SNAPSHOT_KIND_LIST);
+			break;
+		case CIL_NODE:
+			__cil_snapshot_put_ref(w, data, item->data, CIL_SNAPSHOT_KIND_NODE);
+			break;
+		case CIL_DATUM:
+			__cil_snapshot_put_data(w, data, item->data, CIL_NONE);
+			break;
+		default:
+			__cil_snapshot_put_data(w, data, item->data, item->flavor);
+			break;
+		}
+	}
+
+	if (w->emit && copy != 0) {
+		__cil_snapshot_put_ptr(w, offset + offsetof(struct cil_list, tail), CIL_SNAPSHOT_ADDR(copy), CIL_SNAPSHOT_RELOC_DATA);
+	}
+}
+
+static void __cil_snapshot_put_object(struct cil_snapshot_writer *w, uint32_t id)
+{
+	struct cil_snapshot_object *object = &w->objects[id - 1];
+	void *entry = w->entries[id - 1];
+	uint64_t offset = w->emit ? w->offsets[id - 1] : 0;
+
+	switch (object->kind) {
+	case CIL_SNAPSHOT_KIND_NODE:
+		__cil_snapshot_put_node(w, id);
+		break;
+	case CIL_SNAPSHOT_KIND_LIST:
+	case CIL_SNAPSHOT_KIND_CATS_LIST:
+		__cil_snapshot_put_list(w, offset, entry, object->kind);
+		break;
+	case CIL_SNAPSHOT_KIND_CATS:
+	case CIL_SNAPSHOT_KIND_DATA:
+		__cil_snapshot_put_fields(w, offset, entry, __cil_snapshot_object_desc(object->kind, object->flavor));
+		break;
+	default:
+		break;
+	}
+}
+
+static void __cil_snapshot_put_sort(struct cil_snapshot_writer *w, uint64_t offset, struct cil_sort *sort, enum cil_flavor flavor)
+{
+	struct cil_sort *copy = NULL;
+	uint64_t sort_offset = 0;
+	uint64_t array = 0;
+	uint32_t i;
+
+	if (w->emit) {
+		sort_offset = __cil_snapshot_alloc(w, sizeof(*sort));
+		copy = CIL_SNAPSHOT_AT(w, sort_offset);
+		copy->flavor = sort->flavor;
+		copy->count = sort->count;
+		copy->index = sort->index;
+		__cil_snapshot_put_ptr(w, offset, CIL_SNAPSHOT_ADDR(sort_offset), CIL_SNAPSHOT_RELOC_DATA);
+		if (sort->count > 0) {
+			array = __cil_snapshot_alloc(w, sizeof(*sort->array) * sort->count);
+			__cil_snapshot_put_ptr(w, sort_offset + offsetof(struct cil_sort, array), CIL_SNAPSHOT_ADDR(array), CIL_SNAPSHOT_RELOC_DATA);
+		}
+	}
+
+	for (i = 0; i < sort->count; i++) {
+		__cil_snapshot_put_data(w, array + sizeof(*sort->array) * i, sort->array[i], flavor);
+	}
+}
+
+static void __cil_snapshot_put_vals(struct cil_snapshot_writer *w, uint64_t offset, void **vals, int32_t count, enum cil_flavor flavor)
+{
+	uint64_t array = 0;
+	int32_t i;
+
+	if (vals == NULL) {
+		return;
+	}
+
+	if (w->emit) {
+		array = __cil_snapshot_alloc(w, sizeof(*vals) * (count > 0 ? count : 1));
+		__cil_snapshot_put_ptr(w, offset, CIL_SNAPSHOT_ADDR(array), CIL_SNAPSHOT_RELOC_DATA);
+	}
+
+	for (i = 0; i < count; i++) {
+		__cil_snapshot_put_data(w, array + sizeof(*vals) * i, vals[i], flavor);
+	}
+}
+
+static void __cil_snapshot_put_index(struct cil_snapshot_writer *w, uint64_t offset, struct cil_index *index)
+{
+	struct cil_snapshot_db *rec = NULL;
+	uint32_t i;
+	uint32_t j;
+
+	if (index == NULL) {
+		return;
+	}
+
+	if (w->emit) {
+		rec = CIL_SNAPSHOT_AT(w, offset);
+		rec->indexed = CIL_TRUE;
+		rec->index_count = index->count;
+	}
+
+	for (i = 0; i < CIL_INDEX_NUM; i++) {
+		struct cil_index_list *list = &index->lists[i];
+		uint64_t entries = 0;
+
+		if (w->emit && list->count > 0) {
+			uint64_t field = offset + offsetof(struct cil_snapshot_db, index) + sizeof(*list) * i;
+			entries = __cil_snapshot_alloc(w, sizeof(*list->entries) * list->count);
+			((struct cil_index_list *)CIL_SNAPSHOT_AT(w, field))->count = list->count;
+			__cil_snapshot_put_ptr(w, field + offsetof(struct cil_index_list, entries), CIL_SNAPSHOT_ADDR(entries), CIL_SNAPSHOT_RELOC_DATA);
+		}
+
+		for (j = 0; j < list->count; j++) {
+			struct cil_index_entry *entry = &list->entries[j];
+			uint64_t e = entries + sizeof(*entry) * j;
+			__cil_snapshot_put_ref(w, e + offsetof(struct cil_index_entry, node), entry->node, CIL_SNAPSHOT_KIND_NODE);
+			__cil_snapshot_put_ref(w, e + offsetof(struct cil_index_entry, boolif), entry->boolif, CIL_SNAPSHOT_KIND_NODE);
+			if (w->emit) {
+				((struct cil_index_entry *)CIL_SNAPSHOT_AT(w, e))->order = entry->order;
+			}
+		}
+	}
+}
+
+static void __cil_snapshot_put_db(struct cil_snapshot_writer *w, struct cil_db *db)
+{
+	struct cil_snapshot_db *rec = NULL;
+	uint64_t offset = 0;
+	uint32_t i;
+
+	if (w->emit) {
+		offset = __cil_snapshot_alloc(w, sizeof(*rec));
+		w->db = offset;
+	}
+
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, root), db->ast->root, CIL_SNAPSHOT_KIND_NODE);
+	__cil_snapshot_put_data(w, offset + offsetof(struct cil_snapshot_db, selftype), db->selftype, CIL_TYPE);
+
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, sidorder), db->sidorder, CIL_SNAPSHOT_KIND_LIST);
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, classorder), db->classorder, CIL_SNAPSHOT_KIND_LIST);
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, catorder), db->catorder, CIL_SNAPSHOT_KIND_LIST);
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, sensitivityorder), db->sensitivityorder, CIL_SNAPSHOT_KIND_LIST);
+
+	for (i = 0; i < CIL_SNAPSHOT_NUM_SORTS; i++) {
+		__cil_snapshot_put_sort(w, offset + offsetof(struct cil_snapshot_db, sorts) + sizeof(struct cil_sort *) * i,
+			CIL_SNAPSHOT_SORT(db, i), cil_snapshot_sorts[i].flavor);
+	}
+
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, userprefixes), db->userprefixes, CIL_SNAPSHOT_KIND_LIST);
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, selinuxusers), db->selinuxusers, CIL_SNAPSHOT_KIND_LIST);
+	__cil_snapshot_put_ref(w, offset + offsetof(struct cil_snapshot_db, names), db->names, CIL_SNAPSHOT_KIND_LIST);
+
+	__cil_snapshot_put_vals(w, offset + offsetof(struct cil_snapshot_db, val_to_type), (void **)db->val_to_type, db->num_types, CIL_TYPE);
+	__cil_snapshot_put_vals(w, offset + offsetof(struct cil_snapshot_db, val_to_role), (void **)db->val_to_role, db->num_roles, CIL_ROLE);
+
+	__cil_snapshot_put_index(w, offset, db->index);
+
+	if (w->emit) {
+		rec = CIL_SNAPSHOT_AT(w, offset);
+		rec->num_cats = db->num_cats;
+		rec->num_types = db->num_types;
+		rec->num_roles = db->num_roles;
+		rec->disable_dontaudit = db->disable_dontaudit;
+		rec->disable_neverallow = db->disable_neverallow;
+		rec->preserve_tunables = db->preserve_tunables;
+		rec->handle_unknown = db->handle_unknown;
+		rec->mls = db->mls;
+	}
+}
+
+static int __cil_snapshot_add_loc(char *path, uint32_t first, uint32_t count, uint32_t base, void *args)
+{
+	struct cil_snapshot_writer *w = args;
+	struct cil_snapshot_loc *loc;
+
+	w->locs = cil_array_grow(w->locs, w->num_locs, &w->alloc_locs, sizeof(*w->locs), 64);
+	loc = &w->locs[w->num_locs++];
+	loc->path = __cil_snapshot_string_id(w, path);
+	loc->first = first;
+	loc->count = count;
+	loc->base = base;
+
+	return SEPOL_OK;
+}
+
+/* Give each object its place: nodes their index in blocks counted down
+ * from the end of the node table, everything else its offset in the data.
+ * The strings are laid out as well, so that every address is known before
+ * anything is written. */
+static void __cil_snapshot_place(struct cil_snapshot_writer *w)
+{
+	const struct cil_snapshot_desc *desc = NULL;
+	uint32_t num_nodes = 0;
+	uint32_t i;
+
+	w->offsets = cil_malloc(sizeof(*w->offsets) * (w->num_objects + 1));
+
+	for (i = 0; i < w->num_objects; i++) {
+		if (w->objects[i].kind == CIL_SNAPSHOT_KIND_NODE) {
+			num_nodes++;
+		}
+	}
+	w->nodes_count = (num_nodes + CIL_SNAPSHOT_BLOCK_NODES - 1) / CIL_SNAPSHOT_BLOCK_NODES;
+	w->nodes_first = cil_arena_node_blocks() - w->nodes_count;
+	w->nodes = cil_calloc(w->nodes_count, CIL_ARENA_REGION_SIZE);
+
+	num_nodes = 0;
+	for (i = 0; i < w->num_objects; i++) {
+		switch (w->objects[i].kind) {
+		case CIL_SNAPSHOT_KIND_NODE:
+			w->offsets[i] = ((uint64_t)(w->nodes_first + num_nodes / CIL_SNAPSHOT_BLOCK_NODES) << CIL_ARENA_BLOCK_SHIFT) |
+				(1 + num_nodes % CIL_SNAPSHOT_BLOCK_NODES);
+			num_nodes++;
+			break;
+		case CIL_SNAPSHOT_KIND_LIST:
+		case CIL_SNAPSHOT_KIND_CATS_LIST:
+			w->offsets[i] = __cil_snapshot_alloc(w, sizeof(struct cil_list));
+			break;
+		default:
+			desc = __cil_snapshot_object_desc(w->objects[i].kind, w->objects[i].flavor);
+			w->offsets[i] = __cil_snapshot_alloc(w, desc->size);
+			break;
+		}
+	}
+
+	w->copies = cil_malloc(sizeof(*w->copies) * (w->num_strings + 1));
+	w->addrs = cil_malloc(sizeof(*w->addrs) * (w->num_strings + 1));
+	w->strings_size = cil_strpool_image_size(w->strings, w->num_strings);
+	w->strings_image = cil_malloc(w->strings_size);
+	cil_strpool_image_write(w->strings_image, w->strings, w->num_strings, w->copies);
+	for (i = 0; i < w->num_strings; i++) {
+		if (cil_strpool_is_static(w->strings[i])) {
+			w->addrs[i] = (uintptr_t)w->strings[i];
+		} else {
+			w->addrs[i] = CIL_SNAPSHOT_STRINGS_BASE + w->copies[i];
+		}
+	}
+}
+
+/* FNV-1a, to catch files that were damaged after they were written */
+static uint32_t __cil_snapshot_checksum(uint32_t hash, const void *data, size_t size)
+{
+	const unsigned char *p = data;
+	size_t i;
+
+	for (i = 0; i < size; i++) {
+		hash = (hash ^ p[i]) * 16777619;
+	}
+
+	return hash;
+}
+
+/* A sum of the layout of everything an image holds as it is in memory */
+static uint64_t __cil_snapshot_layout(void)
+{
+	const uint64_t sizes[] = {
+		sizeof(struct cil_tree_node), sizeof(struct cil_list), sizeof(struct cil_list_item),
+		sizeof(struct cil_symtab), sizeof(struct cil_symtab_slot), sizeof(struct cil_symtab_datum),
+		sizeof(struct cil_vector), sizeof(struct cil_parse_token), sizeof(struct cil_sort),
+		sizeof(struct cil_index_entry), sizeof(struct cil_index_list), sizeof(ebitmap_t),
+		sizeof(ebitmap_node_t), sizeof(struct cil_snapshot_db), sizeof(struct cil_cats),
+		CIL_SYM_NUM, CIL_INDEX_NUM, CIL_VECTOR_INLINE, CIL_ARENA_REGION_SHIFT,
+		CIL_ARENA_HEADER_SIZE, CIL_ARENA_NODE_SHIFT,
+	};
+	uint32_t sum = __cil_snapshot_checksum(CIL_SNAPSHOT_CHECKSUM_INIT, sizes, sizeof(sizes));
+	uint32_t flavor;
+
+	for (flavor = 0; flavor <= CIL_POLICYCAP; flavor++) {
+		const struct cil_snapshot_desc *desc = __cil_snapshot_desc(flavor);
+		if (desc == NULL) {
+			continue;
+		}
+		sum = __cil_snapshot_checksum(sum, &flavor, sizeof(flavor));
+		sum = __cil_snapshot_checksum(sum, &desc->size, sizeof(desc->size));
+		sum = __cil_snapshot_checksum(sum, desc->fields, sizeof(*desc->fields) * desc->num_fields);
+	}
+
+	return sum;
+}
+
+static int __cil_snapshot_write_at(int fd, uint64_t offset, const void *data, size_t size)
+{
+	const char *p = data;
+	ssize_t written;
+
+	while (size > 0) {
+		written = pwrite(fd, p, size, offset);
+		if (written <= 0) {
+			return SEPOL_ERR;
+		}
+		p += written;
+		offset += written;
+		size -= written;
+	}
+
+	return SEPOL_OK;
+}
+
+#define CIL_SNAPSHOT_ALIGN_UP(x)	(((x) + CIL_SNAPSHOT_ALIGN - 1) & ~(uint64_t)(CIL_SNAPSHOT_ALIGN - 1))
+
+/* The tables, in the order they follow each other */
+static void __cil_snapshot_tables(struct cil_snapshot_writer *w, char **tables, uint64_t *size)
+{
+	struct cil_snapshot_string *strs = NULL;
+	uint64_t *refs = NULL;
+	uint64_t pos;
+	uint32_t i;
+
+	*size = sizeof(*w->locs) * w->num_locs + sizeof(*strs) * w->num_strings +
+		sizeof(*w->symtab_offsets) * w->num_symtabs + sizeof(*refs) * w->num_uses + sizeof(*w->relocs) * w->num_relocs;
+	*tables = cil_calloc(1, *size);
+
+	pos = 0;
+	memcpy(*tables, w->locs, sizeof(*w->locs) * w->num_locs);
+	pos += sizeof(*w->locs) * w->num_locs;
+	strs = (struct cil_snapshot_string *)(*tables + pos);
+	pos += sizeof(*strs) * w->num_strings;
+	memcpy(*tables + pos, w->symtab_offsets, sizeof(*w->symtab_offsets) * w->num_symtabs);
+	pos += sizeof(*w->symtab_offsets) * w->num_symtabs;
+	refs = (uint64_t *)(*tables + pos);
+	pos += sizeof(*refs) * w->num_uses;
+	memcpy(*tables + pos, w->relocs, sizeof(*w->relocs) * w->num_relocs);
+
+	/* The uses of each string are grouped together */
+	for (i = 0; i < w->num_strings; i++) {
+		strs[i].addr = w->addrs[i];
+		strs[i].copy = w->copies[i];
+		strs[i].is_static = cil_strpool_is_static(w->strings[i]);
+	}
+	for (i = 0; i < w->num_uses; i++) {
+		strs[w->uses[i].id - 1].num_refs++;
+	}
+	pos = 0;
+	for (i = 0; i < w->num_strings; i++) {
+		strs[i].first_ref = pos;
+		pos += strs[i].num_refs;
+		strs[i].num_refs = 0;
+	}
+	for (i = 0; i < w->num_uses; i++) {
+		struct cil_snapshot_string *s = &strs[w->uses[i].id - 1];
+		refs[s->first_ref + s->num_refs++] = w->uses[i].offset;
+	}
+}
+
+static int __cil_snapshot_write(struct cil_snapshot_writer *w, const char *path)
+{
+	int rc = SEPOL_ERR;
+	struct cil_snapshot_header header;
+	char *tables = NULL;
+	char *tmp = NULL;
+	uint64_t tables_size;
+	int fd;
+
+	__cil_snapshot_tables(w, &tables, &tables_size);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CIL_SNAPSHOT_MAGIC, 8);
+	header.version = CIL_SNAPSHOT_VERSION;
+	header.byte_order = CIL_SNAPSHOT_BYTE_ORDER;
+	header.layout = __cil_snapshot_layout();
+	header.keys_base = cil_strpool_static(&header.keys_sum);
+	header.data_base = CIL_SNAPSHOT_DATA_BASE;
+	header.data_offset = CIL_SNAPSHOT_ALIGN;
+	header.data_size = w->data.size;
+	header.db = w->db;
+	header.nodes_base = cil_arena_nodes;
+	header.nodes_offset = header.data_offset + header.data_size;
+	header.nodes_first = w->nodes_first;
+	header.nodes_count = w->nodes_count;
+	header.strings_base = CIL_SNAPSHOT_STRINGS_BASE;
+	header.strings_offset = header.nodes_offset + ((uint64_t)w->nodes_count << CIL_ARENA_REGION_SHIFT);
+	header.strings_size = w->strings_size;
+	header.tables_offset = CIL_SNAPSHOT_ALIGN_UP(header.strings_offset + header.strings_size);
+	header.tables_size = tables_size;
+	header.num_refs = w->num_uses;
+	header.num_relocs = w->num_relocs;
+	header.num_symtabs = w->num_symtabs;
+	header.num_strings = w->num_strings;
+	header.num_locs = w->num_locs;
+	header.file_size = header.tables_offset + header.tables_size;
+	header.checksum = 0;
+	header.checksum = __cil_snapshot_checksum(CIL_SNAPSHOT_CHECKSUM_INIT, &header, sizeof(header));
+	header.checksum = __cil_snapshot_checksum(header.checksum, tables, sizeof(*w->locs) * w->num_locs);
+
+	tmp = cil_malloc(strlen(path) + sizeof(".XXXXXX"));
+	strcpy(tmp, path);
+	strcat(tmp, ".XXXXXX");
+
+	fd = mkstemp(tmp);
+	if (fd == -1) {
+		cil_log(CIL_ERR, "Failed to create %s\n", tmp);
+		goto exit;
+	}
+
+	/* The gaps between the areas are left as holes */
+	rc = ftruncate(fd, header.file_size) == 0 ? SEPOL_OK : SEPOL_ERR;
+	if (rc == SEPOL_OK) {
+		rc = __cil_snapshot_write_at(fd, 0, &header, sizeof(header));
+	}
+	if (rc == SEPOL_OK) {
+		rc = __cil_snapshot_write_at(fd, header.data_offset, w->data.data, header.data_size);
+	}
+	if (rc == SEPOL_OK) {
+		rc = __cil_snapshot_write_at(fd, header.nodes_offset, w->nodes, (uint64_t)w->nodes_count << CIL_ARENA_REGION_SHIFT);
+	}
+	if (rc == SEPOL_OK) {
+		rc = __cil_snapshot_write_at(fd, header.strings_offset, w->strings_image, header.strings_size);
+	}
+	if (rc == SEPOL_OK) {
+		rc = __cil_snapshot_write_at(fd, header.tables_offset, tables, header.tables_size);
+	}
+
+	if (close(fd) != 0) {
+		rc = SEPOL_ERR;
+	}
+
+	if (rc == SEPOL_OK && rename(tmp, path) != 0) {
+		rc = SEPOL_ERR;
+	}
+
+	if (rc != SEPOL_OK) {
+		cil_log(CIL_ERR, "Failed to write %s\n", path);
+		unlink(tmp);
+	}
+
+exit:
+	free(tmp);
+	free(tables);
+
+	return rc;
+}
+
+/* Write the compiled database to path. The file is written under a
+ * temporary name and renamed into place. */
+int cil_snapshot_save(struct cil_db *db, const char *path)
+{
+	int rc = SEPOL_ERR;
+	struct cil_snapshot_writer w;
+	struct cil_list_item *item;
+	uint32_t i;
+
+	if (db->compiled_tail == NULL || db->parse != NULL || cil_tree_node_tail(db->ast->root) != db->compiled_tail) {
+		cil_log(CIL_ERR, "Only a compiled database can be saved\n");
+		return SEPOL_ERR;
+	}
+
+	__cil_snapshot_writer_init(&w);
+
+	__cil_snapshot_ref(&w, db->ast->root, CIL_SNAPSHOT_KIND_NODE, CIL_NONE);
+	__cil_snapshot_ref(&w, db->selftype, CIL_SNAPSHOT_KIND_DATA, CIL_TYPE);
+
+	/* The node of a name is the typetransition that first used it, which
+	 * may since have been destroyed with its optional, so names are
+	 * numbered up front and saved without their nodes */
+	cil_list_for_each(item, db->names) {
+		__cil_snapshot_ref(&w, item->data, CIL_SNAPSHOT_KIND_DATA, CIL_NAME);
+	}
+
+	__cil_snapshot_put_db(&w, db);
+	for (i = 1; i <= w.num_objects && w.rc == SEPOL_OK; i++) {
+		__cil_snapshot_put_object(&w, i);
+	}
+	cil_tree_loc_map(__cil_snapshot_add_loc, &w);
+	if (w.rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	__cil_snapshot_place(&w);
+
+	w.emit = CIL_TRUE;
+	__cil_snapshot_put_db(&w, db);
+	for (i = 1; i <= w.num_objects && w.rc == SEPOL_OK; i++) {
+		__cil_snapshot_put_object(&w, i);
+	}
+	if (w.rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	rc = __cil_snapshot_write(&w, path);
+
+exit:
+	__cil_snapshot_writer_destroy(&w);
+
+	return rc;
+}
+
+/* An image being loaded. Any table entry that is out of range makes rc
+ * sticky. */
+struct cil_snapshot_reader {
+	int rc;
+	const struct cil_snapshot_header *header;
+	char *data;
+	char *strings;
+	uint32_t *blocks;
+	const struct cil_snapshot_loc *locs;
+	const struct cil_snapshot_string *strs;
+	const uint64_t *symtabs;
+	const uint64_t *refs;
+	const uint64_t *relocs;
+	int lazy;
+	int keys_moved;
+	int keys_same;			/* keys at the offsets the image has them at */
+	uintptr_t keys_delta;
+};
+
+/* Whether size bytes at offset are an aligned area of a file of file_size
+ * bytes */
+static int __cil_snapshot_area(uint64_t offset, uint64_t size, uint64_t file_size)
+{
+	return (offset & (CIL_SNAPSHOT_ALIGN - 1)) == 0 && offset <= file_size && size <= file_size - offset;
+}
+
+static int __cil_snapshot_check(const struct cil_snapshot_header *header, uint64_t file_size)
+{
+	uint64_t tables_size;
+
+	if (memcmp(header->magic, CIL_SNAPSHOT_MAGIC, 8) != 0 || header->version != CIL_SNAPSHOT_VERSION ||
+		header->byte_order != CIL_SNAPSHOT_BYTE_ORDER || header->layout != __cil_snapshot_layout() ||
+		header->file_size != file_size) {
+		return SEPOL_ERR;
+	}
+
+	if (header->data_size == 0 || (header->data_size & (CIL_ARENA_REGION_SIZE - 1)) != 0 ||
+		header->db > header->data_size - sizeof(struct cil_snapshot_db) || (header->db & 7) != 0 ||
+		header->nodes_count == 0 || header->nodes_count > CIL_ARENA_NUM_BLOCKS) {
+		return SEPOL_ERR;
+	}
+
+	if (!__cil_snapshot_area(header->data_offset, header->data_size, file_size) ||
+		!__cil_snapshot_area(header->nodes_offset, (uint64_t)header->nodes_count << CIL_ARENA_REGION_SHIFT, file_size) ||
+		!__cil_snapshot_area(header->strings_offset, header->strings_size, file_size) ||
+		!__cil_snapshot_area(header->tables_offset, header->tables_size, file_size)) {
+		return SEPOL_ERR;
+	}
+
+	if (header->num_refs > file_size || header->num_relocs > file_size) {
+		return SEPOL_ERR;
+	}
+	tables_size = sizeof(struct cil_snapshot_loc) * (uint64_t)header->num_locs +
+		sizeof(struct cil_snapshot_string) * (uint64_t)header->num_strings +
+		sizeof(uint64_t) * ((uint64_t)header->num_symtabs + header->num_refs + header->num_relocs);
+	if (header->tables_size != tables_size || tables_size == 0) {
+		return SEPOL_ERR;
+	}
+
+	return SEPOL_OK;
+}
+
+/* Check the sum of the header and of the locs, which is all that a load
+ * reads up front */
+static int __cil_snapshot_verify(const struct cil_snapshot_header *header, const char *tables)
+{
+	struct cil_snapshot_header copy = *header;
+	uint32_t checksum;
+
+	copy.checksum = 0;
+	checksum = __cil_snapshot_checksum(CIL_SNAPSHOT_CHECKSUM_INIT, &copy, sizeof(copy));
+	checksum = __cil_snapshot_checksum(checksum, tables, sizeof(struct cil_snapshot_loc) * header->num_locs);
+
+	return (checksum == header->checksum) ? SEPOL_OK : SEPOL_ERR;
+}
+
+/* Map the data of an image at the address it was laid out for or, if that
+ * is taken, anywhere aligned to the region size */
+static char *__cil_snapshot_map_data(int fd, const struct cil_snapshot_header *header)
+{
+	size_t size = header->data_size;
+	char *mem = NULL;
+	char *aligned = NULL;
+
+	mem = mmap((void *)(uintptr_t)header->data_base, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (mem == MAP_FAILED) {
+		return NULL;
+	}
+
+	if (mem != (char *)(uintptr_t)header->data_base) {
+		munmap(mem, size);
+		mem = mmap(NULL, size + CIL_ARENA_REGION_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (mem == MAP_FAILED) {
+			return NULL;
+		}
+		aligned = (char *)(((uintptr_t)mem + CIL_ARENA_REGION_SIZE - 1) & ~(uintptr_t)(CIL_ARENA_REGION_SIZE - 1));
+		if (aligned != mem) {
+			munmap(mem, aligned - mem);
+		}
+		munmap(aligned + size, mem + CIL_ARENA_REGION_SIZE - aligned);
+		mem = aligned;
+	}
+
+	if (mmap(mem, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, header->data_offset) == MAP_FAILED) {
+		munmap(mem, size);
+		return NULL;
+	}
+
+	return mem;
+}
+
+/* Where node index of the image went */
+static uint32_t __cil_snapshot_move_node(struct cil_snapshot_reader *r, uint64_t index)
+{
+	uint64_t block;
+
+	if (index == 0) {
+		return 0;
+	}
+
+	block = (index >> CIL_ARENA_BLOCK_SHIFT) - r->header->nodes_first;
+	if (index > UINT32_MAX || block >= r->header->nodes_count || (index & CIL_SNAPSHOT_SLOT_MASK) == 0) {
+		r->rc = SEPOL_ERR;
+		return 0;
+	}
+
+	return (r->blocks[block] << CIL_ARENA_BLOCK_SHIFT) | (uint32_t)(index & CIL_SNAPSHOT_SLOT_MASK);
+}
+
+static uint64_t *__cil_snapshot_pointer(struct cil_snapshot_reader *r, uint64_t offset)
+{
+	if (offset > r->header->data_size - sizeof(uint64_t) || (offset & 7) != 0) {
+		r->rc = SEPOL_ERR;
+		return NULL;
+	}
+
+	return (uint64_t *)(r->data + offset);
+}
+
+/* Fix up the pointers into the data and the node table if either is not
+ * where the image was laid out for */
+static void __cil_snapshot_relocate(struct cil_snapshot_reader *r)
+{
+	const struct cil_snapshot_header *header = r->header;
+	uint64_t delta = (uintptr_t)r->data - header->data_base;
+	int nodes_moved = (cil_arena_nodes != header->nodes_base);
+	uint64_t *p = NULL;
+	uint64_t i;
+	uint32_t b;
+	uint32_t slot;
+
+	for (b = 0; b < header->nodes_count; b++) {
+		if (r->blocks[b] != header->nodes_first + b) {
+			nodes_moved = CIL_TRUE;
+		}
+	}
+
+	if (delta == 0 && !nodes_moved) {
+		return;
+	}
+
+	for (i = 0; i < header->num_relocs && r->rc == SEPOL_OK; i++) {
+		p = __cil_snapshot_pointer(r, r->relocs[i] >> 1);
+		if (p == NULL) {
+			break;
+		}
+		if ((r->relocs[i] & 1) == CIL_SNAPSHOT_RELOC_NODE) {
+			*p = cil_arena_nodes + ((uint64_t)__cil_snapshot_move_node(r, (*p - header->nodes_base) >> CIL_ARENA_NODE_SHIFT) << CIL_ARENA_NODE_SHIFT);
+		} else {
+			*p += delta;
+		}
+	}
+
+	for (b = 0; b < header->nodes_count; b++) {
+		char *block = (char *)(cil_arena_nodes + ((uintptr_t)r->blocks[b] << CIL_ARENA_REGION_SHIFT));
+		for (slot = 1; slot <= CIL_SNAPSHOT_BLOCK_NODES; slot++) {
+			struct cil_tree_node *node = (struct cil_tree_node *)(block + ((uintptr_t)slot << CIL_ARENA_NODE_SHIFT));
+			if (nodes_moved) {
+				node->parent = __cil_snapshot_move_node(r, node->parent);
+				node->cl_head = __cil_snapshot_move_node(r, node->cl_head);
+				node->cl_tail = __cil_snapshot_move_node(r, node->cl_tail);
+				node->next = __cil_snapshot_move_node(r, node->next);
+			}
+			if (node->data != NULL) {
+				node->data = (char *)node->data + delta;
+			}
+		}
+	}
+}
+
+/* The interned copy of string i of the image */
+static char *__cil_snapshot_string(struct cil_snapshot_reader *r, uint32_t i)
+{
+	const struct cil_snapshot_string *s = &r->strs[i];
+	char *copy = NULL;
+
+	if (s->copy >= r->header->strings_size) {
+		r->rc = SEPOL_ERR;
+		return NULL;
+	}
+	copy = r->strings + s->copy;
+
+	if (s->is_static) {
+		if (!r->keys_moved) {
+			return (char *)(uintptr_t)s->addr;
+		}
+		return r->keys_same ? (char *)(uintptr_t)(s->addr + r->keys_delta) : cil_strpool_add(copy);
+	}
+
+	return r->lazy ? copy : cil_strpool_image_adopt(copy);
+}
+
+/* Point every use of a string at its interned copy, where that is not the
+ * address the image holds, and rehash the symtabs whose keys moved */
+static void __cil_snapshot_intern(struct cil_snapshot_reader *r)
+{
+	const struct cil_snapshot_header *header = r->header;
+	int strings_moved = ((uintptr_t)r->strings != header->strings_base);
+	int moved = CIL_FALSE;
+	int keys_moved = CIL_FALSE;
+	uint64_t offset;
+	uint64_t *p = NULL;
+	uint32_t i;
+	uint32_t j;
+
+	if (!r->keys_moved && r->lazy && !strings_moved) {
+		return;
+	}
+
+	for (i = 0; i < header->num_strings && r->rc == SEPOL_OK; i++) {
+		const struct cil_snapshot_string *s = &r->strs[i];
+		char *str;
+
+		if (s->is_static ? !r->keys_moved : (r->lazy && !strings_moved)) {
+			continue;
+		}
+
+		str = __cil_snapshot_string(r, i);
+		if (str == NULL || (uintptr_t)str == s->addr) {
+			continue;
+		}
+
+		if (s->first_ref > header->num_refs || s->num_refs > header->num_refs - s->first_ref) {
+			r->rc = SEPOL_ERR;
+			return;
+		}
+		for (j = 0; j < s->num_refs; j++) {
+			p = __cil_snapshot_pointer(r, r->refs[s->first_ref + j]);
+			if (p == NULL) {
+				return;
+			}
+			*p = (uintptr_t)str;
+		}
+		if (s->is_static) {
+			keys_moved = CIL_TRUE;
+		} else {
+			moved = CIL_TRUE;
+		}
+	}
+
+	if (!moved && !keys_moved) {
+		return;
+	}
+
+	for (i = 0; i < header->num_symtabs; i++) {
+		offset = r->symtabs[i] & ~(uint64_t)CIL_SNAPSHOT_SYMTAB_KEYED;
+		if (offset > header->data_size - sizeof(struct cil_symtab) || (offset & 7) != 0) {
+			r->rc = SEPOL_ERR;
+			return;
+		}
+		if (moved || (r->symtabs[i] & CIL_SNAPSHOT_SYMTAB_KEYED)) {
+			cil_symtab_rehash((struct cil_symtab *)(r->data + offset));
+		}
+	}
+}
+
+/* Swap what cil_db_init() made for what the image holds */
+static void __cil_snapshot_get_db(struct cil_snapshot_reader *r, struct cil_db *db)
+{
+	struct cil_snapshot_db *rec = (struct cil_snapshot_db *)(r->data + r->header->db);
+	uint32_t i;
+
+	if (rec->root == NULL || rec->num_types < 0 || rec->num_roles < 0) {
+		r->rc = SEPOL_ERR;
+		return;
+	}
+	for (i = 0; i < CIL_SNAPSHOT_NUM_SORTS; i++) {
+		if (rec->sorts[i] == NULL) {
+			r->rc = SEPOL_ERR;
+			return;
+		}
+	}
+
+	cil_tree_node_destroy(&db->ast->root);
+	db->ast->root = rec->root;
+	cil_destroy_type(db->selftype);
+	db->selftype = rec->selftype;
+
+	db->sidorder = rec->sidorder;
+	db->classorder = rec->classorder;
+	db->catorder = rec->catorder;
+	db->sensitivityorder = rec->sensitivityorder;
+
+	for (i = 0; i < CIL_SNAPSHOT_NUM_SORTS; i++) {
+		cil_sort_destroy(&CIL_SNAPSHOT_SORT(db, i));
+		CIL_SNAPSHOT_SORT(db, i) = rec->sorts[i];
+	}
+
+	if (rec->userprefixes != NULL) {
+		cil_list_destroy(&db->userprefixes, CIL_FALSE);
+		db->userprefixes = rec->userprefixes;
+	}
+	if (rec->selinuxusers != NULL) {
+		cil_list_destroy(&db->selinuxusers, CIL_FALSE);
+		db->selinuxusers = rec->selinuxusers;
+	}
+	if (rec->names != NULL) {
+		cil_list_destroy(&db->names, CIL_FALSE);
+		db->names = rec->names;
+	}
+
+	db->num_cats = rec->num_cats;
+	db->num_types = rec->num_types;
+	db->num_roles = rec->num_roles;
+	if (rec->val_to_type != NULL) {
+		db->val_to_type = cil_malloc(sizeof(*db->val_to_type) * db->num_types);
+		memcpy(db->val_to_type, rec->val_to_type, sizeof(*db->val_to_type) * db->num_types);
+	}
+	if (rec->val_to_role != NULL) {
+		db->val_to_role = cil_malloc(sizeof(*db->val_to_role) * db->num_roles);
+		memcpy(db->val_to_role, rec->val_to_role, sizeof(*db->val_to_role) * db->num_roles);
+	}
+
+	db->disable_dontaudit = rec->disable_dontaudit;
+	db->disable_neverallow = rec->disable_neverallow;
+	db->preserve_tunables = rec->preserve_tunables;
+	db->handle_unknown = rec->handle_unknown;
+	db->mls = rec->mls;
+
+	/* The lists of the index are borrowed from the image */
+	cil_index_init(&db->index);
+	if (rec->indexed) {
+		db->index->count = rec->index_count;
+		memcpy(db->index->lists, rec->index, sizeof(rec->index));
+	} else if (cil_index_build(db->index, db->ast->root) != SEPOL_OK) {
+		r->rc = SEPOL_ERR;
+	}
+}
+
+static int __cil_snapshot_read(int fd, const struct cil_snapshot_header *header, const char *tables, struct cil_db *db)
+{
+	struct cil_snapshot_reader r;
+	uint64_t keys_sum;
+	uintptr_t keys_base;
+	uint32_t i;
+
+	memset(&r, 0, sizeof(r));
+	r.rc = SEPOL_ERR;
+	r.header = header;
+	r.locs = (const struct cil_snapshot_loc *)tables;
+	r.strs = (const struct cil_snapshot_string *)(r.locs + header->num_locs);
+	r.symtabs = (const uint64_t *)(r.strs + header->num_strings);
+	r.refs = r.symtabs + header->num_symtabs;
+	r.relocs = r.refs + header->num_refs;
+	keys_base = cil_strpool_static(&keys_sum);
+	r.keys_same = (keys_sum == header->keys_sum);
+	r.keys_moved = (keys_base != header->keys_base || !r.keys_same);
+	r.keys_delta = keys_base - header->keys_base;
+
+	r.data = __cil_snapshot_map_data(fd, header);
+	if (r.data == NULL) {
+		goto exit;
+	}
+	if (cil_arena_add_image(r.data, header->data_size) != SEPOL_OK) {
+		munmap(r.data, header->data_size);
+		goto exit;
+	}
+
+	r.strings = mmap((void *)(uintptr_t)header->strings_base, header->strings_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, header->strings_offset);
+	if (r.strings == MAP_FAILED) {
+		goto exit;
+	}
+	r.lazy = cil_strpool_image_add(r.strings, header->strings_size);
+	if (r.lazy < 0) {
+		munmap(r.strings, header->strings_size);
+		goto exit;
+	}
+
+	r.blocks = cil_malloc(sizeof(*r.blocks) * header->nodes_count);
+	if (cil_arena_map_nodes(fd, header->nodes_offset, header->nodes_first, header->nodes_count, r.blocks) != SEPOL_OK) {
+		goto exit;
+	}
+
+	r.rc = SEPOL_OK;
+	__cil_snapshot_relocate(&r);
+	if (r.rc == SEPOL_OK) {
+		__cil_snapshot_intern(&r);
+	}
+	if (r.rc == SEPOL_OK) {
+		__cil_snapshot_get_db(&r, db);
+	}
+
+	/* Source locations are handed out again in the order they were
+	 * saved, so they get the same bases */
+	for (i = 0; i < header->num_locs && r.rc == SEPOL_OK; i++) {
+		const struct cil_snapshot_loc *loc = &r.locs[i];
+		char *path;
+		if (loc->path == 0 || loc->path > header->num_strings || loc->count == 0) {
+			r.rc = SEPOL_ERR;
+			break;
+		}
+		path = __cil_snapshot_string(&r, loc->path - 1);
+		if (path == NULL || cil_tree_loc_add(path, loc->first, loc->first + loc->count - 1) != loc->base) {
+			r.rc = SEPOL_ERR;
+		}
+	}
+
+	if (r.rc == SEPOL_OK) {
+		db->compiled_tail = cil_tree_node_tail(db->ast->root);
+	}
+
+exit:
+	/* What was mapped belongs to the arena and the strpool by now, and
+	 * goes away with the db */
+	free(r.blocks);
+
+	return r.rc;
+}
+
+/* Load the image at path into a new database, which is ready for
+ * cil_build_policydb() or for compiling further modules into */
+int cil_snapshot_load(struct cil_db **db, const char *path)
+{
+	int rc = SEPOL_ERR;
+	struct cil_snapshot_header header;
+	struct cil_db_thread prev;
+	struct cil_db *new_db = NULL;
+	struct stat filedata;
+	char *tables = MAP_FAILED;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd == -1) {
+		cil_log(CIL_ERR, "Could not open snapshot %s\n", path);
+		return SEPOL_ERR;
+	}
+
+	if (fstat(fd, &filedata) != 0 || pread(fd, &header, sizeof(header), 0) != sizeof(header) ||
+		__cil_snapshot_check(&header, filedata.st_size) != SEPOL_OK) {
+		goto exit;
+	}
+
+	tables = mmap(NULL, header.tables_size, PROT_READ, MAP_PRIVATE, fd, header.tables_offset);
+	if (tables == MAP_FAILED) {
+		goto exit;
+	}
+
+	if (__cil_snapshot_verify(&header, tables) != SEPOL_OK) {
+		goto exit;
+	}
+
+	cil_db_init(&new_db);
+	cil_db_enter(new_db, &prev);
+	rc = __cil_snapshot_read(fd, &header, tables, new_db);
+	cil_db_leave(&prev);
+
+exit:
+	if (rc != SEPOL_OK) {
+		cil_log(CIL_ERR, "Snapshot %s is not valid\n", path);
+		cil_db_destroy(&new_db);
+	}
+	if (tables != MAP_FAILED) {
+		munmap(tables, header.tables_size);
+	}
+	close(fd);
+
+	*db = new_db;
+
+	return rc;
+}
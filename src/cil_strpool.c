@@ -27,78 +27,687 @@
  * either expressed or implied, of Tresys Technology, LLC.
  */
 
+/*
+ * String interner.
+ *
+ * Every string is stored once, in an entry that holds its hash and length
+ * ahead of its bytes. The pool is split into shards chosen by the top bits
+ * of the hash, each with its own lock, pages and table, so that threads
+ * interning different strings rarely wait on each other. Entries are packed
+ * into large pages, and a table of (hash, entry) slots using Robin Hood open
+ * addressing finds them. A shard's table doubles once it is 7/8 full.
+ *
+ * A string that is already interned is found without taking the lock.
+ * Entries never change once placed and are published with release stores,
+ * and a table that was grown out of is kept until the pool is destroyed, so
+ * a search that runs alongside an insert can only miss. Only then is the
+ * shard locked, to search again and add the string.
+ *
+ * Statement keywords and the other keys interned by cil_init_keys() live in
+ * a separate static block with the same entry layout, so that
+ * cil_strpool_keyword() can tell keywords apart from any other string with a
+ * range check. The block is a static array filled in the same order every
+ * time, so a key sits at the same offset in every process running the same
+ * build, and only the address of the block itself can differ.
+ *
+ * A snapshot image brings its own strings, laid out as entries with an index
+ * over them (see cil_strpool_image_write()). The pool owns the memory of the
+ * images added to it. When it holds nothing but keys at the time, an image
+ * is searched after the shards and its entries are moved into them as they
+ * are asked for, so its strings are interned without being visited;
+ * otherwise each of them has to be passed to cil_strpool_image_adopt().
+ *
+ * Dotted names are split into interned segments the first time name
+ * resolution asks for them, and the split is kept with the entry.
+ */
+
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sepol/errcodes.h>
 #include "cil_mem.h"
 #include "cil_strpool.h"
 
 #include "cil_log.h"
-#define CIL_STRPOOL_TABLE_SIZE 1 << 15
+
+#define CIL_STRPOOL_SHARD_BITS		6
+#define CIL_STRPOOL_SHARDS		(1 << CIL_STRPOOL_SHARD_BITS)
+#define CIL_STRPOOL_INITIAL_SLOTS	(1 << 8)
+#define CIL_STRPOOL_PAGE_SIZE		(64 * 1024)
+#define CIL_STRPOOL_KEYWORDS_SIZE	8192
+#define CIL_STRPOOL_SUM_INIT		UINT64_C(14695981039346656037)
 
 struct cil_strpool_entry {
-	char *str;
+	uint64_t hash;
+	uint32_t len;
+	uint32_t keyword;
+	struct cil_strpool_name *name;	/* NULL until it is split */
+	char str[];
 };
 
-static hashtab_t cil_strpool_tab = NULL;
+struct cil_strpool_slot {
+	uint64_t hash;
+	struct cil_strpool_entry *entry;	/* NULL if the slot is empty */
+};
 
-static unsigned int cil_strpool_hash(hashtab_t h, hashtab_key_t key)
-{
-	char *p, *keyp;
+struct cil_strpool_table {
+	struct cil_strpool_table *old;	/* the table this one replaced */
+	uint32_t mask;
+	struct cil_strpool_slot slots[];
+};
+
+struct cil_strpool_page {
+	struct cil_strpool_page *next;
+	size_t used;
+	size_t size;
+	char data[];
+};
+
+/* Aligned so that shards used by different threads never share a cache
+ * line */
+struct cil_strpool_shard {
+	pthread_mutex_t mutex;
+	struct cil_strpool_table *table;
+	uint32_t count;
+	struct cil_strpool_page *pages;
+} __attribute__ ((aligned(64)));
+
+static struct cil_strpool_shard cil_strpool_shards[CIL_STRPOOL_SHARDS];
+
+static pthread_mutex_t cil_strpool_keywords_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char cil_strpool_keywords[CIL_STRPOOL_KEYWORDS_SIZE] __attribute__ ((aligned(8)));
+static size_t cil_strpool_keywords_used = 0;
+static uint64_t cil_strpool_keywords_sum = CIL_STRPOOL_SUM_INIT;
+static uint32_t cil_strpool_keywords_count = 0;
+
+/* The start of an image of strings, followed by its entries and then by
+ * an open addressing table of mask + 1 entry offsets, 0 meaning empty */
+struct cil_strpool_image {
+	uint32_t count;
+	uint32_t mask;
+	uint64_t index;
+};
+
+struct cil_strpool_mapping {
+	struct cil_strpool_mapping *next;
+	char *data;
 	size_t size;
-	unsigned int val;
+};
+
+static pthread_mutex_t cil_strpool_images_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct cil_strpool_mapping *cil_strpool_images;
+static struct cil_strpool_image *cil_strpool_lazy;
+
+#define CIL_STRPOOL_P0	0xa0761d6478bd642fULL
+#define CIL_STRPOOL_P1	0xe7037ed1a0b428dbULL
+#define CIL_STRPOOL_P2	0x8ebc6af09c88c6e3ULL
+
+/* Folds the 128 bit product of a and b into 64 bits */
+static uint64_t cil_strpool_mix(uint64_t a, uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+	__uint128_t r = (__uint128_t)a * b;
+
+	return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+	/* The same product out of 32x32 bit partial products, for targets
+	 * without a 128 bit integer type */
+	uint64_t a_lo = (uint32_t)a;
+	uint64_t a_hi = a >> 32;
+	uint64_t b_lo = (uint32_t)b;
+	uint64_t b_hi = b >> 32;
+	uint64_t lo_lo = a_lo * b_lo;
+	uint64_t hi_lo = a_hi * b_lo;
+	uint64_t lo_hi = a_lo * b_hi;
+	uint64_t hi_hi = a_hi * b_hi;
+	uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+	uint64_t lo = (cross << 32) | (uint32_t)lo_lo;
+	uint64_t hi = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+
+	return lo ^ hi;
+#endif
+}
+
+static uint64_t cil_strpool_read64(const char *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+/* A multiply-mix hash in the style of wyhash, 16 bytes per round */
+static uint64_t cil_strpool_hash_bytes(const char *str, size_t len)
+{
+	uint64_t seed = CIL_STRPOOL_P0 ^ len;
+	uint64_t a = 0;
+	uint64_t b = 0;
+	char tail[16];
+	size_t left = len;
+	const char *p = str;
+
+	while (left > 16) {
+		seed = cil_strpool_mix(cil_strpool_read64(p) ^ CIL_STRPOOL_P1, cil_strpool_read64(p + 8) ^ seed);
+		p += 16;
+		left -= 16;
+	}
+
+	memset(tail, 0, sizeof(tail));
+	memcpy(tail, p, left);
+	a = cil_strpool_read64(tail);
+	b = cil_strpool_read64(tail + 8);
+
+	return cil_strpool_mix(CIL_STRPOOL_P2 ^ len, cil_strpool_mix(a ^ CIL_STRPOOL_P1, b ^ seed));
+}
+
+static struct cil_strpool_entry *cil_strpool_entry(const char *str)
+{
+	return (struct cil_strpool_entry *)(str - offsetof(struct cil_strpool_entry, str));
+}
+
+static void cil_strpool_slot_set(struct cil_strpool_slot *slot, uint64_t hash, struct cil_strpool_entry *entry)
+{
+	__atomic_store_n(&slot->hash, hash, __ATOMIC_RELAXED);
+	__atomic_store_n(&slot->entry, entry, __ATOMIC_RELEASE);
+}
+
+/* Place an entry in a table, which must have room for it. Entries that are
+ * closer to their home slot give way to the one being placed. */
+static void cil_strpool_insert(struct cil_strpool_table *table, uint64_t hash, struct cil_strpool_entry *entry)
+{
+	struct cil_strpool_slot carry;
+	struct cil_strpool_slot tmp;
+	uint32_t pos = hash & table->mask;
+	uint32_t dist = 0;
+	uint32_t slot_dist;
+
+	carry.hash = hash;
+	carry.entry = entry;
+
+	while (table->slots[pos].entry != NULL) {
+		slot_dist = (pos - (uint32_t)table->slots[pos].hash) & table->mask;
+		if (slot_dist < dist) {
+			tmp = table->slots[pos];
+			cil_strpool_slot_set(&table->slots[pos], carry.hash, carry.entry);
+			carry = tmp;
+			dist = slot_dist;
+		}
+		pos = (pos + 1) & table->mask;
+		dist++;
+	}
+
+	cil_strpool_slot_set(&table->slots[pos], carry.hash, carry.entry);
+}
+
+/* Replace the shard's table with one of num_slots slots. Searches without
+ * the lock may still be reading the old one, so it is kept. */
+static void cil_strpool_resize(struct cil_strpool_shard *shard, uint32_t num_slots)
+{
+	struct cil_strpool_table *old = shard->table;
+	struct cil_strpool_table *table = NULL;
+	uint32_t i;
+
+	table = cil_calloc(1, sizeof(*table) + sizeof(*table->slots) * num_slots);
+	table->old = old;
+	table->mask = num_slots - 1;
+
+	for (i = 0; old != NULL && i <= old->mask; i++) {
+		if (old->slots[i].entry != NULL) {
+			cil_strpool_insert(table, old->slots[i].hash, old->slots[i].entry);
+		}
+	}
+
+	__atomic_store_n(&shard->table, table, __ATOMIC_RELEASE);
+}
+
+/* Add an entry to the shard's table, growing it first if need be */
+static void cil_strpool_place(struct cil_strpool_shard *shard, struct cil_strpool_entry *entry)
+{
+	if (shard->count + 1 > (shard->table->mask + 1) / 8 * 7) {
+		cil_strpool_resize(shard, (shard->table->mask + 1) * 2);
+	}
+	cil_strpool_insert(shard->table, entry->hash, entry);
+	shard->count++;
+}
+
+/* Search the shard's table, with or without its lock */
+static struct cil_strpool_entry *cil_strpool_search(struct cil_strpool_shard *shard, const char *str, size_t len, uint64_t hash)
+{
+	struct cil_strpool_table *table = __atomic_load_n(&shard->table, __ATOMIC_ACQUIRE);
+	struct cil_strpool_entry *entry = NULL;
+	uint32_t pos = hash & table->mask;
+	uint32_t dist = 0;
+	uint64_t slot_hash;
+
+	while (1) {
+		entry = __atomic_load_n(&table->slots[pos].entry, __ATOMIC_ACQUIRE);
+		slot_hash = __atomic_load_n(&table->slots[pos].hash, __ATOMIC_RELAXED);
+		if (entry == NULL || ((pos - (uint32_t)slot_hash) & table->mask) < dist) {
+			/* An entry for str would have been placed before this one */
+			return NULL;
+		}
+		/* The slot may be changing, so the entry is checked on its own */
+		if (entry->hash == hash && entry->len == len && memcmp(entry->str, str, len) == 0) {
+			return entry;
+		}
+		pos = (pos + 1) & table->mask;
+		dist++;
+	}
+}
+
+static void *cil_strpool_alloc(struct cil_strpool_shard *shard, size_t size)
+{
+	struct cil_strpool_page *page = shard->pages;
+	void *data = NULL;
+
+	size = (size + 7) & ~(size_t)7;
+
+	if (page == NULL || page->size - page->used < size) {
+		size_t page_size = size > CIL_STRPOOL_PAGE_SIZE ? size : CIL_STRPOOL_PAGE_SIZE;
+		page = cil_malloc(sizeof(*page) + page_size);
+		page->size = page_size;
+		page->used = 0;
+		page->next = shard->pages;
+		shard->pages = page;
+	}
+
+	data = page->data + page->used;
+	page->used += size;
+
+	return data;
+}
+
+static struct cil_strpool_entry *cil_strpool_entry_alloc(struct cil_strpool_shard *shard, size_t len)
+{
+	return cil_strpool_alloc(shard, sizeof(struct cil_strpool_entry) + len + 1);
+}
+
+static struct cil_strpool_entry *cil_strpool_keyword_alloc(const char *str, size_t len, uint32_t keyword)
+{
+	size_t size = (sizeof(struct cil_strpool_entry) + len + 1 + 7) & ~(size_t)7;
+	struct cil_strpool_entry *entry = NULL;
+	uint64_t sum;
+	size_t i;
+
+	pthread_mutex_lock(&cil_strpool_keywords_mutex);
+	if (cil_strpool_keywords_used + size > CIL_STRPOOL_KEYWORDS_SIZE) {
+		pthread_mutex_unlock(&cil_strpool_keywords_mutex);
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+	entry = (struct cil_strpool_entry *)(cil_strpool_keywords + cil_strpool_keywords_used);
+	cil_strpool_keywords_used += size;
+
+	/* Two blocks with the same sum hold the same keys at the same offsets */
+	sum = cil_strpool_keywords_sum ^ keyword;
+	for (i = 0; i <= len; i++) {
+		sum = (sum ^ (unsigned char)(i < len ? str[i] : 0)) * UINT64_C(1099511628211);
+	}
+	cil_strpool_keywords_sum = sum;
+	cil_strpool_keywords_count++;
+	pthread_mutex_unlock(&cil_strpool_keywords_mutex);
+
+	return entry;
+}
+
+/* Search the shard and then the image being interned lazily, moving an
+ * entry found there into the shard. Called with the shard locked. */
+static struct cil_strpool_entry *cil_strpool_find(struct cil_strpool_shard *shard, const char *str, size_t len, uint64_t hash)
+{
+	struct cil_strpool_entry *entry = cil_strpool_search(shard, str, len, hash);
+	struct cil_strpool_image *image = __atomic_load_n(&cil_strpool_lazy, __ATOMIC_ACQUIRE);
+	const uint32_t *index = NULL;
+	uint32_t pos;
+
+	if (entry != NULL || image == NULL) {
+		return entry;
+	}
+
+	index = (const uint32_t *)((char *)image + image->index);
+	for (pos = hash & image->mask; index[pos] != 0; pos = (pos + 1) & image->mask) {
+		entry = (struct cil_strpool_entry *)((char *)image + index[pos]);
+		if (entry->hash == hash && entry->len == len && memcmp(entry->str, str, len) == 0) {
+			cil_strpool_place(shard, entry);
+			return entry;
+		}
+	}
 
-	val = 0;
-	keyp = (char*)key;
-	size = strlen(keyp);
-	for (p = keyp; ((size_t) (p - keyp)) < size; p++)
-		val =
-		    (val << 4 | (val >> (8 * sizeof(unsigned int) - 4))) ^ (*p);
-	return val & (h->size - 1);
+	return NULL;
 }
 
-static int cil_strpool_compare(hashtab_t h __attribute__ ((unused)), hashtab_key_t key1, hashtab_key_t key2)
+static char *cil_strpool_add_entry(const char *str, uint32_t len, uint32_t keyword, int is_static)
 {
-	char *keyp1 = (char*)key1;
-	char *keyp2 = (char*)key2;
-	return strcmp(keyp1, keyp2);
+	struct cil_strpool_entry *entry = NULL;
+	uint64_t hash = cil_strpool_hash_bytes(str, len);
+	struct cil_strpool_shard *shard = &cil_strpool_shards[hash >> (64 - CIL_STRPOOL_SHARD_BITS)];
+
+	entry = cil_strpool_search(shard, str, len, hash);
+	if (entry != NULL) {
+		return entry->str;
+	}
+
+	pthread_mutex_lock(&shard->mutex);
+
+	entry = cil_strpool_find(shard, str, len, hash);
+	if (entry == NULL) {
+		if (is_static) {
+			entry = cil_strpool_keyword_alloc(str, len, keyword);
+		} else {
+			entry = cil_strpool_entry_alloc(shard, len);
+		}
+
+		entry->hash = hash;
+		entry->len = len;
+		entry->keyword = keyword;
+		entry->name = NULL;
+		memcpy(entry->str, str, len);
+		entry->str[len] = '\0';
+
+		cil_strpool_place(shard, entry);
+	}
+
+	pthread_mutex_unlock(&shard->mutex);
+
+	return entry->str;
 }
 
 char *cil_strpool_add(const char *str)
 {
-	struct cil_strpool_entry *strpool_ref = NULL;
+	size_t len = strlen(str);
+
+	if (len > UINT32_MAX) {
+		(*CIL_MEM_ERROR_HANDLER)();
+	}
+
+	return cil_strpool_add_entry(str, len, 0, 0);
+}
+
+/* Intern the first len bytes of str, which need not be NUL-terminated */
+char *cil_strpool_add_len(const char *str, uint32_t len)
+{
+	return cil_strpool_add_entry(str, len, 0, 0);
+}
+
+/* Intern str as keyword. Keywords must be added before the same string is
+ * interned by cil_strpool_add(), which cil_init_keys() takes care of. */
+char *cil_strpool_add_keyword(const char *str, uint32_t keyword)
+{
+	return cil_strpool_add_entry(str, strlen(str), keyword, 1);
+}
+
+/* Intern str in the static block without making it a keyword, under the
+ * same rule as cil_strpool_add_keyword() */
+char *cil_strpool_add_key(const char *str)
+{
+	return cil_strpool_add_entry(str, strlen(str), 0, 1);
+}
+
+/* Returns the keyword id of an interned string, or 0 if it is not a
+ * keyword */
+uint32_t cil_strpool_keyword(const char *str)
+{
+	uintptr_t addr = (uintptr_t)str;
+	uintptr_t start = (uintptr_t)cil_strpool_keywords;
+
+	if (addr < start + offsetof(struct cil_strpool_entry, str) || addr >= start + cil_strpool_keywords_used) {
+		return 0;
+	}
+
+	return cil_strpool_entry(str)->keyword;
+}
+
+/* Returns whether an interned string is in the static block */
+int cil_strpool_is_static(const char *str)
+{
+	uintptr_t addr = (uintptr_t)str;
+	uintptr_t start = (uintptr_t)cil_strpool_keywords;
+
+	return addr >= start + offsetof(struct cil_strpool_entry, str) && addr < start + cil_strpool_keywords_used;
+}
+
+/* The address of the static block and a sum of the keys in it */
+uintptr_t cil_strpool_static(uint64_t *sum)
+{
+	*sum = cil_strpool_keywords_sum;
+
+	return (uintptr_t)cil_strpool_keywords;
+}
+
+/* The hash and length stored with an interned string, for tables keyed by
+ * interned strings that want to avoid hashing them again. str must have
+ * been returned by cil_strpool_add(). */
+uint64_t cil_strpool_hash(const char *str)
+{
+	return cil_strpool_entry(str)->hash;
+}
+
+uint32_t cil_strpool_len(const char *str)
+{
+	return cil_strpool_entry(str)->len;
+}
+
+/* The interned segments of an interned name, split on dots the way
+ * strtok_r() would, so empty segments are dropped. They are worked out the
+ * first time and kept in the pool. Once published a split is never changed,
+ * so later calls read it without taking the shard lock. */
+const struct cil_strpool_name *cil_strpool_name(const char *str)
+{
+	struct cil_strpool_entry *entry = cil_strpool_entry(str);
+	struct cil_strpool_shard *shard = &cil_strpool_shards[entry->hash >> (64 - CIL_STRPOOL_SHARD_BITS)];
+	struct cil_strpool_name *name = NULL;
+	char **segments = NULL;
+	char *dup = NULL;
+	char *sp = NULL;
+	char *segment = NULL;
+	uint32_t count = 0;
 
-	strpool_ref = hashtab_search(cil_strpool_tab, (hashtab_key_t)str);
-	if (strpool_ref == NULL) {
-		strpool_ref = cil_malloc(sizeof(*strpool_ref));
-		strpool_ref->str = cil_strdup(str);
-		int rc = hashtab_insert(cil_strpool_tab, (hashtab_key_t)strpool_ref->str, strpool_ref);
-		if (rc != SEPOL_OK) {
-			(*cil_mem_error_handler)();
+	name = __atomic_load_n(&entry->name, __ATOMIC_ACQUIRE);
+	if (name != NULL) {
+		return name;
+	}
+
+	/* Interning the segments takes the locks of other shards */
+	segments = cil_malloc(sizeof(*segments) * (entry->len / 2 + 1));
+	dup = cil_strdup(str);
+	for (segment = strtok_r(dup, ".", &sp); segment != NULL; segment = strtok_r(NULL, ".", &sp)) {
+		segments[count++] = cil_strpool_add(segment);
+	}
+	free(dup);
+
+	pthread_mutex_lock(&shard->mutex);
+	if (entry->name == NULL) {
+		name = cil_strpool_alloc(shard, sizeof(*name) + sizeof(*segments) * count);
+		name->count = count;
+		name->leading_dot = (str[0] == '.');
+		memcpy(name->segments, segments, sizeof(*segments) * count);
+		__atomic_store_n(&entry->name, name, __ATOMIC_RELEASE);
+	}
+	name = entry->name;
+	pthread_mutex_unlock(&shard->mutex);
+
+	free(segments);
+
+	return name;
+}
+
+/* The size of an image of the count strings in strs */
+size_t cil_strpool_image_size(char **strs, uint32_t count)
+{
+	size_t size = sizeof(struct cil_strpool_image);
+	uint32_t slots = 1;
+	uint32_t i;
+
+	for (i = 0; i < count; i++) {
+		size += (sizeof(struct cil_strpool_entry) + cil_strpool_len(strs[i]) + 1 + 7) & ~(size_t)7;
+	}
+	while (slots < count * 2) {
+		slots <<= 1;
+	}
+
+	return size + sizeof(uint32_t) * slots;
+}
+
+/* Lay the strings out in buf, which must hold cil_strpool_image_size()
+ * bytes, and set offsets[i] to the offset of the copy of strs[i]. Strings of
+ * the static block are copied but left out of the index. */
+void cil_strpool_image_write(char *buf, char **strs, uint32_t count, uint64_t *offsets)
+{
+	struct cil_strpool_image *image = (struct cil_strpool_image *)buf;
+	struct cil_strpool_entry *entry = NULL;
+	uint32_t *index = NULL;
+	size_t used = sizeof(*image);
+	uint32_t slots = 1;
+	uint32_t pos;
+	uint32_t i;
+
+	while (slots < count * 2) {
+		slots <<= 1;
+	}
+
+	for (i = 0; i < count; i++) {
+		uint32_t len = cil_strpool_len(strs[i]);
+		entry = (struct cil_strpool_entry *)(buf + used);
+		entry->hash = cil_strpool_hash(strs[i]);
+		entry->len = len;
+		entry->keyword = 0;
+		entry->name = NULL;
+		memcpy(entry->str, strs[i], len + 1);
+		offsets[i] = used + offsetof(struct cil_strpool_entry, str);
+		used += (sizeof(*entry) + len + 1 + 7) & ~(size_t)7;
+	}
+
+	image->count = count;
+	image->mask = slots - 1;
+	image->index = used;
+	index = (uint32_t *)(buf + used);
+	memset(index, 0, sizeof(*index) * slots);
+
+	for (i = 0; i < count; i++) {
+		if (cil_strpool_is_static(strs[i])) {
+			continue;
 		}
+		entry = cil_strpool_entry(buf + offsets[i]);
+		for (pos = entry->hash & image->mask; index[pos] != 0; pos = (pos + 1) & image->mask);
+		index[pos] = offsets[i] - offsetof(struct cil_strpool_entry, str);
+	}
+}
+
+/* Hand the image of size bytes at data over to the pool, which unmaps it
+ * when it is destroyed. Returns 1 if the pool held nothing but keys, in
+ * which case the strings of the image are interned as they are, -1 if the
+ * image is not well formed and 0 if each string must be passed to
+ * cil_strpool_image_adopt(). */
+int cil_strpool_image_add(char *data, size_t size)
+{
+	struct cil_strpool_image *image = (struct cil_strpool_image *)data;
+	struct cil_strpool_mapping *mapping = NULL;
+	uint32_t count = 0;
+	int lazy;
+	int i;
+
+	if (size < sizeof(*image) || ((uint64_t)image->mask + 1) & image->mask || image->count > image->mask ||
+		image->index > size || (size - image->index) / sizeof(uint32_t) < (uint64_t)image->mask + 1) {
+		return -1;
+	}
+
+	mapping = cil_malloc(sizeof(*mapping));
+	mapping->data = data;
+	mapping->size = size;
+
+	/* No string can be interned while the pool is looked at */
+	for (i = 0; i < CIL_STRPOOL_SHARDS; i++) {
+		pthread_mutex_lock(&cil_strpool_shards[i].mutex);
+		count += cil_strpool_shards[i].count;
+	}
+	pthread_mutex_lock(&cil_strpool_images_mutex);
+
+	lazy = (count == cil_strpool_keywords_count && cil_strpool_lazy == NULL);
+	if (lazy) {
+		__atomic_store_n(&cil_strpool_lazy, image, __ATOMIC_RELEASE);
+	}
+	mapping->next = cil_strpool_images;
+	cil_strpool_images = mapping;
+
+	pthread_mutex_unlock(&cil_strpool_images_mutex);
+	for (i = CIL_STRPOOL_SHARDS - 1; i >= 0; i--) {
+		pthread_mutex_unlock(&cil_strpool_shards[i].mutex);
 	}
 
-	return strpool_ref->str;
+	return lazy;
 }
 
-static int cil_strpool_entry_destroy(hashtab_key_t k __attribute__ ((unused)), hashtab_datum_t d, void *args __attribute__ ((unused)))
+/* Intern a string of an image added to the pool. Returns the copy that was
+ * already interned, if there is one, or else str itself. */
+char *cil_strpool_image_adopt(char *str)
 {
-	struct cil_strpool_entry *strpool_ref = (struct cil_strpool_entry*)d;
-	free(strpool_ref->str);
-	free(strpool_ref);
-	return SEPOL_OK;
+	struct cil_strpool_entry *entry = cil_strpool_entry(str);
+	struct cil_strpool_entry *found = NULL;
+	struct cil_strpool_shard *shard = &cil_strpool_shards[entry->hash >> (64 - CIL_STRPOOL_SHARD_BITS)];
+
+	pthread_mutex_lock(&shard->mutex);
+	found = cil_strpool_find(shard, str, entry->len, entry->hash);
+	if (found == NULL) {
+		cil_strpool_place(shard, entry);
+		found = entry;
+	}
+	pthread_mutex_unlock(&shard->mutex);
+
+	return found->str;
 }
 
 void cil_strpool_init(void)
 {
-	cil_strpool_tab = hashtab_create(cil_strpool_hash, cil_strpool_compare, CIL_STRPOOL_TABLE_SIZE);
-	if (cil_strpool_tab == NULL) {
-		(*cil_mem_error_handler)();
+	struct cil_strpool_shard *shard = NULL;
+	int i;
+
+	cil_strpool_keywords_used = 0;
+	cil_strpool_keywords_sum = CIL_STRPOOL_SUM_INIT;
+	cil_strpool_keywords_count = 0;
+
+	for (i = 0; i < CIL_STRPOOL_SHARDS; i++) {
+		shard = &cil_strpool_shards[i];
+		pthread_mutex_init(&shard->mutex, NULL);
+		shard->table = NULL;
+		shard->count = 0;
+		shard->pages = NULL;
+		cil_strpool_resize(shard, CIL_STRPOOL_INITIAL_SLOTS);
 	}
 }
 
 void cil_strpool_destroy(void)
 {
-	hashtab_map(cil_strpool_tab, cil_strpool_entry_destroy, NULL);
-	hashtab_destroy(cil_strpool_tab);
+	struct cil_strpool_shard *shard = NULL;
+	struct cil_strpool_page *page = NULL;
+	struct cil_strpool_page *next = NULL;
+	struct cil_strpool_mapping *mapping = NULL;
+	struct cil_strpool_table *table = NULL;
+	int i;
+
+	for (i = 0; i < CIL_STRPOOL_SHARDS; i++) {
+		shard = &cil_strpool_shards[i];
+		for (page = shard->pages; page != NULL; page = next) {
+			next = page->next;
+			free(page);
+		}
+		while (shard->table != NULL) {
+			table = shard->table;
+			shard->table = table->old;
+			free(table);
+		}
+		shard->count = 0;
+		shard->pages = NULL;
+		pthread_mutex_destroy(&shard->mutex);
+	}
+
+	while (cil_strpool_images != NULL) {
+		mapping = cil_strpool_images;
+		cil_strpool_images = mapping->next;
+		munmap(mapping->data, mapping->size);
+		free(mapping);
+	}
+	cil_strpool_lazy = NULL;
 }
@@ -30,9 +30,30 @@
 #ifndef CIL_STRPOOL_H_
 #define CIL_STRPOOL_H_
 
-#include <sepol/policydb/hashtab.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* The segments of a dotted name, without the dots */
+struct cil_strpool_name {
+	uint32_t count;
+	uint32_t leading_dot;
+	char *segments[];
+};
 
 char *cil_strpool_add(const char *str);
+char *cil_strpool_add_len(const char *str, uint32_t len);
+char *cil_strpool_add_keyword(const char *str, uint32_t keyword);
+char *cil_strpool_add_key(const char *str);
+uint32_t cil_strpool_keyword(const char *str);
+int cil_strpool_is_static(const char *str);
+uintptr_t cil_strpool_static(uint64_t *sum);
+uint64_t cil_strpool_hash(const char *str);
+uint32_t cil_strpool_len(const char *str);
+const struct cil_strpool_name *cil_strpool_name(const char *str);
+size_t cil_strpool_image_size(char **strs, uint32_t count);
+void cil_strpool_image_write(char *buf, char **strs, uint32_t count, uint64_t *offsets);
+int cil_strpool_image_add(char *data, size_t size);
+char *cil_strpool_image_adopt(char *str);
 void cil_strpool_init(void);
 void cil_strpool_destroy(void);
 #endif /* CIL_STRPOOL_H_ */
@@ -33,9 +33,9 @@
 
 #include <sepol/errcodes.h>
 #include <sepol/policydb/hashtab.h>
-#include <sepol/policydb/symtab.h>
 
 #include "cil_internal.h"
+#include "cil_arena.h"
 #include "cil_tree.h"
 #include "cil_symtab.h"
 #include "cil_mem.h"
@@ -51,12 +51,105 @@ __attribute__((noreturn)) __attribute__((format (printf, 1, 2))) void cil_symtab
 	exit(1);
 }
 
-void cil_symtab_init(symtab_t *symtab, unsigned int size)
+#define CIL_SYMTAB_MIN_SLOTS 8
+
+static void __cil_symtab_size(struct cil_symtab *symtab, uint32_t nslots)
+{
+	uint32_t bits = 0;
+
+	while ((UINT32_C(1) << bits) < nslots) {
+		bits++;
+	}
+
+	symtab->mask = (UINT32_C(1) << bits) - 1;
+	symtab->shift = 64 - bits;
+}
+
+/* The slots and order arrays come from the arena, so a db's symtabs need
+ * not be destroyed one by one. */
+static void __cil_symtab_alloc(struct cil_symtab *symtab)
+{
+	symtab->slots = cil_arena_alloc(sizeof(*symtab->slots) * (symtab->mask + 1));
+	memset(symtab->slots, 0, sizeof(*symtab->slots) * (symtab->mask + 1));
+	symtab->order = cil_arena_alloc(sizeof(*symtab->order) * CIL_SYMTAB_LIMIT(symtab));
+	symtab->nelems = 0;
+	symtab->norder = 0;
+}
+
+static struct cil_symtab_slot *__cil_symtab_search(struct cil_symtab *symtab, char *key)
+{
+	uint32_t i;
+
+	if (symtab->slots == NULL) {
+		return NULL;
+	}
+
+	i = CIL_SYMTAB_HASH(symtab, key);
+
+	for (;;) {
+		struct cil_symtab_slot *slot = &symtab->slots[i];
+		if (slot->key == key) {
+			return slot;
+		} else if (slot->key == NULL) {
+			return NULL;
+		}
+		i = (i + 1) & symtab->mask;
+	}
+}
+
+static void __cil_symtab_add(struct cil_symtab *symtab, char *key, struct cil_symtab_datum *datum)
 {
-	int rc = symtab_init(symtab, size);
-	if (rc != SEPOL_OK) {
-		cil_symtab_error("Failed to create symtab\n");
+	uint32_t i = CIL_SYMTAB_HASH(symtab, key);
+
+	while (symtab->slots[i].key != NULL) {
+		i = (i + 1) & symtab->mask;
 	}
+
+	symtab->slots[i].key = key;
+	symtab->slots[i].datum = datum;
+	symtab->slots[i].order = symtab->norder;
+	symtab->order[symtab->norder++] = datum;
+	symtab->nelems++;
+}
+
+/* Called when order[] is full. Doubles the table if it is at least half
+ * live, otherwise rebuilds it at the same size to squeeze out the holes
+ * left by removals. */
+static void __cil_symtab_grow(struct cil_symtab *symtab)
+{
+	struct cil_symtab_slot *slots = symtab->slots;
+	struct cil_symtab_datum **order = symtab->order;
+	uint32_t norder = symtab->norder;
+	uint32_t nslots = symtab->mask + 1;
+	uint32_t limit = CIL_SYMTAB_LIMIT(symtab);
+	uint32_t i;
+
+	if (symtab->nelems >= norder / 2) {
+		__cil_symtab_size(symtab, (symtab->mask + 1) << 1);
+	}
+
+	__cil_symtab_alloc(symtab);
+
+	for (i = 0; i < norder; i++) {
+		if (order[i] != NULL) {
+			__cil_symtab_add(symtab, order[i]->name, order[i]);
+		}
+	}
+
+	cil_arena_release(slots, sizeof(*slots) * nslots);
+	cil_arena_release(order, sizeof(*order) * limit);
+}
+
+/* Only records the initial size. The slots are allocated by the first
+ * insert, so the many scopes that never declare a symbol of some kind
+ * pay for nothing but the struct itself. */
+void cil_symtab_init(struct cil_symtab *symtab, unsigned int size)
+{
+	symtab->slots = NULL;
+	symtab->order = NULL;
+	symtab->nelems = 0;
+	symtab->norder = 0;
+	__cil_symtab_size(symtab, size < CIL_SYMTAB_MIN_SLOTS ? CIL_SYMTAB_MIN_SLOTS : size);
 }
 
 void cil_symtab_datum_init(struct cil_symtab_datum *datum)
@@ -64,20 +157,20 @@ void cil_symtab_datum_init(struct cil_symtab_datum *datum)
 	datum->name = NULL;
 	datum->fqn = NULL;
 	datum->symtab = NULL;
-	cil_list_init(&datum->nodes, CIL_LIST_ITEM);
+	cil_vector_init(&datum->nodes);
 }
 
 void cil_symtab_datum_destroy(struct cil_symtab_datum *datum)
 {
-	cil_list_destroy(&datum->nodes, 0);
+	cil_vector_destroy(&datum->nodes);
 	cil_symtab_remove_datum(datum);
 }
 
 void cil_symtab_datum_remove_node(struct cil_symtab_datum *datum, struct cil_tree_node *node)
 {
-	if (datum && datum->nodes != NULL) {
-		cil_list_remove(datum->nodes, CIL_NODE, node, 0);
-		if (datum->nodes->head == NULL) {
+	if (datum && datum->nodes.count > 0) {
+		cil_vector_remove(&datum->nodes, node);
+		if (datum->nodes.count == 0) {
 			cil_symtab_datum_destroy(datum);
 		}
 	}
@@ -85,50 +178,136 @@ void cil_symtab_datum_remove_node(struct cil_symtab_datum *datum, struct cil_tre
 
 /* This both initializes the datum and inserts it into the symtab.
    Note that cil_symtab_datum_destroy() is the analog to the initializer portion */
-int cil_symtab_insert(symtab_t *symtab, hashtab_key_t key, struct cil_symtab_datum *datum, struct cil_tree_node *node)
+int cil_symtab_insert(struct cil_symtab *symtab, hashtab_key_t key, struct cil_symtab_datum *datum, struct cil_tree_node *node)
 {
-	int rc = hashtab_insert(symtab->table, key, (hashtab_datum_t)datum);
-	if (rc == SEPOL_OK) {
+	int rc = SEPOL_OK;
+
+	if (__cil_symtab_search(symtab, key) != NULL) {
+		rc = SEPOL_EEXIST;
+	} else {
+		if (symtab->slots == NULL) {
+			__cil_symtab_alloc(symtab);
+		} else if (symtab->norder == CIL_SYMTAB_LIMIT(symtab)) {
+			__cil_symtab_grow(symtab);
+		}
+		__cil_symtab_add(symtab, key, datum);
 		datum->name = key;
 		datum->fqn = key;
 		datum->symtab = symtab;
-		cil_list_append(datum->nodes, CIL_NODE, node);
-	} else if (rc == SEPOL_EEXIST) {
-		cil_list_append(datum->nodes, CIL_NODE, node);
-	} else {
-		cil_symtab_error("Failed to insert datum into hashtab\n");
 	}
 
+	cil_vector_append(&datum->nodes, node);
+
 	return rc;
 }
 
+/* Place every datum again after the addresses of the keys have changed,
+ * as when the strings of a loaded snapshot are moved. Each keeps its place
+ * in order[]. */
+void cil_symtab_rehash(struct cil_symtab *symtab)
+{
+	uint32_t i;
+	uint32_t j;
+
+	if (symtab->slots == NULL) {
+		return;
+	}
+
+	memset(symtab->slots, 0, sizeof(*symtab->slots) * (symtab->mask + 1));
+
+	for (i = 0; i < symtab->norder; i++) {
+		struct cil_symtab_datum *datum = symtab->order[i];
+		if (datum == NULL) {
+			continue;
+		}
+		j = CIL_SYMTAB_HASH(symtab, datum->name);
+		while (symtab->slots[j].key != NULL) {
+			j = (j + 1) & symtab->mask;
+		}
+		symtab->slots[j].key = datum->name;
+		symtab->slots[j].datum = datum;
+		symtab->slots[j].order = i;
+	}
+}
+
+/* Removes the slot and shifts back any later entries of the probe run
+ * that could not have been placed at or before their home slot. */
+static void __cil_symtab_remove(struct cil_symtab *symtab, struct cil_symtab_slot *slot)
+{
+	struct cil_symtab_slot *slots = symtab->slots;
+	uint32_t mask = symtab->mask;
+	uint32_t hole = slot - slots;
+	uint32_t i = hole;
+
+	symtab->order[slot->order] = NULL;
+	symtab->nelems--;
+
+	for (;;) {
+		uint32_t home;
+		i = (i + 1) & mask;
+		if (slots[i].key == NULL) {
+			break;
+		}
+		home = CIL_SYMTAB_HASH(symtab, slots[i].key);
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			slots[hole] = slots[i];
+			hole = i;
+		}
+	}
+
+	slots[hole].key = NULL;
+	slots[hole].datum = NULL;
+}
+
 void cil_symtab_remove_datum(struct cil_symtab_datum *datum)
 {
-	symtab_t *symtab = datum->symtab;
+	struct cil_symtab *symtab = datum->symtab;
+	struct cil_symtab_slot *slot;
 
 	if (symtab == NULL) {
 		return;
 	}
 
-	hashtab_remove(symtab->table, datum->name, NULL, NULL);
+	slot = __cil_symtab_search(symtab, datum->name);
+	if (slot != NULL) {
+		__cil_symtab_remove(symtab, slot);
+	}
 	datum->symtab = NULL;
 }
 
-int cil_symtab_get_datum(symtab_t *symtab, char *key, struct cil_symtab_datum **datum)
+int cil_symtab_get_datum(struct cil_symtab *symtab, char *key, struct cil_symtab_datum **datum)
 {
-	*datum = (struct cil_symtab_datum*)hashtab_search(symtab->table, (hashtab_key_t)key);
-	if (*datum == NULL) {
+	struct cil_symtab_slot *slot = __cil_symtab_search(symtab, key);
+
+	if (slot == NULL) {
+		*datum = NULL;
 		return SEPOL_ENOENT;
 	}
 
+	*datum = slot->datum;
+
 	return SEPOL_OK;
 }
 
-int cil_symtab_map(symtab_t *symtab,
+int cil_symtab_map(struct cil_symtab *symtab,
 				   int (*apply) (hashtab_key_t k, hashtab_datum_t d, void *args),
 				   void *args)
 {
-	return hashtab_map(symtab->table, apply, args);
+	uint32_t i;
+	int rc;
+
+	for (i = 0; i < symtab->norder; i++) {
+		struct cil_symtab_datum *datum = symtab->order[i];
+		if (datum == NULL) {
+			continue;
+		}
+		rc = apply(datum->name, datum, args);
+		if (rc != SEPOL_OK) {
+			return rc;
+		}
+	}
+
+	return SEPOL_OK;
 }
 
 static int __cil_symtab_destroy_helper(__attribute__((unused)) hashtab_key_t k, hashtab_datum_t d, __attribute__((unused)) void *args)
@@ -138,148 +317,128 @@ static int __cil_symtab_destroy_helper(__attribute__((unused)) hashtab_key_t k,
 	return SEPOL_OK;
 }
 
-void cil_symtab_destroy(symtab_t *symtab)
+void cil_symtab_destroy(struct cil_symtab *symtab)
 {
-	if (symtab->table != NULL){
+	if (symtab->slots != NULL){
 		cil_symtab_map(symtab, __cil_symtab_destroy_helper, NULL);
-		hashtab_destroy(symtab->table);
-		symtab->table = NULL;
+		cil_arena_release(symtab->slots, sizeof(*symtab->slots) * (symtab->mask + 1));
+		cil_arena_release(symtab->order, sizeof(*symtab->order) * CIL_SYMTAB_LIMIT(symtab));
+		symtab->slots = NULL;
+		symtab->order = NULL;
+		symtab->nelems = 0;
+		symtab->norder = 0;
 	}
 }
 
-void cil_complex_symtab_hash(struct cil_complex_symtab_key *ckey, int mask, intptr_t *hash)
+static uint32_t __cil_complex_symtab_hash(struct cil_complex_symtab *symtab, struct cil_complex_symtab_key *ckey)
 {
-	intptr_t sum = ckey->key1 + ckey->key2 + ckey->key3 + ckey->key4;
-	*hash = (intptr_t)((sum >> 2) & mask);
+	uint64_t hash = (uint64_t)ckey->key1;
+
+	hash = (hash ^ (uint64_t)ckey->key2) * UINT64_C(0x9E3779B97F4A7C15);
+	hash = (hash ^ (uint64_t)ckey->key3) * UINT64_C(0xBF58476D1CE4E5B9);
+	hash = (hash ^ (uint64_t)ckey->key4) * UINT64_C(0x94D049BB133111EB);
+	hash ^= hash >> 31;
+
+	return (uint32_t)hash & symtab->mask;
 }
 
-void cil_complex_symtab_init(struct cil_complex_symtab *symtab, unsigned int size)
+static int __cil_complex_symtab_key_eq(struct cil_complex_symtab_key *a, struct cil_complex_symtab_key *b)
 {
-	symtab->htable = cil_calloc(size, sizeof(struct cil_complex_symtab *));
+	return a->key1 == b->key1 && a->key2 == b->key2 &&
+		a->key3 == b->key3 && a->key4 == b->key4;
+}
 
-	symtab->nelems = 0;
-	symtab->nslots = size;
-	symtab->mask = size - 1;
+/* Returns the htable slot holding ckey, or the empty slot where it would
+ * be added. */
+static uint32_t *__cil_complex_symtab_slot(struct cil_complex_symtab *symtab, struct cil_complex_symtab_key *ckey)
+{
+	uint32_t i = __cil_complex_symtab_hash(symtab, ckey);
+
+	for (;;) {
+		uint32_t *slot = &symtab->htable[i];
+		if (*slot == 0 || __cil_complex_symtab_key_eq(&symtab->nodes[*slot - 1].ckey, ckey)) {
+			return slot;
+		}
+		i = (i + 1) & symtab->mask;
+	}
 }
 
-int cil_complex_symtab_insert(struct cil_complex_symtab *symtab,
-			struct cil_complex_symtab_key *ckey,
-			struct cil_complex_symtab_datum *datum)
+static void __cil_complex_symtab_grow(struct cil_complex_symtab *symtab)
 {
-	intptr_t hash;
-	struct cil_complex_symtab_node *node = NULL;
-	struct cil_complex_symtab_node *prev = NULL;
-	struct cil_complex_symtab_node *curr = NULL;
+	uint32_t i;
 
-	node = cil_malloc(sizeof(*node));
-	memset(node, 0, sizeof(*node));
+	free(symtab->htable);
+	symtab->nslots <<= 1;
+	symtab->mask = symtab->nslots - 1;
+	symtab->htable = cil_calloc(symtab->nslots, sizeof(*symtab->htable));
+	symtab->nodes = cil_realloc(symtab->nodes, sizeof(*symtab->nodes) * (symtab->nslots / 2));
 
-	node->ckey = ckey;
-	node->datum = datum;
+	for (i = 0; i < symtab->nelems; i++) {
+		*__cil_complex_symtab_slot(symtab, &symtab->nodes[i].ckey) = i + 1;
+	}
+}
 
-	cil_complex_symtab_hash(ckey, symtab->mask, &hash);
+void cil_complex_symtab_init(struct cil_complex_symtab *symtab, unsigned int size)
+{
+	uint32_t nslots = 2;
 
-	for (prev = NULL, curr = symtab->htable[hash]; curr != NULL;
-		prev = curr, curr = curr->next) {
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 == curr->ckey->key3 &&
-			ckey->key4 == curr->ckey->key4) {
-			return SEPOL_EEXIST;
-		}
+	while (nslots < size) {
+		nslots <<= 1;
+	}
 
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 < curr->ckey->key2) {
-			break;
-		}
+	symtab->htable = cil_calloc(nslots, sizeof(*symtab->htable));
+	symtab->nodes = cil_malloc(sizeof(*symtab->nodes) * (nslots / 2));
+	symtab->nelems = 0;
+	symtab->nslots = nslots;
+	symtab->mask = nslots - 1;
+}
 
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 < curr->ckey->key3) {
-			break;
-		}
+/* The key and datum are copied into the table. */
+int cil_complex_symtab_insert(struct cil_complex_symtab *symtab,
+			struct cil_complex_symtab_key *ckey,
+			struct cil_complex_symtab_datum *datum)
+{
+	uint32_t *slot = __cil_complex_symtab_slot(symtab, ckey);
+	struct cil_complex_symtab_node *node = NULL;
 
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 == curr->ckey->key3 &&
-			ckey->key4 < curr->ckey->key4) {
-			break;
-		}
+	if (*slot != 0) {
+		return SEPOL_EEXIST;
 	}
 
-	if (prev != NULL) {
-		node->next = prev->next;
-		prev->next = node;
-	} else {
-		node->next = symtab->htable[hash];
-		symtab->htable[hash] = node;
+	if (symtab->nelems == symtab->nslots / 2) {
+		__cil_complex_symtab_grow(symtab);
+		slot = __cil_complex_symtab_slot(symtab, ckey);
 	}
 
-	symtab->nelems++;
+	node = &symtab->nodes[symtab->nelems++];
+	node->ckey = *ckey;
+	node->datum.data = datum != NULL ? datum->data : NULL;
+	*slot = symtab->nelems;
 
 	return SEPOL_OK;
 }
 
+/* The datum returned is owned by the table and only valid until the next
+ * insert. */
 void cil_complex_symtab_search(struct cil_complex_symtab *symtab,
 			       struct cil_complex_symtab_key *ckey,
 			       struct cil_complex_symtab_datum **out)
 {
-	intptr_t hash;
-	struct cil_complex_symtab_node *curr = NULL;
-
-	cil_complex_symtab_hash(ckey, symtab->mask, &hash);
-	for (curr = symtab->htable[hash]; curr != NULL; curr = curr->next) {
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 == curr->ckey->key3 &&
-			ckey->key4 == curr->ckey->key4) {
-			*out = curr->datum;
-			return;
-		}
-
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 < curr->ckey->key2) {
-			break;
-		}
-
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 < curr->ckey->key3) {
-			break;
-		}
+	uint32_t *slot = __cil_complex_symtab_slot(symtab, ckey);
 
-		if (ckey->key1 == curr->ckey->key1 &&
-			ckey->key2 == curr->ckey->key2 &&
-			ckey->key3 == curr->ckey->key3 &&
-			ckey->key4 < curr->ckey->key4) {
-			break;
-		}
-	}
-
-	*out = NULL;
+	*out = *slot != 0 ? &symtab->nodes[*slot - 1].datum : NULL;
 }
 
 void cil_complex_symtab_destroy(struct cil_complex_symtab *symtab)
 {
-	struct cil_complex_symtab_node *curr = NULL;
-	struct cil_complex_symtab_node *temp = NULL;
-	unsigned int i;
-
 	if (symtab == NULL) {
 		return;
 	}
 
-	for (i = 0; i < symtab->nslots; i++) {
-		curr = symtab->htable[i];
-		while (curr != NULL) {
-			temp = curr;
-			curr = curr->next;
-			free(temp);
-		}
-		symtab->htable[i] = NULL;
-	}
 	free(symtab->htable);
+	free(symtab->nodes);
 	symtab->htable = NULL;
+	symtab->nodes = NULL;
 	symtab->nelems = 0;
 	symtab->nslots = 0;
 	symtab->mask = 0;
@@ -30,20 +30,51 @@
 #ifndef __CIL_SYMTAB_H_
 #define __CIL_SYMTAB_H_
 
-#include <sepol/policydb/symtab.h>
+#include <stdint.h>
+
 #include <sepol/policydb/hashtab.h>
 
 #include "cil_tree.h"
+#include "cil_vector.h"
 
 struct cil_symtab_datum {
-	struct cil_list *nodes;
+	struct cil_vector nodes;
 	char *name;
 	char *fqn;
-	symtab_t *symtab;
+	struct cil_symtab *symtab;
+};
+
+/* Symbol table keyed by strpool pointers. Keys are hashed and compared by
+ * address, never by content, so every key must come from cil_strpool_add().
+ * Slots use linear probing; order[] keeps datums in insertion order for
+ * cil_symtab_map(), with NULL holes left by removals. Both arrays stay
+ * NULL until the first insert. */
+struct cil_symtab_slot {
+	char *key;
+	struct cil_symtab_datum *datum;
+	uint32_t order;
 };
 
+struct cil_symtab {
+	struct cil_symtab_slot *slots;
+	struct cil_symtab_datum **order;
+	uint32_t mask;
+	uint32_t shift;
+	uint32_t nelems;
+	uint32_t norder;
+};
+
+/* Fibonacci hashing of the key's address; the top bits of the product
+ * select the slot. */
+#define CIL_SYMTAB_HASH(symtab, key) \
+	((uint32_t)(((uint64_t)(uintptr_t)(key) * UINT64_C(0x9E3779B97F4A7C15)) >> (symtab)->shift))
+
+/* Tables hold at most three quarters of their slots, which is the size of
+ * order[]. */
+#define CIL_SYMTAB_LIMIT(symtab) (((symtab)->mask + 1) - (((symtab)->mask + 1) >> 2))
+
 #define DATUM(d) ((struct cil_symtab_datum *)(d))
-#define NODE(n) ((struct cil_tree_node *)(DATUM(n)->nodes->head->data))
+#define NODE(n) ((struct cil_tree_node *)(cil_vector_get(&DATUM(n)->nodes, 0)))
 #define FLAVOR(f) (NODE(f)->flavor)
 
 struct cil_complex_symtab_key {
@@ -57,30 +88,34 @@ struct cil_complex_symtab_datum {
 	void *data;
 };
 
+/* Index of 4-tuples used to find duplicate rules. Nodes are stored densely
+ * in insertion order; htable holds node index + 1, with 0 marking an empty
+ * slot, and is kept at most half full. */
 struct cil_complex_symtab_node {
-	struct cil_complex_symtab_key *ckey;
-	struct cil_complex_symtab_datum *datum;
-	struct cil_complex_symtab_node *next;
+	struct cil_complex_symtab_key ckey;
+	struct cil_complex_symtab_datum datum;
 };
 
 struct cil_complex_symtab {
-	struct cil_complex_symtab_node **htable;
+	struct cil_complex_symtab_node *nodes;
+	uint32_t *htable;
 	uint32_t nelems;
 	uint32_t nslots;
 	uint32_t mask;
 };
 
-void cil_symtab_init(symtab_t *symtab, unsigned int size);
+void cil_symtab_init(struct cil_symtab *symtab, unsigned int size);
 void cil_symtab_datum_init(struct cil_symtab_datum *datum);
 void cil_symtab_datum_destroy(struct cil_symtab_datum *datum);
 void cil_symtab_datum_remove_node(struct cil_symtab_datum *datum, struct cil_tree_node *node);
-int cil_symtab_insert(symtab_t *symtab, hashtab_key_t key, struct cil_symtab_datum *datum, struct cil_tree_node *node);
+int cil_symtab_insert(struct cil_symtab *symtab, hashtab_key_t key, struct cil_symtab_datum *datum, struct cil_tree_node *node);
+void cil_symtab_rehash(struct cil_symtab *symtab);
 void cil_symtab_remove_datum(struct cil_symtab_datum *datum);
-int cil_symtab_get_datum(symtab_t *symtab, char *key, struct cil_symtab_datum **datum);
-int cil_symtab_map(symtab_t *symtab,
+int cil_symtab_get_datum(struct cil_symtab *symtab, char *key, struct cil_symtab_datum **datum);
+int cil_symtab_map(struct cil_symtab *symtab,
 				   int (*apply) (hashtab_key_t k, hashtab_datum_t d, void *args),
 				   void *args);
-void cil_symtab_destroy(symtab_t *symtab);
+void cil_symtab_destroy(struct cil_symtab *symtab);
 void cil_complex_symtab_init(struct cil_complex_symtab *symtab, unsigned int size);
 int cil_complex_symtab_insert(struct cil_complex_symtab *symtab, struct cil_complex_symtab_key *ckey, struct cil_complex_symtab_datum *datum);
 void cil_complex_symtab_search(struct cil_complex_symtab *symtab, struct cil_complex_symtab_key *ckey, struct cil_complex_symtab_datum **out);
@@ -28,14 +28,18 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <stdarg.h>
+#include <pthread.h>
 
 #include <sepol/policydb/conditional.h>
 
 #include "cil_internal.h"
 #include "cil_flavor.h"
 #include "cil_log.h"
+#include "cil_mem.h"
 #include "cil_tree.h"
+#include "cil_arena.h"
 #include "cil_list.h"
 #include "cil_parser.h"
 #include "cil_strpool.h"
@@ -58,9 +62,208 @@ __attribute__((noreturn)) __attribute__((format (printf, 1, 2))) void cil_tree_e
 	exit(1);
 }
 
+/* Source locations. Nodes do not carry their path and line; they hold an
+ * id into a table of line ranges instead. Each range covers lines
+ * first..first+count-1 of one file and owns the ids base..base+count-1.
+ * Statements of a file are registered in order, so a file normally needs a
+ * single range. Id 0 is reserved for nodes with no location.
+ *
+ * Every db has a table of its own. Ids are added to and looked up in the
+ * table last passed to cil_tree_locs_enter() on the calling thread, or in a
+ * private table of the thread if it has not entered one. */
+struct cil_tree_loc_range {
+	char *path;
+	uint32_t first;
+	uint32_t count;
+	uint32_t base;
+};
+
+struct cil_tree_locs {
+	pthread_mutex_t mutex;
+	struct cil_tree_loc_range *ranges;
+	uint32_t count;
+	uint32_t alloc;
+	uint32_t next;
+};
+
+static __thread struct cil_tree_locs *cil_tree_locs_current;
+static __thread struct cil_tree_locs *cil_tree_locs_fallback;
+
+void cil_tree_locs_init(struct cil_tree_locs **locs)
+{
+	struct cil_tree_locs *new_locs = cil_malloc(sizeof(*new_locs));
+
+	pthread_mutex_init(&new_locs->mutex, NULL);
+	new_locs->ranges = NULL;
+	new_locs->count = 0;
+	new_locs->alloc = 0;
+	new_locs->next = 1;
+
+	*locs = new_locs;
+}
+
+void cil_tree_locs_destroy(struct cil_tree_locs **locs)
+{
+	if (*locs == NULL) {
+		return;
+	}
+
+	if (cil_tree_locs_current == *locs) {
+		cil_tree_locs_current = NULL;
+	}
+
+	pthread_mutex_destroy(&(*locs)->mutex);
+	free((*locs)->ranges);
+	free(*locs);
+	*locs = NULL;
+}
+
+/* Make locs the table used by this thread and return the previous one,
+ * which the caller passes back here when it is done. */
+struct cil_tree_locs *cil_tree_locs_enter(struct cil_tree_locs *locs)
+{
+	struct cil_tree_locs *prev = cil_tree_locs_current;
+
+	cil_tree_locs_current = locs;
+
+	return prev;
+}
+
+static struct cil_tree_locs *__cil_tree_locs_get(void)
+{
+	if (cil_tree_locs_current != NULL) {
+		return cil_tree_locs_current;
+	}
+
+	if (cil_tree_locs_fallback == NULL) {
+		cil_tree_locs_init(&cil_tree_locs_fallback);
+	}
+
+	return cil_tree_locs_fallback;
+}
+
+/* Reserve ids for lines first..last of path and return the id of first. The
+ * id of any line in between is that plus its distance from first. */
+uint32_t cil_tree_loc_add(char *path, uint32_t first, uint32_t last)
+{
+	struct cil_tree_locs *locs = __cil_tree_locs_get();
+	struct cil_tree_loc_range *range = NULL;
+	uint32_t loc;
+
+	pthread_mutex_lock(&locs->mutex);
+
+	range = locs->count > 0 ? &locs->ranges[locs->count - 1] : NULL;
+	if (range != NULL && range->path == path && first >= range->first) {
+		/* Continue the most recent range */
+		if (last - range->first + 1 > range->count) {
+			locs->next += last - range->first + 1 - range->count;
+			range->count = last - range->first + 1;
+		}
+		loc = range->base + (first - range->first);
+		goto exit;
+	}
+
+	if (locs->count == locs->alloc) {
+		locs->alloc = locs->alloc ? locs->alloc * 2 : 64;
+		locs->ranges = cil_realloc(locs->ranges, sizeof(*locs->ranges) * locs->alloc);
+	}
+
+	range = &locs->ranges[locs->count++];
+	range->path = path;
+	range->first = first;
+	range->count = last - first + 1;
+	range->base = locs->next;
+	locs->next += range->count;
+	loc = range->base;
+
+exit:
+	pthread_mutex_unlock(&locs->mutex);
+
+	return loc;
+}
+
+static struct cil_tree_loc_range *__cil_tree_loc_find(struct cil_tree_locs *locs, uint32_t loc)
+{
+	uint32_t low = 0;
+	uint32_t high = locs->count;
+	uint32_t mid;
+
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		if (loc < locs->ranges[mid].base) {
+			high = mid;
+		} else if (loc >= locs->ranges[mid].base + locs->ranges[mid].count) {
+			low = mid + 1;
+		} else {
+			return &locs->ranges[mid];
+		}
+	}
+
+	return NULL;
+}
+
+/* Call apply on each range of the table, in id order */
+int cil_tree_loc_map(int (*apply)(char *path, uint32_t first, uint32_t count, uint32_t base, void *args), void *args)
+{
+	struct cil_tree_locs *locs = __cil_tree_locs_get();
+	int rc = SEPOL_OK;
+	uint32_t i;
+
+	pthread_mutex_lock(&locs->mutex);
+	for (i = 0; i < locs->count && rc == SEPOL_OK; i++) {
+		struct cil_tree_loc_range *range = &locs->ranges[i];
+		rc = apply(range->path, range->first, range->count, range->base, args);
+	}
+	pthread_mutex_unlock(&locs->mutex);
+
+	return rc;
+}
+
+char *cil_tree_loc_path(uint32_t loc)
+{
+	struct cil_tree_locs *locs = __cil_tree_locs_get();
+	struct cil_tree_loc_range *range = NULL;
+	char *path = NULL;
+
+	pthread_mutex_lock(&locs->mutex);
+	range = __cil_tree_loc_find(locs, loc);
+	if (range != NULL) {
+		path = range->path;
+	}
+	pthread_mutex_unlock(&locs->mutex);
+
+	return path;
+}
+
+uint32_t cil_tree_loc_line(uint32_t loc)
+{
+	struct cil_tree_locs *locs = __cil_tree_locs_get();
+	struct cil_tree_loc_range *range = NULL;
+	uint32_t line = 0;
+
+	pthread_mutex_lock(&locs->mutex);
+	range = __cil_tree_loc_find(locs, loc);
+	if (range != NULL) {
+		line = range->first + (loc - range->base);
+	}
+	pthread_mutex_unlock(&locs->mutex);
+
+	return line;
+}
+
+char *cil_tree_node_path(struct cil_tree_node *node)
+{
+	return cil_tree_loc_path(node->loc);
+}
+
+uint32_t cil_tree_node_line(struct cil_tree_node *node)
+{
+	return cil_tree_loc_line(node->loc);
+}
+
 int cil_tree_init(struct cil_tree **tree)
 {
-	struct cil_tree *new_tree = cil_malloc(sizeof(*new_tree));
+	struct cil_tree *new_tree = cil_arena_alloc(sizeof(*new_tree));
 
 	cil_tree_node_init(&new_tree->root);
 	
@@ -76,7 +279,7 @@ void cil_tree_destroy(struct cil_tree **tree)
 	}
 
 	cil_tree_subtree_destroy((*tree)->root);
-	free(*tree);
+	cil_arena_release(*tree, sizeof(**tree));
 	*tree = NULL;
 }
 
@@ -95,40 +298,41 @@ void cil_tree_children_destroy(struct cil_tree_node *node)
 		return;
 	}
 
-	if (node->cl_head != NULL) {
-		node = node->cl_head;
+	if (cil_tree_node_head(node) != NULL) {
+		node = cil_tree_node_head(node);
 	}
 
 	while (node != start_node) {
-		if (node->cl_head != NULL){
-			next = node->cl_head;
+		if (cil_tree_node_head(node) != NULL){
+			next = cil_tree_node_head(node);
 		} else {
-			if (node->next == NULL) {
-				next = node->parent;
-				if (node->parent != NULL) {
-					node->parent->cl_head = NULL;
+			if (cil_tree_node_next(node) == NULL) {
+				next = cil_tree_node_parent(node);
+				if (cil_tree_node_parent(node) != NULL) {
+					cil_tree_node_set_head(cil_tree_node_parent(node), NULL);
 				}
 				cil_tree_node_destroy(&node);
 			} else {
-				next = node->next;
+				next = cil_tree_node_next(node);
 				cil_tree_node_destroy(&node);
 			}
 		}
 		node = next;
 	}
+
+	cil_tree_node_set_tail(start_node, NULL);
 }
 
 void cil_tree_node_init(struct cil_tree_node **node)
 {
-	struct cil_tree_node *new_node = cil_malloc(sizeof(*new_node));
-	new_node->cl_head = NULL;
-	new_node->cl_tail = NULL;
-	new_node->parent = NULL;
+	struct cil_tree_node *new_node = cil_arena_alloc_node();
+	new_node->cl_head = 0;
+	new_node->cl_tail = 0;
+	new_node->parent = 0;
 	new_node->data = NULL;
-	new_node->next = NULL;
+	new_node->next = 0;
 	new_node->flavor = CIL_ROOT;
-	new_node->line = 0;	
-	new_node->path = NULL;
+	new_node->loc = 0;
 
 	*node = new_node;
 }
@@ -144,102 +348,181 @@ void cil_tree_node_destroy(struct cil_tree_node **node)
 	if ((*node)->flavor >= CIL_MIN_DECLARATIVE) {
 		datum = (*node)->data;
 		cil_symtab_datum_remove_node(datum, *node);
-		if (datum->nodes == NULL) {
+		if (datum->nodes.count == 0) {
 			cil_destroy_data(&(*node)->data, (*node)->flavor);
 		}
 	} else {
 		cil_destroy_data(&(*node)->data, (*node)->flavor);
 	}
-	free(*node);
+	cil_arena_release_node(*node);
 	*node = NULL;
 }
 
-/* Perform depth-first walk of the tree
-   Parameters:
-   start_node:          root node to start walking from
-   process_node:        function to call when visiting a node
-                        Takes parameters:
-                            node:     node being visited
-                            finished: boolean indicating to the tree walker that it should move on from this branch
-                            extra_args:    additional data
-   first_child:		Function to call before entering list of children
-                        Takes parameters:
-                            node:     node of first child
-                            extra args:     additional data
-   last_child:		Function to call when finished with the last child of a node's children
-   extra_args:               any additional data to be passed to the helper functions
-*/
-
-int cil_tree_walk_core(struct cil_tree_node *node,
-					   int (*process_node)(struct cil_tree_node *node, uint32_t *finished, void *extra_args),
-					   int (*first_child)(struct cil_tree_node *node, void *extra_args), 
-					   int (*last_child)(struct cil_tree_node *node, void *extra_args), 
-					   void *extra_args)
+#define CIL_TREE_WALK_STACK	64
+
+struct cil_tree_walk_frame {
+	struct cil_tree_node *parent;
+	uint32_t active;
+};
+
+/* Depth-first walk of the descendants of root, using an explicit stack of
+ * the nodes whose children are being visited. Every visitor is called on
+ * each node in turn. A visitor that sets CIL_TREE_SKIP_HEAD is not called on
+ * the node's descendants, and one that sets CIL_TREE_SKIP_NEXT is not called
+ * on them or on the node's remaining siblings; the other visitors carry on.
+ * A branch is only entered while some visitor is still active in it.
+ * first_child and last_child are called with extra_args around each list of
+ * children that is entered. */
+static int __cil_tree_walk(struct cil_tree_node *root, struct cil_tree_visitor *visitors, uint32_t num_visitors,
+						   int (*first_child)(struct cil_tree_node *node, void *extra_args),
+						   int (*last_child)(struct cil_tree_node *node, void *extra_args),
+						   void *extra_args)
 {
-	int rc = SEPOL_ERR;
+	int rc = SEPOL_OK;
+	struct cil_tree_walk_frame local[CIL_TREE_WALK_STACK];
+	struct cil_tree_walk_frame *stack = local;
+	struct cil_tree_walk_frame *frame = NULL;
+	struct cil_tree_node *node = NULL;
+	struct cil_tree_node *parent = NULL;
+	uint32_t alloc = CIL_TREE_WALK_STACK;
+	uint32_t depth = 0;
+	uint32_t children;
+	uint32_t finished;
+	uint32_t i;
+
+	if (root == NULL || cil_tree_node_head(root) == NULL) {
+		return SEPOL_OK;
+	}
 
-	while (node) {
-		uint32_t finished = CIL_TREE_SKIP_NOTHING;
+	if (first_child != NULL) {
+		rc = (*first_child)(cil_tree_node_head(root), extra_args);
+		if (rc != SEPOL_OK) {
+			cil_log(CIL_INFO, "Problem at line %d of %s\n", cil_tree_node_line(root), cil_tree_node_path(root));
+			return rc;
+		}
+	}
 
-		if (process_node != NULL) {
-			rc = (*process_node)(node, &finished, extra_args);
+	stack[0].parent = root;
+	stack[0].active = num_visitors < 32 ? (1U << num_visitors) - 1 : ~0U;
+	depth = 1;
+	node = cil_tree_node_head(root);
+
+	while (depth > 0) {
+		frame = &stack[depth - 1];
+
+		if (node == NULL || frame->active == 0) {
+			/* Done with this list of children */
+			parent = frame->parent;
+			depth--;
+			if (last_child != NULL) {
+				rc = (*last_child)(cil_tree_node_tail(parent), extra_args);
+				if (rc != SEPOL_OK) {
+					cil_log(CIL_INFO, "Problem at line %d of %s\n", cil_tree_node_line(parent), cil_tree_node_path(parent));
+					goto exit;
+				}
+			}
+			node = cil_tree_node_next(parent);
+			continue;
+		}
+
+		children = frame->active;
+		for (i = 0; i < num_visitors; i++) {
+			if (!(frame->active & (1U << i)) || visitors[i].process_node == NULL) {
+				continue;
+			}
+			finished = CIL_TREE_SKIP_NOTHING;
+			rc = (*visitors[i].process_node)(node, &finished, visitors[i].extra_args);
 			if (rc != SEPOL_OK) {
-				cil_log(CIL_INFO, "Problem at line %d of %s\n", node->line, node->path);
-				return rc;
+				cil_log(CIL_INFO, "Problem at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
+				goto exit;
+			}
+			if (finished & CIL_TREE_SKIP_NEXT) {
+				frame->active &= ~(1U << i);
+				children &= ~(1U << i);
+			} else if (finished & CIL_TREE_SKIP_HEAD) {
+				children &= ~(1U << i);
 			}
 		}
 
-		if (finished & CIL_TREE_SKIP_NEXT) {
-			return SEPOL_OK;
+		if (cil_tree_node_head(node) == NULL || children == 0) {
+			node = cil_tree_node_next(node);
+			continue;
 		}
 
-		if (node->cl_head != NULL && !(finished & CIL_TREE_SKIP_HEAD)) {
-			rc = cil_tree_walk(node, process_node, first_child, last_child, extra_args);
+		if (first_child != NULL) {
+			rc = (*first_child)(cil_tree_node_head(node), extra_args);
 			if (rc != SEPOL_OK) {
-				return rc;
+				cil_log(CIL_INFO, "Problem at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
+				goto exit;
 			}
 		}
 
-		node = node->next;
+		if (depth == alloc) {
+			alloc *= 2;
+			if (stack == local) {
+				stack = cil_malloc(sizeof(*stack) * alloc);
+				memcpy(stack, local, sizeof(local));
+			} else {
+				stack = cil_realloc(stack, sizeof(*stack) * alloc);
+			}
+		}
+		stack[depth].parent = node;
+		stack[depth].active = children;
+		depth++;
+		node = cil_tree_node_head(node);
 	}
 
-	return SEPOL_OK;
+	rc = SEPOL_OK;
+
+exit:
+	if (stack != local) {
+		free(stack);
+	}
+
+	return rc;
 }
 
+/* Perform depth-first walk of the tree
+   Parameters:
+   start_node:          root node to start walking from
+   process_node:        function to call when visiting a node
+                        Takes parameters:
+                            node:     node being visited
+                            finished: boolean indicating to the tree walker that it should move on from this branch
+                            extra_args:    additional data
+   first_child:		Function to call before entering list of children
+                        Takes parameters:
+                            node:     node of first child
+                            extra args:     additional data
+   last_child:		Function to call when finished with the last child of a node's children
+   extra_args:               any additional data to be passed to the helper functions
+*/
 int cil_tree_walk(struct cil_tree_node *node, 
 				  int (*process_node)(struct cil_tree_node *node, uint32_t *finished, void *extra_args), 
 				  int (*first_child)(struct cil_tree_node *node, void *extra_args), 
 				  int (*last_child)(struct cil_tree_node *node, void *extra_args), 
 				  void *extra_args)
 {
-	int rc = SEPOL_ERR;
+	struct cil_tree_visitor visitor;
 
-	if (!node || !node->cl_head) {
-		return SEPOL_OK;
-	}
+	visitor.process_node = process_node;
+	visitor.extra_args = extra_args;
 
-	if (first_child != NULL) {
-		rc = (*first_child)(node->cl_head, extra_args);
-		if (rc != SEPOL_OK) {
-			cil_log(CIL_INFO, "Problem at line %d of %s\n", node->line, node->path);
-			return rc;
-		}
-	}
-
-	rc = cil_tree_walk_core(node->cl_head, process_node, first_child, last_child, extra_args);
-	if (rc != SEPOL_OK) {
-		return rc;
-	}
+	return __cil_tree_walk(node, &visitor, 1, first_child, last_child, extra_args);
+}
 
-	if (last_child != NULL) {
-		rc = (*last_child)(node->cl_tail, extra_args);
-		if (rc != SEPOL_OK) {
-			cil_log(CIL_INFO, "Problem at line %d of %s\n",node->line, node->path);
-			return rc;
-		}
+/* Run several independent visitors over the tree in a single traversal.
+   Visitors are called on each node in the order they are given, so a
+   visitor may only rely on the work of the others for nodes that come
+   before the current one. At most CIL_TREE_MAX_VISITORS may be given. */
+int cil_tree_walk_fused(struct cil_tree_node *node, struct cil_tree_visitor *visitors, uint32_t num_visitors)
+{
+	if (num_visitors > CIL_TREE_MAX_VISITORS) {
+		cil_log(CIL_ERR, "Too many visitors for a single tree walk\n");
+		return SEPOL_ERR;
 	}
 
-	return SEPOL_OK;
+	return __cil_tree_walk(node, visitors, num_visitors, NULL, NULL, NULL);
 }
 
 
@@ -440,7 +723,7 @@ void cil_tree_print_perms_list(struct cil_tree_node *current_perm)
 			cil_log(CIL_INFO, "\n\n perms list contained unexpected data type: %d\n", current_perm->flavor);
 			break;
 		}
-		current_perm = current_perm->next;	
+		current_perm = cil_tree_node_next(current_perm);	
 	}
 }
 
@@ -798,7 +1081,7 @@ void cil_tree_print_node(struct cil_tree_node *node)
 			}
 			cil_log(CIL_INFO, "(");
 	
-			cil_tree_print_perms_list(node->cl_head);
+			cil_tree_print_perms_list(cil_tree_node_head(node));
 	
 			cil_log(CIL_INFO, " )");
 			return;
@@ -823,7 +1106,7 @@ void cil_tree_print_node(struct cil_tree_node *node)
 			struct cil_class *common = node->data;
 			cil_log(CIL_INFO, "COMMON: %s (", common->datum.name);
 		
-			cil_tree_print_perms_list(node->cl_head);
+			cil_tree_print_perms_list(cil_tree_node_head(node));
 	
 			cil_log(CIL_INFO, " )");
 			return;
@@ -860,7 +1143,7 @@ void cil_tree_print_node(struct cil_tree_node *node)
 			cil_log(CIL_INFO, "MAP_CLASS: %s", cm->datum.name);
 
 			cil_log(CIL_INFO, " (");
-			cil_tree_print_perms_list(node->cl_head);
+			cil_tree_print_perms_list(cil_tree_node_head(node));
 			cil_log(CIL_INFO, " )\n");
 
 			return;
@@ -1525,8 +1808,8 @@ void cil_tree_print_node(struct cil_tree_node *node)
 				cil_list_for_each(item, call->args) {
 					struct cil_symtab_datum *datum = ((struct cil_args*)item->data)->arg;
 					if (datum != NULL) {
-						if (datum->nodes != NULL && datum->nodes->head != NULL) {
-							cil_tree_print_node((struct cil_tree_node*)datum->nodes->head->data);
+						if (datum->nodes.count > 0) {
+							cil_tree_print_node((struct cil_tree_node*)cil_vector_get(&datum->nodes, 0));
 						}
 					} else if (((struct cil_args*)item->data)->arg_str != NULL) {
 						switch (item->flavor) {
@@ -1578,9 +1861,9 @@ void cil_tree_print(struct cil_tree_node *tree, uint32_t depth)
 	uint32_t x = 0;
 
 	if (current != NULL) {
-		if (current->cl_head == NULL) {
+		if (cil_tree_node_head(current) == NULL) {
 			if (current->flavor == CIL_NODE) {
-				if (current->parent->cl_head == current) {
+				if (cil_tree_node_head(cil_tree_node_parent(current)) == current) {
 					cil_log(CIL_INFO, "%s", (char*)current->data);
 				} else {
 					cil_log(CIL_INFO, " %s", (char*)current->data);
@@ -1592,7 +1875,7 @@ void cil_tree_print(struct cil_tree_node *tree, uint32_t depth)
 				cil_tree_print_node(current);
 			}
 		} else {
-			if (current->parent != NULL) {
+			if (cil_tree_node_parent(current) != NULL) {
 				cil_log(CIL_INFO, "\n");
 				for (x = 0; x<depth; x++) {
 					cil_log(CIL_INFO, "\t");
@@ -1603,11 +1886,11 @@ void cil_tree_print(struct cil_tree_node *tree, uint32_t depth)
 					cil_tree_print_node(current);
 				}
 			}
-			cil_tree_print(current->cl_head, depth + 1);
+			cil_tree_print(cil_tree_node_head(current), depth + 1);
 		}
 
-		if (current->next == NULL) {
-			if ((current->parent != NULL) && (current->parent->cl_tail == current) && (current->parent->parent != NULL)) {
+		if (cil_tree_node_next(current) == NULL) {
+			if ((cil_tree_node_parent(current) != NULL) && (cil_tree_node_tail(cil_tree_node_parent(current)) == current) && (cil_tree_node_parent(cil_tree_node_parent(current)) != NULL)) {
 				if (current->flavor == CIL_PERM) {
 					cil_log(CIL_INFO, ")\n");
 				} else if (current->flavor != CIL_NODE) {
@@ -1620,10 +1903,10 @@ void cil_tree_print(struct cil_tree_node *tree, uint32_t depth)
 				}
 			}
 
-			if ((current->parent != NULL) && (current->parent->parent == NULL))
+			if ((cil_tree_node_parent(current) != NULL) && (cil_tree_node_parent(cil_tree_node_parent(current)) == NULL))
 				cil_log(CIL_INFO, "\n\n");
 		} else {
-			cil_tree_print(current->next, depth);
+			cil_tree_print(cil_tree_node_next(current), depth);
 		}
 	} else {
 		cil_log(CIL_INFO, "Tree is NULL\n");
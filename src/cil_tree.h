@@ -32,6 +32,7 @@
 
 #include <stdint.h>
 
+#include "cil_arena.h"
 #include "cil_flavor.h"
 #include "cil_list.h"
 
@@ -39,17 +40,36 @@ struct cil_tree {
 	struct cil_tree_node *root;
 };
 
+/* flavor holds an enum cil_flavor. loc identifies the node's path and line
+ * in the source location table; use cil_tree_node_path() and
+ * cil_tree_node_line() to read them. The links are node table indexes
+ * (see cil_arena.h), 0 meaning none; read and write them with the
+ * accessors below. */
 struct cil_tree_node {
-	struct cil_tree_node *parent;
-	struct cil_tree_node *cl_head;		//Head of child_list
-	struct cil_tree_node *cl_tail;		//Tail of child_list
-	struct cil_tree_node *next;		//Each element in the list points to the next element
-	enum cil_flavor flavor;
-	uint32_t line;
-	char *path;
+	uint32_t parent;
+	uint32_t cl_head;		//Head of child_list
+	uint32_t cl_tail;		//Tail of child_list
+	uint32_t next;		//Each element in the list points to the next element
 	void *data;
+	uint32_t loc;
+	uint16_t flavor;
 };
 
+#define CIL_TREE_NODE(index) \
+	((index) ? (struct cil_tree_node *)(cil_arena_nodes + ((uintptr_t)(index) << CIL_ARENA_NODE_SHIFT)) : NULL)
+#define CIL_TREE_INDEX(node) \
+	((node) ? (uint32_t)(((uintptr_t)(node) - cil_arena_nodes) >> CIL_ARENA_NODE_SHIFT) : 0)
+
+#define cil_tree_node_parent(n)	CIL_TREE_NODE((n)->parent)
+#define cil_tree_node_head(n)	CIL_TREE_NODE((n)->cl_head)
+#define cil_tree_node_tail(n)	CIL_TREE_NODE((n)->cl_tail)
+#define cil_tree_node_next(n)	CIL_TREE_NODE((n)->next)
+
+#define cil_tree_node_set_parent(n, node)	((n)->parent = CIL_TREE_INDEX(node))
+#define cil_tree_node_set_head(n, node)	((n)->cl_head = CIL_TREE_INDEX(node))
+#define cil_tree_node_set_tail(n, node)	((n)->cl_tail = CIL_TREE_INDEX(node))
+#define cil_tree_node_set_next(n, node)	((n)->next = CIL_TREE_INDEX(node))
+
 int cil_tree_init(struct cil_tree **tree);
 void cil_tree_destroy(struct cil_tree **tree);
 void cil_tree_subtree_destroy(struct cil_tree_node *node);
@@ -58,6 +78,18 @@ void cil_tree_children_destroy(struct cil_tree_node *node);
 void cil_tree_node_init(struct cil_tree_node **node);
 void cil_tree_node_destroy(struct cil_tree_node **node);
 
+struct cil_tree_locs;
+
+void cil_tree_locs_init(struct cil_tree_locs **locs);
+void cil_tree_locs_destroy(struct cil_tree_locs **locs);
+struct cil_tree_locs *cil_tree_locs_enter(struct cil_tree_locs *locs);
+uint32_t cil_tree_loc_add(char *path, uint32_t first, uint32_t last);
+int cil_tree_loc_map(int (*apply)(char *path, uint32_t first, uint32_t count, uint32_t base, void *args), void *args);
+char *cil_tree_loc_path(uint32_t loc);
+uint32_t cil_tree_loc_line(uint32_t loc);
+char *cil_tree_node_path(struct cil_tree_node *node);
+uint32_t cil_tree_node_line(struct cil_tree_node *node);
+
 void cil_tree_print(struct cil_tree_node *tree, uint32_t depth);
 
 //finished values
@@ -67,5 +99,12 @@ void cil_tree_print(struct cil_tree_node *tree, uint32_t depth);
 #define CIL_TREE_SKIP_ALL	(CIL_TREE_SKIP_NOTHING | CIL_TREE_SKIP_NEXT | CIL_TREE_SKIP_HEAD)
 int cil_tree_walk(struct cil_tree_node *start_node, int (*process_node)(struct cil_tree_node *node, uint32_t *finished, void *extra_args), int (*first_child)(struct cil_tree_node *node, void *extra_args), int (*last_child)(struct cil_tree_node *node, void *extra_args), void *extra_args);
 
+#define CIL_TREE_MAX_VISITORS	32
+struct cil_tree_visitor {
+	int (*process_node)(struct cil_tree_node *node, uint32_t *finished, void *extra_args);
+	void *extra_args;
+};
+int cil_tree_walk_fused(struct cil_tree_node *start_node, struct cil_tree_visitor *visitors, uint32_t num_visitors);
+
 #endif /* CIL_TREE_H_ */
 
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sepol/errcodes.h>
+
+#include "cil_arena.h"
+#include "cil_mem.h"
+#include "cil_vector.h"
+
+void cil_vector_init(struct cil_vector *vector)
+{
+	vector->count = 0;
+	vector->alloc = CIL_VECTOR_INLINE;
+}
+
+void cil_vector_destroy(struct cil_vector *vector)
+{
+	if (vector->alloc > CIL_VECTOR_INLINE) {
+		cil_arena_release(vector->u.data, sizeof(*vector->u.data) * vector->alloc);
+	}
+
+	cil_vector_init(vector);
+}
+
+void cil_vector_append(struct cil_vector *vector, void *data)
+{
+	void **new_data = NULL;
+
+	if (vector->count == vector->alloc) {
+		new_data = cil_arena_alloc(sizeof(*new_data) * vector->alloc * 2);
+		memcpy(new_data, cil_vector_data(vector), sizeof(*new_data) * vector->count);
+		if (vector->alloc > CIL_VECTOR_INLINE) {
+			cil_arena_release(vector->u.data, sizeof(*new_data) * vector->alloc);
+		}
+		vector->u.data = new_data;
+		vector->alloc *= 2;
+	}
+
+	cil_vector_data(vector)[vector->count++] = data;
+}
+
+/* Remove the first occurrence of data, keeping the order of the rest */
+int cil_vector_remove(struct cil_vector *vector, void *data)
+{
+	void **elems = cil_vector_data(vector);
+	uint32_t i;
+
+	for (i = 0; i < vector->count; i++) {
+		if (elems[i] == data) {
+			memmove(&elems[i], &elems[i + 1], sizeof(*elems) * (vector->count - i - 1));
+			vector->count--;
+			return SEPOL_OK;
+		}
+	}
+
+	return SEPOL_ENOENT;
+}
+
+/* Make room for one more element of size bytes in array, which holds count
+ * elements in space for *alloc. Full arrays double, starting from min
+ * elements. Returns the array, which may have moved. */
+void *cil_array_grow(void *array, uint32_t count, uint32_t *alloc, size_t size, uint32_t min)
+{
+	if (count < *alloc) {
+		return array;
+	}
+
+	*alloc = *alloc ? *alloc * 2 : min;
+
+	return cil_realloc(array, size * *alloc);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2011 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#ifndef CIL_VECTOR_H_
+#define CIL_VECTOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CIL_VECTOR_INLINE	2
+
+/* A growable array of pointers, embedded in the structure that owns it. The
+ * first CIL_VECTOR_INLINE elements are stored in the vector itself, so short
+ * vectors never allocate. Longer ones are kept in the arena of the thread
+ * that grows them and go away with it. */
+struct cil_vector {
+	uint32_t count;
+	uint32_t alloc;
+	union {
+		void *inline_data[CIL_VECTOR_INLINE];
+		void **data;
+	} u;
+};
+
+#define cil_vector_data(vector) \
+	((vector)->alloc > CIL_VECTOR_INLINE ? (vector)->u.data : (vector)->u.inline_data)
+
+#define cil_vector_get(vector, index) (cil_vector_data(vector)[index])
+
+#define cil_vector_for_each(data, index, vector) \
+	for (index = 0; index < (vector)->count && ((data) = cil_vector_get(vector, index), 1); index++)
+
+void cil_vector_init(struct cil_vector *vector);
+void cil_vector_destroy(struct cil_vector *vector);
+void cil_vector_append(struct cil_vector *vector, void *data);
+int cil_vector_remove(struct cil_vector *vector, void *data);
+
+/* Growable arrays of structures keep their own count and allocated size
+ * next to the array, and make room for each new element with this */
+void *cil_array_grow(void *array, uint32_t count, uint32_t *alloc, size_t size, uint32_t min);
+
+#endif /* CIL_VECTOR_H_ */
@@ -77,11 +77,11 @@ exit:
 	return rc;
 }
 
-int __cil_verify_syntax(struct cil_tree_node *parse_current, enum cil_syntax s[], int len)
+int __cil_verify_syntax(struct cil_parse_token *parse_current, enum cil_syntax s[], int len)
 {
 	int rc = SEPOL_ERR;
 	int num_extras = 0;
-	struct cil_tree_node *c = parse_current;
+	struct cil_parse_token *c = parse_current;
 	int i = 0;
 	while (i < len) {
 		if ((s[i] & CIL_SYN_END) && c == NULL) {
@@ -96,12 +96,12 @@ int __cil_verify_syntax(struct cil_tree_node *parse_current, enum cil_syntax s[]
 				} else {
 					goto exit;
 				}
-			} else if ((s[i] & CIL_SYN_N_LISTS) && (c->data == NULL && c->cl_head != NULL)) {
-				c = c->next;
+			} else if ((s[i] & CIL_SYN_N_LISTS) && (c->data == NULL && cil_parse_token_child(c) != NULL)) {
+				c = cil_parse_token_next(c);
 				num_extras++;
 				continue;
-			} else if ((s[i] & CIL_SYN_N_STRINGS) && (c->data != NULL && c->cl_head == NULL)) {
-				c = c->next;
+			} else if ((s[i] & CIL_SYN_N_STRINGS) && (c->data != NULL && cil_parse_token_child(c) == NULL)) {
+				c = cil_parse_token_next(c);
 				num_extras++;
 				continue;
 			}
@@ -112,24 +112,24 @@ int __cil_verify_syntax(struct cil_tree_node *parse_current, enum cil_syntax s[]
 		}
 
 		if (s[i] & CIL_SYN_STRING) {
-			if (c->data != NULL && c->cl_head == NULL) {
-				c = c->next;
+			if (c->data != NULL && cil_parse_token_child(c) == NULL) {
+				c = cil_parse_token_next(c);
 				i++;
 				continue;
 			}
 		}
 
 		if (s[i] & CIL_SYN_LIST) {
-			if (c->data == NULL && c->cl_head != NULL) {
-				c = c->next;
+			if (c->data == NULL && cil_parse_token_child(c) != NULL) {
+				c = cil_parse_token_next(c);
 				i++;
 				continue;
 			}
 		}
 
 		if (s[i] & CIL_SYN_EMPTY_LIST) {
-			if (c->data == NULL && c->cl_head == NULL) {
-				c = c->next;
+			if (c->data == NULL && cil_parse_token_child(c) == NULL) {
+				c = cil_parse_token_next(c);
 				i++;
 				continue;
 			}
@@ -143,7 +143,7 @@ exit:
 	return rc;
 }
 
-int cil_verify_expr_syntax(struct cil_tree_node *current, enum cil_flavor op, enum cil_flavor expr_flavor)
+int cil_verify_expr_syntax(struct cil_parse_token *current, enum cil_flavor op, enum cil_flavor expr_flavor)
 {
 	int rc;
 	enum cil_syntax syntax[] = {
@@ -265,7 +265,7 @@ exit:
 	return SEPOL_ERR;
 }
 
-int cil_verify_constraint_expr_syntax(struct cil_tree_node *current, enum cil_flavor op)
+int cil_verify_constraint_expr_syntax(struct cil_parse_token *current, enum cil_flavor op)
 {
 	int rc;
 	enum cil_syntax syntax[] = {
@@ -376,25 +376,25 @@ int __cil_verify_ordered_node_helper(struct cil_tree_node *node, __attribute__((
 		if (node->flavor == CIL_SID) {
 			struct cil_sid *sid = node->data;
 			if (sid->ordered == CIL_FALSE) {
-				cil_log(CIL_ERR, "SID %s not in sidorder statement at line %d of %s\n", sid->datum.name, node->line, node->path);
+				cil_log(CIL_ERR, "SID %s not in sidorder statement at line %d of %s\n", sid->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 				return SEPOL_ERR;
 			}
 		} else if (node->flavor == CIL_CLASS) {
 			struct cil_class *class = node->data;
 			if (class->ordered == CIL_FALSE) {
-				cil_log(CIL_ERR, "Class %s not in classorder statement at line %d of %s\n", class->datum.name, node->line, node->path);
+				cil_log(CIL_ERR, "Class %s not in classorder statement at line %d of %s\n", class->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 				return SEPOL_ERR;
 			}
 		} else if (node->flavor == CIL_CAT) {
 			struct cil_cat *cat = node->data;
 			if (cat->ordered == CIL_FALSE) {
-				cil_log(CIL_ERR, "Category %s not in categoryorder statement at line %d of %s\n", cat->datum.name, node->line, node->path);
+				cil_log(CIL_ERR, "Category %s not in categoryorder statement at line %d of %s\n", cat->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 				return SEPOL_ERR;
 			}
 		} else if (node->flavor == CIL_SENS) {
 			struct cil_sens *sens = node->data;
 			if (sens->ordered == CIL_FALSE) {
-				cil_log(CIL_ERR, "Sensitivity %s not in sensitivityorder statement at line %d of %s\n", sens->datum.name, node->line, node->path);
+				cil_log(CIL_ERR, "Sensitivity %s not in sensitivityorder statement at line %d of %s\n", sens->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 				return SEPOL_ERR;
 			}
 		}
@@ -428,8 +428,8 @@ int __cil_verify_initsids(struct cil_list *sids)
 	cil_list_for_each(i, sids) {
 		struct cil_sid *sid = i->data;
 		if (sid->context == NULL) {
-			struct cil_tree_node *node = sid->datum.nodes->head->data;
-			cil_log(CIL_ERR, "No context assigned to SID %s declared at line %d in %s\n",sid->datum.name, node->line, node->path);
+			struct cil_tree_node *node = cil_vector_get(&sid->datum.nodes, 0);
+			cil_log(CIL_ERR, "No context assigned to SID %s declared at line %d in %s\n",sid->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 			rc = SEPOL_ERR;
 		}
 	}
@@ -439,10 +439,10 @@ int __cil_verify_initsids(struct cil_list *sids)
 
 int __cil_is_cat_in_cats(struct cil_cat *cat, struct cil_cats *cats)
 {
-	struct cil_list_item *i;
+	struct cil_cat *c;
+	uint32_t i;
 
-	cil_list_for_each(i, cats->datum_expr) {
-		struct cil_cat *c = i->data;
+	cil_vector_for_each(c, i, &cats->datums) {
 		if (c == cat) {
 			return CIL_TRUE;
 		}
@@ -465,7 +465,9 @@ int __cil_verify_cat_in_cats(struct cil_cat *cat, struct cil_cats *cats)
 int __cil_verify_cats_associated_with_sens(struct cil_sens *sens, struct cil_cats *cats)
 {
 	int rc = SEPOL_OK;
-	struct cil_list_item *i, *j;
+	struct cil_cat *cat;
+	struct cil_list_item *j;
+	uint32_t i;
 
 	if (!cats) {
 		return SEPOL_OK;
@@ -476,8 +478,7 @@ int __cil_verify_cats_associated_with_sens(struct cil_sens *sens, struct cil_cat
 		return SEPOL_ERR;
 	}
 
-	cil_list_for_each(i, cats->datum_expr) {
-		struct cil_cat *cat = i->data;
+	cil_vector_for_each(cat, i, &cats->datums) {
 		int ok = CIL_FALSE;
 		cil_list_for_each(j, sens->cats_list) {
 			if (__cil_is_cat_in_cats(cat, j->data) == CIL_TRUE) {
@@ -528,7 +529,8 @@ exit:
 int __cil_verify_levelrange_cats(struct cil_cats *low, struct cil_cats *high)
 {
 	int rc = SEPOL_ERR;
-	struct cil_list_item *item;
+	struct cil_cat *cat;
+	uint32_t i;
 
 	if (low == NULL || (low == NULL && high == NULL)) {
 		return SEPOL_OK;
@@ -539,8 +541,8 @@ int __cil_verify_levelrange_cats(struct cil_cats *low, struct cil_cats *high)
 		goto exit;
 	}
 
-	cil_list_for_each(item, low->datum_expr) {
-		rc = __cil_verify_cat_in_cats(item->data, high);
+	cil_vector_for_each(cat, i, &low->datums) {
+		rc = __cil_verify_cat_in_cats(cat, high);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
@@ -597,7 +599,7 @@ int __cil_verify_named_levelrange(struct cil_db *db, struct cil_tree_node *node)
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid named range at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid named range at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -645,7 +647,7 @@ int __cil_verify_user(struct cil_db *db, struct cil_tree_node *node)
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid user at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid user at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -676,7 +678,7 @@ int __cil_verify_role(struct cil_tree_node *node)
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid role at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid role at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -707,7 +709,7 @@ int __cil_verify_type(struct cil_tree_node *node)
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid type at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid type at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -809,7 +811,7 @@ int __cil_verify_named_context(struct cil_db *db, struct cil_tree_node *node)
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid named context at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid named context at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -847,9 +849,9 @@ int __cil_verify_rule(struct cil_tree_node *node, struct cil_complex_symtab *sym
 	if (rc == SEPOL_EEXIST) {
 		struct cil_complex_symtab_datum *datum = NULL;
 		cil_complex_symtab_search(symtab, &ckey, &datum);
-		if (datum == NULL) {
+		if (datum->data == NULL) {
 			cil_log(CIL_ERR, "Duplicate rule defined on line %d of %s\n", 
-				node->line, node->path);
+				cil_tree_node_line(node), cil_tree_node_path(node));
 			rc = SEPOL_ERR;
 			goto exit;
 		}
@@ -857,7 +859,7 @@ int __cil_verify_rule(struct cil_tree_node *node, struct cil_complex_symtab *sym
 
 	return SEPOL_OK;
 exit:
-	cil_log(CIL_ERR, "Invalid rule at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid rule at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -865,7 +867,7 @@ int __cil_verify_booleanif_helper(struct cil_tree_node *node, __attribute__((unu
 {
 	int rc = SEPOL_ERR;
 	struct cil_tree_node *rule_node = node;
-	struct cil_booleanif *bif = node->parent->parent->data;
+	struct cil_booleanif *bif = cil_tree_node_parent(cil_tree_node_parent(node))->data;
 
 	switch (rule_node->flavor) {
 	case CIL_AVRULE: {
@@ -874,10 +876,10 @@ int __cil_verify_booleanif_helper(struct cil_tree_node *node, __attribute__((unu
 		if (avrule->rule_kind == CIL_AVRULE_NEVERALLOW) {
 			if (bif->preserved_tunable) {
 				cil_log(CIL_ERR, "Neverallow found in tunableif block (treated as a booleanif due to preserve-tunables) at line %d or %s\n",
-					node->line, node->path);
+					cil_tree_node_line(node), cil_tree_node_path(node));
 			} else {
 				cil_log(CIL_ERR, "Neverallow found in booleanif block at line %d or %s\n",
-					node->line, node->path);
+					cil_tree_node_line(node), cil_tree_node_path(node));
 			}
 			rc = SEPOL_ERR;
 			goto exit;
@@ -914,7 +916,7 @@ int __cil_verify_booleanif_helper(struct cil_tree_node *node, __attribute__((unu
 					(intptr_t)typerule->tgt == ckey.key2 &&
 					(intptr_t)typerule->obj == ckey.key3 &&
 					(intptr_t)typerule->rule_kind == ckey.key4) {
-					cil_log(CIL_ERR, "Duplicate type rule found (line: %d)\n", node->line);
+					cil_log(CIL_ERR, "Duplicate type rule found (line: %d)\n", cil_tree_node_line(node));
 					rc = SEPOL_ERR;
 					goto exit;
 				}
@@ -939,10 +941,10 @@ int __cil_verify_booleanif_helper(struct cil_tree_node *node, __attribute__((unu
 		const char * flavor = cil_node_to_string(node);
 		if (bif->preserved_tunable) {
 			cil_log(CIL_ERR, "Invalid %s statement in tunableif (treated as a booleanif due to preserve-tunables) at line %d of %s\n",
-					flavor, node->line, node->path);
+					flavor, cil_tree_node_line(node), cil_tree_node_path(node));
 		} else {
 			cil_log(CIL_ERR, "Invalid %s statement in booleanif at line %d of %s\n",
-					flavor, node->line, node->path);
+					flavor, cil_tree_node_line(node), cil_tree_node_path(node));
 		}
 		goto exit;
 	}
@@ -957,22 +959,22 @@ int __cil_verify_booleanif(struct cil_tree_node *node, struct cil_complex_symtab
 {
 	int rc = SEPOL_ERR;
 	struct cil_booleanif *bif = (struct cil_booleanif*)node->data;
-	struct cil_tree_node *cond_block = node->cl_head;
+	struct cil_tree_node *cond_block = cil_tree_node_head(node);
 
 	while (cond_block != NULL) {
 		rc = cil_tree_walk(cond_block, __cil_verify_booleanif_helper, NULL, NULL, symtab);
 		if (rc != SEPOL_OK) {
 			goto exit;
 		}
-		cond_block = cond_block->next;
+		cond_block = cil_tree_node_next(cond_block);
 	}
 
 	return SEPOL_OK;
 exit:
 	if (bif->preserved_tunable) {
-		cil_log(CIL_ERR, "Invalid tunableif (treated as a booleanif due to preserve-tunables) at line %d of %s\n", node->line, node->path);
+		cil_log(CIL_ERR, "Invalid tunableif (treated as a booleanif due to preserve-tunables) at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	} else {
-		cil_log(CIL_ERR, "Invalid booleanif at line %d of %s\n", node->line, node->path);
+		cil_log(CIL_ERR, "Invalid booleanif at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	}
 	return rc;
 }
@@ -1003,7 +1005,7 @@ int __cil_verify_netifcon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid netifcon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid netifcon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1024,7 +1026,7 @@ int __cil_verify_genfscon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid genfscon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid genfscon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1044,7 +1046,7 @@ int __cil_verify_filecon(struct cil_db *db, struct cil_tree_node *node)
 		rc = __cil_verify_context(db, ctx);
 		if (rc != SEPOL_OK) {
 			cil_log(CIL_ERR, "Invalid filecon at line %d of %s\n", 
-				node->line, node->path);
+				cil_tree_node_line(node), cil_tree_node_path(node));
 			goto exit;
 		}
 	}
@@ -1072,7 +1074,7 @@ int __cil_verify_nodecon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid nodecon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid nodecon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1093,7 +1095,7 @@ int __cil_verify_portcon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid portcon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid portcon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1114,7 +1116,7 @@ int __cil_verify_pirqcon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid pirqcon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid pirqcon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1135,7 +1137,7 @@ int __cil_verify_iomemcon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid iomemcon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid iomemcon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1156,7 +1158,7 @@ int __cil_verify_ioportcon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid ioportcon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid ioportcon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1177,7 +1179,7 @@ int __cil_verify_pcidevicecon(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid pcidevicecon at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid pcidevicecon at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1198,7 +1200,7 @@ int __cil_verify_fsuse(struct cil_db *db, struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid fsuse at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid fsuse at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1209,18 +1211,18 @@ int __cil_verify_class(struct cil_tree_node *node)
 
 	if (class->common != NULL) {
 		struct cil_class *common = class->common;
-		struct cil_tree_node *common_node = common->datum.nodes->head->data;
+		struct cil_tree_node *common_node = cil_vector_get(&common->datum.nodes, 0);
 		struct cil_tree_node *curr_com_perm = NULL;
 
-		for (curr_com_perm = common_node->cl_head;
+		for (curr_com_perm = cil_tree_node_head(common_node);
 			curr_com_perm != NULL;
-			curr_com_perm = curr_com_perm->next) {
+			curr_com_perm = cil_tree_node_next(curr_com_perm)) {
 			struct cil_perm *com_perm = curr_com_perm->data;
 			struct cil_tree_node *curr_class_perm = NULL;
 
-			for (curr_class_perm = node->cl_head;
+			for (curr_class_perm = cil_tree_node_head(node);
 				curr_class_perm != NULL;
-				curr_class_perm = curr_class_perm->next) {
+				curr_class_perm = cil_tree_node_next(curr_class_perm)) {
 				struct cil_perm *class_perm = curr_class_perm->data;
 
 				if (com_perm->datum.name == class_perm->datum.name) {
@@ -1234,7 +1236,7 @@ int __cil_verify_class(struct cil_tree_node *node)
 	return SEPOL_OK;
 
 exit:
-	cil_log(CIL_ERR, "Invalid class at line %d of %s\n", node->line, node->path);
+	cil_log(CIL_ERR, "Invalid class at line %d of %s\n", cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1252,7 +1254,7 @@ int __cil_verify_policycap(struct cil_tree_node *node)
 
 exit:
 	cil_log(CIL_ERR, "Invalid policycap (%s) at line %d of %s\n", 
-		(const char*)polcap->datum.name, node->line, node->path);
+		(const char*)polcap->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 	return rc;
 }
 
@@ -1461,7 +1463,7 @@ static int __cil_verify_classpermission(struct cil_tree_node *node)
 
 	rc = __cil_verify_classperms(cp->classperms, &cp->datum);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR, "Found circular class permissions involving the set %s at line %d of %s\n",cp->datum.name, node->line, node->path);
+		cil_log(CIL_ERR, "Found circular class permissions involving the set %s at line %d of %s\n",cp->datum.name, cil_tree_node_line(node), cil_tree_node_path(node));
 		return rc;
 	}
 
@@ -1482,7 +1484,7 @@ static int __verify_map_perm_classperms(__attribute__((unused)) hashtab_key_t k,
 
 	rc = __cil_verify_classperms(cmp->classperms, &cmp->datum);
 	if (rc != SEPOL_OK) {
-		cil_log(CIL_ERR, "Found circular class permissions involving the map class %s and permission %s at line %d of %s\n", map_args->class->datum.name, cmp->datum.name, map_args->node->line, map_args->node->path);
+		cil_log(CIL_ERR, "Found circular class permissions involving the map class %s and permission %s at line %d of %s\n", map_args->class->datum.name, cmp->datum.name, cil_tree_node_line(map_args->node), cil_tree_node_path(map_args->node));
 		map_args->rc = SEPOL_ERR;
 	}
 
@@ -35,6 +35,7 @@
 #include "cil_internal.h"
 #include "cil_flavor.h"
 #include "cil_tree.h"
+#include "cil_parser.h"
 #include "cil_list.h"
 
 enum cil_syntax {
@@ -57,10 +58,10 @@ struct cil_args_verify {
 };
 
 int __cil_verify_name(const char *name);
-int __cil_verify_syntax(struct cil_tree_node *parse_current, enum cil_syntax s[], int len);
-int cil_verify_expr_syntax(struct cil_tree_node *current, enum cil_flavor op, enum cil_flavor expr_flavor);
+int __cil_verify_syntax(struct cil_parse_token *parse_current, enum cil_syntax s[], int len);
+int cil_verify_expr_syntax(struct cil_parse_token *current, enum cil_flavor op, enum cil_flavor expr_flavor);
 int cil_verify_constraint_leaf_expr_syntax(enum cil_flavor l_flavor, enum cil_flavor r_flavor, enum cil_flavor op, enum cil_flavor expr_flavor);
-int cil_verify_constraint_expr_syntax(struct cil_tree_node *current, enum cil_flavor op);
+int cil_verify_constraint_expr_syntax(struct cil_parse_token *current, enum cil_flavor op);
 int cil_verify_no_self_reference(struct cil_symtab_datum *datum, struct cil_list *datum_list);
 int __cil_verify_ranges(struct cil_list *list);
 int __cil_verify_ordered_node_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args);
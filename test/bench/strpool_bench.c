@@ -0,0 +1,159 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+/*
+ * Measures how cil_strpool_add() scales with the number of threads.
+ *
+ * For each thread count every thread first interns strings of its own
+ * (all misses), then looks up strings drawn from a set shared by all
+ * threads (all hits). Throughput is reported in millions of calls per
+ * second across all threads.
+ *
+ * usage: strpool_bench [max threads] [calls per thread]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "../../src/cil_strpool.h"
+
+#define BENCH_SHARED	(1 << 16)
+#define BENCH_NAME_SIZE	48
+
+struct bench_thread {
+	pthread_t thread;
+	pthread_barrier_t *barrier;
+	int id;
+	int calls;
+	char (*names)[BENCH_NAME_SIZE];
+	char (*shared)[BENCH_NAME_SIZE];
+};
+
+static double bench_now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *bench_worker(void *arg)
+{
+	struct bench_thread *t = arg;
+	uint32_t seed = t->id * 2654435761U + 1;
+	int i;
+
+	pthread_barrier_wait(t->barrier);
+	for (i = 0; i < t->calls; i++) {
+		cil_strpool_add(t->names[i]);
+	}
+
+	pthread_barrier_wait(t->barrier);
+	for (i = 0; i < t->calls; i++) {
+		seed = seed * 1103515245 + 12345;
+		cil_strpool_add(t->shared[(seed >> 8) % BENCH_SHARED]);
+	}
+	pthread_barrier_wait(t->barrier);
+
+	return NULL;
+}
+
+/* The main thread takes part in the barriers so that it can time each
+ * phase from the moment all threads are released */
+static void bench_run(int num_threads, int calls, char (*shared)[BENCH_NAME_SIZE])
+{
+	struct bench_thread *threads = calloc(num_threads, sizeof(*threads));
+	pthread_barrier_t barrier;
+	double start, insert, lookup;
+	int i, j;
+
+	cil_strpool_init();
+	for (i = 0; i < BENCH_SHARED; i++) {
+		cil_strpool_add(shared[i]);
+	}
+
+	pthread_barrier_init(&barrier, NULL, num_threads + 1);
+
+	for (i = 0; i < num_threads; i++) {
+		threads[i].barrier = &barrier;
+		threads[i].id = i;
+		threads[i].calls = calls;
+		threads[i].shared = shared;
+		threads[i].names = malloc(sizeof(*threads[i].names) * calls);
+		for (j = 0; j < calls; j++) {
+			snprintf(threads[i].names[j], BENCH_NAME_SIZE, "thread%d_symbol%d", i, j);
+		}
+		pthread_create(&threads[i].thread, NULL, bench_worker, &threads[i]);
+	}
+
+	pthread_barrier_wait(&barrier);
+	start = bench_now();
+	pthread_barrier_wait(&barrier);
+	insert = bench_now() - start;
+	start = bench_now();
+	pthread_barrier_wait(&barrier);
+	lookup = bench_now() - start;
+
+	for (i = 0; i < num_threads; i++) {
+		pthread_join(threads[i].thread, NULL);
+		free(threads[i].names);
+	}
+
+	printf("%7d %14.2f %14.2f\n", num_threads, (double)num_threads * calls / insert / 1e6, (double)num_threads * calls / lookup / 1e6);
+
+	pthread_barrier_destroy(&barrier);
+	free(threads);
+	cil_strpool_destroy();
+}
+
+int main(int argc, char *argv[])
+{
+	int max_threads = argc > 1 ? atoi(argv[1]) : 32;
+	int calls = argc > 2 ? atoi(argv[2]) : 200000;
+	char (*shared)[BENCH_NAME_SIZE] = malloc(sizeof(*shared) * BENCH_SHARED);
+	int num_threads;
+	int i;
+
+	for (i = 0; i < BENCH_SHARED; i++) {
+		snprintf(shared[i], BENCH_NAME_SIZE, "shared_symbol%d", i);
+	}
+
+	printf("threads  insert Mops/s  lookup Mops/s\n");
+	for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+		bench_run(num_threads, calls, shared);
+	}
+
+	free(shared);
+
+	return 0;
+}
@@ -42,8 +42,17 @@
 #include "test_cil.h"
 #include "test_cil_tree.h"
 #include "test_cil_list.h"
+#include "test_cil_vector.h"
+#include "test_cil_index.h"
 #include "test_cil_symtab.h"
 #include "test_cil_parser.h"
+#include "test_cil_parse_cache.h"
+#include "test_cil_snapshot.h"
+#include "test_cil_concurrent.h"
+#include "test_cil_deps.h"
+#include "test_cil_resolve_cache.h"
+#include "test_cil_strpool.h"
+#include "test_cil_arena.h"
 #include "test_cil_lexer.h"
 #include "test_cil_build_ast.h"
 #include "test_cil_resolve_ast.h"
@@ -97,31 +106,31 @@ void gen_test_tree(struct cil_tree **test_root, char *line[]) {
 	do {
 	    if (*i[0] == '(') {
 	        cil_tree_node_init(&node);
-	        node->parent = current;
+	        cil_tree_node_set_parent(node, current);
 	        node->flavor = CIL_PARSE_NODE;
-	        node->line = 0;
-	        if (current->cl_head == NULL)
-	            current->cl_head = node;
+	        node->loc = 0;
+	        if (cil_tree_node_head(current) == NULL)
+	            cil_tree_node_set_head(current, node);
 	        else
-	            current->cl_tail->next = node;
-	        current->cl_tail = node;
+	            cil_tree_node_set_next(cil_tree_node_tail(current), node);
+	        cil_tree_node_set_tail(current, node);
 	        current = node;
 	    }
 	    else if (*i[0] == ')')
-	        current = current->parent;
+	        current = cil_tree_node_parent(current);
 	    else {
 	        cil_tree_node_init(&item);
-	        item->parent = current;
+	        cil_tree_node_set_parent(item, current);
 	        item->data = cil_strdup(*i);
 	        item->flavor = CIL_PARSE_NODE;
-	        item->line = 0;
-	        if (current->cl_head == NULL) {
-	            current->cl_head = item;
+	        item->loc = 0;
+	        if (cil_tree_node_head(current) == NULL) {
+	            cil_tree_node_set_head(current, item);
 	        }
 	        else {
-	            current->cl_tail->next = item;
+	            cil_tree_node_set_next(cil_tree_node_tail(current), item);
 	        }
-	        current->cl_tail = item;
+	        cil_tree_node_set_tail(current, item);
 	    }
 	    i++;
 	} while(*i != NULL);
@@ -1767,20 +1776,99 @@ CuSuite* CilTreeGetSuite(void) {
 
 	/* test_cil_symtab.c */
 	SUITE_ADD_TEST(suite, test_cil_symtab_insert);
+	SUITE_ADD_TEST(suite, test_cil_symtab_get_datum);
+	SUITE_ADD_TEST(suite, test_cil_symtab_remove_grow);
+	SUITE_ADD_TEST(suite, test_cil_complex_symtab_insert);
 
 
 	/* test_cil_tree.c */
 	SUITE_ADD_TEST(suite, test_cil_tree_init);
 	SUITE_ADD_TEST(suite, test_cil_tree_node_init);
+	SUITE_ADD_TEST(suite, test_cil_tree_walk_fused);
 
 
 	/* test_cil_lexer.c */
 	SUITE_ADD_TEST(suite, test_cil_lexer_setup);
 	SUITE_ADD_TEST(suite, test_cil_lexer_next);
+	SUITE_ADD_TEST(suite, test_cil_lexer_setup_no_nul_neg);
+	SUITE_ADD_TEST(suite, test_cil_lexer_next_lines);
+	SUITE_ADD_TEST(suite, test_cil_lexer_next_long_symbol);
+	SUITE_ADD_TEST(suite, test_cil_lexer_next_unterminated_qstring_neg);
+	SUITE_ADD_TEST(suite, test_cil_lexer_next_interleaved);
+	SUITE_ADD_TEST(suite, test_cil_lexer_next_read_only);
 
 
 	/* test_cil_parser.c */
 	SUITE_ADD_TEST(suite, test_cil_parser);
+	SUITE_ADD_TEST(suite, test_cil_parser_stream);
+	SUITE_ADD_TEST(suite, test_cil_parser_stream_unbalanced_neg);
+	SUITE_ADD_TEST(suite, test_cil_parser_tokens);
+	SUITE_ADD_TEST(suite, test_cil_add_stream);
+	SUITE_ADD_TEST(suite, test_cil_add_stream_bare_cr);
+	SUITE_ADD_TEST(suite, test_cil_add_stream_unbalanced_neg);
+	SUITE_ADD_TEST(suite, test_cil_add_files_build_on_parse);
+	SUITE_ADD_TEST(suite, test_cil_add_files_build_on_parse_unbalanced_neg);
+
+
+	/* test_cil_parse_cache.c */
+	SUITE_ADD_TEST(suite, test_cil_parse_cache_parse);
+	SUITE_ADD_TEST(suite, test_cil_parse_cache_parse_truncated);
+	SUITE_ADD_TEST(suite, test_cil_parse_cache_init_nodir_neg);
+
+
+	/* test_cil_snapshot.c */
+	SUITE_ADD_TEST(suite, test_cil_snapshot_save_load);
+	SUITE_ADD_TEST(suite, test_cil_snapshot_save_load_evaluated);
+	SUITE_ADD_TEST(suite, test_cil_snapshot_load_twice);
+	SUITE_ADD_TEST(suite, test_cil_snapshot_save_uncompiled_neg);
+	SUITE_ADD_TEST(suite, test_cil_snapshot_load_damaged_neg);
+
+	/* test_cil_concurrent.c */
+	SUITE_ADD_TEST(suite, test_cil_compile_concurrent);
+	SUITE_ADD_TEST(suite, test_cil_resolve_jobs);
+	SUITE_ADD_TEST(suite, test_cil_db_log_handler);
+
+	/* test_cil_deps.c */
+	SUITE_ADD_TEST(suite, test_cil_deps_same_as_full_reset);
+	SUITE_ADD_TEST(suite, test_cil_deps_worklists_match_tree_walk);
+
+
+	/* test_cil_resolve_cache.c */
+	SUITE_ADD_TEST(suite, test_cil_resolve_cache_insert);
+	SUITE_ADD_TEST(suite, test_cil_resolve_cache_grow);
+	SUITE_ADD_TEST(suite, test_cil_resolve_cache_flush);
+	SUITE_ADD_TEST(suite, test_cil_resolve_cache_invalidate);
+
+
+	/* test_cil_strpool.c */
+	SUITE_ADD_TEST(suite, test_cil_strpool_add);
+	SUITE_ADD_TEST(suite, test_cil_strpool_add_grow);
+	SUITE_ADD_TEST(suite, test_cil_strpool_keyword);
+	SUITE_ADD_TEST(suite, test_cil_strpool_name);
+	SUITE_ADD_TEST(suite, test_cil_strpool_threads);
+
+
+	/* test_cil_vector.c */
+	SUITE_ADD_TEST(suite, test_cil_vector_append_inline);
+	SUITE_ADD_TEST(suite, test_cil_vector_append_grow);
+	SUITE_ADD_TEST(suite, test_cil_vector_remove);
+	SUITE_ADD_TEST(suite, test_cil_array_grow);
+
+
+	/* test_cil_index.c */
+	SUITE_ADD_TEST(suite, test_cil_index_build);
+	SUITE_ADD_TEST(suite, test_cil_index_walk);
+	SUITE_ADD_TEST(suite, test_cil_index_walk_too_many);
+
+
+	/* test_cil_arena.c */
+	SUITE_ADD_TEST(suite, test_cil_arena_alloc);
+	SUITE_ADD_TEST(suite, test_cil_arena_release);
+	SUITE_ADD_TEST(suite, test_cil_arena_reset);
+	SUITE_ADD_TEST(suite, test_cil_arena_large);
+	SUITE_ADD_TEST(suite, test_cil_arena_owned);
+	SUITE_ADD_TEST(suite, test_cil_arena_nodes);
+	SUITE_ADD_TEST(suite, test_cil_arena_defer);
 
 
 	/* test_cil_fqn.c */
@@ -58,7 +58,7 @@ void test_cil_db_init(CuTest *tc) {
 // TODO: Reach SEPOL_ERR return in cil_db_init ( currently can't produce a method to do so )
 
 void test_cil_get_symtab_block(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -66,17 +66,17 @@ void test_cil_get_symtab_block(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->parent->flavor = CIL_BLOCK;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	cil_tree_node_parent(test_ast_node)->flavor = CIL_BLOCK;
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, symtab);
 }
 
 void test_cil_get_symtab_class(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -84,17 +84,17 @@ void test_cil_get_symtab_class(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->parent->flavor = CIL_CLASS;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	cil_tree_node_parent(test_ast_node)->flavor = CIL_CLASS;
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, symtab);
 }
 
 void test_cil_get_symtab_root(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -102,17 +102,17 @@ void test_cil_get_symtab_root(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->parent->flavor = CIL_ROOT;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	cil_tree_node_parent(test_ast_node)->flavor = CIL_ROOT;
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, symtab);
 }
 
 void test_cil_get_symtab_flavor_neg(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -120,17 +120,17 @@ void test_cil_get_symtab_flavor_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->parent->flavor = 1234567;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	cil_tree_node_parent(test_ast_node)->flavor = 1234567;
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertPtrEquals(tc, symtab, NULL);
 }
 
 void test_cil_get_symtab_null_neg(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -138,16 +138,16 @@ void test_cil_get_symtab_null_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = NULL;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, NULL);
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertPtrEquals(tc, symtab, NULL);
 }
 
 void test_cil_get_symtab_node_null_neg(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node = NULL;
 
@@ -161,7 +161,7 @@ void test_cil_get_symtab_node_null_neg(CuTest *tc) {
 }
 
 void test_cil_get_symtab_parent_null_neg(CuTest *tc) {
-	symtab_t *symtab = NULL;
+	struct cil_symtab *symtab = NULL;
 	
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
@@ -169,10 +169,10 @@ void test_cil_get_symtab_parent_null_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = NULL;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, NULL);
+	test_ast_node->loc = 0;
 
-	int rc = cil_get_symtab(test_db, test_ast_node->parent, &symtab, CIL_SYM_BLOCKS);
+	int rc = cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &symtab, CIL_SYM_BLOCKS);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertPtrEquals(tc, symtab, NULL);
 }
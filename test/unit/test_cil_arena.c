@@ -0,0 +1,237 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "CuTest.h"
+#include "test_cil_arena.h"
+
+#include "../../src/cil_arena.h"
+#include "../../src/cil_tree.h"
+
+void test_cil_arena_alloc(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	char *a;
+	char *b;
+	char *big;
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	a = cil_arena_alloc(13);
+	b = cil_arena_alloc(8);
+	CuAssertTrue(tc, ((uintptr_t)a & 7) == 0);
+	CuAssertTrue(tc, ((uintptr_t)b & 7) == 0);
+	CuAssertPtrEquals(tc, a + 16, b);
+
+	big = cil_arena_alloc(3 << 20);
+	memset(big, 0xff, 3 << 20);
+	CuAssertPtrEquals(tc, a + 24, cil_arena_alloc(8));
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+	CuAssertPtrEquals(tc, NULL, arena);
+}
+
+void test_cil_arena_release(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	void *a;
+	void *b;
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	a = cil_arena_alloc(40);
+	b = cil_arena_alloc(40);
+	cil_arena_release(a, 40);
+	cil_arena_release(b, 40);
+	CuAssertPtrEquals(tc, b, cil_arena_alloc(40));
+	CuAssertPtrEquals(tc, a, cil_arena_alloc(40));
+
+	/* Objects go back to the arena that made them */
+	cil_arena_enter(prev);
+	cil_arena_release(a, 40);
+	prev = cil_arena_enter(arena);
+	CuAssertPtrEquals(tc, a, cil_arena_alloc(40));
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+}
+
+void test_cil_arena_reset(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	void *first;
+	int i;
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	first = cil_arena_alloc(64);
+	for (i = 0; i < 50000; i++) {
+		cil_arena_alloc(64);
+	}
+	cil_arena_release(first, 64);
+
+	cil_arena_reset(arena);
+	CuAssertPtrEquals(tc, first, cil_arena_alloc(64));
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+}
+
+void test_cil_arena_large(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	void *a;
+	void *big;
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	/* Sizes over 1K share the free list of their power of two */
+	a = cil_arena_alloc(3000);
+	cil_arena_release(a, 3000);
+	CuAssertPtrEquals(tc, a, cil_arena_alloc(3500));
+
+	big = cil_arena_alloc(3 << 20);
+	memset(big, 0xff, 3 << 20);
+	cil_arena_release(big, 3 << 20);
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+}
+
+static int test_cil_arena_destroyed;
+
+static void test_cil_arena_owned_destroy(void *ptr)
+{
+	test_cil_arena_destroyed += *(int *)ptr;
+}
+
+void test_cil_arena_owned(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	int *a;
+	int *b;
+	int *c;
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	a = cil_arena_alloc_owned(sizeof(*a), test_cil_arena_owned_destroy);
+	b = cil_arena_alloc_owned(sizeof(*b), test_cil_arena_owned_destroy);
+	c = cil_arena_alloc_owned(sizeof(*c), test_cil_arena_owned_destroy);
+	*a = 1;
+	*b = 10;
+	*c = 100;
+
+	test_cil_arena_destroyed = 0;
+	cil_arena_release_owned(b, sizeof(*b));
+	CuAssertIntEquals(tc, 10, test_cil_arena_destroyed);
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+	CuAssertIntEquals(tc, 111, test_cil_arena_destroyed);
+}
+
+void test_cil_arena_nodes(CuTest *tc) {
+	struct cil_arena *arena;
+	struct cil_arena *prev;
+	struct cil_tree_node *parent;
+	struct cil_tree_node *child;
+	struct cil_tree_node *first;
+
+	CuAssertIntEquals(tc, CIL_ARENA_NODE_SIZE, sizeof(struct cil_tree_node));
+
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+
+	cil_tree_node_init(&parent);
+	cil_tree_node_init(&child);
+	first = parent;
+	CuAssertTrue(tc, CIL_TREE_INDEX(parent) != 0);
+	CuAssertPtrEquals(tc, NULL, CIL_TREE_NODE(CIL_TREE_INDEX(NULL)));
+
+	cil_tree_node_set_head(parent, child);
+	cil_tree_node_set_parent(child, parent);
+	CuAssertPtrEquals(tc, child, cil_tree_node_head(parent));
+	CuAssertPtrEquals(tc, parent, cil_tree_node_parent(child));
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_next(child));
+
+	cil_tree_node_destroy(&child);
+	cil_tree_node_init(&child);
+	CuAssertPtrEquals(tc, child, cil_tree_node_head(parent));
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+
+	/* The blocks of a destroyed arena go to the next one */
+	cil_arena_init(&arena);
+	prev = cil_arena_enter(arena);
+	cil_tree_node_init(&parent);
+	CuAssertPtrEquals(tc, first, parent);
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&arena);
+}
+
+void test_cil_arena_defer(CuTest *tc) {
+	struct cil_arena *owner;
+	struct cil_arena *worker;
+	struct cil_arena *prev;
+	void *a;
+	void *b;
+
+	cil_arena_init(&owner);
+	cil_arena_init(&worker);
+	prev = cil_arena_enter(owner);
+	a = cil_arena_alloc(40);
+
+	/* Objects of other arenas wait on the deferring arena */
+	cil_arena_enter(worker);
+	cil_arena_defer(worker);
+	b = cil_arena_alloc(40);
+	cil_arena_release(a, 40);
+	cil_arena_release(b, 40);
+	CuAssertPtrEquals(tc, b, cil_arena_alloc(40));
+
+	cil_arena_enter(owner);
+	CuAssertTrue(tc, cil_arena_alloc(40) != a);
+
+	cil_arena_release_deferred(worker);
+	CuAssertPtrEquals(tc, a, cil_arena_alloc(40));
+
+	cil_arena_enter(prev);
+	cil_arena_destroy(&worker);
+	cil_arena_destroy(&owner);
+}
@@ -67,23 +67,23 @@ void test_cil_parse_to_list(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_avrule *test_avrule;
 	cil_avrule_init(&test_avrule);
 	test_avrule->rule_kind = CIL_AVRULE_ALLOWED;
-	test_avrule->src_str = cil_strdup(test_current->next->data);
-	test_avrule->tgt_str = cil_strdup(test_current->next->next->data);
+	test_avrule->src_str = cil_strdup(cil_tree_node_next(test_current)->data);
+	test_avrule->tgt_str = cil_strdup(cil_tree_node_next(cil_tree_node_next(test_current))->data);
 
 	cil_classpermset_init(&test_avrule->classpermset);
 
-	test_avrule->classpermset->class_str = cil_strdup(test_current->next->next->next->cl_head->data);
+	test_avrule->classpermset->class_str = cil_strdup(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))->data);
 
 	cil_permset_init(&test_avrule->classpermset->permset);
 
 	cil_list_init(&test_avrule->classpermset->permset->perms_list_str);
 
-	test_current = test_current->next->next->next->cl_head->next->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))));
 
 	int rc = cil_parse_to_list(test_current, test_avrule->classpermset->permset->perms_list_str, CIL_AST_STR);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -98,17 +98,17 @@ void test_cil_parse_to_list_currnull_neg(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_avrule *test_avrule;
 	cil_avrule_init(&test_avrule);
 	test_avrule->rule_kind = CIL_AVRULE_ALLOWED;
-	test_avrule->src_str = cil_strdup(test_current->next->data);
-	test_avrule->tgt_str = cil_strdup(test_current->next->next->data);
+	test_avrule->src_str = cil_strdup(cil_tree_node_next(test_current)->data);
+	test_avrule->tgt_str = cil_strdup(cil_tree_node_next(cil_tree_node_next(test_current))->data);
 
 	cil_classpermset_init(&test_avrule->classpermset);
 
-	test_avrule->classpermset->class_str = cil_strdup(test_current->next->next->next->cl_head->data);
+	test_avrule->classpermset->class_str = cil_strdup(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))->data);
 
 	cil_permset_init(&test_avrule->classpermset->permset);
 
@@ -129,21 +129,21 @@ void test_cil_parse_to_list_listnull_neg(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_avrule *test_avrule;
 	cil_avrule_init(&test_avrule);
 	test_avrule->rule_kind = CIL_AVRULE_ALLOWED;
-	test_avrule->src_str = cil_strdup(test_current->next->data);
-	test_avrule->tgt_str = cil_strdup(test_current->next->next->data);
+	test_avrule->src_str = cil_strdup(cil_tree_node_next(test_current)->data);
+	test_avrule->tgt_str = cil_strdup(cil_tree_node_next(cil_tree_node_next(test_current))->data);
 
 	cil_classpermset_init(&test_avrule->classpermset);
 
-	test_avrule->classpermset->class_str = cil_strdup(test_current->next->next->next->cl_head->data);
+	test_avrule->classpermset->class_str = cil_strdup(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))->data);
 
 	cil_permset_init(&test_avrule->classpermset->permset);
 
-	test_current = test_current->next->next->next->cl_head->next->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))));
 
 	int rc = cil_parse_to_list(test_current, test_avrule->classpermset->permset->perms_list_str, CIL_AST_STR);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -161,7 +161,7 @@ void test_cil_set_to_list(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 	cil_list_init(&cil_l);
 
-	int rc = cil_set_to_list(test_tree->root->cl_head, cil_l, 1);
+	int rc = cil_set_to_list(cil_tree_node_head(test_tree->root), cil_l, 1);
 	sub_list = (struct cil_list *)cil_l->head->next->next->data;
 
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -185,7 +185,7 @@ void test_cil_set_to_list_cl_head_null_neg(CuTest *tc) {
 
 	cil_list_init(&cil_l);
 	gen_test_tree(&test_tree, line);
-	test_tree->root->cl_head = NULL;
+	cil_tree_node_set_head(test_tree->root, NULL);
 
 	int rc = cil_set_to_list(test_tree->root, cil_l, 1);
 
@@ -215,10 +215,10 @@ void test_cil_gen_block(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, ((struct cil_block*)test_ast_node->data)->is_abstract, 0);
@@ -237,10 +237,10 @@ void test_cil_gen_block_justblock_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -256,10 +256,10 @@ void test_cil_gen_block_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -274,7 +274,7 @@ void test_cil_gen_block_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -287,15 +287,15 @@ void test_cil_gen_block_treenull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_tree->root->cl_head->cl_head = NULL;
+	cil_tree_node_set_head(cil_tree_node_head(test_tree->root), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -310,7 +310,7 @@ void test_cil_gen_block_nodenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -326,10 +326,10 @@ void test_cil_gen_block_nodeparentnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = NULL;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, NULL);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	int rc = cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -345,10 +345,10 @@ void test_cil_destroy_block(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 
 	cil_destroy_block((struct cil_block*)test_ast_node->data);
 	CuAssertPtrEquals(tc, NULL,test_ast_node->data);
@@ -366,10 +366,10 @@ void test_cil_gen_blockinherit(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -385,10 +385,10 @@ void test_cil_gen_blockinherit_namelist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -404,10 +404,10 @@ void test_cil_gen_blockinherit_namenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -423,10 +423,10 @@ void test_cil_gen_blockinherit_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -441,7 +441,7 @@ void test_cil_gen_blockinherit_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -457,10 +457,10 @@ void test_cil_gen_blockinherit_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -475,7 +475,7 @@ void test_cil_gen_blockinherit_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_blockinherit(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_blockinherit(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -499,12 +499,12 @@ void test_cil_gen_perm(CuTest *tc) {
 	new_tree_node->data = new_node;
 	new_tree_node->flavor = CIL_CLASS;
 
-	test_ast_node->parent = new_tree_node;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, new_tree_node);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node);
-	int rc1 = cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head->next, test_ast_node);
-	int rc2 = cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head->next->next, test_ast_node);
+	int rc = cil_gen_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node);
+	int rc1 = cil_gen_perm(test_db, cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))), test_ast_node);
+	int rc2 = cil_gen_perm(test_db, cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
@@ -524,11 +524,11 @@ void test_cil_gen_perm_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	test_current_perm = test_tree->root->cl_head->cl_head->next->next->cl_head;
+	test_current_perm = cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))));
 
 	cil_tree_node_init(&test_new_ast);
-	test_new_ast->parent = test_ast_node;
-	test_new_ast->line = test_current_perm->line;
+	cil_tree_node_set_parent(test_new_ast, test_ast_node);
+	test_new_ast->loc = test_current_perm->loc;
 
 	rc = cil_gen_perm(test_db, test_current_perm, test_new_ast);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -549,13 +549,13 @@ void test_cil_gen_perm_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	test_current_perm = NULL; 
 
 	cil_tree_node_init(&test_new_ast);
-	test_new_ast->parent = test_ast_node;
+	cil_tree_node_set_parent(test_new_ast, test_ast_node);
 
 	rc = cil_gen_perm(test_db, test_current_perm, test_new_ast);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -580,7 +580,7 @@ void test_cil_gen_perm_astnull_neg(CuTest *tc) {
 	new_tree_node->data = new_node;
 	new_tree_node->flavor = CIL_CLASS;
 
-	int rc = cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -598,11 +598,11 @@ void test_cil_gen_perm_nodenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_current_perm = test_tree->root->cl_head->cl_head->next->next->cl_head;
+	test_current_perm = cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))));
 
 	cil_tree_node_init(&test_new_ast);
-	test_new_ast->parent = test_ast_node;
-	test_new_ast->line = test_current_perm->line;
+	cil_tree_node_set_parent(test_new_ast, test_ast_node);
+	test_new_ast->loc = test_current_perm->loc;
 
 	rc = cil_gen_perm(test_db, test_current_perm, test_new_ast);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -620,10 +620,10 @@ void test_cil_gen_permset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -639,10 +639,10 @@ void test_cil_gen_permset_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -658,10 +658,10 @@ void test_cil_gen_permset_nameinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -677,10 +677,10 @@ void test_cil_gen_permset_noperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -696,10 +696,10 @@ void test_cil_gen_permset_emptyperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -715,10 +715,10 @@ void test_cil_gen_permset_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -733,7 +733,7 @@ void test_cil_gen_permset_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -749,10 +749,10 @@ void test_cil_gen_permset_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -767,7 +767,7 @@ void test_cil_gen_permset_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_permset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_permset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -783,19 +783,19 @@ void test_cil_gen_perm_nodes(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	char *test_key = test_tree->root->cl_head->cl_head->next->data;
+	char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
 	struct cil_class *test_cls;
 	cil_class_init(&test_cls);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
 	test_ast_node->data = test_cls;
 	test_ast_node->flavor = CIL_CLASS;
 
-	int rc = cil_gen_perm_nodes(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node, CIL_PERM);
+	int rc = cil_gen_perm_nodes(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node, CIL_PERM);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -811,21 +811,21 @@ void test_cil_gen_perm_nodes_failgen_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	char *test_key = test_tree->root->cl_head->cl_head->next->data;
+	char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
 	struct cil_class *test_cls;
 	cil_class_init(&test_cls);
 
 	cil_symtab_destroy(&test_cls->perms);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
 	test_ast_node->data = test_cls;
 	test_ast_node->flavor = CIL_CLASS;
 
-	int rc = cil_gen_perm_nodes(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node, CIL_PERM);
+	int rc = cil_gen_perm_nodes(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node, CIL_PERM);
 	CuAssertIntEquals(tc, SEPOL_ENOMEM, rc);
 }
 
@@ -841,19 +841,19 @@ void test_cil_gen_perm_nodes_inval_perm_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	char *test_key = test_tree->root->cl_head->cl_head->next->data;
+	char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
 	struct cil_class *test_cls;
 	cil_class_init(&test_cls);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
 	test_ast_node->data = test_cls;
 	test_ast_node->flavor = CIL_CLASS;
 
-	int rc = cil_gen_perm_nodes(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node, CIL_PERM);
+	int rc = cil_gen_perm_nodes(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node, CIL_PERM);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -869,7 +869,7 @@ void test_cil_fill_permset(CuTest *tc) {
 	struct cil_permset *permset;
 	cil_permset_init(&permset);
 
-	int rc = cil_fill_permset(test_tree->root->cl_head->cl_head->next->next->cl_head, permset);
+	int rc = cil_fill_permset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), permset);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -885,7 +885,7 @@ void test_cil_fill_permset_sublist_neg(CuTest *tc) {
 	struct cil_permset *permset;
 	cil_permset_init(&permset);
 
-	int rc = cil_fill_permset(test_tree->root->cl_head->cl_head->next->next->cl_head, permset);
+	int rc = cil_fill_permset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), permset);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -901,7 +901,7 @@ void test_cil_fill_permset_startpermnull_neg(CuTest *tc) {
 	struct cil_permset *permset;
 	cil_permset_init(&permset);
 
-	int rc = cil_fill_permset(test_tree->root->cl_head->cl_head->next->next->cl_head, permset);
+	int rc = cil_fill_permset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), permset);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -916,7 +916,7 @@ void test_cil_fill_permset_permsetnull_neg(CuTest *tc) {
 
 	struct cil_permset *permset = NULL;
 
-	int rc = cil_fill_permset(test_tree->root->cl_head->cl_head->next->next->cl_head, permset);
+	int rc = cil_fill_permset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), permset);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -932,10 +932,10 @@ void test_cil_gen_in(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -951,10 +951,10 @@ void test_cil_gen_in_blockstrnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -970,10 +970,10 @@ void test_cil_gen_in_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -988,7 +988,7 @@ void test_cil_gen_in_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1004,10 +1004,10 @@ void test_cil_gen_in_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1022,7 +1022,7 @@ void test_cil_gen_in_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_in(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_in(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1038,12 +1038,12 @@ void test_cil_gen_class(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
-	CuAssertPtrNotNull(tc, test_ast_node->cl_tail);
+	CuAssertPtrNotNull(tc, cil_tree_node_tail(test_ast_node));
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_CLASS);
 }
@@ -1060,10 +1060,10 @@ void test_cil_gen_class_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1078,7 +1078,7 @@ void test_cil_gen_class_nodenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1093,7 +1093,7 @@ void test_cil_gen_class_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1109,9 +1109,9 @@ void test_cil_gen_class_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_tree->root->cl_head->cl_head = NULL;
+	cil_tree_node_set_head(cil_tree_node_head(test_tree->root), NULL);
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1127,10 +1127,10 @@ void test_cil_gen_class_noclass_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1146,10 +1146,10 @@ void test_cil_gen_class_noclassname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1165,10 +1165,10 @@ void test_cil_gen_class_namesublist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1184,10 +1184,10 @@ void test_cil_gen_class_noperms(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1203,10 +1203,10 @@ void test_cil_gen_class_permsnotinlist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1222,10 +1222,10 @@ void test_cil_gen_class_extrapermlist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1241,10 +1241,10 @@ void test_cil_gen_class_listinlist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1260,7 +1260,7 @@ void test_cil_fill_classpermset_anonperms(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1276,7 +1276,7 @@ void test_cil_fill_classpermset_anonperms_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1292,7 +1292,7 @@ void test_cil_fill_classpermset_namedperms(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1308,7 +1308,7 @@ void test_cil_fill_classpermset_extra_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1324,7 +1324,7 @@ void test_cil_fill_classpermset_emptypermslist_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1340,7 +1340,7 @@ void test_cil_fill_classpermset_noperms_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1356,7 +1356,7 @@ void test_cil_fill_classpermset_noclass_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1372,7 +1372,7 @@ void test_cil_fill_classpermset_classnodenull_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1387,7 +1387,7 @@ void test_cil_fill_classpermset_cpsnull_neg(CuTest *tc) {
 
 	struct cil_classpermset *cps = NULL;
 
-	int rc = cil_fill_classpermset(test_tree->root->cl_head->cl_head->next->next->cl_head, cps);
+	int rc = cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), cps);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1403,10 +1403,10 @@ void test_cil_gen_classpermset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1422,10 +1422,10 @@ void test_cil_gen_classpermset_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1441,10 +1441,10 @@ void test_cil_gen_classpermset_nameinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1460,10 +1460,10 @@ void test_cil_gen_classpermset_noclass_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1479,10 +1479,10 @@ void test_cil_gen_classpermset_noperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1498,10 +1498,10 @@ void test_cil_gen_classpermset_emptyperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1517,10 +1517,10 @@ void test_cil_gen_classpermset_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1535,7 +1535,7 @@ void test_cil_gen_classpermset_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1551,10 +1551,10 @@ void test_cil_gen_classpermset_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1569,7 +1569,7 @@ void test_cil_gen_classpermset_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_classpermset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classpermset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1585,8 +1585,8 @@ void test_cil_gen_classmap_perm(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_classmap *map = NULL;
 	cil_classmap_init(&map);	
@@ -1597,11 +1597,10 @@ void test_cil_gen_classmap_perm(CuTest *tc) {
 	struct cil_tree_node *test_ast_node_a;
 	cil_tree_node_init(&test_ast_node_a);
 
-	test_ast_node_a->parent = test_ast_node;
-	test_ast_node_a->line = test_tree->root->cl_head->cl_head->next->next->cl_head->line;
-	test_ast_node_a->path = test_tree->root->cl_head->cl_head->next->next->cl_head->path;
+	cil_tree_node_set_parent(test_ast_node_a, test_ast_node);
+	test_ast_node_a->loc = cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))->loc;
 	
-	int rc = cil_gen_classmap_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node_a);
+	int rc = cil_gen_classmap_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node_a);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1617,19 +1616,18 @@ void test_cil_gen_classmap_perm_dupeperm_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_ast_node_a;
 	cil_tree_node_init(&test_ast_node_a);
 
-	test_ast_node_a->parent = test_ast_node;
-	test_ast_node_a->line = test_tree->root->cl_head->cl_head->next->next->cl_head->line;
-	test_ast_node_a->path = test_tree->root->cl_head->cl_head->next->next->cl_head->path; 
+	cil_tree_node_set_parent(test_ast_node_a, test_ast_node);
+	test_ast_node_a->loc = cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))->loc;
 	
-	int rc = cil_gen_classmap_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node_a);
+	int rc = cil_gen_classmap_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node_a);
 	CuAssertIntEquals(tc, SEPOL_EEXIST, rc);
 }
 
@@ -1645,21 +1643,20 @@ void test_cil_gen_classmap_perm_dbnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_ast_node_a;
 	cil_tree_node_init(&test_ast_node_a);
 
-	test_ast_node_a->parent = test_ast_node;
-	test_ast_node_a->line = test_tree->root->cl_head->cl_head->line;
-	test_ast_node_a->path = test_tree->root->cl_head->cl_head->path;
+	cil_tree_node_set_parent(test_ast_node_a, test_ast_node);
+	test_ast_node_a->loc = cil_tree_node_head(cil_tree_node_head(test_tree->root))->loc;
 
 	test_db = NULL;
 
-	int rc = cil_gen_classmap_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node_a);
+	int rc = cil_gen_classmap_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node_a);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1675,19 +1672,18 @@ void test_cil_gen_classmap_perm_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_ast_node_a;
 	cil_tree_node_init(&test_ast_node_a);
 
-	test_ast_node_a->parent = test_ast_node;
-	test_ast_node_a->line = test_tree->root->cl_head->cl_head->line;
-	test_ast_node_a->path = test_tree->root->cl_head->cl_head->path;
+	cil_tree_node_set_parent(test_ast_node_a, test_ast_node);
+	test_ast_node_a->loc = cil_tree_node_head(cil_tree_node_head(test_tree->root))->loc;
 
-	int rc = cil_gen_classmap_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node_a);
+	int rc = cil_gen_classmap_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node_a);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1703,14 +1699,14 @@ void test_cil_gen_classmap_perm_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_ast_node_a = NULL;
 
-	int rc = cil_gen_classmap_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node_a);
+	int rc = cil_gen_classmap_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node_a);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1726,10 +1722,10 @@ void test_cil_gen_classmap(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1745,10 +1741,10 @@ void test_cil_gen_classmap_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1764,10 +1760,10 @@ void test_cil_gen_classmap_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1783,10 +1779,10 @@ void test_cil_gen_classmap_emptyperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1801,7 +1797,7 @@ void test_cil_gen_classmap_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1817,10 +1813,10 @@ void test_cil_gen_classmap_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1835,7 +1831,7 @@ void test_cil_gen_classmap_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_classmap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1852,10 +1848,10 @@ void test_cil_gen_classmapping_anonpermset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1872,10 +1868,10 @@ void test_cil_gen_classmapping_anonpermset_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1891,10 +1887,10 @@ void test_cil_gen_classmapping_namedpermset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1910,10 +1906,10 @@ void test_cil_gen_classmapping_noclassmapname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1929,10 +1925,10 @@ void test_cil_gen_classmapping_noclassmapperm_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1948,10 +1944,10 @@ void test_cil_gen_classmapping_nopermissionsets_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1967,7 +1963,7 @@ void test_cil_gen_classmapping_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1983,10 +1979,10 @@ void test_cil_gen_classmapping_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2002,7 +1998,7 @@ void test_cil_gen_classmapping_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_classmapping(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_classmapping(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2018,10 +2014,10 @@ void test_cil_gen_common(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_COMMON);
@@ -2038,7 +2034,7 @@ void test_cil_gen_common_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2055,7 +2051,7 @@ void test_cil_gen_common_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2071,7 +2067,7 @@ void test_cil_gen_common_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2088,10 +2084,10 @@ void test_cil_gen_common_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2108,10 +2104,10 @@ void test_cil_gen_common_twoperms_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2128,10 +2124,10 @@ void test_cil_gen_common_permsublist_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2148,10 +2144,10 @@ void test_cil_gen_common_noperms_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
        
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2168,10 +2164,10 @@ void test_cil_gen_sid(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2187,10 +2183,10 @@ void test_cil_gen_sid_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2206,10 +2202,10 @@ void test_cil_gen_sid_nameinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2225,10 +2221,10 @@ void test_cil_gen_sid_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2243,7 +2239,7 @@ void test_cil_gen_sid_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2259,10 +2255,10 @@ void test_cil_gen_sid_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2277,7 +2273,7 @@ void test_cil_gen_sid_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2294,10 +2290,10 @@ void test_cil_gen_sidcontext(CuTest *tc) {
 	cil_db_init(&test_db);
 
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_SIDCONTEXT);
@@ -2315,10 +2311,10 @@ void test_cil_gen_sidcontext_namedcontext(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_SIDCONTEXT);
@@ -2336,10 +2332,10 @@ void test_cil_gen_sidcontext_halfcontext_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2355,10 +2351,10 @@ void test_cil_gen_sidcontext_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2374,10 +2370,10 @@ void test_cil_gen_sidcontext_empty_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2393,10 +2389,10 @@ void test_cil_gen_sidcontext_nocontext_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2412,10 +2408,10 @@ void test_cil_gen_sidcontext_dblname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2430,7 +2426,7 @@ void test_cil_gen_sidcontext_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2441,8 +2437,8 @@ void test_cil_gen_sidcontext_pcurrnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	int rc = cil_gen_sidcontext(test_db, NULL, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -2460,10 +2456,10 @@ void test_cil_gen_sidcontext_astnodenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, NULL);
+	int rc = cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2479,10 +2475,10 @@ void test_cil_gen_type(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPE);
@@ -2499,7 +2495,7 @@ void test_cil_gen_type_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2515,10 +2511,10 @@ void test_cil_gen_type_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2533,7 +2529,7 @@ void test_cil_gen_type_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2549,10 +2545,10 @@ void test_cil_gen_type_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2568,10 +2564,10 @@ void test_cil_gen_typeattribute(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPEATTRIBUTE);
@@ -2588,7 +2584,7 @@ void test_cil_gen_typeattribute_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2605,10 +2601,10 @@ void test_cil_gen_typeattribute_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2624,7 +2620,7 @@ void test_cil_gen_typeattribute_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2640,10 +2636,10 @@ void test_cil_gen_typeattribute_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2659,10 +2655,10 @@ void test_cil_gen_typebounds(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2678,10 +2674,10 @@ void test_cil_gen_typebounds_notype1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2697,10 +2693,10 @@ void test_cil_gen_typebounds_type1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2716,10 +2712,10 @@ void test_cil_gen_typebounds_notype2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2735,10 +2731,10 @@ void test_cil_gen_typebounds_type2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2754,10 +2750,10 @@ void test_cil_gen_typebounds_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2772,7 +2768,7 @@ void test_cil_gen_typebounds_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2788,10 +2784,10 @@ void test_cil_gen_typebounds_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2806,7 +2802,7 @@ void test_cil_gen_typebounds_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_typebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2822,10 +2818,10 @@ void test_cil_gen_typepermissive(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2841,10 +2837,10 @@ void test_cil_gen_typepermissive_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2860,10 +2856,10 @@ void test_cil_gen_typepermissive_typeinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2879,10 +2875,10 @@ void test_cil_gen_typepermissive_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2897,7 +2893,7 @@ void test_cil_gen_typepermissive_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 	
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2913,10 +2909,10 @@ void test_cil_gen_typepermissive_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2931,7 +2927,7 @@ void test_cil_gen_typepermissive_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_typepermissive(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typepermissive(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2947,10 +2943,10 @@ void test_cil_gen_nametypetransition(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2966,10 +2962,10 @@ void test_cil_gen_nametypetransition_strinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2985,10 +2981,10 @@ void test_cil_gen_nametypetransition_nostr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3004,10 +3000,10 @@ void test_cil_gen_nametypetransition_srcinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3023,10 +3019,10 @@ void test_cil_gen_nametypetransition_nosrc_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3042,10 +3038,10 @@ void test_cil_gen_nametypetransition_tgtinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3061,10 +3057,10 @@ void test_cil_gen_nametypetransition_notgt_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3080,10 +3076,10 @@ void test_cil_gen_nametypetransition_classinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3099,10 +3095,10 @@ void test_cil_gen_nametypetransition_noclass_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3118,10 +3114,10 @@ void test_cil_gen_nametypetransition_destinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3137,10 +3133,10 @@ void test_cil_gen_nametypetransition_nodest_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3157,10 +3153,10 @@ void test_cil_gen_nametypetransition_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3175,7 +3171,7 @@ void test_cil_gen_nametypetransition_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3191,10 +3187,10 @@ void test_cil_gen_nametypetransition_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3209,7 +3205,7 @@ void test_cil_gen_nametypetransition_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_nametypetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_nametypetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3225,10 +3221,10 @@ void test_cil_gen_rangetransition(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3244,10 +3240,10 @@ void test_cil_gen_rangetransition_namedtransition(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3263,10 +3259,10 @@ void test_cil_gen_rangetransition_anon_low_l(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3282,10 +3278,10 @@ void test_cil_gen_rangetransition_anon_low_l_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3301,10 +3297,10 @@ void test_cil_gen_rangetransition_anon_high_l(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3320,10 +3316,10 @@ void test_cil_gen_rangetransition_anon_high_l_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3338,7 +3334,7 @@ void test_cil_gen_rangetransition_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3354,10 +3350,10 @@ void test_cil_gen_rangetransition_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3372,7 +3368,7 @@ void test_cil_gen_rangetransition_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3388,10 +3384,10 @@ void test_cil_gen_rangetransition_nofirsttype_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3407,10 +3403,10 @@ void test_cil_gen_rangetransition_firsttype_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3426,10 +3422,10 @@ void test_cil_gen_rangetransition_nosecondtype_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3445,10 +3441,10 @@ void test_cil_gen_rangetransition_secondtype_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3464,10 +3460,10 @@ void test_cil_gen_rangetransition_noclass_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3483,10 +3479,10 @@ void test_cil_gen_rangetransition_class_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3502,10 +3498,10 @@ void test_cil_gen_rangetransition_nolevel_l_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3521,10 +3517,10 @@ void test_cil_gen_rangetransition_nolevel_h_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3540,10 +3536,10 @@ void test_cil_gen_rangetransition_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rangetransition(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rangetransition(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3560,13 +3556,13 @@ void test_cil_gen_expr_stack_and(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3583,13 +3579,13 @@ void test_cil_gen_expr_stack_or(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3606,13 +3602,13 @@ void test_cil_gen_expr_stack_xor(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3629,13 +3625,13 @@ void test_cil_gen_expr_stack_not(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3652,13 +3648,13 @@ void test_cil_gen_expr_stack_not_noexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3675,13 +3671,13 @@ void test_cil_gen_expr_stack_not_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3698,13 +3694,13 @@ void test_cil_gen_expr_stack_eq(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3721,13 +3717,13 @@ void test_cil_gen_expr_stack_neq(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3744,13 +3740,13 @@ void test_cil_gen_expr_stack_nested(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3767,13 +3763,13 @@ void test_cil_gen_expr_stack_nested_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3790,13 +3786,13 @@ void test_cil_gen_expr_stack_nested_emptyargs_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3813,13 +3809,13 @@ void test_cil_gen_expr_stack_nested_missingoperator_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3836,13 +3832,13 @@ void test_cil_gen_expr_stack_arg1null_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3859,13 +3855,13 @@ void test_cil_gen_expr_stack_arg2null_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3882,13 +3878,13 @@ void test_cil_gen_expr_stack_extraarg_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3904,13 +3900,13 @@ void test_cil_gen_expr_stack_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_booleanif *bif;
 	cil_boolif_init(&bif);
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, &bif->expr_stack);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, &bif->expr_stack);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3927,10 +3923,10 @@ void test_cil_gen_expr_stack_stacknull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_expr_stack(test_tree->root->cl_head->cl_head->next, CIL_BOOL, NULL);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), CIL_BOOL, NULL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3948,10 +3944,10 @@ void test_cil_gen_boolif_multiplebools_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3969,10 +3965,10 @@ void test_cil_gen_boolif_multiplebools_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3990,10 +3986,10 @@ void test_cil_gen_boolif_multiplebools_unknowncond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4010,10 +4006,10 @@ void test_cil_gen_boolif_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4030,10 +4026,10 @@ void test_cil_gen_boolif_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4050,10 +4046,10 @@ void test_cil_gen_boolif_unknowncond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4070,10 +4066,10 @@ void test_cil_gen_boolif_nested(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4090,10 +4086,10 @@ void test_cil_gen_boolif_nested_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4110,10 +4106,10 @@ void test_cil_gen_boolif_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4130,10 +4126,10 @@ void test_cil_gen_boolif_extra_parens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4150,10 +4146,10 @@ void test_cil_gen_boolif_nocond(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4170,10 +4166,10 @@ void test_cil_gen_boolif_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4189,7 +4185,7 @@ void test_cil_gen_boolif_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4205,10 +4201,10 @@ void test_cil_gen_boolif_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4224,7 +4220,7 @@ void test_cil_gen_boolif_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4240,10 +4236,10 @@ void test_cil_gen_boolif_nocond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4259,10 +4255,10 @@ void test_cil_gen_boolif_notruelist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4279,10 +4275,10 @@ void test_cil_gen_boolif_empty_cond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4300,10 +4296,10 @@ void test_cil_gen_tunif_multiplebools_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4321,10 +4317,10 @@ void test_cil_gen_tunif_multiplebools_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4342,10 +4338,10 @@ void test_cil_gen_tunif_multiplebools_unknowncond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4362,10 +4358,10 @@ void test_cil_gen_tunif_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4382,10 +4378,10 @@ void test_cil_gen_tunif_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4402,10 +4398,10 @@ void test_cil_gen_tunif_unknowncond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4422,10 +4418,10 @@ void test_cil_gen_tunif_nocond(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4442,10 +4438,10 @@ void test_cil_gen_tunif_nested(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4462,10 +4458,10 @@ void test_cil_gen_tunif_nested_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4482,10 +4478,10 @@ void test_cil_gen_tunif_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4502,10 +4498,10 @@ void test_cil_gen_tunif_extra_parens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4522,10 +4518,10 @@ void test_cil_gen_tunif_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4541,7 +4537,7 @@ void test_cil_gen_tunif_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4557,10 +4553,10 @@ void test_cil_gen_tunif_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4576,7 +4572,7 @@ void test_cil_gen_tunif_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4592,10 +4588,10 @@ void test_cil_gen_tunif_nocond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4611,10 +4607,10 @@ void test_cil_gen_tunif_notruelist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_tunif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_tunif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4630,10 +4626,10 @@ void test_cil_gen_condblock_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDTRUE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDTRUE);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4649,10 +4645,10 @@ void test_cil_gen_condblock_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDFALSE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDFALSE);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4667,7 +4663,7 @@ void test_cil_gen_condblock_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDFALSE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDFALSE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4683,10 +4679,10 @@ void test_cil_gen_condblock_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDFALSE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDFALSE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4701,7 +4697,7 @@ void test_cil_gen_condblock_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDFALSE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDFALSE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4717,10 +4713,10 @@ void test_cil_gen_condblock_nocond_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDTRUE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDTRUE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4736,10 +4732,10 @@ void test_cil_gen_condblock_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_condblock(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_CONDTRUE);
+	int rc = cil_gen_condblock(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_CONDTRUE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4755,13 +4751,13 @@ void test_cil_gen_typealias(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
-	CuAssertStrEquals(tc, ((struct cil_typealias*)test_ast_node->data)->type_str, test_tree->root->cl_head->cl_head->next->data);
+	CuAssertStrEquals(tc, ((struct cil_typealias*)test_ast_node->data)->type_str, cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPEALIAS);
 }
 
@@ -4777,10 +4773,10 @@ void test_cil_gen_typealias_incomplete_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4796,10 +4792,10 @@ void test_cil_gen_typealias_incomplete_neg2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4815,10 +4811,10 @@ void test_cil_gen_typealias_extratype_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4833,7 +4829,7 @@ void test_cil_gen_typealias_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4849,10 +4845,10 @@ void test_cil_gen_typealias_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4867,7 +4863,7 @@ void test_cil_gen_typealias_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4883,10 +4879,10 @@ void test_cil_gen_typeattributeset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 }
@@ -4903,10 +4899,10 @@ void test_cil_gen_typeattributeset_and_two_types(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 }
@@ -4923,10 +4919,10 @@ void test_cil_gen_typeattributeset_not(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 }
@@ -4943,10 +4939,10 @@ void test_cil_gen_typeattributeset_exclude_attr(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 }
@@ -4963,10 +4959,10 @@ void test_cil_gen_typeattributeset_exclude_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4981,7 +4977,7 @@ void test_cil_gen_typeattributeset_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4997,10 +4993,10 @@ void test_cil_gen_typeattributeset_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5015,7 +5011,7 @@ void test_cil_gen_typeattributeset_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5031,10 +5027,10 @@ void test_cil_gen_typeattributeset_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5050,10 +5046,10 @@ void test_cil_gen_typeattributeset_nameinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5069,10 +5065,10 @@ void test_cil_gen_typeattributeset_emptylists_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5088,10 +5084,10 @@ void test_cil_gen_typeattributeset_listinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5107,10 +5103,10 @@ void test_cil_gen_typeattributeset_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_typeattributeset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_typeattributeset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5126,10 +5122,10 @@ void test_cil_gen_userbounds(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 }
 
@@ -5145,10 +5141,10 @@ void test_cil_gen_userbounds_notype1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5164,10 +5160,10 @@ void test_cil_gen_userbounds_type1_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5183,10 +5179,10 @@ void test_cil_gen_userbounds_notype2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5202,10 +5198,10 @@ void test_cil_gen_userbounds_type2_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5221,10 +5217,10 @@ void test_cil_gen_userbounds_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5239,7 +5235,7 @@ void test_cil_gen_userbounds_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5255,10 +5251,10 @@ void test_cil_gen_userbounds_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5273,7 +5269,7 @@ void test_cil_gen_userbounds_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_userbounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userbounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -5289,10 +5285,10 @@ void test_cil_gen_role(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_ROLE);
@@ -5309,7 +5305,7 @@ void test_cil_gen_role_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -5326,7 +5322,7 @@ void test_cil_gen_role_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -5342,7 +5338,7 @@ void test_cil_gen_role_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -5359,10 +5355,10 @@ void test_cil_gen_role_extrarole_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -5379,10 +5375,10 @@ void test_cil_gen_role_noname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -5399,10 +5395,10 @@ void test_cil_gen_roletransition(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_ROLETRANSITION);
@@ -5424,7 +5420,7 @@ void test_cil_gen_roletransition_astnull_neg (CuTest *tc) {
 	
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5434,12 +5430,12 @@ void test_cil_gen_roletransition_srcnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5449,12 +5445,12 @@ void test_cil_gen_roletransition_tgtnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5464,12 +5460,12 @@ void test_cil_gen_roletransition_resultnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), NULL);
 
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5482,7 +5478,7 @@ void test_cil_gen_roletransition_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletransition(test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletransition(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5498,10 +5494,10 @@ void test_cil_gen_bool_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, ((struct cil_bool*)test_ast_node->data)->value, 1);
@@ -5520,10 +5516,10 @@ void test_cil_gen_bool_tunable_true(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_TUNABLE);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TUNABLE);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, ((struct cil_bool*)test_ast_node->data)->value, 1);
@@ -5542,10 +5538,10 @@ void test_cil_gen_bool_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, ((struct cil_bool*)test_ast_node->data)->value, 0);
@@ -5564,10 +5560,10 @@ void test_cil_gen_bool_tunable_false(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_TUNABLE);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TUNABLE);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, ((struct cil_bool*)test_ast_node->data)->value, 0);
@@ -5586,10 +5582,10 @@ void test_cil_gen_bool_none_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5604,7 +5600,7 @@ void test_cil_gen_bool_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5620,10 +5616,10 @@ void test_cil_gen_bool_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5638,7 +5634,7 @@ void test_cil_gen_bool_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5654,10 +5650,10 @@ void test_cil_gen_bool_notbool_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5673,10 +5669,10 @@ void test_cil_gen_bool_boolname_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5692,10 +5688,10 @@ void test_cil_gen_bool_extraname_false_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5711,10 +5707,10 @@ void test_cil_gen_bool_extraname_true_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	int rc = cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5729,18 +5725,18 @@ void test_cil_gen_constrain_expr_stack_eq2_t1type(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5755,17 +5751,17 @@ void test_cil_gen_constrain_expr_stack_eq2_t1t1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(parse_current))), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5780,17 +5776,17 @@ void test_cil_gen_constrain_expr_stack_eq2_t2type(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5805,17 +5801,17 @@ void test_cil_gen_constrain_expr_stack_eq2_t2t2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5830,17 +5826,17 @@ void test_cil_gen_constrain_expr_stack_eq2_r1role(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5855,17 +5851,17 @@ void test_cil_gen_constrain_expr_stack_eq2_r1r1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5880,17 +5876,17 @@ void test_cil_gen_constrain_expr_stack_eq2_r2role(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5905,17 +5901,17 @@ void test_cil_gen_constrain_expr_stack_eq2_r2r2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5930,17 +5926,17 @@ void test_cil_gen_constrain_expr_stack_eq2_t1t2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5955,17 +5951,17 @@ void test_cil_gen_constrain_expr_stack_eq_r1r2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5980,17 +5976,17 @@ void test_cil_gen_constrain_expr_stack_eq2_r1r2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6005,17 +6001,17 @@ void test_cil_gen_constrain_expr_stack_eq2_u1u2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6030,17 +6026,17 @@ void test_cil_gen_constrain_expr_stack_eq2_u1user(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6055,17 +6051,17 @@ void test_cil_gen_constrain_expr_stack_eq2_u1u1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6080,17 +6076,17 @@ void test_cil_gen_constrain_expr_stack_eq2_u2user(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6105,17 +6101,17 @@ void test_cil_gen_constrain_expr_stack_eq2_u2u2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6130,17 +6126,17 @@ void test_cil_gen_constrain_expr_stack_eq_l2h2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6155,17 +6151,17 @@ void test_cil_gen_constrain_expr_stack_eq_l2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6180,17 +6176,17 @@ void test_cil_gen_constrain_expr_stack_eq_l1l2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6205,17 +6201,17 @@ void test_cil_gen_constrain_expr_stack_eq_l1h1(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6230,17 +6226,17 @@ void test_cil_gen_constrain_expr_stack_eq_l1h2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6255,17 +6251,17 @@ void test_cil_gen_constrain_expr_stack_eq_h1l2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6280,17 +6276,17 @@ void test_cil_gen_constrain_expr_stack_eq_h1h2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6305,17 +6301,17 @@ void test_cil_gen_constrain_expr_stack_eq_h1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6330,17 +6326,17 @@ void test_cil_gen_constrain_expr_stack_eq_l1l1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6355,17 +6351,17 @@ void test_cil_gen_constrain_expr_stack_eq2_l1l2_constrain_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_CONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_CONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6380,17 +6376,17 @@ void test_cil_gen_constrain_expr_stack_eq_l1l2_constrain_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_CONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_CONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6405,17 +6401,17 @@ void test_cil_gen_constrain_expr_stack_eq_leftkeyword_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6430,17 +6426,17 @@ void test_cil_gen_constrain_expr_stack_eq_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6455,17 +6451,17 @@ void test_cil_gen_constrain_expr_stack_eq_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6480,17 +6476,17 @@ void test_cil_gen_constrain_expr_stack_eq_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6505,17 +6501,17 @@ void test_cil_gen_constrain_expr_stack_eq_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6530,17 +6526,17 @@ void test_cil_gen_constrain_expr_stack_eq_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6555,17 +6551,17 @@ void test_cil_gen_constrain_expr_stack_eq2(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6580,17 +6576,17 @@ void test_cil_gen_constrain_expr_stack_eq2_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6605,17 +6601,17 @@ void test_cil_gen_constrain_expr_stack_eq2_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6630,17 +6626,17 @@ void test_cil_gen_constrain_expr_stack_eq2_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6655,17 +6651,17 @@ void test_cil_gen_constrain_expr_stack_eq2_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6680,17 +6676,17 @@ void test_cil_gen_constrain_expr_stack_eq2_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6705,17 +6701,17 @@ void test_cil_gen_constrain_expr_stack_noteq(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6730,17 +6726,17 @@ void test_cil_gen_constrain_expr_stack_noteq_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6755,17 +6751,17 @@ void test_cil_gen_constrain_expr_stack_noteq_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6780,17 +6776,17 @@ void test_cil_gen_constrain_expr_stack_noteq_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6805,17 +6801,17 @@ void test_cil_gen_constrain_expr_stack_noteq_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6830,17 +6826,17 @@ void test_cil_gen_constrain_expr_stack_noteq_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6855,17 +6851,17 @@ void test_cil_gen_constrain_expr_stack_not(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6880,17 +6876,17 @@ void test_cil_gen_constrain_expr_stack_not_noexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6905,17 +6901,17 @@ void test_cil_gen_constrain_expr_stack_not_emptyparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6930,18 +6926,18 @@ void test_cil_gen_constrain_expr_stack_not_extraparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6957,17 +6953,17 @@ void test_cil_gen_constrain_expr_stack_or(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6983,17 +6979,17 @@ void test_cil_gen_constrain_expr_stack_or_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7008,17 +7004,17 @@ void test_cil_gen_constrain_expr_stack_or_noexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7033,18 +7029,18 @@ void test_cil_gen_constrain_expr_stack_or_emptyfirstparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7059,17 +7055,17 @@ void test_cil_gen_constrain_expr_stack_or_missingsecondexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7084,17 +7080,17 @@ void test_cil_gen_constrain_expr_stack_or_emptysecondparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7109,17 +7105,17 @@ void test_cil_gen_constrain_expr_stack_or_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7135,17 +7131,17 @@ void test_cil_gen_constrain_expr_stack_and(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7161,17 +7157,17 @@ void test_cil_gen_constrain_expr_stack_and_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7186,17 +7182,17 @@ void test_cil_gen_constrain_expr_stack_and_noexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7211,17 +7207,17 @@ void test_cil_gen_constrain_expr_stack_and_emptyfirstparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7236,17 +7232,17 @@ void test_cil_gen_constrain_expr_stack_and_missingsecondexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7261,17 +7257,17 @@ void test_cil_gen_constrain_expr_stack_and_emptysecondparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7286,17 +7282,17 @@ void test_cil_gen_constrain_expr_stack_and_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7311,17 +7307,17 @@ void test_cil_gen_constrain_expr_stack_dom(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7336,17 +7332,17 @@ void test_cil_gen_constrain_expr_stack_dom_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7361,17 +7357,17 @@ void test_cil_gen_constrain_expr_stack_dom_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7386,17 +7382,17 @@ void test_cil_gen_constrain_expr_stack_dom_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7411,17 +7407,17 @@ void test_cil_gen_constrain_expr_stack_dom_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7436,17 +7432,17 @@ void test_cil_gen_constrain_expr_stack_dom_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7461,17 +7457,17 @@ void test_cil_gen_constrain_expr_stack_domby(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7486,17 +7482,17 @@ void test_cil_gen_constrain_expr_stack_domby_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7511,17 +7507,17 @@ void test_cil_gen_constrain_expr_stack_domby_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7536,17 +7532,17 @@ void test_cil_gen_constrain_expr_stack_domby_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7561,17 +7557,17 @@ void test_cil_gen_constrain_expr_stack_domby_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7586,17 +7582,17 @@ void test_cil_gen_constrain_expr_stack_domby_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7611,17 +7607,17 @@ void test_cil_gen_constrain_expr_stack_incomp(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7636,17 +7632,17 @@ void test_cil_gen_constrain_expr_stack_incomp_noexpr1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7661,17 +7657,17 @@ void test_cil_gen_constrain_expr_stack_incomp_expr1inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7686,17 +7682,17 @@ void test_cil_gen_constrain_expr_stack_incomp_noexpr2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7711,17 +7707,17 @@ void test_cil_gen_constrain_expr_stack_incomp_expr2inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7736,17 +7732,17 @@ void test_cil_gen_constrain_expr_stack_incomp_extraexpr_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7761,17 +7757,17 @@ void test_cil_gen_constrain_expr_stack_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7786,17 +7782,17 @@ void test_cil_gen_constrain_expr_stack_stacknull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, NULL);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, NULL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7811,17 +7807,17 @@ void test_cil_gen_constrain_expr_stack_operatorinparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(parse_current)), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7836,17 +7832,17 @@ void test_cil_gen_constrain_expr_stack_incorrectcall_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	struct cil_tree_node *parse_current = test_tree->root->cl_head->cl_head;
+	struct cil_tree_node *parse_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	struct cil_constrain *cons;
 	cil_constrain_init(&cons);
 	cil_classpermset_init(&cons->classpermset);
-	cil_fill_classpermset(parse_current->next->cl_head, cons->classpermset);
+	cil_fill_classpermset(cil_tree_node_head(cil_tree_node_next(parse_current)), cons->classpermset);
 	
-	int rc = cil_gen_expr_stack(parse_current->next->next->cl_head->next->next, CIL_MLSCONSTRAIN, &cons->expr);
+	int rc = cil_gen_expr_stack(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(parse_current))))), CIL_MLSCONSTRAIN, &cons->expr);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7863,15 +7859,15 @@ void test_cil_gen_roleallow(CuTest *tc) {
 	cil_db_init(&test_db);
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
-	CuAssertStrEquals(tc, ((struct cil_roleallow*)test_ast_node->data)->src_str, test_current->next->data);
-	CuAssertStrEquals(tc, ((struct cil_roleallow*)test_ast_node->data)->tgt_str, test_current->next->next->data);
+	CuAssertStrEquals(tc, ((struct cil_roleallow*)test_ast_node->data)->src_str, cil_tree_node_next(test_current)->data);
+	CuAssertStrEquals(tc, ((struct cil_roleallow*)test_ast_node->data)->tgt_str, cil_tree_node_next(cil_tree_node_next(test_current))->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_ROLEALLOW);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7887,7 +7883,7 @@ void test_cil_gen_roleallow_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7913,7 +7909,7 @@ void test_cil_gen_roleallow_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7923,7 +7919,7 @@ void test_cil_gen_roleallow_srcnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -7931,7 +7927,7 @@ void test_cil_gen_roleallow_srcnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7941,7 +7937,7 @@ void test_cil_gen_roleallow_tgtnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -7949,7 +7945,7 @@ void test_cil_gen_roleallow_tgtnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7965,7 +7961,7 @@ void test_cil_gen_roleallow_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roleallow(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roleallow(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7981,10 +7977,10 @@ void test_cil_gen_rolebounds(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 }
 
@@ -8000,10 +7996,10 @@ void test_cil_gen_rolebounds_norole1_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8019,10 +8015,10 @@ void test_cil_gen_rolebounds_role1_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8038,10 +8034,10 @@ void test_cil_gen_rolebounds_norole2_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8057,10 +8053,10 @@ void test_cil_gen_rolebounds_role2_inparens_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8076,10 +8072,10 @@ void test_cil_gen_rolebounds_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8094,7 +8090,7 @@ void test_cil_gen_rolebounds_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8110,10 +8106,10 @@ void test_cil_gen_rolebounds_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8128,7 +8124,7 @@ void test_cil_gen_rolebounds_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_rolebounds(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_rolebounds(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, rc, SEPOL_ERR);
 }
 
@@ -8144,29 +8140,29 @@ void test_cil_gen_avrule(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
-	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->src_str, test_current->next->data);
-	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->tgt_str, test_current->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->classpermset->class_str, test_current->next->next->next->cl_head->data);
+	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->src_str, cil_tree_node_next(test_current)->data);
+	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->tgt_str, cil_tree_node_next(cil_tree_node_next(test_current))->data);
+	CuAssertStrEquals(tc, ((struct cil_avrule*)test_ast_node->data)->classpermset->class_str, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_AVRULE);
 	CuAssertPtrNotNull(tc, ((struct cil_avrule*)test_ast_node->data)->classpermset->permset->perms_list_str);
 
 	struct cil_list_item *test_list = ((struct cil_avrule*)test_ast_node->data)->classpermset->permset->perms_list_str->head;
-	test_current = test_current->next->next->next->cl_head->next->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(test_current))))));
 
 	while(test_list != NULL) {
 	    CuAssertIntEquals(tc, test_list->flavor, CIL_AST_STR);
 	    CuAssertStrEquals(tc, test_list->data, test_current->data );
 	    test_list = test_list->next;
-	    test_current = test_current->next;
+	    test_current = cil_tree_node_next(test_current);
 	}
 }
 
@@ -8182,11 +8178,11 @@ void test_cil_gen_avrule_permset(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -8204,11 +8200,11 @@ void test_cil_gen_avrule_permset_anon(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -8226,11 +8222,11 @@ void test_cil_gen_avrule_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8248,11 +8244,11 @@ void test_cil_gen_avrule_sourceparens(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8270,11 +8266,11 @@ void test_cil_gen_avrule_sourceemptyparen_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8292,11 +8288,11 @@ void test_cil_gen_avrule_targetparens(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8314,11 +8310,11 @@ void test_cil_gen_avrule_targetemptyparen_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8336,11 +8332,11 @@ void test_cil_gen_avrule_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8355,7 +8351,7 @@ void test_cil_gen_avrule_astnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node = NULL;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8373,11 +8369,11 @@ void test_cil_gen_avrule_sourcedomainnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8395,11 +8391,11 @@ void test_cil_gen_avrule_targetdomainnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8417,11 +8413,11 @@ void test_cil_gen_avrule_objectclassnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8439,11 +8435,11 @@ void test_cil_gen_avrule_permsnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8461,11 +8457,11 @@ void test_cil_gen_avrule_twolists_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	int rc = cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -8483,15 +8479,15 @@ void test_cil_gen_type_rule_transition(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, test_tree->root->cl_head->cl_head->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, test_tree->root->cl_head->cl_head->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, test_tree->root->cl_head->cl_head->next->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, test_tree->root->cl_head->cl_head->next->next->next->next->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))))->data);
 	CuAssertIntEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->rule_kind, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPE_RULE);
 }
@@ -8512,7 +8508,7 @@ void test_cil_gen_type_rule_transition_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }	
 
@@ -8528,12 +8524,12 @@ void test_cil_gen_type_rule_transition_srcnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 	
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8549,12 +8545,12 @@ void test_cil_gen_type_rule_transition_tgtnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8570,12 +8566,12 @@ void test_cil_gen_type_rule_transition_objnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8591,12 +8587,12 @@ void test_cil_gen_type_rule_transition_resultnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8612,10 +8608,10 @@ void test_cil_gen_type_rule_transition_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8631,15 +8627,15 @@ void test_cil_gen_type_rule_change(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, test_tree->root->cl_head->cl_head->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, test_tree->root->cl_head->cl_head->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, test_tree->root->cl_head->cl_head->next->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, test_tree->root->cl_head->cl_head->next->next->next->next->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))))->data);
 	CuAssertIntEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->rule_kind, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPE_RULE);
 }
@@ -8660,7 +8656,7 @@ void test_cil_gen_type_rule_change_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }	
 
@@ -8676,12 +8672,12 @@ void test_cil_gen_type_rule_change_srcnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 	
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8697,12 +8693,12 @@ void test_cil_gen_type_rule_change_tgtnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8718,12 +8714,12 @@ void test_cil_gen_type_rule_change_objnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8739,12 +8735,12 @@ void test_cil_gen_type_rule_change_resultnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8760,10 +8756,10 @@ void test_cil_gen_type_rule_change_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_CHANGE);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_CHANGE);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8779,15 +8775,15 @@ void test_cil_gen_type_rule_member(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, test_tree->root->cl_head->cl_head->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, test_tree->root->cl_head->cl_head->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, test_tree->root->cl_head->cl_head->next->next->next->data);
-	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, test_tree->root->cl_head->cl_head->next->next->next->next->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->src_str, cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->tgt_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->obj_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))->data);
+	CuAssertStrEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->result_str, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))))->data);
 	CuAssertIntEquals(tc, ((struct cil_type_rule*)test_ast_node->data)->rule_kind, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_TYPE_RULE);
 }
@@ -8808,7 +8804,7 @@ void test_cil_gen_type_rule_member_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }	
 
@@ -8824,12 +8820,12 @@ void test_cil_gen_type_rule_member_srcnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 	
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8845,12 +8841,12 @@ void test_cil_gen_type_rule_member_tgtnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8866,12 +8862,12 @@ void test_cil_gen_type_rule_member_objnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8887,12 +8883,12 @@ void test_cil_gen_type_rule_member_resultnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	test_tree->root->cl_head->cl_head->next->next->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), NULL);
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8908,10 +8904,10 @@ void test_cil_gen_type_rule_member_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_MEMBER);
+	int rc = cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_MEMBER);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8927,15 +8923,15 @@ void test_cil_gen_user(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, CIL_USER, test_ast_node->flavor);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertPtrEquals(tc, test_ast_node, ((struct cil_symtab_datum*)test_ast_node->data)->node);
-	CuAssertStrEquals(tc, test_tree->root->cl_head->cl_head->next->data, ((struct cil_symtab_datum*)test_ast_node->data)->name);
+	CuAssertStrEquals(tc, cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data, ((struct cil_symtab_datum*)test_ast_node->data)->name);
 }
 
 void test_cil_gen_user_dbnull_neg(CuTest *tc) {
@@ -8949,7 +8945,7 @@ void test_cil_gen_user_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8965,10 +8961,10 @@ void test_cil_gen_user_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8983,7 +8979,7 @@ void test_cil_gen_user_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -8999,10 +8995,10 @@ void test_cil_gen_user_nouser_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9018,10 +9014,10 @@ void test_cil_gen_user_xsinfo_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9037,10 +9033,10 @@ void test_cil_gen_userlevel(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9056,10 +9052,10 @@ void test_cil_gen_userlevel_anon_level(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9075,10 +9071,10 @@ void test_cil_gen_userlevel_anon_level_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9094,10 +9090,10 @@ void test_cil_gen_userlevel_usernull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9113,10 +9109,10 @@ void test_cil_gen_userlevel_userrange_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9132,10 +9128,10 @@ void test_cil_gen_userlevel_levelnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9151,10 +9147,10 @@ void test_cil_gen_userlevel_levelrangeempty_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9170,10 +9166,10 @@ void test_cil_gen_userlevel_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9188,7 +9184,7 @@ void test_cil_gen_userlevel_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9204,10 +9200,10 @@ void test_cil_gen_userlevel_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9222,7 +9218,7 @@ void test_cil_gen_userlevel_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_userlevel(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userlevel(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9238,10 +9234,10 @@ void test_cil_gen_userrange_named(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9257,10 +9253,10 @@ void test_cil_gen_userrange_anon(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9276,10 +9272,10 @@ void test_cil_gen_userrange_usernull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9295,10 +9291,10 @@ void test_cil_gen_userrange_anonuser_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9314,10 +9310,10 @@ void test_cil_gen_userrange_rangenamenull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9333,10 +9329,10 @@ void test_cil_gen_userrange_anonrangeinvalid_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9352,10 +9348,10 @@ void test_cil_gen_userrange_anonrangeempty_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9371,10 +9367,10 @@ void test_cil_gen_userrange_extra_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9389,7 +9385,7 @@ void test_cil_gen_userrange_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9405,10 +9401,10 @@ void test_cil_gen_userrange_currnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9423,7 +9419,7 @@ void test_cil_gen_userrange_astnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_userrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9439,10 +9435,10 @@ void test_cil_gen_sensitivity(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_ast_node->data);
 	CuAssertIntEquals(tc, test_ast_node->flavor, CIL_SENS);
@@ -9460,7 +9456,7 @@ void test_cil_gen_sensitivity_dbnull_neg(CuTest *tc) {
 
 	struct cil_db *test_db = NULL;
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9486,7 +9482,7 @@ void test_cil_gen_sensitivity_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9496,7 +9492,7 @@ void test_cil_gen_sensitivity_sensnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -9504,7 +9500,7 @@ void test_cil_gen_sensitivity_sensnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9520,7 +9516,7 @@ void test_cil_gen_sensitivity_senslist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9536,7 +9532,7 @@ void test_cil_gen_sensitivity_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }	
 
@@ -9552,10 +9548,10 @@ void test_cil_gen_sensalias(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9570,7 +9566,7 @@ void test_cil_gen_sensalias_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9596,7 +9592,7 @@ void test_cil_gen_sensalias_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9606,14 +9602,14 @@ void test_cil_gen_sensalias_sensnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9629,7 +9625,7 @@ void test_cil_gen_sensalias_senslist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9639,7 +9635,7 @@ void test_cil_gen_sensalias_aliasnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -9647,7 +9643,7 @@ void test_cil_gen_sensalias_aliasnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9663,7 +9659,7 @@ void test_cil_gen_sensalias_aliaslist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9679,7 +9675,7 @@ void test_cil_gen_sensalias_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9695,10 +9691,10 @@ void test_cil_gen_category(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9713,7 +9709,7 @@ void test_cil_gen_category_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9728,7 +9724,7 @@ void test_cil_gen_category_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9744,8 +9740,8 @@ void test_cil_gen_category_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	int rc = cil_gen_category(test_db, NULL, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -9757,7 +9753,7 @@ void test_cil_gen_category_catnull_neg(CuTest *tc){
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -9765,10 +9761,10 @@ void test_cil_gen_category_catnull_neg(CuTest *tc){
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9784,10 +9780,10 @@ void test_cil_gen_category_catlist_neg(CuTest *tc){
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9803,10 +9799,10 @@ void test_cil_gen_category_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9822,10 +9818,10 @@ void test_cil_gen_catset(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -9840,7 +9836,7 @@ void test_cil_gen_catset_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9856,8 +9852,8 @@ void test_cil_gen_catset_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	int rc = cil_gen_catset(test_db, NULL, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -9874,7 +9870,7 @@ void test_cil_gen_catset_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 	
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9884,7 +9880,7 @@ void test_cil_gen_catset_namenull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -9892,10 +9888,10 @@ void test_cil_gen_catset_namenull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9911,10 +9907,10 @@ void test_cil_gen_catset_setnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9930,10 +9926,10 @@ void test_cil_gen_catset_namelist_neg(CuTest *tc) { //This should fail before ge
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9949,10 +9945,10 @@ void test_cil_gen_catset_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9968,10 +9964,10 @@ void test_cil_gen_catset_notset_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -9987,7 +9983,7 @@ void test_cil_gen_catset_nodefail_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10003,10 +9999,10 @@ void test_cil_gen_catset_settolistfail_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catset(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catset(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10022,10 +10018,10 @@ void test_cil_gen_catalias(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -10040,7 +10036,7 @@ void test_cil_gen_catalias_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10056,8 +10052,8 @@ void test_cil_gen_catalias_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	int rc = cil_gen_catalias(test_db, NULL, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -10074,7 +10070,7 @@ void test_cil_gen_catalias_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10084,7 +10080,7 @@ void test_cil_gen_catalias_catnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -10092,10 +10088,10 @@ void test_cil_gen_catalias_catnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10105,7 +10101,7 @@ void test_cil_gen_catalias_aliasnull_neg(CuTest *tc) {
 	struct cil_tree *test_tree;
 	gen_test_tree(&test_tree, line);
 
-	test_tree->root->cl_head->cl_head->next->next = NULL;
+	cil_tree_node_set_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))), NULL);
 
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
@@ -10113,10 +10109,10 @@ void test_cil_gen_catalias_aliasnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10132,10 +10128,10 @@ void test_cil_gen_catalias_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10151,10 +10147,10 @@ void test_cil_gen_catrange(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -10170,10 +10166,10 @@ void test_cil_gen_catrange_noname_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10189,10 +10185,10 @@ void test_cil_gen_catrange_norange_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10208,10 +10204,10 @@ void test_cil_gen_catrange_emptyrange_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10227,10 +10223,10 @@ void test_cil_gen_catrange_extrarange_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10245,7 +10241,7 @@ void test_cil_gen_catrange_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10261,8 +10257,8 @@ void test_cil_gen_catrange_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	int rc = cil_gen_catrange(test_db, NULL, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -10279,7 +10275,7 @@ void test_cil_gen_catrange_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10295,10 +10291,10 @@ void test_cil_gen_catrange_extra_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_catrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10314,7 +10310,7 @@ void test_cil_gen_roletype(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10331,7 +10327,7 @@ void test_cil_gen_roletype_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10347,7 +10343,7 @@ void test_cil_gen_roletype_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10363,7 +10359,7 @@ void test_cil_gen_roletype_astnull_neg(CuTest *tc) {
 	
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10381,7 +10377,7 @@ void test_cil_gen_roletype_empty_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10398,7 +10394,7 @@ void test_cil_gen_roletype_rolelist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10418,7 +10414,7 @@ void test_cil_gen_roletype_roletype_sublist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10435,7 +10431,7 @@ void test_cil_gen_roletype_typelist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_roletype(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_roletype(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10452,7 +10448,7 @@ void test_cil_gen_userrole(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10469,7 +10465,7 @@ void test_cil_gen_userrole_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10485,7 +10481,7 @@ void test_cil_gen_userrole_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10501,7 +10497,7 @@ void test_cil_gen_userrole_astnull_neg(CuTest *tc) {
 	
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10518,7 +10514,7 @@ void test_cil_gen_userrole_empty_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10534,7 +10530,7 @@ void test_cil_gen_userrole_userlist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10553,7 +10549,7 @@ void test_cil_gen_userrole_userrole_sublist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10570,7 +10566,7 @@ void test_cil_gen_userrole_rolelist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -10587,19 +10583,19 @@ void test_cil_gen_classcommon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        char *test_key = test_tree->root->cl_head->cl_head->next->data;
+        char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
         struct cil_class *test_cls;
 		cil_class_init(&test_cls);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
         cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
         test_ast_node->data = test_cls;
         test_ast_node->flavor = CIL_CLASS;
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -10614,7 +10610,7 @@ void test_cil_gen_classcommon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10630,7 +10626,7 @@ void test_cil_gen_classcommon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10645,7 +10641,7 @@ void test_cil_gen_classcommon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10661,7 +10657,7 @@ void test_cil_gen_classcommon_missingclassname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10677,19 +10673,19 @@ void test_cil_gen_classcommon_noperms_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        char *test_key = test_tree->root->cl_head->cl_head->next->data;
+        char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
         struct cil_class *test_cls;
 		cil_class_init(&test_cls);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
         cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
         test_ast_node->data = test_cls;
         test_ast_node->flavor = CIL_CLASS;
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10705,19 +10701,19 @@ void test_cil_gen_classcommon_extraperms_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        char *test_key = test_tree->root->cl_head->cl_head->next->data;
+        char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
         struct cil_class *test_cls;
 		cil_class_init(&test_cls);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
         cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
         test_ast_node->data = test_cls;
         test_ast_node->flavor = CIL_CLASS;
 
-        int rc = cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10735,10 +10731,10 @@ void test_cil_gen_catorder(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -10755,7 +10751,7 @@ void test_cil_gen_catorder_dbnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10773,10 +10769,10 @@ void test_cil_gen_catorder_currnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10793,7 +10789,7 @@ void test_cil_gen_catorder_astnull_neg(CuTest *tc) {
 
 	struct cil_tree_node *test_ast_node = NULL;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10811,10 +10807,10 @@ void test_cil_gen_catorder_missingcats_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10832,10 +10828,10 @@ void test_cil_gen_catorder_nosublist_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10853,10 +10849,10 @@ void test_cil_gen_catorder_nestedcat_neg(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	int rc = cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10875,10 +10871,10 @@ void test_cil_gen_dominance(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -10896,7 +10892,7 @@ void test_cil_gen_dominance_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10915,10 +10911,10 @@ void test_cil_gen_dominance_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10936,7 +10932,7 @@ void test_cil_gen_dominance_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10955,10 +10951,10 @@ void test_cil_gen_dominance_nosensitivities_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -10977,10 +10973,10 @@ void test_cil_gen_dominance_nosublist_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11002,10 +10998,10 @@ void test_cil_gen_senscat(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11021,10 +11017,10 @@ void test_cil_gen_senscat_nosublist(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11045,7 +11041,7 @@ void test_cil_gen_senscat_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11067,10 +11063,10 @@ void test_cil_gen_senscat_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11091,7 +11087,7 @@ void test_cil_gen_senscat_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11113,10 +11109,10 @@ void test_cil_gen_senscat_nosensitivities_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11138,7 +11134,7 @@ void test_cil_gen_senscat_sublist_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+	int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11154,7 +11150,7 @@ void test_cil_gen_senscat_nocat_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = cil_gen_senscat(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	int rc = cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11172,13 +11168,13 @@ void test_cil_fill_level(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_level *test_level;
 	cil_level_init(&test_level);
 
-        int rc = cil_fill_level(test_tree->root->cl_head->next->next->cl_head->next->next->cl_head, test_level);
+        int rc = cil_fill_level(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))))), test_level);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11196,13 +11192,13 @@ void test_cil_fill_level_sensnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_level *test_level;
 	cil_level_init(&test_level);
 
-        int rc = cil_fill_level(test_tree->root->cl_head->next->next->cl_head->next->next, test_level);
+        int rc = cil_fill_level(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))), test_level);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11220,12 +11216,12 @@ void test_cil_fill_level_levelnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_level *test_level = NULL;
 
-        int rc = cil_fill_level(test_tree->root->cl_head->next->next->cl_head->next->next->cl_head, test_level);
+        int rc = cil_fill_level(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))))), test_level);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11243,13 +11239,13 @@ void test_cil_fill_level_nocat(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_level *test_level;
 	cil_level_init(&test_level);
 
-        int rc = cil_fill_level(test_tree->root->cl_head->next->next->cl_head->next->next->cl_head, test_level);
+        int rc = cil_fill_level(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))))), test_level);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11267,13 +11263,13 @@ void test_cil_fill_level_emptycat_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_level *test_level;
 	cil_level_init(&test_level);
 
-        int rc = cil_fill_level(test_tree->root->cl_head->next->next->cl_head->next->next->cl_head, test_level);
+        int rc = cil_fill_level(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))))), test_level);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11291,10 +11287,10 @@ void test_cil_gen_level(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11310,10 +11306,10 @@ void test_cil_gen_level_nameinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11329,10 +11325,10 @@ void test_cil_gen_level_emptysensparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11348,10 +11344,10 @@ void test_cil_gen_level_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11369,10 +11365,10 @@ void test_cil_gen_level_emptycat_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11390,10 +11386,10 @@ void test_cil_gen_level_noname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11411,10 +11407,10 @@ void test_cil_gen_level_nosens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11431,7 +11427,7 @@ void test_cil_gen_level_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11449,10 +11445,10 @@ void test_cil_gen_level_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11469,7 +11465,7 @@ void test_cil_gen_level_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_level(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+        int rc = cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11485,10 +11481,10 @@ void test_cil_gen_levelrange(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11504,10 +11500,10 @@ void test_cil_gen_levelrange_rangeinvalid_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11523,10 +11519,10 @@ void test_cil_gen_levelrange_namenull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11542,10 +11538,10 @@ void test_cil_gen_levelrange_rangenull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11561,10 +11557,10 @@ void test_cil_gen_levelrange_rangeempty_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11580,10 +11576,10 @@ void test_cil_gen_levelrange_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11598,7 +11594,7 @@ void test_cil_gen_levelrange_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11614,10 +11610,10 @@ void test_cil_gen_levelrange_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11632,7 +11628,7 @@ void test_cil_gen_levelrange_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_levelrange(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_levelrange(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11648,10 +11644,10 @@ void test_cil_gen_constrain(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11667,10 +11663,10 @@ void test_cil_gen_constrain_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11686,10 +11682,10 @@ void test_cil_gen_constrain_classset_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11705,10 +11701,10 @@ void test_cil_gen_constrain_classset_noclass_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11724,10 +11720,10 @@ void test_cil_gen_constrain_classset_noperm_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11743,10 +11739,10 @@ void test_cil_gen_constrain_permset_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11762,10 +11758,10 @@ void test_cil_gen_constrain_permset_noclass_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11781,10 +11777,10 @@ void test_cil_gen_constrain_permset_noperm_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11800,10 +11796,10 @@ void test_cil_gen_constrain_expression_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11818,7 +11814,7 @@ void test_cil_gen_constrain_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11834,10 +11830,10 @@ void test_cil_gen_constrain_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11852,7 +11848,7 @@ void test_cil_gen_constrain_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        int rc = cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11868,13 +11864,13 @@ void test_cil_fill_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-        int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+        int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11890,13 +11886,13 @@ void test_cil_fill_context_unnamedlvl(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-        int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+        int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11912,12 +11908,12 @@ void test_cil_fill_context_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context = NULL;
 
-        int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+        int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11933,13 +11929,13 @@ void test_cil_fill_context_nouser_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11955,13 +11951,13 @@ void test_cil_fill_context_norole_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11977,13 +11973,13 @@ void test_cil_fill_context_notype_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11999,13 +11995,13 @@ void test_cil_fill_context_nolowlvl_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12021,13 +12017,13 @@ void test_cil_fill_context_nohighlvl_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12043,13 +12039,13 @@ void test_cil_fill_context_unnamedlvl_nocontextlow_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12065,13 +12061,13 @@ void test_cil_fill_context_unnamedlvl_nocontexthigh_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_context *test_context;
 	cil_context_init(&test_context);
 
-	int rc = cil_fill_context(test_tree->root->cl_head->cl_head->next->next->cl_head, test_context);
+	int rc = cil_fill_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_context);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12087,10 +12083,10 @@ void test_cil_gen_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12106,10 +12102,10 @@ void test_cil_gen_context_notinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12125,10 +12121,10 @@ void test_cil_gen_context_extralevel_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12144,10 +12140,10 @@ void test_cil_gen_context_emptycontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12163,10 +12159,10 @@ void test_cil_gen_context_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12182,10 +12178,10 @@ void test_cil_gen_context_doubleparen_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12201,10 +12197,10 @@ void test_cil_gen_context_norole_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12220,10 +12216,10 @@ void test_cil_gen_context_roleinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12239,10 +12235,10 @@ void test_cil_gen_context_notype_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12258,10 +12254,10 @@ void test_cil_gen_context_typeinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12277,10 +12273,10 @@ void test_cil_gen_context_nolevels_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12296,10 +12292,10 @@ void test_cil_gen_context_nosecondlevel_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12315,10 +12311,10 @@ void test_cil_gen_context_noname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12334,10 +12330,10 @@ void test_cil_gen_context_nouser_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12352,7 +12348,7 @@ void test_cil_gen_context_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12368,10 +12364,10 @@ void test_cil_gen_context_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12386,7 +12382,7 @@ void test_cil_gen_context_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12402,10 +12398,10 @@ void test_cil_gen_filecon_dir(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12421,10 +12417,10 @@ void test_cil_gen_filecon_file(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12440,10 +12436,10 @@ void test_cil_gen_filecon_char(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12459,10 +12455,10 @@ void test_cil_gen_filecon_block(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12478,10 +12474,10 @@ void test_cil_gen_filecon_socket(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12497,10 +12493,10 @@ void test_cil_gen_filecon_pipe(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12516,10 +12512,10 @@ void test_cil_gen_filecon_symlink(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12535,10 +12531,10 @@ void test_cil_gen_filecon_any(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12554,10 +12550,10 @@ void test_cil_gen_filecon_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12573,10 +12569,10 @@ void test_cil_gen_filecon_anon_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12591,7 +12587,7 @@ void test_cil_gen_filecon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12607,10 +12603,10 @@ void test_cil_gen_filecon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12625,7 +12621,7 @@ void test_cil_gen_filecon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12641,10 +12637,10 @@ void test_cil_gen_filecon_str1null_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12660,10 +12656,10 @@ void test_cil_gen_filecon_str1_inparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12679,10 +12675,10 @@ void test_cil_gen_filecon_str2null_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12698,10 +12694,10 @@ void test_cil_gen_filecon_str2_inparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12717,10 +12713,10 @@ void test_cil_gen_filecon_classnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12736,10 +12732,10 @@ void test_cil_gen_filecon_class_inparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12755,10 +12751,10 @@ void test_cil_gen_filecon_contextnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12774,10 +12770,10 @@ void test_cil_gen_filecon_context_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12793,10 +12789,10 @@ void test_cil_gen_filecon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_filecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_filecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12812,10 +12808,10 @@ void test_cil_gen_portcon_udp(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12831,10 +12827,10 @@ void test_cil_gen_portcon_tcp(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12850,10 +12846,10 @@ void test_cil_gen_portcon_unknownprotocol_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12869,10 +12865,10 @@ void test_cil_gen_portcon_anon_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12888,10 +12884,10 @@ void test_cil_gen_portcon_portrange(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -12907,10 +12903,10 @@ void test_cil_gen_portcon_portrange_one_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12926,10 +12922,10 @@ void test_cil_gen_portcon_portrange_morethanone_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12945,10 +12941,10 @@ void test_cil_gen_portcon_singleport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12964,10 +12960,10 @@ void test_cil_gen_portcon_lowport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -12983,10 +12979,10 @@ void test_cil_gen_portcon_highport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13001,7 +12997,7 @@ void test_cil_gen_portcon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13017,10 +13013,10 @@ void test_cil_gen_portcon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13035,7 +13031,7 @@ void test_cil_gen_portcon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13051,10 +13047,10 @@ void test_cil_gen_portcon_str1null_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13070,10 +13066,10 @@ void test_cil_gen_portcon_str1parens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13089,10 +13085,10 @@ void test_cil_gen_portcon_portnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13108,10 +13104,10 @@ void test_cil_gen_portcon_contextnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13127,10 +13123,10 @@ void test_cil_gen_portcon_context_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13146,10 +13142,10 @@ void test_cil_gen_portcon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_portcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_portcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13165,14 +13161,14 @@ void test_cil_fill_ipaddr(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_nodecon *nodecon;
 	cil_nodecon_init(&nodecon);
 	cil_ipaddr_init(&nodecon->addr);
 
-        int rc = cil_fill_ipaddr(test_tree->root->cl_head->cl_head->next->cl_head, nodecon->addr);
+        int rc = cil_fill_ipaddr(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), nodecon->addr);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13188,8 +13184,8 @@ void test_cil_fill_ipaddr_addrnodenull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_nodecon *nodecon;
 	cil_nodecon_init(&nodecon);
@@ -13211,14 +13207,14 @@ void test_cil_fill_ipaddr_addrnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_nodecon *nodecon;
 	cil_nodecon_init(&nodecon);
 	nodecon->addr = NULL;
 
-        int rc = cil_fill_ipaddr(test_tree->root->cl_head->cl_head->next->cl_head, nodecon->addr);
+        int rc = cil_fill_ipaddr(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), nodecon->addr);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13234,14 +13230,14 @@ void test_cil_fill_ipaddr_addrinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_nodecon *nodecon;
 	cil_nodecon_init(&nodecon);
 	cil_ipaddr_init(&nodecon->addr);
 
-        int rc = cil_fill_ipaddr(test_tree->root->cl_head->cl_head->next->cl_head, nodecon->addr);
+        int rc = cil_fill_ipaddr(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), nodecon->addr);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13257,14 +13253,14 @@ void test_cil_fill_ipaddr_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
 	struct cil_nodecon *nodecon;
 	cil_nodecon_init(&nodecon);
 	cil_ipaddr_init(&nodecon->addr);
 
-        int rc = cil_fill_ipaddr(test_tree->root->cl_head->cl_head->next->cl_head, nodecon->addr);
+        int rc = cil_fill_ipaddr(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))), nodecon->addr);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13280,10 +13276,10 @@ void test_cil_gen_nodecon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13299,10 +13295,10 @@ void test_cil_gen_nodecon_anon_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13317,7 +13313,7 @@ void test_cil_gen_nodecon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13333,10 +13329,10 @@ void test_cil_gen_nodecon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13351,7 +13347,7 @@ void test_cil_gen_nodecon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13367,10 +13363,10 @@ void test_cil_gen_nodecon_ipnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13386,10 +13382,10 @@ void test_cil_gen_nodecon_ipanon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13405,10 +13401,10 @@ void test_cil_gen_nodecon_ipanon_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13424,10 +13420,10 @@ void test_cil_gen_nodecon_netmasknull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13443,10 +13439,10 @@ void test_cil_gen_nodecon_netmaskanon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13462,10 +13458,10 @@ void test_cil_gen_nodecon_netmaskanon_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13481,10 +13477,10 @@ void test_cil_gen_nodecon_contextnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13500,10 +13496,10 @@ void test_cil_gen_nodecon_context_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13519,10 +13515,10 @@ void test_cil_gen_nodecon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13538,10 +13534,10 @@ void test_cil_gen_genfscon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13557,10 +13553,10 @@ void test_cil_gen_genfscon_anon_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13575,7 +13571,7 @@ void test_cil_gen_genfscon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13591,10 +13587,10 @@ void test_cil_gen_genfscon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13609,7 +13605,7 @@ void test_cil_gen_genfscon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13625,10 +13621,10 @@ void test_cil_gen_genfscon_typenull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13644,10 +13640,10 @@ void test_cil_gen_genfscon_typeparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13663,10 +13659,10 @@ void test_cil_gen_genfscon_pathnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13682,10 +13678,10 @@ void test_cil_gen_genfscon_pathparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13701,10 +13697,10 @@ void test_cil_gen_genfscon_contextnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13720,10 +13716,10 @@ void test_cil_gen_genfscon_context_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13739,10 +13735,10 @@ void test_cil_gen_genfscon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_genfscon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_genfscon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13758,10 +13754,10 @@ void test_cil_gen_netifcon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13779,10 +13775,10 @@ void test_cil_gen_netifcon_nested(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -13798,10 +13794,10 @@ void test_cil_gen_netifcon_nested_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13819,10 +13815,10 @@ void test_cil_gen_netifcon_nested_emptysecondlist_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13840,10 +13836,10 @@ void test_cil_gen_netifcon_extra_nested_secondlist_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13861,10 +13857,10 @@ void test_cil_gen_netifcon_nested_missingobjects_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13882,10 +13878,10 @@ void test_cil_gen_netifcon_nested_secondnested_missingobjects_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13900,7 +13896,7 @@ void test_cil_gen_netifcon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13916,10 +13912,10 @@ void test_cil_gen_netifcon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13934,7 +13930,7 @@ void test_cil_gen_netifcon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13950,10 +13946,10 @@ void test_cil_gen_netifcon_ethmissing_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13969,10 +13965,10 @@ void test_cil_gen_netifcon_interfacemissing_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -13988,10 +13984,10 @@ void test_cil_gen_netifcon_packetmissing_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14007,10 +14003,10 @@ void test_cil_gen_pirqcon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14026,10 +14022,10 @@ void test_cil_gen_pirqcon_pirqnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14045,10 +14041,10 @@ void test_cil_gen_pirqcon_nopirq_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14064,10 +14060,10 @@ void test_cil_gen_pirqcon_pirqrange_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14083,10 +14079,10 @@ void test_cil_gen_pirqcon_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14102,10 +14098,10 @@ void test_cil_gen_pirqcon_anoncontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14121,10 +14117,10 @@ void test_cil_gen_pirqcon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14139,7 +14135,7 @@ void test_cil_gen_pirqcon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14155,10 +14151,10 @@ void test_cil_gen_pirqcon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14173,7 +14169,7 @@ void test_cil_gen_pirqcon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_pirqcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pirqcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14189,10 +14185,10 @@ void test_cil_gen_iomemcon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14208,10 +14204,10 @@ void test_cil_gen_iomemcon_iomemrange(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14227,10 +14223,10 @@ void test_cil_gen_iomemcon_iomemrange_firstnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14246,10 +14242,10 @@ void test_cil_gen_iomemcon_iomemrange_secondnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14265,10 +14261,10 @@ void test_cil_gen_iomemcon_iomemrange_empty_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14284,10 +14280,10 @@ void test_cil_gen_iomemcon_iomemrange_singleiomem_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14303,10 +14299,10 @@ void test_cil_gen_iomemcon_iomemrange_morethantwoiomem_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14322,10 +14318,10 @@ void test_cil_gen_iomemcon_iomemnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14341,10 +14337,10 @@ void test_cil_gen_iomemcon_noiomem_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14360,10 +14356,10 @@ void test_cil_gen_iomemcon_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14379,10 +14375,10 @@ void test_cil_gen_iomemcon_anoncontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14398,10 +14394,10 @@ void test_cil_gen_iomemcon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14416,7 +14412,7 @@ void test_cil_gen_iomemcon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14432,10 +14428,10 @@ void test_cil_gen_iomemcon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14450,7 +14446,7 @@ void test_cil_gen_iomemcon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_iomemcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_iomemcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14466,10 +14462,10 @@ void test_cil_gen_ioportcon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14485,10 +14481,10 @@ void test_cil_gen_ioportcon_ioportrange(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14504,10 +14500,10 @@ void test_cil_gen_ioportcon_ioportrange_firstnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14523,10 +14519,10 @@ void test_cil_gen_ioportcon_ioportrange_secondnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14542,10 +14538,10 @@ void test_cil_gen_ioportcon_ioportrange_empty_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14561,10 +14557,10 @@ void test_cil_gen_ioportcon_ioportrange_singleioport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14580,10 +14576,10 @@ void test_cil_gen_ioportcon_ioportrange_morethantwoioport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14599,10 +14595,10 @@ void test_cil_gen_ioportcon_ioportnotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14618,10 +14614,10 @@ void test_cil_gen_ioportcon_noioport_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14637,10 +14633,10 @@ void test_cil_gen_ioportcon_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14656,10 +14652,10 @@ void test_cil_gen_ioportcon_anoncontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14675,10 +14671,10 @@ void test_cil_gen_ioportcon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14693,7 +14689,7 @@ void test_cil_gen_ioportcon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14709,10 +14705,10 @@ void test_cil_gen_ioportcon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14727,7 +14723,7 @@ void test_cil_gen_ioportcon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_ioportcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ioportcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14743,10 +14739,10 @@ void test_cil_gen_pcidevicecon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14762,10 +14758,10 @@ void test_cil_gen_pcidevicecon_pcidevicenotint_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14781,10 +14777,10 @@ void test_cil_gen_pcidevicecon_nopcidevice_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14800,10 +14796,10 @@ void test_cil_gen_pcidevicecon_pcidevicerange_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14819,10 +14815,10 @@ void test_cil_gen_pcidevicecon_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14838,10 +14834,10 @@ void test_cil_gen_pcidevicecon_anoncontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14857,10 +14853,10 @@ void test_cil_gen_pcidevicecon_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14875,7 +14871,7 @@ void test_cil_gen_pcidevicecon_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14891,10 +14887,10 @@ void test_cil_gen_pcidevicecon_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14909,7 +14905,7 @@ void test_cil_gen_pcidevicecon_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_pcidevicecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_pcidevicecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14925,10 +14921,10 @@ void test_cil_gen_fsuse_anoncontext(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14944,10 +14940,10 @@ void test_cil_gen_fsuse_anoncontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -14963,10 +14959,10 @@ void test_cil_gen_fsuse_xattr(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -14982,10 +14978,10 @@ void test_cil_gen_fsuse_task(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15001,10 +14997,10 @@ void test_cil_gen_fsuse_transition(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15020,10 +15016,10 @@ void test_cil_gen_fsuse_invalidtype_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15039,10 +15035,10 @@ void test_cil_gen_fsuse_notype_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15058,10 +15054,10 @@ void test_cil_gen_fsuse_typeinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15077,10 +15073,10 @@ void test_cil_gen_fsuse_nofilesystem_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15096,10 +15092,10 @@ void test_cil_gen_fsuse_filesysteminparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15115,10 +15111,10 @@ void test_cil_gen_fsuse_nocontext_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15134,10 +15130,10 @@ void test_cil_gen_fsuse_emptyconparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15153,10 +15149,10 @@ void test_cil_gen_fsuse_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15171,7 +15167,7 @@ void test_cil_gen_fsuse_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15187,10 +15183,10 @@ void test_cil_gen_fsuse_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15205,7 +15201,7 @@ void test_cil_gen_fsuse_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_fsuse(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_fsuse(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15221,10 +15217,10 @@ void test_cil_gen_macro_noparams(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15240,10 +15236,10 @@ void test_cil_gen_macro_type(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15259,10 +15255,10 @@ void test_cil_gen_macro_role(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15278,10 +15274,10 @@ void test_cil_gen_macro_user(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15297,10 +15293,10 @@ void test_cil_gen_macro_sensitivity(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15316,10 +15312,10 @@ void test_cil_gen_macro_category(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15335,10 +15331,10 @@ void test_cil_gen_macro_catset(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15354,10 +15350,10 @@ void test_cil_gen_macro_level(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15373,10 +15369,10 @@ void test_cil_gen_macro_class(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15392,10 +15388,10 @@ void test_cil_gen_macro_classmap(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15412,10 +15408,10 @@ void test_cil_gen_macro_permset(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15431,10 +15427,10 @@ void test_cil_gen_macro_duplicate(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15450,10 +15446,10 @@ void test_cil_gen_macro_duplicate_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15469,10 +15465,10 @@ void test_cil_gen_macro_unknown_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15487,7 +15483,7 @@ void test_cil_gen_macro_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15503,10 +15499,10 @@ void test_cil_gen_macro_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15524,7 +15520,7 @@ void test_cil_gen_macro_astnull_neg(CuTest *tc) {
 
         test_ast_node = NULL;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15540,10 +15536,10 @@ void test_cil_gen_macro_unnamed_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15559,10 +15555,10 @@ void test_cil_gen_macro_noparam_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15578,10 +15574,10 @@ void test_cil_gen_macro_nosecondparam_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15597,10 +15593,10 @@ void test_cil_gen_macro_noparam_name_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15616,10 +15612,10 @@ void test_cil_gen_macro_emptyparam_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15635,10 +15631,10 @@ void test_cil_gen_macro_paramcontainsperiod_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_macro(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_macro(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15654,10 +15650,10 @@ void test_cil_gen_call(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15673,10 +15669,10 @@ void test_cil_gen_call_noargs(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15692,10 +15688,10 @@ void test_cil_gen_call_anon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15711,10 +15707,10 @@ void test_cil_gen_call_empty_call_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15729,7 +15725,7 @@ void test_cil_gen_call_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15745,10 +15741,10 @@ void test_cil_gen_call_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15763,7 +15759,7 @@ void test_cil_gen_call_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15779,10 +15775,10 @@ void test_cil_gen_call_name_inparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15798,10 +15794,10 @@ void test_cil_gen_call_noname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15817,10 +15813,10 @@ void test_cil_gen_optional(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15835,7 +15831,7 @@ void test_cil_gen_optional_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15851,10 +15847,10 @@ void test_cil_gen_optional_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15869,7 +15865,7 @@ void test_cil_gen_optional_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15885,10 +15881,10 @@ void test_cil_gen_optional_unnamed_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15904,10 +15900,10 @@ void test_cil_gen_optional_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15923,10 +15919,10 @@ void test_cil_gen_optional_nameinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15942,10 +15938,10 @@ void test_cil_gen_optional_emptyoptional(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15961,10 +15957,10 @@ void test_cil_gen_optional_norule_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -15980,10 +15976,10 @@ void test_cil_gen_policycap(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -15999,10 +15995,10 @@ void test_cil_gen_policycap_noname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16018,10 +16014,10 @@ void test_cil_gen_policycap_nameinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16037,10 +16033,10 @@ void test_cil_gen_policycap_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16055,7 +16051,7 @@ void test_cil_gen_policycap_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16071,10 +16067,10 @@ void test_cil_gen_policycap_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16089,7 +16085,7 @@ void test_cil_gen_policycap_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16105,10 +16101,10 @@ void test_cil_gen_policycap_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_policycap(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_policycap(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16124,10 +16120,10 @@ void test_cil_gen_ipaddr_ipv4(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -16143,10 +16139,10 @@ void test_cil_gen_ipaddr_ipv4_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16162,10 +16158,10 @@ void test_cil_gen_ipaddr_ipv6(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -16181,10 +16177,10 @@ void test_cil_gen_ipaddr_ipv6_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16200,10 +16196,10 @@ void test_cil_gen_ipaddr_noname_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16219,10 +16215,10 @@ void test_cil_gen_ipaddr_nameinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16238,10 +16234,10 @@ void test_cil_gen_ipaddr_noip_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16257,10 +16253,10 @@ void test_cil_gen_ipaddr_ipinparens_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16276,10 +16272,10 @@ void test_cil_gen_ipaddr_extra_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16294,7 +16290,7 @@ void test_cil_gen_ipaddr_dbnull_neg(CuTest *tc) {
 
         struct cil_db *test_db = NULL;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16310,10 +16306,10 @@ void test_cil_gen_ipaddr_currnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16328,7 +16324,7 @@ void test_cil_gen_ipaddr_astnull_neg(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        int rc = cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        int rc = cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
         CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -16422,7 +16418,7 @@ void test_cil_build_ast_node_helper_block(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16440,7 +16436,7 @@ void test_cil_build_ast_node_helper_block_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 
@@ -16459,7 +16455,7 @@ void test_cil_build_ast_node_helper_blockinherit(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16477,7 +16473,7 @@ void test_cil_build_ast_node_helper_blockinherit_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 
@@ -16496,7 +16492,7 @@ void test_cil_build_ast_node_helper_permset(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, CIL_TREE_SKIP_NEXT, finished);
 }
@@ -16514,7 +16510,7 @@ void test_cil_build_ast_node_helper_permset_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 
@@ -16533,7 +16529,7 @@ void test_cil_build_ast_node_helper_in(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16551,7 +16547,7 @@ void test_cil_build_ast_node_helper_in_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16569,7 +16565,7 @@ void test_cil_build_ast_node_helper_class(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16587,7 +16583,7 @@ void test_cil_build_ast_node_helper_class_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16605,7 +16601,7 @@ void test_cil_build_ast_node_helper_classpermset(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, CIL_TREE_SKIP_NEXT, finished);
 }
@@ -16623,7 +16619,7 @@ void test_cil_build_ast_node_helper_classpermset_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 
@@ -16642,7 +16638,7 @@ void test_cil_build_ast_node_helper_classmap(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16660,7 +16656,7 @@ void test_cil_build_ast_node_helper_classmap_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16678,7 +16674,7 @@ void test_cil_build_ast_node_helper_classmapping(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16696,7 +16692,7 @@ void test_cil_build_ast_node_helper_classmapping_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16714,7 +16710,7 @@ void test_cil_build_ast_node_helper_common(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16732,7 +16728,7 @@ void test_cil_build_ast_node_helper_common_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16750,7 +16746,7 @@ void test_cil_build_ast_node_helper_sid(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16768,7 +16764,7 @@ void test_cil_build_ast_node_helper_sid_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16786,7 +16782,7 @@ void test_cil_build_ast_node_helper_sidcontext(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16804,7 +16800,7 @@ void test_cil_build_ast_node_helper_sidcontext_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16822,7 +16818,7 @@ void test_cil_build_ast_node_helper_user(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16840,7 +16836,7 @@ void test_cil_build_ast_node_helper_user_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16858,7 +16854,7 @@ void test_cil_build_ast_node_helper_userlevel(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16876,7 +16872,7 @@ void test_cil_build_ast_node_helper_userlevel_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16894,7 +16890,7 @@ void test_cil_build_ast_node_helper_userrange(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -16912,7 +16908,7 @@ void test_cil_build_ast_node_helper_userrange_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16930,7 +16926,7 @@ void test_cil_build_ast_node_helper_type(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16948,7 +16944,7 @@ void test_cil_build_ast_node_helper_type_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16966,7 +16962,7 @@ void test_cil_build_ast_node_helper_attribute(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -16984,7 +16980,7 @@ void test_cil_build_ast_node_helper_attribute_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17001,7 +16997,7 @@ void test_cil_build_ast_node_helper_typebounds(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17019,7 +17015,7 @@ void test_cil_build_ast_node_helper_typebounds_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17036,7 +17032,7 @@ void test_cil_build_ast_node_helper_typepermissive(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17054,7 +17050,7 @@ void test_cil_build_ast_node_helper_typepermissive_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17072,7 +17068,7 @@ void test_cil_build_ast_node_helper_nametypetransition(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17090,7 +17086,7 @@ void test_cil_build_ast_node_helper_nametypetransition_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17108,7 +17104,7 @@ void test_cil_build_ast_node_helper_rangetransition(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17126,7 +17122,7 @@ void test_cil_build_ast_node_helper_rangetransition_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17146,7 +17142,7 @@ void test_cil_build_ast_node_helper_boolif(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17166,7 +17162,7 @@ void test_cil_build_ast_node_helper_boolif_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17184,7 +17180,7 @@ void test_cil_build_ast_node_helper_condblock_true(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17202,7 +17198,7 @@ void test_cil_build_ast_node_helper_condblock_true_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17220,7 +17216,7 @@ void test_cil_build_ast_node_helper_condblock_false(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17238,7 +17234,7 @@ void test_cil_build_ast_node_helper_condblock_false_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17258,7 +17254,7 @@ void test_cil_build_ast_node_helper_tunif(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17277,7 +17273,7 @@ void test_cil_build_ast_node_helper_tunif_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }	
@@ -17295,7 +17291,7 @@ void test_cil_build_ast_node_helper_typealias(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17313,7 +17309,7 @@ void test_cil_build_ast_node_helper_typealias_notype_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17332,7 +17328,7 @@ void test_cil_build_ast_node_helper_typeattribute(CuTest *tc)
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17351,7 +17347,7 @@ void test_cil_build_ast_node_helper_typeattribute_neg(CuTest *tc)
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17369,7 +17365,7 @@ void test_cil_build_ast_node_helper_typeattributeset(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17387,7 +17383,7 @@ void test_cil_build_ast_node_helper_typeattributeset_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17405,7 +17401,7 @@ void test_cil_build_ast_node_helper_userbounds(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17423,7 +17419,7 @@ void test_cil_build_ast_node_helper_userbounds_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17441,7 +17437,7 @@ void test_cil_build_ast_node_helper_role(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17459,7 +17455,7 @@ void test_cil_build_ast_node_helper_role_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17477,7 +17473,7 @@ void test_cil_build_ast_node_helper_roletransition(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17495,7 +17491,7 @@ void test_cil_build_ast_node_helper_roletransition_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17513,7 +17509,7 @@ void test_cil_build_ast_node_helper_roleallow(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17531,7 +17527,7 @@ void test_cil_build_ast_node_helper_roleallow_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17549,7 +17545,7 @@ void test_cil_build_ast_node_helper_rolebounds(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17567,7 +17563,7 @@ void test_cil_build_ast_node_helper_rolebounds_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17585,7 +17581,7 @@ void test_cil_build_ast_node_helper_avrule_allow(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17603,7 +17599,7 @@ void test_cil_build_ast_node_helper_avrule_allow_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17621,7 +17617,7 @@ void test_cil_build_ast_node_helper_avrule_auditallow(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17639,7 +17635,7 @@ void test_cil_build_ast_node_helper_avrule_auditallow_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17657,7 +17653,7 @@ void test_cil_build_ast_node_helper_avrule_dontaudit(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17675,7 +17671,7 @@ void test_cil_build_ast_node_helper_avrule_dontaudit_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17693,7 +17689,7 @@ void test_cil_build_ast_node_helper_avrule_neverallow(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -17711,7 +17707,7 @@ void test_cil_build_ast_node_helper_avrule_neverallow_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17729,7 +17725,7 @@ void test_cil_build_ast_node_helper_type_rule_transition(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17747,7 +17743,7 @@ void test_cil_build_ast_node_helper_type_rule_transition_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17765,7 +17761,7 @@ void test_cil_build_ast_node_helper_type_rule_change(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17783,7 +17779,7 @@ void test_cil_build_ast_node_helper_type_rule_change_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17801,7 +17797,7 @@ void test_cil_build_ast_node_helper_type_rule_member(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17819,7 +17815,7 @@ void test_cil_build_ast_node_helper_type_rule_member_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17837,7 +17833,7 @@ void test_cil_build_ast_node_helper_bool(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17855,7 +17851,7 @@ void test_cil_build_ast_node_helper_bool_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17873,7 +17869,7 @@ void test_cil_build_ast_node_helper_bool_tunable(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17891,7 +17887,7 @@ void test_cil_build_ast_node_helper_bool_tunable_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17909,7 +17905,7 @@ void test_cil_build_ast_node_helper_sensitivity(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17927,7 +17923,7 @@ void test_cil_build_ast_node_helper_sensitivity_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17945,7 +17941,7 @@ void test_cil_build_ast_node_helper_sensalias(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17963,7 +17959,7 @@ void test_cil_build_ast_node_helper_sensalias_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17981,7 +17977,7 @@ void test_cil_build_ast_node_helper_category(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -17999,7 +17995,7 @@ void test_cil_build_ast_node_helper_category_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -18017,7 +18013,7 @@ void test_cil_build_ast_node_helper_catset(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished); 
 }
@@ -18035,7 +18031,7 @@ void test_cil_build_ast_node_helper_catset_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished); 
 }
@@ -18053,7 +18049,7 @@ void test_cil_build_ast_node_helper_catorder(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished); 
 }
@@ -18071,7 +18067,7 @@ void test_cil_build_ast_node_helper_catorder_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished); 
 }
@@ -18089,7 +18085,7 @@ void test_cil_build_ast_node_helper_catalias(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -18107,7 +18103,7 @@ void test_cil_build_ast_node_helper_catalias_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -18125,7 +18121,7 @@ void test_cil_build_ast_node_helper_catrange(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 1, finished);
 }
@@ -18143,7 +18139,7 @@ void test_cil_build_ast_node_helper_catrange_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -18162,7 +18158,7 @@ void test_cil_build_ast_node_helper_roletype(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18180,7 +18176,7 @@ void test_cil_build_ast_node_helper_roletype_neg(CuTest *tc) {
 	
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18198,7 +18194,7 @@ void test_cil_build_ast_node_helper_userrole(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18216,7 +18212,7 @@ void test_cil_build_ast_node_helper_userrole_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18234,7 +18230,7 @@ void test_cil_build_ast_node_helper_gen_classcommon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18252,7 +18248,7 @@ void test_cil_build_ast_node_helper_gen_classcommon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18273,7 +18269,7 @@ void test_cil_build_ast_node_helper_gen_dominance(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18294,7 +18290,7 @@ void test_cil_build_ast_node_helper_gen_dominance_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18318,7 +18314,7 @@ void test_cil_build_ast_node_helper_gen_senscat(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->next->next->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18342,7 +18338,7 @@ void test_cil_build_ast_node_helper_gen_senscat_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->next->next->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18362,7 +18358,7 @@ void test_cil_build_ast_node_helper_gen_level(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18382,7 +18378,7 @@ void test_cil_build_ast_node_helper_gen_level_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->next->next->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18400,7 +18396,7 @@ void test_cil_build_ast_node_helper_gen_levelrange(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18418,7 +18414,7 @@ void test_cil_build_ast_node_helper_gen_levelrange_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18436,7 +18432,7 @@ void test_cil_build_ast_node_helper_gen_constrain(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18454,7 +18450,7 @@ void test_cil_build_ast_node_helper_gen_constrain_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18472,7 +18468,7 @@ void test_cil_build_ast_node_helper_gen_mlsconstrain(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18490,7 +18486,7 @@ void test_cil_build_ast_node_helper_gen_mlsconstrain_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18508,7 +18504,7 @@ void test_cil_build_ast_node_helper_gen_context(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18526,7 +18522,7 @@ void test_cil_build_ast_node_helper_gen_context_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18544,7 +18540,7 @@ void test_cil_build_ast_node_helper_gen_filecon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18562,7 +18558,7 @@ void test_cil_build_ast_node_helper_gen_filecon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18580,7 +18576,7 @@ void test_cil_build_ast_node_helper_gen_portcon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18598,7 +18594,7 @@ void test_cil_build_ast_node_helper_gen_portcon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18616,7 +18612,7 @@ void test_cil_build_ast_node_helper_gen_nodecon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18634,7 +18630,7 @@ void test_cil_build_ast_node_helper_gen_nodecon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18652,7 +18648,7 @@ void test_cil_build_ast_node_helper_gen_genfscon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18670,7 +18666,7 @@ void test_cil_build_ast_node_helper_gen_genfscon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18690,7 +18686,7 @@ void test_cil_build_ast_node_helper_gen_netifcon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18708,7 +18704,7 @@ void test_cil_build_ast_node_helper_gen_netifcon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18726,7 +18722,7 @@ void test_cil_build_ast_node_helper_gen_pirqcon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18744,7 +18740,7 @@ void test_cil_build_ast_node_helper_gen_pirqcon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18762,7 +18758,7 @@ void test_cil_build_ast_node_helper_gen_iomemcon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18780,7 +18776,7 @@ void test_cil_build_ast_node_helper_gen_iomemcon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18798,7 +18794,7 @@ void test_cil_build_ast_node_helper_gen_ioportcon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18816,7 +18812,7 @@ void test_cil_build_ast_node_helper_gen_ioportcon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18834,7 +18830,7 @@ void test_cil_build_ast_node_helper_gen_pcidevicecon(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18852,7 +18848,7 @@ void test_cil_build_ast_node_helper_gen_pcidevicecon_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18870,7 +18866,7 @@ void test_cil_build_ast_node_helper_gen_fsuse(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18888,7 +18884,7 @@ void test_cil_build_ast_node_helper_gen_fsuse_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18906,7 +18902,7 @@ void test_cil_build_ast_node_helper_gen_macro(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -18924,7 +18920,7 @@ void test_cil_build_ast_node_helper_gen_macro_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -18950,7 +18946,7 @@ void test_cil_build_ast_node_helper_gen_macro_nested_macro_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, macronode, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 
@@ -18980,7 +18976,7 @@ void test_cil_build_ast_node_helper_gen_macro_nested_tunif_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, macronode, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 
@@ -19001,7 +18997,7 @@ void test_cil_build_ast_node_helper_gen_call(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -19019,7 +19015,7 @@ void test_cil_build_ast_node_helper_gen_call_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -19037,7 +19033,7 @@ void test_cil_build_ast_node_helper_gen_optional(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -19055,7 +19051,7 @@ void test_cil_build_ast_node_helper_gen_optional_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -19073,7 +19069,7 @@ void test_cil_build_ast_node_helper_gen_policycap(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 1);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -19091,7 +19087,7 @@ void test_cil_build_ast_node_helper_gen_policycap_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -19109,7 +19105,7 @@ void test_cil_build_ast_node_helper_gen_ipaddr(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -19127,7 +19123,7 @@ void test_cil_build_ast_node_helper_gen_ipaddr_neg(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -19145,7 +19141,7 @@ void test_cil_build_ast_node_helper_extraargsnull_neg(CuTest *tc) {
 
 	uint32_t finished = 0;
 	
-	int rc = __cil_build_ast_node_helper(test_tree->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_build_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -19160,7 +19156,7 @@ void test_cil_build_ast_last_child_helper(CuTest *tc) {
 
 	struct cil_args_build *extra_args = gen_build_args(test_db->ast->root, test_db, NULL, NULL);
 	
-	int rc = __cil_build_ast_last_child_helper(test_tree->root->cl_head->cl_head, extra_args);
+	int rc = __cil_build_ast_last_child_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), extra_args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -19173,7 +19169,7 @@ void test_cil_build_ast_last_child_helper_extraargsnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	int rc = __cil_build_ast_last_child_helper(test_tree->root->cl_head->cl_head, NULL);
+	int rc = __cil_build_ast_last_child_helper(cil_tree_node_head(cil_tree_node_head(test_tree->root)), NULL);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
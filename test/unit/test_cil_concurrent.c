@@ -0,0 +1,286 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <sepol/policydb.h>
+
+#include "CuTest.h"
+#include "test_cil_concurrent.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_symtab.h"
+#include "../../src/cil_log.h"
+
+#define TEST_CONCURRENT_THREADS	16
+#define TEST_CONCURRENT_BLOCKS	64
+#define TEST_CONCURRENT_RESOLVE_BLOCKS	512
+#define TEST_CONCURRENT_RESOLVE_JOBS	4
+
+struct test_concurrent_job {
+	char *policy;
+	char *binary;
+	size_t binary_size;
+	char *filecons;
+	int resolve_jobs;
+	int rc;
+};
+
+static char *__test_concurrent_policy(int blocks) {
+	size_t size = 4096 + blocks * 256;
+	char *policy = malloc(size);
+	size_t used;
+	int i;
+
+	used = snprintf(policy, size,
+		"(class file (read write))\n"
+		"(classorder (file))\n"
+		"(sid kernel)\n"
+		"(sidorder (kernel))\n"
+		"(user u)\n"
+		"(role r)\n"
+		"(type t)\n"
+		"(category c0)\n"
+		"(categoryorder (c0))\n"
+		"(sensitivity s0)\n"
+		"(sensitivityorder (s0))\n"
+		"(sensitivitycategory s0 (c0))\n"
+		"(roletype r t)\n"
+		"(userrole u r)\n"
+		"(userlevel u (s0))\n"
+		"(userrange u ((s0)(s0 (c0))))\n"
+		"(sidcontext kernel (u r t ((s0)(s0))))\n"
+		"(typeattribute domain)\n"
+		"(macro domain_type ((type d)) (typeattributeset domain (d)) (allow d self (file (read))))\n"
+		"(optional missing (allow t absent (file (read))))\n");
+
+	for (i = 0; i < blocks; i++) {
+		used += snprintf(policy + used, size - used,
+			"(block b%d (type exec) (call domain_type (exec)) (roletype r exec)\n"
+			" (filecon \"/b%d\" file (u r exec ((s0)(s0))))\n"
+			" (optional o (allow exec b%d.exec (file (write)))))\n",
+			i, i, (i + 1) % blocks);
+	}
+
+	return policy;
+}
+
+/* Write the binary policy and the file contexts, the way secilc does */
+static int __test_concurrent_write(struct cil_db *db, sepol_policydb_t *pdb, struct test_concurrent_job *job) {
+	struct sepol_policy_file *pf = NULL;
+	FILE *binary = NULL;
+	size_t filecons_size = 0;
+	int rc = SEPOL_ERR;
+
+	rc = cil_build_policydb(db, pdb);
+	if (rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	binary = open_memstream(&job->binary, &job->binary_size);
+	if (binary == NULL || sepol_policy_file_create(&pf) != 0) {
+		rc = SEPOL_ERR;
+		goto exit;
+	}
+	sepol_policy_file_set_fp(pf, binary);
+	rc = sepol_policydb_write(pdb, pf);
+	if (rc != 0) {
+		rc = SEPOL_ERR;
+		goto exit;
+	}
+
+	rc = cil_filecons_to_string(db, pdb, &job->filecons, &filecons_size);
+
+exit:
+	if (binary != NULL) {
+		fclose(binary);
+	}
+	sepol_policy_file_free(pf);
+	return rc;
+}
+
+static void *__test_concurrent_compile(void *arg) {
+	struct test_concurrent_job *job = arg;
+	struct cil_db *db = NULL;
+	sepol_policydb_t *pdb = NULL;
+
+	cil_db_init(&db);
+	cil_set_resolve_jobs(db, job->resolve_jobs);
+	sepol_policydb_create(&pdb);
+	pdb->p.policy_type = POLICY_KERN;
+	sepol_policydb_set_vers(pdb, POLICYDB_VERSION_MAX);
+
+	job->rc = cil_add_file(db, "test.cil", job->policy, strlen(job->policy));
+	if (job->rc == SEPOL_OK) {
+		job->rc = cil_compile(db, pdb);
+	}
+	if (job->rc == SEPOL_OK) {
+		job->rc = __test_concurrent_write(db, pdb, job);
+	}
+
+	sepol_policydb_free(pdb);
+	cil_db_destroy(&db);
+
+	return NULL;
+}
+
+static void __test_concurrent_job_init(struct test_concurrent_job *job, char *policy, int resolve_jobs) {
+	job->policy = policy;
+	job->binary = NULL;
+	job->binary_size = 0;
+	job->filecons = NULL;
+	job->resolve_jobs = resolve_jobs;
+	job->rc = SEPOL_ERR;
+}
+
+static void __test_concurrent_job_destroy(struct test_concurrent_job *job) {
+	free(job->binary);
+	free(job->filecons);
+}
+
+/* Both jobs wrote the same policy */
+static void __test_concurrent_same(CuTest *tc, struct test_concurrent_job *a, struct test_concurrent_job *b) {
+	CuAssertIntEquals(tc, SEPOL_OK, a->rc);
+	CuAssertIntEquals(tc, SEPOL_OK, b->rc);
+	CuAssertTrue(tc, a->binary_size > 0);
+	CuAssertIntEquals(tc, a->binary_size, b->binary_size);
+	CuAssertTrue(tc, memcmp(a->binary, b->binary, a->binary_size) == 0);
+	CuAssertStrEquals(tc, a->filecons, b->filecons);
+}
+
+void test_cil_compile_concurrent(CuTest *tc) {
+	struct test_concurrent_job jobs[TEST_CONCURRENT_THREADS];
+	pthread_t threads[TEST_CONCURRENT_THREADS];
+	char *policy = __test_concurrent_policy(TEST_CONCURRENT_BLOCKS);
+	int i;
+
+	for (i = 0; i < TEST_CONCURRENT_THREADS; i++) {
+		__test_concurrent_job_init(&jobs[i], policy, 1);
+		CuAssertIntEquals(tc, 0, pthread_create(&threads[i], NULL, __test_concurrent_compile, &jobs[i]));
+	}
+
+	for (i = 0; i < TEST_CONCURRENT_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (i = 0; i < TEST_CONCURRENT_THREADS; i++) {
+		__test_concurrent_same(tc, &jobs[0], &jobs[i]);
+	}
+	CuAssertPtrNotNull(tc, strstr(jobs[0].filecons, "/b0\t--\tu:r:b0.exec"));
+
+	for (i = 0; i < TEST_CONCURRENT_THREADS; i++) {
+		__test_concurrent_job_destroy(&jobs[i]);
+	}
+	free(policy);
+}
+
+void test_cil_resolve_jobs(CuTest *tc) {
+	struct test_concurrent_job jobs[2];
+	char *policy = __test_concurrent_policy(TEST_CONCURRENT_RESOLVE_BLOCKS);
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		__test_concurrent_job_init(&jobs[i], policy, i == 0 ? 1 : TEST_CONCURRENT_RESOLVE_JOBS);
+		__test_concurrent_compile(&jobs[i]);
+	}
+
+	/* Resolving on several threads gives what resolving on one does */
+	__test_concurrent_same(tc, &jobs[0], &jobs[1]);
+	CuAssertPtrNotNull(tc, strstr(jobs[1].filecons, "/b511\t--\tu:r:b511.exec"));
+
+	for (i = 0; i < 2; i++) {
+		__test_concurrent_job_destroy(&jobs[i]);
+	}
+	free(policy);
+}
+
+static __thread int test_concurrent_db_logged;
+static int test_concurrent_db_log_count;
+static int test_concurrent_global_logged;
+
+static void __test_concurrent_db_log(__attribute__((unused)) int lvl, __attribute__((unused)) char *msg) {
+	test_concurrent_db_logged++;
+}
+
+static void __test_concurrent_global_log(__attribute__((unused)) int lvl, __attribute__((unused)) char *msg) {
+	test_concurrent_global_logged++;
+}
+
+static void *__test_concurrent_db_log_compile(void *arg) {
+	struct test_concurrent_job *job = arg;
+	struct cil_db *db = NULL;
+	sepol_policydb_t *pdb = NULL;
+
+	cil_db_init(&db);
+	cil_db_set_log_level(db, CIL_INFO);
+	cil_db_set_log_handler(db, __test_concurrent_db_log);
+	sepol_policydb_create(&pdb);
+
+	job->rc = cil_add_file(db, "test.cil", job->policy, strlen(job->policy));
+	if (job->rc == SEPOL_OK) {
+		job->rc = cil_compile(db, pdb);
+	}
+	test_concurrent_db_log_count = test_concurrent_db_logged;
+
+	sepol_policydb_free(pdb);
+	cil_db_destroy(&db);
+
+	return NULL;
+}
+
+void test_cil_db_log_handler(CuTest *tc) {
+	struct test_concurrent_job job;
+	pthread_t thread;
+	char *policy = __test_concurrent_policy(TEST_CONCURRENT_BLOCKS);
+	void (*log_handler)(int lvl, char *msg) = cil_get_log_handler();
+
+	cil_set_log_level(CIL_ERR);
+	cil_set_log_handler(__test_concurrent_global_log);
+	__test_concurrent_job_init(&job, policy, 0);
+
+	CuAssertIntEquals(tc, 0, pthread_create(&thread, NULL, __test_concurrent_db_log_compile, &job));
+	pthread_join(thread, NULL);
+
+	/* The db logged at its own level through its own handler, and left
+	 * the process wide settings alone */
+	CuAssertIntEquals(tc, SEPOL_OK, job.rc);
+	CuAssertTrue(tc, test_concurrent_db_log_count > 0);
+	CuAssertIntEquals(tc, 0, test_concurrent_global_logged);
+	CuAssertIntEquals(tc, CIL_ERR, cil_get_log_level());
+	CuAssertPtrEquals(tc, __test_concurrent_global_log, cil_get_log_handler());
+
+	cil_log(CIL_ERR, "logged\n");
+	CuAssertIntEquals(tc, 1, test_concurrent_global_logged);
+
+	cil_set_log_handler(log_handler);
+	free(policy);
+}
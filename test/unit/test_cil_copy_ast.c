@@ -62,7 +62,7 @@ void test_cil_copy_list(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 	cil_list_init(&cil_l);
 
-	cil_set_to_list(test_tree->root->cl_head, cil_l, 1);
+	cil_set_to_list(cil_tree_node_head(test_tree->root), cil_l, 1);
 
 	struct cil_list *copy_list;
 	cil_list_init(&copy_list);
@@ -84,7 +84,7 @@ void test_cil_copy_list_sublist(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 	cil_list_init(&cil_l);
 
-	cil_set_to_list(test_tree->root->cl_head, cil_l, 1);
+	cil_set_to_list(cil_tree_node_head(test_tree->root), cil_l, 1);
 
 	struct cil_list *copy_list;
 	cil_list_init(&copy_list);
@@ -108,7 +108,7 @@ void test_cil_copy_list_sublist_extra(CuTest *tc) {
 	gen_test_tree(&test_tree, line);
 	cil_list_init(&cil_l);
 
-	cil_set_to_list(test_tree->root->cl_head, cil_l, 1);
+	cil_set_to_list(cil_tree_node_head(test_tree->root), cil_l, 1);
 
 	struct cil_list *copy_list;
 	cil_list_init(&copy_list);
@@ -153,19 +153,21 @@ void test_cil_copy_block(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_block(test_db, test_tree->root->cl_head->cl_head, test_ast_node, 0);
+	cil_gen_block(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, 0);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, cil_sym_sizes[CIL_SYM_ARRAY_BLOCK][CIL_SYM_BLOCKS]);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, cil_sym_sizes[CIL_SYM_ARRAY_BLOCK][CIL_SYM_BLOCKS]);
 
 	int rc = cil_copy_block(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_perm(CuTest *tc) {
@@ -188,25 +190,26 @@ void test_cil_copy_perm(CuTest *tc) {
 	new_tree_node->data = new_node;
 	new_tree_node->flavor = CIL_CLASS;
 
-	test_ast_node->parent = new_tree_node;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, new_tree_node);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_CLASS_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_CLASS_SYM_SIZE);
 
-	cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head, test_ast_node);
+	cil_gen_perm(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))), test_ast_node);
 	int rc = cil_copy_perm(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
-	cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head->next, test_ast_node);
+	cil_gen_perm(test_db, cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))))), test_ast_node);
 	rc = cil_copy_perm(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
-	cil_gen_perm(test_db, test_tree->root->cl_head->cl_head->next->next->cl_head->next->next, test_ast_node);
+	cil_gen_perm(test_db, cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))))), test_ast_node);
 	rc = cil_copy_perm(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
-	
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_class(CuTest *tc) {
@@ -221,19 +224,21 @@ void test_cil_copy_class(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_class(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_class(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_CLASS_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_CLASS_SYM_SIZE);
 
 	int rc = cil_copy_class(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_common(CuTest *tc) {
@@ -248,19 +253,21 @@ void test_cil_copy_common(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_common(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_common(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_CLASS_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_CLASS_SYM_SIZE);
 
 	int rc = cil_copy_common(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_classcommon(CuTest *tc) {
@@ -275,30 +282,32 @@ void test_cil_copy_classcommon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        char *test_key = test_tree->root->cl_head->cl_head->next->data;
+        char *test_key = cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))->data;
         struct cil_class *test_cls;
 	cil_class_init(&test_cls);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
         cil_symtab_insert(&test_db->symtab[CIL_SYM_CLASSES], (hashtab_key_t)test_key, (struct cil_symtab_datum*)test_cls, test_ast_node);
 
         test_ast_node->data = test_cls;
         test_ast_node->flavor = CIL_CLASS;
 
-        cil_gen_classcommon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_classcommon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_classcommon *test_copy;
 	cil_classcommon_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_CLASS_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_CLASS_SYM_SIZE);
 
 	int rc = cil_copy_classcommon(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_classcommon *)test_ast_node->data)->class_str, test_copy->class_str);
 	CuAssertStrEquals(tc, ((struct cil_classcommon *)test_ast_node->data)->common_str, test_copy->common_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_sid(CuTest *tc) {
@@ -313,19 +322,21 @@ void test_cil_copy_sid(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_sid(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_sid(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_sid(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_sidcontext(CuTest *tc) {
@@ -340,21 +351,23 @@ void test_cil_copy_sidcontext(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_sidcontext(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_sidcontext(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_sidcontext(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_user *)test_copy->data)->datum.name, 
 		((struct cil_user *)test_ast_node->data)->datum.name);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_user(CuTest *tc) {
@@ -369,19 +382,21 @@ void test_cil_copy_user(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_user(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_user(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_user(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_role(CuTest *tc) {
@@ -396,19 +411,21 @@ void test_cil_copy_role(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_role(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_role(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_role(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_userrole(CuTest *tc) {
@@ -423,21 +440,23 @@ void test_cil_copy_userrole(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_userrole(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_userrole(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_userrole *test_copy;
 	cil_userrole_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_userrole(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_userrole *)test_ast_node->data)->user_str, test_copy->user_str);
 	CuAssertStrEquals(tc, ((struct cil_userrole *)test_ast_node->data)->role_str, test_copy->role_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_type(CuTest *tc) {
@@ -452,19 +471,21 @@ void test_cil_copy_type(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_type(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_type(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_type(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_typealias(CuTest *tc) {
@@ -479,19 +500,21 @@ void test_cil_copy_typealias(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_typealias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_typealias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_typealias(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_typeattribute(CuTest *tc) {
@@ -506,19 +529,21 @@ void test_cil_copy_typeattribute(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_typeattribute(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_typeattribute(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_typeattribute(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_bool(CuTest *tc) {
@@ -533,21 +558,23 @@ void test_cil_copy_bool(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_bool(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_BOOL);
+	cil_gen_bool(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_BOOL);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_bool(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertIntEquals(tc, ((struct cil_bool *)test_copy->data)->value,
 		((struct cil_bool *)test_ast_node->data)->value);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_type_rule(CuTest *tc) {
@@ -562,16 +589,16 @@ void test_cil_copy_type_rule(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_type_rule(test_tree->root->cl_head->cl_head, test_ast_node, CIL_TYPE_TRANSITION);
+	cil_gen_type_rule(cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_TYPE_TRANSITION);
 
 	struct cil_type_rule *test_copy;
 	cil_type_rule_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_type_rule(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -579,6 +606,8 @@ void test_cil_copy_type_rule(CuTest *tc) {
 	CuAssertStrEquals(tc, ((struct cil_type_rule *)test_ast_node->data)->src_str, test_copy->src_str);
 	CuAssertStrEquals(tc, ((struct cil_type_rule *)test_ast_node->data)->tgt_str, test_copy->tgt_str);
 	CuAssertStrEquals(tc, ((struct cil_type_rule *)test_ast_node->data)->obj_str, test_copy->obj_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_avrule(CuTest *tc) {
@@ -593,19 +622,19 @@ void test_cil_copy_avrule(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_tree_node *test_current;
-	test_current = test_tree->root->cl_head->cl_head;
+	test_current = cil_tree_node_head(cil_tree_node_head(test_tree->root));
 
 	cil_gen_avrule(test_current, test_ast_node, CIL_AVRULE_ALLOWED);
 
 	struct cil_avrule *test_copy;
 	cil_avrule_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_avrule(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -617,6 +646,8 @@ void test_cil_copy_avrule(CuTest *tc) {
 	CuAssertStrEquals(tc, (char*)((struct cil_avrule *)test_ast_node->data)->classpermset->permset->perms_list_str->head->data, (char*)test_copy->classpermset->permset->perms_list_str->head->data);
 	CuAssertIntEquals(tc, ((struct cil_avrule *)test_ast_node->data)->classpermset->permset->perms_list_str->head->next->flavor, test_copy->classpermset->permset->perms_list_str->head->next->flavor);
 	CuAssertStrEquals(tc, (char*)((struct cil_avrule *)test_ast_node->data)->classpermset->permset->perms_list_str->head->next->data, (char*)test_copy->classpermset->permset->perms_list_str->head->next->data);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_sens(CuTest *tc) {
@@ -631,19 +662,21 @@ void test_cil_copy_sens(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_sensitivity(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_sensitivity(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_sens(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_sensalias(CuTest *tc) {
@@ -658,21 +691,23 @@ void test_cil_copy_sensalias(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_sensalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_sensalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_sensalias(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_sensalias *)test_copy->data)->sens_str,
 		((struct cil_sensalias *)test_ast_node->data)->sens_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_cat(CuTest *tc) {
@@ -687,19 +722,21 @@ void test_cil_copy_cat(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_category(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_category(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_cat(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_catalias(CuTest *tc) {
@@ -714,21 +751,23 @@ void test_cil_copy_catalias(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 	
-	cil_gen_catalias(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_catalias(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_catalias(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_catalias *)test_copy->data)->cat_str,
 		((struct cil_catalias *)test_ast_node->data)->cat_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_senscat(CuTest *tc) {
@@ -749,16 +788,16 @@ void test_cil_copy_senscat(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_senscat(test_db, test_tree->root->cl_head->next->next->next->next->next->next->cl_head, test_ast_node);
+        cil_gen_senscat(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))))))), test_ast_node);
 
 	struct cil_senscat *test_copy;
 	cil_senscat_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_senscat(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -767,6 +806,8 @@ void test_cil_copy_senscat(CuTest *tc) {
 	                      (char*)test_copy->catset->cat_list_str->head->data);
 	CuAssertStrEquals(tc, (char*)((struct cil_senscat *)test_ast_node->data)->catset->cat_list_str->head->next->data,
 	                      (char*)test_copy->catset->cat_list_str->head->next->data);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_catorder(CuTest *tc) {
@@ -783,21 +824,23 @@ void test_cil_copy_catorder(CuTest *tc) {
 	struct cil_tree_node *test_ast_node;
 	cil_tree_node_init(&test_ast_node);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_catorder(test_db, test_tree->root->cl_head->next->next->cl_head, test_ast_node);
+	cil_gen_catorder(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root)))), test_ast_node);
 
 	struct cil_catorder *test_copy;
 	cil_catorder_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_catorder(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, (char*)((struct cil_catorder *)test_ast_node->data)->cat_list_str->head->data, (char*)test_copy->cat_list_str->head->data);
 	CuAssertStrEquals(tc, (char*)((struct cil_catorder *)test_ast_node->data)->cat_list_str->head->next->data, (char*)test_copy->cat_list_str->head->next->data);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_dominance(CuTest *tc) {
@@ -815,21 +858,23 @@ void test_cil_copy_dominance(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_dominance(test_db, test_tree->root->cl_head->next->next->next->cl_head, test_ast_node);
+        cil_gen_dominance(test_db, cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_tree->root))))), test_ast_node);
 
 	struct cil_sens_dominates *test_copy;
 	cil_sens_dominates_init(&test_copy);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_dominance(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, (char*)((struct cil_sens_dominates *)test_ast_node->data)->sens_list_str->head->data, (char*)test_copy->sens_list_str->head->data);
 	CuAssertStrEquals(tc, (char*)((struct cil_sens_dominates *)test_ast_node->data)->sens_list_str->head->next->data, (char*)test_copy->sens_list_str->head->next->data);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_level(CuTest *tc) {
@@ -844,19 +889,21 @@ void test_cil_copy_level(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_level(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_level(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_fill_level(CuTest *tc) {
@@ -871,22 +918,24 @@ void test_cil_copy_fill_level(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_level(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_level(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 	cil_level_init((struct cil_level**)&test_copy->data);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_fill_level((struct cil_level*)test_ast_node->data, (struct cil_level*)test_copy->data);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_level *)test_copy->data)->sens_str,
 		((struct cil_level *)test_ast_node->data)->sens_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_context(CuTest *tc) {
@@ -901,19 +950,21 @@ void test_cil_copy_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-	cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_context(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_netifcon(CuTest *tc) {
@@ -928,15 +979,15 @@ void test_cil_copy_netifcon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_netifcon *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_netifcon(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -946,6 +997,8 @@ void test_cil_copy_netifcon(CuTest *tc) {
 		((struct cil_netifcon *)test_ast_node->data)->if_context_str);
 	CuAssertStrEquals(tc, test_copy->packet_context_str,
 		((struct cil_netifcon *)test_ast_node->data)->packet_context_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_netifcon_nested(CuTest *tc) {
@@ -962,15 +1015,15 @@ void test_cil_copy_netifcon_nested(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_netifcon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_netifcon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_netifcon *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_netifcon(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -988,6 +1041,8 @@ void test_cil_copy_netifcon_nested(CuTest *tc) {
 		((struct cil_netifcon *)test_ast_node->data)->packet_context->type_str);
 	CuAssertStrEquals(tc, test_copy->packet_context->range_str,
 		((struct cil_netifcon *)test_ast_node->data)->packet_context->range_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_fill_context(CuTest *tc) {
@@ -1002,17 +1057,17 @@ void test_cil_copy_fill_context(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-	cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 	cil_context_init((struct cil_context**)&test_copy->data);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_fill_context((struct cil_context*)test_ast_node->data, (struct cil_context*)test_copy->data);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -1024,6 +1079,8 @@ void test_cil_copy_fill_context(CuTest *tc) {
 		((struct cil_context *)test_ast_node->data)->type_str);
 	CuAssertStrEquals(tc, ((struct cil_context *)test_copy->data)->range_str,
 		((struct cil_context *)test_ast_node->data)->range_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_fill_context_anonrange(CuTest *tc) {
@@ -1038,17 +1095,17 @@ void test_cil_copy_fill_context_anonrange(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-	cil_gen_context(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_context(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 	cil_context_init((struct cil_context**)&test_copy->data);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_fill_context((struct cil_context*)test_ast_node->data, (struct cil_context*)test_copy->data);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -1060,6 +1117,8 @@ void test_cil_copy_fill_context_anonrange(CuTest *tc) {
 		((struct cil_context *)test_ast_node->data)->type_str);
 	CuAssertStrEquals(tc, ((struct cil_context *)test_copy->data)->range_str,
 		((struct cil_context *)test_ast_node->data)->range_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_call(CuTest *tc) {
@@ -1074,19 +1133,21 @@ void test_cil_copy_call(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_call(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_call(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_call *test_copy;
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_call(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, test_copy->macro_str, ((struct cil_call *)test_ast_node->data)->macro_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_optional(CuTest *tc) {
@@ -1101,19 +1162,21 @@ void test_cil_copy_optional(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_optional(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_optional(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_optional(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_nodecon(CuTest *tc) {
@@ -1128,15 +1191,15 @@ void test_cil_copy_nodecon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_nodecon *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_nodecon(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -1146,6 +1209,8 @@ void test_cil_copy_nodecon(CuTest *tc) {
 		((struct cil_nodecon *)test_ast_node->data)->mask_str);
 	CuAssertStrEquals(tc, test_copy->context_str,
 		((struct cil_nodecon *)test_ast_node->data)->context_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_nodecon_anon(CuTest *tc) {
@@ -1160,15 +1225,15 @@ void test_cil_copy_nodecon_anon(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_nodecon(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_nodecon(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_nodecon *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_nodecon(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
@@ -1178,6 +1243,8 @@ void test_cil_copy_nodecon_anon(CuTest *tc) {
 		((struct cil_nodecon *)test_ast_node->data)->mask_str);
 	CuAssertStrEquals(tc, test_copy->context_str,
 		((struct cil_nodecon *)test_ast_node->data)->context_str);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_fill_ipaddr(CuTest *tc) {
@@ -1192,13 +1259,13 @@ void test_cil_copy_fill_ipaddr(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	struct cil_ipaddr *new;
 	cil_ipaddr_init(&new);
@@ -1210,6 +1277,8 @@ void test_cil_copy_fill_ipaddr(CuTest *tc) {
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 
 	CuAssertIntEquals(tc, old->family, new->family);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_ipaddr(CuTest *tc) {
@@ -1224,19 +1293,21 @@ void test_cil_copy_ipaddr(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_ipaddr(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+        cil_gen_ipaddr(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_tree_node *test_copy;
 	cil_tree_node_init(&test_copy);
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_ipaddr(test_db, test_ast_node->data, &test_copy->data, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_conditional(CuTest *tc) {
@@ -1253,24 +1324,26 @@ void test_cil_copy_conditional(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_list_item *curr_old;
 	curr_old = ((struct cil_booleanif*)test_ast_node->data)->expr_stack->head;
 
 	struct cil_conditional *cond_new;
 
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_conditional(test_db, curr_old->data, (void**)&cond_new, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 
 	CuAssertStrEquals(tc, ((struct cil_conditional*)curr_old->data)->str, cond_new->str);
 	CuAssertIntEquals(tc, ((struct cil_conditional*)curr_old->data)->flavor, cond_new->flavor);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_boolif(CuTest *tc) {
@@ -1287,18 +1360,20 @@ void test_cil_copy_boolif(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
-	cil_gen_boolif(test_db, test_tree->root->cl_head->cl_head, test_ast_node);
+	cil_gen_boolif(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node);
 
 	struct cil_booleanif *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_boolif(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
+
+	cil_symtab_destroy(&sym);
 }
 
 void test_cil_copy_constrain(CuTest *tc) {
@@ -1313,19 +1388,21 @@ void test_cil_copy_constrain(CuTest *tc) {
         struct cil_db *test_db;
         cil_db_init(&test_db);
 
-        test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+        test_ast_node->loc = 0;
 
-        cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
+        cil_gen_constrain(test_db, cil_tree_node_head(cil_tree_node_head(test_tree->root)), test_ast_node, CIL_MLSCONSTRAIN);
 
 	struct cil_constrain *test_copy;
 	
-	symtab_t sym;
-	symtab_init(&sym, CIL_TEST_SYM_SIZE);
+	struct cil_symtab sym;
+	cil_symtab_init(&sym, CIL_TEST_SYM_SIZE);
 
 	int rc = cil_copy_constrain(test_db, test_ast_node->data, (void**)&test_copy, &sym);
 	CuAssertIntEquals(tc, rc, SEPOL_OK);
 	CuAssertStrEquals(tc, ((struct cil_constrain*)test_copy)->classpermset->class_str, ((struct cil_constrain *)test_ast_node->data)->classpermset->class_str);
+
+	cil_symtab_destroy(&sym);
 }
 /*
 void test_cil_copy_ast(CuTest *tc) {
@@ -1341,7 +1418,7 @@ void test_cil_copy_ast(CuTest *tc) {
         cil_db_init(&test_db);
 
         test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        test_ast_node->loc = 0;
 
         cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
 
@@ -1369,7 +1446,7 @@ void test_cil_copy_ast_neg(CuTest *tc) {
         cil_db_init(&test_db);
 
         test_ast_node->parent = test_db->ast->root;
-        test_ast_node->line = 1;
+        test_ast_node->loc = 0;
 
         cil_gen_constrain(test_db, test_tree->root->cl_head->cl_head, test_ast_node, CIL_MLSCONSTRAIN);
 
@@ -1404,7 +1481,7 @@ void test_cil_copy_node_helper_block(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1424,7 +1501,7 @@ void test_cil_copy_node_helper_block_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1453,13 +1530,13 @@ void test_cil_copy_node_helper_perm(CuTest *tc) {
 	struct cil_tree_node *root;
 	cil_tree_node_init(&root);
 	root->flavor = CIL_ROOT;
-	parent_node->parent = root;
+	cil_tree_node_set_parent(parent_node, root);
 
 	struct cil_args_copy *extra_args = gen_copy_args(parent_node, test_db2);
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1479,7 +1556,7 @@ void test_cil_copy_node_helper_perm_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -1502,7 +1579,7 @@ void test_cil_copy_node_helper_class(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1522,7 +1599,7 @@ void test_cil_copy_node_helper_class_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -1545,7 +1622,7 @@ void test_cil_copy_node_helper_common(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1565,7 +1642,7 @@ void test_cil_copy_node_helper_common_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -1588,7 +1665,7 @@ void test_cil_copy_node_helper_classcommon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1611,7 +1688,7 @@ void test_cil_copy_node_helper_sid(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1631,7 +1708,7 @@ void test_cil_copy_node_helper_sid_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1654,7 +1731,7 @@ void test_cil_copy_node_helper_sidcontext(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1677,7 +1754,7 @@ void test_cil_copy_node_helper_user(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1697,7 +1774,7 @@ void test_cil_copy_node_helper_user_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1720,7 +1797,7 @@ void test_cil_copy_node_helper_role(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1740,7 +1817,7 @@ void test_cil_copy_node_helper_role_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1763,7 +1840,7 @@ void test_cil_copy_node_helper_userrole(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1786,7 +1863,7 @@ void test_cil_copy_node_helper_type(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1806,7 +1883,7 @@ void test_cil_copy_node_helper_type_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1829,7 +1906,7 @@ void test_cil_copy_node_helper_typeattribute(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1849,7 +1926,7 @@ void test_cil_copy_node_helper_typeattribute_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1872,7 +1949,7 @@ void test_cil_copy_node_helper_typealias(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1892,7 +1969,7 @@ void test_cil_copy_node_helper_typealias_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -1915,7 +1992,7 @@ void test_cil_copy_node_helper_bool(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1935,7 +2012,7 @@ void test_cil_copy_node_helper_bool_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -1958,7 +2035,7 @@ void test_cil_copy_node_helper_avrule(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1981,7 +2058,7 @@ void test_cil_copy_node_helper_type_rule(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2004,7 +2081,7 @@ void test_cil_copy_node_helper_sens(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2024,7 +2101,7 @@ void test_cil_copy_node_helper_sens_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2047,7 +2124,7 @@ void test_cil_copy_node_helper_sensalias(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2067,7 +2144,7 @@ void test_cil_copy_node_helper_sensalias_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2090,7 +2167,7 @@ void test_cil_copy_node_helper_cat(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2110,7 +2187,7 @@ void test_cil_copy_node_helper_cat_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2133,7 +2210,7 @@ void test_cil_copy_node_helper_catalias(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2153,7 +2230,7 @@ void test_cil_copy_node_helper_catalias_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2190,7 +2267,7 @@ void test_cil_copy_node_helper_senscat(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2223,7 +2300,7 @@ void test_cil_copy_node_helper_catorder(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head->next->next, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2257,7 +2334,7 @@ void test_cil_copy_node_helper_dominance(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2280,7 +2357,7 @@ void test_cil_copy_node_helper_level(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2300,7 +2377,7 @@ void test_cil_copy_node_helper_level_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2323,7 +2400,7 @@ void test_cil_copy_node_helper_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2343,7 +2420,7 @@ void test_cil_copy_node_helper_context_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2366,7 +2443,7 @@ void test_cil_copy_node_helper_netifcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2389,7 +2466,7 @@ void test_cil_copy_node_helper_call(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2412,7 +2489,7 @@ void test_cil_copy_node_helper_optional(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2432,7 +2509,7 @@ void test_cil_copy_node_helper_optional_merge(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2455,7 +2532,7 @@ void test_cil_copy_node_helper_ipaddr(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2475,7 +2552,7 @@ void test_cil_copy_node_helper_ipaddr_dup_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -2500,7 +2577,7 @@ void test_cil_copy_node_helper_boolif(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2523,7 +2600,7 @@ void test_cil_copy_node_helper_mlsconstrain(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, finished, 0);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -2544,7 +2621,7 @@ void test_cil_copy_node_helper_orignull_neg(CuTest *tc) {
 
 	struct cil_args_copy *extra_args = gen_copy_args(test_db2->ast->root, test_db2);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -2566,6 +2643,6 @@ void test_cil_copy_node_helper_extraargsnull_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_copy_node_helper(test_db->ast->root->cl_head, &finished, extra_args);
+	int rc = __cil_copy_node_helper(cil_tree_node_head(test_db->ast->root), &finished, extra_args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
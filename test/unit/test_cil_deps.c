@@ -0,0 +1,377 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sepol/policydb.h>
+
+#include "CuTest.h"
+#include "test_cil_deps.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_list.h"
+#include "../../src/cil_strpool.h"
+#include "../../src/cil_tree.h"
+
+#define TEST_DEPS_CHAIN	32
+#define TEST_DEPS_BLOCKS	8
+
+/* Each optional of the chain uses the type of the next one, and the last
+ * one a type that is never declared, so the chain is disabled from its far
+ * end one optional at a time */
+static char *__test_deps_policy(void) {
+	size_t size = 4096 + TEST_DEPS_CHAIN * 512;
+	char *policy = malloc(size);
+	size_t used;
+	int i;
+
+	used = snprintf(policy, size,
+		"(class file (read write open))\n"
+		"(classorder (file))\n"
+		"(classmap cmap (a))\n"
+		"(classmapping cmap a (file (read)))\n"
+		"(sid kernel)\n"
+		"(sidorder (kernel))\n"
+		"(user u)\n"
+		"(role r)\n"
+		"(type t)\n"
+		"(category c0)\n"
+		"(categoryorder (c0))\n"
+		"(sensitivity s0)\n"
+		"(sensitivityorder (s0))\n"
+		"(sensitivitycategory s0 (c0))\n"
+		"(roletype r t)\n"
+		"(userrole u r)\n"
+		"(userlevel u (s0))\n"
+		"(userrange u ((s0)(s0 (c0))))\n"
+		"(sidcontext kernel (u r t ((s0)(s0))))\n"
+		"(typeattribute domain)\n"
+		"(classpermission rw)\n"
+		"(classpermissionset rw (file (read)))\n"
+		"(allow domain t rw)\n"
+		"(optional keep (type kept) (roletype r kept) (typeattributeset domain (kept))\n"
+		" (classpermissionset rw (file (write))) (classmapping cmap a (file (open))))\n");
+
+	for (i = 0; i < TEST_DEPS_CHAIN; i++) {
+		char next[16];
+
+		if (i + 1 < TEST_DEPS_CHAIN) {
+			snprintf(next, sizeof(next), "t%d", i + 1);
+		} else {
+			snprintf(next, sizeof(next), "absent");
+		}
+
+		used += snprintf(policy + used, size - used,
+			"(optional o%d (type t%d) (roletype r t%d) (typealias a%d) (typealiasactual a%d t%d)\n"
+			" (typeattributeset domain (t%d)) (classpermissionset rw (file (open)))\n"
+			" (classmapping cmap a (file (write))) (allow a%d %s (cmap (a))))\n",
+			i, i, i, i, i, i, i, i, next);
+	}
+
+	return policy;
+}
+
+static void __test_deps_append(char **summary, size_t *used, size_t *size, const char *str) {
+	size_t len = strlen(str);
+
+	while (*used + len + 1 > *size) {
+		*size *= 2;
+		*summary = realloc(*summary, *size);
+	}
+	memcpy(*summary + *used, str, len + 1);
+	*used += len;
+}
+
+static void __test_deps_classperms(char **summary, size_t *used, size_t *size, struct cil_list *classperms) {
+	struct cil_list_item *curr;
+	struct cil_list_item *perm;
+
+	cil_list_for_each(curr, classperms) {
+		struct cil_classperms *cp = curr->data;
+		__test_deps_append(summary, used, size, " ");
+		__test_deps_append(summary, used, size, DATUM(cp->class)->fqn);
+		cil_list_for_each(perm, cp->perms) {
+			__test_deps_append(summary, used, size, " ");
+			__test_deps_append(summary, used, size, DATUM(perm->data)->fqn);
+		}
+	}
+	__test_deps_append(summary, used, size, "\n");
+}
+
+static struct cil_symtab_datum *__test_deps_lookup(struct cil_db *db, enum cil_sym_index sym_index, char *name) {
+	struct cil_symtab_datum *datum = NULL;
+	struct cil_root *root = db->ast->root->data;
+
+	cil_symtab_get_datum(&root->symtab[sym_index], cil_strpool_add(name), &datum);
+
+	return datum;
+}
+
+/* The types in value order, the members of the attribute and what the named
+ * sets hold */
+static char *__test_deps_compile(char *policy, int full_reset, int *rc) {
+	struct cil_db_thread prev;
+	struct cil_db *db = NULL;
+	sepol_policydb_t *pdb = NULL;
+	struct cil_symtab_datum *datum = NULL;
+	struct cil_typeattribute *attr = NULL;
+	struct cil_classpermission *cp = NULL;
+	struct cil_class *map = NULL;
+	struct cil_perm *perm = NULL;
+	size_t size = 1024;
+	size_t used = 0;
+	char *summary = malloc(size);
+	char line[256];
+	int i;
+
+	summary[0] = '\0';
+
+	cil_db_init(&db);
+	cil_set_full_reset(db, full_reset);
+	sepol_policydb_create(&pdb);
+
+	*rc = cil_add_file(db, "test.cil", policy, strlen(policy));
+	if (*rc == SEPOL_OK) {
+		*rc = cil_compile(db, pdb);
+	}
+	if (*rc != SEPOL_OK) {
+		goto exit;
+	}
+
+	cil_db_enter(db, &prev);
+
+	for (i = 0; i < db->num_types; i++) {
+		snprintf(line, sizeof(line), "%s %u\n", db->val_to_type[i]->datum.fqn, cil_tree_node_line(NODE(db->val_to_type[i])));
+		__test_deps_append(&summary, &used, &size, line);
+	}
+
+	attr = (struct cil_typeattribute *)__test_deps_lookup(db, CIL_SYM_TYPES, "domain");
+	__test_deps_append(&summary, &used, &size, "domain");
+	for (i = 0; i < db->num_types; i++) {
+		if (ebitmap_get_bit(attr->types, i)) {
+			snprintf(line, sizeof(line), " %s", db->val_to_type[i]->datum.fqn);
+			__test_deps_append(&summary, &used, &size, line);
+		}
+	}
+	__test_deps_append(&summary, &used, &size, "\n");
+
+	cp = (struct cil_classpermission *)__test_deps_lookup(db, CIL_SYM_CLASSPERMSETS, "rw");
+	__test_deps_append(&summary, &used, &size, "rw");
+	__test_deps_classperms(&summary, &used, &size, cp->classperms);
+
+	map = (struct cil_class *)__test_deps_lookup(db, CIL_SYM_CLASSES, "cmap");
+	cil_symtab_get_datum(&map->perms, cil_strpool_add("a"), &datum);
+	perm = (struct cil_perm *)datum;
+	__test_deps_append(&summary, &used, &size, "cmap.a");
+	__test_deps_classperms(&summary, &used, &size, perm->classperms);
+
+	cil_db_leave(&prev);
+
+exit:
+	sepol_policydb_free(pdb);
+	cil_db_destroy(&db);
+	return summary;
+}
+
+void test_cil_deps_same_as_full_reset(CuTest *tc) {
+	char *policy = __test_deps_policy();
+	char *full = NULL;
+	char *incremental = NULL;
+	int rc_full = SEPOL_ERR;
+	int rc_incremental = SEPOL_ERR;
+
+	full = __test_deps_compile(policy, CIL_TRUE, &rc_full);
+	incremental = __test_deps_compile(policy, CIL_FALSE, &rc_incremental);
+
+	CuAssertIntEquals(tc, SEPOL_OK, rc_full);
+	CuAssertIntEquals(tc, SEPOL_OK, rc_incremental);
+	CuAssertStrEquals(tc, full, incremental);
+
+	/* The whole chain is gone and what it added to the sets with it */
+	CuAssertPtrEquals(tc, NULL, strstr(incremental, "t0 "));
+	CuAssertPtrNotNull(tc, strstr(incremental, "domain kept\n"));
+	CuAssertPtrNotNull(tc, strstr(incremental, "rw file read file write\n"));
+	CuAssertPtrNotNull(tc, strstr(incremental, "cmap.a file read file open\n"));
+
+	free(full);
+	free(incremental);
+	free(policy);
+}
+
+/* Blocks that inherit templates and call macros, some of them in
+ * optionals that are disabled in the later passes, so the worklists are
+ * rebuilt after copies, call expansion and resets */
+static char *__test_deps_worklist_policy(void) {
+	size_t size = 4096 + TEST_DEPS_BLOCKS * 512;
+	char *policy = malloc(size);
+	size_t used;
+	int i;
+
+	used = snprintf(policy, size,
+		"(class file (read write open))\n"
+		"(classorder (file))\n"
+		"(sid kernel)\n"
+		"(sidorder (kernel))\n"
+		"(user u)\n"
+		"(role r)\n"
+		"(type t)\n"
+		"(category c0)\n"
+		"(categoryorder (c0))\n"
+		"(sensitivity s0)\n"
+		"(sensitivityorder (s0))\n"
+		"(sensitivitycategory s0 (c0))\n"
+		"(roletype r t)\n"
+		"(userrole u r)\n"
+		"(userlevel u (s0))\n"
+		"(userrange u ((s0)(s0 (c0))))\n"
+		"(sidcontext kernel (u r t ((s0)(s0))))\n"
+		"(typeattribute domain)\n"
+		"(allow domain t (file (read)))\n"
+		"(macro m ((type a))\n"
+		" (roletype r a) (allow a t (file (write))) (typeattributeset domain (a)))\n"
+		"(block tmpl (blockabstract tmpl)\n"
+		" (type x) (call m (x)) (allow x self (file (open)))\n"
+		" (block inner (blockabstract inner) (allow z self (file (read)))))\n"
+		"(block mtmpl (blockabstract mtmpl)\n"
+		" (macro n ((type a)) (allow a self (file (read)))))\n");
+
+	for (i = 0; i < TEST_DEPS_BLOCKS; i++) {
+		if (i % 2 == 0) {
+			used += snprintf(policy + used, size - used,
+				"(block b%d (blockinherit tmpl) (blockinherit mtmpl)"
+				" (type y) (call m (y)) (call n (y)))\n", i);
+		} else {
+			/* Every other one fails on a type declared nowhere */
+			used += snprintf(policy + used, size - used,
+				"(optional o%d (block b%d (blockinherit tmpl) (type y) (call m (y))"
+				" (allow y %s (file (read)))))\n",
+				i, i, i % 4 == 1 ? "absent" : "t");
+		}
+	}
+
+	return policy;
+}
+
+struct test_deps_walk {
+	int total;
+	int resolved;
+};
+
+static int __test_deps_walk_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args) {
+	struct test_deps_walk *walk = extra_args;
+	int resolved;
+
+	switch (node->flavor) {
+	case CIL_MACRO:
+		*finished = CIL_TREE_SKIP_HEAD;
+		return SEPOL_OK;
+	case CIL_BLOCK:
+		if (((struct cil_block *)node->data)->is_abstract == CIL_TRUE) {
+			*finished = CIL_TREE_SKIP_HEAD;
+		}
+		return SEPOL_OK;
+	case CIL_AVRULE: {
+		struct cil_avrule *rule = node->data;
+		resolved = (rule->src != NULL && rule->tgt != NULL);
+		break;
+	}
+	case CIL_ROLETYPE: {
+		struct cil_roletype *roletype = node->data;
+		resolved = (roletype->role != NULL && roletype->type != NULL);
+		break;
+	}
+	case CIL_TYPEATTRIBUTESET:
+		resolved = (((struct cil_typeattributeset *)node->data)->datum_expr != NULL);
+		break;
+	case CIL_CALL:
+		resolved = (((struct cil_call *)node->data)->macro != NULL);
+		break;
+	default:
+		return SEPOL_OK;
+	}
+
+	walk->total++;
+	if (resolved) {
+		walk->resolved++;
+	}
+
+	return SEPOL_OK;
+}
+
+static int __test_deps_walk(char *policy, int full_reset, int jobs, struct test_deps_walk *walk) {
+	struct cil_db_thread prev;
+	struct cil_db *db = NULL;
+	sepol_policydb_t *pdb = NULL;
+	int rc;
+
+	cil_db_init(&db);
+	cil_set_full_reset(db, full_reset);
+	cil_set_resolve_jobs(db, jobs);
+	sepol_policydb_create(&pdb);
+
+	rc = cil_add_file(db, "test.cil", policy, strlen(policy));
+	if (rc == SEPOL_OK) {
+		rc = cil_compile(db, pdb);
+	}
+	if (rc == SEPOL_OK) {
+		cil_db_enter(db, &prev);
+		rc = cil_tree_walk(db->ast->root, __test_deps_walk_helper, NULL, NULL, walk);
+		cil_db_leave(&prev);
+	}
+
+	sepol_policydb_free(pdb);
+	cil_db_destroy(&db);
+	return rc;
+}
+
+void test_cil_deps_worklists_match_tree_walk(CuTest *tc) {
+	char *policy = __test_deps_worklist_policy();
+	int full_reset;
+	int jobs;
+
+	for (full_reset = CIL_FALSE; full_reset <= CIL_TRUE; full_reset++) {
+		for (jobs = 1; jobs <= 4; jobs *= 4) {
+			struct test_deps_walk walk = { 0, 0 };
+			int rc = __test_deps_walk(policy, full_reset, jobs, &walk);
+
+			CuAssertIntEquals(tc, SEPOL_OK, rc);
+			/* The roletype and allow outside the blocks, then per kept
+			 * block the allow and call of the template and its own call,
+			 * each call bringing three statements, the call of the
+			 * inherited macro outside the optionals and the allow it
+			 * brings, and the allow of the kept optionals */
+			CuAssertIntEquals(tc, 2 + (TEST_DEPS_BLOCKS - TEST_DEPS_BLOCKS / 4) * 9 + TEST_DEPS_BLOCKS / 2 * 2 + TEST_DEPS_BLOCKS / 4, walk.total);
+			CuAssertIntEquals(tc, walk.total, walk.resolved);
+		}
+	}
+
+	free(policy);
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+
+#include <sepol/errcodes.h>
+
+#include "CuTest.h"
+#include "test_cil_index.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_tree.h"
+#include "../../src/cil_index.h"
+
+static struct cil_tree_node *__test_add_child(struct cil_tree_node *parent, enum cil_flavor flavor) {
+	struct cil_tree_node *node;
+
+	cil_tree_node_init(&node);
+	node->flavor = flavor;
+	cil_tree_node_set_parent(node, parent);
+	if (cil_tree_node_head(parent) == NULL) {
+		cil_tree_node_set_head(parent, node);
+	} else {
+		cil_tree_node_set_next(cil_tree_node_tail(parent), node);
+	}
+	cil_tree_node_set_tail(parent, node);
+
+	return node;
+}
+
+static struct cil_tree_node *__test_add_block(struct cil_tree_node *parent, int is_abstract) {
+	struct cil_tree_node *node = __test_add_child(parent, CIL_BLOCK);
+	struct cil_block *block;
+
+	cil_block_init(&block);
+	block->is_abstract = is_abstract;
+	cil_vector_append(&block->datum.nodes, node);
+	node->data = block;
+
+	return node;
+}
+
+static struct cil_tree_node *__test_add_macro(struct cil_tree_node *parent) {
+	struct cil_tree_node *node = __test_add_child(parent, CIL_MACRO);
+	struct cil_macro *macro;
+
+	cil_macro_init(&macro);
+	cil_vector_append(&macro->datum.nodes, node);
+	node->data = macro;
+
+	return node;
+}
+
+/* avrule (block abstract (avrule)) (macro (avrule))
+ * (booleanif (condblock (avrule))) roleallow (block (avrule)) */
+static struct cil_tree *__test_tree(struct cil_tree_node **nodes) {
+	struct cil_tree *tree;
+	struct cil_tree_node *node;
+
+	cil_tree_init(&tree);
+	nodes[0] = __test_add_child(tree->root, CIL_AVRULE);
+	nodes[6] = __test_add_block(tree->root, CIL_TRUE);
+	__test_add_child(nodes[6], CIL_AVRULE);
+	node = __test_add_macro(tree->root);
+	__test_add_child(node, CIL_AVRULE);
+	nodes[1] = __test_add_child(tree->root, CIL_BOOLEANIF);
+	node = __test_add_child(nodes[1], CIL_CONDBLOCK);
+	nodes[2] = __test_add_child(node, CIL_AVRULE);
+	nodes[3] = __test_add_child(tree->root, CIL_ROLEALLOW);
+	nodes[4] = __test_add_block(tree->root, CIL_FALSE);
+	nodes[5] = __test_add_child(nodes[4], CIL_AVRULE);
+
+	return tree;
+}
+
+void test_cil_index_build(CuTest *tc) {
+	struct cil_tree *tree;
+	struct cil_tree_node *nodes[7];
+	struct cil_index *index;
+	struct cil_index_list *list;
+
+	tree = __test_tree(nodes);
+	cil_index_init(&index);
+
+	int rc = cil_index_build(index, tree->root);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+	list = cil_index_get(index, CIL_AVRULE);
+	CuAssertIntEquals(tc, 3, list->count);
+	CuAssertPtrEquals(tc, nodes[0], list->entries[0].node);
+	CuAssertPtrEquals(tc, NULL, list->entries[0].boolif);
+	CuAssertPtrEquals(tc, nodes[2], list->entries[1].node);
+	CuAssertPtrEquals(tc, nodes[1], list->entries[1].boolif);
+	CuAssertPtrEquals(tc, nodes[5], list->entries[2].node);
+	CuAssertPtrEquals(tc, NULL, list->entries[2].boolif);
+
+	/* An abstract block is indexed, but not its contents */
+	list = cil_index_get(index, CIL_BLOCK);
+	CuAssertIntEquals(tc, 2, list->count);
+	CuAssertPtrEquals(tc, nodes[6], list->entries[0].node);
+	CuAssertPtrEquals(tc, nodes[4], list->entries[1].node);
+
+	CuAssertIntEquals(tc, 0, cil_index_get(index, CIL_MACRO)->count);
+	CuAssertPtrEquals(tc, NULL, cil_index_get(index, CIL_OP));
+
+	/* Rebuilding does not keep the old entries */
+	rc = cil_index_build(index, tree->root);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, cil_index_get(index, CIL_AVRULE)->count);
+	CuAssertIntEquals(tc, 8, index->count);
+
+	cil_index_destroy(&index);
+	CuAssertPtrEquals(tc, NULL, index);
+	cil_tree_destroy(&tree);
+}
+
+struct test_walk {
+	struct cil_tree_node *nodes[8];
+	int count;
+};
+
+static int __test_walk_helper(struct cil_index_entry *entry, void *extra_args) {
+	struct test_walk *walk = extra_args;
+
+	walk->nodes[walk->count++] = entry->node;
+
+	return SEPOL_OK;
+}
+
+void test_cil_index_walk(CuTest *tc) {
+	struct cil_tree *tree;
+	struct cil_tree_node *nodes[7];
+	struct cil_index *index;
+	struct test_walk walk;
+	enum cil_flavor flavors[] = { CIL_ROLEALLOW, CIL_AVRULE, CIL_FILECON };
+
+	tree = __test_tree(nodes);
+	cil_index_init(&index);
+	cil_index_build(index, tree->root);
+
+	walk.count = 0;
+	int rc = cil_index_walk(index, flavors, 3, __test_walk_helper, &walk);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 4, walk.count);
+	CuAssertPtrEquals(tc, nodes[0], walk.nodes[0]);
+	CuAssertPtrEquals(tc, nodes[2], walk.nodes[1]);
+	CuAssertPtrEquals(tc, nodes[3], walk.nodes[2]);
+	CuAssertPtrEquals(tc, nodes[5], walk.nodes[3]);
+
+	cil_index_destroy(&index);
+	cil_tree_destroy(&tree);
+}
+
+void test_cil_index_walk_too_many(CuTest *tc) {
+	struct cil_index *index;
+	struct test_walk walk;
+	enum cil_flavor flavors[CIL_INDEX_MAX_WALK + 1];
+	int i;
+
+	for (i = 0; i < CIL_INDEX_MAX_WALK + 1; i++) {
+		flavors[i] = CIL_AVRULE;
+	}
+
+	cil_index_init(&index);
+
+	walk.count = 0;
+	int rc = cil_index_walk(index, flavors, CIL_INDEX_MAX_WALK + 1, __test_walk_helper, &walk);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertIntEquals(tc, 0, walk.count);
+
+	cil_index_destroy(&index);
+}
@@ -27,6 +27,10 @@
  * either expressed or implied, of Tresys Technology, LLC.
  */
 
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
 #include <sepol/policydb/policydb.h>
 
 #include "CuTest.h"
@@ -35,6 +39,7 @@
 #include "../../src/cil_lexer.h"
 
 void test_cil_lexer_setup(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
    char *test_str = "(test \"qstring\");comment\n";
    uint32_t str_size = strlen(test_str);
    char *buffer = malloc(str_size + 2);
@@ -42,13 +47,15 @@ void test_cil_lexer_setup(CuTest *tc) {
    memset(buffer+str_size, 0, 2);
    strncpy(buffer, test_str, str_size);
 
-   int rc = cil_lexer_setup(buffer, str_size + 2);
+   int rc = cil_lexer_setup(&lexer, buffer, str_size + 2);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
 
+   cil_lexer_destroy(&lexer);
    free(buffer);
 }
 
 void test_cil_lexer_next(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
    char *test_str = "(test \"qstring\") ;comment\n";
    uint32_t str_size = strlen(test_str);
    char *buffer = malloc(str_size + 2);
@@ -56,45 +63,229 @@ void test_cil_lexer_next(CuTest *tc) {
    memset(buffer+str_size, 0, 2);
    strcpy(buffer, test_str);
 
-   cil_lexer_setup(buffer, str_size + 2);
+   cil_lexer_setup(&lexer, buffer, str_size + 2);
 
    struct token test_tok;
 
-   int rc = cil_lexer_next(&test_tok);
+   int rc = cil_lexer_next(lexer, &test_tok);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
 
    CuAssertIntEquals(tc, OPAREN, test_tok.type);
    CuAssertStrEquals(tc, "(", test_tok.value);
    CuAssertIntEquals(tc, 1, test_tok.line);
 
-   rc = cil_lexer_next(&test_tok);
+   rc = cil_lexer_next(lexer, &test_tok);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
    
    CuAssertIntEquals(tc, SYMBOL, test_tok.type);
    CuAssertStrEquals(tc, "test", test_tok.value);
    CuAssertIntEquals(tc, 1, test_tok.line);
  
-   rc = cil_lexer_next(&test_tok);
+   rc = cil_lexer_next(lexer, &test_tok);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
    
    CuAssertIntEquals(tc, QSTRING, test_tok.type);
    CuAssertStrEquals(tc, "\"qstring\"", test_tok.value);
    CuAssertIntEquals(tc, 1, test_tok.line);
  
-   rc = cil_lexer_next(&test_tok);
+   rc = cil_lexer_next(lexer, &test_tok);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
    
    CuAssertIntEquals(tc, CPAREN, test_tok.type);
    CuAssertStrEquals(tc, ")", test_tok.value);
    CuAssertIntEquals(tc, 1, test_tok.line);
 
-   rc = cil_lexer_next(&test_tok);
+   rc = cil_lexer_next(lexer, &test_tok);
    CuAssertIntEquals(tc, SEPOL_OK, rc);
   
    CuAssertIntEquals(tc, COMMENT, test_tok.type);
    CuAssertStrEquals(tc, ";comment", test_tok.value);
    CuAssertIntEquals(tc, 1, test_tok.line);
 
+   cil_lexer_destroy(&lexer);
+   free(buffer);
+}
+
+
+void test_cil_lexer_setup_no_nul_neg(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
+   char buffer[] = "(test)";
+
+   int rc = cil_lexer_setup(&lexer, buffer, strlen(buffer));
+   CuAssertIntEquals(tc, SEPOL_ERR, rc);
+}
+
+void test_cil_lexer_next_lines(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
+   char *test_str = "(a\r\n;comment\r\n\n\t b)";
+   uint32_t str_size = strlen(test_str);
+   char *buffer = malloc(str_size + 2);
+
+   memset(buffer+str_size, 0, 2);
+   strcpy(buffer, test_str);
+
+   cil_lexer_setup(&lexer, buffer, str_size + 2);
+
+   struct token test_tok;
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+   CuAssertIntEquals(tc, 1, test_tok.line);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, SYMBOL, test_tok.type);
+   CuAssertStrEquals(tc, "a", test_tok.value);
+   CuAssertIntEquals(tc, 1, test_tok.line);
+
+   /* "\r\n" counts as two newlines */
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, COMMENT, test_tok.type);
+   CuAssertStrEquals(tc, ";comment\r", test_tok.value);
+   CuAssertIntEquals(tc, 3, test_tok.line);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, SYMBOL, test_tok.type);
+   CuAssertStrEquals(tc, "b", test_tok.value);
+   CuAssertIntEquals(tc, 5, test_tok.line);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, CPAREN, test_tok.type);
+   CuAssertIntEquals(tc, 5, test_tok.line);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, END_OF_FILE, test_tok.type);
+   CuAssertIntEquals(tc, 5, test_tok.line);
+
+   cil_lexer_destroy(&lexer);
    free(buffer);
 }
 
+void test_cil_lexer_next_long_symbol(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
+   char *test_str = "(abcdefghijklmnopqrstuvwxyz.ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789-abcdefghij)";
+   uint32_t str_size = strlen(test_str);
+   char *buffer = malloc(str_size + 2);
+
+   memset(buffer+str_size, 0, 2);
+   strcpy(buffer, test_str);
+
+   cil_lexer_setup(&lexer, buffer, str_size + 2);
+
+   struct token test_tok;
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, SYMBOL, test_tok.type);
+   CuAssertStrEquals(tc, "abcdefghijklmnopqrstuvwxyz.ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789-abcdefghij", test_tok.value);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, CPAREN, test_tok.type);
+   CuAssertStrEquals(tc, ")", test_tok.value);
+
+   cil_lexer_destroy(&lexer);
+   free(buffer);
+}
+
+void test_cil_lexer_next_unterminated_qstring_neg(CuTest *tc) {
+   struct cil_lexer *lexer = NULL;
+   char *test_str = "(\"qstring\n\")";
+   uint32_t str_size = strlen(test_str);
+   char *buffer = malloc(str_size + 2);
+
+   memset(buffer+str_size, 0, 2);
+   strcpy(buffer, test_str);
+
+   cil_lexer_setup(&lexer, buffer, str_size + 2);
+
+   struct token test_tok;
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, UNKNOWN, test_tok.type);
+   CuAssertStrEquals(tc, "\"", test_tok.value);
+   CuAssertIntEquals(tc, 1, test_tok.line);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, SYMBOL, test_tok.type);
+   CuAssertStrEquals(tc, "qstring", test_tok.value);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, UNKNOWN, test_tok.type);
+   CuAssertStrEquals(tc, "\"", test_tok.value);
+   CuAssertIntEquals(tc, 2, test_tok.line);
+
+   cil_lexer_destroy(&lexer);
+   free(buffer);
+}
+
+void test_cil_lexer_next_interleaved(CuTest *tc) {
+   char buffer1[] = "(first\n one)\0";
+   char buffer2[] = "\n\n(second)\0";
+   struct cil_lexer *lexer1 = NULL;
+   struct cil_lexer *lexer2 = NULL;
+   struct token test_tok;
+
+   int rc = cil_lexer_setup(&lexer1, buffer1, sizeof(buffer1));
+   CuAssertIntEquals(tc, SEPOL_OK, rc);
+   rc = cil_lexer_setup(&lexer2, buffer2, sizeof(buffer2));
+   CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+   cil_lexer_next(lexer1, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+   cil_lexer_next(lexer2, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+   CuAssertIntEquals(tc, 3, test_tok.line);
+
+   cil_lexer_next(lexer1, &test_tok);
+   CuAssertStrEquals(tc, "first", test_tok.value);
+   cil_lexer_next(lexer2, &test_tok);
+   CuAssertStrEquals(tc, "second", test_tok.value);
+
+   cil_lexer_next(lexer1, &test_tok);
+   CuAssertStrEquals(tc, "one", test_tok.value);
+   CuAssertIntEquals(tc, 2, test_tok.line);
+   cil_lexer_next(lexer2, &test_tok);
+   CuAssertIntEquals(tc, CPAREN, test_tok.type);
+   CuAssertIntEquals(tc, 3, test_tok.line);
+
+   cil_lexer_destroy(&lexer1);
+   cil_lexer_destroy(&lexer2);
+   CuAssertPtrEquals(tc, NULL, lexer1);
+}
+
+void test_cil_lexer_next_read_only(CuTest *tc) {
+   char *test_str = "(test \"qstring\") ;comment\n";
+   uint32_t str_size = strlen(test_str);
+   struct cil_lexer *lexer = NULL;
+   struct token test_tok;
+   char *buffer = mmap(NULL, str_size + 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+   CuAssertTrue(tc, buffer != MAP_FAILED);
+   memcpy(buffer, test_str, str_size);
+   mprotect(buffer, str_size + 2, PROT_READ);
+
+   int rc = cil_lexer_setup(&lexer, buffer, str_size + 2);
+   CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, OPAREN, test_tok.type);
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertStrEquals(tc, "test", test_tok.value);
+   CuAssertIntEquals(tc, 4, test_tok.len);
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertStrEquals(tc, "\"qstring\"", test_tok.value);
+   CuAssertIntEquals(tc, 9, test_tok.len);
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, CPAREN, test_tok.type);
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, COMMENT, test_tok.type);
+   cil_lexer_next(lexer, &test_tok);
+   CuAssertIntEquals(tc, END_OF_FILE, test_tok.type);
+
+   cil_lexer_destroy(&lexer);
+   munmap(buffer, str_size + 2);
+}
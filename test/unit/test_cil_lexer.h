@@ -34,5 +34,11 @@
 
 void test_cil_lexer_setup(CuTest *);
 void test_cil_lexer_next(CuTest *);
+void test_cil_lexer_setup_no_nul_neg(CuTest *);
+void test_cil_lexer_next_lines(CuTest *);
+void test_cil_lexer_next_long_symbol(CuTest *);
+void test_cil_lexer_next_unterminated_qstring_neg(CuTest *);
+void test_cil_lexer_next_interleaved(CuTest *);
+void test_cil_lexer_next_read_only(CuTest *);
 
 #endif
@@ -57,8 +57,8 @@ void test_cil_list_append_item(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -67,7 +67,7 @@ void test_cil_list_append_item(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_append_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -85,8 +85,8 @@ void test_cil_list_append_item_append(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -95,14 +95,14 @@ void test_cil_list_append_item_append(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_append_item(test_class_list, test_new_item);
 	
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head->next;
+	test_new_item->data = cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))));
 	
 	int rc2 = cil_list_append_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -121,8 +121,8 @@ void test_cil_list_append_item_append_extra(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -131,19 +131,19 @@ void test_cil_list_append_item_append_extra(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_append_item(test_class_list, test_new_item);
 	
 	cil_list_item_init(&test_new_item);
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head->next;
+	test_new_item->data = cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))));
 	
 	int rc2 = cil_list_append_item(test_class_list, test_new_item);
 	
 	cil_list_item_init(&test_new_item);
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head->next->next;
+	test_new_item->data = cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))))));
 	
 	int rc3 = cil_list_append_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -163,8 +163,8 @@ void test_cil_list_append_item_listnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list = NULL;
 
@@ -172,7 +172,7 @@ void test_cil_list_append_item_listnull_neg(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_append_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -190,8 +190,8 @@ void test_cil_list_append_item_itemnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -214,8 +214,8 @@ void test_cil_list_prepend_item(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -224,7 +224,7 @@ void test_cil_list_prepend_item(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_prepend_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
@@ -242,8 +242,8 @@ void test_cil_list_prepend_item_prepend(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -252,7 +252,7 @@ void test_cil_list_prepend_item_prepend(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_prepend_item(test_class_list, test_new_item);
 	
@@ -271,8 +271,8 @@ void test_cil_list_prepend_item_prepend_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -281,12 +281,12 @@ void test_cil_list_prepend_item_prepend_neg(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	struct cil_list_item *test_new_item_next;
 	cil_list_item_init(&test_new_item_next);
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head->next;
+	test_new_item->data = cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root)))));
 	test_new_item->next = test_new_item_next;	
 	
 	int rc = cil_list_prepend_item(test_class_list, test_new_item);
@@ -305,8 +305,8 @@ void test_cil_list_prepend_item_listnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list = NULL;
 
@@ -314,7 +314,7 @@ void test_cil_list_prepend_item_listnull_neg(CuTest *tc) {
 	cil_list_item_init(&test_new_item);
 
 	test_new_item->flavor = CIL_CLASS;
-	test_new_item->data = test_tree->root->cl_head->cl_head->next->cl_head;
+	test_new_item->data = cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(cil_tree_node_head(test_tree->root))));
 
 	int rc = cil_list_prepend_item(test_class_list, test_new_item);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
@@ -332,8 +332,8 @@ void test_cil_list_prepend_item_itemnull_neg(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	struct cil_list *test_class_list;
 	cil_list_init(&test_class_list);
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <dirent.h>
+#include <limits.h>
+#include <unistd.h>
+
+#include <sepol/policydb/policydb.h>
+
+#include "CuTest.h"
+#include "test_cil_parse_cache.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_parse_cache.h"
+#include "../../src/cil_parser.h"
+
+struct parse_cache_test_output {
+	char text[256];
+	int count;
+};
+
+static void __test_parse_cache_print(struct parse_cache_test_output *out, struct cil_parse_token *token) {
+	struct cil_parse_token *child = NULL;
+
+	if (token->data != NULL) {
+		snprintf(out->text + strlen(out->text), sizeof(out->text) - strlen(out->text), " %s:%d", (char *)token->data, cil_tree_loc_line(token->loc));
+		return;
+	}
+
+	strncat(out->text, " (", sizeof(out->text) - strlen(out->text) - 1);
+	for (child = cil_parse_token_child(token); child != NULL; child = cil_parse_token_next(child)) {
+		__test_parse_cache_print(out, child);
+	}
+	strncat(out->text, " )", sizeof(out->text) - strlen(out->text) - 1);
+}
+
+static int __test_parse_cache_statement(struct cil_parse_token *statement, void *extra_args) {
+	struct parse_cache_test_output *out = extra_args;
+
+	__test_parse_cache_print(out, statement);
+	out->count++;
+
+	return SEPOL_OK;
+}
+
+static int __test_parse_cache_parse(struct cil_parse_cache *cache, const char *str, struct parse_cache_test_output *out) {
+	uint32_t size = strlen(str);
+	char *buffer = malloc(size + 2);
+	struct cil_parse_tokens *tokens = NULL;
+	int rc;
+
+	memcpy(buffer, str, size);
+	memset(buffer + size, 0, 2);
+	memset(out, 0, sizeof(*out));
+
+	cil_parse_tokens_init(&tokens);
+
+	rc = cil_parse_cache_parse(cache, "test.cil", buffer, size + 2, tokens);
+	if (rc == SEPOL_OK) {
+		rc = cil_parse_tokens_walk(tokens, __test_parse_cache_statement, out);
+	}
+
+	cil_parse_tokens_destroy(&tokens);
+	free(buffer);
+
+	return rc;
+}
+
+static void __test_parse_cache_clear(char *dir) {
+	char path[PATH_MAX];
+	struct dirent *entry;
+	DIR *d = opendir(dir);
+
+	while ((entry = readdir(d)) != NULL) {
+		if (entry->d_name[0] != '.') {
+			snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+			unlink(path);
+		}
+	}
+	closedir(d);
+}
+
+void test_cil_parse_cache_parse(CuTest *tc) {
+	char dir[] = "/tmp/cil_parse_cache_XXXXXX";
+	char *str = "(type a)\n(block b\n\t(type \"c d\"))\n;comment\n(allow a a (file (read)))";
+	struct parse_cache_test_output miss;
+	struct parse_cache_test_output hit;
+	struct cil_parse_cache *cache = NULL;
+	unsigned int hits, misses;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	CuAssertPtrNotNull(tc, mkdtemp(dir));
+
+	int rc = cil_parse_cache_init(&cache, dir);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+	rc = __test_parse_cache_parse(cache, str, &miss);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, miss.count);
+
+	rc = __test_parse_cache_parse(cache, str, &hit);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, hit.count);
+	CuAssertStrEquals(tc, miss.text, hit.text);
+
+	cil_parse_cache_stats(cache, &hits, &misses);
+	CuAssertIntEquals(tc, 1, hits);
+	CuAssertIntEquals(tc, 1, misses);
+
+	cil_parse_cache_destroy(&cache);
+	__test_parse_cache_clear(dir);
+	rmdir(dir);
+}
+
+void test_cil_parse_cache_parse_truncated(CuTest *tc) {
+	char dir[] = "/tmp/cil_parse_cache_XXXXXX";
+	char path[PATH_MAX];
+	char *str = "(type a)\n(type b)";
+	struct parse_cache_test_output out;
+	struct cil_parse_cache *cache = NULL;
+	struct dirent *entry;
+	unsigned int hits, misses;
+	DIR *d;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	CuAssertPtrNotNull(tc, mkdtemp(dir));
+	cil_parse_cache_init(&cache, dir);
+
+	__test_parse_cache_parse(cache, str, &out);
+
+	d = opendir(dir);
+	while ((entry = readdir(d)) != NULL) {
+		if (entry->d_name[0] != '.') {
+			snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+			CuAssertIntEquals(tc, 0, truncate(path, 40));
+		}
+	}
+	closedir(d);
+
+	int rc = __test_parse_cache_parse(cache, str, &out);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 2, out.count);
+
+	cil_parse_cache_stats(cache, &hits, &misses);
+	CuAssertIntEquals(tc, 0, hits);
+	CuAssertIntEquals(tc, 2, misses);
+
+	cil_parse_cache_destroy(&cache);
+	__test_parse_cache_clear(dir);
+	rmdir(dir);
+}
+
+void test_cil_parse_cache_init_nodir_neg(CuTest *tc) {
+	struct cil_parse_cache *cache = NULL;
+
+	int rc = cil_parse_cache_init(&cache, "/nonexistent/cil_parse_cache");
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertPtrEquals(tc, NULL, cache);
+}
@@ -27,6 +27,10 @@
  * either expressed or implied, of Tresys Technology, LLC.
  */
 
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
 #include <sepol/policydb/policydb.h>
 
 #include "CuTest.h"
@@ -55,3 +59,229 @@ void test_cil_parser(CuTest *tc) {
 	// TODO add checking of the parse tree that is returned
 }
 
+
+static int __test_parser_stream_count(struct cil_parse_token *statement, void *extra_args) {
+	int *count = extra_args;
+
+	if (statement->data != NULL || cil_parse_token_child(statement) == NULL) {
+		return SEPOL_ERR;
+	}
+
+	(*count)++;
+
+	return SEPOL_OK;
+}
+
+void test_cil_parser_stream(CuTest *tc) {
+	char buffer[] = "(type a)\n(block b (type c))\n(allow a a (file (read)))\0";
+	int count = 0;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	int rc = cil_parser_stream("test.cil", buffer, sizeof(buffer), __test_parser_stream_count, &count);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, count);
+}
+
+void test_cil_parser_stream_unbalanced_neg(CuTest *tc) {
+	char buffer[] = "(type a)\n(type b\0";
+	int count = 0;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	int rc = cil_parser_stream("test.cil", buffer, sizeof(buffer), __test_parser_stream_count, &count);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertIntEquals(tc, 1, count);
+}
+
+void test_cil_parser_tokens(CuTest *tc) {
+	char buffer[] = "(a (b \"c d\") ())\n(e)\0";
+	struct cil_parse_tokens *tokens = NULL;
+	struct cil_parse_token *token = NULL;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	cil_parse_tokens_init(&tokens);
+
+	int rc = cil_parser_tokens("test.cil", buffer, sizeof(buffer), tokens);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 12, tokens->count);
+
+	CuAssertIntEquals(tc, 8, tokens->tokens[0].match);
+	CuAssertIntEquals(tc, -8, tokens->tokens[8].match);
+
+	token = cil_parse_token_child(&tokens->tokens[0]);
+	CuAssertStrEquals(tc, "a", token->data);
+	CuAssertPtrEquals(tc, NULL, cil_parse_token_child(token));
+
+	token = cil_parse_token_next(token);
+	CuAssertPtrEquals(tc, NULL, token->data);
+	CuAssertStrEquals(tc, "c d", cil_parse_token_next(cil_parse_token_child(token))->data);
+
+	token = cil_parse_token_next(token);
+	CuAssertPtrEquals(tc, &tokens->tokens[6], token);
+	CuAssertPtrEquals(tc, NULL, cil_parse_token_child(token));
+	CuAssertPtrEquals(tc, NULL, cil_parse_token_next(token));
+
+	token = &tokens->tokens[tokens->tokens[0].match + 1];
+	CuAssertIntEquals(tc, 2, token->line);
+	CuAssertStrEquals(tc, "e", cil_parse_token_child(token)->data);
+	CuAssertPtrEquals(tc, NULL, cil_parse_token_next(cil_parse_token_child(token)));
+
+	cil_parse_tokens_destroy(&tokens);
+}
+
+struct test_stream {
+	const char *data;
+	size_t pos;
+};
+
+static ssize_t __test_stream_read(void *ctx, char *buffer, size_t size) {
+	struct test_stream *stream = ctx;
+
+	if (size == 0 || stream->data[stream->pos] == '\0') {
+		return 0;
+	}
+
+	/* One byte at a time, so every token is split across reads */
+	buffer[0] = stream->data[stream->pos++];
+
+	return 1;
+}
+
+/* Check that streaming str gives the tokens of parsing it in one piece */
+static void __test_add_stream_check(CuTest *tc, const char *str) {
+	char buffer[128];
+	struct test_stream stream = { str, 0 };
+	struct cil_parse_tokens *tokens = NULL;
+	uint32_t i;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	int rc = cil_add_stream(test_db, "test.cil", __test_stream_read, &stream);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertPtrNotNull(tc, test_db->parse);
+
+	memset(buffer, 0, sizeof(buffer));
+	strcpy(buffer, str);
+	cil_parse_tokens_init(&tokens);
+	rc = cil_parser_tokens("test.cil", buffer, strlen(str) + 2, tokens);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+	CuAssertIntEquals(tc, tokens->count, test_db->parse->count);
+	for (i = 0; i < tokens->count; i++) {
+		CuAssertPtrEquals(tc, tokens->tokens[i].data, test_db->parse->tokens[i].data);
+		CuAssertIntEquals(tc, tokens->tokens[i].line, test_db->parse->tokens[i].line);
+		CuAssertIntEquals(tc, tokens->tokens[i].match, test_db->parse->tokens[i].match);
+	}
+
+	cil_parse_tokens_destroy(&tokens);
+}
+
+void test_cil_add_stream(CuTest *tc) {
+	__test_add_stream_check(tc, "(type a) ;(type x)\n(block b\n\t(type \"c d)\"))\r\n(allow a a (file (read)))");
+}
+
+/* A bare '\r' does not end a comment or a quoted string */
+void test_cil_add_stream_bare_cr(CuTest *tc) {
+	__test_add_stream_check(tc, "(type a)\n(block b ; x\r)\n\t(type \"c\r)\"))\n(type e)");
+}
+
+void test_cil_add_stream_unbalanced_neg(CuTest *tc) {
+	struct test_stream stream = { "(type a)\n(type \"b)\"", 0 };
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	int rc = cil_add_stream(test_db, "test.cil", __test_stream_read, &stream);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertPtrEquals(tc, NULL, test_db->parse);
+}
+
+static char *__test_add_files_write(const char *data) {
+	char *name = strdup("/tmp/test_cil_parser.XXXXXX");
+	int fd = mkstemp(name);
+
+	if (fd == -1) {
+		free(name);
+		return NULL;
+	}
+	if (write(fd, data, strlen(data)) != (ssize_t)strlen(data)) {
+		close(fd);
+		unlink(name);
+		free(name);
+		return NULL;
+	}
+	close(fd);
+
+	return name;
+}
+
+static struct cil_tree_node *__test_add_files_type(struct cil_tree_node *node, const char *name) {
+	if (node == NULL || node->flavor != CIL_TYPE || strcmp(DATUM(node->data)->name, name) != 0) {
+		return NULL;
+	}
+
+	return node;
+}
+
+void test_cil_add_files_build_on_parse(CuTest *tc) {
+	char *names[2];
+	struct cil_tree_node *node = NULL;
+
+	names[0] = __test_add_files_write("(type a)\n(type b)\n");
+	names[1] = __test_add_files_write("(type c)\n");
+	CuAssertPtrNotNull(tc, names[0]);
+	CuAssertPtrNotNull(tc, names[1]);
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+	cil_set_build_on_parse(test_db, CIL_TRUE);
+
+	int rc = cil_add_files(test_db, names, 2, 1);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertPtrEquals(tc, NULL, test_db->parse);
+
+	node = __test_add_files_type(cil_tree_node_head(test_db->ast->root), "a");
+	CuAssertPtrNotNull(tc, node);
+	node = __test_add_files_type(cil_tree_node_next(node), "b");
+	CuAssertPtrNotNull(tc, node);
+	node = __test_add_files_type(cil_tree_node_next(node), "c");
+	CuAssertPtrNotNull(tc, node);
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_next(node));
+
+	cil_db_destroy(&test_db);
+	unlink(names[0]);
+	unlink(names[1]);
+	free(names[0]);
+	free(names[1]);
+}
+
+void test_cil_add_files_build_on_parse_unbalanced_neg(CuTest *tc) {
+	char *names[1];
+	struct cil_tree_node *node = NULL;
+
+	names[0] = __test_add_files_write("(type a)\n(type b\n");
+	CuAssertPtrNotNull(tc, names[0]);
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+	cil_set_build_on_parse(test_db, CIL_TRUE);
+
+	/* The file is built as it is parsed, so the statement before the
+	 * error is already in the AST */
+	int rc = cil_add_files(test_db, names, 1, 1);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+
+	node = __test_add_files_type(cil_tree_node_head(test_db->ast->root), "a");
+	CuAssertPtrNotNull(tc, node);
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_next(node));
+
+	cil_db_destroy(&test_db);
+	unlink(names[0]);
+	free(names[0]);
+}
@@ -33,5 +33,13 @@
 #include "CuTest.h"
 
 void test_cil_parser(CuTest *);
+void test_cil_parser_stream(CuTest *);
+void test_cil_parser_stream_unbalanced_neg(CuTest *);
+void test_cil_parser_tokens(CuTest *);
+void test_cil_add_stream(CuTest *);
+void test_cil_add_stream_bare_cr(CuTest *);
+void test_cil_add_stream_unbalanced_neg(CuTest *);
+void test_cil_add_files_build_on_parse(CuTest *);
+void test_cil_add_files_build_on_parse_unbalanced_neg(CuTest *);
 
 #endif
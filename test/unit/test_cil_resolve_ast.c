@@ -79,7 +79,7 @@ void test_cil_resolve_name(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_tree_node *test_curr = test_db->ast->root->cl_head->cl_head;
+	struct cil_tree_node *test_curr = cil_tree_node_head(cil_tree_node_head(test_db->ast->root));
 	struct cil_typealias *test_alias = (struct cil_typealias*)test_curr->data;
 	struct cil_tree_node *type_node = NULL;
 
@@ -103,7 +103,7 @@ void test_cil_resolve_name_invalid_type_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_tree_node *test_curr = test_db->ast->root->cl_head->cl_head;
+	struct cil_tree_node *test_curr = cil_tree_node_head(cil_tree_node_head(test_db->ast->root));
 	struct cil_typealias *test_alias = (struct cil_typealias*)test_curr->data;
 	struct cil_tree_node *type_node = NULL;
 
@@ -142,7 +142,7 @@ void test_cil_resolve_roleallow(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roleallow(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_roleallow(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -162,7 +162,7 @@ void test_cil_resolve_roleallow_srcdecl_neg(CuTest *tc) {
 	int rc1=cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	rc1 = rc1;
 
-	int rc = cil_resolve_roleallow(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_roleallow(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -181,7 +181,7 @@ void test_cil_resolve_roleallow_tgtdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roleallow(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_roleallow(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -201,7 +201,7 @@ void test_cil_resolve_classmapping_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -225,16 +225,16 @@ void test_cil_resolve_classmapping_anon_inmacro(CuTest *tc) {
 	
 	args->pass = CIL_PASS_CALL1;
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))));
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next->next->cl_head, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -260,16 +260,16 @@ void test_cil_resolve_classmapping_anon_inmacro_neg(CuTest *tc) {
 	
 	args->pass = CIL_PASS_CALL1;
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))));
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next->next->cl_head, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -291,7 +291,7 @@ void test_cil_resolve_classmapping_named(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -311,7 +311,7 @@ void test_cil_resolve_classmapping_named_classmapname_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -331,7 +331,7 @@ void test_cil_resolve_classmapping_anon_classmapname_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -351,7 +351,7 @@ void test_cil_resolve_classmapping_anon_permset_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classmapping(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classmapping(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -371,7 +371,7 @@ void test_cil_resolve_rolebounds(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rolebounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_rolebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -391,8 +391,8 @@ void test_cil_resolve_rolebounds_exists_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_rolebounds(test_db->ast->root->cl_head->next->next, args);
-	int rc = cil_resolve_rolebounds(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_rolebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
+	int rc = cil_resolve_rolebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -412,7 +412,7 @@ void test_cil_resolve_rolebounds_role1_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rolebounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_rolebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -432,7 +432,7 @@ void test_cil_resolve_rolebounds_role2_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rolebounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_rolebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -451,7 +451,7 @@ void test_cil_resolve_sensalias(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_sensalias(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_sensalias(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -469,7 +469,7 @@ void test_cil_resolve_sensalias_sensdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_sensalias(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_sensalias(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -488,7 +488,7 @@ void test_cil_resolve_catalias(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_catalias(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_catalias(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -506,7 +506,7 @@ void test_cil_resolve_catalias_catdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_catalias(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_catalias(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);	
 }
 
@@ -526,8 +526,8 @@ void test_cil_resolve_catorder(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
-	int rc2 = cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
+	int rc2 = cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 }
@@ -548,7 +548,7 @@ void test_cil_resolve_catorder_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -569,8 +569,8 @@ void test_cil_resolve_dominance(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_dominance(test_db->ast->root->cl_head->next->next->next, args);
-	int rc2 = cil_resolve_dominance(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_dominance(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc2 = cil_resolve_dominance(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 }
@@ -592,7 +592,7 @@ void test_cil_resolve_dominance_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_dominance(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_dominance(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -616,9 +616,9 @@ void test_cil_resolve_cat_list(CuTest *tc) {
 	struct cil_list *test_cat_list;
 	cil_list_init(&test_cat_list);
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -642,10 +642,10 @@ void test_cil_resolve_cat_list_catlistnull_neg(CuTest *tc) {
 	struct cil_list *test_cat_list;
 	cil_list_init(&test_cat_list);
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	test_catset->cat_list_str = NULL;
 
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -668,9 +668,9 @@ void test_cil_resolve_cat_list_rescatlistnull_neg(CuTest *tc) {
 	
 	struct cil_list *test_cat_list = NULL;
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -698,9 +698,9 @@ void test_cil_resolve_cat_list_catrange(CuTest *tc) {
 	struct cil_list *test_cat_list;
 	cil_list_init(&test_cat_list);
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data;
 
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -725,13 +725,13 @@ void test_cil_resolve_cat_list_catrange_neg(CuTest *tc) {
 	struct cil_list *test_cat_list;
 	cil_list_init(&test_cat_list);
 
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MLS;
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data;
 
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -753,15 +753,15 @@ void test_cil_resolve_cat_list_catname_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MLS;
 	struct cil_list *test_cat_list;
 	cil_list_init(&test_cat_list);
 
-	struct cil_catset *test_catset = (struct cil_catset*)test_db->ast->root->cl_head->next->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data;
 	
-	int rc = cil_resolve_cat_list(test_db->ast->root->cl_head->next->next->next->next, test_catset->cat_list_str, test_cat_list, args);
+	int rc = cil_resolve_cat_list(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), test_catset->cat_list_str, test_cat_list, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -782,9 +782,9 @@ void test_cil_resolve_catset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_catset *test_catset = (struct cil_catset *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	
-	int rc = cil_resolve_catset(test_db->ast->root->cl_head->next->next->next, test_catset, args);
+	int rc = cil_resolve_catset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), test_catset, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -805,9 +805,9 @@ void test_cil_resolve_catset_catlist_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_catset *test_catset = (struct cil_catset *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *test_catset = (struct cil_catset *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	
-	int rc = cil_resolve_catset(test_db->ast->root->cl_head->next->next->next, test_catset, args);
+	int rc = cil_resolve_catset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), test_catset, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -827,12 +827,12 @@ void test_cil_resolve_catrange(CuTest *tc) {
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_catrange(test_db->ast->root->cl_head->next->next->next, (struct cil_catrange*)test_db->ast->root->cl_head->next->next->next->data, args);
+	int rc = cil_resolve_catrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), (struct cil_catrange*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -852,7 +852,7 @@ void test_cil_resolve_catrange_catloworder_neg(CuTest *tc) {
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	test_db->catorder->head = test_db->catorder->head->next;
@@ -860,7 +860,7 @@ void test_cil_resolve_catrange_catloworder_neg(CuTest *tc) {
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_catrange(test_db->ast->root->cl_head->next->next->next, (struct cil_catrange*)test_db->ast->root->cl_head->next->next->next->data, args);
+	int rc = cil_resolve_catrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), (struct cil_catrange*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -880,12 +880,12 @@ void test_cil_resolve_catrange_cathighorder_neg(CuTest *tc) {
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_catrange(test_db->ast->root->cl_head->next->next->next, (struct cil_catrange*)test_db->ast->root->cl_head->next->next->next->data, args);
+	int rc = cil_resolve_catrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), (struct cil_catrange*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -905,12 +905,12 @@ void test_cil_resolve_catrange_cat1_neg(CuTest *tc) {
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_catrange(test_db->ast->root->cl_head->next->next->next, (struct cil_catrange*)test_db->ast->root->cl_head->next->next->next->data, args);
+	int rc = cil_resolve_catrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), (struct cil_catrange*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -930,12 +930,12 @@ void test_cil_resolve_catrange_cat2_neg(CuTest *tc) {
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_catrange(test_db->ast->root->cl_head->next->next->next, (struct cil_catrange*)test_db->ast->root->cl_head->next->next->next->data, args);
+	int rc = cil_resolve_catrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), (struct cil_catrange*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -959,7 +959,7 @@ void test_cil_resolve_senscat(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -984,11 +984,11 @@ void test_cil_resolve_senscat_catrange_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -1013,12 +1013,12 @@ void test_cil_resolve_senscat_catsetname(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_catset *test_catset = (struct cil_catset *)test_db->ast->root->cl_head->next->next->next->next->next->data;
-	cil_resolve_catset(test_db->ast->root->cl_head->next->next->next->next->next, test_catset, args);
+	struct cil_catset *test_catset = (struct cil_catset *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))->data;
+	cil_resolve_catset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), test_catset, args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1041,7 +1041,7 @@ void test_cil_resolve_senscat_catsetname_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1069,7 +1069,7 @@ void test_cil_resolve_senscat_sublist(CuTest *tc) {
 	cil_tree_walk(test_db->ast->root, __cil_resolve_ast_node_helper, NULL, NULL, args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1092,7 +1092,7 @@ void test_cil_resolve_senscat_missingsens_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1116,7 +1116,7 @@ void test_cil_resolve_senscat_category_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1147,7 +1147,7 @@ void test_cil_resolve_senscat_currrangecat(CuTest *tc) {
 
 	args->pass = CIL_PASS_MISC2;
 
-	int rc = cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1174,13 +1174,13 @@ void test_cil_resolve_level(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
-	int rc2 = cil_resolve_level(level->next, (struct cil_level*)level->next->data, args);
+	int rc2 = cil_resolve_level(cil_tree_node_next(level), (struct cil_level*)cil_tree_node_next(level)->data, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 }
@@ -1209,11 +1209,11 @@ void test_cil_resolve_level_catlist(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
@@ -1246,21 +1246,21 @@ void test_cil_resolve_level_catset(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC1, &changed, NULL, NULL, NULL);
 
-	struct cil_catset *cs = (struct cil_catset *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_catset *cs = (struct cil_catset *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 
 	args->pass = CIL_PASS_MLS;
 
-	cil_resolve_catset(test_db->ast->root->cl_head->next->next->next, cs, args);
+	cil_resolve_catset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), cs, args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 	
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next;
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))));
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -1291,11 +1291,11 @@ void test_cil_resolve_level_catset_name_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 	
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next;
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))));
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -1323,13 +1323,13 @@ void test_cil_resolve_level_sens_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 
 	args->pass = CIL_PASS_MISC3;
 
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
-	int rc2 = cil_resolve_level(level->next, (struct cil_level*)level->next->data, args);
+	int rc2 = cil_resolve_level(cil_tree_node_next(level), (struct cil_level*)cil_tree_node_next(level)->data, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc2);
 }
@@ -1357,12 +1357,12 @@ void test_cil_resolve_level_cat_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 
 	args->pass = CIL_PASS_MISC3;
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
-	int rc2 = cil_resolve_level(level->next, (struct cil_level*)level->next->data, args);
+	int rc2 = cil_resolve_level(cil_tree_node_next(level), (struct cil_level*)cil_tree_node_next(level)->data, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc2);
 }
@@ -1390,12 +1390,12 @@ void test_cil_resolve_level_senscat_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 
 	args->pass = CIL_PASS_MISC3;
 	int rc = cil_resolve_level(level, (struct cil_level*)level->data, args);
-	int rc2 = cil_resolve_level(level->next, (struct cil_level*)level->next->data, args);
+	int rc2 = cil_resolve_level(cil_tree_node_next(level), (struct cil_level*)cil_tree_node_next(level)->data, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc2);
 }
@@ -1419,13 +1419,13 @@ void test_cil_resolve_levelrange_namedlvl(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))->data;
 
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1448,13 +1448,13 @@ void test_cil_resolve_levelrange_namedlvl_low_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))->data;
 	
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1477,13 +1477,13 @@ void test_cil_resolve_levelrange_namedlvl_high_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))->data;
 	
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1504,13 +1504,13 @@ void test_cil_resolve_levelrange_anonlvl(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1531,13 +1531,13 @@ void test_cil_resolve_levelrange_anonlvl_low_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1558,13 +1558,13 @@ void test_cil_resolve_levelrange_anonlvl_high_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
-	struct cil_levelrange *lvlrange = (struct cil_levelrange *)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_levelrange *lvlrange = (struct cil_levelrange *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_levelrange(test_db->ast->root->cl_head->next->next->next, lvlrange, args);
+	int rc = cil_resolve_levelrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), lvlrange, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1588,7 +1588,7 @@ void test_cil_resolve_constrain(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_constrain(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_constrain(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1611,7 +1611,7 @@ void test_cil_resolve_constrain_class_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_constrain(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_constrain(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1635,7 +1635,7 @@ void test_cil_resolve_constrain_perm_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_constrain(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_constrain(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1657,7 +1657,7 @@ void test_cil_resolve_constrain_perm_resolve_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_constrain(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_constrain(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1684,9 +1684,9 @@ void test_cil_resolve_context(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1714,22 +1714,22 @@ void test_cil_resolve_context_macro(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_CALL1, &changed, NULL, NULL, NULL);
 	
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->cl_head->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data;
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, test_context,  args);
+	int rc = cil_resolve_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), test_context,  args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -1759,22 +1759,22 @@ void test_cil_resolve_context_macro_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->cl_head->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data;
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -1804,9 +1804,9 @@ void test_cil_resolve_context_namedrange(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1834,9 +1834,9 @@ void test_cil_resolve_context_namedrange_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1862,9 +1862,9 @@ void test_cil_resolve_context_user_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1890,9 +1890,9 @@ void test_cil_resolve_context_role_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1918,9 +1918,9 @@ void test_cil_resolve_context_type_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1947,13 +1947,13 @@ void test_cil_resolve_context_anon_level_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_context *test_context = (struct cil_context*)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->data;
+	struct cil_context *test_context = (struct cil_context*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data;
 
-	int rc = cil_resolve_context(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, test_context, args);
+	int rc = cil_resolve_context(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), test_context, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -1975,7 +1975,7 @@ void test_cil_resolve_roletransition(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_roletransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -1996,7 +1996,7 @@ void test_cil_resolve_roletransition_srcdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletransition(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_roletransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2017,7 +2017,7 @@ void test_cil_resolve_roletransition_tgtdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletransition(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_roletransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2038,7 +2038,7 @@ void test_cil_resolve_roletransition_resultdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletransition(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_roletransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2060,8 +2060,8 @@ void test_cil_resolve_typeattributeset_type_in_multiple_attrs(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next->next->next, args);
-	int rc2 = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
+	int rc2 = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 }
@@ -2086,7 +2086,7 @@ void test_cil_resolve_typeattributeset_multiple_excludes_with_not(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2107,7 +2107,7 @@ void test_cil_resolve_typeattributeset_multiple_types_with_and(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2127,7 +2127,7 @@ void test_cil_resolve_typeattributeset_using_attr(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2146,7 +2146,7 @@ void test_cil_resolve_typeattributeset_name_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2165,7 +2165,7 @@ void test_cil_resolve_typeattributeset_undef_type_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2186,7 +2186,7 @@ void test_cil_resolve_typeattributeset_not(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2206,7 +2206,7 @@ void test_cil_resolve_typeattributeset_undef_type_not_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_typeattributeset(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_typeattributeset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2226,7 +2226,7 @@ void test_cil_resolve_typealias(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typealias(test_db->ast->root->cl_head->cl_head, args);
+	int rc = cil_resolve_typealias(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2245,7 +2245,7 @@ void test_cil_resolve_typealias_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typealias(test_db->ast->root->cl_head->cl_head, args);
+	int rc = cil_resolve_typealias(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2265,7 +2265,7 @@ void test_cil_resolve_typebounds(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typebounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_typebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2286,8 +2286,8 @@ void test_cil_resolve_typebounds_repeatbind_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typebounds(test_db->ast->root->cl_head->next->next, args);
-	int rc2 = cil_resolve_typebounds(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_typebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
+	int rc2 = cil_resolve_typebounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc2);
 }
@@ -2307,7 +2307,7 @@ void test_cil_resolve_typebounds_type1_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typebounds(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typebounds(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2326,7 +2326,7 @@ void test_cil_resolve_typebounds_type2_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typebounds(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typebounds(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2345,7 +2345,7 @@ void test_cil_resolve_typepermissive(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typepermissive(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typepermissive(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2364,7 +2364,7 @@ void test_cil_resolve_typepermissive_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_typepermissive(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_typepermissive(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2386,7 +2386,7 @@ void test_cil_resolve_nametypetransition(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nametypetransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_nametypetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2408,7 +2408,7 @@ void test_cil_resolve_nametypetransition_src_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nametypetransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_nametypetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2430,7 +2430,7 @@ void test_cil_resolve_nametypetransition_tgt_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nametypetransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_nametypetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2452,7 +2452,7 @@ void test_cil_resolve_nametypetransition_class_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nametypetransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_nametypetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2474,7 +2474,7 @@ void test_cil_resolve_nametypetransition_dest_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nametypetransition(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_nametypetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2499,7 +2499,7 @@ void test_cil_resolve_rangetransition(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2527,20 +2527,20 @@ void test_cil_resolve_rangetransition_namedrange_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2570,20 +2570,20 @@ void test_cil_resolve_rangetransition_namedrange_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->cl_head,  args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))),  args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2611,7 +2611,7 @@ void test_cil_resolve_rangetransition_namedrange(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2637,7 +2637,7 @@ void test_cil_resolve_rangetransition_namedrange_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2662,7 +2662,7 @@ void test_cil_resolve_rangetransition_type1_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2687,7 +2687,7 @@ void test_cil_resolve_rangetransition_type2_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2712,7 +2712,7 @@ void test_cil_resolve_rangetransition_class_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2739,20 +2739,20 @@ void test_cil_resolve_rangetransition_call_level_l_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2781,20 +2781,20 @@ void test_cil_resolve_rangetransition_call_level_l_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2823,20 +2823,20 @@ void test_cil_resolve_rangetransition_call_level_h_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2865,20 +2865,20 @@ void test_cil_resolve_rangetransition_call_level_h_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))));
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -2905,7 +2905,7 @@ void test_cil_resolve_rangetransition_level_l_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2930,7 +2930,7 @@ void test_cil_resolve_rangetransition_level_h_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -2955,11 +2955,11 @@ void test_cil_resolve_rangetransition_anon_level_l(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -2984,11 +2984,11 @@ void test_cil_resolve_rangetransition_anon_level_l_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3013,11 +3013,11 @@ void test_cil_resolve_rangetransition_anon_level_h(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3042,11 +3042,11 @@ void test_cil_resolve_rangetransition_anon_level_h_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_rangetransition(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_rangetransition(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3066,7 +3066,7 @@ void test_cil_resolve_classcommon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classcommon(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_classcommon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3085,7 +3085,7 @@ void test_cil_resolve_classcommon_no_class_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classcommon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_classcommon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3104,7 +3104,7 @@ void test_cil_resolve_classcommon_no_common_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_classcommon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_classcommon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3125,9 +3125,9 @@ void test_cil_resolve_classpermset_named(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = test_db->ast->root->cl_head->next->next->data;
+	struct cil_classpermset *cps = cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next->next->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), cps, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3149,9 +3149,9 @@ void test_cil_resolve_classpermset_named_namedpermlist(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = test_db->ast->root->cl_head->next->next->data;
+	struct cil_classpermset *cps = cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next->next->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), cps, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3172,9 +3172,9 @@ void test_cil_resolve_classpermset_named_permlist_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = test_db->ast->root->cl_head->next->next->data;
+	struct cil_classpermset *cps = cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next->next->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), cps, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3198,7 +3198,7 @@ void test_cil_resolve_classpermset_named_unnamedcps_neg(CuTest *tc) {
 	struct cil_classpermset *cps;
 	cil_classpermset_init(&cps);
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next->next->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), cps, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -3218,9 +3218,9 @@ void test_cil_resolve_classpermset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = ((struct cil_classmapping*)test_db->ast->root->cl_head->next->data)->classpermsets_str->head->data;
+	struct cil_classpermset *cps = ((struct cil_classmapping*)cil_tree_node_next(cil_tree_node_head(test_db->ast->root))->data)->classpermsets_str->head->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), cps, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3241,9 +3241,9 @@ void test_cil_resolve_classpermset_anon_namedpermlist(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = ((struct cil_classmapping*)test_db->ast->root->cl_head->next->data)->classpermsets_str->head->data;
+	struct cil_classpermset *cps = ((struct cil_classmapping*)cil_tree_node_next(cil_tree_node_head(test_db->ast->root))->data)->classpermsets_str->head->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), cps, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3263,9 +3263,9 @@ void test_cil_resolve_classpermset_anon_permlist_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_classpermset *cps = ((struct cil_classmapping*)test_db->ast->root->cl_head->next->data)->classpermsets_str->head->data;
+	struct cil_classpermset *cps = ((struct cil_classmapping*)cil_tree_node_next(cil_tree_node_head(test_db->ast->root))->data)->classpermsets_str->head->data;
 
-	int rc = cil_resolve_classpermset(test_db->ast->root->cl_head->next, cps, args);
+	int rc = cil_resolve_classpermset(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), cps, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3286,7 +3286,7 @@ void test_cil_resolve_avrule(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3308,7 +3308,7 @@ void test_cil_resolve_avrule_permset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3330,7 +3330,7 @@ void test_cil_resolve_avrule_permset_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3352,7 +3352,7 @@ void test_cil_resolve_avrule_permset_permdne_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3373,7 +3373,7 @@ void test_cil_resolve_avrule_firsttype_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3394,7 +3394,7 @@ void test_cil_resolve_avrule_secondtype_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3415,7 +3415,7 @@ void test_cil_resolve_avrule_class_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3436,7 +3436,7 @@ void test_cil_resolve_avrule_perm_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_avrule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_avrule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3458,7 +3458,7 @@ void test_cil_resolve_type_rule_transition(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3479,7 +3479,7 @@ void test_cil_resolve_type_rule_transition_srcdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3500,7 +3500,7 @@ void test_cil_resolve_type_rule_transition_tgtdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3521,7 +3521,7 @@ void test_cil_resolve_type_rule_transition_objdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3542,7 +3542,7 @@ void test_cil_resolve_type_rule_transition_resultdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3564,7 +3564,7 @@ void test_cil_resolve_type_rule_change(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3585,7 +3585,7 @@ void test_cil_resolve_type_rule_change_srcdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3606,7 +3606,7 @@ void test_cil_resolve_type_rule_change_tgtdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3627,7 +3627,7 @@ void test_cil_resolve_type_rule_change_objdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3648,7 +3648,7 @@ void test_cil_resolve_type_rule_change_resultdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3670,7 +3670,7 @@ void test_cil_resolve_type_rule_member(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3691,7 +3691,7 @@ void test_cil_resolve_type_rule_member_srcdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3712,7 +3712,7 @@ void test_cil_resolve_type_rule_member_tgtdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3733,7 +3733,7 @@ void test_cil_resolve_type_rule_member_objdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3754,7 +3754,7 @@ void test_cil_resolve_type_rule_member_resultdecl_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_type_rule(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_type_rule(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3780,7 +3780,7 @@ void test_cil_resolve_filecon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_filecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_filecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3806,7 +3806,7 @@ void test_cil_resolve_filecon_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_filecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_filecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3831,7 +3831,7 @@ void test_cil_resolve_filecon_anon_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_filecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_filecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3855,7 +3855,7 @@ void test_cil_resolve_filecon_anon_context_neg(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_filecon(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_filecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3881,7 +3881,7 @@ void test_cil_resolve_portcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_portcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_portcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3907,7 +3907,7 @@ void test_cil_resolve_portcon_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_portcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_portcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3932,7 +3932,7 @@ void test_cil_resolve_portcon_anon_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_portcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_portcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -3956,7 +3956,7 @@ void test_cil_resolve_portcon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_portcon(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_portcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -3982,7 +3982,7 @@ void test_cil_resolve_genfscon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_genfscon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_genfscon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4008,7 +4008,7 @@ void test_cil_resolve_genfscon_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_genfscon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_genfscon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4033,7 +4033,7 @@ void test_cil_resolve_genfscon_anon_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_genfscon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_genfscon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4057,7 +4057,7 @@ void test_cil_resolve_genfscon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_genfscon(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_genfscon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4085,7 +4085,7 @@ void test_cil_resolve_nodecon_ipv4(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4113,7 +4113,7 @@ void test_cil_resolve_nodecon_ipv6(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4140,7 +4140,7 @@ void test_cil_resolve_nodecon_anonipaddr_ipv4(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4167,7 +4167,7 @@ void test_cil_resolve_nodecon_anonnetmask_ipv4(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4194,7 +4194,7 @@ void test_cil_resolve_nodecon_anonipaddr_ipv6(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4221,7 +4221,7 @@ void test_cil_resolve_nodecon_anonnetmask_ipv6(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4248,7 +4248,7 @@ void test_cil_resolve_nodecon_diffipfam_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4276,7 +4276,7 @@ void test_cil_resolve_nodecon_context_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4304,7 +4304,7 @@ void test_cil_resolve_nodecon_ipaddr_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4331,7 +4331,7 @@ void test_cil_resolve_nodecon_netmask_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4357,7 +4357,7 @@ void test_cil_resolve_nodecon_anon_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4382,7 +4382,7 @@ void test_cil_resolve_nodecon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_nodecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_nodecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4402,7 +4402,7 @@ void test_cil_resolve_netifcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4421,7 +4421,7 @@ void test_cil_resolve_netifcon_otf_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4440,7 +4440,7 @@ void test_cil_resolve_netifcon_interface_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4467,7 +4467,7 @@ void test_cil_resolve_netifcon_unnamed(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4493,7 +4493,7 @@ void test_cil_resolve_netifcon_unnamed_packet_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4520,7 +4520,7 @@ void test_cil_resolve_netifcon_unnamed_otf_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4539,7 +4539,7 @@ void test_cil_resolve_netifcon_sublist_secondlist_missing_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_netifcon(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_netifcon(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4558,7 +4558,7 @@ void test_cil_resolve_pirqcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pirqcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_pirqcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4577,7 +4577,7 @@ void test_cil_resolve_pirqcon_context_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pirqcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_pirqcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4603,11 +4603,11 @@ void test_cil_resolve_pirqcon_anon_context(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC2, &changed, NULL, NULL, NULL);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_pirqcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_pirqcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4625,7 +4625,7 @@ void test_cil_resolve_pirqcon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pirqcon(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_pirqcon(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4644,7 +4644,7 @@ void test_cil_resolve_iomemcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_iomemcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_iomemcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4663,7 +4663,7 @@ void test_cil_resolve_iomemcon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_iomemcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_iomemcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4689,11 +4689,11 @@ void test_cil_resolve_iomemcon_anon_context(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_iomemcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_iomemcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4711,7 +4711,7 @@ void test_cil_resolve_iomemcon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_iomemcon(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_iomemcon(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4730,7 +4730,7 @@ void test_cil_resolve_ioportcon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_ioportcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_ioportcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4749,7 +4749,7 @@ void test_cil_resolve_ioportcon_context_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_ioportcon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_ioportcon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4775,11 +4775,11 @@ void test_cil_resolve_ioportcon_anon_context(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_ioportcon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_ioportcon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4797,7 +4797,7 @@ void test_cil_resolve_ioportcon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_ioportcon(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_ioportcon(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4816,7 +4816,7 @@ void test_cil_resolve_pcidevicecon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pcidevicecon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_pcidevicecon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4835,7 +4835,7 @@ void test_cil_resolve_pcidevicecon_context_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pcidevicecon(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_pcidevicecon(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4861,11 +4861,11 @@ void test_cil_resolve_pcidevicecon_anon_context(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_pcidevicecon(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_pcidevicecon(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4883,7 +4883,7 @@ void test_cil_resolve_pcidevicecon_anon_context_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_pcidevicecon(test_db->ast->root->cl_head, args);
+	int rc = cil_resolve_pcidevicecon(cil_tree_node_head(test_db->ast->root), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4910,7 +4910,7 @@ void test_cil_resolve_fsuse(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_fsuse(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_fsuse(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -4937,7 +4937,7 @@ void test_cil_resolve_fsuse_nocontext_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_fsuse(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_fsuse(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -4964,7 +4964,7 @@ void test_cil_resolve_fsuse_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_fsuse(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_fsuse(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -4990,7 +4990,7 @@ void test_cil_resolve_fsuse_anon(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_fsuse(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_fsuse(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5016,7 +5016,7 @@ void test_cil_resolve_fsuse_anon_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_fsuse(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_fsuse(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5042,11 +5042,11 @@ void test_cil_resolve_sidcontext(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 	
-	int rc = cil_resolve_sidcontext(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_sidcontext(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5074,14 +5074,14 @@ void test_cil_resolve_sidcontext_named_levels(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_tree_node *level = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	struct cil_tree_node *level = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 	cil_resolve_level(level, (struct cil_level*)level->data, args);
-	cil_resolve_level(level->next, (struct cil_level*)level->next->data, args);
-	int rc = cil_resolve_sidcontext(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	cil_resolve_level(cil_tree_node_next(level), (struct cil_level*)cil_tree_node_next(level)->data, args);
+	int rc = cil_resolve_sidcontext(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5108,14 +5108,14 @@ void test_cil_resolve_sidcontext_named_context(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_tree_node *context = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	struct cil_tree_node *context = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 	cil_resolve_context(context, (struct cil_context*)context->data, args);
 
-	int rc = cil_resolve_sidcontext(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_sidcontext(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5142,14 +5142,14 @@ void test_cil_resolve_sidcontext_named_context_wrongname_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	struct cil_tree_node *context = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	struct cil_tree_node *context = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 	cil_resolve_context(context, (struct cil_context*)context->data, args);
 	
-	int rc = cil_resolve_sidcontext(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_sidcontext(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5175,9 +5175,9 @@ void test_cil_resolve_sidcontext_named_context_invaliduser_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+        cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
-        int rc = cil_resolve_sidcontext(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+        int rc = cil_resolve_sidcontext(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5197,7 +5197,7 @@ void test_cil_resolve_blockinherit(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_blockinherit(test_db->ast->root->cl_head->next->cl_head->next, args);
+	int rc = cil_resolve_blockinherit(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5217,7 +5217,7 @@ void test_cil_resolve_blockinherit_blockstrdne_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_blockinherit(test_db->ast->root->cl_head->next->cl_head->next, args);
+	int rc = cil_resolve_blockinherit(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5237,7 +5237,7 @@ void test_cil_resolve_in_block(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_in(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_in(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5256,7 +5256,7 @@ void test_cil_resolve_in_blockstrdne_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_in(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_in(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5277,7 +5277,7 @@ void test_cil_resolve_in_macro(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_in(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_in(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5297,7 +5297,7 @@ void test_cil_resolve_in_optional(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_in(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_in(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5320,7 +5320,7 @@ void test_cil_resolve_call1_noparam(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5343,7 +5343,7 @@ void test_cil_resolve_call1_type(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5366,7 +5366,7 @@ void test_cil_resolve_call1_role(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5389,7 +5389,7 @@ void test_cil_resolve_call1_user(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5412,7 +5412,7 @@ void test_cil_resolve_call1_sens(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5435,7 +5435,7 @@ void test_cil_resolve_call1_cat(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5459,7 +5459,7 @@ void test_cil_resolve_call1_catset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5482,7 +5482,7 @@ void test_cil_resolve_call1_catset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5505,7 +5505,7 @@ void test_cil_resolve_call1_catset_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5532,7 +5532,7 @@ void test_cil_resolve_call1_level(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5559,7 +5559,7 @@ void test_cil_resolve_call1_level_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5586,7 +5586,7 @@ void test_cil_resolve_call1_level_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5616,7 +5616,7 @@ void test_cil_resolve_call1_ipaddr(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5645,7 +5645,7 @@ void test_cil_resolve_call1_ipaddr_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5674,7 +5674,7 @@ void test_cil_resolve_call1_ipaddr_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5697,7 +5697,7 @@ void test_cil_resolve_call1_class(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5718,7 +5718,7 @@ void test_cil_resolve_call1_classmap(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5742,7 +5742,7 @@ void test_cil_resolve_call1_permset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5765,7 +5765,7 @@ void test_cil_resolve_call1_permset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5788,7 +5788,7 @@ void test_cil_resolve_call1_classpermset_named(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5810,7 +5810,7 @@ void test_cil_resolve_call1_classpermset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5832,7 +5832,7 @@ void test_cil_resolve_call1_classpermset_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5856,14 +5856,14 @@ void test_cil_resolve_call1_unknown_neg(CuTest *tc) {
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
 	struct cil_tree_node *macro_node = NULL;
-	cil_resolve_name(test_db->ast->root->cl_head->next->next->next, ((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data)->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
-	((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data)->macro = (struct cil_macro*)macro_node->data;
-	free(((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data)->macro_str);
-	((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data)->macro_str = NULL;
+	cil_resolve_name(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), ((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data)->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
+	((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data)->macro = (struct cil_macro*)macro_node->data;
+	free(((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data)->macro_str);
+	((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data)->macro_str = NULL;
 
-	((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data)->macro->params->head->flavor = CIL_NETIFCON;
+	((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data)->macro->params->head->flavor = CIL_NETIFCON;
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5886,7 +5886,7 @@ void test_cil_resolve_call1_unknowncall_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -5909,7 +5909,7 @@ void test_cil_resolve_call1_extraargs_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5932,7 +5932,7 @@ void test_cil_resolve_call1_copy_dup(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -5959,7 +5959,7 @@ void test_cil_resolve_call1_missing_arg_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -5984,13 +5984,13 @@ void test_cil_resolve_call1_paramsflavor_neg(CuTest *tc) {
 
 	struct cil_tree_node *macro_node = NULL;
 
-	struct cil_call *new_call = ((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data);
-	cil_resolve_name(test_db->ast->root->cl_head->next->next->next, new_call->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
+	struct cil_call *new_call = ((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data);
+	cil_resolve_name(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), new_call->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
 	new_call->macro = (struct cil_macro*)macro_node->data;
 	struct cil_list_item *item = new_call->macro->params->head;
 	item->flavor = CIL_CONTEXT;
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6015,13 +6015,13 @@ void test_cil_resolve_call1_unknownflavor_neg(CuTest *tc) {
 
 	struct cil_tree_node *macro_node = NULL;
 
-	struct cil_call *new_call = ((struct cil_call*)test_db->ast->root->cl_head->next->next->next->data);
-	cil_resolve_name(test_db->ast->root->cl_head->next->next->next, new_call->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
+	struct cil_call *new_call = ((struct cil_call*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data);
+	cil_resolve_name(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), new_call->macro_str, CIL_SYM_BLOCKS, args, &macro_node);
 	new_call->macro = (struct cil_macro*)macro_node->data;
 	struct cil_list_item *item = new_call->macro->params->head;
 	((struct cil_param*)item->data)->flavor = CIL_CONTEXT;
 
-	int rc = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6044,11 +6044,11 @@ void test_cil_resolve_call2_type(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6071,11 +6071,11 @@ void test_cil_resolve_call2_role(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6098,11 +6098,11 @@ void test_cil_resolve_call2_user(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6125,11 +6125,11 @@ void test_cil_resolve_call2_sens(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6152,11 +6152,11 @@ void test_cil_resolve_call2_cat(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6180,11 +6180,11 @@ void test_cil_resolve_call2_catset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6207,11 +6207,11 @@ void test_cil_resolve_call2_catset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6235,11 +6235,11 @@ void test_cil_resolve_call2_permset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6262,11 +6262,11 @@ void test_cil_resolve_call2_permset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6289,11 +6289,11 @@ void test_cil_resolve_call2_classpermset_named(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6315,11 +6315,11 @@ void test_cil_resolve_call2_classpermset_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6342,11 +6342,11 @@ void test_cil_resolve_call2_class(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6368,11 +6368,11 @@ void test_cil_resolve_call2_classmap(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 }
@@ -6400,11 +6400,11 @@ void test_cil_resolve_call2_level(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6431,11 +6431,11 @@ void test_cil_resolve_call2_level_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6465,11 +6465,11 @@ void test_cil_resolve_call2_ipaddr(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6498,11 +6498,11 @@ void test_cil_resolve_call2_ipaddr_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6529,12 +6529,12 @@ void test_cil_resolve_call2_unknown_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
-	((struct cil_args*)((struct cil_list_item *)((struct cil_call *)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->data)->args->head)->data)->flavor = CIL_SYM_UNKNOWN;
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
+	((struct cil_args*)((struct cil_list_item *)((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data)->args->head)->data)->flavor = CIL_SYM_UNKNOWN;
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6557,11 +6557,11 @@ void test_cil_resolve_call2_name_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6587,12 +6587,12 @@ void test_cil_resolve_name_call_args(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->data, "a", CIL_SYM_TYPES, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, "a", CIL_SYM_TYPES, &test_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6622,12 +6622,12 @@ void test_cil_resolve_name_call_args_multipleparams(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->data, "lvl_h", CIL_SYM_LEVELS, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))->data, "lvl_h", CIL_SYM_LEVELS, &test_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6652,12 +6652,12 @@ void test_cil_resolve_name_call_args_diffflavor(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->data, "qaz", CIL_LEVEL, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, "qaz", CIL_LEVEL, &test_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6683,11 +6683,11 @@ void test_cil_resolve_name_call_args_callnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_resolve_name_call_args(NULL, "qaz", CIL_LEVEL, &test_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -6714,12 +6714,12 @@ void test_cil_resolve_name_call_args_namenull_neg(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->data, NULL, CIL_LEVEL, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, NULL, CIL_LEVEL, &test_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6745,12 +6745,12 @@ void test_cil_resolve_name_call_args_callargsnull_neg(CuTest *tc) {
 	struct cil_tree_node *test_node;
 	cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->data, "qas", CIL_LEVEL, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, "qas", CIL_LEVEL, &test_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6776,12 +6776,12 @@ void test_cil_resolve_name_call_args_name_neg(CuTest *tc) {
 	struct cil_tree_node *test_node = NULL;
 	//cil_tree_node_init(&test_node);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	cil_resolve_call2(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_name_call_args((struct cil_call *)test_db->ast->root->cl_head->next->next->next->data, "qas", CIL_TYPE, &test_node);
+	cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_name_call_args((struct cil_call *)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data, "qas", CIL_TYPE, &test_node);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6803,9 +6803,9 @@ void test_cil_resolve_expr_stack_bools(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_booleanif *bif = (struct cil_booleanif*)test_db->ast->root->cl_head->next->next->next->data; 
+	struct cil_booleanif *bif = (struct cil_booleanif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data; 
 
-	int rc = cil_resolve_expr_stack(bif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_expr_stack(bif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6828,9 +6828,9 @@ void test_cil_resolve_expr_stack_tunables(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data; 
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data; 
 
-	int rc = cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6852,9 +6852,9 @@ void test_cil_resolve_expr_stack_type(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_constrain *cons = (struct cil_constrain*)test_db->ast->root->cl_head->next->next->next->next->data; 
+	struct cil_constrain *cons = (struct cil_constrain*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data; 
 
-	int rc = cil_resolve_expr_stack(cons->expr, test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_expr_stack(cons->expr, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6876,9 +6876,9 @@ void test_cil_resolve_expr_stack_role(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_constrain *cons = (struct cil_constrain*)test_db->ast->root->cl_head->next->next->next->next->data; 
+	struct cil_constrain *cons = (struct cil_constrain*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data; 
 
-	int rc = cil_resolve_expr_stack(cons->expr, test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_expr_stack(cons->expr, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6900,9 +6900,9 @@ void test_cil_resolve_expr_stack_user(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_constrain *cons = (struct cil_constrain*)test_db->ast->root->cl_head->next->next->next->next->data; 
+	struct cil_constrain *cons = (struct cil_constrain*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data; 
 
-	int rc = cil_resolve_expr_stack(cons->expr, test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_expr_stack(cons->expr, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6925,9 +6925,9 @@ void test_cil_resolve_expr_stack_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_booleanif *bif = (struct cil_booleanif*)test_db->ast->root->cl_head->next->next->next->data; 
+	struct cil_booleanif *bif = (struct cil_booleanif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data; 
 
-	int rc = cil_resolve_expr_stack(bif->expr_stack,test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_expr_stack(bif->expr_stack,cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -6950,10 +6950,10 @@ void test_cil_resolve_expr_stack_emptystr_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	struct cil_booleanif *bif = (struct cil_booleanif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_booleanif *bif = (struct cil_booleanif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 	((struct cil_conditional*)bif->expr_stack->head->data)->str = NULL;
 
-	int rc = cil_resolve_expr_stack(bif->expr_stack,test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_expr_stack(bif->expr_stack,cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -6976,7 +6976,7 @@ void test_cil_resolve_boolif(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = cil_resolve_boolif(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_boolif(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -6999,7 +6999,7 @@ void test_cil_resolve_boolif_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = cil_resolve_boolif(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_boolif(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7023,9 +7023,9 @@ void test_cil_evaluate_expr_stack_and(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7050,9 +7050,9 @@ void test_cil_evaluate_expr_stack_not(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7077,9 +7077,9 @@ void test_cil_evaluate_expr_stack_or(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7104,9 +7104,9 @@ void test_cil_evaluate_expr_stack_xor(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7131,9 +7131,9 @@ void test_cil_evaluate_expr_stack_eq(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7158,9 +7158,9 @@ void test_cil_evaluate_expr_stack_neq(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7186,9 +7186,9 @@ void test_cil_evaluate_expr_stack_oper1(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7214,9 +7214,9 @@ void test_cil_evaluate_expr_stack_oper2(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	struct cil_tunableif *tif = (struct cil_tunableif*)test_db->ast->root->cl_head->next->next->next->next->data;
+	struct cil_tunableif *tif = (struct cil_tunableif*)cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))->data;
 
-	cil_resolve_expr_stack(tif->expr_stack, test_db->ast->root->cl_head->next->next->next->next, args);
+	cil_resolve_expr_stack(tif->expr_stack, cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	int rc = cil_evaluate_expr_stack(tif->expr_stack, &result);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -7278,7 +7278,7 @@ void test_cil_resolve_tunif_false(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = cil_resolve_tunif(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_tunif(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7301,7 +7301,7 @@ void test_cil_resolve_tunif_true(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = cil_resolve_tunif(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_tunif(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7324,7 +7324,7 @@ void test_cil_resolve_tunif_resolveexpr_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = cil_resolve_tunif(test_db->ast->root->cl_head->next->next->next, args);
+	int rc = cil_resolve_tunif(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 /*
@@ -7379,7 +7379,7 @@ void test_cil_resolve_userbounds(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_userbounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_userbounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7399,8 +7399,8 @@ void test_cil_resolve_userbounds_exists_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_userbounds(test_db->ast->root->cl_head->next->next, args);
-	int rc = cil_resolve_userbounds(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_userbounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
+	int rc = cil_resolve_userbounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -7420,7 +7420,7 @@ void test_cil_resolve_userbounds_user1_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_userbounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_userbounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7440,7 +7440,7 @@ void test_cil_resolve_userbounds_user2_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_userbounds(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_userbounds(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7460,7 +7460,7 @@ void test_cil_resolve_roletype(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletype(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_roletype(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7479,7 +7479,7 @@ void test_cil_resolve_roletype_type_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletype(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_roletype(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7498,7 +7498,7 @@ void test_cil_resolve_roletype_role_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_roletype(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_roletype(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7518,7 +7518,7 @@ void test_cil_resolve_userrole(CuTest *tc) {
 	uint32_t changed = CIL_FALSE;
 	struct cil_args_resolve *args = gen_resolve_args(test_db, CIL_PASS_MISC3, &changed, NULL, NULL, NULL);
 
-	int rc = cil_resolve_userrole(test_db->ast->root->cl_head->next->next, args);
+	int rc = cil_resolve_userrole(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7537,7 +7537,7 @@ void test_cil_resolve_userrole_user_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_userrole(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_userrole(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7556,7 +7556,7 @@ void test_cil_resolve_userrole_role_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = cil_resolve_userrole(test_db->ast->root->cl_head->next, args);
+	int rc = cil_resolve_userrole(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7579,11 +7579,11 @@ void test_cil_resolve_userlevel(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7610,20 +7610,20 @@ void test_cil_resolve_userlevel_macro(CuTest *tc) {
 
 	args->pass = CIL_PASS_CALL1;
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))));
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -7649,20 +7649,20 @@ void test_cil_resolve_userlevel_macro_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))));
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -7686,11 +7686,11 @@ void test_cil_resolve_userlevel_level_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7712,11 +7712,11 @@ void test_cil_resolve_userlevel_level_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7739,11 +7739,11 @@ void test_cil_resolve_userlevel_user_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7766,11 +7766,11 @@ void test_cil_resolve_userlevel_level_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userlevel(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_userlevel(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7793,8 +7793,8 @@ void test_cil_resolve_userrange(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
+	int rc = cil_resolve_userrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7820,20 +7820,20 @@ void test_cil_resolve_userrange_macro(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_userrange(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -7861,20 +7861,20 @@ void test_cil_resolve_userrange_macro_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc2 = cil_resolve_call1(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc2 = cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc3 = cil_resolve_call2(test_db->ast->root->cl_head->next->next->next->next->next->next->next, args);
+	int rc3 = cil_resolve_call2(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), args);
 
 	args->pass = CIL_PASS_MISC2;
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
-	args->callstack = test_db->ast->root->cl_head->next->next->next->next->next->next->next;
+	args->callstack = cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))));
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next->next->next->cl_head, args);
+	int rc = cil_resolve_userrange(cil_tree_node_head(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, SEPOL_OK, rc2);
 	CuAssertIntEquals(tc, SEPOL_OK, rc3);
@@ -7900,11 +7900,11 @@ void test_cil_resolve_userrange_range_anon(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_userrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -7928,11 +7928,11 @@ void test_cil_resolve_userrange_range_anon_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next->next, args);
+	int rc = cil_resolve_userrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7955,11 +7955,11 @@ void test_cil_resolve_userrange_user_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_userrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -7982,11 +7982,11 @@ void test_cil_resolve_userrange_range_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_senscat(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_senscat(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = cil_resolve_userrange(test_db->ast->root->cl_head->next->next->next->next->next, args);
+	int rc = cil_resolve_userrange(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -8003,7 +8003,7 @@ void test_cil_disable_children_helper_optional_enabled(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8020,9 +8020,9 @@ void test_cil_disable_children_helper_optional_disabled(CuTest *tc) {
 
 	uint32_t finished = 0;
 
-	((struct cil_optional *)test_db->ast->root->cl_head->data)->datum.state = CIL_STATE_DISABLED;
+	((struct cil_optional *)cil_tree_node_head(test_db->ast->root)->data)->datum.state = CIL_STATE_DISABLED;
 	
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8039,7 +8039,7 @@ void test_cil_disable_children_helper_block(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8056,7 +8056,7 @@ void test_cil_disable_children_helper_user(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8073,7 +8073,7 @@ void test_cil_disable_children_helper_role(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8090,7 +8090,7 @@ void test_cil_disable_children_helper_type(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8107,7 +8107,7 @@ void test_cil_disable_children_helper_typealias(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8124,7 +8124,7 @@ void test_cil_disable_children_helper_common(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8141,7 +8141,7 @@ void test_cil_disable_children_helper_class(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8158,7 +8158,7 @@ void test_cil_disable_children_helper_bool(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8175,7 +8175,7 @@ void test_cil_disable_children_helper_sens(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8192,7 +8192,7 @@ void test_cil_disable_children_helper_cat(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8209,7 +8209,7 @@ void test_cil_disable_children_helper_catset(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8226,7 +8226,7 @@ void test_cil_disable_children_helper_sid(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8245,7 +8245,7 @@ void test_cil_disable_children_helper_macro(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8263,7 +8263,7 @@ void test_cil_disable_children_helper_context(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8280,7 +8280,7 @@ void test_cil_disable_children_helper_level(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8297,7 +8297,7 @@ void test_cil_disable_children_helper_policycap(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8314,7 +8314,7 @@ void test_cil_disable_children_helper_perm(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8331,7 +8331,7 @@ void test_cil_disable_children_helper_catalias(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8348,7 +8348,7 @@ void test_cil_disable_children_helper_sensalias(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8365,7 +8365,7 @@ void test_cil_disable_children_helper_tunable(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8382,7 +8382,7 @@ void test_cil_disable_children_helper_unknown(CuTest *tc) {
 	
 	uint32_t finished = 0;
 
-	int rc = __cil_disable_children_helper(test_db->ast->root->cl_head, &finished, NULL);
+	int rc = __cil_disable_children_helper(cil_tree_node_head(test_db->ast->root), &finished, NULL);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -8412,7 +8412,7 @@ void test_cil_resolve_ast_node_helper_call1(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8438,7 +8438,7 @@ void test_cil_resolve_ast_node_helper_call1_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8464,11 +8464,11 @@ void test_cil_resolve_ast_node_helper_call2(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8493,11 +8493,11 @@ void test_cil_resolve_ast_node_helper_call2_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
 
@@ -8521,7 +8521,7 @@ void test_cil_resolve_ast_node_helper_boolif(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8546,7 +8546,7 @@ void test_cil_resolve_ast_node_helper_boolif_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8571,7 +8571,7 @@ void test_cil_resolve_ast_node_helper_tunif(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8597,7 +8597,7 @@ void test_cil_resolve_ast_node_helper_tunif_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8620,7 +8620,7 @@ void test_cil_resolve_ast_node_helper_catorder(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8643,7 +8643,7 @@ void test_cil_resolve_ast_node_helper_catorder_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8666,7 +8666,7 @@ void test_cil_resolve_ast_node_helper_dominance(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8689,7 +8689,7 @@ void test_cil_resolve_ast_node_helper_dominance_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8712,7 +8712,7 @@ void test_cil_resolve_ast_node_helper_roleallow(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);	
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);	
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8734,7 +8734,7 @@ void test_cil_resolve_ast_node_helper_roleallow_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8756,7 +8756,7 @@ void test_cil_resolve_ast_node_helper_sensalias(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8777,7 +8777,7 @@ void test_cil_resolve_ast_node_helper_sensalias_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8799,7 +8799,7 @@ void test_cil_resolve_ast_node_helper_catalias(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8819,7 +8819,7 @@ void test_cil_resolve_ast_node_helper_catalias_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8843,7 +8843,7 @@ void test_cil_resolve_ast_node_helper_catset(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8866,7 +8866,7 @@ void test_cil_resolve_ast_node_helper_catset_catlist_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8890,12 +8890,12 @@ void test_cil_resolve_ast_node_helper_catrange(CuTest *tc) {
 	uint32_t finished = 0;
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
-	cil_resolve_catorder(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_catorder(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 	__cil_verify_order(test_db->catorder, test_db->ast->root, CIL_CAT);
 
 	args->pass = CIL_PASS_MLS;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8919,7 +8919,7 @@ void test_cil_resolve_ast_node_helper_catrange_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -8955,7 +8955,7 @@ void test_cil_resolve_ast_node_helper_level(CuTest *tc) {
 	cil_tree_walk(test_db->ast->root, __cil_resolve_ast_node_helper, NULL, NULL, args);
 
 	args->pass = CIL_PASS_MISC3;
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -8989,7 +8989,7 @@ void test_cil_resolve_ast_node_helper_level_neg(CuTest *tc) {
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -9028,7 +9028,7 @@ void test_cil_resolve_ast_node_helper_levelrange(CuTest *tc) {
 	cil_tree_walk(test_db->ast->root, __cil_resolve_ast_node_helper, NULL, NULL, args);
 
 	args->pass = CIL_PASS_MISC3;
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -9064,7 +9064,7 @@ void test_cil_resolve_ast_node_helper_levelrange_neg(CuTest *tc) {
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -9091,7 +9091,7 @@ void test_cil_resolve_ast_node_helper_constrain(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9118,7 +9118,7 @@ void test_cil_resolve_ast_node_helper_constrain_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9145,7 +9145,7 @@ void test_cil_resolve_ast_node_helper_mlsconstrain(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9172,7 +9172,7 @@ void test_cil_resolve_ast_node_helper_mlsconstrain_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9212,7 +9212,7 @@ void test_cil_resolve_ast_node_helper_context(CuTest *tc) {
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -9252,7 +9252,7 @@ void test_cil_resolve_ast_node_helper_context_neg(CuTest *tc) {
 
 	args->pass = CIL_PASS_MISC3;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, finished, 0);
 }
@@ -9279,7 +9279,7 @@ void test_cil_resolve_ast_node_helper_senscat(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9306,7 +9306,7 @@ void test_cil_resolve_ast_node_helper_senscat_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9331,7 +9331,7 @@ void test_cil_resolve_ast_node_helper_roletransition(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9355,7 +9355,7 @@ void test_cil_resolve_ast_node_helper_roletransition_srcdecl_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9379,7 +9379,7 @@ void test_cil_resolve_ast_node_helper_roletransition_tgtdecl_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9403,7 +9403,7 @@ void test_cil_resolve_ast_node_helper_roletransition_resultdecl_neg(CuTest *tc)
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9427,7 +9427,7 @@ void test_cil_resolve_ast_node_helper_typeattributeset(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9450,7 +9450,7 @@ void test_cil_resolve_ast_node_helper_typeattributeset_undef_type_neg(CuTest *tc
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9473,7 +9473,7 @@ void test_cil_resolve_ast_node_helper_typealias(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9495,7 +9495,7 @@ void test_cil_resolve_ast_node_helper_typealias_notype_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9518,7 +9518,7 @@ void test_cil_resolve_ast_node_helper_typebounds(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9540,7 +9540,7 @@ void test_cil_resolve_ast_node_helper_typebounds_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9561,7 +9561,7 @@ void test_cil_resolve_ast_node_helper_typepermissive(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9583,7 +9583,7 @@ void test_cil_resolve_ast_node_helper_typepermissive_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9611,7 +9611,7 @@ void test_cil_resolve_ast_node_helper_rangetransition(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9639,7 +9639,7 @@ void test_cil_resolve_ast_node_helper_rangetransition_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9664,7 +9664,7 @@ void test_cil_resolve_ast_node_helper_nametypetransition(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9689,7 +9689,7 @@ void test_cil_resolve_ast_node_helper_nametypetransition_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9713,7 +9713,7 @@ void test_cil_resolve_ast_node_helper_avrule(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9734,7 +9734,7 @@ void test_cil_resolve_ast_node_helper_avrule_src_nores_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9756,7 +9756,7 @@ void test_cil_resolve_ast_node_helper_avrule_tgt_nores_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9779,7 +9779,7 @@ void test_cil_resolve_ast_node_helper_avrule_class_nores_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9802,7 +9802,7 @@ void test_cil_resolve_ast_node_helper_avrule_datum_null_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9827,7 +9827,7 @@ void test_cil_resolve_ast_node_helper_type_rule_transition(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9851,7 +9851,7 @@ void test_cil_resolve_ast_node_helper_type_rule_transition_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9876,7 +9876,7 @@ void test_cil_resolve_ast_node_helper_type_rule_change(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9900,7 +9900,7 @@ void test_cil_resolve_ast_node_helper_type_rule_change_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9925,7 +9925,7 @@ void test_cil_resolve_ast_node_helper_type_rule_member(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9949,7 +9949,7 @@ void test_cil_resolve_ast_node_helper_type_rule_member_neg(CuTest *tc) {
 	
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -9975,7 +9975,7 @@ void test_cil_resolve_ast_node_helper_userbounds(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10000,7 +10000,7 @@ void test_cil_resolve_ast_node_helper_userbounds_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10026,7 +10026,7 @@ void test_cil_resolve_ast_node_helper_roletype(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10051,7 +10051,7 @@ void test_cil_resolve_ast_node_helper_roletype_role_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10076,7 +10076,7 @@ void test_cil_resolve_ast_node_helper_roletype_type_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10102,7 +10102,7 @@ void test_cil_resolve_ast_node_helper_userrole(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10127,7 +10127,7 @@ void test_cil_resolve_ast_node_helper_userrole_user_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10152,7 +10152,7 @@ void test_cil_resolve_ast_node_helper_userrole_role_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10181,7 +10181,7 @@ void test_cil_resolve_ast_node_helper_userlevel(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10210,7 +10210,7 @@ void test_cil_resolve_ast_node_helper_userlevel_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10239,7 +10239,7 @@ void test_cil_resolve_ast_node_helper_userrange(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10268,7 +10268,7 @@ void test_cil_resolve_ast_node_helper_userrange_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -10297,7 +10297,7 @@ void test_cil_resolve_ast_node_helper_filecon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10326,7 +10326,7 @@ void test_cil_resolve_ast_node_helper_filecon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10355,7 +10355,7 @@ void test_cil_resolve_ast_node_helper_portcon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10384,7 +10384,7 @@ void test_cil_resolve_ast_node_helper_portcon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10413,7 +10413,7 @@ void test_cil_resolve_ast_node_helper_genfscon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10442,7 +10442,7 @@ void test_cil_resolve_ast_node_helper_genfscon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10472,7 +10472,7 @@ void test_cil_resolve_ast_node_helper_nodecon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10503,7 +10503,7 @@ void test_cil_resolve_ast_node_helper_nodecon_ipaddr_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10534,7 +10534,7 @@ void test_cil_resolve_ast_node_helper_nodecon_netmask_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10557,7 +10557,7 @@ void test_cil_resolve_ast_node_helper_netifcon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10579,7 +10579,7 @@ void test_cil_resolve_ast_node_helper_netifcon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10601,7 +10601,7 @@ void test_cil_resolve_ast_node_helper_pirqcon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10623,7 +10623,7 @@ void test_cil_resolve_ast_node_helper_pirqcon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10645,7 +10645,7 @@ void test_cil_resolve_ast_node_helper_iomemcon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10667,7 +10667,7 @@ void test_cil_resolve_ast_node_helper_iomemcon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10689,7 +10689,7 @@ void test_cil_resolve_ast_node_helper_ioportcon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10711,7 +10711,7 @@ void test_cil_resolve_ast_node_helper_ioportcon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10733,7 +10733,7 @@ void test_cil_resolve_ast_node_helper_pcidevicecon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10755,7 +10755,7 @@ void test_cil_resolve_ast_node_helper_pcidevicecon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10785,7 +10785,7 @@ void test_cil_resolve_ast_node_helper_fsuse(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10807,7 +10807,7 @@ void test_cil_resolve_ast_node_helper_fsuse_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10837,7 +10837,7 @@ void test_cil_resolve_ast_node_helper_sidcontext(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10865,7 +10865,7 @@ void test_cil_resolve_ast_node_helper_sidcontext_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next->next->next->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))))))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10888,7 +10888,7 @@ void test_cil_resolve_ast_node_helper_blockinherit(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10911,7 +10911,7 @@ void test_cil_resolve_ast_node_helper_classcommon(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10933,7 +10933,7 @@ void test_cil_resolve_ast_node_helper_classcommon_neg(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
@@ -10959,7 +10959,7 @@ void test_cil_resolve_ast_node_helper_rolebounds(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
@@ -10984,7 +10984,7 @@ void test_cil_resolve_ast_node_helper_rolebounds_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
 }
@@ -11013,8 +11013,8 @@ void test_cil_resolve_ast_node_helper_callstack(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	__cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	__cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11041,7 +11041,7 @@ void test_cil_resolve_ast_node_helper_call(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11069,9 +11069,9 @@ void test_cil_resolve_ast_node_helper_optional(CuTest *tc) {
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
 	// set optional to disabled
-	((struct cil_symtab_datum *)test_db->ast->root->cl_head->data)->state = CIL_STATE_DISABLED;
+	((struct cil_symtab_datum *)cil_tree_node_head(test_db->ast->root)->data)->state = CIL_STATE_DISABLED;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11096,7 +11096,7 @@ void test_cil_resolve_ast_node_helper_macro(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11126,8 +11126,8 @@ void test_cil_resolve_ast_node_helper_optstack(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	__cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next->next, &finished, args);
+	__cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
 
@@ -11151,7 +11151,7 @@ void test_cil_resolve_ast_node_helper_optstack_tunable_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_head(test_db->ast->root), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11180,11 +11180,11 @@ void test_cil_resolve_ast_node_helper_optstack_macro_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-	cil_resolve_call1(test_db->ast->root->cl_head->next->next, args);
+	cil_resolve_call1(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), args);
 
 	args->pass = CIL_PASS_CALL2;
 
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 	CuAssertIntEquals(tc, 0, finished);
 }
@@ -11232,7 +11232,7 @@ void test_cil_resolve_ast_node_helper_extraargsnull_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, NULL);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, NULL);
 	CuAssertIntEquals(tc, 0, finished);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
@@ -11258,7 +11258,7 @@ void test_cil_resolve_ast_node_helper_dbflavor_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11283,7 +11283,7 @@ void test_cil_resolve_ast_node_helper_pass_neg(CuTest *tc) {
 
 	cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 	
-	int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next->next, &finished, args);
+	int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_next(cil_tree_node_head(test_db->ast->root))), &finished, args);
 	CuAssertIntEquals(tc, SEPOL_ERR, rc);
 }
 
@@ -11312,7 +11312,7 @@ void test_cil_resolve_ast_node_helper_optfailedtoresolve(CuTest *tc) {
 
         cil_build_ast(test_db, test_tree->root, test_db->ast->root);
 
-        int rc = __cil_resolve_ast_node_helper(test_db->ast->root->cl_head->next, &finished, args);
+        int rc = __cil_resolve_ast_node_helper(cil_tree_node_next(cil_tree_node_head(test_db->ast->root)), &finished, args);
         CuAssertIntEquals(tc, SEPOL_OK, rc);
         CuAssertIntEquals(tc, 0, finished);
 }
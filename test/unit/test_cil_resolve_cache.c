@@ -0,0 +1,129 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+
+#include "CuTest.h"
+#include "test_cil_resolve_cache.h"
+
+#include "../../src/cil_resolve_cache.h"
+
+void test_cil_resolve_cache_insert(CuTest *tc) {
+	struct cil_resolve_cache *cache;
+	struct cil_tree_node scope_a, scope_b;
+	struct cil_symtab_datum datum_a, datum_b;
+	char *name = "t";
+
+	cil_resolve_cache_init(&cache);
+
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope_a, name, 0));
+	cil_resolve_cache_insert(cache, &scope_a, name, 0, &datum_a);
+	cil_resolve_cache_insert(cache, &scope_b, name, 0, &datum_b);
+
+	CuAssertPtrEquals(tc, &datum_a, cil_resolve_cache_lookup(cache, &scope_a, name, 0));
+	CuAssertPtrEquals(tc, &datum_b, cil_resolve_cache_lookup(cache, &scope_b, name, 0));
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope_a, name, 1));
+	CuAssertIntEquals(tc, 2, cache->hits);
+	CuAssertIntEquals(tc, 2, cache->misses);
+
+	cil_resolve_cache_destroy(&cache);
+	CuAssertPtrEquals(tc, NULL, cache);
+}
+
+void test_cil_resolve_cache_grow(CuTest *tc) {
+	struct cil_resolve_cache *cache;
+	struct cil_tree_node scopes[5000];
+	struct cil_symtab_datum datums[5000];
+	char *name = "t";
+	uint32_t i;
+
+	cil_resolve_cache_init(&cache);
+
+	for (i = 0; i < 5000; i++) {
+		cil_resolve_cache_insert(cache, &scopes[i], name, 0, &datums[i]);
+	}
+	CuAssertIntEquals(tc, 5000, cache->count);
+
+	for (i = 0; i < 5000; i++) {
+		CuAssertPtrEquals(tc, &datums[i], cil_resolve_cache_lookup(cache, &scopes[i], name, 0));
+	}
+
+	cil_resolve_cache_destroy(&cache);
+}
+
+void test_cil_resolve_cache_flush(CuTest *tc) {
+	struct cil_resolve_cache *cache;
+	struct cil_tree_node scope;
+	struct cil_symtab_datum datum_a, datum_b;
+	char *name = "t";
+
+	cil_resolve_cache_init(&cache);
+
+	cil_resolve_cache_insert(cache, &scope, name, 0, &datum_a);
+	cil_resolve_cache_flush(cache);
+	CuAssertIntEquals(tc, 0, cache->count);
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope, name, 0));
+
+	cil_resolve_cache_insert(cache, &scope, name, 0, &datum_b);
+	CuAssertPtrEquals(tc, &datum_b, cil_resolve_cache_lookup(cache, &scope, name, 0));
+
+	cil_resolve_cache_release(cache);
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope, name, 0));
+	CuAssertIntEquals(tc, 1, cache->hits);
+
+	cil_resolve_cache_destroy(&cache);
+}
+
+void test_cil_resolve_cache_invalidate(CuTest *tc) {
+	struct cil_resolve_cache *cache;
+	struct cil_tree_node scope_a, scope_b;
+	struct cil_symtab_datum datum_a, datum_b, datum_c;
+	char *name = "t";
+	char *other = "u";
+
+	cil_resolve_cache_init(&cache);
+
+	cil_resolve_cache_insert(cache, &scope_a, name, 0, &datum_a);
+	cil_resolve_cache_insert(cache, &scope_b, name, 1, &datum_b);
+	cil_resolve_cache_insert(cache, &scope_b, other, 0, &datum_c);
+	cil_resolve_cache_invalidate(cache, name, 0);
+
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope_a, name, 0));
+	CuAssertPtrEquals(tc, &datum_b, cil_resolve_cache_lookup(cache, &scope_b, name, 1));
+	CuAssertPtrEquals(tc, &datum_c, cil_resolve_cache_lookup(cache, &scope_b, other, 0));
+
+	cil_resolve_cache_insert(cache, &scope_a, name, 0, &datum_b);
+	CuAssertPtrEquals(tc, &datum_b, cil_resolve_cache_lookup(cache, &scope_a, name, 0));
+
+	cil_resolve_cache_invalidate(cache, other, 0);
+	CuAssertPtrEquals(tc, &datum_b, cil_resolve_cache_lookup(cache, &scope_a, name, 0));
+	CuAssertPtrEquals(tc, NULL, cil_resolve_cache_lookup(cache, &scope_b, other, 0));
+
+	cil_resolve_cache_destroy(&cache);
+}
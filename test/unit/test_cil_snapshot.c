@@ -0,0 +1,274 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sepol/policydb.h>
+
+#include "CuTest.h"
+#include "test_cil_snapshot.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_symtab.h"
+#include "../../src/cil_strpool.h"
+
+static char *__test_snapshot_base =
+	"(class file (read write))\n"
+	"(classorder (file))\n"
+	"(sid kernel)\n"
+	"(sidorder (kernel))\n"
+	"(user u)\n"
+	"(role r)\n"
+	"(type t)\n"
+	"(category c0)\n"
+	"(categoryorder (c0))\n"
+	"(sensitivity s0)\n"
+	"(sensitivityorder (s0))\n"
+	"(sensitivitycategory s0 (c0))\n"
+	"(allow t self (file (read)))\n"
+	"(roletype r t)\n"
+	"(userrole u r)\n"
+	"(userlevel u (s0))\n"
+	"(userrange u ((s0)(s0 (c0))))\n"
+	"(sidcontext kernel (u r t ((s0)(s0))))\n"
+	"(typeattribute domain)\n"
+	"(typeattributeset domain (t))\n"
+	"(block tmpl (blockabstract tmpl) (type exec))\n"
+	"(optional o (allow t missing (file (read))))\n";
+
+static int __test_snapshot_compile(struct cil_db *db, char *str) {
+	sepol_policydb_t *pdb = NULL;
+	int rc;
+
+	rc = cil_add_file(db, "test.cil", str, strlen(str));
+	if (rc != SEPOL_OK) {
+		return rc;
+	}
+
+	sepol_policydb_create(&pdb);
+	rc = cil_compile(db, pdb);
+	sepol_policydb_free(pdb);
+
+	return rc;
+}
+
+static struct cil_symtab_datum *__test_snapshot_lookup(struct cil_db *db, enum cil_sym_index sym_index, char *name) {
+	struct cil_symtab_datum *datum = NULL;
+	struct cil_root *root = db->ast->root->data;
+
+	cil_symtab_get_datum(&root->symtab[sym_index], cil_strpool_add(name), &datum);
+
+	return datum;
+}
+
+void test_cil_snapshot_save_load(CuTest *tc) {
+	char path[] = "/tmp/cil_snapshot_XXXXXX";
+	struct cil_db *test_db;
+	struct cil_db *loaded_db = NULL;
+	struct cil_type *type;
+	struct cil_typeattribute *attr;
+	int fd = mkstemp(path);
+	close(fd);
+
+	cil_db_init(&test_db);
+	int rc = __test_snapshot_compile(test_db, __test_snapshot_base);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	rc = cil_db_save(test_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	cil_db_destroy(&test_db);
+
+	rc = cil_db_load(&loaded_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertPtrNotNull(tc, loaded_db);
+
+	type = (struct cil_type *)__test_snapshot_lookup(loaded_db, CIL_SYM_TYPES, "t");
+	CuAssertPtrNotNull(tc, type);
+	CuAssertStrEquals(tc, "t", type->datum.fqn);
+	CuAssertIntEquals(tc, 1, type->datum.nodes.count);
+	attr = (struct cil_typeattribute *)__test_snapshot_lookup(loaded_db, CIL_SYM_TYPES, "domain");
+	CuAssertPtrNotNull(tc, attr->types);
+	CuAssertIntEquals(tc, 1, ebitmap_get_bit(attr->types, type->value));
+
+	/* Statements added to the loaded database are resolved against it */
+	rc = __test_snapshot_compile(loaded_db, "(type m)\n(typeattributeset domain (m))\n(block b (blockinherit tmpl))\n(allow m b.exec (file (write)))\n");
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	type = (struct cil_type *)__test_snapshot_lookup(loaded_db, CIL_SYM_TYPES, "m");
+	CuAssertPtrNotNull(tc, type);
+	attr = (struct cil_typeattribute *)__test_snapshot_lookup(loaded_db, CIL_SYM_TYPES, "domain");
+	CuAssertIntEquals(tc, 1, ebitmap_get_bit(attr->types, type->value));
+	CuAssertIntEquals(tc, 3, loaded_db->num_types);
+
+	cil_db_destroy(&loaded_db);
+	unlink(path);
+}
+
+static void __test_snapshot_check_evaluated(CuTest *tc, struct cil_db *db) {
+	struct cil_catset *catset;
+	struct cil_classpermission *cp;
+	struct cil_classperms *perms;
+
+	catset = (struct cil_catset *)__test_snapshot_lookup(db, CIL_SYM_CATS, "cs");
+	CuAssertPtrNotNull(tc, catset);
+	CuAssertIntEquals(tc, CIL_TRUE, catset->cats->evaluated);
+	CuAssertIntEquals(tc, 1, catset->cats->datums.count);
+	CuAssertStrEquals(tc, "c0", DATUM(cil_vector_get(&catset->cats->datums, 0))->fqn);
+
+	cp = (struct cil_classpermission *)__test_snapshot_lookup(db, CIL_SYM_CLASSPERMSETS, "cpm");
+	CuAssertPtrNotNull(tc, cp);
+	perms = cp->classperms->head->data;
+	CuAssertIntEquals(tc, CIL_TRUE, perms->evaluated);
+	CuAssertIntEquals(tc, 1, perms->datums.count);
+	CuAssertStrEquals(tc, "write", DATUM(cil_vector_get(&perms->datums, 0))->fqn);
+}
+
+void test_cil_snapshot_save_load_evaluated(CuTest *tc) {
+	char path[] = "/tmp/cil_snapshot_XXXXXX";
+	char *sets = "(categoryset cs (all))\n(classpermission cpm)\n(classpermissionset cpm (file (not (read))))\n";
+	struct cil_db *test_db;
+	struct cil_db *loaded_db = NULL;
+	int fd = mkstemp(path);
+	close(fd);
+
+	cil_db_init(&test_db);
+	int rc = cil_add_file(test_db, "base.cil", __test_snapshot_base, strlen(__test_snapshot_base));
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	rc = __test_snapshot_compile(test_db, sets);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	__test_snapshot_check_evaluated(tc, test_db);
+	rc = cil_db_save(test_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	cil_db_destroy(&test_db);
+
+	rc = cil_db_load(&loaded_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	__test_snapshot_check_evaluated(tc, loaded_db);
+
+	cil_db_destroy(&loaded_db);
+	unlink(path);
+}
+
+void test_cil_snapshot_load_twice(CuTest *tc) {
+	char path[] = "/tmp/cil_snapshot_XXXXXX";
+	struct cil_db *test_db;
+	struct cil_db *first_db = NULL;
+	struct cil_db *second_db = NULL;
+	struct cil_type *first;
+	struct cil_type *second;
+	int fd = mkstemp(path);
+	close(fd);
+
+	cil_db_init(&test_db);
+	int rc = __test_snapshot_compile(test_db, __test_snapshot_base);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	rc = cil_db_save(test_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	cil_db_destroy(&test_db);
+
+	/* The second image cannot go where the first one went */
+	rc = cil_db_load(&first_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	rc = cil_db_load(&second_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+
+	first = (struct cil_type *)__test_snapshot_lookup(first_db, CIL_SYM_TYPES, "t");
+	second = (struct cil_type *)__test_snapshot_lookup(second_db, CIL_SYM_TYPES, "t");
+	CuAssertPtrNotNull(tc, first);
+	CuAssertPtrNotNull(tc, second);
+	CuAssertTrue(tc, first != second);
+	CuAssertPtrEquals(tc, first->datum.name, second->datum.name);
+	CuAssertPtrEquals(tc, second_db->ast->root, cil_tree_node_parent(NODE(second)));
+
+	rc = __test_snapshot_compile(second_db, "(type m)\n(typeattributeset domain (m))\n");
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 2, second_db->num_types);
+	CuAssertIntEquals(tc, 1, first_db->num_types);
+
+	cil_db_destroy(&first_db);
+	cil_db_destroy(&second_db);
+	unlink(path);
+}
+
+void test_cil_snapshot_save_uncompiled_neg(CuTest *tc) {
+	char path[] = "/tmp/cil_snapshot_XXXXXX";
+	struct cil_db *test_db;
+	int fd = mkstemp(path);
+	close(fd);
+	unlink(path);
+
+	cil_db_init(&test_db);
+	int rc = cil_db_save(test_db, path);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertIntEquals(tc, -1, access(path, F_OK));
+
+	cil_db_destroy(&test_db);
+}
+
+void test_cil_snapshot_load_damaged_neg(CuTest *tc) {
+	char path[] = "/tmp/cil_snapshot_XXXXXX";
+	struct cil_db *test_db;
+	FILE *file;
+	long size;
+	int byte;
+	int fd = mkstemp(path);
+	close(fd);
+
+	cil_db_init(&test_db);
+	int rc = __test_snapshot_compile(test_db, __test_snapshot_base);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	rc = cil_db_save(test_db, path);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	cil_db_destroy(&test_db);
+
+	file = fopen(path, "r+");
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	/* Only the header and the locs are checksummed, so damage a field of
+	 * the header that is not otherwise checked */
+	fseek(file, 40, SEEK_SET);
+	byte = fgetc(file);
+	fseek(file, 40, SEEK_SET);
+	fputc(byte ^ 0x10, file);
+	fclose(file);
+
+	test_db = NULL;
+	rc = cil_db_load(&test_db, path);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertPtrEquals(tc, NULL, test_db);
+
+	rc = truncate(path, size / 2);
+	CuAssertIntEquals(tc, 0, rc);
+	rc = cil_db_load(&test_db, path);
+	CuAssertIntEquals(tc, SEPOL_ERR, rc);
+	CuAssertPtrEquals(tc, NULL, test_db);
+
+	unlink(path);
+}
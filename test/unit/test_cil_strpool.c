@@ -0,0 +1,160 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <sepol/policydb/policydb.h>
+
+#include "CuTest.h"
+#include "test_cil_strpool.h"
+
+#include "../../src/cil_internal.h"
+#include "../../src/cil_strpool.h"
+
+void test_cil_strpool_add(CuTest *tc) {
+	char buffer[] = "name";
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	char *str = cil_strpool_add("name");
+	CuAssertStrEquals(tc, "name", str);
+	CuAssertPtrEquals(tc, str, cil_strpool_add(buffer));
+	CuAssertTrue(tc, str != cil_strpool_add("name2"));
+	CuAssertIntEquals(tc, 4, cil_strpool_len(str));
+	CuAssertTrue(tc, cil_strpool_hash(str) != cil_strpool_hash(cil_strpool_add("name2")));
+	CuAssertIntEquals(tc, 0, cil_strpool_len(cil_strpool_add("")));
+
+	cil_db_destroy(&test_db);
+}
+
+void test_cil_strpool_add_grow(CuTest *tc) {
+	char name[32];
+	char *strs[20000];
+	int i;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	for (i = 0; i < 20000; i++) {
+		snprintf(name, sizeof(name), "symbol_%d", i);
+		strs[i] = cil_strpool_add(name);
+	}
+
+	for (i = 0; i < 20000; i++) {
+		snprintf(name, sizeof(name), "symbol_%d", i);
+		CuAssertPtrEquals(tc, strs[i], cil_strpool_add(name));
+		CuAssertStrEquals(tc, name, strs[i]);
+	}
+
+	cil_db_destroy(&test_db);
+}
+
+void test_cil_strpool_keyword(CuTest *tc) {
+	char buffer[] = "block";
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	CuAssertPtrEquals(tc, CIL_KEY_BLOCK, cil_strpool_add("block"));
+	CuAssertIntEquals(tc, CIL_KEYWORD_BLOCK, cil_strpool_keyword(CIL_KEY_BLOCK));
+	CuAssertIntEquals(tc, CIL_KEYWORD_MLS, cil_strpool_keyword(CIL_KEY_MLS));
+	CuAssertIntEquals(tc, CIL_KEYWORD_NONE, cil_strpool_keyword(CIL_KEY_SELF));
+	CuAssertIntEquals(tc, CIL_KEYWORD_NONE, cil_strpool_keyword(buffer));
+
+	cil_db_destroy(&test_db);
+}
+
+void test_cil_strpool_name(CuTest *tc) {
+	const struct cil_strpool_name *name;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	name = cil_strpool_name(cil_strpool_add("a.bb..c"));
+	CuAssertIntEquals(tc, 3, name->count);
+	CuAssertIntEquals(tc, 0, name->leading_dot);
+	CuAssertPtrEquals(tc, cil_strpool_add("a"), name->segments[0]);
+	CuAssertPtrEquals(tc, cil_strpool_add("bb"), name->segments[1]);
+	CuAssertPtrEquals(tc, cil_strpool_add("c"), name->segments[2]);
+	CuAssertPtrEquals(tc, (void *)name, (void *)cil_strpool_name(cil_strpool_add("a.bb..c")));
+
+	name = cil_strpool_name(cil_strpool_add(".a"));
+	CuAssertIntEquals(tc, 1, name->count);
+	CuAssertIntEquals(tc, 1, name->leading_dot);
+	CuAssertPtrEquals(tc, cil_strpool_add("a"), name->segments[0]);
+
+	name = cil_strpool_name(cil_strpool_add(".."));
+	CuAssertIntEquals(tc, 0, name->count);
+
+	cil_db_destroy(&test_db);
+}
+
+#define TEST_STRPOOL_THREADS	4
+#define TEST_STRPOOL_STRINGS	20000
+
+static void *__test_strpool_intern(void *arg)
+{
+	char **strs = arg;
+	char name[32];
+	int i;
+
+	for (i = 0; i < TEST_STRPOOL_STRINGS; i++) {
+		snprintf(name, sizeof(name), "thread_symbol_%d", i);
+		strs[i] = cil_strpool_add(name);
+	}
+
+	return NULL;
+}
+
+void test_cil_strpool_threads(CuTest *tc) {
+	static char *strs[TEST_STRPOOL_THREADS][TEST_STRPOOL_STRINGS];
+	pthread_t threads[TEST_STRPOOL_THREADS];
+	int i, j;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	for (i = 0; i < TEST_STRPOOL_THREADS; i++) {
+		CuAssertIntEquals(tc, 0, pthread_create(&threads[i], NULL, __test_strpool_intern, strs[i]));
+	}
+	for (i = 0; i < TEST_STRPOOL_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	for (j = 0; j < TEST_STRPOOL_STRINGS; j++) {
+		for (i = 1; i < TEST_STRPOOL_THREADS; i++) {
+			CuAssertPtrEquals(tc, strs[0][j], strs[i][j]);
+		}
+	}
+
+	cil_db_destroy(&test_db);
+}
@@ -27,6 +27,8 @@
  * either expressed or implied, of Tresys Technology, LLC.
  */
 
+#include <stdio.h>
+
 #include <sepol/policydb/policydb.h>
 
 #include "CuTest.h"
@@ -35,9 +37,10 @@
 #include "../../src/cil_tree.h"
 #include "../../src/cil_symtab.h"
 #include "../../src/cil_internal.h"
+#include "../../src/cil_strpool.h"
 
 void test_cil_symtab_insert(CuTest *tc) {
-	symtab_t *test_symtab = NULL;
+	struct cil_symtab *test_symtab = NULL;
 	char* test_name = "test";
 	struct cil_block *test_block = malloc(sizeof(*test_block));
 
@@ -47,15 +50,153 @@ void test_cil_symtab_insert(CuTest *tc) {
 	struct cil_db *test_db;
 	cil_db_init(&test_db);   
 
-	test_ast_node->parent = test_db->ast->root;
-	test_ast_node->line = 1;
+	cil_tree_node_set_parent(test_ast_node, test_db->ast->root);
+	test_ast_node->loc = 0;
 
 	cil_symtab_array_init(test_block->symtab, cil_sym_sizes[CIL_SYM_ARRAY_BLOCK]);
 
 	test_block->is_abstract = 0;
 
-	cil_get_symtab(test_db, test_ast_node->parent, &test_symtab, CIL_SYM_BLOCKS);
+	cil_get_symtab(test_db, cil_tree_node_parent(test_ast_node), &test_symtab, CIL_SYM_BLOCKS);
 
 	int rc = cil_symtab_insert(test_symtab, (hashtab_key_t)test_name, (struct cil_symtab_datum*)test_block, test_ast_node);
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 }
+
+void test_cil_symtab_get_datum(CuTest *tc) {
+	char buffer[] = "test";
+	struct cil_symtab symtab;
+	struct cil_symtab_datum datum;
+	struct cil_symtab_datum *found = NULL;
+	struct cil_tree_node *test_ast_node;
+	cil_tree_node_init(&test_ast_node);
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	char *key = cil_strpool_add("test");
+
+	cil_symtab_init(&symtab, 1);
+	cil_symtab_datum_init(&datum);
+
+	int rc = cil_symtab_insert(&symtab, key, &datum, test_ast_node);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, SEPOL_EEXIST, cil_symtab_insert(&symtab, key, &datum, test_ast_node));
+
+	CuAssertIntEquals(tc, SEPOL_OK, cil_symtab_get_datum(&symtab, cil_strpool_add(buffer), &found));
+	CuAssertPtrEquals(tc, &datum, found);
+
+	/* Keys are compared by address, not content */
+	CuAssertIntEquals(tc, SEPOL_ENOENT, cil_symtab_get_datum(&symtab, buffer, &found));
+	CuAssertPtrEquals(tc, NULL, found);
+
+	cil_symtab_destroy(&symtab);
+	CuAssertPtrEquals(tc, NULL, datum.symtab);
+	cil_db_destroy(&test_db);
+}
+
+static int __test_cil_symtab_order(hashtab_key_t k, hashtab_datum_t d, void *args)
+{
+	struct cil_symtab_datum ***next = args;
+
+	if (**next != d || ((struct cil_symtab_datum *)d)->name != k) {
+		return SEPOL_ERR;
+	}
+	(*next)++;
+	/* Skip the datums removed by the test */
+	while (**next != NULL && (**next)->symtab == NULL) {
+		(*next)++;
+	}
+
+	return SEPOL_OK;
+}
+
+void test_cil_symtab_remove_grow(CuTest *tc) {
+	char name[32];
+	struct cil_symtab symtab;
+	struct cil_symtab_datum datums[5000];
+	struct cil_symtab_datum *order[5001];
+	struct cil_symtab_datum **next = order;
+	struct cil_symtab_datum *found = NULL;
+	struct cil_tree_node *test_ast_node;
+	cil_tree_node_init(&test_ast_node);
+	int i;
+
+	struct cil_db *test_db;
+	cil_db_init(&test_db);
+
+	cil_symtab_init(&symtab, 1);
+
+	for (i = 0; i < 5000; i++) {
+		snprintf(name, sizeof(name), "symbol_%d", i);
+		cil_symtab_datum_init(&datums[i]);
+		cil_symtab_insert(&symtab, cil_strpool_add(name), &datums[i], test_ast_node);
+		order[i] = &datums[i];
+		if (i % 3 == 0) {
+			cil_symtab_remove_datum(&datums[i]);
+		}
+	}
+	order[5000] = NULL;
+
+	for (i = 0; i < 5000; i++) {
+		snprintf(name, sizeof(name), "symbol_%d", i);
+		int rc = cil_symtab_get_datum(&symtab, cil_strpool_add(name), &found);
+		if (i % 3 == 0) {
+			CuAssertIntEquals(tc, SEPOL_ENOENT, rc);
+		} else {
+			CuAssertIntEquals(tc, SEPOL_OK, rc);
+			CuAssertPtrEquals(tc, &datums[i], found);
+		}
+	}
+
+	/* Map visits the remaining datums in insertion order */
+	next++;
+	CuAssertIntEquals(tc, SEPOL_OK, cil_symtab_map(&symtab, __test_cil_symtab_order, &next));
+	CuAssertPtrEquals(tc, NULL, *next);
+
+	cil_symtab_destroy(&symtab);
+	cil_db_destroy(&test_db);
+}
+
+void test_cil_complex_symtab_insert(CuTest *tc) {
+	struct cil_complex_symtab symtab;
+	struct cil_complex_symtab_key ckey;
+	struct cil_complex_symtab_datum datum;
+	struct cil_complex_symtab_datum *found = NULL;
+	intptr_t values[50000];
+	int i;
+
+	cil_complex_symtab_init(&symtab, 4);
+
+	for (i = 0; i < 50000; i++) {
+		ckey.key1 = i % 7;
+		ckey.key2 = i;
+		ckey.key3 = i / 3;
+		ckey.key4 = 1;
+		values[i] = i;
+		datum.data = &values[i];
+		CuAssertIntEquals(tc, SEPOL_OK, cil_complex_symtab_insert(&symtab, &ckey, &datum));
+	}
+
+	/* The table keeps its own copy of each key */
+	ckey.key1 = 3;
+	ckey.key2 = 10;
+	ckey.key3 = 3;
+	datum.data = NULL;
+	CuAssertIntEquals(tc, SEPOL_EEXIST, cil_complex_symtab_insert(&symtab, &ckey, &datum));
+
+	for (i = 0; i < 50000; i++) {
+		ckey.key1 = i % 7;
+		ckey.key2 = i;
+		ckey.key3 = i / 3;
+		cil_complex_symtab_search(&symtab, &ckey, &found);
+		CuAssertPtrNotNull(tc, found);
+		CuAssertPtrEquals(tc, &values[i], found->data);
+	}
+
+	ckey.key4 = 2;
+	cil_complex_symtab_search(&symtab, &ckey, &found);
+	CuAssertPtrEquals(tc, NULL, found);
+
+	cil_complex_symtab_destroy(&symtab);
+}
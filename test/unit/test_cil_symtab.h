@@ -33,5 +33,8 @@
 #include "CuTest.h"
 
 void test_cil_symtab_insert(CuTest *);
+void test_cil_symtab_get_datum(CuTest *);
+void test_cil_symtab_remove_grow(CuTest *);
+void test_cil_complex_symtab_insert(CuTest *);
 
 #endif
@@ -40,15 +40,15 @@ void test_cil_tree_node_init(CuTest *tc) {
    cil_tree_node_init(&test_node);
 
    CuAssertPtrNotNull(tc, test_node);
-   CuAssertPtrEquals(tc, NULL, test_node->cl_head);
-   CuAssertPtrEquals(tc, NULL, test_node->cl_tail);
-   CuAssertPtrEquals(tc, NULL, test_node->parent);
+   CuAssertPtrEquals(tc, NULL, cil_tree_node_head(test_node));
+   CuAssertPtrEquals(tc, NULL, cil_tree_node_tail(test_node));
+   CuAssertPtrEquals(tc, NULL, cil_tree_node_parent(test_node));
    CuAssertPtrEquals(tc, NULL, test_node->data);
-   CuAssertPtrEquals(tc, NULL, test_node->next);
+   CuAssertPtrEquals(tc, NULL, cil_tree_node_next(test_node));
    CuAssertIntEquals(tc, 0, test_node->flavor);
-   CuAssertIntEquals(tc, 0, test_node->line);
+   CuAssertIntEquals(tc, 0, cil_tree_node_line(test_node));
 
-   free(test_node);
+   cil_tree_node_destroy(&test_node);
 }
 
 void test_cil_tree_init(CuTest *tc) {
@@ -58,14 +58,98 @@ void test_cil_tree_init(CuTest *tc) {
 
 	CuAssertIntEquals(tc, SEPOL_OK, rc);
 	CuAssertPtrNotNull(tc, test_tree);
-	CuAssertPtrEquals(tc, NULL, test_tree->root->cl_head);
-	CuAssertPtrEquals(tc, NULL, test_tree->root->cl_tail);
-	CuAssertPtrEquals(tc, NULL, test_tree->root->parent);
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_head(test_tree->root));
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_tail(test_tree->root));
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_parent(test_tree->root));
 	CuAssertPtrEquals(tc, NULL, test_tree->root->data);
-	CuAssertPtrEquals(tc, NULL, test_tree->root->next);
+	CuAssertPtrEquals(tc, NULL, cil_tree_node_next(test_tree->root));
 	CuAssertIntEquals(tc, 0, test_tree->root->flavor);
-	CuAssertIntEquals(tc, 0, test_tree->root->line);
+	CuAssertIntEquals(tc, 0, cil_tree_node_line(test_tree->root));
 
-	free(test_tree);
+	cil_tree_destroy(&test_tree);
 }
 
+
+static int __test_count_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args) {
+	int *count = extra_args;
+
+	(*count)++;
+	if (node->flavor == CIL_IN) {
+		*finished = CIL_TREE_SKIP_HEAD;
+	}
+
+	return SEPOL_OK;
+}
+
+static int __test_first_helper(struct cil_tree_node *node, uint32_t *finished, void *extra_args) {
+	int *count = extra_args;
+
+	(*count)++;
+	if (node->flavor == CIL_IN) {
+		*finished = CIL_TREE_SKIP_NEXT;
+	}
+
+	return SEPOL_OK;
+}
+
+static struct cil_tree_node *__test_add_child(struct cil_tree_node *parent, enum cil_flavor flavor) {
+	struct cil_tree_node *node;
+
+	cil_tree_node_init(&node);
+	node->flavor = flavor;
+	cil_tree_node_set_parent(node, parent);
+	if (cil_tree_node_head(parent) == NULL) {
+		cil_tree_node_set_head(parent, node);
+	} else {
+		cil_tree_node_set_next(cil_tree_node_tail(parent), node);
+	}
+	cil_tree_node_set_tail(parent, node);
+
+	return node;
+}
+
+void test_cil_tree_walk_fused(CuTest *tc) {
+	struct cil_tree *test_tree;
+	struct cil_tree_node *block;
+	struct cil_tree_node *node;
+	int all = 0;
+	int skip_head = 0;
+	int skip_next = 0;
+	int i;
+
+	/* node (in node (in (condblock (condblock ...)))) node */
+	cil_tree_init(&test_tree);
+	__test_add_child(test_tree->root, CIL_NODE);
+	block = __test_add_child(test_tree->root, CIL_IN);
+	__test_add_child(block, CIL_NODE);
+	node = __test_add_child(block, CIL_IN);
+	for (i = 0; i < 100; i++) {
+		node = __test_add_child(node, CIL_CONDBLOCK);
+	}
+	__test_add_child(test_tree->root, CIL_NODE);
+
+	struct cil_tree_visitor visitors[] = {
+		{ NULL, NULL },
+		{ __test_count_helper, &skip_head },
+		{ __test_first_helper, &skip_next },
+	};
+
+	int rc = cil_tree_walk_fused(test_tree->root, visitors, 3);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, skip_head);
+	CuAssertIntEquals(tc, 2, skip_next);
+
+	rc = cil_tree_walk(test_tree->root, __test_count_helper, NULL, NULL, &all);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 3, all);
+
+	visitors[1].extra_args = &all;
+	visitors[1].process_node = NULL;
+	all = 0;
+	skip_next = 0;
+	rc = cil_tree_walk_fused(test_tree->root, visitors, 3);
+	CuAssertIntEquals(tc, SEPOL_OK, rc);
+	CuAssertIntEquals(tc, 2, skip_next);
+
+	cil_tree_destroy(&test_tree);
+}
@@ -34,5 +34,6 @@
 
 void test_cil_tree_node_init(CuTest *);
 void test_cil_tree_init(CuTest *);
+void test_cil_tree_walk_fused(CuTest *);
 
 #endif
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2014 Tresys Technology, LLC. All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ *    1. Redistributions of source code must retain the above copyright notice,
+ *       this list of conditions and the following disclaimer.
+ * 
+ *    2. Redistributions in binary form must reproduce the above copyright notice,
+ *       this list of conditions and the following disclaimer in the documentation
+ *       and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY TRESYS TECHNOLOGY, LLC ``AS IS'' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL TRESYS TECHNOLOGY, LLC OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of Tresys Technology, LLC.
+ */
+
+#include <stdlib.h>
+
+#include <sepol/errcodes.h>
+
+#include "CuTest.h"
+#include "test_cil_vector.h"
+
+#include "../../src/cil_vector.h"
+
+void test_cil_vector_append_inline(CuTest *tc) {
+	struct cil_vector vector;
+	int a, b;
+
+	cil_vector_init(&vector);
+	cil_vector_append(&vector, &a);
+	cil_vector_append(&vector, &b);
+
+	CuAssertIntEquals(tc, 2, vector.count);
+	CuAssertIntEquals(tc, CIL_VECTOR_INLINE, vector.alloc);
+	CuAssertPtrEquals(tc, &a, cil_vector_get(&vector, 0));
+	CuAssertPtrEquals(tc, &b, cil_vector_get(&vector, 1));
+
+	cil_vector_destroy(&vector);
+	CuAssertIntEquals(tc, 0, vector.count);
+}
+
+void test_cil_vector_append_grow(CuTest *tc) {
+	struct cil_vector vector;
+	int values[100];
+	void *data;
+	uint32_t i;
+
+	cil_vector_init(&vector);
+	for (i = 0; i < 100; i++) {
+		cil_vector_append(&vector, &values[i]);
+	}
+
+	CuAssertIntEquals(tc, 100, vector.count);
+	cil_vector_for_each(data, i, &vector) {
+		CuAssertPtrEquals(tc, &values[i], data);
+	}
+
+	cil_vector_destroy(&vector);
+}
+
+void test_cil_vector_remove(CuTest *tc) {
+	struct cil_vector vector;
+	int a, b, c;
+
+	cil_vector_init(&vector);
+	cil_vector_append(&vector, &a);
+	cil_vector_append(&vector, &b);
+	cil_vector_append(&vector, &c);
+
+	CuAssertIntEquals(tc, SEPOL_OK, cil_vector_remove(&vector, &a));
+	CuAssertIntEquals(tc, 2, vector.count);
+	CuAssertPtrEquals(tc, &b, cil_vector_get(&vector, 0));
+	CuAssertPtrEquals(tc, &c, cil_vector_get(&vector, 1));
+	CuAssertIntEquals(tc, SEPOL_ENOENT, cil_vector_remove(&vector, &a));
+
+	cil_vector_destroy(&vector);
+}
+
+void test_cil_array_grow(CuTest *tc) {
+	struct pair { uint32_t a; uint32_t b; } *pairs = NULL;
+	uint32_t count = 0;
+	uint32_t alloc = 0;
+	uint32_t i;
+
+	for (i = 0; i < 100; i++) {
+		pairs = cil_array_grow(pairs, count, &alloc, sizeof(*pairs), 4);
+		pairs[count].a = i;
+		pairs[count].b = i * 2;
+		count++;
+	}
+
+	CuAssertIntEquals(tc, 128, alloc);
+	for (i = 0; i < count; i++) {
+		CuAssertIntEquals(tc, i, pairs[i].a);
+		CuAssertIntEquals(tc, i * 2, pairs[i].b);
+	}
+
+	free(pairs);
+}